@@ -0,0 +1,130 @@
+"""
+
+Copyright:
+Copyright (c) 2022 Microsoft Research
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+"""
+
+# Writes the binary input files read by EzPC-generated SCI and FSS programs
+# when EZPC_INPUT_FILE is set (format: SCI/src/utils/binary_input.h).
+#
+# Examples:
+#   # weights dumped as fixed-point text (the file normally piped to stdin)
+#   python3 convert_fixedpt_to_binary.py --inp model_weights.inp --output model_weights.bin
+#
+#   # 25 million random 12-bit values, e.g. to benchmark a model without weights
+#   python3 convert_fixedpt_to_binary.py --prg 25000000:12 --output random.bin
+#
+#   EZPC_INPUT_FILE=model_weights.bin ./resnet50 r=1 ...
+#
+# --inp and --prg can be repeated; records are written in the order given.
+
+import argparse
+from argparse import RawTextHelpFormatter
+from array import array
+import os
+import struct
+import sys
+
+MAGIC = b"EZPCINP1"
+KIND_RAW = 0
+KIND_PRG = 1
+MASK64 = (1 << 64) - 1
+
+
+def prg_value(seed, i, bits):
+    """Python mirror of binary_input::prgValue."""
+    z = (seed + (i + 1) * 0x9E3779B97F4A7C15) & MASK64
+    z = ((z ^ (z >> 30)) * 0xBF58476D1CE4E5B9) & MASK64
+    z = ((z ^ (z >> 27)) * 0x94D049BB133111EB) & MASK64
+    z ^= z >> 31
+    if bits == 0 or bits >= 64:
+        return z - (1 << 64) if z >> 63 else z
+    m = 1 << (bits - 1)
+    z &= (m << 1) - 1
+    return (z ^ m) - m
+
+
+def parse_prg(spec):
+    parts = spec.split(":")
+    if len(parts) not in (2, 3):
+        raise argparse.ArgumentTypeError("expected COUNT:BITS[:SEED], got " + spec)
+    count, bits = int(parts[0]), int(parts[1])
+    seed = int(parts[2], 0) if len(parts) == 3 else int.from_bytes(os.urandom(8), "little")
+    if count < 0 or not 0 <= bits <= 64:
+        raise argparse.ArgumentTypeError("bad PRG record " + spec)
+    return ("prg", (count, bits, seed & MASK64))
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(formatter_class=RawTextHelpFormatter)
+    parser.add_argument(
+        "--inp",
+        dest="records",
+        action="append",
+        type=lambda s: ("inp", s),
+        help="Text file of whitespace separated fixed-point integers\n"
+        "(as fed on stdin); '-' reads stdin",
+    )
+    parser.add_argument(
+        "--prg",
+        dest="records",
+        action="append",
+        type=parse_prg,
+        help="COUNT:BITS[:SEED] -- COUNT pseudorandom values in\n"
+        "[-2^(BITS-1), 2^(BITS-1)); the seed is random if omitted",
+    )
+    parser.add_argument(
+        "--output", required=True, type=str, help="Path of the binary input file"
+    )
+    args = parser.parse_args()
+    if not args.records:
+        parser.error("give at least one --inp or --prg")
+    return args
+
+
+def write_raw(out, path):
+    f = sys.stdin if path == "-" else open(path)
+    with f:
+        tokens = f.read().split()
+    # Parse through Python ints: values may be written as unsigned 64-bit
+    vals = array("Q", (int(t) & MASK64 for t in tokens))
+    if sys.byteorder != "little":
+        vals.byteswap()
+    out.write(struct.pack("<IIQ", KIND_RAW, 0, len(vals)))
+    out.write(vals.tobytes())
+    return len(vals)
+
+
+def write_prg(out, count, bits, seed):
+    out.write(struct.pack("<IIQ", KIND_PRG, bits, count))
+    out.write(struct.pack("<Q", seed))
+    return count
+
+
+if __name__ == "__main__":
+    args = parse_args()
+    total = 0
+    with open(args.output, "wb") as out:
+        out.write(MAGIC)
+        for kind, val in args.records:
+            if kind == "inp":
+                total += write_raw(out, val)
+            else:
+                total += write_prg(out, *val)
+    print("Wrote {} values to {}".format(total, args.output))
@@ -59,6 +59,7 @@ type codegen_stmt =
   | If_codegen     of label * codegen_expr * codegen_stmt * codegen_stmt option  (* the label is used only in the oblivc backend, since secret conditionals become obliv if statements *)
   | Seq_codegen    of codegen_stmt * codegen_stmt
   | Output_s       of role * codegen_expr * codegen_expr * base_type (* only used by oblivc backend, first expression is add_to_output_queue return value -- this is where the clear output will be put, second expression is the secret expression, base_type is the base type of the secret expression *)
+  | Read_bin       of codegen_expr * codegen_expr * codegen_expr * codegen_stmt (* only used by the SCI backend, destination buffer, number of values, whether this party owns the input, and the statement that reads them from stdin if no binary input file was given *)
 
 type codegen_program = global list * codegen_stmt list
 
@@ -399,10 +399,11 @@ let rec o_stmt (g:gamma) (s:stmt) :comp * gamma =
                       ) (0, Var x |> mk_dsyntax "") el))
      in
 
-     (* this is the innermost loop body *)
-     let base_init =
-       let role_var = { name = "party"; index = 0 } in
-       let r_cmp = Base_e (Binop (Is_equal, Var role_var |> mk_dsyntax "", Role r |> mk_dsyntax "", Some Public) |> mk_dsyntax "") in
+     let role_var = { name = "party"; index = 0 } in
+     let r_cmp = Base_e (Binop (Is_equal, Var role_var |> mk_dsyntax "", Role r |> mk_dsyntax "", Some Public) |> mk_dsyntax "") in
+
+     (* this is the innermost loop body, split into the cin and the assignment *)
+     let base_cin, base_assgn =
        (* if role == r then cin into the temporary variable *)
        let cin = Cin ("cin", Base_e (Var tmp_var_name |> mk_dsyntax "") , bt) in
 
@@ -415,24 +416,41 @@ let rec o_stmt (g:gamma) (s:stmt) :comp * gamma =
                                                           Input_g (r, sl, tmp_var_name, bt),
                                                           Dummy_g (sl, bt), Public))
          in
-         Seq_codegen (cin, assgn)
+         cin, assgn
        else
          let assgn = Assign_codegen (assgn_left,
                                      Base_e (Var tmp_var_name |> mk_dsyntax ""))
          in
-         Seq_codegen (cin, assgn)
+         cin, assgn
      in
-     
+
+     (*
+      * if the party was given a binary input file (EZPC_INPUT_FILE, see SCI/src/utils/binary_input.h),
+      * the values are copied out of it, otherwise we fall back to cin;
+      * arrays are copied in one go, skipping the loops
+      *)
+     let read_bin (dst:codegen_expr) (n:codegen_expr) (fallback:codegen_stmt) :codegen_stmt =
+       if Config.get_dummy_inputs () then fallback
+       else
+         let owner = if is_secret_label l then r_cmp else Codegen_String "true" in
+         Read_bin (dst, n, owner, fallback)
+     in
+
      (* these are the for loops on the outside, note fold_right *)
      let loops =
-       snd (List.fold_right (fun e (i, s) ->
-                let i_var = { name = "i" ^ (string_of_int i); index = 0; } in
-                i - 1,
-                For_codegen (Base_e (Var i_var |> mk_dsyntax ""),
-                             Base_e (Const (UInt32C (Uint32.of_int 0)) |> mk_dsyntax ""),
-                             Base_e e,
-                             s)
-              ) el (List.length el - 1, base_init))
+       if is_arr then
+         let loops = snd (List.fold_right (fun e (i, s) ->
+                              let i_var = { name = "i" ^ (string_of_int i); index = 0; } in
+                              i - 1,
+                              For_codegen (Base_e (Var i_var |> mk_dsyntax ""),
+                                           Base_e (Const (UInt32C (Uint32.of_int 0)) |> mk_dsyntax ""),
+                                           Base_e e,
+                                           s)
+                            ) el (List.length el - 1, Seq_codegen (base_cin, base_assgn)))
+         in
+         read_bin (Base_e (Var x |> mk_dsyntax "")) (Base_e (get_array_flat_size t)) loops
+       else
+         Seq_codegen (read_bin (Codegen_String ("&" ^ tmp_var_name.name)) (Codegen_String "1") base_cin, base_assgn)
      in
 
      (* stitch *)
@@ -530,6 +548,12 @@ and o_codegen_stmt (g:gamma) (s:codegen_stmt) :comp * gamma =
      let c2, g = o_codegen_stmt g s2 in
      seq c1 (seq o_newline c2), g
 
+  | Read_bin (dst, n, owner, fallback) ->
+     let g_body = [] |> push_local_scope g in
+     let c_read = o_app (o_str "binary_input::readArray") [o_codegen_expr g dst; o_codegen_expr g n; o_codegen_expr g owner] in
+     o_ite (seq (o_str "!") c_read) (o_codegen_stmt g_body fallback |> fst) None,
+     g
+
   | _ -> failwith "o_codegen_stmt: impossible case"
 
 let o_binder (b:binder) :comp =
@@ -29,6 +29,7 @@ SOFTWARE.
 #include "pubdiv.h"
 #include "dcf.h"
 #include "input_prng.h"
+#include "utils/trace.h"
 #include <cassert>
 #include <iostream>
 #include <assert.h>
@@ -94,6 +95,21 @@ void StartComputation()
         auto commonSeed = dealer->recv_block();
         prngShared.SetSeed(commonSeed);
     }
+
+    // layer-wise traces, enabled through EZPC_TRACE
+    trace::Tracer::instance().setParty(party);
+    trace::Tracer::instance().setCounterSource([]() {
+        trace::Counters c;
+        if (party == DEALER) {
+            c.bytesSent = server->bytesSent + client->bytesSent;
+        }
+        else {
+            c.bytesSent = peer->bytesSent;
+            c.bytesReceived = peer->bytesReceived;
+            c.rounds = numRounds;
+        }
+        return c;
+    });
 }
 
 int32_t numRounds = 0;
@@ -112,6 +128,7 @@ void EndComputation()
         std::cerr << "Offline Time = " << (dealerMicroseconds + accumulatedInputTimeOffline) / 1000.0 << " milliseconds\n";
     }
     std::cerr << "=========\n";
+    trace::Tracer::instance().close();
 }
 
 const bool parallel_reconstruct = true;
@@ -162,6 +179,7 @@ void Conv2DWrapper(int32_t N, int32_t H, int32_t W,
                    MASK_PAIR(GroupElement *outArr))
 {
     std::cerr << ">> Conv2D - Start" << std::endl;
+    TRACE_LAYER("Conv2D");
     int d0 = N;
     int d1 = ((H - FH + (zPadHLeft + zPadHRight)) / strideH) + 1;
     int d2 = ((W - FW + (zPadWLeft + zPadWRight)) / strideW) + 1;
@@ -326,6 +344,7 @@ void ARS(int32_t size, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *o
 void ScaleDown(int32_t size, MASK_PAIR(GroupElement *inArr), int32_t sf)
 {
     std::cerr << ">> ScaleDown - Start " << std::endl;
+    TRACE_LAYER("ScaleDown");
 
     if (localTruncation) {
         uint64_t m = ((1L << sf) - 1) << (bitlength - sf);
@@ -395,6 +414,7 @@ void MatMul2D(int32_t s1, int32_t s2, int32_t s3, MASK_PAIR(GroupElement *A),
             MASK_PAIR(GroupElement *B), MASK_PAIR(GroupElement *C), bool modelIsA)
 {
     std::cerr << ">> MatMul2D - Start" << std::endl;
+    TRACE_LAYER("MatMul2D");
     if (party == DEALER) {
 
         auto dealer_start = std::chrono::high_resolution_clock::now();
@@ -453,6 +473,7 @@ void ArgMax(int32_t rows, int32_t cols, MASK_PAIR(GroupElement *inp), MASK_PAIR(
     // column chunk of elements. Result maxidx is stored in out (size: rows)
 
     std::cerr << ">> ArgMax - Start" << std::endl;
+    TRACE_LAYER("ArgMax");
     always_assert(rows == 1);
     if (party == DEALER)
     { 
@@ -645,6 +666,7 @@ void Relu(int32_t size, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *
           bool doTruncation)
 {
     std::cerr << ">> Relu - Start" << std::endl;
+    TRACE_LAYER("Relu");
     // todo: handle doTruncation param
     if (party == DEALER) {
         uint64_t dealer_total_time = 0;
@@ -775,6 +797,7 @@ void MaxPool(int32_t N, int32_t H, int32_t W, int32_t C, int32_t FH,
              int32_t C1, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *outArr)) 
 {
     std::cerr << ">> MaxPool - Start" << std::endl;
+    TRACE_LAYER("MaxPool");
     int d1 = ((imgH - FH + (zPadHLeft + zPadHRight)) / strideH) + 1;
     int d2 = ((imgW - FW + (zPadWLeft + zPadWRight)) / strideW) + 1;
     always_assert(d1 == H);
@@ -925,6 +948,7 @@ void AvgPool(int32_t N, int32_t H, int32_t W, int32_t C, int32_t ksizeH,
 {
     // taken from the equivalent function in Porthos/src/EzPCFunctionalities.cpp
     std::cerr << ">> AvgPool - Start" << std::endl;
+    TRACE_LAYER("AvgPool");
     int rows = N*H*W*C;
 	std::vector<GroupElement> filterAvg(rows, 0);
     std::vector<GroupElement> filterAvg_mask(rows, 0);
@@ -1052,6 +1076,7 @@ void ElemWiseVectorPublicDiv(int32_t s1, MASK_PAIR(GroupElement *arr1), int32_t
                              MASK_PAIR(GroupElement *outArr)) 
 {
     std::cerr << ">> ElemWiseVectorPublicDiv - Start" << std::endl;
+    TRACE_LAYER("ElemWiseVectorPublicDiv");
     // if divisor is a power of 2, call fss truncate else call fss pubdiv
 
     assert(divisor > 0);
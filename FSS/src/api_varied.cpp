@@ -1535,13 +1535,13 @@ void Sigmoid_threads_helper(int thread_idx, int size, GroupElement *A, GroupElem
     }
 }
 
-void Sigmoid_dealer_threads_helper(int thread_idx, int size, int ib, int ob, int shift_in, int shift_out, GroupElement *tmpA_mask, GroupElement *tmpB_mask, pair<SplineKeyPack> *keys)
+void Sigmoid_dealer_threads_helper(int thread_idx, int size, int bitlen, int ib, int ob, int shift_in, int shift_out, GroupElement *tmpA_mask, GroupElement *tmpB_mask, pair<SplineKeyPack> *keys)
 {
     auto p = get_start_end(size, thread_idx);
     for(int i = p.first; i < p.second; ++i)
     {
         tmpB_mask[i] = random_ge(ob);
-        keys[i] = keyGenSigmoid_main_wrapper(ib, ob, shift_in, shift_out, tmpA_mask[i], tmpB_mask[i]);
+        keys[i] = keyGenSigmoid_main_wrapper(bitlen, ib, ob, shift_in, shift_out, tmpA_mask[i], tmpB_mask[i]);
     }
 }
 
@@ -1558,45 +1558,21 @@ void Sigmoid(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
              int64_t bwA, int64_t bwB, MASK_PAIR(GroupElement *A), MASK_PAIR(GroupElement *B))
 {
     always_assert(bwA == bwB);
-#ifdef SIGMOID_TANH_37
-    always_assert(bwA == 37);
-#else 
-    always_assert(bwA == 16);
-#endif
     fix_bitwidth(A, I*J, bwA);
     fix_bitwidth(A_mask, I*J, bwA);
 
     int32_t shift_in = log(scale_in);
     int32_t shift_out = log(scale_out);
 
-
-#ifdef SIGMOID_TANH_37
-    always_assert(shift_in == 12);
-    always_assert(shift_out == 12);
-    int ib = 64, ob = 64, sin = 12, scoef = 20, sout = 12, degree = 2, numPoly = 20;
-#elif defined(SIGMOID_12_12)
-    always_assert(shift_in == 12);
-    always_assert(shift_out == 12);
-    int ib = 64, ob = 64, sin = 12, scoef = 20, sout = 12, degree = 2, numPoly = 19;
-#elif defined(SIGMOID_9_14)
-    always_assert(shift_in == 9);
-    always_assert(shift_out == 14);
-    int ib = 64, ob = 64, sin = 9, scoef = 20, sout = 14, degree = 2, numPoly = 34;
-#elif defined(SIGMOID_8_14)
-    always_assert(shift_in == 8);
-    always_assert(shift_out == 14);
-    int ib = 64, ob = 64, sin = 8, scoef = 20, sout = 14, degree = 2, numPoly = 34;
-#elif defined(SIGMOID_11_14)
-    always_assert(shift_in == 11);
-    always_assert(shift_out == 14);
-    int ib = 64, ob = 64, sin = 11, scoef = 20, sout = 14, degree = 2, numPoly = 34;
-#elif defined(SIGMOID_13_14)
-    always_assert(shift_in == 13);
-    always_assert(shift_out == 14);
-    int ib = 64, ob = 64, sin = 13, scoef = 20, sout = 14, degree = 2, numPoly = 29;
-#else 
-    throw std::invalid_argument("no scales selected for sigmoid");
-#endif
+    int ib = 64, ob = 64, sin = shift_in, sout = shift_out;
+    // only the dealer builds the spline table, the evaluators take its shape
+    // from the keys
+    int scoef = 0, degree = 0;
+    if (party == DEALER) {
+        const SplineTable &table = getSplineTable(SplineFunction::Sigmoid, bwA, sin, sout);
+        scoef = table.scaleCoef;
+        degree = table.degree;
+    }
 
     GroupElement *tmpA = make_ge_array(I*J, ib);
     GroupElement *tmpA_mask = party == DEALER ? tmpA : nullptr;
@@ -1610,7 +1586,7 @@ void Sigmoid(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
 #ifdef DEALER_DIRECT_SEND
         for(int i = 0; i < I*J; ++i) {
             tmpB_mask[i] = random_ge(ob);
-            auto keys = keyGenSigmoid_main_wrapper(ib, ob, shift_in, shift_out, tmpA_mask[i], tmpB_mask[i]);
+            auto keys = keyGenSigmoid_main_wrapper(bwA, ib, ob, shift_in, shift_out, tmpA_mask[i], tmpB_mask[i]);
             server->send_spline_key(keys.first);
             client->send_spline_key(keys.second);
             freeSplineKeyPair(keys);
@@ -1623,7 +1599,7 @@ void Sigmoid(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
         std::thread thread_pool[num_threads];
 
         for(int i = 0; i < num_threads; ++i) {
-            thread_pool[i] = std::thread(Sigmoid_dealer_threads_helper, i, size, ib, ob, shift_in, shift_out, tmpA, tmpB, keys);
+            thread_pool[i] = std::thread(Sigmoid_dealer_threads_helper, i, size, bwA, ib, ob, shift_in, shift_out, tmpA, tmpB, keys);
         }
 
         for(int i = 0; i < num_threads; ++i) {
@@ -1644,7 +1620,11 @@ void Sigmoid(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
     else {
         SplineKeyPack *keys = new SplineKeyPack[I*J];
         for(int i = 0; i < I*J; ++i) {
-            keys[i] = dealer->recv_spline_key(ib, ob, numPoly, degree);
+            keys[i] = dealer->recv_spline_key(bwA, ib, ob);
+        }
+        if (I*J > 0) {
+            scoef = keys[0].scaleCoef;
+            degree = keys[0].degree;
         }
 
         peer->sync();
@@ -1679,13 +1659,13 @@ void Sigmoid(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
     delete[] tmpB;
 }
 
-void Tanh_dealer_threads_helper(int thread_idx, int size, int ib, int ob, int shift_in, int shift_out, GroupElement *tmpA_mask, GroupElement *tmpB_mask, pair<SplineKeyPack> *keys)
+void Tanh_dealer_threads_helper(int thread_idx, int size, int bitlen, int ib, int ob, int shift_in, int shift_out, GroupElement *tmpA_mask, GroupElement *tmpB_mask, pair<SplineKeyPack> *keys)
 {
     auto p = get_start_end(size, thread_idx);
     for(int i = p.first; i < p.second; ++i)
     {
         tmpB_mask[i] = random_ge(ob);
-        keys[i] = keyGenTanh_main_wrapper(ib, ob, shift_in, shift_out, tmpA_mask[i], tmpB_mask[i]);
+        keys[i] = keyGenTanh_main_wrapper(bitlen, ib, ob, shift_in, shift_out, tmpA_mask[i], tmpB_mask[i]);
     }
 }
 
@@ -1713,40 +1693,21 @@ void TanH(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
           int64_t bwA, int64_t bwB, MASK_PAIR(GroupElement *A), MASK_PAIR(GroupElement *B))
 {
     always_assert(bwA == bwB);
-#ifdef SIGMOID_TANH_37
-    always_assert(bwA == 37);
-#else 
-    always_assert(bwA == 16);
-#endif
     fix_bitwidth(A, I*J, bwA);
     fix_bitwidth(A_mask, I*J, bwA);
 
     int32_t shift_in = log(scale_in);
     int32_t shift_out = log(scale_out);
-#if defined(TANH_12_12) || defined(SIGMOID_TANH_37)
-// same spline for both cases for tanh
-    always_assert(shift_in == 12);
-    always_assert(shift_out == 12);
-    int ib = 64, ob = 64, sin = 12, scoef = 18, sout = 12, degree = 2, numPoly = 26;
-#elif defined(TANH_9_9)
-    always_assert(shift_in == 9);
-    always_assert(shift_out == 9);
-    int ib = 64, ob = 64, sin = 9, scoef = 18, sout = 9, degree = 2, numPoly = 12;
-#elif defined(TANH_8_8)
-    always_assert(shift_in == 8);
-    always_assert(shift_out == 8);
-    int ib = 64, ob = 64, sin = 8, scoef = 18, sout = 8, degree = 2, numPoly = 10;
-#elif defined(TANH_11_11)
-    always_assert(shift_in == 11);
-    always_assert(shift_out == 11);
-    int ib = 64, ob = 64, sin = 11, scoef = 18, sout = 11, degree = 2, numPoly = 20;
-#elif defined(TANH_13_13)
-    always_assert(shift_in == 13);
-    always_assert(shift_out == 13);
-    int ib = 64, ob = 64, sin = 13, scoef = 18, sout = 13, degree = 2, numPoly = 12;
-#else 
-    throw std::invalid_argument("no scales selected for tanh");
-#endif
+
+    int ib = 64, ob = 64, sin = shift_in, sout = shift_out;
+    // only the dealer builds the spline table, the evaluators take its shape
+    // from the keys
+    int scoef = 0, degree = 0;
+    if (party == DEALER) {
+        const SplineTable &table = getSplineTable(SplineFunction::Tanh, bwA, sin, sout);
+        scoef = table.scaleCoef;
+        degree = table.degree;
+    }
 
     GroupElement *tmpA = make_ge_array(I*J, ib);
     GroupElement *tmpA_mask = party == DEALER ? tmpA : nullptr;
@@ -1760,7 +1721,7 @@ void TanH(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
 #ifdef DEALER_DIRECT_SEND
         for(int i = 0; i < I*J; ++i) {
             tmpB_mask[i] = random_ge(ob);
-            auto keys = keyGenTanh_main_wrapper(ib, ob, shift_in, shift_out, tmpA_mask[i], tmpB_mask[i]);
+            auto keys = keyGenTanh_main_wrapper(bwA, ib, ob, shift_in, shift_out, tmpA_mask[i], tmpB_mask[i]);
             server->send_spline_key(keys.first);
             client->send_spline_key(keys.second);
             freeSplineKeyPair(keys);
@@ -1773,7 +1734,7 @@ void TanH(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
         std::thread thread_pool[num_threads];
 
         for(int i = 0; i < num_threads; ++i) {
-            thread_pool[i] = std::thread(Tanh_dealer_threads_helper, i, size, ib, ob, shift_in, shift_out, tmpA, tmpB, keys);
+            thread_pool[i] = std::thread(Tanh_dealer_threads_helper, i, size, bwA, ib, ob, shift_in, shift_out, tmpA, tmpB, keys);
         }
 
         for(int i = 0; i < num_threads; ++i) {
@@ -1794,7 +1755,11 @@ void TanH(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
     else {
         SplineKeyPack *keys = new SplineKeyPack[I*J];
         for(int i = 0; i < I*J; ++i) {
-            keys[i] = dealer->recv_spline_key(ib, ob, numPoly, degree);
+            keys[i] = dealer->recv_spline_key(bwA, ib, ob);
+        }
+        if (I*J > 0) {
+            scoef = keys[0].scaleCoef;
+            degree = keys[0].degree;
         }
 
         peer->sync();
@@ -1839,13 +1804,13 @@ void Invsqrt_threads_helper(int thread_idx, int size, GroupElement *A, GroupElem
     }
 }
 
-void Invsqrt_dealer_threads_helper(int thread_idx, int size, int ib, int ob, int shift_in, int shift_out, GroupElement *tmpA_mask, GroupElement *tmpB_mask, pair<SplineKeyPack> *keys)
+void Invsqrt_dealer_threads_helper(int thread_idx, int size, int bitlen, int ib, int ob, int shift_in, int shift_out, GroupElement *tmpA_mask, GroupElement *tmpB_mask, pair<SplineKeyPack> *keys)
 {
     auto p = get_start_end(size, thread_idx);
     for(int i = p.first; i < p.second; ++i)
     {
         tmpB_mask[i] = random_ge(ob);
-        keys[i] = keyGenInvsqrt_main_wrapper(ib, ob, shift_in, shift_out, tmpA_mask[i], tmpB_mask[i]);
+        keys[i] = keyGenInvsqrt_main_wrapper(bitlen, ib, ob, shift_in, shift_out, tmpA_mask[i], tmpB_mask[i]);
     }
 }
 
@@ -1862,27 +1827,21 @@ void Sqrt(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
              int64_t bwA, int64_t bwB, MASK_PAIR(GroupElement *A), MASK_PAIR(GroupElement *B))
 {
     always_assert(bwA == bwB);
-    always_assert(bwA == 16);
-    
     fix_bitwidth(A, I*J, bwA);
     fix_bitwidth(A_mask, I*J, bwA);
 
     int32_t shift_in = log(scale_in);
     int32_t shift_out = log(scale_out);
 
-    
-
-#ifdef INVSQRT_10_9
-    always_assert(shift_in == 10);
-    always_assert(shift_out == 9);
-    int ib = 64, ob = 64, sin = 10, scoef = 13, sout = 9, degree = 2, numPoly = 10;
-#elif defined(INVSQRT_12_11)
-    always_assert(shift_in == 12);
-    always_assert(shift_out == 11);
-    int ib = 64, ob = 64, sin = 12, scoef = 13, sout = 11, degree = 2, numPoly = 10;
-#else
-    throw std::invalid_argument("no scales selected for invsqrt");
-#endif
+    int ib = 64, ob = 64, sin = shift_in, sout = shift_out;
+    // only the dealer builds the spline table, the evaluators take its shape
+    // from the keys
+    int scoef = 0, degree = 0;
+    if (party == DEALER) {
+        const SplineTable &table = getSplineTable(SplineFunction::Invsqrt, bwA, sin, sout);
+        scoef = table.scaleCoef;
+        degree = table.degree;
+    }
 
     GroupElement *tmpA = make_ge_array(I*J, ib);
     GroupElement *tmpA_mask = party == DEALER ? tmpA : nullptr;
@@ -1896,7 +1855,7 @@ void Sqrt(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
 #ifdef DEALER_DIRECT_SEND
         for(int i = 0; i < I*J; ++i) {
             tmpB_mask[i] = random_ge(ob);
-            auto keys = keyGenInvsqrt_main_wrapper(ib, ob, shift_in, shift_out, tmpA_mask[i], tmpB_mask[i]);
+            auto keys = keyGenInvsqrt_main_wrapper(bwA, ib, ob, shift_in, shift_out, tmpA_mask[i], tmpB_mask[i]);
             server->send_spline_key(keys.first);
             client->send_spline_key(keys.second);
             freeSplineKeyPair(keys);
@@ -1909,7 +1868,7 @@ void Sqrt(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
         std::thread thread_pool[num_threads];
 
         for(int i = 0; i < num_threads; ++i) {
-            thread_pool[i] = std::thread(Invsqrt_dealer_threads_helper, i, size, ib, ob, shift_in, shift_out, tmpA, tmpB, keys);
+            thread_pool[i] = std::thread(Invsqrt_dealer_threads_helper, i, size, bwA, ib, ob, shift_in, shift_out, tmpA, tmpB, keys);
         }
 
         for(int i = 0; i < num_threads; ++i) {
@@ -1930,7 +1889,11 @@ void Sqrt(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
     else {
         SplineKeyPack *keys = new SplineKeyPack[I*J];
         for(int i = 0; i < I*J; ++i) {
-            keys[i] = dealer->recv_spline_key(ib, ob, numPoly, degree);
+            keys[i] = dealer->recv_spline_key(bwA, ib, ob);
+        }
+        if (I*J > 0) {
+            scoef = keys[0].scaleCoef;
+            degree = keys[0].degree;
         }
 
         peer->sync();
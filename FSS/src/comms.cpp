@@ -60,6 +60,7 @@ Peer::Peer(std::string ip, int port) {
         const int one = 1;
         setsockopt(sendsocket, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
     }
+    link = netem::Link::fromEnv(sendsocket);
     std::cerr << "connected" << std::endl;
 
 }
@@ -69,11 +70,27 @@ void Peer::close() {
         file.close();
     }
     else {
+        delete link;
+        link = nullptr;
         ::close(sendsocket);
         ::close(recvsocket);
     }
 }
 
+void Peer::send_bytes(const void *data, size_t size) {
+    if (link != nullptr) {
+        link->send(data, size);
+        return;
+    }
+    const char *buf = (const char *)data;
+    while (size > 0) {
+        ssize_t res = send(sendsocket, buf, size, 0);
+        always_assert(res > 0);
+        buf += res;
+        size -= res;
+    }
+}
+
 Peer* waitForPeer(int port) {
     int sendsocket, recvsocket;
     std::cerr << "waiting for connection from client...";
@@ -141,7 +158,7 @@ void Peer::send_ge(const GroupElement &g, int bw) {
         if (useFile) {
             this->file.write(buf, 8);
         } else {
-            send(sendsocket, buf, 8, 0);
+            send_bytes(buf, 8);
         }
         bytesSent += 8;
     }
@@ -150,7 +167,7 @@ void Peer::send_ge(const GroupElement &g, int bw) {
         if (useFile) {
             this->file.write(buf, 4);
         } else {
-            send(sendsocket, buf, 4, 0);
+            send_bytes(buf, 4);
         }
         bytesSent += 4;
     }
@@ -159,7 +176,7 @@ void Peer::send_ge(const GroupElement &g, int bw) {
         if (useFile) {
             this->file.write(buf, 2);
         } else {
-            send(sendsocket, buf, 2, 0);
+            send_bytes(buf, 2);
         }
         bytesSent += 2;
     }
@@ -168,7 +185,7 @@ void Peer::send_ge(const GroupElement &g, int bw) {
         if (useFile) {
             this->file.write(buf, 1);
         } else {
-            send(sendsocket, buf, 1, 0);
+            send_bytes(buf, 1);
         }
         bytesSent += 1;
     }
@@ -179,7 +196,7 @@ void Peer::send_block(const osuCrypto::block &b) {
     if (useFile) {
         this->file.write(buf, sizeof(osuCrypto::block));
     } else {
-        send(sendsocket, buf, sizeof(osuCrypto::block), 0);
+        send_bytes(buf, sizeof(osuCrypto::block));
     }
     bytesSent += sizeof(osuCrypto::block);
 }
@@ -203,7 +220,7 @@ void Peer::send_batched_input(GroupElement *g, int size, int bw)
         if (useFile) {
             this->file.write(buf, 8*size);
         } else {
-            send(sendsocket, buf, 8*size, 0);
+            send_bytes(buf, 8*size);
         }
         delete[] temp;
         bytesSent += 8*size;
@@ -217,7 +234,7 @@ void Peer::send_batched_input(GroupElement *g, int size, int bw)
         if (useFile) {
             this->file.write(buf, 4*size);
         } else {
-            send(sendsocket, buf, 4*size, 0);
+            send_bytes(buf, 4*size);
         }
         delete[] temp;
         bytesSent += 4*size;
@@ -231,7 +248,7 @@ void Peer::send_batched_input(GroupElement *g, int size, int bw)
         if (useFile) {
             this->file.write(buf, 2*size);
         } else {
-            send(sendsocket, buf, 2*size, 0);
+            send_bytes(buf, 2*size);
         }
         delete[] temp;
         bytesSent += 2*size;
@@ -245,7 +262,7 @@ void Peer::send_batched_input(GroupElement *g, int size, int bw)
         if (useFile) {
             this->file.write(buf, size);
         } else {
-            send(sendsocket, buf, size, 0);
+            send_bytes(buf, size);
         }
         delete[] temp;
         bytesSent += size;
@@ -308,7 +325,7 @@ void Peer::send_mult_key(const MultKey &k) {
     if (useFile) {
         this->file.write(buf, sizeof(MultKey));
     } else {
-        send(sendsocket, buf, sizeof(MultKey), 0);
+        send_bytes(buf, sizeof(MultKey));
     }
     bytesSent += sizeof(MultKey);
 }
@@ -466,6 +483,11 @@ void Peer::send_ars_key(const ARSKeyPack &kp) {
 
 void Peer::send_spline_key(const SplineKeyPack &kp)
 {
+    // shape of the dealer's spline table, so that the evaluators never need
+    // to rebuild it
+    send_ge(GroupElement(kp.numPoly, 32), 32);
+    send_ge(GroupElement(kp.degree, 32), 32);
+    send_ge(GroupElement(kp.scaleCoef, 32), 32);
     send_dcf_keypack(kp.dcfKey);
     for(auto &pi: kp.p) {
         send_ge(pi, kp.Bin);
@@ -842,7 +864,7 @@ ARSKeyPack Dealer::recv_ars_key(int Bin, int Bout, int shift) {
 
 void Peer::sync() {
     char buf[1] = {1};
-    send(sendsocket, buf, 1, 0);
+    send_bytes(buf, 1);
     recv(recvsocket, buf, 1, MSG_WAITALL);
     bytesReceived += 1;
     bytesSent += 1;
@@ -878,14 +900,16 @@ PublicICKeyPack Dealer::recv_publicIC_key(int Bin, int Bout) {
 }
 
 
-SplineKeyPack Dealer::recv_spline_key(int Bin, int Bout, int numPoly, int degree)
+SplineKeyPack Dealer::recv_spline_key(int bitlen, int Bin, int Bout)
 {
     SplineKeyPack kp;
     kp.Bin = Bin;
     kp.Bout = Bout;
-    kp.numPoly = numPoly;
-    kp.degree = degree;
-    kp.dcfKey = recv_dcf_keypack(16, Bout, numPoly * (degree + 1));
+    kp.numPoly = (int32_t)recv_ge(32).value;
+    kp.degree = (int32_t)recv_ge(32).value;
+    kp.scaleCoef = (int32_t)recv_ge(32).value;
+    int numPoly = kp.numPoly, degree = kp.degree;
+    kp.dcfKey = recv_dcf_keypack(bitlen, Bout, numPoly * (degree + 1));
 
     kp.p.resize(numPoly + 1);
     for(int i = 0; i < numPoly + 1; ++i) {
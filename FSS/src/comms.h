@@ -26,6 +26,7 @@ SOFTWARE.
 #include "group_element.h"
 #include "keypack.h"
 #include "array.h"
+#include "utils/netem.h"
 
 #include <arpa/inet.h>
 #include <netinet/in.h>
@@ -49,11 +50,14 @@ public:
     std::fstream file;
     uint64_t bytesSent = 0;
     uint64_t bytesReceived = 0;
+    // Emulated outgoing link (see netem.h); null unless EZPC_NETEM is set
+    netem::Link *link = nullptr;
 
     Peer(std::string ip, int port);
     Peer(int sendsocket, int recvsocket) {
         this->sendsocket = sendsocket;
         this->recvsocket = recvsocket;
+        this->link = netem::Link::fromEnv(sendsocket);
     }
     Peer(std::string filename) {
         this->useFile = true;
@@ -62,6 +66,8 @@ public:
 
     void close();
 
+    void send_bytes(const void *data, size_t size);
+
     void send_ge(const GroupElement &g, int bw);
 
     void send_block(const osuCrypto::block &b);
@@ -160,7 +166,7 @@ public:
 
     MultKeyNew recv_new_mult_key(int Bin, int Bout);
 
-    SplineKeyPack recv_spline_key(int Bin, int Bout, int numPoly, int degree);
+    SplineKeyPack recv_spline_key(int bitlen, int Bin, int Bout);
 
     SignedPublicDivKeyPack recv_signedpubdiv_key(int Bin, int Bout);
 
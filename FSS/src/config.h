@@ -21,25 +21,9 @@ SOFTWARE.
 
 #pragma once
 
-/* The below comments use (bitlen, scale) format to describe the functionality. */
-
-/* To use Sigmoid and Tanh in (37, 12) uncomment this flag and comment all other SIGMOID and TANH flags */
-// #define SIGMOID_TANH_37
-
-/* To use Sigmoid in (bitlen, scale), uncomment `SIGMOID_bitlen_scale` flag and comment other SIGMOID flags and SIGMOID_TANH_37 flag. */
-// #define SIGMOID_8_14
-#define SIGMOID_9_14
-// #define SIGMOID_11_14
-// #define SIGMOID_13_14
-// #define SIGMOID_12_12
-
-/* To use Tanh in (bitlen, scale), uncomment `TANH_bitlen_scale` flag and comment other TANH flags and SIGMOID_TANH_37 flag. */
-// #define TANH_8_8
-#define TANH_9_9
-// #define TANH_11_11
-// #define TANH_12_12
-// #define TANH_13_13
-
-/* To use InvSqrt in (bitlen, scale), uncomment `INVSQRT_bitlen_scale` flag and comment other INVSQRT flags. */
-// #define INVSQRT_10_9
-#define INVSQRT_12_11
+/* Sigmoid, Tanh and InvSqrt pick their spline at runtime from (bitlen, scaleIn, scaleOut):
+   the octave fitted ones for sigmoid (16, 8/9/11/13 -> 14), (16, 12) and (37, 12),
+   tanh (16, 8/9/11/12/13) and (37, 12), and invsqrt (16, 10 -> 9) and (16, 12 -> 11).
+   Any other choice is fitted by the dealer on first use, within SPLINE_ULP of the function
+   (on long intervals at sampled inputs only, see SplineFit::checkAll). */
+#define SPLINE_ULP 4
@@ -20,6 +20,9 @@ SOFTWARE.
 */
 
 #include "dcf.h"
+#include "utils/aes_multikey.h"
+#include <algorithm>
+#include <cstring>
 
 using namespace osuCrypto;
 // uint64_t aes_evals_count = 0;
@@ -164,7 +167,7 @@ std::pair<DCFKeyPack, DCFKeyPack> keyGenDCF(int Bin, int Bout, int groupSize,
     s[0] = (s[0] & notOneBlock) ^ ((s[1] & OneBlock) ^ OneBlock);
     k0[0] = s[0];
     k1[0] = s[1];
-    block ct[4];
+    block ct[8];
 
     for (int i = 0; i < Bin; ++i)
     {
@@ -174,18 +177,17 @@ std::pair<DCFKeyPack, DCFKeyPack> keyGenDCF(int Bin, int Bout, int groupSize,
         auto ss0 = s[0] & notThreeBlock;
         auto ss1 = s[1] & notThreeBlock;
 
-        AES ak0(ss0);
-        AES ak1(ss1);
-        ak0.ecbEncFourBlocks(pt, ct);
+        const block ks[2] = {ss0, ss1};
+        const block pts[8] = {pt[0], pt[1], pt[2], pt[3], pt[0], pt[1], pt[2], pt[3]};
+        aes_multikey::encrypt(2, ks, pts, 4, ct);
         si[0][0] = ct[0];
         si[0][1] = ct[1];
         vi[0][0] = ct[2];
         vi[0][1] = ct[3];
-        ak1.ecbEncFourBlocks(pt, ct);
-        si[1][0] = ct[0];
-        si[1][1] = ct[1];
-        vi[1][0] = ct[2];
-        vi[1][1] = ct[3];
+        si[1][0] = ct[4];
+        si[1][1] = ct[5];
+        vi[1][0] = ct[6];
+        vi[1][1] = ct[7];
 
         auto ti0 = lsb(s[0]);
         auto ti1 = lsb(s[1]);
@@ -311,6 +313,162 @@ void evalDCFPartial(int party, GroupElement *res, GroupElement idx, const DCFKey
     evalDCF(key.Bin, key.Bout, key.groupSize, res, party, idx, key.k, key.g, key.v, false, start, len);
 }
 
+// Same as convert, but only entries [start[w], start[w] + len) (mod groupSize)
+// of out are filled, for each of the numWindows windows: of the AES blocks b
+// expands to, only those holding these entries are computed
+void convertWindow(const int bitsize, const int groupSize, const block &b, uint64_t *out,
+                        const int *start, int numWindows, int len)
+{
+    const int bys = bytesize(bitsize);
+    const int totalBys = bys * groupSize;
+    if (totalBys <= 16) {
+        uint8_t bptr[24] = {0};
+        memcpy(bptr, &b, 16);
+        for (int i = 0; i < groupSize; i++) {
+            out[i] = *(uint64_t *)(bptr + i * bys);
+        }
+        return;
+    }
+    int numblocks = totalBys % 16 == 0 ? totalBys / 16 : (totalBys / 16) + 1;
+    AES aes(b);
+    block pt[numblocks];
+    block ct[numblocks + 1];
+    for (int w = 0; w < numWindows; ++w) {
+        // a window wraps around at most once, so it is at most two runs
+        int lo = ((start[w] % groupSize) + groupSize) % groupSize;
+        for (int remaining = len; remaining > 0; lo = 0) {
+            int n = std::min(remaining, groupSize - lo);
+            int first = (lo * bys) / 16;
+            int last = std::min(((lo + n - 1) * bys + 7) / 16, numblocks - 1);
+            for (int i = first; i <= last; i++) {
+                pt[i - first] = toBlock(0, i);
+            }
+            aes.ecbEncBlocks(pt, last - first + 1, ct);
+            ct[last - first + 1] = ZeroBlock;
+            uint8_t *bptr = (uint8_t *)ct - first * 16;
+            for (int i = lo; i < lo + n; i++) {
+                out[i] = *(uint64_t *)(bptr + i * bys);
+            }
+            remaining -= n;
+        }
+    }
+}
+
+void evalDCFMulti(int party, int numIdx, const GroupElement *idx, const int *start, int len,
+                GroupElement *res, const DCFKeyPack &key)
+{
+    static const block notThreeBlock = toBlock(~0, ~3);
+    static const block TwoBlock = toBlock(0, 2);
+    static const block ThreeBlock = toBlock(0, 3);
+    static const block blocks[4] = {ZeroBlock, TwoBlock, OneBlock, ThreeBlock};
+
+    const int Bin = key.Bin, groupSize = key.groupSize;
+    if (numIdx == 0 || len == 0) {
+        return;
+    }
+    uint64_t inMask = (Bin == 64) ? ~0ULL : ((1ULL << Bin) - 1);
+    uint64_t sign = (party == SERVER1) ? -1 : 1;
+
+    // inputs sorted by value, so that the ones below any node of the tree
+    // are contiguous
+    std::vector<int> order(numIdx);
+    std::vector<int> orderedStart(numIdx);
+    for (int q = 0; q < numIdx; ++q) {
+        order[q] = q;
+    }
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return (idx[a].value & inMask) < (idx[b].value & inMask);
+    });
+    for (int q = 0; q < numIdx; ++q) {
+        orderedStart[q] = start[order[q]];
+        GroupElement *out = res + order[q] * groupSize;
+        for (int c = 0, lp = (start[order[q]] % groupSize + groupSize) % groupSize; c < len; ++c, lp = (lp + 1 == groupSize) ? 0 : lp + 1) {
+            out[lp].value = 0;
+        }
+    }
+
+    struct Node {
+        block s;
+        int lo, hi;
+    };
+    // a child of a node that some input goes down to; the AES calls of all
+    // of them at one level are made together
+    struct Child {
+        int node;
+        u8 keep;
+        int lo, hi;
+    };
+    std::vector<Node> nodes{{key.k[0], 0, numIdx}}, next;
+    std::vector<Child> children;
+    std::vector<block> aesKeys, aesBlocks;
+    std::vector<uint64_t> converted(groupSize);
+
+    for (int i = 0; i < Bin; ++i)
+    {
+        const block &cw = key.k[i + 1];
+        const auto scw = (cw & notThreeBlock);
+        block ds[] = { ((cw >> 1) & OneBlock), (cw & OneBlock) };
+        children.clear();
+        for (int n = 0; n < (int)nodes.size(); ++n) {
+            auto &node = nodes[n];
+            int mid = node.lo;
+            while (mid < node.hi && ((idx[order[mid]].value >> (Bin - 1 - i)) & 1) == 0) {
+                mid++;
+            }
+            if (node.lo < mid) {
+                children.push_back({n, 0, node.lo, mid});
+            }
+            if (mid < node.hi) {
+                children.push_back({n, 1, mid, node.hi});
+            }
+        }
+        aesKeys.resize(children.size());
+        aesBlocks.resize(2 * children.size());
+        for (size_t ch = 0; ch < children.size(); ++ch) {
+            aesKeys[ch] = nodes[children[ch].node].s & notThreeBlock;
+            aesBlocks[2 * ch] = blocks[2 * children[ch].keep];
+            aesBlocks[2 * ch + 1] = blocks[2 * children[ch].keep + 1];
+        }
+        aes_multikey::encrypt(children.size(), aesKeys.data(), aesBlocks.data(), 2, aesBlocks.data());
+
+        next.clear();
+        for (size_t ch = 0; ch < children.size(); ++ch) {
+            const Child &child = children[ch];
+            const block *ct = aesBlocks.data() + 2 * ch;
+            int lo = child.lo, hi = child.hi;
+            u8 t_previous = lsb(nodes[child.node].s);
+            const auto mask = zeroAndAllOne[t_previous];
+            next.push_back({((scw ^ ds[child.keep]) & mask) ^ ct[0], lo, hi});
+            convertWindow(key.Bout, groupSize, ct[1], converted.data(), orderedStart.data() + lo, hi - lo, len);
+            for (int q = lo; q < hi; ++q) {
+                GroupElement *out = res + order[q] * groupSize;
+                for (int c = 0, lp = (orderedStart[q] % groupSize + groupSize) % groupSize; c < len; ++c, lp = (lp + 1 == groupSize) ? 0 : lp + 1) {
+                    out[lp].value = out[lp].value + sign * (converted[lp] + t_previous * key.v[i * groupSize + lp].value);
+                }
+            }
+        }
+        std::swap(nodes, next);
+    }
+
+    for (auto &node : nodes) {
+        u8 t = lsb(node.s);
+        convertWindow(key.Bout, groupSize, node.s & notThreeBlock, converted.data(), orderedStart.data() + node.lo, node.hi - node.lo, len);
+        for (int q = node.lo; q < node.hi; ++q) {
+            GroupElement *out = res + order[q] * groupSize;
+            for (int c = 0, lp = (orderedStart[q] % groupSize + groupSize) % groupSize; c < len; ++c, lp = (lp + 1 == groupSize) ? 0 : lp + 1) {
+                GroupElement final_term = converted[lp];
+                if (t)
+                    final_term.value = final_term.value + key.g[lp].value;
+                if (party == SERVER1)
+                {
+                    final_term.value = -final_term.value;
+                }
+                out[lp].value = out[lp].value + final_term.value;
+            }
+        }
+    }
+}
+
 // Dual DCF
 
 std::pair<DualDCFKeyPack, DualDCFKeyPack> keyGenDualDCF(int Bin, int Bout, int groupSize, GroupElement idx, GroupElement *payload1, GroupElement *payload2)
@@ -58,6 +58,13 @@ void evalDCF(int Bin, int Bout, int groupSize,
 
 void evalDCFPartial(int party, GroupElement *res, GroupElement idx, const DCFKeyPack &key, int start, int len);
 
+// Evaluates key at numIdx inputs in one walk down the tree: a node on the
+// paths of several inputs is expanded once, and only the groupSize entries
+// [start[q], start[q] + len) (mod groupSize) needed by input q are computed,
+// into res[q * groupSize + ...]
+void evalDCFMulti(int party, int numIdx, const GroupElement *idx, const int *start, int len,
+                GroupElement *res, const DCFKeyPack &key);
+
 std::pair<DualDCFKeyPack, DualDCFKeyPack> keyGenDualDCF(int Bin, int Bout, int groupSize, GroupElement idx, GroupElement *payload1, GroupElement *payload2);
 
 std::pair<DualDCFKeyPack, DualDCFKeyPack> keyGenDualDCF(int Bin, int Bout, GroupElement idx, GroupElement payload1, GroupElement payload2);
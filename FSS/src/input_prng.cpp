@@ -21,6 +21,7 @@ SOFTWARE.
 
 #include "input_prng.h"
 #include "comms.h"
+#include "utils/binary_input.h"
 #include <chrono>
 #include <thread>
 extern int num_threads;
@@ -112,8 +113,10 @@ void input_layer(GroupElement *x, GroupElement *x_mask, int size, int owner)
         , true, accumulatedInputTimeOffline)
     }
     else if (party == owner) {
-        for(int i = 0; i < size; ++i) {
-            std::cin >> x[i];
+        if (!binary_input::readArray(x, size, true)) {
+            for(int i = 0; i < size; ++i) {
+                std::cin >> x[i];
+            }
         }
         // generate and add masks
         TIME_THIS_BLOCK_FOR_INPUT_IF(
@@ -254,6 +254,7 @@ struct SplineKeyPack
 {
     int Bin, Bout;
     int numPoly, degree;
+    int scaleCoef;                      // coefficients are at scale degree * scaleIn + scaleCoef
     DCFKeyPack dcfKey;
     std::vector<GroupElement> p;        // spline breakpoints, size: numPoly + 1; p[0] = 0 and p[numPoly] = N-1
     std::vector<std::vector<GroupElement>> e_b; // 2d array dim: numPoly x (degree+1) (size is same as beta)
@@ -23,6 +23,11 @@ SOFTWARE.
 #include "dcf.h"
 #include "utils.h"
 #include <assert.h>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
 
 std::pair<ReluKeyPack, ReluKeyPack> keyGenRelu(int Bin, int Bout,
                         GroupElement rin, GroupElement rout)
@@ -130,7 +135,7 @@ GroupElement evalMaxpool(int party, GroupElement x, GroupElement y, const Maxpoo
 }
 
 
-std::pair<SplineKeyPack, SplineKeyPack> keyGenSigmoid(int Bin, int Bout, int numPoly, int degree, 
+std::pair<SplineKeyPack, SplineKeyPack> keyGenSigmoid(int bitlen, int Bin, int Bout, int numPoly, int degree, 
                     std::vector<std::vector<GroupElement>> polynomials,
                     std::vector<GroupElement> p,
                     GroupElement rin, GroupElement rout)
@@ -213,17 +218,8 @@ std::pair<SplineKeyPack, SplineKeyPack> keyGenSigmoid(int Bin, int Bout, int num
     // line 3
     block seed;
     int dcfGroupSize = beta.size();
-#ifdef SIGMOID_TANH_37
-    int newBitlen = 37;
-    auto dcfKeys = keyGenDCF(newBitlen, Bout, beta.size(), gamma, beta.data());
-#elif defined(SIGMOID_12_12) || defined(TANH_12_12)
-    auto dcfKeys = keyGenDCF(16, Bout, beta.size(), gamma, beta.data());
-    // auto dcfKeys = keyGenDCF(Bin, Bout, beta.size(), gamma, beta.data());
-#else // all equal bit case
-    // assert(Bin == Bout);
-    // auto dcfKeys = keyGenDCF(Bin, Bout, beta.size(), gamma, beta.data());
-    auto dcfKeys = keyGenDCF(16, Bout, beta.size(), gamma, beta.data());
-#endif 
+    // intervals are compared over the bitlen bits of the input
+    auto dcfKeys = keyGenDCF(bitlen, Bout, beta.size(), gamma, beta.data());
     
     k0.dcfKey = dcfKeys.first;
     k1.dcfKey = dcfKeys.second;
@@ -285,33 +281,28 @@ GroupElement evalSigmoid(int party, GroupElement x, SplineKeyPack &k)
     assert((k.p[0] == GroupElement(0, k.Bin)) && (k.p[m] == GroupElement(-1, k.Bin)));
     k.p[0] = k.p[0] - GroupElement(1, k.Bin);
 
-    std::vector<std::vector<GroupElement>> s (m, std::vector<GroupElement>(m * (degree + 1)));
-
+    // all m comparisons come from one walk down the DCF tree; comparison i
+    // only needs the coefficients of polynomials i - 1 and i
     int dcfGroupSize = m * (degree + 1);
-    for (int i = 0; i <m ; ++i)
+    std::vector<GroupElement> s(m * dcfGroupSize);
+    std::vector<GroupElement> xs(m);
+    std::vector<int> start(m);
+    for (int i = 0; i < m; ++i)
     {
-        GroupElement xi = x + (GroupElement(-1, k.Bin) - (k.p[i] + GroupElement(1, k.Bin)));
-        evalDCFPartial(party, s[i].data(), xi, k.dcfKey, (i - 1) * (degree + 1), 2 * (degree + 1));
+        xs[i] = x + (GroupElement(-1, k.Bin) - (k.p[i] + GroupElement(1, k.Bin)));
+        start[i] = (i - 1) * (degree + 1);
     }
+    evalDCFMulti(party, m, xs.data(), start.data(), 2 * (degree + 1), s.data(), k.dcfKey);
 
+    const int bitlen = k.dcfKey.Bin;
     GroupElement w_b[m][degree + 1];
     for (int i = 0; i < m; ++i)
     {
-#ifdef SIGMOID_TANH_37
-        int newBitlen = 37;
-        GroupElement cx = GroupElement((changeBitsize(x, newBitlen) > (changeBitsize(k.p[i], newBitlen) + GroupElement(1, newBitlen))) - (changeBitsize(x, newBitlen) > (changeBitsize(k.p[i+1], newBitlen) + GroupElement(1, newBitlen))), k.Bout);
-#elif defined(SIGMOID_12_12) || defined(TANH_12_12) 
-        GroupElement cx = GroupElement((changeBitsize(x, 16) > (changeBitsize(k.p[i], 16) + GroupElement(1, 16))) - (changeBitsize(x, 16) > (changeBitsize(k.p[i+1], 16) + GroupElement(1, 16))), k.Bout);
-        // GroupElement cx = GroupElement((x > k.p[i - 1] + 1) - (x > k.p[i] + 1), k.Bout);
-#else // all equal bit case
-        // assert(k.Bin == k.Bout);
-        // GroupElement cx = GroupElement((x > k.p[i] + 1) - (x > k.p[i+1] + 1), k.Bout);
-        GroupElement cx = GroupElement((changeBitsize(x, 16) > (changeBitsize(k.p[i], 16) + GroupElement(1, 16))) - (changeBitsize(x, 16) > (changeBitsize(k.p[i+1], 16) + GroupElement(1, 16))), k.Bout);
-#endif 
+        GroupElement cx = GroupElement((changeBitsize(x, bitlen) > (changeBitsize(k.p[i], bitlen) + GroupElement(1, bitlen))) - (changeBitsize(x, bitlen) > (changeBitsize(k.p[i+1], bitlen) + GroupElement(1, bitlen))), k.Bout);
         if(print) std::cout << " i " << i << " cx " << cx << std::endl;
         for (int j = 0; j < degree + 1; ++j)
         {
-            w_b[i][j] = cx * k.beta_b[i * (degree + 1) + j] - s[i][i * (degree + 1) + j] + s[(i+1) % (m)][i * (degree + 1) + j] + k.e_b[i][j];
+            w_b[i][j] = cx * k.beta_b[i * (degree + 1) + j] - s[i * dcfGroupSize + i * (degree + 1) + j] + s[((i+1) % (m)) * dcfGroupSize + i * (degree + 1) + j] + k.e_b[i][j];
         }
     }
 
@@ -346,30 +337,15 @@ GroupElement evalSigmoid(int party, GroupElement x, SplineKeyPack &k)
 
 
 
-std::pair<SplineKeyPack, SplineKeyPack> keyGenSigmoid_main_wrapper(int Bin, int Bout, int scaleIn, int scaleOut,
-                    GroupElement rin, GroupElement rout)
+// Splines fitted offline in octave; false if there is none for
+// (bitlen, scaleIn, scaleOut)
+static bool sigmoidTable(int bitlen, int scaleIn, int scaleOut, SplineTable &t)
 {
-    // todo: add other scales
-    assert((Bin == 64) && (Bout == 64));
-#if defined(SIGMOID_12_12) || defined(SIGMOID_TANH_37)
-    assert((scaleIn == 12) && (scaleOut == 12));
-#elif defined(SIGMOID_9_14)
-    assert((scaleIn == 9) && (scaleOut == 14));
-#elif defined(SIGMOID_8_14)
-    assert((scaleIn == 8) && (scaleOut == 14));
-#elif defined(SIGMOID_11_14)
-    assert((scaleIn == 11) && (scaleOut == 14));
-#elif defined(SIGMOID_13_14)
-    assert((scaleIn == 13) && (scaleOut == 14));
-#else 
-    throw std::invalid_argument("no scales selected for sigmoid");
-#endif
-
     // imp: make sure different choices of i/p, o/p scales use same coef scale
     int scaleCoef = 20, coefBitsize = 64;
 
-    int ib = Bin, cb = coefBitsize, ob = Bout, sin = scaleIn, scoef = scaleCoef, sout = scaleOut;
-    
+    int ib = 64, cb = coefBitsize, sin = scaleIn, scoef = scaleCoef;
+
     // from octave:
 
     // best fit for spline with ulp 4: degree = 2 and 32 polys
@@ -470,369 +446,376 @@ std::pair<SplineKeyPack, SplineKeyPack> keyGenSigmoid_main_wrapper(int Bin, int
 
     int degree = 2;
 
-#ifdef SIGMOID_TANH_37
-
-    std::vector<std::vector<GroupElement>> fxd_polynomials
+    if (bitlen == 37 && scaleIn == 12 && scaleOut == 12)
     {
-        {GroupElement(   -29928, cb),  GroupElement(     1114308608, cb),  GroupElement(   8796093022208, cb)},
-        {GroupElement(   -52222, cb),  GroupElement(     1283092480, cb),  GroupElement(   8476621275136, cb)},
-        {GroupElement(   -35115, cb),  GroupElement(     1024057344, cb),  GroupElement(   9457182441472, cb)},
-        {GroupElement(   -17337, cb),  GroupElement(      620269568, cb),  GroupElement(  11749956780032, cb)},
-        {GroupElement(    -7459, cb),  GroupElement(      321150976, cb),  GroupElement(  14014562172928, cb)},
-        {GroupElement(    -3077, cb),  GroupElement(      155246592, cb),  GroupElement(  15584590823424, cb)},
-        {GroupElement(    -1232, cb),  GroupElement(       71475200, cb),  GroupElement(  16535942856704, cb)},
-        {GroupElement(     -493, cb),  GroupElement(       32301056, cb),  GroupElement(  17054962810880, cb)},
-        {GroupElement(     -200, cb),  GroupElement(       14553088, cb),  GroupElement(  17323733811200, cb)},
-        {GroupElement(        0, cb),  GroupElement(              0, cb),  flt2fxd(1, degree*sin + scoef, cb)},
-
-        // after x = N/2
-
-        {GroupElement(        0, cb),  GroupElement(              0, cb),  GroupElement(               0, cb)},
-        {GroupElement(      199, cb),  GroupElement(       14553088, cb),  GroupElement(    268435456000, cb)},
-        {GroupElement(      492, cb),  GroupElement(       32301056, cb),  GroupElement(    537206456320, cb)},
-        {GroupElement(     1231, cb),  GroupElement(       71475200, cb),  GroupElement(   1056226410496, cb)},
-        {GroupElement(     3076, cb),  GroupElement(      155246592, cb),  GroupElement(   2007578443776, cb)},
-        {GroupElement(     7458, cb),  GroupElement(      321150976, cb),  GroupElement(   3577607094272, cb)},
-        {GroupElement(    17336, cb),  GroupElement(      620269568, cb),  GroupElement(   5842212487168, cb)},
-        {GroupElement(    35114, cb),  GroupElement(     1024057344, cb),  GroupElement(   8134986825728, cb)},
-        {GroupElement(    52221, cb),  GroupElement(     1283092480, cb),  GroupElement(   9115547992064, cb)},
-        {GroupElement(    29927, cb),  GroupElement(     1114308608, cb),  GroupElement(   8796093022208, cb)},
-    };
-
-    std::vector<GroupElement> fxd_p{
-        GroupElement(0, cb), GroupElement( 3785, cb), GroupElement( 7570, cb), GroupElement(11356, cb), GroupElement(15141, cb), GroupElement( 18927, cb), GroupElement(22712, cb), GroupElement(26498, cb), GroupElement(30283, cb), GroupElement(34069, cb), /* important one */ GroupElement((1ULL << 36) - 1, cb),
-        GroupElement(-34069, cb), GroupElement(-30284, cb), GroupElement(-26499, cb), GroupElement(-22713, cb), GroupElement(-18928, cb), GroupElement(-15142, cb), GroupElement(-11357, cb), GroupElement(-7571, cb), GroupElement(-3786, cb)
-    };
-
-#elif defined(SIGMOID_12_12)  // when bitlen = 16 and scale is 12
-
-   // the above defined steps are a little different here because max allowed
-   // value of x with bitlen 16 and scale 12 is [-8, 8] and turns out those are the
-   // leftmost and rightmost breakpoints
-
-    std::vector<std::vector<GroupElement>> fxd_polynomials
+        t.polynomials =
+        {
+            {GroupElement(   -29928, cb),  GroupElement(     1114308608, cb),  GroupElement(   8796093022208, cb)},
+            {GroupElement(   -52222, cb),  GroupElement(     1283092480, cb),  GroupElement(   8476621275136, cb)},
+            {GroupElement(   -35115, cb),  GroupElement(     1024057344, cb),  GroupElement(   9457182441472, cb)},
+            {GroupElement(   -17337, cb),  GroupElement(      620269568, cb),  GroupElement(  11749956780032, cb)},
+            {GroupElement(    -7459, cb),  GroupElement(      321150976, cb),  GroupElement(  14014562172928, cb)},
+            {GroupElement(    -3077, cb),  GroupElement(      155246592, cb),  GroupElement(  15584590823424, cb)},
+            {GroupElement(    -1232, cb),  GroupElement(       71475200, cb),  GroupElement(  16535942856704, cb)},
+            {GroupElement(     -493, cb),  GroupElement(       32301056, cb),  GroupElement(  17054962810880, cb)},
+            {GroupElement(     -200, cb),  GroupElement(       14553088, cb),  GroupElement(  17323733811200, cb)},
+            {GroupElement(        0, cb),  GroupElement(              0, cb),  flt2fxd(1, degree*sin + scoef, cb)},
+
+            // after x = N/2
+
+            {GroupElement(        0, cb),  GroupElement(              0, cb),  GroupElement(               0, cb)},
+            {GroupElement(      199, cb),  GroupElement(       14553088, cb),  GroupElement(    268435456000, cb)},
+            {GroupElement(      492, cb),  GroupElement(       32301056, cb),  GroupElement(    537206456320, cb)},
+            {GroupElement(     1231, cb),  GroupElement(       71475200, cb),  GroupElement(   1056226410496, cb)},
+            {GroupElement(     3076, cb),  GroupElement(      155246592, cb),  GroupElement(   2007578443776, cb)},
+            {GroupElement(     7458, cb),  GroupElement(      321150976, cb),  GroupElement(   3577607094272, cb)},
+            {GroupElement(    17336, cb),  GroupElement(      620269568, cb),  GroupElement(   5842212487168, cb)},
+            {GroupElement(    35114, cb),  GroupElement(     1024057344, cb),  GroupElement(   8134986825728, cb)},
+            {GroupElement(    52221, cb),  GroupElement(     1283092480, cb),  GroupElement(   9115547992064, cb)},
+            {GroupElement(    29927, cb),  GroupElement(     1114308608, cb),  GroupElement(   8796093022208, cb)},
+        };
+
+        t.p = {
+            GroupElement(0, cb), GroupElement( 3785, cb), GroupElement( 7570, cb), GroupElement(11356, cb), GroupElement(15141, cb), GroupElement( 18927, cb), GroupElement(22712, cb), GroupElement(26498, cb), GroupElement(30283, cb), GroupElement(34069, cb), /* important one */ GroupElement((1ULL << 36) - 1, cb),
+            GroupElement(-34069, cb), GroupElement(-30284, cb), GroupElement(-26499, cb), GroupElement(-22713, cb), GroupElement(-18928, cb), GroupElement(-15142, cb), GroupElement(-11357, cb), GroupElement(-7571, cb), GroupElement(-3786, cb)
+        };
+    }
+    else if (bitlen == 16 && scaleIn == 12 && scaleOut == 12)  // when bitlen = 16 and scale is 12
     {
-        { GroupElement(   -28859 , cb) ,   GroupElement(    1111248896 , cb) , GroupElement(    8796093022208 , cb) },
-        { GroupElement(   -52266 , cb) ,   GroupElement(    1281687552 , cb) , GroupElement(    8485815189504 , cb) },
-        { GroupElement(   -37164 , cb) ,   GroupElement(    1061756928 , cb) , GroupElement(    9286558154752 , cb) },
-        { GroupElement(   -19267 , cb) ,   GroupElement(     670793728 , cb) , GroupElement(   11421727326208 , cb) },
-        { GroupElement(    -8685 , cb) ,   GroupElement(     362573824 , cb) , GroupElement(   13666132951040 , cb) },
-        { GroupElement(    -3723 , cb) ,   GroupElement(     181891072 , cb) , GroupElement(   15310753103872 , cb) },
-        { GroupElement(    -1552 , cb) ,   GroupElement(      87056384 , cb) , GroupElement(   16346595196928 , cb) },
-        { GroupElement(     -643 , cb) ,   GroupElement(      40681472 , cb) , GroupElement(   16937522298880 , cb) },
-        { GroupElement(     -271 , cb) ,   GroupElement(      19050496 , cb) , GroupElement(   17252564860928 , cb) },
-
-        // marks end of x = 32768
-        // add dummy polynomial for the interval 32768 to -32768 (because we are operating in 64 bitlen for breakp bitlen)
-        // if we change break points to 16 bitlen need to remove/change this
-        // currently breakpoints are represented in 64 bitlen as well (although dcf comparison happens in 16 bits)
-
-        { GroupElement(     0 , cb) ,   GroupElement(      0 , cb) , GroupElement(   0 , cb) },
-
-        // marks start of x = -32768
-
-        {GroupElement(      270 , cb) ,    GroupElement(     19050496 , cb) , GroupElement(     339604406272 , cb) },
-        {GroupElement(      642 , cb) ,    GroupElement(     40681472 , cb) , GroupElement(     654646968320 , cb) },
-        {GroupElement(     1551 , cb) ,    GroupElement(     87056384 , cb) , GroupElement(    1245574070272 , cb) },
-        {GroupElement(     3722 , cb) ,    GroupElement(    181891072 , cb) , GroupElement(    2281416163328 , cb) },
-        {GroupElement(     8684 , cb) ,    GroupElement(    362573824 , cb) , GroupElement(    3926036316160 , cb) },
-        {GroupElement(    19266 , cb) ,    GroupElement(    670793728 , cb) , GroupElement(    6170441940992 , cb) },
-        {GroupElement(    37163 , cb) ,    GroupElement(   1061756928 , cb) , GroupElement(    8305611112448 , cb) },
-        {GroupElement(    52265 , cb) ,    GroupElement(   1281687552 , cb) , GroupElement(    9106354077696 , cb) },
-        {GroupElement(    28858 , cb) ,    GroupElement(   1111248896 , cb) , GroupElement(    8796093022208 , cb) },
-    };
-
-    std::vector<GroupElement> fxd_p{ GroupElement(0, ib),    GroupElement(3640, ib),    GroupElement(7281, ib),   GroupElement(10922, ib),   GroupElement(14563, ib),   GroupElement(18204, ib),   GroupElement(21845, ib),   GroupElement(25486, ib),   GroupElement(29127, ib),   GroupElement(32767, ib),
-    GroupElement(-32768, ib),  GroupElement(-29128, ib),  GroupElement(-25487, ib),  GroupElement(-21846, ib),  GroupElement(-18205, ib),  GroupElement(-14564, ib),  GroupElement(-10923, ib),   GroupElement(-7282, ib),   GroupElement(-3641, ib)
-    };
+       // the above defined steps are a little different here because max allowed
+       // value of x with bitlen 16 and scale 12 is [-8, 8] and turns out those are the
+       // leftmost and rightmost breakpoints
 
-#elif defined(SIGMOID_9_14)  // when scale is not 12  (input scale 9, output scale 14)
-    std::vector<std::vector<GroupElement>> fxd_polynomials
+        t.polynomials =
+        {
+            { GroupElement(   -28859 , cb) ,   GroupElement(    1111248896 , cb) , GroupElement(    8796093022208 , cb) },
+            { GroupElement(   -52266 , cb) ,   GroupElement(    1281687552 , cb) , GroupElement(    8485815189504 , cb) },
+            { GroupElement(   -37164 , cb) ,   GroupElement(    1061756928 , cb) , GroupElement(    9286558154752 , cb) },
+            { GroupElement(   -19267 , cb) ,   GroupElement(     670793728 , cb) , GroupElement(   11421727326208 , cb) },
+            { GroupElement(    -8685 , cb) ,   GroupElement(     362573824 , cb) , GroupElement(   13666132951040 , cb) },
+            { GroupElement(    -3723 , cb) ,   GroupElement(     181891072 , cb) , GroupElement(   15310753103872 , cb) },
+            { GroupElement(    -1552 , cb) ,   GroupElement(      87056384 , cb) , GroupElement(   16346595196928 , cb) },
+            { GroupElement(     -643 , cb) ,   GroupElement(      40681472 , cb) , GroupElement(   16937522298880 , cb) },
+            { GroupElement(     -271 , cb) ,   GroupElement(      19050496 , cb) , GroupElement(   17252564860928 , cb) },
+
+            // marks end of x = 32768
+            // add dummy polynomial for the interval 32768 to -32768 (because we are operating in 64 bitlen for breakp bitlen)
+            // if we change break points to 16 bitlen need to remove/change this
+            // currently breakpoints are represented in 64 bitlen as well (although dcf comparison happens in 16 bits)
+
+            { GroupElement(     0 , cb) ,   GroupElement(      0 , cb) , GroupElement(   0 , cb) },
+
+            // marks start of x = -32768
+
+            {GroupElement(      270 , cb) ,    GroupElement(     19050496 , cb) , GroupElement(     339604406272 , cb) },
+            {GroupElement(      642 , cb) ,    GroupElement(     40681472 , cb) , GroupElement(     654646968320 , cb) },
+            {GroupElement(     1551 , cb) ,    GroupElement(     87056384 , cb) , GroupElement(    1245574070272 , cb) },
+            {GroupElement(     3722 , cb) ,    GroupElement(    181891072 , cb) , GroupElement(    2281416163328 , cb) },
+            {GroupElement(     8684 , cb) ,    GroupElement(    362573824 , cb) , GroupElement(    3926036316160 , cb) },
+            {GroupElement(    19266 , cb) ,    GroupElement(    670793728 , cb) , GroupElement(    6170441940992 , cb) },
+            {GroupElement(    37163 , cb) ,    GroupElement(   1061756928 , cb) , GroupElement(    8305611112448 , cb) },
+            {GroupElement(    52265 , cb) ,    GroupElement(   1281687552 , cb) , GroupElement(    9106354077696 , cb) },
+            {GroupElement(    28858 , cb) ,    GroupElement(   1111248896 , cb) , GroupElement(    8796093022208 , cb) },
+        };
+
+        t.p = { GroupElement(0, ib),    GroupElement(3640, ib),    GroupElement(7281, ib),   GroupElement(10922, ib),   GroupElement(14563, ib),   GroupElement(18204, ib),   GroupElement(21845, ib),   GroupElement(25486, ib),   GroupElement(29127, ib),   GroupElement(32767, ib),
+        GroupElement(-32768, ib),  GroupElement(-29128, ib),  GroupElement(-25487, ib),  GroupElement(-21846, ib),  GroupElement(-18205, ib),  GroupElement(-14564, ib),  GroupElement(-10923, ib),   GroupElement(-7282, ib),   GroupElement(-3641, ib)
+        };
+    }
+    else if (bitlen == 16 && scaleIn == 9 && scaleOut == 14)  // when scale is not 12  (input scale 9, output scale 14)
     {
+        t.polynomials =
+        {
 
-        { GroupElement( -19865 , cb)  ,  GroupElement(    136350720 , cb) , GroupElement(   137438953472 , cb)},
+            { GroupElement( -19865 , cb)  ,  GroupElement(    136350720 , cb) , GroupElement(   137438953472 , cb)},
 
-        { GroupElement( -46751 , cb)  ,  GroupElement(    153050624 , cb) , GroupElement(   134845562880 , cb)},
+            { GroupElement( -46751 , cb)  ,  GroupElement(    153050624 , cb) , GroupElement(   134845562880 , cb)},
 
-        { GroupElement( -50113 , cb)  ,  GroupElement(    157227008 , cb) , GroupElement(   133548736512 , cb)},
+            { GroupElement( -50113 , cb)  ,  GroupElement(    157227008 , cb) , GroupElement(   133548736512 , cb)},
 
-        { GroupElement( -39428 , cb)  ,  GroupElement(    137315840 , cb) , GroupElement(   142824177664 , cb)},
+            { GroupElement( -39428 , cb)  ,  GroupElement(    137315840 , cb) , GroupElement(   142824177664 , cb)},
 
-        { GroupElement( -26323 , cb)  ,  GroupElement(    104756736 , cb) , GroupElement(   163047276544 , cb)},
+            { GroupElement( -26323 , cb)  ,  GroupElement(    104756736 , cb) , GroupElement(   163047276544 , cb)},
 
-        { GroupElement( -16046 , cb)  ,  GroupElement(     72842240 , cb) , GroupElement(   187825913856 , cb)},
+            { GroupElement( -16046 , cb)  ,  GroupElement(     72842240 , cb) , GroupElement(   187825913856 , cb)},
 
-        { GroupElement(  -9302 , cb)  ,  GroupElement(     47707136 , cb) , GroupElement(   211243761664 , cb)},
+            { GroupElement(  -9302 , cb)  ,  GroupElement(     47707136 , cb) , GroupElement(   211243761664 , cb)},
 
-        { GroupElement(  -5245 , cb)  ,  GroupElement(     30067200 , cb) , GroupElement(   230417760256 , cb)},
+            { GroupElement(  -5245 , cb)  ,  GroupElement(     30067200 , cb) , GroupElement(   230417760256 , cb)},
 
-        { GroupElement(  -2913 , cb)  ,  GroupElement(     18479104 , cb) , GroupElement(   244813398016 , cb)},
+            { GroupElement(  -2913 , cb)  ,  GroupElement(     18479104 , cb) , GroupElement(   244813398016 , cb)},
 
-        { GroupElement(  -1604 , cb)  ,  GroupElement(     11164672 , cb) , GroupElement(   255035441152 , cb)},
+            { GroupElement(  -1604 , cb)  ,  GroupElement(     11164672 , cb) , GroupElement(   255035441152 , cb)},
 
-        { GroupElement(   -880 , cb)  ,  GroupElement(      6664192 , cb) , GroupElement(   262023938048 , cb)},
+            { GroupElement(   -880 , cb)  ,  GroupElement(      6664192 , cb) , GroupElement(   262023938048 , cb)},
 
-        { GroupElement(   -481 , cb)  ,  GroupElement(      3942400 , cb) , GroupElement(   266673324032 , cb)},
+            { GroupElement(   -481 , cb)  ,  GroupElement(      3942400 , cb) , GroupElement(   266673324032 , cb)},
 
-        { GroupElement(   -263 , cb)  ,  GroupElement(      2315264 , cb) , GroupElement(   269705019392 , cb)},
+            { GroupElement(   -263 , cb)  ,  GroupElement(      2315264 , cb) , GroupElement(   269705019392 , cb)},
 
-        { GroupElement(   -144 , cb)  ,  GroupElement(      1353216 , cb) , GroupElement(   271647244288 , cb)},
+            { GroupElement(   -144 , cb)  ,  GroupElement(      1353216 , cb) , GroupElement(   271647244288 , cb)},
 
-        { GroupElement(    -78 , cb)  ,  GroupElement(       784384 , cb) , GroupElement(   272884039680 , cb)},
+            { GroupElement(    -78 , cb)  ,  GroupElement(       784384 , cb) , GroupElement(   272884039680 , cb)},
 
-        { GroupElement(    -44 , cb)  ,  GroupElement(       462336 , cb) , GroupElement(   273633247232 , cb)},
+            { GroupElement(    -44 , cb)  ,  GroupElement(       462336 , cb) , GroupElement(   273633247232 , cb)},
 
-        { GroupElement(      0 , cb)  ,  GroupElement(            0 , cb) , flt2fxd(1, degree*sin + scoef, cb)},
+            { GroupElement(      0 , cb)  ,  GroupElement(            0 , cb) , flt2fxd(1, degree*sin + scoef, cb)},
 
-       
 
-       // after x=N/2
 
- 
+           // after x=N/2
 
-        { GroupElement(      0 , cb)  , GroupElement(              0 , cb) , GroupElement(              0 , cb)},
 
-        { GroupElement(     43 , cb) ,  GroupElement(         462336 , cb) , GroupElement(     1244397568 , cb)},
 
-        { GroupElement(     77 , cb) ,  GroupElement(         784384 , cb) , GroupElement(     1993605120 , cb)},
+            { GroupElement(      0 , cb)  , GroupElement(              0 , cb) , GroupElement(              0 , cb)},
 
-        { GroupElement(    143 , cb) ,  GroupElement(        1353216 , cb) , GroupElement(     3230400512 , cb)},
+            { GroupElement(     43 , cb) ,  GroupElement(         462336 , cb) , GroupElement(     1244397568 , cb)},
 
-        { GroupElement(    262 , cb) ,  GroupElement(        2315264 , cb) , GroupElement(     5172625408 , cb)},
+            { GroupElement(     77 , cb) ,  GroupElement(         784384 , cb) , GroupElement(     1993605120 , cb)},
 
-        { GroupElement(    480 , cb) ,  GroupElement(        3942400 , cb) , GroupElement(     8204320768 , cb)},
+            { GroupElement(    143 , cb) ,  GroupElement(        1353216 , cb) , GroupElement(     3230400512 , cb)},
 
-        { GroupElement(    879 , cb) ,  GroupElement(        6664192 , cb) , GroupElement(    12853706752 , cb)},
+            { GroupElement(    262 , cb) ,  GroupElement(        2315264 , cb) , GroupElement(     5172625408 , cb)},
 
-        { GroupElement(   1603 , cb) ,  GroupElement(       11164672 , cb) , GroupElement(    19842203648 , cb)},
+            { GroupElement(    480 , cb) ,  GroupElement(        3942400 , cb) , GroupElement(     8204320768 , cb)},
 
-        { GroupElement(   2912 , cb) ,  GroupElement(       18479104 , cb) , GroupElement(    30064246784 , cb)},
+            { GroupElement(    879 , cb) ,  GroupElement(        6664192 , cb) , GroupElement(    12853706752 , cb)},
 
-        { GroupElement(   5244 , cb) ,  GroupElement(       30067200 , cb) , GroupElement(    44459884544 , cb)},
+            { GroupElement(   1603 , cb) ,  GroupElement(       11164672 , cb) , GroupElement(    19842203648 , cb)},
 
-        { GroupElement(   9301 , cb) ,  GroupElement(       47707136 , cb) , GroupElement(    63633883136 , cb)},
+            { GroupElement(   2912 , cb) ,  GroupElement(       18479104 , cb) , GroupElement(    30064246784 , cb)},
 
-        { GroupElement(  16045 , cb) ,  GroupElement(       72842240 , cb) , GroupElement(    87051730944 , cb)},
+            { GroupElement(   5244 , cb) ,  GroupElement(       30067200 , cb) , GroupElement(    44459884544 , cb)},
 
-        { GroupElement(  26322 , cb) ,  GroupElement(      104756736 , cb) , GroupElement(   111830368256 , cb)},
+            { GroupElement(   9301 , cb) ,  GroupElement(       47707136 , cb) , GroupElement(    63633883136 , cb)},
 
-        { GroupElement(  39427 , cb) ,  GroupElement(      137315840 , cb) , GroupElement(   132053467136 , cb)},
+            { GroupElement(  16045 , cb) ,  GroupElement(       72842240 , cb) , GroupElement(    87051730944 , cb)},
 
-        { GroupElement(  50112 , cb) ,  GroupElement(      157227008 , cb) , GroupElement(   141328908288 , cb)},
+            { GroupElement(  26322 , cb) ,  GroupElement(      104756736 , cb) , GroupElement(   111830368256 , cb)},
 
-        { GroupElement(  46750 , cb) ,  GroupElement(      153050624 , cb) , GroupElement(   140032081920 , cb)},
+            { GroupElement(  39427 , cb) ,  GroupElement(      137315840 , cb) , GroupElement(   132053467136 , cb)},
 
-        { GroupElement(  19864 , cb) ,  GroupElement(      136350720 , cb) , GroupElement(   137438691328 , cb)},
-    };
+            { GroupElement(  50112 , cb) ,  GroupElement(      157227008 , cb) , GroupElement(   141328908288 , cb)},
 
-    std::vector<GroupElement> fxd_p{GroupElement(0, ib),    GroupElement(310, ib),    GroupElement(621, ib),    GroupElement(931, ib),   GroupElement(1242, ib),   GroupElement(1552, ib),   GroupElement(1863, ib),   GroupElement(2173, ib),   GroupElement(2484, ib),   GroupElement(2795, ib),   GroupElement(3105, ib),   GroupElement(3416, ib),   GroupElement(3726, ib),   GroupElement(4037, ib),   GroupElement(4347, ib),  GroupElement(4658, ib),
-    GroupElement(4969, ib), /* important one */ GroupElement(32767, ib),
-    GroupElement(-4969, ib),  GroupElement(-4659, ib),  GroupElement(-4348, ib),  GroupElement(-4038, ib),  GroupElement(-3727, ib),  GroupElement(-3417, ib),  GroupElement(-3106, ib),  GroupElement(-2796, ib),  GroupElement(-2485, ib),  GroupElement(-2174, ib),  GroupElement(-1864, ib),  GroupElement(-1553, ib),  GroupElement(-1243, ib),  GroupElement(-932, ib),   GroupElement(-622, ib),   GroupElement(-311, ib)
-    };
+            { GroupElement(  46750 , cb) ,  GroupElement(      153050624 , cb) , GroupElement(   140032081920 , cb)},
 
-#elif defined(SIGMOID_8_14)
-    std::vector<std::vector<GroupElement>> fxd_polynomials
-    {
-        {GroupElement(-19869, cb),     GroupElement( 68175872, cb),  GroupElement(34359738368, cb)},
-        {GroupElement(-46756, cb),     GroupElement( 76527616, cb),  GroupElement(33711128576, cb)},
-        {GroupElement(-50110, cb),     GroupElement( 78611456, cb),  GroupElement(33387511808, cb)},
-        {GroupElement(-39418, cb),     GroupElement( 68647680, cb),  GroupElement(35708731392, cb)},
-        {GroupElement(-26312, cb),     GroupElement( 52363008, cb),  GroupElement(40767193088, cb)},
-        {GroupElement(-16037, cb),     GroupElement( 36404992, cb),  GroupElement(46963359744, cb)},
-        {GroupElement( -9295, cb),     GroupElement( 23839744, cb),  GroupElement(52818018304, cb)},
-        {GroupElement( -5240, cb),     GroupElement( 15022848, cb),  GroupElement(57610797056, cb)},
-        {GroupElement( -2910, cb),     GroupElement(  9231616, cb),  GroupElement(61208592384, cb)},
-        {GroupElement( -1602, cb),     GroupElement(  5576960, cb),  GroupElement(63762923520, cb)},
-        {GroupElement(  -879, cb),     GroupElement(  3328512, cb),  GroupElement(65508999168, cb)},
-        {GroupElement(  -481, cb),     GroupElement(  1968640, cb),  GroupElement(66670493696, cb)},
-        {GroupElement(  -263, cb),     GroupElement(  1156096, cb),  GroupElement(67427762176, cb)},
-        {GroupElement(  -144, cb),     GroupElement(   675584, cb),  GroupElement(67912859648, cb)},
-        {GroupElement(   -78, cb),     GroupElement(   391424, cb),  GroupElement(68221730816, cb)},
-        {GroupElement(   -44, cb),     GroupElement(   230912, cb),  GroupElement(68408836096, cb)},
-        {GroupElement(     0, cb),     GroupElement(        0, cb),  flt2fxd(1, degree*sin + scoef, cb)},
-        // start of x=N/2
-        {GroupElement(     0, cb),     GroupElement(        0, cb),  GroupElement(          0, cb)},
-        {GroupElement(    43, cb),     GroupElement(   230912, cb),  GroupElement(  310575104, cb)},
-        {GroupElement(    77, cb),     GroupElement(   391424, cb),  GroupElement(  497680384, cb)},
-        {GroupElement(   143, cb),     GroupElement(   675584, cb),  GroupElement(  806551552, cb)},
-        {GroupElement(   262, cb),     GroupElement(  1156096, cb),  GroupElement( 1291649024, cb)},
-        {GroupElement(   480, cb),     GroupElement(  1968640, cb),  GroupElement( 2048917504, cb)},
-        {GroupElement(   878, cb),     GroupElement(  3328512, cb),  GroupElement( 3210412032, cb)},
-        {GroupElement(  1601, cb),     GroupElement(  5576960, cb),  GroupElement( 4956487680, cb)},
-        {GroupElement(  2909, cb),     GroupElement(  9231616, cb),  GroupElement( 7510818816, cb)},
-        {GroupElement(  5239, cb),     GroupElement( 15022848, cb),  GroupElement(11108614144, cb)},
-        {GroupElement(  9294, cb),     GroupElement( 23839744, cb),  GroupElement(15901392896, cb)},
-        {GroupElement( 16036, cb),     GroupElement( 36404992, cb),  GroupElement(21756051456, cb)},
-        {GroupElement( 26311, cb),     GroupElement( 52363008, cb),  GroupElement(27952218112, cb)},
-        {GroupElement( 39417, cb),     GroupElement( 68647680, cb),  GroupElement(33010679808, cb)},
-        {GroupElement( 50109, cb),     GroupElement( 78611456, cb),  GroupElement(35331899392, cb)},
-        {GroupElement( 46755, cb),     GroupElement( 76527616, cb),  GroupElement(35008282624, cb)},
-        {GroupElement( 19868, cb),     GroupElement( 68175872, cb),  GroupElement(34359738368, cb)},
-    };
+            { GroupElement(  19864 , cb) ,  GroupElement(      136350720 , cb) , GroupElement(   137438691328 , cb)},
+        };
 
-    std::vector<GroupElement> fxd_p 
-    {   GroupElement(0, ib),
-        GroupElement(155, ib),
-        GroupElement(310, ib),
-        GroupElement(465, ib),
-        GroupElement(621, ib),
-        GroupElement(776, ib),
-        GroupElement(931, ib),
-        GroupElement(1087, ib),
-        GroupElement(1242, ib),
-        GroupElement(1397, ib),
-        GroupElement(1553, ib),
-        GroupElement(1708, ib),
-        GroupElement(1863, ib),
-        GroupElement(2019, ib),
-        GroupElement(2174, ib),
-        GroupElement(2329, ib),
-        GroupElement(2485, ib),
-        // x=N/2
-        GroupElement(32767, ib),
-        GroupElement(-2485, ib),
-        GroupElement(-2330, ib),
-        GroupElement(-2175, ib),
-        GroupElement(-2020, ib),
-        GroupElement(-1864, ib),
-        GroupElement(-1709, ib),
-        GroupElement(-1554, ib),
-        GroupElement(-1398, ib),
-        GroupElement(-1243, ib),
-        GroupElement(-1088, ib),
-        GroupElement( -932, ib),
-        GroupElement( -777, ib),
-        GroupElement( -622, ib),
-        GroupElement( -466, ib),
-        GroupElement( -311, ib),
-        GroupElement( -156, ib)
-    };
-#elif defined(SIGMOID_11_14)
-    std::vector<std::vector<GroupElement>> fxd_polynomials
+        t.p = {GroupElement(0, ib),    GroupElement(310, ib),    GroupElement(621, ib),    GroupElement(931, ib),   GroupElement(1242, ib),   GroupElement(1552, ib),   GroupElement(1863, ib),   GroupElement(2173, ib),   GroupElement(2484, ib),   GroupElement(2795, ib),   GroupElement(3105, ib),   GroupElement(3416, ib),   GroupElement(3726, ib),   GroupElement(4037, ib),   GroupElement(4347, ib),  GroupElement(4658, ib),
+        GroupElement(4969, ib), /* important one */ GroupElement(32767, ib),
+        GroupElement(-4969, ib),  GroupElement(-4659, ib),  GroupElement(-4348, ib),  GroupElement(-4038, ib),  GroupElement(-3727, ib),  GroupElement(-3417, ib),  GroupElement(-3106, ib),  GroupElement(-2796, ib),  GroupElement(-2485, ib),  GroupElement(-2174, ib),  GroupElement(-1864, ib),  GroupElement(-1553, ib),  GroupElement(-1243, ib),  GroupElement(-932, ib),   GroupElement(-622, ib),   GroupElement(-311, ib)
+        };
+    }
+    else if (bitlen == 16 && scaleIn == 8 && scaleOut == 14)
     {
-        {GroupElement(-19863, cb), GroupElement(  545402880, cb), GroupElement(  2199019061248, cb)},
-        {GroupElement(-46749, cb), GroupElement(  612192256, cb), GroupElement(  2157541588992, cb)},
-        {GroupElement(-50115, cb), GroupElement(  628916224, cb), GroupElement(  2136767201280, cb)},
-        {GroupElement(-39432, cb), GroupElement(  549302272, cb), GroupElement(  2285102956544, cb)},
-        {GroupElement(-26328, cb), GroupElement(  419088384, cb), GroupElement(  2608588652544, cb)},
-        {GroupElement(-16051, cb), GroupElement(  291432448, cb), GroupElement(  3004996517888, cb)},
-        {GroupElement( -9305, cb), GroupElement(  190885888, cb), GroupElement(  3379673694208, cb)},
-        {GroupElement( -5247, cb), GroupElement(  120313856, cb), GroupElement(  3686482837504, cb)},
-        {GroupElement( -2914, cb), GroupElement(   73947136, cb), GroupElement(  3916846596096, cb)},
-        {GroupElement( -1605, cb), GroupElement(   44681216, cb), GroupElement(  4080437035008, cb)},
-        {GroupElement(  -880, cb), GroupElement(   26671104, cb), GroupElement(  4192286539776, cb)},
-        {GroupElement(  -482, cb), GroupElement(   15777792, cb), GroupElement(  4266706075648, cb)},
-        {GroupElement(  -263, cb), GroupElement(    9267200, cb), GroupElement(  4315229978624, cb)},
-        {GroupElement(  -144, cb), GroupElement(    5416960, cb), GroupElement(  4346322354176, cb)},
-        {GroupElement(   -79, cb), GroupElement(    3139584, cb), GroupElement(  4366123663360, cb)},
-        {GroupElement(   -44, cb), GroupElement(    1851392, cb), GroupElement(  4378115178496, cb)},
-        {GroupElement(     0, cb), GroupElement(          0, cb), flt2fxd(1, degree*sin + scoef, cb)},
-        // x=N/2
-        {GroupElement(     0, cb), GroupElement(          0, cb), GroupElement(              0, cb)},
-        {GroupElement(    43, cb), GroupElement(    1851392, cb), GroupElement(    19927138304, cb)},
-        {GroupElement(    78, cb), GroupElement(    3139584, cb), GroupElement(    31918653440, cb)},
-        {GroupElement(   143, cb), GroupElement(    5416960, cb), GroupElement(    51719962624, cb)},
-        {GroupElement(   262, cb), GroupElement(    9267200, cb), GroupElement(    82812338176, cb)},
-        {GroupElement(   481, cb), GroupElement(   15777792, cb), GroupElement(   131336241152, cb)},
-        {GroupElement(   879, cb), GroupElement(   26671104, cb), GroupElement(   205755777024, cb)},
-        {GroupElement(  1604, cb), GroupElement(   44681216, cb), GroupElement(   317605281792, cb)},
-        {GroupElement(  2913, cb), GroupElement(   73947136, cb), GroupElement(   481195720704, cb)},
-        {GroupElement(  5246, cb), GroupElement(  120313856, cb), GroupElement(   711559479296, cb)},
-        {GroupElement(  9304, cb), GroupElement(  190885888, cb), GroupElement(  1018368622592, cb)},
-        {GroupElement( 16050, cb), GroupElement(  291432448, cb), GroupElement(  1393045798912, cb)},
-        {GroupElement( 26327, cb), GroupElement(  419088384, cb), GroupElement(  1789453664256, cb)},
-        {GroupElement( 39431, cb), GroupElement(  549302272, cb), GroupElement(  2112939360256, cb)},
-        {GroupElement( 50114, cb), GroupElement(  628916224, cb), GroupElement(  2261275115520, cb)},
-        {GroupElement( 46748, cb), GroupElement(  612192256, cb), GroupElement(  2240500727808, cb)},
-        {GroupElement( 19862, cb), GroupElement(  545402880, cb), GroupElement(  2199019061248, cb)},
-    };
-
-    std::vector<GroupElement> fxd_p 
+        t.polynomials =
+        {
+            {GroupElement(-19869, cb),     GroupElement( 68175872, cb),  GroupElement(34359738368, cb)},
+            {GroupElement(-46756, cb),     GroupElement( 76527616, cb),  GroupElement(33711128576, cb)},
+            {GroupElement(-50110, cb),     GroupElement( 78611456, cb),  GroupElement(33387511808, cb)},
+            {GroupElement(-39418, cb),     GroupElement( 68647680, cb),  GroupElement(35708731392, cb)},
+            {GroupElement(-26312, cb),     GroupElement( 52363008, cb),  GroupElement(40767193088, cb)},
+            {GroupElement(-16037, cb),     GroupElement( 36404992, cb),  GroupElement(46963359744, cb)},
+            {GroupElement( -9295, cb),     GroupElement( 23839744, cb),  GroupElement(52818018304, cb)},
+            {GroupElement( -5240, cb),     GroupElement( 15022848, cb),  GroupElement(57610797056, cb)},
+            {GroupElement( -2910, cb),     GroupElement(  9231616, cb),  GroupElement(61208592384, cb)},
+            {GroupElement( -1602, cb),     GroupElement(  5576960, cb),  GroupElement(63762923520, cb)},
+            {GroupElement(  -879, cb),     GroupElement(  3328512, cb),  GroupElement(65508999168, cb)},
+            {GroupElement(  -481, cb),     GroupElement(  1968640, cb),  GroupElement(66670493696, cb)},
+            {GroupElement(  -263, cb),     GroupElement(  1156096, cb),  GroupElement(67427762176, cb)},
+            {GroupElement(  -144, cb),     GroupElement(   675584, cb),  GroupElement(67912859648, cb)},
+            {GroupElement(   -78, cb),     GroupElement(   391424, cb),  GroupElement(68221730816, cb)},
+            {GroupElement(   -44, cb),     GroupElement(   230912, cb),  GroupElement(68408836096, cb)},
+            {GroupElement(     0, cb),     GroupElement(        0, cb),  flt2fxd(1, degree*sin + scoef, cb)},
+            // start of x=N/2
+            {GroupElement(     0, cb),     GroupElement(        0, cb),  GroupElement(          0, cb)},
+            {GroupElement(    43, cb),     GroupElement(   230912, cb),  GroupElement(  310575104, cb)},
+            {GroupElement(    77, cb),     GroupElement(   391424, cb),  GroupElement(  497680384, cb)},
+            {GroupElement(   143, cb),     GroupElement(   675584, cb),  GroupElement(  806551552, cb)},
+            {GroupElement(   262, cb),     GroupElement(  1156096, cb),  GroupElement( 1291649024, cb)},
+            {GroupElement(   480, cb),     GroupElement(  1968640, cb),  GroupElement( 2048917504, cb)},
+            {GroupElement(   878, cb),     GroupElement(  3328512, cb),  GroupElement( 3210412032, cb)},
+            {GroupElement(  1601, cb),     GroupElement(  5576960, cb),  GroupElement( 4956487680, cb)},
+            {GroupElement(  2909, cb),     GroupElement(  9231616, cb),  GroupElement( 7510818816, cb)},
+            {GroupElement(  5239, cb),     GroupElement( 15022848, cb),  GroupElement(11108614144, cb)},
+            {GroupElement(  9294, cb),     GroupElement( 23839744, cb),  GroupElement(15901392896, cb)},
+            {GroupElement( 16036, cb),     GroupElement( 36404992, cb),  GroupElement(21756051456, cb)},
+            {GroupElement( 26311, cb),     GroupElement( 52363008, cb),  GroupElement(27952218112, cb)},
+            {GroupElement( 39417, cb),     GroupElement( 68647680, cb),  GroupElement(33010679808, cb)},
+            {GroupElement( 50109, cb),     GroupElement( 78611456, cb),  GroupElement(35331899392, cb)},
+            {GroupElement( 46755, cb),     GroupElement( 76527616, cb),  GroupElement(35008282624, cb)},
+            {GroupElement( 19868, cb),     GroupElement( 68175872, cb),  GroupElement(34359738368, cb)},
+        };
+
+        t.p =
+        {   GroupElement(0, ib),
+            GroupElement(155, ib),
+            GroupElement(310, ib),
+            GroupElement(465, ib),
+            GroupElement(621, ib),
+            GroupElement(776, ib),
+            GroupElement(931, ib),
+            GroupElement(1087, ib),
+            GroupElement(1242, ib),
+            GroupElement(1397, ib),
+            GroupElement(1553, ib),
+            GroupElement(1708, ib),
+            GroupElement(1863, ib),
+            GroupElement(2019, ib),
+            GroupElement(2174, ib),
+            GroupElement(2329, ib),
+            GroupElement(2485, ib),
+            // x=N/2
+            GroupElement(32767, ib),
+            GroupElement(-2485, ib),
+            GroupElement(-2330, ib),
+            GroupElement(-2175, ib),
+            GroupElement(-2020, ib),
+            GroupElement(-1864, ib),
+            GroupElement(-1709, ib),
+            GroupElement(-1554, ib),
+            GroupElement(-1398, ib),
+            GroupElement(-1243, ib),
+            GroupElement(-1088, ib),
+            GroupElement( -932, ib),
+            GroupElement( -777, ib),
+            GroupElement( -622, ib),
+            GroupElement( -466, ib),
+            GroupElement( -311, ib),
+            GroupElement( -156, ib)
+        };
+    }
+    else if (bitlen == 16 && scaleIn == 11 && scaleOut == 14)
     {
-        GroupElement(     0, ib),
-        GroupElement(  1242, ib),
-        GroupElement(  2484, ib),
-        GroupElement(  3726, ib),
-        GroupElement(  4968, ib),
-        GroupElement(  6210, ib),
-        GroupElement(  7452, ib),
-        GroupElement(  8694, ib),
-        GroupElement(  9937, ib),
-        GroupElement( 11179, ib),
-        GroupElement( 12421, ib),
-        GroupElement( 13663, ib),
-        GroupElement( 14905, ib),
-        GroupElement( 16147, ib),
-        GroupElement( 17389, ib),
-        GroupElement( 18631, ib),
-        GroupElement( 19874, ib),
-        // x=N/2
-        GroupElement( 32767, ib),
-        GroupElement(-19874, ib),
-        GroupElement(-18632, ib),
-        GroupElement(-17390, ib),
-        GroupElement(-16148, ib),
-        GroupElement(-14906, ib),
-        GroupElement(-13664, ib),
-        GroupElement(-12422, ib),
-        GroupElement(-11180, ib),
-        GroupElement( -9937, ib),
-        GroupElement( -8695, ib),
-        GroupElement( -7453, ib),
-        GroupElement( -6211, ib),
-        GroupElement( -4969, ib),
-        GroupElement( -3727, ib),
-        GroupElement( -2485, ib),
-        GroupElement( -1243, ib)
-    };
-#elif defined(SIGMOID_13_14)
-    std::vector<std::vector<GroupElement>> fxd_polynomials
+        t.polynomials =
+        {
+            {GroupElement(-19863, cb), GroupElement(  545402880, cb), GroupElement(  2199019061248, cb)},
+            {GroupElement(-46749, cb), GroupElement(  612192256, cb), GroupElement(  2157541588992, cb)},
+            {GroupElement(-50115, cb), GroupElement(  628916224, cb), GroupElement(  2136767201280, cb)},
+            {GroupElement(-39432, cb), GroupElement(  549302272, cb), GroupElement(  2285102956544, cb)},
+            {GroupElement(-26328, cb), GroupElement(  419088384, cb), GroupElement(  2608588652544, cb)},
+            {GroupElement(-16051, cb), GroupElement(  291432448, cb), GroupElement(  3004996517888, cb)},
+            {GroupElement( -9305, cb), GroupElement(  190885888, cb), GroupElement(  3379673694208, cb)},
+            {GroupElement( -5247, cb), GroupElement(  120313856, cb), GroupElement(  3686482837504, cb)},
+            {GroupElement( -2914, cb), GroupElement(   73947136, cb), GroupElement(  3916846596096, cb)},
+            {GroupElement( -1605, cb), GroupElement(   44681216, cb), GroupElement(  4080437035008, cb)},
+            {GroupElement(  -880, cb), GroupElement(   26671104, cb), GroupElement(  4192286539776, cb)},
+            {GroupElement(  -482, cb), GroupElement(   15777792, cb), GroupElement(  4266706075648, cb)},
+            {GroupElement(  -263, cb), GroupElement(    9267200, cb), GroupElement(  4315229978624, cb)},
+            {GroupElement(  -144, cb), GroupElement(    5416960, cb), GroupElement(  4346322354176, cb)},
+            {GroupElement(   -79, cb), GroupElement(    3139584, cb), GroupElement(  4366123663360, cb)},
+            {GroupElement(   -44, cb), GroupElement(    1851392, cb), GroupElement(  4378115178496, cb)},
+            {GroupElement(     0, cb), GroupElement(          0, cb), flt2fxd(1, degree*sin + scoef, cb)},
+            // x=N/2
+            {GroupElement(     0, cb), GroupElement(          0, cb), GroupElement(              0, cb)},
+            {GroupElement(    43, cb), GroupElement(    1851392, cb), GroupElement(    19927138304, cb)},
+            {GroupElement(    78, cb), GroupElement(    3139584, cb), GroupElement(    31918653440, cb)},
+            {GroupElement(   143, cb), GroupElement(    5416960, cb), GroupElement(    51719962624, cb)},
+            {GroupElement(   262, cb), GroupElement(    9267200, cb), GroupElement(    82812338176, cb)},
+            {GroupElement(   481, cb), GroupElement(   15777792, cb), GroupElement(   131336241152, cb)},
+            {GroupElement(   879, cb), GroupElement(   26671104, cb), GroupElement(   205755777024, cb)},
+            {GroupElement(  1604, cb), GroupElement(   44681216, cb), GroupElement(   317605281792, cb)},
+            {GroupElement(  2913, cb), GroupElement(   73947136, cb), GroupElement(   481195720704, cb)},
+            {GroupElement(  5246, cb), GroupElement(  120313856, cb), GroupElement(   711559479296, cb)},
+            {GroupElement(  9304, cb), GroupElement(  190885888, cb), GroupElement(  1018368622592, cb)},
+            {GroupElement( 16050, cb), GroupElement(  291432448, cb), GroupElement(  1393045798912, cb)},
+            {GroupElement( 26327, cb), GroupElement(  419088384, cb), GroupElement(  1789453664256, cb)},
+            {GroupElement( 39431, cb), GroupElement(  549302272, cb), GroupElement(  2112939360256, cb)},
+            {GroupElement( 50114, cb), GroupElement(  628916224, cb), GroupElement(  2261275115520, cb)},
+            {GroupElement( 46748, cb), GroupElement(  612192256, cb), GroupElement(  2240500727808, cb)},
+            {GroupElement( 19862, cb), GroupElement(  545402880, cb), GroupElement(  2199019061248, cb)},
+        };
+
+        t.p =
+        {
+            GroupElement(     0, ib),
+            GroupElement(  1242, ib),
+            GroupElement(  2484, ib),
+            GroupElement(  3726, ib),
+            GroupElement(  4968, ib),
+            GroupElement(  6210, ib),
+            GroupElement(  7452, ib),
+            GroupElement(  8694, ib),
+            GroupElement(  9937, ib),
+            GroupElement( 11179, ib),
+            GroupElement( 12421, ib),
+            GroupElement( 13663, ib),
+            GroupElement( 14905, ib),
+            GroupElement( 16147, ib),
+            GroupElement( 17389, ib),
+            GroupElement( 18631, ib),
+            GroupElement( 19874, ib),
+            // x=N/2
+            GroupElement( 32767, ib),
+            GroupElement(-19874, ib),
+            GroupElement(-18632, ib),
+            GroupElement(-17390, ib),
+            GroupElement(-16148, ib),
+            GroupElement(-14906, ib),
+            GroupElement(-13664, ib),
+            GroupElement(-12422, ib),
+            GroupElement(-11180, ib),
+            GroupElement( -9937, ib),
+            GroupElement( -8695, ib),
+            GroupElement( -7453, ib),
+            GroupElement( -6211, ib),
+            GroupElement( -4969, ib),
+            GroupElement( -3727, ib),
+            GroupElement( -2485, ib),
+            GroupElement( -1243, ib)
+        };
+    }
+    else if (bitlen == 16 && scaleIn == 13 && scaleOut == 14)
     {
-        {GroupElement( -18720, cb), GroupElement(  2177662976, cb), GroupElement( 35184304979968, cb)},
-        {GroupElement( -45253, cb), GroupElement(  2426077184, cb), GroupElement( 34602940891136, cb)},
-        {GroupElement( -50752, cb), GroupElement(  2529050624, cb), GroupElement( 34120897921024, cb)},
-        {GroupElement( -42055, cb), GroupElement(  2284789760, cb), GroupElement( 35835999158272, cb)},
-        {GroupElement( -29603, cb), GroupElement(  1818443776, cb), GroupElement( 40202034741248, cb)},
-        {GroupElement( -18884, cb), GroupElement(  1316691968, cb), GroupElement( 46074060341248, cb)},
-        {GroupElement( -11677, cb), GroupElement(   911826944, cb), GroupElement( 51759657517056, cb)},
-        // dummy poly b/w 2^16-1 and -2^16, problem arising b/c we have ib=64 and actual bitlen=16}
-        {GroupElement(      0, cb), GroupElement(           0, cb), GroupElement(              0, cb)},
-        {GroupElement(  11676, cb), GroupElement(   911826944, cb), GroupElement( 18609019551744, cb)},
-        {GroupElement(  18883, cb), GroupElement(  1316691968, cb), GroupElement( 24294616727552, cb)},
-        {GroupElement(  29602, cb), GroupElement(  1818443776, cb), GroupElement( 30166642327552, cb)},
-        {GroupElement(  42054, cb), GroupElement(  2284789760, cb), GroupElement( 34532677910528, cb)},
-        {GroupElement(  50751, cb), GroupElement(  2529050624, cb), GroupElement( 36247779147776, cb)},
-        {GroupElement(  45252, cb), GroupElement(  2426077184, cb), GroupElement( 35765736177664, cb)},
-        {GroupElement(  18719, cb), GroupElement(  2177662976, cb), GroupElement( 35184304979968, cb)}
-    };
-
-    std::vector<GroupElement> fxd_p 
+        t.polynomials =
+        {
+            {GroupElement( -18720, cb), GroupElement(  2177662976, cb), GroupElement( 35184304979968, cb)},
+            {GroupElement( -45253, cb), GroupElement(  2426077184, cb), GroupElement( 34602940891136, cb)},
+            {GroupElement( -50752, cb), GroupElement(  2529050624, cb), GroupElement( 34120897921024, cb)},
+            {GroupElement( -42055, cb), GroupElement(  2284789760, cb), GroupElement( 35835999158272, cb)},
+            {GroupElement( -29603, cb), GroupElement(  1818443776, cb), GroupElement( 40202034741248, cb)},
+            {GroupElement( -18884, cb), GroupElement(  1316691968, cb), GroupElement( 46074060341248, cb)},
+            {GroupElement( -11677, cb), GroupElement(   911826944, cb), GroupElement( 51759657517056, cb)},
+            // dummy poly b/w 2^16-1 and -2^16, problem arising b/c we have ib=64 and actual bitlen=16}
+            {GroupElement(      0, cb), GroupElement(           0, cb), GroupElement(              0, cb)},
+            {GroupElement(  11676, cb), GroupElement(   911826944, cb), GroupElement( 18609019551744, cb)},
+            {GroupElement(  18883, cb), GroupElement(  1316691968, cb), GroupElement( 24294616727552, cb)},
+            {GroupElement(  29602, cb), GroupElement(  1818443776, cb), GroupElement( 30166642327552, cb)},
+            {GroupElement(  42054, cb), GroupElement(  2284789760, cb), GroupElement( 34532677910528, cb)},
+            {GroupElement(  50751, cb), GroupElement(  2529050624, cb), GroupElement( 36247779147776, cb)},
+            {GroupElement(  45252, cb), GroupElement(  2426077184, cb), GroupElement( 35765736177664, cb)},
+            {GroupElement(  18719, cb), GroupElement(  2177662976, cb), GroupElement( 35184304979968, cb)}
+        };
+
+        t.p =
+        {
+            GroupElement(     0, ib),
+            GroupElement(  4681, ib),
+            GroupElement(  9362, ib),
+            GroupElement( 14043, ib),
+            GroupElement( 18724, ib),
+            GroupElement( 23405, ib),
+            GroupElement( 28086, ib),
+            GroupElement( 32767, ib),
+            // blank area that is due to ib=64 and actual i/p bitlen 16
+            GroupElement(-32768, ib),
+            GroupElement(-28087, ib),
+            GroupElement(-23406, ib),
+            GroupElement(-18725, ib),
+            GroupElement(-14044, ib),
+            GroupElement( -9363, ib),
+            GroupElement( -4682, ib)
+        };
+    }
+    else
     {
-        GroupElement(     0, ib),
-        GroupElement(  4681, ib),
-        GroupElement(  9362, ib),
-        GroupElement( 14043, ib),
-        GroupElement( 18724, ib),
-        GroupElement( 23405, ib),
-        GroupElement( 28086, ib),
-        GroupElement( 32767, ib),
-        // blank area that is due to ib=64 and actual i/p bitlen 16
-        GroupElement(-32768, ib),
-        GroupElement(-28087, ib),
-        GroupElement(-23406, ib),
-        GroupElement(-18725, ib),
-        GroupElement(-14044, ib),
-        GroupElement( -9363, ib),
-        GroupElement( -4682, ib)
-    };
-#else 
-    throw std::invalid_argument("no scales selected for sigmoid");    
-#endif
-
-    int numPoly = fxd_polynomials.size(), m = numPoly;
-    fxd_p.push_back(GroupElement(-1, ib));
+        return false;
+    }
 
-    return keyGenSigmoid(ib, ob, numPoly, degree, fxd_polynomials, fxd_p, rin, rout);
+    t.degree = degree;
+    t.scaleCoef = scaleCoef;
+    return true;
 }
 
 GroupElement evalSigmoid_main_wrapper(int party, GroupElement x, SplineKeyPack &k)
@@ -840,29 +823,14 @@ GroupElement evalSigmoid_main_wrapper(int party, GroupElement x, SplineKeyPack &
     return evalSigmoid(party, x, k);
 }
 
-std::pair<SplineKeyPack, SplineKeyPack> keyGenTanh_main_wrapper(int Bin, int Bout, int scaleIn, int scaleOut,
-                    GroupElement rin, GroupElement rout)
+// Splines fitted offline in octave; false if there is none for
+// (bitlen, scaleIn, scaleOut)
+static bool tanhTable(int bitlen, int scaleIn, int scaleOut, SplineTable &t)
 {
-    // todo: add other scales
-    assert((Bin == 64) && (Bout == 64));
-#if defined(TANH_12_12) || defined(SIGMOID_TANH_37)
-    assert((scaleIn == 12) && (scaleOut == 12));
-#elif defined(TANH_9_9)
-    assert((scaleIn == 9) && (scaleOut == 9));
-#elif defined(TANH_8_8)
-    assert((scaleIn == 8) && (scaleOut == 8));
-#elif defined(TANH_11_11)
-    assert((scaleIn == 11) && (scaleOut == 11));
-#elif defined(TANH_13_13)
-    assert((scaleIn == 13) && (scaleOut == 13));
-#else 
-    throw std::invalid_argument("no scales selected for tanh");
-#endif
-
     // imp: make sure different choices of i/p, o/p scales use same coef scale
     int scaleCoef = 18, coefBitsize = 64;
 
-    int ib = Bin, cb = coefBitsize, ob = Bout, sin = scaleIn, scoef = scaleCoef, sout = scaleOut;
+    int ib = 64, cb = coefBitsize, sin = scaleIn, scoef = scaleCoef;
     // from octave:
 
     // best fit for spline with ulp 4: degree = 2 and 10 polys
@@ -885,7 +853,7 @@ std::pair<SplineKeyPack, SplineKeyPack> keyGenTanh_main_wrapper(int Bin, int Bou
     // -8319      25172480     49230118912
     // -1192      4930048      63602163712
 
-    
+
 
     // breakpoints: size 11
     // -1775  -1420  -1065   -710   -355      0    355    710   1065   1420   1775
@@ -920,312 +888,676 @@ std::pair<SplineKeyPack, SplineKeyPack> keyGenTanh_main_wrapper(int Bin, int Bou
 
     int degree = 2;
 
-#if defined(TANH_12_12) || defined(SIGMOID_TANH_37)
-
-// turns out coefs and breaks for bitlen 16 and 37 are same (scale being 12 in both)
-// (but i'm still including this case)
-// this is because flt cutoffs are -4.3 to 4.3 (can be fit in both bitlengths)
-
-// this wont happen in sigmoid because for bitlen 16, flt cutoffs are forced to be 8
-// (actual flt cutoffs go > 8 but can only do so for bitlen 37)
-// so, intervals for spline will change and so will coefs
-
-    std::vector<std::vector<GroupElement>> fxd_polynomials {
-        {GroupElement(  -49070 , cb) ,   GroupElement(    1100283904 , cb) , GroupElement(               0 , cb)},
-        {GroupElement( -101928 , cb) ,   GroupElement(    1262866432 , cb) , GroupElement(   -125023813632 , cb)},
-        {GroupElement(  -89387 , cb) ,   GroupElement(    1185718272 , cb) , GroupElement(     -6375342080 , cb)},
-        {GroupElement(  -56632 , cb) ,   GroupElement(     883470336 , cb) , GroupElement(    690868977664 , cb)},
-        {GroupElement(  -30750 , cb) ,   GroupElement(     565043200 , cb) , GroupElement(   1670306070528 , cb)},
-        {GroupElement(  -15516 , cb) ,   GroupElement(     330747904 , cb) , GroupElement(   2571108352000 , cb)},
-        {GroupElement(   -7557 , cb) ,   GroupElement(     183861248 , cb) , GroupElement(   3248807215104 , cb)},
-        {GroupElement(   -3621 , cb) ,   GroupElement(      99115008 , cb) , GroupElement(   3704962940928 , cb)},
-        {GroupElement(   -1721 , cb) ,   GroupElement(      52363264 , cb) , GroupElement(   3992574754816 , cb)},
-        {GroupElement(    -816 , cb) ,   GroupElement(      27312128 , cb) , GroupElement(   4165950504960 , cb)},
-        {GroupElement(    -384 , cb) ,   GroupElement(      14049280 , cb) , GroupElement(   4267939201024 , cb)},
-        {GroupElement(    -186 , cb) ,   GroupElement(       7348224 , cb) , GroupElement(   4324612636672 , cb)},
-        {GroupElement(       0 , cb) ,   GroupElement(             0 , cb) , flt2fxd(1, degree*sin + scoef, cb)},
-        {GroupElement(       0 , cb) ,   GroupElement(             0 , cb) , flt2fxd(-1, degree*sin + scoef, cb)}, 
-        {GroupElement(     185 , cb) ,   GroupElement(       7348224 , cb) , GroupElement(  -4324629413888 , cb)},
-        {GroupElement(     383 , cb) ,   GroupElement(      14049280 , cb) , GroupElement(  -4267955978240 , cb)},
-        {GroupElement(     815 , cb) ,   GroupElement(      27312128 , cb) , GroupElement(  -4165967282176 , cb)},
-        {GroupElement(    1720 , cb) ,   GroupElement(      52363264 , cb) , GroupElement(  -3992591532032 , cb)},
-        {GroupElement(    3620 , cb) ,   GroupElement(      99115008 , cb) , GroupElement(  -3704979718144 , cb)},
-        {GroupElement(    7556 , cb) ,   GroupElement(     183861248 , cb) , GroupElement(  -3248823992320 , cb)},
-        {GroupElement(   15515 , cb) ,   GroupElement(     330747904 , cb) , GroupElement(  -2571125129216 , cb)},
-        {GroupElement(   30749 , cb) ,   GroupElement(     565043200 , cb) , GroupElement(  -1670322847744 , cb)},
-        {GroupElement(   56631 , cb) ,   GroupElement(     883470336 , cb) , GroupElement(   -690885754880 , cb)},
-        {GroupElement(   89386 , cb) ,   GroupElement(    1185718272 , cb) , GroupElement(      6358564864 , cb)},
-        {GroupElement(  101927 , cb) ,   GroupElement(    1262866432 , cb) , GroupElement(    125007036416 , cb)},
-        {GroupElement(   49069 , cb) ,   GroupElement(    1100283904 , cb) , GroupElement(               0 , cb)},   
-    };
+    if ((bitlen == 16 || bitlen == 37) && scaleIn == 12 && scaleOut == 12)
+    {
+        // turns out coefs and breaks for bitlen 16 and 37 are same (scale being 12 in both),
+        // except for the important knot at N/2 - 1
+        // this is because flt cutoffs are -4.3 to 4.3 (can be fit in both bitlengths)
+
+        // this wont happen in sigmoid because for bitlen 16, flt cutoffs are forced to be 8
+        // (actual flt cutoffs go > 8 but can only do so for bitlen 37)
+        // so, intervals for spline will change and so will coefs
+
+        t.polynomials = {
+            {GroupElement(  -49070 , cb) ,   GroupElement(    1100283904 , cb) , GroupElement(               0 , cb)},
+            {GroupElement( -101928 , cb) ,   GroupElement(    1262866432 , cb) , GroupElement(   -125023813632 , cb)},
+            {GroupElement(  -89387 , cb) ,   GroupElement(    1185718272 , cb) , GroupElement(     -6375342080 , cb)},
+            {GroupElement(  -56632 , cb) ,   GroupElement(     883470336 , cb) , GroupElement(    690868977664 , cb)},
+            {GroupElement(  -30750 , cb) ,   GroupElement(     565043200 , cb) , GroupElement(   1670306070528 , cb)},
+            {GroupElement(  -15516 , cb) ,   GroupElement(     330747904 , cb) , GroupElement(   2571108352000 , cb)},
+            {GroupElement(   -7557 , cb) ,   GroupElement(     183861248 , cb) , GroupElement(   3248807215104 , cb)},
+            {GroupElement(   -3621 , cb) ,   GroupElement(      99115008 , cb) , GroupElement(   3704962940928 , cb)},
+            {GroupElement(   -1721 , cb) ,   GroupElement(      52363264 , cb) , GroupElement(   3992574754816 , cb)},
+            {GroupElement(    -816 , cb) ,   GroupElement(      27312128 , cb) , GroupElement(   4165950504960 , cb)},
+            {GroupElement(    -384 , cb) ,   GroupElement(      14049280 , cb) , GroupElement(   4267939201024 , cb)},
+            {GroupElement(    -186 , cb) ,   GroupElement(       7348224 , cb) , GroupElement(   4324612636672 , cb)},
+            {GroupElement(       0 , cb) ,   GroupElement(             0 , cb) , flt2fxd(1, degree*sin + scoef, cb)},
+            {GroupElement(       0 , cb) ,   GroupElement(             0 , cb) , flt2fxd(-1, degree*sin + scoef, cb)}, 
+            {GroupElement(     185 , cb) ,   GroupElement(       7348224 , cb) , GroupElement(  -4324629413888 , cb)},
+            {GroupElement(     383 , cb) ,   GroupElement(      14049280 , cb) , GroupElement(  -4267955978240 , cb)},
+            {GroupElement(     815 , cb) ,   GroupElement(      27312128 , cb) , GroupElement(  -4165967282176 , cb)},
+            {GroupElement(    1720 , cb) ,   GroupElement(      52363264 , cb) , GroupElement(  -3992591532032 , cb)},
+            {GroupElement(    3620 , cb) ,   GroupElement(      99115008 , cb) , GroupElement(  -3704979718144 , cb)},
+            {GroupElement(    7556 , cb) ,   GroupElement(     183861248 , cb) , GroupElement(  -3248823992320 , cb)},
+            {GroupElement(   15515 , cb) ,   GroupElement(     330747904 , cb) , GroupElement(  -2571125129216 , cb)},
+            {GroupElement(   30749 , cb) ,   GroupElement(     565043200 , cb) , GroupElement(  -1670322847744 , cb)},
+            {GroupElement(   56631 , cb) ,   GroupElement(     883470336 , cb) , GroupElement(   -690885754880 , cb)},
+            {GroupElement(   89386 , cb) ,   GroupElement(    1185718272 , cb) , GroupElement(      6358564864 , cb)},
+            {GroupElement(  101927 , cb) ,   GroupElement(    1262866432 , cb) , GroupElement(    125007036416 , cb)},
+            {GroupElement(   49069 , cb) ,   GroupElement(    1100283904 , cb) , GroupElement(               0 , cb)},   
+        };
+
+        t.p = {GroupElement(0, ib),    GroupElement(1537, ib),    GroupElement(3075, ib),    GroupElement(4613, ib),    GroupElement(6151, ib),    GroupElement(7689, ib),    GroupElement(9227, ib),   GroupElement(10765, ib),   GroupElement(12303, ib),   GroupElement(13841, ib),   GroupElement(15379, ib),   GroupElement(16917, ib),   GroupElement(18455, ib),    /* important one */ GroupElement((1ULL << (bitlen - 1)) - 1, ib),
+        GroupElement(-18455, ib),  GroupElement(-16918, ib),  GroupElement(-15380, ib),  GroupElement(-13842, ib),  GroupElement(-12304, ib),  GroupElement(-10766, ib),   GroupElement(-9228, ib),   GroupElement(-7690, ib),   GroupElement(-6152, ib),   GroupElement(-4614, ib),   GroupElement(-3076, ib),   GroupElement(-1538, ib)
+        };
+    }
+    else if (bitlen == 16 && scaleIn == 9 && scaleOut == 9)  // scale is not 12 (input scale 9, output scale 9)
+    {
+        t.polynomials =
+        {
+           { GroupElement(-82639 , cb) ,   GroupElement(144710656 , cb) ,  GroupElement(         0 , cb)},
+           { GroupElement(-85271 , cb) ,   GroupElement(146579968 , cb) ,  GroupElement(-331874304, cb)},
+           { GroupElement(-25412 , cb) ,   GroupElement(61579776  , cb) ,  GroupElement(29842997248, cb)},
+           { GroupElement(-8319  , cb) ,   GroupElement(25172480  , cb) ,  GroupElement(49230118912, cb)},
+           { GroupElement(-1192  , cb) ,   GroupElement(4930048   , cb) ,  GroupElement(63602163712, cb)},
+           { GroupElement( 0    , cb)  ,   GroupElement(0     , cb) ,      flt2fxd(1, degree*sin + scoef, cb)     },
+
+           // after x=N/2
+
+           { GroupElement( 0    , cb)  ,   GroupElement(0       , cb) ,    flt2fxd(-1, degree*sin + scoef, cb)     },
+           { GroupElement(1191  , cb)  ,   GroupElement(4930048  , cb),   GroupElement(-63602425856 , cb)},
+           { GroupElement(8318  , cb)  ,   GroupElement(25172480 , cb),   GroupElement(-49230381056 , cb)},
+           { GroupElement(25411 , cb)  ,   GroupElement(61579776 , cb),   GroupElement(-29843259392 , cb)},
+           { GroupElement(85270 , cb)  ,   GroupElement(146579968, cb),   GroupElement(331612160    , cb)},
+           { GroupElement(82638 , cb)  ,   GroupElement(144710656, cb),   GroupElement(          0  , cb)}
+
+        };
+
+        t.p = {GroupElement(0, ib),    GroupElement(355, ib),    GroupElement(710, ib),   GroupElement(1065, ib),   GroupElement(1420, ib),   GroupElement(1775, ib),  GroupElement(32767, ib),
+        GroupElement(-1775, ib),  GroupElement(-1420, ib),  GroupElement(-1065, ib),   GroupElement(-710, ib),   GroupElement(-355, ib)
+        };
+    }
+    else if (bitlen == 16 && scaleIn == 8 && scaleOut == 8)
+    {
+        t.polynomials =
+        {
+           {GroupElement( -87883, cb),   GroupElement( 73233920, cb),  GroupElement(      -65536, cb)},
+           {GroupElement( -74280, cb),   GroupElement( 67799296, cb),  GroupElement(   542769152, cb)},
+           {GroupElement( -15013, cb),   GroupElement( 20444928, cb),  GroupElement( 10001776640, cb)},
+           {GroupElement(  -6420, cb),   GroupElement( 10146304, cb),  GroupElement( 13087539200, cb)},
+           {GroupElement(      0, cb),   GroupElement(        0, cb),  flt2fxd(1, degree*sin + scoef, cb)}, 
+           // after x=N/2
+           {GroupElement(      0, cb),   GroupElement(        0, cb),  flt2fxd(-1, degree*sin + scoef, cb)}, 
+           {GroupElement(   6419, cb),   GroupElement( 10146304, cb),  GroupElement(-13087604736, cb)},
+           {GroupElement(  15012, cb),   GroupElement( 20444928, cb),  GroupElement(-10001842176, cb)},
+           {GroupElement(  74279, cb),   GroupElement( 67799296, cb),  GroupElement(  -542834688, cb)},
+           {GroupElement(  87882, cb),   GroupElement( 73233920, cb),  GroupElement(      -65536, cb)}
+        };
+
+        t.p =
+        {
+            GroupElement(     0, ib),
+            GroupElement(   199, ib),
+            GroupElement(   399, ib),
+            GroupElement(   599, ib),
+            GroupElement(   799, ib),
+            GroupElement( 32767, ib),
+            // after x=N/2
+            GroupElement(  -799, ib),
+            GroupElement(  -600, ib),
+            GroupElement(  -400, ib),
+            GroupElement(  -200, ib)
+        };
+    }
+    else if (bitlen == 16 && scaleIn == 11 && scaleOut == 11)
+    {
+        t.polynomials =
+        {
+            {GroupElement( -59861, cb), GroupElement( 557158400, cb), GroupElement(       -4194304, cb)},
+            {GroupElement(-104442, cb), GroupElement( 641546240, cb), GroupElement(   -39938162688, cb)},
+            {GroupElement( -70219, cb), GroupElement( 511983616, cb), GroupElement(    82686509056, cb)},
+            {GroupElement( -34664, cb), GroupElement( 310079488, cb), GroupElement(   369325244416, cb)},
+            {GroupElement( -14913, cb), GroupElement( 160530432, cb), GroupElement(   652403015680, cb)},
+            {GroupElement(  -6150, cb), GroupElement(  77594624, cb), GroupElement(   848637722624, cb)},
+            {GroupElement(  -2463, cb), GroupElement(  35721216, cb), GroupElement(   967529463808, cb)},
+            {GroupElement(   -985, cb), GroupElement(  16142336, cb), GroupElement(  1032385986560, cb)},
+            {GroupElement(   -399, cb), GroupElement(   7270400, cb), GroupElement(  1065973972992, cb)},
+            {GroupElement(      0, cb), GroupElement(         0, cb), flt2fxd(1, degree*sin + scoef, cb)},
+            // after x=N/2
+            {GroupElement(      0, cb), GroupElement(         0, cb), flt2fxd(-1, degree*sin + scoef, cb)},
+            {GroupElement(    398, cb), GroupElement(   7270400, cb), GroupElement( -1065978167296, cb)},
+            {GroupElement(    984, cb), GroupElement(  16142336, cb), GroupElement( -1032390180864, cb)},
+            {GroupElement(   2462, cb), GroupElement(  35721216, cb), GroupElement(  -967533658112, cb)},
+            {GroupElement(   6149, cb), GroupElement(  77594624, cb), GroupElement(  -848641916928, cb)},
+            {GroupElement(  14912, cb), GroupElement( 160530432, cb), GroupElement(  -652407209984, cb)},
+            {GroupElement(  34663, cb), GroupElement( 310079488, cb), GroupElement(  -369329438720, cb)},
+            {GroupElement(  70218, cb), GroupElement( 511983616, cb), GroupElement(   -82690703360, cb)},
+            {GroupElement( 104441, cb), GroupElement( 641546240, cb), GroupElement(    39933968384, cb)},
+            {GroupElement(  59860, cb), GroupElement( 557158400, cb), GroupElement(       -4194304, cb)},
+        };
+
+        t.p =
+        {
+            GroupElement(    0, ib),
+            GroupElement(  946, ib),
+            GroupElement( 1892, ib),
+            GroupElement( 2839, ib),
+            GroupElement( 3785, ib),
+            GroupElement( 4732, ib),
+            GroupElement( 5678, ib),
+            GroupElement( 6625, ib),
+            GroupElement( 7571, ib),
+            GroupElement( 8518, ib),
+            GroupElement(32767, ib),
+            // after x=N/2
+            GroupElement(-8518, ib),
+            GroupElement(-7572, ib),
+            GroupElement(-6626, ib),
+            GroupElement(-5679, ib),
+            GroupElement(-4733, ib),
+            GroupElement(-3786, ib),
+            GroupElement(-2840, ib),
+            GroupElement(-1893, ib),
+            GroupElement( -947, ib)
+        };
+    }
+    else if (bitlen == 16 && scaleIn == 13 && scaleOut == 13)
+    {
+        t.polynomials =
+        {
+            {GroupElement( -37436, cb),  GroupElement(2177662976, cb), GroupElement(       -67108864, cb)},
+            {GroupElement( -90509, cb),  GroupElement(2426101760, cb), GroupElement(   -290782707712, cb)},
+            {GroupElement(-101496, cb),  GroupElement(2528968704, cb), GroupElement(   -531569311744, cb)},
+            {GroupElement( -84129, cb),  GroupElement(2285068288, cb), GroupElement(    324739792896, cb)},
+            {GroupElement( -59163, cb),  GroupElement(1817600000, cb), GroupElement(   2513025630208, cb)},
+            {GroupElement( -37872, cb),  GroupElement(1319256064, cb), GroupElement(   5429039988736, cb)},
+            {GroupElement( -22968, cb),  GroupElement( 900677632, cb), GroupElement(   8368206905344, cb)},
+            {GroupElement( -13507, cb),  GroupElement( 590635008, cb), GroupElement(  10908076081152, cb)},
+            {GroupElement(  -7805, cb),  GroupElement( 377094144, cb), GroupElement(  12907316248576, cb)},
+            {GroupElement(  -4465, cb),  GroupElement( 236412928, cb), GroupElement(  14389079965696, cb)},
+            {GroupElement(  -2540, cb),  GroupElement( 146276352, cb), GroupElement(  15443829981184, cb)},
+            {GroupElement(  -1442, cb),  GroupElement(  89726976, cb), GroupElement(  16171894046720, cb)},
+            {GroupElement(   -814, cb),  GroupElement(  54444032, cb), GroupElement(  16667358789632, cb)},
+            {GroupElement(   -470, cb),  GroupElement(  33513472, cb), GroupElement(  16985790349312, cb)},
+            // blank area b/w 2^16-1 and -2^16
+            {GroupElement(      0, cb),  GroupElement(         0, cb), GroupElement(               0, cb)},
+            {GroupElement(    469, cb),  GroupElement(  33513472, cb), GroupElement( -16985857458176, cb)},
+            {GroupElement(    813, cb),  GroupElement(  54444032, cb), GroupElement( -16667425898496, cb)},
+            {GroupElement(   1441, cb),  GroupElement(  89726976, cb), GroupElement( -16171961155584, cb)},
+            {GroupElement(   2539, cb),  GroupElement( 146276352, cb), GroupElement( -15443897090048, cb)},
+            {GroupElement(   4464, cb),  GroupElement( 236412928, cb), GroupElement( -14389147074560, cb)},
+            {GroupElement(   7804, cb),  GroupElement( 377094144, cb), GroupElement( -12907383357440, cb)},
+            {GroupElement(  13506, cb),  GroupElement( 590635008, cb), GroupElement( -10908143190016, cb)},
+            {GroupElement(  22967, cb),  GroupElement( 900677632, cb), GroupElement(  -8368274014208, cb)},
+            {GroupElement(  37871, cb),  GroupElement(1319256064, cb), GroupElement(  -5429107097600, cb)},
+            {GroupElement(  59162, cb),  GroupElement(1817600000, cb), GroupElement(  -2513092739072, cb)},
+            {GroupElement(  84128, cb),  GroupElement(2285068288, cb), GroupElement(   -324806901760, cb)},
+            {GroupElement( 101495, cb),  GroupElement(2528968704, cb), GroupElement(    531502202880, cb)},
+            {GroupElement(  90508, cb),  GroupElement(2426101760, cb), GroupElement(    290715598848, cb)},
+            {GroupElement(  37435, cb),  GroupElement(2177662976, cb), GroupElement(       -67108864, cb)},
+        };
+
+        t.p =
+        {
+            GroupElement(     0, ib),
+            GroupElement(  2340, ib),
+            GroupElement(  4681, ib),
+            GroupElement(  7021, ib),
+            GroupElement(  9362, ib),
+            GroupElement( 11702, ib),
+            GroupElement( 14043, ib),
+            GroupElement( 16384, ib),
+            GroupElement( 18724, ib),
+            GroupElement( 21065, ib),
+            GroupElement( 23405, ib),
+            GroupElement( 25746, ib),
+            GroupElement( 28086, ib),
+            GroupElement( 30427, ib),
+            GroupElement( 32767, ib),
+            // blank area b/w 2^16-1 and -2^16 because ib=64 and actual inp bitlen = 16
+            GroupElement(-32768, ib),
+            GroupElement(-30428, ib),
+            GroupElement(-28087, ib),
+            GroupElement(-25747, ib),
+            GroupElement(-23406, ib),
+            GroupElement(-21066, ib),
+            GroupElement(-18725, ib),
+            GroupElement(-16384, ib),
+            GroupElement(-14044, ib),
+            GroupElement(-11703, ib),
+            GroupElement( -9363, ib),
+            GroupElement( -7022, ib),
+            GroupElement( -4682, ib),
+            GroupElement( -2341, ib)
+        };
+    }
+    else
+    {
+        return false;
+    }
 
-    std::vector<GroupElement> fxd_p {GroupElement(0, ib),    GroupElement(1537, ib),    GroupElement(3075, ib),    GroupElement(4613, ib),    GroupElement(6151, ib),    GroupElement(7689, ib),    GroupElement(9227, ib),   GroupElement(10765, ib),   GroupElement(12303, ib),   GroupElement(13841, ib),   GroupElement(15379, ib),   GroupElement(16917, ib),   GroupElement(18455, ib),    GroupElement(32767, ib),
-    GroupElement(-18455, ib),  GroupElement(-16918, ib),  GroupElement(-15380, ib),  GroupElement(-13842, ib),  GroupElement(-12304, ib),  GroupElement(-10766, ib),   GroupElement(-9228, ib),   GroupElement(-7690, ib),   GroupElement(-6152, ib),   GroupElement(-4614, ib),   GroupElement(-3076, ib),   GroupElement(-1538, ib)
-    };
+    t.degree = degree;
+    t.scaleCoef = scaleCoef;
+    return true;
+}
 
-#elif defined(TANH_9_9)  // scale is not 12 (input scale 9, output scale 9)
-    std::vector<std::vector<GroupElement>> fxd_polynomials 
-    {
-       { GroupElement(-82639 , cb) ,   GroupElement(144710656 , cb) ,  GroupElement(         0 , cb)},
-       { GroupElement(-85271 , cb) ,   GroupElement(146579968 , cb) ,  GroupElement(-331874304, cb)},
-       { GroupElement(-25412 , cb) ,   GroupElement(61579776  , cb) ,  GroupElement(29842997248, cb)},
-       { GroupElement(-8319  , cb) ,   GroupElement(25172480  , cb) ,  GroupElement(49230118912, cb)},
-       { GroupElement(-1192  , cb) ,   GroupElement(4930048   , cb) ,  GroupElement(63602163712, cb)},
-       { GroupElement( 0    , cb)  ,   GroupElement(0     , cb) ,      flt2fxd(1, degree*sin + scoef, cb)     },
-       
-       // after x=N/2
-
-       { GroupElement( 0    , cb)  ,   GroupElement(0       , cb) ,    flt2fxd(-1, degree*sin + scoef, cb)     },
-       { GroupElement(1191  , cb)  ,   GroupElement(4930048  , cb),   GroupElement(-63602425856 , cb)},
-       { GroupElement(8318  , cb)  ,   GroupElement(25172480 , cb),   GroupElement(-49230381056 , cb)},
-       { GroupElement(25411 , cb)  ,   GroupElement(61579776 , cb),   GroupElement(-29843259392 , cb)},
-       { GroupElement(85270 , cb)  ,   GroupElement(146579968, cb),   GroupElement(331612160    , cb)},
-       { GroupElement(82638 , cb)  ,   GroupElement(144710656, cb),   GroupElement(          0  , cb)}
-       
-    };
+GroupElement evalTanh_main_wrapper(int party, GroupElement x, SplineKeyPack &k)
+{
+    return evalSigmoid(party, x, k);
+}
 
-    std::vector<GroupElement> fxd_p{GroupElement(0, ib),    GroupElement(355, ib),    GroupElement(710, ib),   GroupElement(1065, ib),   GroupElement(1420, ib),   GroupElement(1775, ib),  GroupElement(32767, ib),
-    GroupElement(-1775, ib),  GroupElement(-1420, ib),  GroupElement(-1065, ib),   GroupElement(-710, ib),   GroupElement(-355, ib)
-    };
-#elif defined(TANH_8_8)
-    std::vector<std::vector<GroupElement>> fxd_polynomials
+// Splines fitted offline in octave; false if there is none for
+// (bitlen, scaleIn, scaleOut)
+static bool invsqrtTable(int bitlen, int scaleIn, int scaleOut, SplineTable &t)
+{
+    int scaleCoef = 13, coefBitsize = 64;
+
+    int ib = 64, cb = coefBitsize, sin = scaleIn, scoef = scaleCoef;
+    int degree = 2;
+
+    if (bitlen == 16 && scaleIn == 10 && scaleOut == 9)  // when input scale = 10, output scale = 9
     {
-       {GroupElement( -87883, cb),   GroupElement( 73233920, cb),  GroupElement(      -65536, cb)},
-       {GroupElement( -74280, cb),   GroupElement( 67799296, cb),  GroupElement(   542769152, cb)},
-       {GroupElement( -15013, cb),   GroupElement( 20444928, cb),  GroupElement( 10001776640, cb)},
-       {GroupElement(  -6420, cb),   GroupElement( 10146304, cb),  GroupElement( 13087539200, cb)},
-       {GroupElement(      0, cb),   GroupElement(        0, cb),  flt2fxd(1, degree*sin + scoef, cb)}, 
-       // after x=N/2
-       {GroupElement(      0, cb),   GroupElement(        0, cb),  flt2fxd(-1, degree*sin + scoef, cb)}, 
-       {GroupElement(   6419, cb),   GroupElement( 10146304, cb),  GroupElement(-13087604736, cb)},
-       {GroupElement(  15012, cb),   GroupElement( 20444928, cb),  GroupElement(-10001842176, cb)},
-       {GroupElement(  74279, cb),   GroupElement( 67799296, cb),  GroupElement(  -542834688, cb)},
-       {GroupElement(  87882, cb),   GroupElement( 73233920, cb),  GroupElement(      -65536, cb)}
-    };
+        t.polynomials =
+        {
+            // for x=0 to fxd2flt(epsilon=0.1), technically input shouldn't fall here because we have condition x >= epsilon,
+            // but worst case, just to be safe, use same poly as first interval of octave spline
+            { GroupElement(116573, cb),  GroupElement(-99579904, cb),    GroupElement(35036069888, cb)},
+            // octave spline from epsilon to end (2^16)
+            { GroupElement(116573, cb),  GroupElement(-99579904, cb),    GroupElement(35036069888, cb)},
+            { GroupElement( 15140, cb),  GroupElement(-27114496, cb),    GroupElement(22093496320, cb)},
+            { GroupElement(  5288, cb),  GroupElement(-15048704, cb),    GroupElement(18398314496, cb)},
+            { GroupElement(   957, cb),  GroupElement( -5320704, cb),    GroupElement(12937330688, cb)},
+            { GroupElement(   190, cb),  GroupElement( -2032640, cb),    GroupElement( 9413066752, cb)},
+            { GroupElement(    34, cb),  GroupElement(  -731136, cb),    GroupElement( 6689914880, cb)},
+            { GroupElement(     6, cb),  GroupElement(  -260096, cb),    GroupElement( 4739563520, cb)},
+            { GroupElement(     1, cb),  GroupElement(   -97280, cb),    GroupElement( 3407872000, cb)},
+            // for negative x (input doesn't fall here, so use some dummy)
+            { GroupElement(0, cb),  GroupElement(0, cb),    GroupElement(0, cb)}
+        };
+
+        t.p = {/* dummy knot x=0 for consistency */  GroupElement(0, ib),   /* actual spline starts here */  GroupElement(102, ib),     GroupElement(357, ib),     GroupElement(612, ib),    GroupElement(1122, ib),    GroupElement(2143, ib),    GroupElement(4185, ib),    GroupElement(8268, ib),   GroupElement(16435, ib),   GroupElement(32767, ib)  /* actual spline ends here  */
+        };
+    }
+    else if (bitlen == 16 && scaleIn == 12 && scaleOut == 11)  // (input scale 12, output scale 11)
+    {
+        t.polynomials =
+        {
+            // for x=0 to fxd2flt(epsilon=0.1), technically input shouldn't fall here because we have condition x >= epsilon,
+            // but worst case, just to be safe, use same poly as first interval of octave spline
+            { GroupElement( 454375, cb),   GroupElement(-850591744, cb),   GroupElement(705582596096, cb)},
+            // octave spline from epsilon to end (2^16)
+            { GroupElement( 454375, cb),   GroupElement(-850591744, cb),   GroupElement(705582596096, cb)},
+            { GroupElement( 191957, cb),   GroupElement(-503250944, cb),   GroupElement(590641889280, cb)},
+            { GroupElement(  75342, cb),   GroupElement(-289939456, cb),   GroupElement(493099155456, cb)},
+            { GroupElement(  21226, cb),   GroupElement(-136224768, cb),   GroupElement(383946588160, cb)},
+            { GroupElement(   4919, cb),   GroupElement( -56926208, cb),   GroupElement(287527927808, cb)},
+            { GroupElement(   1016, cb),   GroupElement( -22155264, cb),   GroupElement(210101075968, cb)},
+            { GroupElement(    189, cb),   GroupElement(  -8101888, cb),   GroupElement(150374187008, cb)},
+            { GroupElement(     38, cb),   GroupElement(  -3104768, cb),   GroupElement(108917686272, cb)},
+            // for negative x (input doesn't fall here, so use some dummy)
+            { GroupElement(0, cb),  GroupElement(0, cb),    GroupElement(0, cb)}
+        };
+
+        t.p = {/* dummy knot x=0 for consistency */  GroupElement(0, ib),   /* actual spline starts here */   GroupElement(409, ib),     GroupElement(661, ib),     GroupElement(914, ib),    GroupElement(1420, ib),    GroupElement(2431, ib),    GroupElement(4453, ib),    GroupElement(8498, ib),   GroupElement(16588, ib),   GroupElement(32768, ib) /* actual spline ends here  */
+        };
+    }
+    else
+    {
+        return false;
+    }
+
+    t.degree = degree;
+    t.scaleCoef = scaleCoef;
+    return true;
+}
+
+GroupElement evalInvsqrt_main_wrapper(int party, GroupElement x, SplineKeyPack &k)
+{
+    return evalSigmoid(party, x, k);
+}
 
-    std::vector<GroupElement> fxd_p 
+static double splineReference(SplineFunction f, double u)
+{
+    switch (f)
     {
-        GroupElement(     0, ib),
-        GroupElement(   199, ib),
-        GroupElement(   399, ib),
-        GroupElement(   599, ib),
-        GroupElement(   799, ib),
-        GroupElement( 32767, ib),
-        // after x=N/2
-        GroupElement(  -799, ib),
-        GroupElement(  -600, ib),
-        GroupElement(  -400, ib),
-        GroupElement(  -200, ib)
-    };
-#elif defined(TANH_11_11)
-    std::vector<std::vector<GroupElement>> fxd_polynomials
+    case SplineFunction::Sigmoid:
+        return 1 / (1 + std::exp(-u));
+    case SplineFunction::Tanh:
+        return std::tanh(u);
+    default:
+        return 1 / std::sqrt(u);
+    }
+}
+
+// Greedy degree-2 fit of f on bitlen-bit inputs: each poly is least squares
+// over its interval with coefficients rounded to the ring, and the interval
+// is the longest one (by binary search on its right end) whose outputs, after
+// the arithmetic shift by shift(), all stay within ulp of round(f)
+struct SplineFit
+{
+    // intervals longer than this are fitted at this many evenly spaced points
+    static const int64_t maxPoints = 1 << 14;
+    // and the chosen ones are then checked at every point up to this length,
+    // beyond it at this many evenly spaced points and the maxPoints at each end
+    static const int64_t maxChecked = 1 << 22;
+
+    SplineFunction f;
+    int sin, sout, scoef, ulp;
+
+    int shift() const { return 2 * sin + scoef - sout; }
+
+    // f at x with a half ulp added, so that the shift (a floor) rounds
+    double target(int64_t x) const
     {
-        {GroupElement( -59861, cb), GroupElement( 557158400, cb), GroupElement(       -4194304, cb)},
-        {GroupElement(-104442, cb), GroupElement( 641546240, cb), GroupElement(   -39938162688, cb)},
-        {GroupElement( -70219, cb), GroupElement( 511983616, cb), GroupElement(    82686509056, cb)},
-        {GroupElement( -34664, cb), GroupElement( 310079488, cb), GroupElement(   369325244416, cb)},
-        {GroupElement( -14913, cb), GroupElement( 160530432, cb), GroupElement(   652403015680, cb)},
-        {GroupElement(  -6150, cb), GroupElement(  77594624, cb), GroupElement(   848637722624, cb)},
-        {GroupElement(  -2463, cb), GroupElement(  35721216, cb), GroupElement(   967529463808, cb)},
-        {GroupElement(   -985, cb), GroupElement(  16142336, cb), GroupElement(  1032385986560, cb)},
-        {GroupElement(   -399, cb), GroupElement(   7270400, cb), GroupElement(  1065973972992, cb)},
-        {GroupElement(      0, cb), GroupElement(         0, cb), flt2fxd(1, degree*sin + scoef, cb)},
-        // after x=N/2
-        {GroupElement(      0, cb), GroupElement(         0, cb), flt2fxd(-1, degree*sin + scoef, cb)},
-        {GroupElement(    398, cb), GroupElement(   7270400, cb), GroupElement( -1065978167296, cb)},
-        {GroupElement(    984, cb), GroupElement(  16142336, cb), GroupElement( -1032390180864, cb)},
-        {GroupElement(   2462, cb), GroupElement(  35721216, cb), GroupElement(  -967533658112, cb)},
-        {GroupElement(   6149, cb), GroupElement(  77594624, cb), GroupElement(  -848641916928, cb)},
-        {GroupElement(  14912, cb), GroupElement( 160530432, cb), GroupElement(  -652407209984, cb)},
-        {GroupElement(  34663, cb), GroupElement( 310079488, cb), GroupElement(  -369329438720, cb)},
-        {GroupElement(  70218, cb), GroupElement( 511983616, cb), GroupElement(   -82690703360, cb)},
-        {GroupElement( 104441, cb), GroupElement( 641546240, cb), GroupElement(    39933968384, cb)},
-        {GroupElement(  59860, cb), GroupElement( 557158400, cb), GroupElement(       -4194304, cb)},
-    };
+        return splineReference(f, std::ldexp((double)x, -sin)) * std::ldexp(1.0, sout) + 0.5;
+    }
 
-    std::vector<GroupElement> fxd_p 
+    int64_t expected(int64_t x) const
     {
-        GroupElement(    0, ib),
-        GroupElement(  946, ib),
-        GroupElement( 1892, ib),
-        GroupElement( 2839, ib),
-        GroupElement( 3785, ib),
-        GroupElement( 4732, ib),
-        GroupElement( 5678, ib),
-        GroupElement( 6625, ib),
-        GroupElement( 7571, ib),
-        GroupElement( 8518, ib),
-        GroupElement(32767, ib),
-        // after x=N/2
-        GroupElement(-8518, ib),
-        GroupElement(-7572, ib),
-        GroupElement(-6626, ib),
-        GroupElement(-5679, ib),
-        GroupElement(-4733, ib),
-        GroupElement(-3786, ib),
-        GroupElement(-2840, ib),
-        GroupElement(-1893, ib),
-        GroupElement( -947, ib)
-    };
-#elif defined(TANH_13_13)
-    std::vector<std::vector<GroupElement>> fxd_polynomials
+        return (int64_t)std::floor(target(x));
+    }
+
+    std::vector<int64_t> points(int64_t a, int64_t b) const
     {
-        {GroupElement( -37436, cb),  GroupElement(2177662976, cb), GroupElement(       -67108864, cb)},
-        {GroupElement( -90509, cb),  GroupElement(2426101760, cb), GroupElement(   -290782707712, cb)},
-        {GroupElement(-101496, cb),  GroupElement(2528968704, cb), GroupElement(   -531569311744, cb)},
-        {GroupElement( -84129, cb),  GroupElement(2285068288, cb), GroupElement(    324739792896, cb)},
-        {GroupElement( -59163, cb),  GroupElement(1817600000, cb), GroupElement(   2513025630208, cb)},
-        {GroupElement( -37872, cb),  GroupElement(1319256064, cb), GroupElement(   5429039988736, cb)},
-        {GroupElement( -22968, cb),  GroupElement( 900677632, cb), GroupElement(   8368206905344, cb)},
-        {GroupElement( -13507, cb),  GroupElement( 590635008, cb), GroupElement(  10908076081152, cb)},
-        {GroupElement(  -7805, cb),  GroupElement( 377094144, cb), GroupElement(  12907316248576, cb)},
-        {GroupElement(  -4465, cb),  GroupElement( 236412928, cb), GroupElement(  14389079965696, cb)},
-        {GroupElement(  -2540, cb),  GroupElement( 146276352, cb), GroupElement(  15443829981184, cb)},
-        {GroupElement(  -1442, cb),  GroupElement(  89726976, cb), GroupElement(  16171894046720, cb)},
-        {GroupElement(   -814, cb),  GroupElement(  54444032, cb), GroupElement(  16667358789632, cb)},
-        {GroupElement(   -470, cb),  GroupElement(  33513472, cb), GroupElement(  16985790349312, cb)},
-        // blank area b/w 2^16-1 and -2^16
-        {GroupElement(      0, cb),  GroupElement(         0, cb), GroupElement(               0, cb)},
-        {GroupElement(    469, cb),  GroupElement(  33513472, cb), GroupElement( -16985857458176, cb)},
-        {GroupElement(    813, cb),  GroupElement(  54444032, cb), GroupElement( -16667425898496, cb)},
-        {GroupElement(   1441, cb),  GroupElement(  89726976, cb), GroupElement( -16171961155584, cb)},
-        {GroupElement(   2539, cb),  GroupElement( 146276352, cb), GroupElement( -15443897090048, cb)},
-        {GroupElement(   4464, cb),  GroupElement( 236412928, cb), GroupElement( -14389147074560, cb)},
-        {GroupElement(   7804, cb),  GroupElement( 377094144, cb), GroupElement( -12907383357440, cb)},
-        {GroupElement(  13506, cb),  GroupElement( 590635008, cb), GroupElement( -10908143190016, cb)},
-        {GroupElement(  22967, cb),  GroupElement( 900677632, cb), GroupElement(  -8368274014208, cb)},
-        {GroupElement(  37871, cb),  GroupElement(1319256064, cb), GroupElement(  -5429107097600, cb)},
-        {GroupElement(  59162, cb),  GroupElement(1817600000, cb), GroupElement(  -2513092739072, cb)},
-        {GroupElement(  84128, cb),  GroupElement(2285068288, cb), GroupElement(   -324806901760, cb)},
-        {GroupElement( 101495, cb),  GroupElement(2528968704, cb), GroupElement(    531502202880, cb)},
-        {GroupElement(  90508, cb),  GroupElement(2426101760, cb), GroupElement(    290715598848, cb)},
-        {GroupElement(  37435, cb),  GroupElement(2177662976, cb), GroupElement(       -67108864, cb)},
-    };
+        std::vector<int64_t> xs;
+        if (b - a + 1 <= maxPoints)
+        {
+            for (int64_t x = a; x <= b; ++x)
+                xs.push_back(x);
+        }
+        else
+        {
+            for (int64_t j = 0; j < maxPoints; ++j)
+                xs.push_back(a + (int64_t)(((__int128)(b - a) * j) / (maxPoints - 1)));
+        }
+        return xs;
+    }
 
-    std::vector<GroupElement> fxd_p 
+    std::vector<GroupElement> constant(int64_t y) const
     {
-        GroupElement(     0, ib),
-        GroupElement(  2340, ib),
-        GroupElement(  4681, ib),
-        GroupElement(  7021, ib),
-        GroupElement(  9362, ib),
-        GroupElement( 11702, ib),
-        GroupElement( 14043, ib),
-        GroupElement( 16384, ib),
-        GroupElement( 18724, ib),
-        GroupElement( 21065, ib),
-        GroupElement( 23405, ib),
-        GroupElement( 25746, ib),
-        GroupElement( 28086, ib),
-        GroupElement( 30427, ib),
-        GroupElement( 32767, ib),
-        // blank area b/w 2^16-1 and -2^16 because ib=64 and actual inp bitlen = 16
-        GroupElement(-32768, ib),
-        GroupElement(-30428, ib),
-        GroupElement(-28087, ib),
-        GroupElement(-25747, ib),
-        GroupElement(-23406, ib),
-        GroupElement(-21066, ib),
-        GroupElement(-18725, ib),
-        GroupElement(-16384, ib),
-        GroupElement(-14044, ib),
-        GroupElement(-11703, ib),
-        GroupElement( -9363, ib),
-        GroupElement( -7022, ib),
-        GroupElement( -4682, ib),
-        GroupElement( -2341, ib)
-    };
-#else 
-    throw std::invalid_argument("no scales selected for tanh");
-#endif
+        return {GroupElement(0, 64), GroupElement(0, 64), GroupElement((uint64_t)y << shift(), 64)};
+    }
 
-    int numPoly = fxd_polynomials.size(), m = numPoly;
-    fxd_p.push_back(GroupElement(-1, ib));
+    bool check(int64_t x, const std::vector<GroupElement> &poly) const
+    {
+        uint64_t ux = (uint64_t)x;
+        uint64_t y = poly[0].value * ux * ux + poly[1].value * ux + poly[2].value;
+        int64_t out = ((int64_t)y) >> shift();
+        int64_t e = expected(x);
+        return (out <= e + ulp) && (out >= e - ulp);
+    }
 
-    return keyGenSigmoid(ib, ob, numPoly, degree, fxd_polynomials, fxd_p, rin, rout);
-}                    
+    bool check(const std::vector<int64_t> &xs, const std::vector<GroupElement> &poly) const
+    {
+        for (int64_t x : xs)
+            if (!check(x, poly))
+                return false;
+        return true;
+    }
 
-GroupElement evalTanh_main_wrapper(int party, GroupElement x, SplineKeyPack &k)
-{
-    return evalSigmoid(party, x, k);
-}
+    bool checkAll(int64_t a, int64_t b, const std::vector<GroupElement> &poly) const
+    {
+        if (b - a + 1 <= maxChecked)
+        {
+            for (int64_t x = a; x <= b; ++x)
+                if (!check(x, poly))
+                    return false;
+            return true;
+        }
+        for (int64_t j = 0; j < maxPoints; ++j)
+            if (!check(a + j, poly) || !check(b - j, poly))
+                return false;
+        for (int64_t j = 0; j < maxChecked; ++j)
+            if (!check(a + (int64_t)(((__int128)(b - a) * j) / (maxChecked - 1)), poly))
+                return false;
+        return true;
+    }
 
-std::pair<SplineKeyPack, SplineKeyPack> keyGenInvsqrt_main_wrapper(int Bin, int Bout, int scaleIn, int scaleOut,
-                    GroupElement rin, GroupElement rout)
-{
-    // todo: add other scales
-    assert((Bin == 64) && (Bout == 64));
+    // fits [a, b]; false if no rounded poly is within ulp everywhere
+    bool fit(int64_t a, int64_t b, std::vector<GroupElement> &poly) const
+    {
+        std::vector<int64_t> xs = points(a, b);
+        long double c = ((long double)a + b) / 2, h = std::max(((long double)b - a) / 2, (long double)1);
+        long double scale = std::ldexp((long double)1, shift());
 
-#ifdef INVSQRT_10_9
-    assert((scaleIn == 10) && (scaleOut == 9));
-#elif defined(INVSQRT_12_11)
-    assert((scaleIn == 12) && (scaleOut == 11));
-#else 
-    throw std::invalid_argument("no scales selected for invsqrt");
-#endif
+        // least squares for t(v) = alpha v^2 + beta v + gamma, v = (x - c) / h
+        long double A[3][4] = {};
+        for (int64_t x : xs)
+        {
+            long double v = (x - c) / h, t = target(x);
+            long double pw[3] = {v * v, v, 1};
+            for (int r = 0; r < 3; ++r)
+            {
+                for (int q = 0; q < 3; ++q)
+                    A[r][q] += pw[r] * pw[q];
+                A[r][3] += pw[r] * t;
+            }
+        }
+        long double sol[3] = {0, 0, 0};
+        for (int r = 0; r < 3; ++r)
+        {
+            int piv = r;
+            for (int q = r + 1; q < 3; ++q)
+                if (std::fabs(A[q][r]) > std::fabs(A[piv][r]))
+                    piv = q;
+            std::swap(A[r], A[piv]);
+            if (std::fabs(A[r][r]) < 1e-12L)
+                continue;
+            for (int q = 0; q < 3; ++q)
+            {
+                if (q == r)
+                    continue;
+                long double mul = A[q][r] / A[r][r];
+                for (int col = r; col < 4; ++col)
+                    A[q][col] -= mul * A[r][col];
+            }
+        }
+        for (int r = 0; r < 3; ++r)
+            if (std::fabs(A[r][r]) >= 1e-12L)
+                sol[r] = A[r][3] / A[r][r];
+
+        // round one coefficient at a time, refitting the rest on the residual
+        int64_t c0 = llroundl(sol[0] / (h * h) * scale);
+        long double sxx = 0, sx = 0, sr = 0, sxr = 0;
+        for (int64_t x : xs)
+        {
+            long double v = (x - c) / h;
+            long double r = target(x) * scale - (long double)c0 * x * x;
+            sx += v; sxx += v * v; sr += r; sxr += v * r;
+        }
+        long double n = xs.size(), den = n * sxx - sx * sx;
+        long double slope = den > 1e-12L ? (n * sxr - sx * sr) / den : 0;
+        int64_t c1 = llroundl(slope / h);
+        long double mean = 0;
+        for (int64_t x : xs)
+            mean += target(x) * scale - (long double)c0 * x * x - (long double)c1 * x;
+        int64_t c2 = llroundl(mean / n);
+
+        poly = {GroupElement((uint64_t)c0, 64), GroupElement((uint64_t)c1, 64), GroupElement((uint64_t)c2, 64)};
+        return check(xs, poly);
+    }
 
-    int scaleCoef = 13, coefBitsize = 64;
+    // fits [a, b] with as few polys as the greedy search finds, appending the
+    // right end of each to ends
+    void segment(int64_t a, int64_t b, std::vector<std::vector<GroupElement>> &polynomials, std::vector<int64_t> &ends) const
+    {
+        while (a <= b)
+        {
+            std::vector<GroupElement> poly, tmp;
+            int64_t e = b;
+            if (!fit(a, b, poly))
+            {
+                int64_t lo = a, hi = b;
+                fit(a, a, poly);
+                while (hi - lo > 1)
+                {
+                    int64_t mid = lo + (hi - lo) / 2;
+                    if (fit(a, mid, tmp))
+                    {
+                        lo = mid;
+                        poly = tmp;
+                    }
+                    else
+                        hi = mid;
+                }
+                e = lo;
+            }
+            // sampled points may have missed a bad one in between
+            while (!checkAll(a, e, poly))
+            {
+                e = a + (e - a) * 7 / 8;
+                fit(a, e, poly);
+            }
+            polynomials.push_back(poly);
+            ends.push_back(e);
+            a = e + 1;
+        }
+    }
+};
 
-    int ib = Bin, cb = coefBitsize, ob = Bout, sin = scaleIn, scoef = scaleCoef, sout = scaleOut;
-    int degree = 2;
+// first x in [lo, hi] where pred holds, for pred false then true; hi + 1 if none
+template <typename Pred>
+static int64_t firstTrue(int64_t lo, int64_t hi, Pred pred)
+{
+    int64_t ans = hi + 1;
+    while (lo <= hi)
+    {
+        int64_t mid = lo + (hi - lo) / 2;
+        if (pred(mid))
+        {
+            ans = mid;
+            hi = mid - 1;
+        }
+        else
+            lo = mid + 1;
+    }
+    return ans;
+}
 
-#if defined(INVSQRT_10_9)  // when input scale = 10, output scale = 9
+static int ceilLog2(double v)
+{
+    int l = 0;
+    while (std::ldexp(1.0, l) < v)
+        ++l;
+    return l;
+}
 
-    std::vector<std::vector<GroupElement>> fxd_polynomials
+static SplineTable fitSplineTable(SplineFunction f, int bitlen, int scaleIn, int scaleOut, int ulp)
+{
+    if (ulp < 1 || bitlen < 2 || bitlen > 63)
+        throw std::invalid_argument("cannot fit a spline for this bitlen and ulp");
+    const int64_t H = (1LL << (bitlen - 1)) - 1, lowest = -(1LL << (bitlen - 1));
+    SplineFit fit{f, scaleIn, scaleOut, 0, ulp};
+
+    // region left to the polys: saturated ends of sigmoid and tanh, epsilon =
+    // 0.1 and negatives of invsqrt
+    int64_t a, b, left = lowest - 1, right = H + 1, eps = 0;
+    int64_t limLeft = 0, limRight = 0;
+    double maxAbs = 1;
+    if (f == SplineFunction::Invsqrt)
     {
-        // for x=0 to fxd2flt(epsilon=0.1), technically input shouldn't fall here because we have condition x >= epsilon,
-        // but worst case, just to be safe, use same poly as first interval of octave spline
-        { GroupElement(116573, cb),  GroupElement(-99579904, cb),    GroupElement(35036069888, cb)},
-        // octave spline from epsilon to end (2^16)
-        { GroupElement(116573, cb),  GroupElement(-99579904, cb),    GroupElement(35036069888, cb)},
-        { GroupElement( 15140, cb),  GroupElement(-27114496, cb),    GroupElement(22093496320, cb)},
-        { GroupElement(  5288, cb),  GroupElement(-15048704, cb),    GroupElement(18398314496, cb)},
-        { GroupElement(   957, cb),  GroupElement( -5320704, cb),    GroupElement(12937330688, cb)},
-        { GroupElement(   190, cb),  GroupElement( -2032640, cb),    GroupElement( 9413066752, cb)},
-        { GroupElement(    34, cb),  GroupElement(  -731136, cb),    GroupElement( 6689914880, cb)},
-        { GroupElement(     6, cb),  GroupElement(  -260096, cb),    GroupElement( 4739563520, cb)},
-        { GroupElement(     1, cb),  GroupElement(   -97280, cb),    GroupElement( 3407872000, cb)},
-        // for negative x (input doesn't fall here, so use some dummy)
-        { GroupElement(0, cb),  GroupElement(0, cb),    GroupElement(0, cb)}
-    };
+        eps = std::max((int64_t)llround(std::ldexp(0.1, scaleIn)), (int64_t)1);
+        if (eps >= H)
+            throw std::invalid_argument("invsqrt: epsilon does not fit in bitlen");
+        a = eps + 1;
+        b = H;
+        maxAbs = splineReference(f, std::ldexp((double)eps, -scaleIn));
+    }
+    else
+    {
+        limRight = llround(std::ldexp(1.0, scaleOut));
+        limLeft = (f == SplineFunction::Sigmoid) ? 0 : -limRight;
+        // outputs are monotone, so the saturated ends are found by binary search
+        right = std::max(firstTrue(0, H, [&](int64_t x) { return fit.expected(x) >= limRight - ulp; }), (int64_t)1);
+        left = firstTrue(lowest, -1, [&](int64_t x) { return fit.expected(x) > limLeft + ulp; }) - 1;
+        a = left + 1;
+        b = right - 1;
+    }
 
-    std::vector<GroupElement> fxd_p{/* dummy knot x=0 for consistency */  GroupElement(0, ib),   /* actual spline starts here */  GroupElement(102, ib),     GroupElement(357, ib),     GroupElement(612, ib),    GroupElement(1122, ib),    GroupElement(2143, ib),    GroupElement(4185, ib),    GroupElement(8268, ib),   GroupElement(16435, ib),   GroupElement(32767, ib)  /* actual spline ends here  */
+    // coefficient scale: enough for x^2 over the fitted region, without
+    // overflowing 64 bits (plus sign) at the largest output
+    int64_t maxX = std::max(std::max((int64_t)std::llabs(a), (int64_t)std::llabs(b)), (int64_t)1);
+    int sh = std::min(2 * ceilLog2((double)maxX + 1) + 3, 61 - ceilLog2(maxAbs) - scaleOut);
+    if (sh < 0)
+        throw std::invalid_argument("spline output does not fit in 64 bits");
+    fit.scoef = sh + scaleOut - 2 * scaleIn;
+
+    SplineTable t;
+    t.degree = 2;
+    t.scaleCoef = fit.scoef;
+    auto addKnots = [&](int64_t lo, int64_t hi) {
+        std::vector<int64_t> ends;
+        fit.segment(lo, hi, t.polynomials, ends);
+        for (int64_t e : ends)
+            t.p.push_back(GroupElement((uint64_t)e, 64));
     };
 
-#elif defined(INVSQRT_12_11)  //  (input scale 12, output scale 11)
+    t.p.push_back(GroupElement(0, 64));
+    if (f == SplineFunction::Invsqrt)
+    {
+        // dummy interval [0, eps] reuses the first poly, negatives get zero
+        t.p.push_back(GroupElement(eps, 64));
+        addKnots(a, b);
+        t.polynomials.insert(t.polynomials.begin(), t.polynomials[0]);
+        t.polynomials.push_back(fit.constant(0));
+    }
+    else
+    {
+        addKnots(0, b);
+        if (right <= H)
+        {
+            t.polynomials.push_back(fit.constant(limRight));
+            t.p.push_back(GroupElement(H, 64));
+        }
+        if (left >= lowest)
+        {
+            t.polynomials.push_back(fit.constant(limLeft));
+            t.p.push_back(GroupElement((uint64_t)left, 64));
+        }
+        if (a <= -1)
+            addKnots(a, -1);
+        // -1 is added by getSplineTable
+        t.p.pop_back();
+    }
+    return t;
+}
 
-    std::vector<std::vector<GroupElement>> fxd_polynomials
+const SplineTable &getSplineTable(SplineFunction f, int bitlen, int scaleIn, int scaleOut, int ulp)
+{
+    static std::map<std::tuple<int, int, int, int, int>, SplineTable> tables;
+    static std::mutex mtx;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto key = std::make_tuple((int)f, bitlen, scaleIn, scaleOut, ulp);
+    auto it = tables.find(key);
+    if (it != tables.end())
+        return it->second;
+
+    SplineTable t;
+    bool found;
+    switch (f)
     {
-        // for x=0 to fxd2flt(epsilon=0.1), technically input shouldn't fall here because we have condition x >= epsilon,
-        // but worst case, just to be safe, use same poly as first interval of octave spline
-        { GroupElement( 454375, cb),   GroupElement(-850591744, cb),   GroupElement(705582596096, cb)},
-        // octave spline from epsilon to end (2^16)
-        { GroupElement( 454375, cb),   GroupElement(-850591744, cb),   GroupElement(705582596096, cb)},
-        { GroupElement( 191957, cb),   GroupElement(-503250944, cb),   GroupElement(590641889280, cb)},
-        { GroupElement(  75342, cb),   GroupElement(-289939456, cb),   GroupElement(493099155456, cb)},
-        { GroupElement(  21226, cb),   GroupElement(-136224768, cb),   GroupElement(383946588160, cb)},
-        { GroupElement(   4919, cb),   GroupElement( -56926208, cb),   GroupElement(287527927808, cb)},
-        { GroupElement(   1016, cb),   GroupElement( -22155264, cb),   GroupElement(210101075968, cb)},
-        { GroupElement(    189, cb),   GroupElement(  -8101888, cb),   GroupElement(150374187008, cb)},
-        { GroupElement(     38, cb),   GroupElement(  -3104768, cb),   GroupElement(108917686272, cb)},
-        // for negative x (input doesn't fall here, so use some dummy)
-        { GroupElement(0, cb),  GroupElement(0, cb),    GroupElement(0, cb)}
-    };
+    case SplineFunction::Sigmoid:
+        found = sigmoidTable(bitlen, scaleIn, scaleOut, t);
+        break;
+    case SplineFunction::Tanh:
+        found = tanhTable(bitlen, scaleIn, scaleOut, t);
+        break;
+    default:
+        found = invsqrtTable(bitlen, scaleIn, scaleOut, t);
+        break;
+    }
+    if (!found)
+        t = fitSplineTable(f, bitlen, scaleIn, scaleOut, ulp);
+    t.p.push_back(GroupElement(-1, 64));
+    return tables.emplace(key, std::move(t)).first->second;
+}
 
-    std::vector<GroupElement> fxd_p{/* dummy knot x=0 for consistency */  GroupElement(0, ib),   /* actual spline starts here */   GroupElement(409, ib),     GroupElement(661, ib),     GroupElement(914, ib),    GroupElement(1420, ib),    GroupElement(2431, ib),    GroupElement(4453, ib),    GroupElement(8498, ib),   GroupElement(16588, ib),   GroupElement(32768, ib) /* actual spline ends here  */
-    };
-  
-#else 
-    throw std::invalid_argument("no scales selected for invsqrt");
-#endif
+std::pair<SplineKeyPack, SplineKeyPack> keyGenSpline(SplineFunction f, int bitlen, int Bin, int Bout, int scaleIn, int scaleOut,
+                    GroupElement rin, GroupElement rout)
+{
+    assert((Bin == 64) && (Bout == 64));
+    const SplineTable &t = getSplineTable(f, bitlen, scaleIn, scaleOut);
+    auto keys = keyGenSigmoid(bitlen, Bin, Bout, t.polynomials.size(), t.degree, t.polynomials, t.p, rin, rout);
+    keys.first.scaleCoef = t.scaleCoef;
+    keys.second.scaleCoef = t.scaleCoef;
+    return keys;
+}
 
-    int numPoly = fxd_polynomials.size(), m = numPoly;
-    fxd_p.push_back(GroupElement(-1, ib));
+std::pair<SplineKeyPack, SplineKeyPack> keyGenSigmoid_main_wrapper(int bitlen, int Bin, int Bout, int scaleIn, int scaleOut,
+                    GroupElement rin, GroupElement rout)
+{
+    return keyGenSpline(SplineFunction::Sigmoid, bitlen, Bin, Bout, scaleIn, scaleOut, rin, rout);
+}
 
-    return keyGenSigmoid(ib, ob, numPoly, degree, fxd_polynomials, fxd_p, rin, rout);
+std::pair<SplineKeyPack, SplineKeyPack> keyGenTanh_main_wrapper(int bitlen, int Bin, int Bout, int scaleIn, int scaleOut,
+                    GroupElement rin, GroupElement rout)
+{
+    return keyGenSpline(SplineFunction::Tanh, bitlen, Bin, Bout, scaleIn, scaleOut, rin, rout);
 }
 
-GroupElement evalInvsqrt_main_wrapper(int party, GroupElement x, SplineKeyPack &k)
+std::pair<SplineKeyPack, SplineKeyPack> keyGenInvsqrt_main_wrapper(int bitlen, int Bin, int Bout, int scaleIn, int scaleOut,
+                    GroupElement rin, GroupElement rout)
 {
-    return evalSigmoid(party, x, k);
+    return keyGenSpline(SplineFunction::Invsqrt, bitlen, Bin, Bout, scaleIn, scaleOut, rin, rout);
 }
@@ -31,24 +31,45 @@ GroupElement evalRelu(int party, GroupElement x, const ReluKeyPack &k);
 std::pair<MaxpoolKeyPack, MaxpoolKeyPack> keyGenMaxpool(int Bin, int Bout, GroupElement rin1, GroupElement rin2, GroupElement rout);
 GroupElement evalMaxpool(int party, GroupElement x, GroupElement y, const MaxpoolKeyPack &k);
 
-std::pair<SplineKeyPack, SplineKeyPack> keyGenSigmoid_main_wrapper(int Bin, int Bout, int scaleIn, int scaleOut,
+enum class SplineFunction { Sigmoid, Tanh, Invsqrt };
+
+// Degree-2 spline of a function on bitlen-bit fixed-point inputs: poly i
+// covers p[i] + 1 to p[i + 1] (p[0] taken as -1) and has coefficients at
+// scale degree * scaleIn + scaleCoef
+struct SplineTable {
+    int degree;
+    int scaleCoef;
+    std::vector<std::vector<GroupElement>> polynomials;
+    std::vector<GroupElement> p;        // size: polynomials.size() + 1, ends with -1
+};
+
+// Spline of f for (bitlen, scaleIn, scaleOut): the octave tables where one
+// exists, otherwise a spline fitted on first use with the fewest polys the
+// greedy fit finds within ulp of f after the final truncation
+const SplineTable &getSplineTable(SplineFunction f, int bitlen, int scaleIn, int scaleOut, int ulp = SPLINE_ULP);
+
+std::pair<SplineKeyPack, SplineKeyPack> keyGenSpline(SplineFunction f, int bitlen, int Bin, int Bout, int scaleIn, int scaleOut,
+                    GroupElement rin, GroupElement rout);
+
+std::pair<SplineKeyPack, SplineKeyPack> keyGenSigmoid_main_wrapper(int bitlen, int Bin, int Bout, int scaleIn, int scaleOut,
                     GroupElement rin, GroupElement rout);
 
 GroupElement evalSigmoid_main_wrapper(int party, GroupElement x, SplineKeyPack &k);
 
-std::pair<SplineKeyPack, SplineKeyPack> keyGenTanh_main_wrapper(int Bin, int Bout, int scaleIn, int scaleOut,
+std::pair<SplineKeyPack, SplineKeyPack> keyGenTanh_main_wrapper(int bitlen, int Bin, int Bout, int scaleIn, int scaleOut,
                     GroupElement rin, GroupElement rout);
 
 GroupElement evalTanh_main_wrapper(int party, GroupElement x, SplineKeyPack &k);
 
 // Note: for input bitlen 12, octave spline's ulp is calculated over bitlen 6 = 12/2, but truncate-reduce is called keeping in mind output bitlen 11
 
-std::pair<SplineKeyPack, SplineKeyPack> keyGenInvsqrt_main_wrapper(int Bin, int Bout, int scaleIn, int scaleOut,
+std::pair<SplineKeyPack, SplineKeyPack> keyGenInvsqrt_main_wrapper(int bitlen, int Bin, int Bout, int scaleIn, int scaleOut,
                     GroupElement rin, GroupElement rout);
 
 GroupElement evalInvsqrt_main_wrapper(int party, GroupElement x, SplineKeyPack &k);
 
-std::pair<SplineKeyPack, SplineKeyPack> keyGenSigmoid(int Bin, int Bout, int numPoly, int degree, 
+// DCF comparisons are over the low bitlen bits of the input
+std::pair<SplineKeyPack, SplineKeyPack> keyGenSigmoid(int bitlen, int Bin, int Bout, int numPoly, int degree, 
                     std::vector<std::vector<GroupElement>> polynomials,
                     std::vector<GroupElement> p,
                     GroupElement rin, GroupElement rout);
@@ -254,13 +254,21 @@ int main(int __argc, char**__argv){'{'}
     srand(time(NULL));
     
     const u64 scale = {scale};
+    // Client queries stacked into one forward pass, see query_batch_size()
+    const u64 queries = query_batch_size();
 
     if (party == 0) {'{'}
         Net<i64> net;
         net.init(scale);
         net.load(weights_file);
-        Tensor<i64> input({'{'}{iterate_list([n]+ dims +[c])}{'}'});
+        Tensor<i64> input({'{'}queries * {iterate_list([n]+ dims +[c])}{'}'});
         input.input_nchw(scale);
+        // With EZPC_CALIBRATION=<file>, the input is also used as sample
+        // data for the range analysis, whose result goes to <file>
+        if (const char *calibration = std::getenv("EZPC_CALIBRATION")) {'{'}
+            net.calibrate(input);
+            net.saveCalibration(calibration);
+        {'}'}
         print_dot_graph(net.root);
         net.forward(input);
         print(net.activation, scale, 64);
@@ -271,8 +279,15 @@ int main(int __argc, char**__argv){'{'}
     LlamaConfig::party = party;
     LlamaConfig::stochasticT = true;
     LlamaConfig::stochasticRT = true;
+    LlamaConfig::serverKnownWeights = true;
     LlamaConfig::num_threads = nt;
     LlamaConfig::ramdisk_path = ramdisk_path;
+    // With EZPC_KEY_STREAM=<dealer ip> the dealer runs alongside the server
+    // and client and streams the keys instead of writing key files
+    if (const char *dealer_ip = std::getenv("EZPC_KEY_STREAM")) {'{'}
+        LlamaConfig::streamKeys = true;
+        LlamaConfig::dealerIp = dealer_ip;
+    {'}'}
 
     if(ramdisk_path){'{'}
     llama->init(ip, true,true);
@@ -284,6 +299,25 @@ int main(int __argc, char**__argv){'{'}
     net.init(scale);
     net.setBackend(llama);
     net.optimize();
+    // The ranges written by the cleartext run (party 0) let each ReLU and
+    // truncation run at the bitwidth its inputs need
+    if (const char *calibration = std::getenv("EZPC_CALIBRATION")) {'{'}
+        net.loadCalibration(calibration);
+    {'}'}
+    // With EZPC_CHECKPOINT=<dir>[,<interval>] the server and client checkpoint
+    // the run every <interval> layer waves (8 by default). Rerunning the two of
+    // them with the same inputs (but not the dealer, whose key files they read
+    // again) then resumes after the last checkpoint both of them hold
+    if (const char *checkpoint = std::getenv("EZPC_CHECKPOINT")) {'{'}
+        std::string dir = checkpoint;
+        u64 interval = 8;
+        auto comma = dir.find(',');
+        if (comma != std::string::npos) {'{'}
+            interval = std::stoull(dir.substr(comma + 1));
+            dir = dir.substr(0, comma);
+        {'}'}
+        net.enableCheckpoints(dir + "/" + std::to_string(party), interval);
+    {'}'}
     if(party == SERVER){'{'}
         net.load(weights_file);
     {'}'}
@@ -292,8 +326,9 @@ int main(int __argc, char**__argv){'{'}
     {'}'}
     llama->initializeInferencePartyA(net.root);
 
-    Tensor<u64> input({'{'}{iterate_list([n]+ dims +[c])}{'}'});
+    Tensor<u64> input({'{'}queries * {iterate_list([n]+ dims +[c])}{'}'});
     if(party == CLIENT){'{'}
+         // the queries are read one after the other
          input.input_nchw(scale);
     {'}'}
     llama->initializeInferencePartyB(input);
@@ -305,7 +340,7 @@ int main(int __argc, char**__argv){'{'}
     auto &output = net.activation;
     llama->outputA(output);
     if (party == CLIENT) {'{'}
-        print_nchw(output, scale, LlamaConfig::bitlength);
+        print_nchw_queries(output, queries, scale, LlamaConfig::bitlength);
     {'}'}
     llama->finalize();
 {'}'}
@@ -15,8 +15,7 @@
 
 //If Porthos compiled with Eigen support
 #ifdef USE_EIGEN
-#include <Eigen/Dense>
-using namespace Eigen;
+#include "utils/ring_gemm.h"
 #endif
 
 using namespace std;
@@ -299,7 +298,8 @@ void matrixMultEigen(porthosSecretType* a,
 }
 
 #else
-//Use Eigen MatMul
+//Use the cache-blocked ring GEMM (ring_gemm.h): Eigen's integer product is
+//not vectorized and needed the operands copied into column-major matrices.
 void matrixMultEigen(const vector<porthosSecretType> &a, 
 		const vector<porthosSecretType> &b, 
 		vector<porthosSecretType> &c, 
@@ -309,37 +309,8 @@ void matrixMultEigen(const vector<porthosSecretType> &a,
 		size_t transpose_a, 
 		size_t transpose_b)
 {
-	Matrix<porthosSecretType, Dynamic, Dynamic> eigen_a(rows, common_dim);
-	Matrix<porthosSecretType, Dynamic, Dynamic> eigen_b(common_dim, columns);
-	Matrix<porthosSecretType, Dynamic, Dynamic> eigen_c(rows, columns);
-
-	for (size_t i = 0; i < rows; ++i)
-	{
-		for (size_t j = 0; j < common_dim; ++j)
-		{
-			if (transpose_a)
-				eigen_a(i, j) = a[j*rows + i];
-			else
-				eigen_a(i, j) = a[i*common_dim + j];
-		}
-	}
-
-	for (size_t i = 0; i < common_dim; ++i)
-	{
-		for (size_t j = 0; j < columns; ++j)
-		{
-			if (transpose_b)
-				eigen_b(i, j) = b[j*common_dim + i];	
-			else
-				eigen_b(i, j) = b[i*columns + j];	
-		}
-	}
-
-	eigen_c = eigen_a * eigen_b;
-
-	for (size_t i = 0; i < rows; ++i)
-		for (size_t j = 0; j < columns; ++j)
-				c[i*columns + j] = eigen_c(i,j);
+	ring_gemm::matmul<porthosSecretType>(rows, columns, common_dim, a.data(), b.data(), c.data(), 
+		transpose_a, transpose_b);
 }
 
 
@@ -352,37 +323,21 @@ void matrixMultEigen(const vector< vector<porthosSecretType> > &a,
 		size_t transpose_a, 
 		size_t transpose_b)
 {
-	Matrix<porthosSecretType, Dynamic, Dynamic> eigen_a(rows, common_dim);
-	Matrix<porthosSecretType, Dynamic, Dynamic> eigen_b(common_dim, columns);
-	Matrix<porthosSecretType, Dynamic, Dynamic> eigen_c(rows, columns);
-
-	for (size_t i = 0; i < rows; ++i)
-	{
-		for (size_t j = 0; j < common_dim; ++j)
-		{
-			if (transpose_a)
-				eigen_a(i, j) = a[j][i];
-			else
-				eigen_a(i, j) = a[i][j];
-		}
-	}
+	size_t a_rows = transpose_a ? common_dim : rows;
+	size_t b_rows = transpose_b ? columns : common_dim;
+	size_t a_cols = (rows*common_dim)/a_rows;
+	size_t b_cols = (common_dim*columns)/b_rows;
+	vector<porthosSecretType> flat_a(rows*common_dim), flat_b(common_dim*columns), flat_c(rows*columns);
 
-	for (size_t i = 0; i < common_dim; ++i)
-	{
-		for (size_t j = 0; j < columns; ++j)
-		{
-			if (transpose_b)
-				eigen_b(i, j) = b[j][i];
-			else
-				eigen_b(i, j) = b[i][j];	
-		}
-	}
+	for (size_t i = 0; i < a_rows; ++i)
+		copy(a[i].begin(), a[i].begin() + a_cols, flat_a.begin() + i*a_cols);
+	for (size_t i = 0; i < b_rows; ++i)
+		copy(b[i].begin(), b[i].begin() + b_cols, flat_b.begin() + i*b_cols);
 
-	eigen_c = eigen_a * eigen_b;
+	matrixMultEigen(flat_a, flat_b, flat_c, rows, common_dim, columns, transpose_a, transpose_b);
 
 	for (size_t i = 0; i < rows; ++i)
-		for (size_t j = 0; j < columns; ++j)
-				c[i][j] = eigen_c(i,j);
+		copy(flat_c.begin() + i*columns, flat_c.begin() + (i+1)*columns, c[i].begin());
 }
 
 void matrixMultEigen(porthosSecretType* a, 
@@ -394,37 +349,7 @@ void matrixMultEigen(porthosSecretType* a,
 		size_t transpose_a, 
 		size_t transpose_b)
 {
-	Matrix<porthosSecretType, Dynamic, Dynamic> eigen_a(rows, common_dim);
-	Matrix<porthosSecretType, Dynamic, Dynamic> eigen_b(common_dim, columns);
-	Matrix<porthosSecretType, Dynamic, Dynamic> eigen_c(rows, columns);
-
-	for (size_t i = 0; i < rows; ++i)
-	{
-		for (size_t j = 0; j < common_dim; ++j)
-		{
-			if (transpose_a)
-				eigen_a(i, j) = Arr2DIdx(a, rows, common_dim, j, i);
-			else
-				eigen_a(i, j) = Arr2DIdx(a, rows, common_dim, i, j);
-		}
-	}
-
-	for (size_t i = 0; i < common_dim; ++i)
-	{
-		for (size_t j = 0; j < columns; ++j)
-		{
-			if (transpose_b)
-				eigen_b(i, j) = Arr2DIdx(b, common_dim, columns, j, i);
-			else
-				eigen_b(i, j) = Arr2DIdx(b, common_dim, columns, i, j);
-		}
-	}
-
-	eigen_c = eigen_a * eigen_b;
-
-	for (size_t i = 0; i < rows; ++i)
-		for (size_t j = 0; j < columns; ++j)
-				Arr2DIdx(c, rows, columns, i, j) = eigen_c(i,j);
+	ring_gemm::matmul<porthosSecretType>(rows, columns, common_dim, a, b, c, transpose_a, transpose_b);
 }
 
 #endif
@@ -2276,15 +2276,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp0
    * at (1930,1-1930,46) */
   uint64_t __tmp_in_tmp0;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)224; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)224; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)3; i3++) {
-          if ((party == CLIENT)) {
-            cin >> __tmp_in_tmp0;
+  if (!binary_input::readArray(
+          tmp0,
+          (((((int32_t)1 * (int32_t)3) * (int32_t)224) * (int32_t)224) * (int32_t)1),
+          (party == CLIENT))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)224; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)224; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)3; i3++) {
+            if ((party == CLIENT)) {
+              cin >> __tmp_in_tmp0;
+            }
+            Arr4DIdxRowM(tmp0, (int32_t)1, (int32_t)224, (int32_t)224, (int32_t)3,
+                         i0, i1, i2, i3) = (party == CLIENT) ? __tmp_in_tmp0 : 0;
           }
-          Arr4DIdxRowM(tmp0, (int32_t)1, (int32_t)224, (int32_t)224, (int32_t)3,
-                       i0, i1, i2, i3) = (party == CLIENT) ? __tmp_in_tmp0 : 0;
         }
       }
     }
@@ -2295,15 +2300,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp1
    * at (1933,1-1933,43) */
   uint64_t __tmp_in_tmp1;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)7; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)7; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)3; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp1;
+  if (!binary_input::readArray(
+          tmp1,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)3) * (int32_t)7) * (int32_t)7),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)7; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)7; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)3; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp1;
+            }
+            Arr4DIdxRowM(tmp1, (int32_t)7, (int32_t)7, (int32_t)3, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp1 : 0;
           }
-          Arr4DIdxRowM(tmp1, (int32_t)7, (int32_t)7, (int32_t)3, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp1 : 0;
         }
       }
     }
@@ -2313,88 +2323,128 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp2
    * at (1936,1-1936,34) */
   uint64_t __tmp_in_tmp2;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp2;
+  if (!binary_input::readArray(
+          tmp2,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp2;
+      }
+      Arr1DIdxRowM(tmp2, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp2 : 0;
     }
-    Arr1DIdxRowM(tmp2, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp2 : 0;
   }
 
   uint64_t *tmp3 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp3
    * at (1939,1-1939,34) */
   uint64_t __tmp_in_tmp3;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp3;
+  if (!binary_input::readArray(
+          tmp3,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp3;
+      }
+      Arr1DIdxRowM(tmp3, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp3 : 0;
     }
-    Arr1DIdxRowM(tmp3, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp3 : 0;
   }
 
   uint64_t *tmp4 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp4
    * at (1942,1-1942,34) */
   uint64_t __tmp_in_tmp4;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp4;
+  if (!binary_input::readArray(
+          tmp4,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp4;
+      }
+      Arr1DIdxRowM(tmp4, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp4 : 0;
     }
-    Arr1DIdxRowM(tmp4, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp4 : 0;
   }
 
   uint64_t *tmp5 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp5
    * at (1945,1-1945,34) */
   uint64_t __tmp_in_tmp5;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp5;
+  if (!binary_input::readArray(
+          tmp5,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp5;
+      }
+      Arr1DIdxRowM(tmp5, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp5 : 0;
     }
-    Arr1DIdxRowM(tmp5, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp5 : 0;
   }
 
   uint64_t *tmp6 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp6
    * at (1948,1-1948,34) */
   uint64_t __tmp_in_tmp6;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp6;
+  if (!binary_input::readArray(
+          tmp6,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp6;
+      }
+      Arr1DIdxRowM(tmp6, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp6 : 0;
     }
-    Arr1DIdxRowM(tmp6, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp6 : 0;
   }
 
   uint64_t *tmp7 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp7
    * at (1951,1-1951,34) */
   uint64_t __tmp_in_tmp7;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp7;
+  if (!binary_input::readArray(
+          tmp7,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp7;
+      }
+      Arr1DIdxRowM(tmp7, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp7 : 0;
     }
-    Arr1DIdxRowM(tmp7, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp7 : 0;
   }
 
   uint64_t *tmp8 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp8
    * at (1954,1-1954,34) */
   uint64_t __tmp_in_tmp8;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp8;
+  if (!binary_input::readArray(
+          tmp8,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp8;
+      }
+      Arr1DIdxRowM(tmp8, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp8 : 0;
     }
-    Arr1DIdxRowM(tmp8, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp8 : 0;
   }
 
   uint64_t *tmp9 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp9
    * at (1957,1-1957,34) */
   uint64_t __tmp_in_tmp9;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp9;
+  if (!binary_input::readArray(
+          tmp9,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp9;
+      }
+      Arr1DIdxRowM(tmp9, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp9 : 0;
     }
-    Arr1DIdxRowM(tmp9, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp9 : 0;
   }
 
   uint64_t *tmp10 =
@@ -2402,15 +2452,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp10
    * at (1960,1-1960,46) */
   uint64_t __tmp_in_tmp10;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp10;
+  if (!binary_input::readArray(
+          tmp10,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)64) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp10;
+            }
+            Arr4DIdxRowM(tmp10, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)128,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp10 : 0;
           }
-          Arr4DIdxRowM(tmp10, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)128,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp10 : 0;
         }
       }
     }
@@ -2420,48 +2475,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp11
    * at (1963,1-1963,36) */
   uint64_t __tmp_in_tmp11;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp11;
+  if (!binary_input::readArray(
+          tmp11,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp11;
+      }
+      Arr1DIdxRowM(tmp11, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp11 : 0;
     }
-    Arr1DIdxRowM(tmp11, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp11 : 0;
   }
 
   uint64_t *tmp12 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp12
    * at (1966,1-1966,36) */
   uint64_t __tmp_in_tmp12;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp12;
+  if (!binary_input::readArray(
+          tmp12,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp12;
+      }
+      Arr1DIdxRowM(tmp12, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp12 : 0;
     }
-    Arr1DIdxRowM(tmp12, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp12 : 0;
   }
 
   uint64_t *tmp13 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp13
    * at (1969,1-1969,36) */
   uint64_t __tmp_in_tmp13;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp13;
+  if (!binary_input::readArray(
+          tmp13,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp13;
+      }
+      Arr1DIdxRowM(tmp13, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp13 : 0;
     }
-    Arr1DIdxRowM(tmp13, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp13 : 0;
   }
 
   uint64_t *tmp14 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp14
    * at (1972,1-1972,36) */
   uint64_t __tmp_in_tmp14;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp14;
+  if (!binary_input::readArray(
+          tmp14,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp14;
+      }
+      Arr1DIdxRowM(tmp14, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp14 : 0;
     }
-    Arr1DIdxRowM(tmp14, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp14 : 0;
   }
 
   uint64_t *tmp15 =
@@ -2469,15 +2544,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp15
    * at (1975,1-1975,46) */
   uint64_t __tmp_in_tmp15;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp15;
+  if (!binary_input::readArray(
+          tmp15,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp15;
+            }
+            Arr4DIdxRowM(tmp15, (int32_t)3, (int32_t)3, (int32_t)128, (int32_t)32,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp15 : 0;
           }
-          Arr4DIdxRowM(tmp15, (int32_t)3, (int32_t)3, (int32_t)128, (int32_t)32,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp15 : 0;
         }
       }
     }
@@ -2487,48 +2567,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp16
    * at (1978,1-1978,35) */
   uint64_t __tmp_in_tmp16;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)96; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp16;
+  if (!binary_input::readArray(
+          tmp16,
+          ((int32_t)1 * (int32_t)96),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)96; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp16;
+      }
+      Arr1DIdxRowM(tmp16, (int32_t)96, i0) =
+          (party == SERVER) ? __tmp_in_tmp16 : 0;
     }
-    Arr1DIdxRowM(tmp16, (int32_t)96, i0) =
-        (party == SERVER) ? __tmp_in_tmp16 : 0;
   }
 
   uint64_t *tmp17 = make_array<uint64_t>((int32_t)96);
   /* Variable to read the clear value corresponding to the input variable tmp17
    * at (1981,1-1981,35) */
   uint64_t __tmp_in_tmp17;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)96; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp17;
+  if (!binary_input::readArray(
+          tmp17,
+          ((int32_t)1 * (int32_t)96),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)96; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp17;
+      }
+      Arr1DIdxRowM(tmp17, (int32_t)96, i0) =
+          (party == SERVER) ? __tmp_in_tmp17 : 0;
     }
-    Arr1DIdxRowM(tmp17, (int32_t)96, i0) =
-        (party == SERVER) ? __tmp_in_tmp17 : 0;
   }
 
   uint64_t *tmp18 = make_array<uint64_t>((int32_t)96);
   /* Variable to read the clear value corresponding to the input variable tmp18
    * at (1984,1-1984,35) */
   uint64_t __tmp_in_tmp18;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)96; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp18;
+  if (!binary_input::readArray(
+          tmp18,
+          ((int32_t)1 * (int32_t)96),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)96; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp18;
+      }
+      Arr1DIdxRowM(tmp18, (int32_t)96, i0) =
+          (party == SERVER) ? __tmp_in_tmp18 : 0;
     }
-    Arr1DIdxRowM(tmp18, (int32_t)96, i0) =
-        (party == SERVER) ? __tmp_in_tmp18 : 0;
   }
 
   uint64_t *tmp19 = make_array<uint64_t>((int32_t)96);
   /* Variable to read the clear value corresponding to the input variable tmp19
    * at (1987,1-1987,35) */
   uint64_t __tmp_in_tmp19;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)96; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp19;
+  if (!binary_input::readArray(
+          tmp19,
+          ((int32_t)1 * (int32_t)96),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)96; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp19;
+      }
+      Arr1DIdxRowM(tmp19, (int32_t)96, i0) =
+          (party == SERVER) ? __tmp_in_tmp19 : 0;
     }
-    Arr1DIdxRowM(tmp19, (int32_t)96, i0) =
-        (party == SERVER) ? __tmp_in_tmp19 : 0;
   }
 
   uint64_t *tmp20 =
@@ -2536,15 +2636,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp20
    * at (1990,1-1990,46) */
   uint64_t __tmp_in_tmp20;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)96; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp20;
+  if (!binary_input::readArray(
+          tmp20,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)96) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)96; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp20;
+            }
+            Arr4DIdxRowM(tmp20, (int32_t)1, (int32_t)1, (int32_t)96, (int32_t)128,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp20 : 0;
           }
-          Arr4DIdxRowM(tmp20, (int32_t)1, (int32_t)1, (int32_t)96, (int32_t)128,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp20 : 0;
         }
       }
     }
@@ -2554,48 +2659,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp21
    * at (1993,1-1993,36) */
   uint64_t __tmp_in_tmp21;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp21;
+  if (!binary_input::readArray(
+          tmp21,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp21;
+      }
+      Arr1DIdxRowM(tmp21, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp21 : 0;
     }
-    Arr1DIdxRowM(tmp21, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp21 : 0;
   }
 
   uint64_t *tmp22 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp22
    * at (1996,1-1996,36) */
   uint64_t __tmp_in_tmp22;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp22;
+  if (!binary_input::readArray(
+          tmp22,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp22;
+      }
+      Arr1DIdxRowM(tmp22, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp22 : 0;
     }
-    Arr1DIdxRowM(tmp22, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp22 : 0;
   }
 
   uint64_t *tmp23 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp23
    * at (1999,1-1999,36) */
   uint64_t __tmp_in_tmp23;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp23;
+  if (!binary_input::readArray(
+          tmp23,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp23;
+      }
+      Arr1DIdxRowM(tmp23, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp23 : 0;
     }
-    Arr1DIdxRowM(tmp23, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp23 : 0;
   }
 
   uint64_t *tmp24 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp24
    * at (2002,1-2002,36) */
   uint64_t __tmp_in_tmp24;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp24;
+  if (!binary_input::readArray(
+          tmp24,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp24;
+      }
+      Arr1DIdxRowM(tmp24, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp24 : 0;
     }
-    Arr1DIdxRowM(tmp24, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp24 : 0;
   }
 
   uint64_t *tmp25 =
@@ -2603,15 +2728,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp25
    * at (2005,1-2005,46) */
   uint64_t __tmp_in_tmp25;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp25;
+  if (!binary_input::readArray(
+          tmp25,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp25;
+            }
+            Arr4DIdxRowM(tmp25, (int32_t)3, (int32_t)3, (int32_t)128, (int32_t)32,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp25 : 0;
           }
-          Arr4DIdxRowM(tmp25, (int32_t)3, (int32_t)3, (int32_t)128, (int32_t)32,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp25 : 0;
         }
       }
     }
@@ -2621,48 +2751,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp26
    * at (2008,1-2008,36) */
   uint64_t __tmp_in_tmp26;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp26;
+  if (!binary_input::readArray(
+          tmp26,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp26;
+      }
+      Arr1DIdxRowM(tmp26, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp26 : 0;
     }
-    Arr1DIdxRowM(tmp26, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp26 : 0;
   }
 
   uint64_t *tmp27 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp27
    * at (2011,1-2011,36) */
   uint64_t __tmp_in_tmp27;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp27;
+  if (!binary_input::readArray(
+          tmp27,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp27;
+      }
+      Arr1DIdxRowM(tmp27, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp27 : 0;
     }
-    Arr1DIdxRowM(tmp27, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp27 : 0;
   }
 
   uint64_t *tmp28 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp28
    * at (2014,1-2014,36) */
   uint64_t __tmp_in_tmp28;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp28;
+  if (!binary_input::readArray(
+          tmp28,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp28;
+      }
+      Arr1DIdxRowM(tmp28, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp28 : 0;
     }
-    Arr1DIdxRowM(tmp28, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp28 : 0;
   }
 
   uint64_t *tmp29 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp29
    * at (2017,1-2017,36) */
   uint64_t __tmp_in_tmp29;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp29;
+  if (!binary_input::readArray(
+          tmp29,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp29;
+      }
+      Arr1DIdxRowM(tmp29, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp29 : 0;
     }
-    Arr1DIdxRowM(tmp29, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp29 : 0;
   }
 
   uint64_t *tmp30 =
@@ -2670,16 +2820,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp30
    * at (2020,1-2020,47) */
   uint64_t __tmp_in_tmp30;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp30;
+  if (!binary_input::readArray(
+          tmp30,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)128) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp30;
+            }
+            Arr4DIdxRowM(tmp30, (int32_t)1, (int32_t)1, (int32_t)128,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp30 : 0;
           }
-          Arr4DIdxRowM(tmp30, (int32_t)1, (int32_t)1, (int32_t)128,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp30 : 0;
         }
       }
     }
@@ -2689,48 +2844,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp31
    * at (2023,1-2023,36) */
   uint64_t __tmp_in_tmp31;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp31;
+  if (!binary_input::readArray(
+          tmp31,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp31;
+      }
+      Arr1DIdxRowM(tmp31, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp31 : 0;
     }
-    Arr1DIdxRowM(tmp31, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp31 : 0;
   }
 
   uint64_t *tmp32 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp32
    * at (2026,1-2026,36) */
   uint64_t __tmp_in_tmp32;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp32;
+  if (!binary_input::readArray(
+          tmp32,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp32;
+      }
+      Arr1DIdxRowM(tmp32, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp32 : 0;
     }
-    Arr1DIdxRowM(tmp32, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp32 : 0;
   }
 
   uint64_t *tmp33 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp33
    * at (2029,1-2029,36) */
   uint64_t __tmp_in_tmp33;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp33;
+  if (!binary_input::readArray(
+          tmp33,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp33;
+      }
+      Arr1DIdxRowM(tmp33, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp33 : 0;
     }
-    Arr1DIdxRowM(tmp33, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp33 : 0;
   }
 
   uint64_t *tmp34 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp34
    * at (2032,1-2032,36) */
   uint64_t __tmp_in_tmp34;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp34;
+  if (!binary_input::readArray(
+          tmp34,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp34;
+      }
+      Arr1DIdxRowM(tmp34, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp34 : 0;
     }
-    Arr1DIdxRowM(tmp34, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp34 : 0;
   }
 
   uint64_t *tmp35 =
@@ -2738,15 +2913,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp35
    * at (2035,1-2035,46) */
   uint64_t __tmp_in_tmp35;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp35;
+  if (!binary_input::readArray(
+          tmp35,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp35;
+            }
+            Arr4DIdxRowM(tmp35, (int32_t)3, (int32_t)3, (int32_t)128, (int32_t)32,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp35 : 0;
           }
-          Arr4DIdxRowM(tmp35, (int32_t)3, (int32_t)3, (int32_t)128, (int32_t)32,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp35 : 0;
         }
       }
     }
@@ -2756,48 +2936,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp36
    * at (2038,1-2038,36) */
   uint64_t __tmp_in_tmp36;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)160; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp36;
+  if (!binary_input::readArray(
+          tmp36,
+          ((int32_t)1 * (int32_t)160),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)160; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp36;
+      }
+      Arr1DIdxRowM(tmp36, (int32_t)160, i0) =
+          (party == SERVER) ? __tmp_in_tmp36 : 0;
     }
-    Arr1DIdxRowM(tmp36, (int32_t)160, i0) =
-        (party == SERVER) ? __tmp_in_tmp36 : 0;
   }
 
   uint64_t *tmp37 = make_array<uint64_t>((int32_t)160);
   /* Variable to read the clear value corresponding to the input variable tmp37
    * at (2041,1-2041,36) */
   uint64_t __tmp_in_tmp37;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)160; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp37;
+  if (!binary_input::readArray(
+          tmp37,
+          ((int32_t)1 * (int32_t)160),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)160; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp37;
+      }
+      Arr1DIdxRowM(tmp37, (int32_t)160, i0) =
+          (party == SERVER) ? __tmp_in_tmp37 : 0;
     }
-    Arr1DIdxRowM(tmp37, (int32_t)160, i0) =
-        (party == SERVER) ? __tmp_in_tmp37 : 0;
   }
 
   uint64_t *tmp38 = make_array<uint64_t>((int32_t)160);
   /* Variable to read the clear value corresponding to the input variable tmp38
    * at (2044,1-2044,36) */
   uint64_t __tmp_in_tmp38;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)160; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp38;
+  if (!binary_input::readArray(
+          tmp38,
+          ((int32_t)1 * (int32_t)160),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)160; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp38;
+      }
+      Arr1DIdxRowM(tmp38, (int32_t)160, i0) =
+          (party == SERVER) ? __tmp_in_tmp38 : 0;
     }
-    Arr1DIdxRowM(tmp38, (int32_t)160, i0) =
-        (party == SERVER) ? __tmp_in_tmp38 : 0;
   }
 
   uint64_t *tmp39 = make_array<uint64_t>((int32_t)160);
   /* Variable to read the clear value corresponding to the input variable tmp39
    * at (2047,1-2047,36) */
   uint64_t __tmp_in_tmp39;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)160; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp39;
+  if (!binary_input::readArray(
+          tmp39,
+          ((int32_t)1 * (int32_t)160),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)160; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp39;
+      }
+      Arr1DIdxRowM(tmp39, (int32_t)160, i0) =
+          (party == SERVER) ? __tmp_in_tmp39 : 0;
     }
-    Arr1DIdxRowM(tmp39, (int32_t)160, i0) =
-        (party == SERVER) ? __tmp_in_tmp39 : 0;
   }
 
   uint64_t *tmp40 =
@@ -2805,16 +3005,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp40
    * at (2050,1-2050,47) */
   uint64_t __tmp_in_tmp40;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)160; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp40;
+  if (!binary_input::readArray(
+          tmp40,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)160) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)160; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp40;
+            }
+            Arr4DIdxRowM(tmp40, (int32_t)1, (int32_t)1, (int32_t)160,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp40 : 0;
           }
-          Arr4DIdxRowM(tmp40, (int32_t)1, (int32_t)1, (int32_t)160,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp40 : 0;
         }
       }
     }
@@ -2824,48 +3029,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp41
    * at (2053,1-2053,36) */
   uint64_t __tmp_in_tmp41;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp41;
+  if (!binary_input::readArray(
+          tmp41,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp41;
+      }
+      Arr1DIdxRowM(tmp41, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp41 : 0;
     }
-    Arr1DIdxRowM(tmp41, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp41 : 0;
   }
 
   uint64_t *tmp42 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp42
    * at (2056,1-2056,36) */
   uint64_t __tmp_in_tmp42;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp42;
+  if (!binary_input::readArray(
+          tmp42,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp42;
+      }
+      Arr1DIdxRowM(tmp42, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp42 : 0;
     }
-    Arr1DIdxRowM(tmp42, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp42 : 0;
   }
 
   uint64_t *tmp43 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp43
    * at (2059,1-2059,36) */
   uint64_t __tmp_in_tmp43;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp43;
+  if (!binary_input::readArray(
+          tmp43,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp43;
+      }
+      Arr1DIdxRowM(tmp43, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp43 : 0;
     }
-    Arr1DIdxRowM(tmp43, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp43 : 0;
   }
 
   uint64_t *tmp44 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp44
    * at (2062,1-2062,36) */
   uint64_t __tmp_in_tmp44;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp44;
+  if (!binary_input::readArray(
+          tmp44,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp44;
+      }
+      Arr1DIdxRowM(tmp44, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp44 : 0;
     }
-    Arr1DIdxRowM(tmp44, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp44 : 0;
   }
 
   uint64_t *tmp45 =
@@ -2873,15 +3098,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp45
    * at (2065,1-2065,46) */
   uint64_t __tmp_in_tmp45;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp45;
+  if (!binary_input::readArray(
+          tmp45,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp45;
+            }
+            Arr4DIdxRowM(tmp45, (int32_t)3, (int32_t)3, (int32_t)128, (int32_t)32,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp45 : 0;
           }
-          Arr4DIdxRowM(tmp45, (int32_t)3, (int32_t)3, (int32_t)128, (int32_t)32,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp45 : 0;
         }
       }
     }
@@ -2891,48 +3121,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp46
    * at (2068,1-2068,36) */
   uint64_t __tmp_in_tmp46;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp46;
+  if (!binary_input::readArray(
+          tmp46,
+          ((int32_t)1 * (int32_t)192),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp46;
+      }
+      Arr1DIdxRowM(tmp46, (int32_t)192, i0) =
+          (party == SERVER) ? __tmp_in_tmp46 : 0;
     }
-    Arr1DIdxRowM(tmp46, (int32_t)192, i0) =
-        (party == SERVER) ? __tmp_in_tmp46 : 0;
   }
 
   uint64_t *tmp47 = make_array<uint64_t>((int32_t)192);
   /* Variable to read the clear value corresponding to the input variable tmp47
    * at (2071,1-2071,36) */
   uint64_t __tmp_in_tmp47;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp47;
+  if (!binary_input::readArray(
+          tmp47,
+          ((int32_t)1 * (int32_t)192),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp47;
+      }
+      Arr1DIdxRowM(tmp47, (int32_t)192, i0) =
+          (party == SERVER) ? __tmp_in_tmp47 : 0;
     }
-    Arr1DIdxRowM(tmp47, (int32_t)192, i0) =
-        (party == SERVER) ? __tmp_in_tmp47 : 0;
   }
 
   uint64_t *tmp48 = make_array<uint64_t>((int32_t)192);
   /* Variable to read the clear value corresponding to the input variable tmp48
    * at (2074,1-2074,36) */
   uint64_t __tmp_in_tmp48;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp48;
+  if (!binary_input::readArray(
+          tmp48,
+          ((int32_t)1 * (int32_t)192),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp48;
+      }
+      Arr1DIdxRowM(tmp48, (int32_t)192, i0) =
+          (party == SERVER) ? __tmp_in_tmp48 : 0;
     }
-    Arr1DIdxRowM(tmp48, (int32_t)192, i0) =
-        (party == SERVER) ? __tmp_in_tmp48 : 0;
   }
 
   uint64_t *tmp49 = make_array<uint64_t>((int32_t)192);
   /* Variable to read the clear value corresponding to the input variable tmp49
    * at (2077,1-2077,36) */
   uint64_t __tmp_in_tmp49;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp49;
+  if (!binary_input::readArray(
+          tmp49,
+          ((int32_t)1 * (int32_t)192),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp49;
+      }
+      Arr1DIdxRowM(tmp49, (int32_t)192, i0) =
+          (party == SERVER) ? __tmp_in_tmp49 : 0;
     }
-    Arr1DIdxRowM(tmp49, (int32_t)192, i0) =
-        (party == SERVER) ? __tmp_in_tmp49 : 0;
   }
 
   uint64_t *tmp50 =
@@ -2940,16 +3190,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp50
    * at (2080,1-2080,47) */
   uint64_t __tmp_in_tmp50;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)192; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp50;
+  if (!binary_input::readArray(
+          tmp50,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)192) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)192; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp50;
+            }
+            Arr4DIdxRowM(tmp50, (int32_t)1, (int32_t)1, (int32_t)192,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp50 : 0;
           }
-          Arr4DIdxRowM(tmp50, (int32_t)1, (int32_t)1, (int32_t)192,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp50 : 0;
         }
       }
     }
@@ -2959,48 +3214,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp51
    * at (2083,1-2083,36) */
   uint64_t __tmp_in_tmp51;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp51;
+  if (!binary_input::readArray(
+          tmp51,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp51;
+      }
+      Arr1DIdxRowM(tmp51, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp51 : 0;
     }
-    Arr1DIdxRowM(tmp51, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp51 : 0;
   }
 
   uint64_t *tmp52 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp52
    * at (2086,1-2086,36) */
   uint64_t __tmp_in_tmp52;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp52;
+  if (!binary_input::readArray(
+          tmp52,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp52;
+      }
+      Arr1DIdxRowM(tmp52, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp52 : 0;
     }
-    Arr1DIdxRowM(tmp52, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp52 : 0;
   }
 
   uint64_t *tmp53 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp53
    * at (2089,1-2089,36) */
   uint64_t __tmp_in_tmp53;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp53;
+  if (!binary_input::readArray(
+          tmp53,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp53;
+      }
+      Arr1DIdxRowM(tmp53, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp53 : 0;
     }
-    Arr1DIdxRowM(tmp53, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp53 : 0;
   }
 
   uint64_t *tmp54 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp54
    * at (2092,1-2092,36) */
   uint64_t __tmp_in_tmp54;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp54;
+  if (!binary_input::readArray(
+          tmp54,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp54;
+      }
+      Arr1DIdxRowM(tmp54, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp54 : 0;
     }
-    Arr1DIdxRowM(tmp54, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp54 : 0;
   }
 
   uint64_t *tmp55 =
@@ -3008,15 +3283,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp55
    * at (2095,1-2095,46) */
   uint64_t __tmp_in_tmp55;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp55;
+  if (!binary_input::readArray(
+          tmp55,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp55;
+            }
+            Arr4DIdxRowM(tmp55, (int32_t)3, (int32_t)3, (int32_t)128, (int32_t)32,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp55 : 0;
           }
-          Arr4DIdxRowM(tmp55, (int32_t)3, (int32_t)3, (int32_t)128, (int32_t)32,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp55 : 0;
         }
       }
     }
@@ -3026,48 +3306,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp56
    * at (2098,1-2098,36) */
   uint64_t __tmp_in_tmp56;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)224; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp56;
+  if (!binary_input::readArray(
+          tmp56,
+          ((int32_t)1 * (int32_t)224),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)224; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp56;
+      }
+      Arr1DIdxRowM(tmp56, (int32_t)224, i0) =
+          (party == SERVER) ? __tmp_in_tmp56 : 0;
     }
-    Arr1DIdxRowM(tmp56, (int32_t)224, i0) =
-        (party == SERVER) ? __tmp_in_tmp56 : 0;
   }
 
   uint64_t *tmp57 = make_array<uint64_t>((int32_t)224);
   /* Variable to read the clear value corresponding to the input variable tmp57
    * at (2101,1-2101,36) */
   uint64_t __tmp_in_tmp57;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)224; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp57;
+  if (!binary_input::readArray(
+          tmp57,
+          ((int32_t)1 * (int32_t)224),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)224; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp57;
+      }
+      Arr1DIdxRowM(tmp57, (int32_t)224, i0) =
+          (party == SERVER) ? __tmp_in_tmp57 : 0;
     }
-    Arr1DIdxRowM(tmp57, (int32_t)224, i0) =
-        (party == SERVER) ? __tmp_in_tmp57 : 0;
   }
 
   uint64_t *tmp58 = make_array<uint64_t>((int32_t)224);
   /* Variable to read the clear value corresponding to the input variable tmp58
    * at (2104,1-2104,36) */
   uint64_t __tmp_in_tmp58;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)224; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp58;
+  if (!binary_input::readArray(
+          tmp58,
+          ((int32_t)1 * (int32_t)224),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)224; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp58;
+      }
+      Arr1DIdxRowM(tmp58, (int32_t)224, i0) =
+          (party == SERVER) ? __tmp_in_tmp58 : 0;
     }
-    Arr1DIdxRowM(tmp58, (int32_t)224, i0) =
-        (party == SERVER) ? __tmp_in_tmp58 : 0;
   }
 
   uint64_t *tmp59 = make_array<uint64_t>((int32_t)224);
   /* Variable to read the clear value corresponding to the input variable tmp59
    * at (2107,1-2107,36) */
   uint64_t __tmp_in_tmp59;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)224; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp59;
+  if (!binary_input::readArray(
+          tmp59,
+          ((int32_t)1 * (int32_t)224),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)224; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp59;
+      }
+      Arr1DIdxRowM(tmp59, (int32_t)224, i0) =
+          (party == SERVER) ? __tmp_in_tmp59 : 0;
     }
-    Arr1DIdxRowM(tmp59, (int32_t)224, i0) =
-        (party == SERVER) ? __tmp_in_tmp59 : 0;
   }
 
   uint64_t *tmp60 =
@@ -3075,16 +3375,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp60
    * at (2110,1-2110,47) */
   uint64_t __tmp_in_tmp60;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)224; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp60;
+  if (!binary_input::readArray(
+          tmp60,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)224) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)224; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp60;
+            }
+            Arr4DIdxRowM(tmp60, (int32_t)1, (int32_t)1, (int32_t)224,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp60 : 0;
           }
-          Arr4DIdxRowM(tmp60, (int32_t)1, (int32_t)1, (int32_t)224,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp60 : 0;
         }
       }
     }
@@ -3094,48 +3399,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp61
    * at (2113,1-2113,36) */
   uint64_t __tmp_in_tmp61;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp61;
+  if (!binary_input::readArray(
+          tmp61,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp61;
+      }
+      Arr1DIdxRowM(tmp61, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp61 : 0;
     }
-    Arr1DIdxRowM(tmp61, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp61 : 0;
   }
 
   uint64_t *tmp62 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp62
    * at (2116,1-2116,36) */
   uint64_t __tmp_in_tmp62;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp62;
+  if (!binary_input::readArray(
+          tmp62,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp62;
+      }
+      Arr1DIdxRowM(tmp62, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp62 : 0;
     }
-    Arr1DIdxRowM(tmp62, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp62 : 0;
   }
 
   uint64_t *tmp63 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp63
    * at (2119,1-2119,36) */
   uint64_t __tmp_in_tmp63;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp63;
+  if (!binary_input::readArray(
+          tmp63,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp63;
+      }
+      Arr1DIdxRowM(tmp63, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp63 : 0;
     }
-    Arr1DIdxRowM(tmp63, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp63 : 0;
   }
 
   uint64_t *tmp64 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp64
    * at (2122,1-2122,36) */
   uint64_t __tmp_in_tmp64;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp64;
+  if (!binary_input::readArray(
+          tmp64,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp64;
+      }
+      Arr1DIdxRowM(tmp64, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp64 : 0;
     }
-    Arr1DIdxRowM(tmp64, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp64 : 0;
   }
 
   uint64_t *tmp65 =
@@ -3143,15 +3468,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp65
    * at (2125,1-2125,46) */
   uint64_t __tmp_in_tmp65;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp65;
+  if (!binary_input::readArray(
+          tmp65,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp65;
+            }
+            Arr4DIdxRowM(tmp65, (int32_t)3, (int32_t)3, (int32_t)128, (int32_t)32,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp65 : 0;
           }
-          Arr4DIdxRowM(tmp65, (int32_t)3, (int32_t)3, (int32_t)128, (int32_t)32,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp65 : 0;
         }
       }
     }
@@ -3161,48 +3491,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp66
    * at (2128,1-2128,36) */
   uint64_t __tmp_in_tmp66;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp66;
+  if (!binary_input::readArray(
+          tmp66,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp66;
+      }
+      Arr1DIdxRowM(tmp66, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp66 : 0;
     }
-    Arr1DIdxRowM(tmp66, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp66 : 0;
   }
 
   uint64_t *tmp67 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp67
    * at (2131,1-2131,36) */
   uint64_t __tmp_in_tmp67;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp67;
+  if (!binary_input::readArray(
+          tmp67,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp67;
+      }
+      Arr1DIdxRowM(tmp67, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp67 : 0;
     }
-    Arr1DIdxRowM(tmp67, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp67 : 0;
   }
 
   uint64_t *tmp68 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp68
    * at (2134,1-2134,36) */
   uint64_t __tmp_in_tmp68;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp68;
+  if (!binary_input::readArray(
+          tmp68,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp68;
+      }
+      Arr1DIdxRowM(tmp68, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp68 : 0;
     }
-    Arr1DIdxRowM(tmp68, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp68 : 0;
   }
 
   uint64_t *tmp69 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp69
    * at (2137,1-2137,36) */
   uint64_t __tmp_in_tmp69;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp69;
+  if (!binary_input::readArray(
+          tmp69,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp69;
+      }
+      Arr1DIdxRowM(tmp69, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp69 : 0;
     }
-    Arr1DIdxRowM(tmp69, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp69 : 0;
   }
 
   uint64_t *tmp70 =
@@ -3210,16 +3560,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp70
    * at (2140,1-2140,47) */
   uint64_t __tmp_in_tmp70;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp70;
+  if (!binary_input::readArray(
+          tmp70,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)256) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp70;
+            }
+            Arr4DIdxRowM(tmp70, (int32_t)1, (int32_t)1, (int32_t)256,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp70 : 0;
           }
-          Arr4DIdxRowM(tmp70, (int32_t)1, (int32_t)1, (int32_t)256,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp70 : 0;
         }
       }
     }
@@ -3229,48 +3584,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp71
    * at (2143,1-2143,36) */
   uint64_t __tmp_in_tmp71;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp71;
+  if (!binary_input::readArray(
+          tmp71,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp71;
+      }
+      Arr1DIdxRowM(tmp71, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp71 : 0;
     }
-    Arr1DIdxRowM(tmp71, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp71 : 0;
   }
 
   uint64_t *tmp72 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp72
    * at (2146,1-2146,36) */
   uint64_t __tmp_in_tmp72;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp72;
+  if (!binary_input::readArray(
+          tmp72,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp72;
+      }
+      Arr1DIdxRowM(tmp72, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp72 : 0;
     }
-    Arr1DIdxRowM(tmp72, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp72 : 0;
   }
 
   uint64_t *tmp73 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp73
    * at (2149,1-2149,36) */
   uint64_t __tmp_in_tmp73;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp73;
+  if (!binary_input::readArray(
+          tmp73,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp73;
+      }
+      Arr1DIdxRowM(tmp73, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp73 : 0;
     }
-    Arr1DIdxRowM(tmp73, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp73 : 0;
   }
 
   uint64_t *tmp74 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp74
    * at (2152,1-2152,36) */
   uint64_t __tmp_in_tmp74;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp74;
+  if (!binary_input::readArray(
+          tmp74,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp74;
+      }
+      Arr1DIdxRowM(tmp74, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp74 : 0;
     }
-    Arr1DIdxRowM(tmp74, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp74 : 0;
   }
 
   uint64_t *tmp75 =
@@ -3278,16 +3653,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp75
    * at (2155,1-2155,47) */
   uint64_t __tmp_in_tmp75;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp75;
+  if (!binary_input::readArray(
+          tmp75,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)128) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp75;
+            }
+            Arr4DIdxRowM(tmp75, (int32_t)1, (int32_t)1, (int32_t)128,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp75 : 0;
           }
-          Arr4DIdxRowM(tmp75, (int32_t)1, (int32_t)1, (int32_t)128,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp75 : 0;
         }
       }
     }
@@ -3297,48 +3677,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp76
    * at (2158,1-2158,36) */
   uint64_t __tmp_in_tmp76;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp76;
+  if (!binary_input::readArray(
+          tmp76,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp76;
+      }
+      Arr1DIdxRowM(tmp76, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp76 : 0;
     }
-    Arr1DIdxRowM(tmp76, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp76 : 0;
   }
 
   uint64_t *tmp77 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp77
    * at (2161,1-2161,36) */
   uint64_t __tmp_in_tmp77;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp77;
+  if (!binary_input::readArray(
+          tmp77,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp77;
+      }
+      Arr1DIdxRowM(tmp77, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp77 : 0;
     }
-    Arr1DIdxRowM(tmp77, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp77 : 0;
   }
 
   uint64_t *tmp78 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp78
    * at (2164,1-2164,36) */
   uint64_t __tmp_in_tmp78;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp78;
+  if (!binary_input::readArray(
+          tmp78,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp78;
+      }
+      Arr1DIdxRowM(tmp78, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp78 : 0;
     }
-    Arr1DIdxRowM(tmp78, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp78 : 0;
   }
 
   uint64_t *tmp79 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp79
    * at (2167,1-2167,36) */
   uint64_t __tmp_in_tmp79;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp79;
+  if (!binary_input::readArray(
+          tmp79,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp79;
+      }
+      Arr1DIdxRowM(tmp79, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp79 : 0;
     }
-    Arr1DIdxRowM(tmp79, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp79 : 0;
   }
 
   uint64_t *tmp80 =
@@ -3346,15 +3746,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp80
    * at (2170,1-2170,46) */
   uint64_t __tmp_in_tmp80;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp80;
+  if (!binary_input::readArray(
+          tmp80,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp80;
+            }
+            Arr4DIdxRowM(tmp80, (int32_t)3, (int32_t)3, (int32_t)128, (int32_t)32,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp80 : 0;
           }
-          Arr4DIdxRowM(tmp80, (int32_t)3, (int32_t)3, (int32_t)128, (int32_t)32,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp80 : 0;
         }
       }
     }
@@ -3364,48 +3769,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp81
    * at (2173,1-2173,36) */
   uint64_t __tmp_in_tmp81;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)160; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp81;
+  if (!binary_input::readArray(
+          tmp81,
+          ((int32_t)1 * (int32_t)160),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)160; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp81;
+      }
+      Arr1DIdxRowM(tmp81, (int32_t)160, i0) =
+          (party == SERVER) ? __tmp_in_tmp81 : 0;
     }
-    Arr1DIdxRowM(tmp81, (int32_t)160, i0) =
-        (party == SERVER) ? __tmp_in_tmp81 : 0;
   }
 
   uint64_t *tmp82 = make_array<uint64_t>((int32_t)160);
   /* Variable to read the clear value corresponding to the input variable tmp82
    * at (2176,1-2176,36) */
   uint64_t __tmp_in_tmp82;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)160; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp82;
+  if (!binary_input::readArray(
+          tmp82,
+          ((int32_t)1 * (int32_t)160),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)160; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp82;
+      }
+      Arr1DIdxRowM(tmp82, (int32_t)160, i0) =
+          (party == SERVER) ? __tmp_in_tmp82 : 0;
     }
-    Arr1DIdxRowM(tmp82, (int32_t)160, i0) =
-        (party == SERVER) ? __tmp_in_tmp82 : 0;
   }
 
   uint64_t *tmp83 = make_array<uint64_t>((int32_t)160);
   /* Variable to read the clear value corresponding to the input variable tmp83
    * at (2179,1-2179,36) */
   uint64_t __tmp_in_tmp83;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)160; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp83;
+  if (!binary_input::readArray(
+          tmp83,
+          ((int32_t)1 * (int32_t)160),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)160; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp83;
+      }
+      Arr1DIdxRowM(tmp83, (int32_t)160, i0) =
+          (party == SERVER) ? __tmp_in_tmp83 : 0;
     }
-    Arr1DIdxRowM(tmp83, (int32_t)160, i0) =
-        (party == SERVER) ? __tmp_in_tmp83 : 0;
   }
 
   uint64_t *tmp84 = make_array<uint64_t>((int32_t)160);
   /* Variable to read the clear value corresponding to the input variable tmp84
    * at (2182,1-2182,36) */
   uint64_t __tmp_in_tmp84;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)160; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp84;
+  if (!binary_input::readArray(
+          tmp84,
+          ((int32_t)1 * (int32_t)160),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)160; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp84;
+      }
+      Arr1DIdxRowM(tmp84, (int32_t)160, i0) =
+          (party == SERVER) ? __tmp_in_tmp84 : 0;
     }
-    Arr1DIdxRowM(tmp84, (int32_t)160, i0) =
-        (party == SERVER) ? __tmp_in_tmp84 : 0;
   }
 
   uint64_t *tmp85 =
@@ -3413,16 +3838,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp85
    * at (2185,1-2185,47) */
   uint64_t __tmp_in_tmp85;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)160; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp85;
+  if (!binary_input::readArray(
+          tmp85,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)160) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)160; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp85;
+            }
+            Arr4DIdxRowM(tmp85, (int32_t)1, (int32_t)1, (int32_t)160,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp85 : 0;
           }
-          Arr4DIdxRowM(tmp85, (int32_t)1, (int32_t)1, (int32_t)160,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp85 : 0;
         }
       }
     }
@@ -3432,48 +3862,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp86
    * at (2188,1-2188,36) */
   uint64_t __tmp_in_tmp86;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp86;
+  if (!binary_input::readArray(
+          tmp86,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp86;
+      }
+      Arr1DIdxRowM(tmp86, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp86 : 0;
     }
-    Arr1DIdxRowM(tmp86, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp86 : 0;
   }
 
   uint64_t *tmp87 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp87
    * at (2191,1-2191,36) */
   uint64_t __tmp_in_tmp87;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp87;
+  if (!binary_input::readArray(
+          tmp87,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp87;
+      }
+      Arr1DIdxRowM(tmp87, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp87 : 0;
     }
-    Arr1DIdxRowM(tmp87, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp87 : 0;
   }
 
   uint64_t *tmp88 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp88
    * at (2194,1-2194,36) */
   uint64_t __tmp_in_tmp88;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp88;
+  if (!binary_input::readArray(
+          tmp88,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp88;
+      }
+      Arr1DIdxRowM(tmp88, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp88 : 0;
     }
-    Arr1DIdxRowM(tmp88, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp88 : 0;
   }
 
   uint64_t *tmp89 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp89
    * at (2197,1-2197,36) */
   uint64_t __tmp_in_tmp89;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp89;
+  if (!binary_input::readArray(
+          tmp89,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp89;
+      }
+      Arr1DIdxRowM(tmp89, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp89 : 0;
     }
-    Arr1DIdxRowM(tmp89, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp89 : 0;
   }
 
   uint64_t *tmp90 =
@@ -3481,15 +3931,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp90
    * at (2200,1-2200,46) */
   uint64_t __tmp_in_tmp90;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp90;
+  if (!binary_input::readArray(
+          tmp90,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp90;
+            }
+            Arr4DIdxRowM(tmp90, (int32_t)3, (int32_t)3, (int32_t)128, (int32_t)32,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp90 : 0;
           }
-          Arr4DIdxRowM(tmp90, (int32_t)3, (int32_t)3, (int32_t)128, (int32_t)32,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp90 : 0;
         }
       }
     }
@@ -3499,48 +3954,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp91
    * at (2203,1-2203,36) */
   uint64_t __tmp_in_tmp91;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp91;
+  if (!binary_input::readArray(
+          tmp91,
+          ((int32_t)1 * (int32_t)192),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp91;
+      }
+      Arr1DIdxRowM(tmp91, (int32_t)192, i0) =
+          (party == SERVER) ? __tmp_in_tmp91 : 0;
     }
-    Arr1DIdxRowM(tmp91, (int32_t)192, i0) =
-        (party == SERVER) ? __tmp_in_tmp91 : 0;
   }
 
   uint64_t *tmp92 = make_array<uint64_t>((int32_t)192);
   /* Variable to read the clear value corresponding to the input variable tmp92
    * at (2206,1-2206,36) */
   uint64_t __tmp_in_tmp92;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp92;
+  if (!binary_input::readArray(
+          tmp92,
+          ((int32_t)1 * (int32_t)192),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp92;
+      }
+      Arr1DIdxRowM(tmp92, (int32_t)192, i0) =
+          (party == SERVER) ? __tmp_in_tmp92 : 0;
     }
-    Arr1DIdxRowM(tmp92, (int32_t)192, i0) =
-        (party == SERVER) ? __tmp_in_tmp92 : 0;
   }
 
   uint64_t *tmp93 = make_array<uint64_t>((int32_t)192);
   /* Variable to read the clear value corresponding to the input variable tmp93
    * at (2209,1-2209,36) */
   uint64_t __tmp_in_tmp93;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp93;
+  if (!binary_input::readArray(
+          tmp93,
+          ((int32_t)1 * (int32_t)192),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp93;
+      }
+      Arr1DIdxRowM(tmp93, (int32_t)192, i0) =
+          (party == SERVER) ? __tmp_in_tmp93 : 0;
     }
-    Arr1DIdxRowM(tmp93, (int32_t)192, i0) =
-        (party == SERVER) ? __tmp_in_tmp93 : 0;
   }
 
   uint64_t *tmp94 = make_array<uint64_t>((int32_t)192);
   /* Variable to read the clear value corresponding to the input variable tmp94
    * at (2212,1-2212,36) */
   uint64_t __tmp_in_tmp94;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp94;
+  if (!binary_input::readArray(
+          tmp94,
+          ((int32_t)1 * (int32_t)192),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp94;
+      }
+      Arr1DIdxRowM(tmp94, (int32_t)192, i0) =
+          (party == SERVER) ? __tmp_in_tmp94 : 0;
     }
-    Arr1DIdxRowM(tmp94, (int32_t)192, i0) =
-        (party == SERVER) ? __tmp_in_tmp94 : 0;
   }
 
   uint64_t *tmp95 =
@@ -3548,16 +4023,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp95
    * at (2215,1-2215,47) */
   uint64_t __tmp_in_tmp95;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)192; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp95;
+  if (!binary_input::readArray(
+          tmp95,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)192) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)192; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp95;
+            }
+            Arr4DIdxRowM(tmp95, (int32_t)1, (int32_t)1, (int32_t)192,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp95 : 0;
           }
-          Arr4DIdxRowM(tmp95, (int32_t)1, (int32_t)1, (int32_t)192,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp95 : 0;
         }
       }
     }
@@ -3567,48 +4047,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp96
    * at (2218,1-2218,36) */
   uint64_t __tmp_in_tmp96;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp96;
+  if (!binary_input::readArray(
+          tmp96,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp96;
+      }
+      Arr1DIdxRowM(tmp96, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp96 : 0;
     }
-    Arr1DIdxRowM(tmp96, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp96 : 0;
   }
 
   uint64_t *tmp97 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp97
    * at (2221,1-2221,36) */
   uint64_t __tmp_in_tmp97;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp97;
+  if (!binary_input::readArray(
+          tmp97,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp97;
+      }
+      Arr1DIdxRowM(tmp97, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp97 : 0;
     }
-    Arr1DIdxRowM(tmp97, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp97 : 0;
   }
 
   uint64_t *tmp98 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp98
    * at (2224,1-2224,36) */
   uint64_t __tmp_in_tmp98;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp98;
+  if (!binary_input::readArray(
+          tmp98,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp98;
+      }
+      Arr1DIdxRowM(tmp98, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp98 : 0;
     }
-    Arr1DIdxRowM(tmp98, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp98 : 0;
   }
 
   uint64_t *tmp99 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp99
    * at (2227,1-2227,36) */
   uint64_t __tmp_in_tmp99;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp99;
+  if (!binary_input::readArray(
+          tmp99,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp99;
+      }
+      Arr1DIdxRowM(tmp99, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp99 : 0;
     }
-    Arr1DIdxRowM(tmp99, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp99 : 0;
   }
 
   uint64_t *tmp100 =
@@ -3616,16 +4116,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp100
    * at (2230,1-2230,47) */
   uint64_t __tmp_in_tmp100;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp100;
+  if (!binary_input::readArray(
+          tmp100,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp100;
+            }
+            Arr4DIdxRowM(tmp100, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp100 : 0;
           }
-          Arr4DIdxRowM(tmp100, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp100 : 0;
         }
       }
     }
@@ -3635,48 +4140,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp101
    * at (2233,1-2233,37) */
   uint64_t __tmp_in_tmp101;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)224; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp101;
+  if (!binary_input::readArray(
+          tmp101,
+          ((int32_t)1 * (int32_t)224),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)224; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp101;
+      }
+      Arr1DIdxRowM(tmp101, (int32_t)224, i0) =
+          (party == SERVER) ? __tmp_in_tmp101 : 0;
     }
-    Arr1DIdxRowM(tmp101, (int32_t)224, i0) =
-        (party == SERVER) ? __tmp_in_tmp101 : 0;
   }
 
   uint64_t *tmp102 = make_array<uint64_t>((int32_t)224);
   /* Variable to read the clear value corresponding to the input variable tmp102
    * at (2236,1-2236,37) */
   uint64_t __tmp_in_tmp102;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)224; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp102;
+  if (!binary_input::readArray(
+          tmp102,
+          ((int32_t)1 * (int32_t)224),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)224; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp102;
+      }
+      Arr1DIdxRowM(tmp102, (int32_t)224, i0) =
+          (party == SERVER) ? __tmp_in_tmp102 : 0;
     }
-    Arr1DIdxRowM(tmp102, (int32_t)224, i0) =
-        (party == SERVER) ? __tmp_in_tmp102 : 0;
   }
 
   uint64_t *tmp103 = make_array<uint64_t>((int32_t)224);
   /* Variable to read the clear value corresponding to the input variable tmp103
    * at (2239,1-2239,37) */
   uint64_t __tmp_in_tmp103;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)224; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp103;
+  if (!binary_input::readArray(
+          tmp103,
+          ((int32_t)1 * (int32_t)224),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)224; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp103;
+      }
+      Arr1DIdxRowM(tmp103, (int32_t)224, i0) =
+          (party == SERVER) ? __tmp_in_tmp103 : 0;
     }
-    Arr1DIdxRowM(tmp103, (int32_t)224, i0) =
-        (party == SERVER) ? __tmp_in_tmp103 : 0;
   }
 
   uint64_t *tmp104 = make_array<uint64_t>((int32_t)224);
   /* Variable to read the clear value corresponding to the input variable tmp104
    * at (2242,1-2242,37) */
   uint64_t __tmp_in_tmp104;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)224; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp104;
+  if (!binary_input::readArray(
+          tmp104,
+          ((int32_t)1 * (int32_t)224),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)224; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp104;
+      }
+      Arr1DIdxRowM(tmp104, (int32_t)224, i0) =
+          (party == SERVER) ? __tmp_in_tmp104 : 0;
     }
-    Arr1DIdxRowM(tmp104, (int32_t)224, i0) =
-        (party == SERVER) ? __tmp_in_tmp104 : 0;
   }
 
   uint64_t *tmp105 =
@@ -3684,16 +4209,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp105
    * at (2245,1-2245,48) */
   uint64_t __tmp_in_tmp105;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)224; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp105;
+  if (!binary_input::readArray(
+          tmp105,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)224) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)224; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp105;
+            }
+            Arr4DIdxRowM(tmp105, (int32_t)1, (int32_t)1, (int32_t)224,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp105 : 0;
           }
-          Arr4DIdxRowM(tmp105, (int32_t)1, (int32_t)1, (int32_t)224,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp105 : 0;
         }
       }
     }
@@ -3703,48 +4233,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp106
    * at (2248,1-2248,37) */
   uint64_t __tmp_in_tmp106;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp106;
+  if (!binary_input::readArray(
+          tmp106,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp106;
+      }
+      Arr1DIdxRowM(tmp106, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp106 : 0;
     }
-    Arr1DIdxRowM(tmp106, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp106 : 0;
   }
 
   uint64_t *tmp107 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp107
    * at (2251,1-2251,37) */
   uint64_t __tmp_in_tmp107;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp107;
+  if (!binary_input::readArray(
+          tmp107,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp107;
+      }
+      Arr1DIdxRowM(tmp107, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp107 : 0;
     }
-    Arr1DIdxRowM(tmp107, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp107 : 0;
   }
 
   uint64_t *tmp108 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp108
    * at (2254,1-2254,37) */
   uint64_t __tmp_in_tmp108;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp108;
+  if (!binary_input::readArray(
+          tmp108,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp108;
+      }
+      Arr1DIdxRowM(tmp108, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp108 : 0;
     }
-    Arr1DIdxRowM(tmp108, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp108 : 0;
   }
 
   uint64_t *tmp109 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp109
    * at (2257,1-2257,37) */
   uint64_t __tmp_in_tmp109;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp109;
+  if (!binary_input::readArray(
+          tmp109,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp109;
+      }
+      Arr1DIdxRowM(tmp109, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp109 : 0;
     }
-    Arr1DIdxRowM(tmp109, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp109 : 0;
   }
 
   uint64_t *tmp110 =
@@ -3752,16 +4302,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp110
    * at (2260,1-2260,47) */
   uint64_t __tmp_in_tmp110;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp110;
+  if (!binary_input::readArray(
+          tmp110,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp110;
+            }
+            Arr4DIdxRowM(tmp110, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp110 : 0;
           }
-          Arr4DIdxRowM(tmp110, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp110 : 0;
         }
       }
     }
@@ -3771,48 +4326,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp111
    * at (2263,1-2263,37) */
   uint64_t __tmp_in_tmp111;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp111;
+  if (!binary_input::readArray(
+          tmp111,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp111;
+      }
+      Arr1DIdxRowM(tmp111, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp111 : 0;
     }
-    Arr1DIdxRowM(tmp111, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp111 : 0;
   }
 
   uint64_t *tmp112 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp112
    * at (2266,1-2266,37) */
   uint64_t __tmp_in_tmp112;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp112;
+  if (!binary_input::readArray(
+          tmp112,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp112;
+      }
+      Arr1DIdxRowM(tmp112, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp112 : 0;
     }
-    Arr1DIdxRowM(tmp112, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp112 : 0;
   }
 
   uint64_t *tmp113 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp113
    * at (2269,1-2269,37) */
   uint64_t __tmp_in_tmp113;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp113;
+  if (!binary_input::readArray(
+          tmp113,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp113;
+      }
+      Arr1DIdxRowM(tmp113, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp113 : 0;
     }
-    Arr1DIdxRowM(tmp113, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp113 : 0;
   }
 
   uint64_t *tmp114 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp114
    * at (2272,1-2272,37) */
   uint64_t __tmp_in_tmp114;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp114;
+  if (!binary_input::readArray(
+          tmp114,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp114;
+      }
+      Arr1DIdxRowM(tmp114, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp114 : 0;
     }
-    Arr1DIdxRowM(tmp114, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp114 : 0;
   }
 
   uint64_t *tmp115 =
@@ -3820,16 +4395,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp115
    * at (2275,1-2275,48) */
   uint64_t __tmp_in_tmp115;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp115;
+  if (!binary_input::readArray(
+          tmp115,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)256) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp115;
+            }
+            Arr4DIdxRowM(tmp115, (int32_t)1, (int32_t)1, (int32_t)256,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp115 : 0;
           }
-          Arr4DIdxRowM(tmp115, (int32_t)1, (int32_t)1, (int32_t)256,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp115 : 0;
         }
       }
     }
@@ -3839,48 +4419,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp116
    * at (2278,1-2278,37) */
   uint64_t __tmp_in_tmp116;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp116;
+  if (!binary_input::readArray(
+          tmp116,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp116;
+      }
+      Arr1DIdxRowM(tmp116, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp116 : 0;
     }
-    Arr1DIdxRowM(tmp116, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp116 : 0;
   }
 
   uint64_t *tmp117 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp117
    * at (2281,1-2281,37) */
   uint64_t __tmp_in_tmp117;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp117;
+  if (!binary_input::readArray(
+          tmp117,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp117;
+      }
+      Arr1DIdxRowM(tmp117, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp117 : 0;
     }
-    Arr1DIdxRowM(tmp117, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp117 : 0;
   }
 
   uint64_t *tmp118 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp118
    * at (2284,1-2284,37) */
   uint64_t __tmp_in_tmp118;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp118;
+  if (!binary_input::readArray(
+          tmp118,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp118;
+      }
+      Arr1DIdxRowM(tmp118, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp118 : 0;
     }
-    Arr1DIdxRowM(tmp118, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp118 : 0;
   }
 
   uint64_t *tmp119 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp119
    * at (2287,1-2287,37) */
   uint64_t __tmp_in_tmp119;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp119;
+  if (!binary_input::readArray(
+          tmp119,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp119;
+      }
+      Arr1DIdxRowM(tmp119, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp119 : 0;
     }
-    Arr1DIdxRowM(tmp119, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp119 : 0;
   }
 
   uint64_t *tmp120 =
@@ -3888,16 +4488,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp120
    * at (2290,1-2290,47) */
   uint64_t __tmp_in_tmp120;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp120;
+  if (!binary_input::readArray(
+          tmp120,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp120;
+            }
+            Arr4DIdxRowM(tmp120, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp120 : 0;
           }
-          Arr4DIdxRowM(tmp120, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp120 : 0;
         }
       }
     }
@@ -3907,48 +4512,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp121
    * at (2293,1-2293,37) */
   uint64_t __tmp_in_tmp121;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)288; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp121;
+  if (!binary_input::readArray(
+          tmp121,
+          ((int32_t)1 * (int32_t)288),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)288; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp121;
+      }
+      Arr1DIdxRowM(tmp121, (int32_t)288, i0) =
+          (party == SERVER) ? __tmp_in_tmp121 : 0;
     }
-    Arr1DIdxRowM(tmp121, (int32_t)288, i0) =
-        (party == SERVER) ? __tmp_in_tmp121 : 0;
   }
 
   uint64_t *tmp122 = make_array<uint64_t>((int32_t)288);
   /* Variable to read the clear value corresponding to the input variable tmp122
    * at (2296,1-2296,37) */
   uint64_t __tmp_in_tmp122;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)288; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp122;
+  if (!binary_input::readArray(
+          tmp122,
+          ((int32_t)1 * (int32_t)288),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)288; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp122;
+      }
+      Arr1DIdxRowM(tmp122, (int32_t)288, i0) =
+          (party == SERVER) ? __tmp_in_tmp122 : 0;
     }
-    Arr1DIdxRowM(tmp122, (int32_t)288, i0) =
-        (party == SERVER) ? __tmp_in_tmp122 : 0;
   }
 
   uint64_t *tmp123 = make_array<uint64_t>((int32_t)288);
   /* Variable to read the clear value corresponding to the input variable tmp123
    * at (2299,1-2299,37) */
   uint64_t __tmp_in_tmp123;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)288; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp123;
+  if (!binary_input::readArray(
+          tmp123,
+          ((int32_t)1 * (int32_t)288),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)288; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp123;
+      }
+      Arr1DIdxRowM(tmp123, (int32_t)288, i0) =
+          (party == SERVER) ? __tmp_in_tmp123 : 0;
     }
-    Arr1DIdxRowM(tmp123, (int32_t)288, i0) =
-        (party == SERVER) ? __tmp_in_tmp123 : 0;
   }
 
   uint64_t *tmp124 = make_array<uint64_t>((int32_t)288);
   /* Variable to read the clear value corresponding to the input variable tmp124
    * at (2302,1-2302,37) */
   uint64_t __tmp_in_tmp124;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)288; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp124;
+  if (!binary_input::readArray(
+          tmp124,
+          ((int32_t)1 * (int32_t)288),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)288; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp124;
+      }
+      Arr1DIdxRowM(tmp124, (int32_t)288, i0) =
+          (party == SERVER) ? __tmp_in_tmp124 : 0;
     }
-    Arr1DIdxRowM(tmp124, (int32_t)288, i0) =
-        (party == SERVER) ? __tmp_in_tmp124 : 0;
   }
 
   uint64_t *tmp125 =
@@ -3956,16 +4581,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp125
    * at (2305,1-2305,48) */
   uint64_t __tmp_in_tmp125;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)288; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp125;
+  if (!binary_input::readArray(
+          tmp125,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)288) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)288; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp125;
+            }
+            Arr4DIdxRowM(tmp125, (int32_t)1, (int32_t)1, (int32_t)288,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp125 : 0;
           }
-          Arr4DIdxRowM(tmp125, (int32_t)1, (int32_t)1, (int32_t)288,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp125 : 0;
         }
       }
     }
@@ -3975,48 +4605,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp126
    * at (2308,1-2308,37) */
   uint64_t __tmp_in_tmp126;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp126;
+  if (!binary_input::readArray(
+          tmp126,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp126;
+      }
+      Arr1DIdxRowM(tmp126, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp126 : 0;
     }
-    Arr1DIdxRowM(tmp126, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp126 : 0;
   }
 
   uint64_t *tmp127 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp127
    * at (2311,1-2311,37) */
   uint64_t __tmp_in_tmp127;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp127;
+  if (!binary_input::readArray(
+          tmp127,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp127;
+      }
+      Arr1DIdxRowM(tmp127, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp127 : 0;
     }
-    Arr1DIdxRowM(tmp127, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp127 : 0;
   }
 
   uint64_t *tmp128 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp128
    * at (2314,1-2314,37) */
   uint64_t __tmp_in_tmp128;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp128;
+  if (!binary_input::readArray(
+          tmp128,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp128;
+      }
+      Arr1DIdxRowM(tmp128, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp128 : 0;
     }
-    Arr1DIdxRowM(tmp128, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp128 : 0;
   }
 
   uint64_t *tmp129 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp129
    * at (2317,1-2317,37) */
   uint64_t __tmp_in_tmp129;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp129;
+  if (!binary_input::readArray(
+          tmp129,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp129;
+      }
+      Arr1DIdxRowM(tmp129, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp129 : 0;
     }
-    Arr1DIdxRowM(tmp129, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp129 : 0;
   }
 
   uint64_t *tmp130 =
@@ -4024,16 +4674,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp130
    * at (2320,1-2320,47) */
   uint64_t __tmp_in_tmp130;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp130;
+  if (!binary_input::readArray(
+          tmp130,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp130;
+            }
+            Arr4DIdxRowM(tmp130, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp130 : 0;
           }
-          Arr4DIdxRowM(tmp130, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp130 : 0;
         }
       }
     }
@@ -4043,48 +4698,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp131
    * at (2323,1-2323,37) */
   uint64_t __tmp_in_tmp131;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)320; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp131;
+  if (!binary_input::readArray(
+          tmp131,
+          ((int32_t)1 * (int32_t)320),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)320; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp131;
+      }
+      Arr1DIdxRowM(tmp131, (int32_t)320, i0) =
+          (party == SERVER) ? __tmp_in_tmp131 : 0;
     }
-    Arr1DIdxRowM(tmp131, (int32_t)320, i0) =
-        (party == SERVER) ? __tmp_in_tmp131 : 0;
   }
 
   uint64_t *tmp132 = make_array<uint64_t>((int32_t)320);
   /* Variable to read the clear value corresponding to the input variable tmp132
    * at (2326,1-2326,37) */
   uint64_t __tmp_in_tmp132;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)320; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp132;
+  if (!binary_input::readArray(
+          tmp132,
+          ((int32_t)1 * (int32_t)320),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)320; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp132;
+      }
+      Arr1DIdxRowM(tmp132, (int32_t)320, i0) =
+          (party == SERVER) ? __tmp_in_tmp132 : 0;
     }
-    Arr1DIdxRowM(tmp132, (int32_t)320, i0) =
-        (party == SERVER) ? __tmp_in_tmp132 : 0;
   }
 
   uint64_t *tmp133 = make_array<uint64_t>((int32_t)320);
   /* Variable to read the clear value corresponding to the input variable tmp133
    * at (2329,1-2329,37) */
   uint64_t __tmp_in_tmp133;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)320; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp133;
+  if (!binary_input::readArray(
+          tmp133,
+          ((int32_t)1 * (int32_t)320),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)320; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp133;
+      }
+      Arr1DIdxRowM(tmp133, (int32_t)320, i0) =
+          (party == SERVER) ? __tmp_in_tmp133 : 0;
     }
-    Arr1DIdxRowM(tmp133, (int32_t)320, i0) =
-        (party == SERVER) ? __tmp_in_tmp133 : 0;
   }
 
   uint64_t *tmp134 = make_array<uint64_t>((int32_t)320);
   /* Variable to read the clear value corresponding to the input variable tmp134
    * at (2332,1-2332,37) */
   uint64_t __tmp_in_tmp134;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)320; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp134;
+  if (!binary_input::readArray(
+          tmp134,
+          ((int32_t)1 * (int32_t)320),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)320; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp134;
+      }
+      Arr1DIdxRowM(tmp134, (int32_t)320, i0) =
+          (party == SERVER) ? __tmp_in_tmp134 : 0;
     }
-    Arr1DIdxRowM(tmp134, (int32_t)320, i0) =
-        (party == SERVER) ? __tmp_in_tmp134 : 0;
   }
 
   uint64_t *tmp135 =
@@ -4092,16 +4767,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp135
    * at (2335,1-2335,48) */
   uint64_t __tmp_in_tmp135;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)320; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp135;
+  if (!binary_input::readArray(
+          tmp135,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)320) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)320; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp135;
+            }
+            Arr4DIdxRowM(tmp135, (int32_t)1, (int32_t)1, (int32_t)320,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp135 : 0;
           }
-          Arr4DIdxRowM(tmp135, (int32_t)1, (int32_t)1, (int32_t)320,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp135 : 0;
         }
       }
     }
@@ -4111,48 +4791,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp136
    * at (2338,1-2338,37) */
   uint64_t __tmp_in_tmp136;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp136;
+  if (!binary_input::readArray(
+          tmp136,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp136;
+      }
+      Arr1DIdxRowM(tmp136, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp136 : 0;
     }
-    Arr1DIdxRowM(tmp136, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp136 : 0;
   }
 
   uint64_t *tmp137 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp137
    * at (2341,1-2341,37) */
   uint64_t __tmp_in_tmp137;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp137;
+  if (!binary_input::readArray(
+          tmp137,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp137;
+      }
+      Arr1DIdxRowM(tmp137, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp137 : 0;
     }
-    Arr1DIdxRowM(tmp137, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp137 : 0;
   }
 
   uint64_t *tmp138 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp138
    * at (2344,1-2344,37) */
   uint64_t __tmp_in_tmp138;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp138;
+  if (!binary_input::readArray(
+          tmp138,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp138;
+      }
+      Arr1DIdxRowM(tmp138, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp138 : 0;
     }
-    Arr1DIdxRowM(tmp138, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp138 : 0;
   }
 
   uint64_t *tmp139 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp139
    * at (2347,1-2347,37) */
   uint64_t __tmp_in_tmp139;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp139;
+  if (!binary_input::readArray(
+          tmp139,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp139;
+      }
+      Arr1DIdxRowM(tmp139, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp139 : 0;
     }
-    Arr1DIdxRowM(tmp139, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp139 : 0;
   }
 
   uint64_t *tmp140 =
@@ -4160,16 +4860,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp140
    * at (2350,1-2350,47) */
   uint64_t __tmp_in_tmp140;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp140;
+  if (!binary_input::readArray(
+          tmp140,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp140;
+            }
+            Arr4DIdxRowM(tmp140, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp140 : 0;
           }
-          Arr4DIdxRowM(tmp140, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp140 : 0;
         }
       }
     }
@@ -4179,48 +4884,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp141
    * at (2353,1-2353,37) */
   uint64_t __tmp_in_tmp141;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)352; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp141;
+  if (!binary_input::readArray(
+          tmp141,
+          ((int32_t)1 * (int32_t)352),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)352; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp141;
+      }
+      Arr1DIdxRowM(tmp141, (int32_t)352, i0) =
+          (party == SERVER) ? __tmp_in_tmp141 : 0;
     }
-    Arr1DIdxRowM(tmp141, (int32_t)352, i0) =
-        (party == SERVER) ? __tmp_in_tmp141 : 0;
   }
 
   uint64_t *tmp142 = make_array<uint64_t>((int32_t)352);
   /* Variable to read the clear value corresponding to the input variable tmp142
    * at (2356,1-2356,37) */
   uint64_t __tmp_in_tmp142;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)352; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp142;
+  if (!binary_input::readArray(
+          tmp142,
+          ((int32_t)1 * (int32_t)352),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)352; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp142;
+      }
+      Arr1DIdxRowM(tmp142, (int32_t)352, i0) =
+          (party == SERVER) ? __tmp_in_tmp142 : 0;
     }
-    Arr1DIdxRowM(tmp142, (int32_t)352, i0) =
-        (party == SERVER) ? __tmp_in_tmp142 : 0;
   }
 
   uint64_t *tmp143 = make_array<uint64_t>((int32_t)352);
   /* Variable to read the clear value corresponding to the input variable tmp143
    * at (2359,1-2359,37) */
   uint64_t __tmp_in_tmp143;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)352; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp143;
+  if (!binary_input::readArray(
+          tmp143,
+          ((int32_t)1 * (int32_t)352),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)352; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp143;
+      }
+      Arr1DIdxRowM(tmp143, (int32_t)352, i0) =
+          (party == SERVER) ? __tmp_in_tmp143 : 0;
     }
-    Arr1DIdxRowM(tmp143, (int32_t)352, i0) =
-        (party == SERVER) ? __tmp_in_tmp143 : 0;
   }
 
   uint64_t *tmp144 = make_array<uint64_t>((int32_t)352);
   /* Variable to read the clear value corresponding to the input variable tmp144
    * at (2362,1-2362,37) */
   uint64_t __tmp_in_tmp144;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)352; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp144;
+  if (!binary_input::readArray(
+          tmp144,
+          ((int32_t)1 * (int32_t)352),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)352; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp144;
+      }
+      Arr1DIdxRowM(tmp144, (int32_t)352, i0) =
+          (party == SERVER) ? __tmp_in_tmp144 : 0;
     }
-    Arr1DIdxRowM(tmp144, (int32_t)352, i0) =
-        (party == SERVER) ? __tmp_in_tmp144 : 0;
   }
 
   uint64_t *tmp145 =
@@ -4228,16 +4953,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp145
    * at (2365,1-2365,48) */
   uint64_t __tmp_in_tmp145;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)352; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp145;
+  if (!binary_input::readArray(
+          tmp145,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)352) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)352; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp145;
+            }
+            Arr4DIdxRowM(tmp145, (int32_t)1, (int32_t)1, (int32_t)352,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp145 : 0;
           }
-          Arr4DIdxRowM(tmp145, (int32_t)1, (int32_t)1, (int32_t)352,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp145 : 0;
         }
       }
     }
@@ -4247,48 +4977,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp146
    * at (2368,1-2368,37) */
   uint64_t __tmp_in_tmp146;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp146;
+  if (!binary_input::readArray(
+          tmp146,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp146;
+      }
+      Arr1DIdxRowM(tmp146, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp146 : 0;
     }
-    Arr1DIdxRowM(tmp146, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp146 : 0;
   }
 
   uint64_t *tmp147 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp147
    * at (2371,1-2371,37) */
   uint64_t __tmp_in_tmp147;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp147;
+  if (!binary_input::readArray(
+          tmp147,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp147;
+      }
+      Arr1DIdxRowM(tmp147, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp147 : 0;
     }
-    Arr1DIdxRowM(tmp147, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp147 : 0;
   }
 
   uint64_t *tmp148 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp148
    * at (2374,1-2374,37) */
   uint64_t __tmp_in_tmp148;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp148;
+  if (!binary_input::readArray(
+          tmp148,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp148;
+      }
+      Arr1DIdxRowM(tmp148, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp148 : 0;
     }
-    Arr1DIdxRowM(tmp148, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp148 : 0;
   }
 
   uint64_t *tmp149 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp149
    * at (2377,1-2377,37) */
   uint64_t __tmp_in_tmp149;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp149;
+  if (!binary_input::readArray(
+          tmp149,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp149;
+      }
+      Arr1DIdxRowM(tmp149, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp149 : 0;
     }
-    Arr1DIdxRowM(tmp149, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp149 : 0;
   }
 
   uint64_t *tmp150 =
@@ -4296,16 +5046,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp150
    * at (2380,1-2380,47) */
   uint64_t __tmp_in_tmp150;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp150;
+  if (!binary_input::readArray(
+          tmp150,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp150;
+            }
+            Arr4DIdxRowM(tmp150, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp150 : 0;
           }
-          Arr4DIdxRowM(tmp150, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp150 : 0;
         }
       }
     }
@@ -4315,48 +5070,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp151
    * at (2383,1-2383,37) */
   uint64_t __tmp_in_tmp151;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)384; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp151;
+  if (!binary_input::readArray(
+          tmp151,
+          ((int32_t)1 * (int32_t)384),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)384; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp151;
+      }
+      Arr1DIdxRowM(tmp151, (int32_t)384, i0) =
+          (party == SERVER) ? __tmp_in_tmp151 : 0;
     }
-    Arr1DIdxRowM(tmp151, (int32_t)384, i0) =
-        (party == SERVER) ? __tmp_in_tmp151 : 0;
   }
 
   uint64_t *tmp152 = make_array<uint64_t>((int32_t)384);
   /* Variable to read the clear value corresponding to the input variable tmp152
    * at (2386,1-2386,37) */
   uint64_t __tmp_in_tmp152;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)384; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp152;
+  if (!binary_input::readArray(
+          tmp152,
+          ((int32_t)1 * (int32_t)384),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)384; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp152;
+      }
+      Arr1DIdxRowM(tmp152, (int32_t)384, i0) =
+          (party == SERVER) ? __tmp_in_tmp152 : 0;
     }
-    Arr1DIdxRowM(tmp152, (int32_t)384, i0) =
-        (party == SERVER) ? __tmp_in_tmp152 : 0;
   }
 
   uint64_t *tmp153 = make_array<uint64_t>((int32_t)384);
   /* Variable to read the clear value corresponding to the input variable tmp153
    * at (2389,1-2389,37) */
   uint64_t __tmp_in_tmp153;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)384; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp153;
+  if (!binary_input::readArray(
+          tmp153,
+          ((int32_t)1 * (int32_t)384),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)384; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp153;
+      }
+      Arr1DIdxRowM(tmp153, (int32_t)384, i0) =
+          (party == SERVER) ? __tmp_in_tmp153 : 0;
     }
-    Arr1DIdxRowM(tmp153, (int32_t)384, i0) =
-        (party == SERVER) ? __tmp_in_tmp153 : 0;
   }
 
   uint64_t *tmp154 = make_array<uint64_t>((int32_t)384);
   /* Variable to read the clear value corresponding to the input variable tmp154
    * at (2392,1-2392,37) */
   uint64_t __tmp_in_tmp154;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)384; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp154;
+  if (!binary_input::readArray(
+          tmp154,
+          ((int32_t)1 * (int32_t)384),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)384; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp154;
+      }
+      Arr1DIdxRowM(tmp154, (int32_t)384, i0) =
+          (party == SERVER) ? __tmp_in_tmp154 : 0;
     }
-    Arr1DIdxRowM(tmp154, (int32_t)384, i0) =
-        (party == SERVER) ? __tmp_in_tmp154 : 0;
   }
 
   uint64_t *tmp155 =
@@ -4364,16 +5139,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp155
    * at (2395,1-2395,48) */
   uint64_t __tmp_in_tmp155;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)384; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp155;
+  if (!binary_input::readArray(
+          tmp155,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)384) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)384; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp155;
+            }
+            Arr4DIdxRowM(tmp155, (int32_t)1, (int32_t)1, (int32_t)384,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp155 : 0;
           }
-          Arr4DIdxRowM(tmp155, (int32_t)1, (int32_t)1, (int32_t)384,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp155 : 0;
         }
       }
     }
@@ -4383,48 +5163,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp156
    * at (2398,1-2398,37) */
   uint64_t __tmp_in_tmp156;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp156;
+  if (!binary_input::readArray(
+          tmp156,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp156;
+      }
+      Arr1DIdxRowM(tmp156, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp156 : 0;
     }
-    Arr1DIdxRowM(tmp156, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp156 : 0;
   }
 
   uint64_t *tmp157 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp157
    * at (2401,1-2401,37) */
   uint64_t __tmp_in_tmp157;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp157;
+  if (!binary_input::readArray(
+          tmp157,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp157;
+      }
+      Arr1DIdxRowM(tmp157, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp157 : 0;
     }
-    Arr1DIdxRowM(tmp157, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp157 : 0;
   }
 
   uint64_t *tmp158 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp158
    * at (2404,1-2404,37) */
   uint64_t __tmp_in_tmp158;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp158;
+  if (!binary_input::readArray(
+          tmp158,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp158;
+      }
+      Arr1DIdxRowM(tmp158, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp158 : 0;
     }
-    Arr1DIdxRowM(tmp158, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp158 : 0;
   }
 
   uint64_t *tmp159 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp159
    * at (2407,1-2407,37) */
   uint64_t __tmp_in_tmp159;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp159;
+  if (!binary_input::readArray(
+          tmp159,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp159;
+      }
+      Arr1DIdxRowM(tmp159, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp159 : 0;
     }
-    Arr1DIdxRowM(tmp159, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp159 : 0;
   }
 
   uint64_t *tmp160 =
@@ -4432,16 +5232,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp160
    * at (2410,1-2410,47) */
   uint64_t __tmp_in_tmp160;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp160;
+  if (!binary_input::readArray(
+          tmp160,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp160;
+            }
+            Arr4DIdxRowM(tmp160, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp160 : 0;
           }
-          Arr4DIdxRowM(tmp160, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp160 : 0;
         }
       }
     }
@@ -4451,48 +5256,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp161
    * at (2413,1-2413,37) */
   uint64_t __tmp_in_tmp161;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)416; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp161;
+  if (!binary_input::readArray(
+          tmp161,
+          ((int32_t)1 * (int32_t)416),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)416; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp161;
+      }
+      Arr1DIdxRowM(tmp161, (int32_t)416, i0) =
+          (party == SERVER) ? __tmp_in_tmp161 : 0;
     }
-    Arr1DIdxRowM(tmp161, (int32_t)416, i0) =
-        (party == SERVER) ? __tmp_in_tmp161 : 0;
   }
 
   uint64_t *tmp162 = make_array<uint64_t>((int32_t)416);
   /* Variable to read the clear value corresponding to the input variable tmp162
    * at (2416,1-2416,37) */
   uint64_t __tmp_in_tmp162;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)416; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp162;
+  if (!binary_input::readArray(
+          tmp162,
+          ((int32_t)1 * (int32_t)416),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)416; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp162;
+      }
+      Arr1DIdxRowM(tmp162, (int32_t)416, i0) =
+          (party == SERVER) ? __tmp_in_tmp162 : 0;
     }
-    Arr1DIdxRowM(tmp162, (int32_t)416, i0) =
-        (party == SERVER) ? __tmp_in_tmp162 : 0;
   }
 
   uint64_t *tmp163 = make_array<uint64_t>((int32_t)416);
   /* Variable to read the clear value corresponding to the input variable tmp163
    * at (2419,1-2419,37) */
   uint64_t __tmp_in_tmp163;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)416; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp163;
+  if (!binary_input::readArray(
+          tmp163,
+          ((int32_t)1 * (int32_t)416),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)416; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp163;
+      }
+      Arr1DIdxRowM(tmp163, (int32_t)416, i0) =
+          (party == SERVER) ? __tmp_in_tmp163 : 0;
     }
-    Arr1DIdxRowM(tmp163, (int32_t)416, i0) =
-        (party == SERVER) ? __tmp_in_tmp163 : 0;
   }
 
   uint64_t *tmp164 = make_array<uint64_t>((int32_t)416);
   /* Variable to read the clear value corresponding to the input variable tmp164
    * at (2422,1-2422,37) */
   uint64_t __tmp_in_tmp164;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)416; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp164;
+  if (!binary_input::readArray(
+          tmp164,
+          ((int32_t)1 * (int32_t)416),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)416; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp164;
+      }
+      Arr1DIdxRowM(tmp164, (int32_t)416, i0) =
+          (party == SERVER) ? __tmp_in_tmp164 : 0;
     }
-    Arr1DIdxRowM(tmp164, (int32_t)416, i0) =
-        (party == SERVER) ? __tmp_in_tmp164 : 0;
   }
 
   uint64_t *tmp165 =
@@ -4500,16 +5325,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp165
    * at (2425,1-2425,48) */
   uint64_t __tmp_in_tmp165;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)416; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp165;
+  if (!binary_input::readArray(
+          tmp165,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)416) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)416; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp165;
+            }
+            Arr4DIdxRowM(tmp165, (int32_t)1, (int32_t)1, (int32_t)416,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp165 : 0;
           }
-          Arr4DIdxRowM(tmp165, (int32_t)1, (int32_t)1, (int32_t)416,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp165 : 0;
         }
       }
     }
@@ -4519,48 +5349,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp166
    * at (2428,1-2428,37) */
   uint64_t __tmp_in_tmp166;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp166;
+  if (!binary_input::readArray(
+          tmp166,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp166;
+      }
+      Arr1DIdxRowM(tmp166, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp166 : 0;
     }
-    Arr1DIdxRowM(tmp166, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp166 : 0;
   }
 
   uint64_t *tmp167 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp167
    * at (2431,1-2431,37) */
   uint64_t __tmp_in_tmp167;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp167;
+  if (!binary_input::readArray(
+          tmp167,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp167;
+      }
+      Arr1DIdxRowM(tmp167, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp167 : 0;
     }
-    Arr1DIdxRowM(tmp167, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp167 : 0;
   }
 
   uint64_t *tmp168 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp168
    * at (2434,1-2434,37) */
   uint64_t __tmp_in_tmp168;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp168;
+  if (!binary_input::readArray(
+          tmp168,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp168;
+      }
+      Arr1DIdxRowM(tmp168, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp168 : 0;
     }
-    Arr1DIdxRowM(tmp168, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp168 : 0;
   }
 
   uint64_t *tmp169 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp169
    * at (2437,1-2437,37) */
   uint64_t __tmp_in_tmp169;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp169;
+  if (!binary_input::readArray(
+          tmp169,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp169;
+      }
+      Arr1DIdxRowM(tmp169, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp169 : 0;
     }
-    Arr1DIdxRowM(tmp169, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp169 : 0;
   }
 
   uint64_t *tmp170 =
@@ -4568,16 +5418,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp170
    * at (2440,1-2440,47) */
   uint64_t __tmp_in_tmp170;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp170;
+  if (!binary_input::readArray(
+          tmp170,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp170;
+            }
+            Arr4DIdxRowM(tmp170, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp170 : 0;
           }
-          Arr4DIdxRowM(tmp170, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp170 : 0;
         }
       }
     }
@@ -4587,48 +5442,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp171
    * at (2443,1-2443,37) */
   uint64_t __tmp_in_tmp171;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)448; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp171;
+  if (!binary_input::readArray(
+          tmp171,
+          ((int32_t)1 * (int32_t)448),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)448; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp171;
+      }
+      Arr1DIdxRowM(tmp171, (int32_t)448, i0) =
+          (party == SERVER) ? __tmp_in_tmp171 : 0;
     }
-    Arr1DIdxRowM(tmp171, (int32_t)448, i0) =
-        (party == SERVER) ? __tmp_in_tmp171 : 0;
   }
 
   uint64_t *tmp172 = make_array<uint64_t>((int32_t)448);
   /* Variable to read the clear value corresponding to the input variable tmp172
    * at (2446,1-2446,37) */
   uint64_t __tmp_in_tmp172;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)448; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp172;
+  if (!binary_input::readArray(
+          tmp172,
+          ((int32_t)1 * (int32_t)448),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)448; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp172;
+      }
+      Arr1DIdxRowM(tmp172, (int32_t)448, i0) =
+          (party == SERVER) ? __tmp_in_tmp172 : 0;
     }
-    Arr1DIdxRowM(tmp172, (int32_t)448, i0) =
-        (party == SERVER) ? __tmp_in_tmp172 : 0;
   }
 
   uint64_t *tmp173 = make_array<uint64_t>((int32_t)448);
   /* Variable to read the clear value corresponding to the input variable tmp173
    * at (2449,1-2449,37) */
   uint64_t __tmp_in_tmp173;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)448; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp173;
+  if (!binary_input::readArray(
+          tmp173,
+          ((int32_t)1 * (int32_t)448),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)448; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp173;
+      }
+      Arr1DIdxRowM(tmp173, (int32_t)448, i0) =
+          (party == SERVER) ? __tmp_in_tmp173 : 0;
     }
-    Arr1DIdxRowM(tmp173, (int32_t)448, i0) =
-        (party == SERVER) ? __tmp_in_tmp173 : 0;
   }
 
   uint64_t *tmp174 = make_array<uint64_t>((int32_t)448);
   /* Variable to read the clear value corresponding to the input variable tmp174
    * at (2452,1-2452,37) */
   uint64_t __tmp_in_tmp174;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)448; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp174;
+  if (!binary_input::readArray(
+          tmp174,
+          ((int32_t)1 * (int32_t)448),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)448; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp174;
+      }
+      Arr1DIdxRowM(tmp174, (int32_t)448, i0) =
+          (party == SERVER) ? __tmp_in_tmp174 : 0;
     }
-    Arr1DIdxRowM(tmp174, (int32_t)448, i0) =
-        (party == SERVER) ? __tmp_in_tmp174 : 0;
   }
 
   uint64_t *tmp175 =
@@ -4636,16 +5511,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp175
    * at (2455,1-2455,48) */
   uint64_t __tmp_in_tmp175;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)448; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp175;
+  if (!binary_input::readArray(
+          tmp175,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)448) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)448; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp175;
+            }
+            Arr4DIdxRowM(tmp175, (int32_t)1, (int32_t)1, (int32_t)448,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp175 : 0;
           }
-          Arr4DIdxRowM(tmp175, (int32_t)1, (int32_t)1, (int32_t)448,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp175 : 0;
         }
       }
     }
@@ -4655,48 +5535,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp176
    * at (2458,1-2458,37) */
   uint64_t __tmp_in_tmp176;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp176;
+  if (!binary_input::readArray(
+          tmp176,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp176;
+      }
+      Arr1DIdxRowM(tmp176, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp176 : 0;
     }
-    Arr1DIdxRowM(tmp176, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp176 : 0;
   }
 
   uint64_t *tmp177 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp177
    * at (2461,1-2461,37) */
   uint64_t __tmp_in_tmp177;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp177;
+  if (!binary_input::readArray(
+          tmp177,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp177;
+      }
+      Arr1DIdxRowM(tmp177, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp177 : 0;
     }
-    Arr1DIdxRowM(tmp177, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp177 : 0;
   }
 
   uint64_t *tmp178 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp178
    * at (2464,1-2464,37) */
   uint64_t __tmp_in_tmp178;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp178;
+  if (!binary_input::readArray(
+          tmp178,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp178;
+      }
+      Arr1DIdxRowM(tmp178, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp178 : 0;
     }
-    Arr1DIdxRowM(tmp178, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp178 : 0;
   }
 
   uint64_t *tmp179 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp179
    * at (2467,1-2467,37) */
   uint64_t __tmp_in_tmp179;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp179;
+  if (!binary_input::readArray(
+          tmp179,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp179;
+      }
+      Arr1DIdxRowM(tmp179, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp179 : 0;
     }
-    Arr1DIdxRowM(tmp179, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp179 : 0;
   }
 
   uint64_t *tmp180 =
@@ -4704,16 +5604,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp180
    * at (2470,1-2470,47) */
   uint64_t __tmp_in_tmp180;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp180;
+  if (!binary_input::readArray(
+          tmp180,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp180;
+            }
+            Arr4DIdxRowM(tmp180, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp180 : 0;
           }
-          Arr4DIdxRowM(tmp180, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp180 : 0;
         }
       }
     }
@@ -4723,48 +5628,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp181
    * at (2473,1-2473,37) */
   uint64_t __tmp_in_tmp181;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)480; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp181;
+  if (!binary_input::readArray(
+          tmp181,
+          ((int32_t)1 * (int32_t)480),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)480; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp181;
+      }
+      Arr1DIdxRowM(tmp181, (int32_t)480, i0) =
+          (party == SERVER) ? __tmp_in_tmp181 : 0;
     }
-    Arr1DIdxRowM(tmp181, (int32_t)480, i0) =
-        (party == SERVER) ? __tmp_in_tmp181 : 0;
   }
 
   uint64_t *tmp182 = make_array<uint64_t>((int32_t)480);
   /* Variable to read the clear value corresponding to the input variable tmp182
    * at (2476,1-2476,37) */
   uint64_t __tmp_in_tmp182;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)480; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp182;
+  if (!binary_input::readArray(
+          tmp182,
+          ((int32_t)1 * (int32_t)480),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)480; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp182;
+      }
+      Arr1DIdxRowM(tmp182, (int32_t)480, i0) =
+          (party == SERVER) ? __tmp_in_tmp182 : 0;
     }
-    Arr1DIdxRowM(tmp182, (int32_t)480, i0) =
-        (party == SERVER) ? __tmp_in_tmp182 : 0;
   }
 
   uint64_t *tmp183 = make_array<uint64_t>((int32_t)480);
   /* Variable to read the clear value corresponding to the input variable tmp183
    * at (2479,1-2479,37) */
   uint64_t __tmp_in_tmp183;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)480; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp183;
+  if (!binary_input::readArray(
+          tmp183,
+          ((int32_t)1 * (int32_t)480),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)480; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp183;
+      }
+      Arr1DIdxRowM(tmp183, (int32_t)480, i0) =
+          (party == SERVER) ? __tmp_in_tmp183 : 0;
     }
-    Arr1DIdxRowM(tmp183, (int32_t)480, i0) =
-        (party == SERVER) ? __tmp_in_tmp183 : 0;
   }
 
   uint64_t *tmp184 = make_array<uint64_t>((int32_t)480);
   /* Variable to read the clear value corresponding to the input variable tmp184
    * at (2482,1-2482,37) */
   uint64_t __tmp_in_tmp184;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)480; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp184;
+  if (!binary_input::readArray(
+          tmp184,
+          ((int32_t)1 * (int32_t)480),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)480; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp184;
+      }
+      Arr1DIdxRowM(tmp184, (int32_t)480, i0) =
+          (party == SERVER) ? __tmp_in_tmp184 : 0;
     }
-    Arr1DIdxRowM(tmp184, (int32_t)480, i0) =
-        (party == SERVER) ? __tmp_in_tmp184 : 0;
   }
 
   uint64_t *tmp185 =
@@ -4772,16 +5697,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp185
    * at (2485,1-2485,48) */
   uint64_t __tmp_in_tmp185;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)480; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp185;
+  if (!binary_input::readArray(
+          tmp185,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)480) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)480; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp185;
+            }
+            Arr4DIdxRowM(tmp185, (int32_t)1, (int32_t)1, (int32_t)480,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp185 : 0;
           }
-          Arr4DIdxRowM(tmp185, (int32_t)1, (int32_t)1, (int32_t)480,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp185 : 0;
         }
       }
     }
@@ -4791,48 +5721,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp186
    * at (2488,1-2488,37) */
   uint64_t __tmp_in_tmp186;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp186;
+  if (!binary_input::readArray(
+          tmp186,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp186;
+      }
+      Arr1DIdxRowM(tmp186, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp186 : 0;
     }
-    Arr1DIdxRowM(tmp186, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp186 : 0;
   }
 
   uint64_t *tmp187 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp187
    * at (2491,1-2491,37) */
   uint64_t __tmp_in_tmp187;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp187;
+  if (!binary_input::readArray(
+          tmp187,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp187;
+      }
+      Arr1DIdxRowM(tmp187, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp187 : 0;
     }
-    Arr1DIdxRowM(tmp187, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp187 : 0;
   }
 
   uint64_t *tmp188 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp188
    * at (2494,1-2494,37) */
   uint64_t __tmp_in_tmp188;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp188;
+  if (!binary_input::readArray(
+          tmp188,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp188;
+      }
+      Arr1DIdxRowM(tmp188, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp188 : 0;
     }
-    Arr1DIdxRowM(tmp188, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp188 : 0;
   }
 
   uint64_t *tmp189 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp189
    * at (2497,1-2497,37) */
   uint64_t __tmp_in_tmp189;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp189;
+  if (!binary_input::readArray(
+          tmp189,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp189;
+      }
+      Arr1DIdxRowM(tmp189, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp189 : 0;
     }
-    Arr1DIdxRowM(tmp189, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp189 : 0;
   }
 
   uint64_t *tmp190 =
@@ -4840,16 +5790,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp190
    * at (2500,1-2500,47) */
   uint64_t __tmp_in_tmp190;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp190;
+  if (!binary_input::readArray(
+          tmp190,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp190;
+            }
+            Arr4DIdxRowM(tmp190, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp190 : 0;
           }
-          Arr4DIdxRowM(tmp190, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp190 : 0;
         }
       }
     }
@@ -4859,48 +5814,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp191
    * at (2503,1-2503,37) */
   uint64_t __tmp_in_tmp191;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp191;
+  if (!binary_input::readArray(
+          tmp191,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp191;
+      }
+      Arr1DIdxRowM(tmp191, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp191 : 0;
     }
-    Arr1DIdxRowM(tmp191, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp191 : 0;
   }
 
   uint64_t *tmp192 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp192
    * at (2506,1-2506,37) */
   uint64_t __tmp_in_tmp192;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp192;
+  if (!binary_input::readArray(
+          tmp192,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp192;
+      }
+      Arr1DIdxRowM(tmp192, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp192 : 0;
     }
-    Arr1DIdxRowM(tmp192, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp192 : 0;
   }
 
   uint64_t *tmp193 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp193
    * at (2509,1-2509,37) */
   uint64_t __tmp_in_tmp193;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp193;
+  if (!binary_input::readArray(
+          tmp193,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp193;
+      }
+      Arr1DIdxRowM(tmp193, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp193 : 0;
     }
-    Arr1DIdxRowM(tmp193, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp193 : 0;
   }
 
   uint64_t *tmp194 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp194
    * at (2512,1-2512,37) */
   uint64_t __tmp_in_tmp194;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp194;
+  if (!binary_input::readArray(
+          tmp194,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp194;
+      }
+      Arr1DIdxRowM(tmp194, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp194 : 0;
     }
-    Arr1DIdxRowM(tmp194, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp194 : 0;
   }
 
   uint64_t *tmp195 =
@@ -4908,16 +5883,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp195
    * at (2515,1-2515,48) */
   uint64_t __tmp_in_tmp195;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp195;
+  if (!binary_input::readArray(
+          tmp195,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)512) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp195;
+            }
+            Arr4DIdxRowM(tmp195, (int32_t)1, (int32_t)1, (int32_t)512,
+                         (int32_t)256, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp195 : 0;
           }
-          Arr4DIdxRowM(tmp195, (int32_t)1, (int32_t)1, (int32_t)512,
-                       (int32_t)256, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp195 : 0;
         }
       }
     }
@@ -4927,48 +5907,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp196
    * at (2518,1-2518,37) */
   uint64_t __tmp_in_tmp196;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp196;
+  if (!binary_input::readArray(
+          tmp196,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp196;
+      }
+      Arr1DIdxRowM(tmp196, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp196 : 0;
     }
-    Arr1DIdxRowM(tmp196, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp196 : 0;
   }
 
   uint64_t *tmp197 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp197
    * at (2521,1-2521,37) */
   uint64_t __tmp_in_tmp197;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp197;
+  if (!binary_input::readArray(
+          tmp197,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp197;
+      }
+      Arr1DIdxRowM(tmp197, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp197 : 0;
     }
-    Arr1DIdxRowM(tmp197, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp197 : 0;
   }
 
   uint64_t *tmp198 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp198
    * at (2524,1-2524,37) */
   uint64_t __tmp_in_tmp198;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp198;
+  if (!binary_input::readArray(
+          tmp198,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp198;
+      }
+      Arr1DIdxRowM(tmp198, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp198 : 0;
     }
-    Arr1DIdxRowM(tmp198, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp198 : 0;
   }
 
   uint64_t *tmp199 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp199
    * at (2527,1-2527,37) */
   uint64_t __tmp_in_tmp199;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp199;
+  if (!binary_input::readArray(
+          tmp199,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp199;
+      }
+      Arr1DIdxRowM(tmp199, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp199 : 0;
     }
-    Arr1DIdxRowM(tmp199, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp199 : 0;
   }
 
   uint64_t *tmp200 =
@@ -4976,16 +5976,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp200
    * at (2530,1-2530,48) */
   uint64_t __tmp_in_tmp200;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp200;
+  if (!binary_input::readArray(
+          tmp200,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)256) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp200;
+            }
+            Arr4DIdxRowM(tmp200, (int32_t)1, (int32_t)1, (int32_t)256,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp200 : 0;
           }
-          Arr4DIdxRowM(tmp200, (int32_t)1, (int32_t)1, (int32_t)256,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp200 : 0;
         }
       }
     }
@@ -4995,48 +6000,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp201
    * at (2533,1-2533,37) */
   uint64_t __tmp_in_tmp201;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp201;
+  if (!binary_input::readArray(
+          tmp201,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp201;
+      }
+      Arr1DIdxRowM(tmp201, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp201 : 0;
     }
-    Arr1DIdxRowM(tmp201, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp201 : 0;
   }
 
   uint64_t *tmp202 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp202
    * at (2536,1-2536,37) */
   uint64_t __tmp_in_tmp202;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp202;
+  if (!binary_input::readArray(
+          tmp202,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp202;
+      }
+      Arr1DIdxRowM(tmp202, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp202 : 0;
     }
-    Arr1DIdxRowM(tmp202, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp202 : 0;
   }
 
   uint64_t *tmp203 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp203
    * at (2539,1-2539,37) */
   uint64_t __tmp_in_tmp203;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp203;
+  if (!binary_input::readArray(
+          tmp203,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp203;
+      }
+      Arr1DIdxRowM(tmp203, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp203 : 0;
     }
-    Arr1DIdxRowM(tmp203, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp203 : 0;
   }
 
   uint64_t *tmp204 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp204
    * at (2542,1-2542,37) */
   uint64_t __tmp_in_tmp204;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp204;
+  if (!binary_input::readArray(
+          tmp204,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp204;
+      }
+      Arr1DIdxRowM(tmp204, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp204 : 0;
     }
-    Arr1DIdxRowM(tmp204, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp204 : 0;
   }
 
   uint64_t *tmp205 =
@@ -5044,16 +6069,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp205
    * at (2545,1-2545,47) */
   uint64_t __tmp_in_tmp205;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp205;
+  if (!binary_input::readArray(
+          tmp205,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp205;
+            }
+            Arr4DIdxRowM(tmp205, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp205 : 0;
           }
-          Arr4DIdxRowM(tmp205, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp205 : 0;
         }
       }
     }
@@ -5063,48 +6093,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp206
    * at (2548,1-2548,37) */
   uint64_t __tmp_in_tmp206;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)288; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp206;
+  if (!binary_input::readArray(
+          tmp206,
+          ((int32_t)1 * (int32_t)288),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)288; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp206;
+      }
+      Arr1DIdxRowM(tmp206, (int32_t)288, i0) =
+          (party == SERVER) ? __tmp_in_tmp206 : 0;
     }
-    Arr1DIdxRowM(tmp206, (int32_t)288, i0) =
-        (party == SERVER) ? __tmp_in_tmp206 : 0;
   }
 
   uint64_t *tmp207 = make_array<uint64_t>((int32_t)288);
   /* Variable to read the clear value corresponding to the input variable tmp207
    * at (2551,1-2551,37) */
   uint64_t __tmp_in_tmp207;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)288; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp207;
+  if (!binary_input::readArray(
+          tmp207,
+          ((int32_t)1 * (int32_t)288),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)288; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp207;
+      }
+      Arr1DIdxRowM(tmp207, (int32_t)288, i0) =
+          (party == SERVER) ? __tmp_in_tmp207 : 0;
     }
-    Arr1DIdxRowM(tmp207, (int32_t)288, i0) =
-        (party == SERVER) ? __tmp_in_tmp207 : 0;
   }
 
   uint64_t *tmp208 = make_array<uint64_t>((int32_t)288);
   /* Variable to read the clear value corresponding to the input variable tmp208
    * at (2554,1-2554,37) */
   uint64_t __tmp_in_tmp208;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)288; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp208;
+  if (!binary_input::readArray(
+          tmp208,
+          ((int32_t)1 * (int32_t)288),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)288; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp208;
+      }
+      Arr1DIdxRowM(tmp208, (int32_t)288, i0) =
+          (party == SERVER) ? __tmp_in_tmp208 : 0;
     }
-    Arr1DIdxRowM(tmp208, (int32_t)288, i0) =
-        (party == SERVER) ? __tmp_in_tmp208 : 0;
   }
 
   uint64_t *tmp209 = make_array<uint64_t>((int32_t)288);
   /* Variable to read the clear value corresponding to the input variable tmp209
    * at (2557,1-2557,37) */
   uint64_t __tmp_in_tmp209;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)288; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp209;
+  if (!binary_input::readArray(
+          tmp209,
+          ((int32_t)1 * (int32_t)288),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)288; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp209;
+      }
+      Arr1DIdxRowM(tmp209, (int32_t)288, i0) =
+          (party == SERVER) ? __tmp_in_tmp209 : 0;
     }
-    Arr1DIdxRowM(tmp209, (int32_t)288, i0) =
-        (party == SERVER) ? __tmp_in_tmp209 : 0;
   }
 
   uint64_t *tmp210 =
@@ -5112,16 +6162,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp210
    * at (2560,1-2560,48) */
   uint64_t __tmp_in_tmp210;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)288; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp210;
+  if (!binary_input::readArray(
+          tmp210,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)288) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)288; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp210;
+            }
+            Arr4DIdxRowM(tmp210, (int32_t)1, (int32_t)1, (int32_t)288,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp210 : 0;
           }
-          Arr4DIdxRowM(tmp210, (int32_t)1, (int32_t)1, (int32_t)288,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp210 : 0;
         }
       }
     }
@@ -5131,48 +6186,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp211
    * at (2563,1-2563,37) */
   uint64_t __tmp_in_tmp211;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp211;
+  if (!binary_input::readArray(
+          tmp211,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp211;
+      }
+      Arr1DIdxRowM(tmp211, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp211 : 0;
     }
-    Arr1DIdxRowM(tmp211, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp211 : 0;
   }
 
   uint64_t *tmp212 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp212
    * at (2566,1-2566,37) */
   uint64_t __tmp_in_tmp212;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp212;
+  if (!binary_input::readArray(
+          tmp212,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp212;
+      }
+      Arr1DIdxRowM(tmp212, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp212 : 0;
     }
-    Arr1DIdxRowM(tmp212, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp212 : 0;
   }
 
   uint64_t *tmp213 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp213
    * at (2569,1-2569,37) */
   uint64_t __tmp_in_tmp213;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp213;
+  if (!binary_input::readArray(
+          tmp213,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp213;
+      }
+      Arr1DIdxRowM(tmp213, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp213 : 0;
     }
-    Arr1DIdxRowM(tmp213, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp213 : 0;
   }
 
   uint64_t *tmp214 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp214
    * at (2572,1-2572,37) */
   uint64_t __tmp_in_tmp214;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp214;
+  if (!binary_input::readArray(
+          tmp214,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp214;
+      }
+      Arr1DIdxRowM(tmp214, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp214 : 0;
     }
-    Arr1DIdxRowM(tmp214, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp214 : 0;
   }
 
   uint64_t *tmp215 =
@@ -5180,16 +6255,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp215
    * at (2575,1-2575,47) */
   uint64_t __tmp_in_tmp215;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp215;
+  if (!binary_input::readArray(
+          tmp215,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp215;
+            }
+            Arr4DIdxRowM(tmp215, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp215 : 0;
           }
-          Arr4DIdxRowM(tmp215, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp215 : 0;
         }
       }
     }
@@ -5199,48 +6279,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp216
    * at (2578,1-2578,37) */
   uint64_t __tmp_in_tmp216;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)320; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp216;
+  if (!binary_input::readArray(
+          tmp216,
+          ((int32_t)1 * (int32_t)320),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)320; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp216;
+      }
+      Arr1DIdxRowM(tmp216, (int32_t)320, i0) =
+          (party == SERVER) ? __tmp_in_tmp216 : 0;
     }
-    Arr1DIdxRowM(tmp216, (int32_t)320, i0) =
-        (party == SERVER) ? __tmp_in_tmp216 : 0;
   }
 
   uint64_t *tmp217 = make_array<uint64_t>((int32_t)320);
   /* Variable to read the clear value corresponding to the input variable tmp217
    * at (2581,1-2581,37) */
   uint64_t __tmp_in_tmp217;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)320; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp217;
+  if (!binary_input::readArray(
+          tmp217,
+          ((int32_t)1 * (int32_t)320),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)320; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp217;
+      }
+      Arr1DIdxRowM(tmp217, (int32_t)320, i0) =
+          (party == SERVER) ? __tmp_in_tmp217 : 0;
     }
-    Arr1DIdxRowM(tmp217, (int32_t)320, i0) =
-        (party == SERVER) ? __tmp_in_tmp217 : 0;
   }
 
   uint64_t *tmp218 = make_array<uint64_t>((int32_t)320);
   /* Variable to read the clear value corresponding to the input variable tmp218
    * at (2584,1-2584,37) */
   uint64_t __tmp_in_tmp218;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)320; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp218;
+  if (!binary_input::readArray(
+          tmp218,
+          ((int32_t)1 * (int32_t)320),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)320; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp218;
+      }
+      Arr1DIdxRowM(tmp218, (int32_t)320, i0) =
+          (party == SERVER) ? __tmp_in_tmp218 : 0;
     }
-    Arr1DIdxRowM(tmp218, (int32_t)320, i0) =
-        (party == SERVER) ? __tmp_in_tmp218 : 0;
   }
 
   uint64_t *tmp219 = make_array<uint64_t>((int32_t)320);
   /* Variable to read the clear value corresponding to the input variable tmp219
    * at (2587,1-2587,37) */
   uint64_t __tmp_in_tmp219;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)320; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp219;
+  if (!binary_input::readArray(
+          tmp219,
+          ((int32_t)1 * (int32_t)320),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)320; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp219;
+      }
+      Arr1DIdxRowM(tmp219, (int32_t)320, i0) =
+          (party == SERVER) ? __tmp_in_tmp219 : 0;
     }
-    Arr1DIdxRowM(tmp219, (int32_t)320, i0) =
-        (party == SERVER) ? __tmp_in_tmp219 : 0;
   }
 
   uint64_t *tmp220 =
@@ -5248,16 +6348,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp220
    * at (2590,1-2590,48) */
   uint64_t __tmp_in_tmp220;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)320; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp220;
+  if (!binary_input::readArray(
+          tmp220,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)320) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)320; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp220;
+            }
+            Arr4DIdxRowM(tmp220, (int32_t)1, (int32_t)1, (int32_t)320,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp220 : 0;
           }
-          Arr4DIdxRowM(tmp220, (int32_t)1, (int32_t)1, (int32_t)320,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp220 : 0;
         }
       }
     }
@@ -5267,48 +6372,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp221
    * at (2593,1-2593,37) */
   uint64_t __tmp_in_tmp221;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp221;
+  if (!binary_input::readArray(
+          tmp221,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp221;
+      }
+      Arr1DIdxRowM(tmp221, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp221 : 0;
     }
-    Arr1DIdxRowM(tmp221, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp221 : 0;
   }
 
   uint64_t *tmp222 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp222
    * at (2596,1-2596,37) */
   uint64_t __tmp_in_tmp222;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp222;
+  if (!binary_input::readArray(
+          tmp222,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp222;
+      }
+      Arr1DIdxRowM(tmp222, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp222 : 0;
     }
-    Arr1DIdxRowM(tmp222, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp222 : 0;
   }
 
   uint64_t *tmp223 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp223
    * at (2599,1-2599,37) */
   uint64_t __tmp_in_tmp223;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp223;
+  if (!binary_input::readArray(
+          tmp223,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp223;
+      }
+      Arr1DIdxRowM(tmp223, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp223 : 0;
     }
-    Arr1DIdxRowM(tmp223, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp223 : 0;
   }
 
   uint64_t *tmp224 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp224
    * at (2602,1-2602,37) */
   uint64_t __tmp_in_tmp224;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp224;
+  if (!binary_input::readArray(
+          tmp224,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp224;
+      }
+      Arr1DIdxRowM(tmp224, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp224 : 0;
     }
-    Arr1DIdxRowM(tmp224, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp224 : 0;
   }
 
   uint64_t *tmp225 =
@@ -5316,16 +6441,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp225
    * at (2605,1-2605,47) */
   uint64_t __tmp_in_tmp225;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp225;
+  if (!binary_input::readArray(
+          tmp225,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp225;
+            }
+            Arr4DIdxRowM(tmp225, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp225 : 0;
           }
-          Arr4DIdxRowM(tmp225, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp225 : 0;
         }
       }
     }
@@ -5335,48 +6465,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp226
    * at (2608,1-2608,37) */
   uint64_t __tmp_in_tmp226;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)352; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp226;
+  if (!binary_input::readArray(
+          tmp226,
+          ((int32_t)1 * (int32_t)352),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)352; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp226;
+      }
+      Arr1DIdxRowM(tmp226, (int32_t)352, i0) =
+          (party == SERVER) ? __tmp_in_tmp226 : 0;
     }
-    Arr1DIdxRowM(tmp226, (int32_t)352, i0) =
-        (party == SERVER) ? __tmp_in_tmp226 : 0;
   }
 
   uint64_t *tmp227 = make_array<uint64_t>((int32_t)352);
   /* Variable to read the clear value corresponding to the input variable tmp227
    * at (2611,1-2611,37) */
   uint64_t __tmp_in_tmp227;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)352; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp227;
+  if (!binary_input::readArray(
+          tmp227,
+          ((int32_t)1 * (int32_t)352),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)352; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp227;
+      }
+      Arr1DIdxRowM(tmp227, (int32_t)352, i0) =
+          (party == SERVER) ? __tmp_in_tmp227 : 0;
     }
-    Arr1DIdxRowM(tmp227, (int32_t)352, i0) =
-        (party == SERVER) ? __tmp_in_tmp227 : 0;
   }
 
   uint64_t *tmp228 = make_array<uint64_t>((int32_t)352);
   /* Variable to read the clear value corresponding to the input variable tmp228
    * at (2614,1-2614,37) */
   uint64_t __tmp_in_tmp228;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)352; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp228;
+  if (!binary_input::readArray(
+          tmp228,
+          ((int32_t)1 * (int32_t)352),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)352; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp228;
+      }
+      Arr1DIdxRowM(tmp228, (int32_t)352, i0) =
+          (party == SERVER) ? __tmp_in_tmp228 : 0;
     }
-    Arr1DIdxRowM(tmp228, (int32_t)352, i0) =
-        (party == SERVER) ? __tmp_in_tmp228 : 0;
   }
 
   uint64_t *tmp229 = make_array<uint64_t>((int32_t)352);
   /* Variable to read the clear value corresponding to the input variable tmp229
    * at (2617,1-2617,37) */
   uint64_t __tmp_in_tmp229;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)352; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp229;
+  if (!binary_input::readArray(
+          tmp229,
+          ((int32_t)1 * (int32_t)352),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)352; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp229;
+      }
+      Arr1DIdxRowM(tmp229, (int32_t)352, i0) =
+          (party == SERVER) ? __tmp_in_tmp229 : 0;
     }
-    Arr1DIdxRowM(tmp229, (int32_t)352, i0) =
-        (party == SERVER) ? __tmp_in_tmp229 : 0;
   }
 
   uint64_t *tmp230 =
@@ -5384,16 +6534,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp230
    * at (2620,1-2620,48) */
   uint64_t __tmp_in_tmp230;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)352; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp230;
+  if (!binary_input::readArray(
+          tmp230,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)352) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)352; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp230;
+            }
+            Arr4DIdxRowM(tmp230, (int32_t)1, (int32_t)1, (int32_t)352,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp230 : 0;
           }
-          Arr4DIdxRowM(tmp230, (int32_t)1, (int32_t)1, (int32_t)352,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp230 : 0;
         }
       }
     }
@@ -5403,48 +6558,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp231
    * at (2623,1-2623,37) */
   uint64_t __tmp_in_tmp231;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp231;
+  if (!binary_input::readArray(
+          tmp231,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp231;
+      }
+      Arr1DIdxRowM(tmp231, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp231 : 0;
     }
-    Arr1DIdxRowM(tmp231, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp231 : 0;
   }
 
   uint64_t *tmp232 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp232
    * at (2626,1-2626,37) */
   uint64_t __tmp_in_tmp232;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp232;
+  if (!binary_input::readArray(
+          tmp232,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp232;
+      }
+      Arr1DIdxRowM(tmp232, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp232 : 0;
     }
-    Arr1DIdxRowM(tmp232, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp232 : 0;
   }
 
   uint64_t *tmp233 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp233
    * at (2629,1-2629,37) */
   uint64_t __tmp_in_tmp233;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp233;
+  if (!binary_input::readArray(
+          tmp233,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp233;
+      }
+      Arr1DIdxRowM(tmp233, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp233 : 0;
     }
-    Arr1DIdxRowM(tmp233, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp233 : 0;
   }
 
   uint64_t *tmp234 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp234
    * at (2632,1-2632,37) */
   uint64_t __tmp_in_tmp234;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp234;
+  if (!binary_input::readArray(
+          tmp234,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp234;
+      }
+      Arr1DIdxRowM(tmp234, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp234 : 0;
     }
-    Arr1DIdxRowM(tmp234, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp234 : 0;
   }
 
   uint64_t *tmp235 =
@@ -5452,16 +6627,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp235
    * at (2635,1-2635,47) */
   uint64_t __tmp_in_tmp235;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp235;
+  if (!binary_input::readArray(
+          tmp235,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp235;
+            }
+            Arr4DIdxRowM(tmp235, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp235 : 0;
           }
-          Arr4DIdxRowM(tmp235, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp235 : 0;
         }
       }
     }
@@ -5471,48 +6651,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp236
    * at (2638,1-2638,37) */
   uint64_t __tmp_in_tmp236;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)384; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp236;
+  if (!binary_input::readArray(
+          tmp236,
+          ((int32_t)1 * (int32_t)384),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)384; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp236;
+      }
+      Arr1DIdxRowM(tmp236, (int32_t)384, i0) =
+          (party == SERVER) ? __tmp_in_tmp236 : 0;
     }
-    Arr1DIdxRowM(tmp236, (int32_t)384, i0) =
-        (party == SERVER) ? __tmp_in_tmp236 : 0;
   }
 
   uint64_t *tmp237 = make_array<uint64_t>((int32_t)384);
   /* Variable to read the clear value corresponding to the input variable tmp237
    * at (2641,1-2641,37) */
   uint64_t __tmp_in_tmp237;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)384; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp237;
+  if (!binary_input::readArray(
+          tmp237,
+          ((int32_t)1 * (int32_t)384),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)384; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp237;
+      }
+      Arr1DIdxRowM(tmp237, (int32_t)384, i0) =
+          (party == SERVER) ? __tmp_in_tmp237 : 0;
     }
-    Arr1DIdxRowM(tmp237, (int32_t)384, i0) =
-        (party == SERVER) ? __tmp_in_tmp237 : 0;
   }
 
   uint64_t *tmp238 = make_array<uint64_t>((int32_t)384);
   /* Variable to read the clear value corresponding to the input variable tmp238
    * at (2644,1-2644,37) */
   uint64_t __tmp_in_tmp238;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)384; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp238;
+  if (!binary_input::readArray(
+          tmp238,
+          ((int32_t)1 * (int32_t)384),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)384; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp238;
+      }
+      Arr1DIdxRowM(tmp238, (int32_t)384, i0) =
+          (party == SERVER) ? __tmp_in_tmp238 : 0;
     }
-    Arr1DIdxRowM(tmp238, (int32_t)384, i0) =
-        (party == SERVER) ? __tmp_in_tmp238 : 0;
   }
 
   uint64_t *tmp239 = make_array<uint64_t>((int32_t)384);
   /* Variable to read the clear value corresponding to the input variable tmp239
    * at (2647,1-2647,37) */
   uint64_t __tmp_in_tmp239;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)384; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp239;
+  if (!binary_input::readArray(
+          tmp239,
+          ((int32_t)1 * (int32_t)384),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)384; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp239;
+      }
+      Arr1DIdxRowM(tmp239, (int32_t)384, i0) =
+          (party == SERVER) ? __tmp_in_tmp239 : 0;
     }
-    Arr1DIdxRowM(tmp239, (int32_t)384, i0) =
-        (party == SERVER) ? __tmp_in_tmp239 : 0;
   }
 
   uint64_t *tmp240 =
@@ -5520,16 +6720,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp240
    * at (2650,1-2650,48) */
   uint64_t __tmp_in_tmp240;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)384; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp240;
+  if (!binary_input::readArray(
+          tmp240,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)384) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)384; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp240;
+            }
+            Arr4DIdxRowM(tmp240, (int32_t)1, (int32_t)1, (int32_t)384,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp240 : 0;
           }
-          Arr4DIdxRowM(tmp240, (int32_t)1, (int32_t)1, (int32_t)384,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp240 : 0;
         }
       }
     }
@@ -5539,48 +6744,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp241
    * at (2653,1-2653,37) */
   uint64_t __tmp_in_tmp241;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp241;
+  if (!binary_input::readArray(
+          tmp241,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp241;
+      }
+      Arr1DIdxRowM(tmp241, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp241 : 0;
     }
-    Arr1DIdxRowM(tmp241, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp241 : 0;
   }
 
   uint64_t *tmp242 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp242
    * at (2656,1-2656,37) */
   uint64_t __tmp_in_tmp242;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp242;
+  if (!binary_input::readArray(
+          tmp242,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp242;
+      }
+      Arr1DIdxRowM(tmp242, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp242 : 0;
     }
-    Arr1DIdxRowM(tmp242, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp242 : 0;
   }
 
   uint64_t *tmp243 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp243
    * at (2659,1-2659,37) */
   uint64_t __tmp_in_tmp243;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp243;
+  if (!binary_input::readArray(
+          tmp243,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp243;
+      }
+      Arr1DIdxRowM(tmp243, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp243 : 0;
     }
-    Arr1DIdxRowM(tmp243, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp243 : 0;
   }
 
   uint64_t *tmp244 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp244
    * at (2662,1-2662,37) */
   uint64_t __tmp_in_tmp244;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp244;
+  if (!binary_input::readArray(
+          tmp244,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp244;
+      }
+      Arr1DIdxRowM(tmp244, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp244 : 0;
     }
-    Arr1DIdxRowM(tmp244, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp244 : 0;
   }
 
   uint64_t *tmp245 =
@@ -5588,16 +6813,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp245
    * at (2665,1-2665,47) */
   uint64_t __tmp_in_tmp245;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp245;
+  if (!binary_input::readArray(
+          tmp245,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp245;
+            }
+            Arr4DIdxRowM(tmp245, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp245 : 0;
           }
-          Arr4DIdxRowM(tmp245, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp245 : 0;
         }
       }
     }
@@ -5607,48 +6837,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp246
    * at (2668,1-2668,37) */
   uint64_t __tmp_in_tmp246;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)416; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp246;
+  if (!binary_input::readArray(
+          tmp246,
+          ((int32_t)1 * (int32_t)416),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)416; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp246;
+      }
+      Arr1DIdxRowM(tmp246, (int32_t)416, i0) =
+          (party == SERVER) ? __tmp_in_tmp246 : 0;
     }
-    Arr1DIdxRowM(tmp246, (int32_t)416, i0) =
-        (party == SERVER) ? __tmp_in_tmp246 : 0;
   }
 
   uint64_t *tmp247 = make_array<uint64_t>((int32_t)416);
   /* Variable to read the clear value corresponding to the input variable tmp247
    * at (2671,1-2671,37) */
   uint64_t __tmp_in_tmp247;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)416; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp247;
+  if (!binary_input::readArray(
+          tmp247,
+          ((int32_t)1 * (int32_t)416),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)416; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp247;
+      }
+      Arr1DIdxRowM(tmp247, (int32_t)416, i0) =
+          (party == SERVER) ? __tmp_in_tmp247 : 0;
     }
-    Arr1DIdxRowM(tmp247, (int32_t)416, i0) =
-        (party == SERVER) ? __tmp_in_tmp247 : 0;
   }
 
   uint64_t *tmp248 = make_array<uint64_t>((int32_t)416);
   /* Variable to read the clear value corresponding to the input variable tmp248
    * at (2674,1-2674,37) */
   uint64_t __tmp_in_tmp248;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)416; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp248;
+  if (!binary_input::readArray(
+          tmp248,
+          ((int32_t)1 * (int32_t)416),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)416; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp248;
+      }
+      Arr1DIdxRowM(tmp248, (int32_t)416, i0) =
+          (party == SERVER) ? __tmp_in_tmp248 : 0;
     }
-    Arr1DIdxRowM(tmp248, (int32_t)416, i0) =
-        (party == SERVER) ? __tmp_in_tmp248 : 0;
   }
 
   uint64_t *tmp249 = make_array<uint64_t>((int32_t)416);
   /* Variable to read the clear value corresponding to the input variable tmp249
    * at (2677,1-2677,37) */
   uint64_t __tmp_in_tmp249;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)416; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp249;
+  if (!binary_input::readArray(
+          tmp249,
+          ((int32_t)1 * (int32_t)416),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)416; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp249;
+      }
+      Arr1DIdxRowM(tmp249, (int32_t)416, i0) =
+          (party == SERVER) ? __tmp_in_tmp249 : 0;
     }
-    Arr1DIdxRowM(tmp249, (int32_t)416, i0) =
-        (party == SERVER) ? __tmp_in_tmp249 : 0;
   }
 
   uint64_t *tmp250 =
@@ -5656,16 +6906,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp250
    * at (2680,1-2680,48) */
   uint64_t __tmp_in_tmp250;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)416; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp250;
+  if (!binary_input::readArray(
+          tmp250,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)416) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)416; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp250;
+            }
+            Arr4DIdxRowM(tmp250, (int32_t)1, (int32_t)1, (int32_t)416,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp250 : 0;
           }
-          Arr4DIdxRowM(tmp250, (int32_t)1, (int32_t)1, (int32_t)416,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp250 : 0;
         }
       }
     }
@@ -5675,48 +6930,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp251
    * at (2683,1-2683,37) */
   uint64_t __tmp_in_tmp251;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp251;
+  if (!binary_input::readArray(
+          tmp251,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp251;
+      }
+      Arr1DIdxRowM(tmp251, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp251 : 0;
     }
-    Arr1DIdxRowM(tmp251, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp251 : 0;
   }
 
   uint64_t *tmp252 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp252
    * at (2686,1-2686,37) */
   uint64_t __tmp_in_tmp252;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp252;
+  if (!binary_input::readArray(
+          tmp252,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp252;
+      }
+      Arr1DIdxRowM(tmp252, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp252 : 0;
     }
-    Arr1DIdxRowM(tmp252, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp252 : 0;
   }
 
   uint64_t *tmp253 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp253
    * at (2689,1-2689,37) */
   uint64_t __tmp_in_tmp253;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp253;
+  if (!binary_input::readArray(
+          tmp253,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp253;
+      }
+      Arr1DIdxRowM(tmp253, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp253 : 0;
     }
-    Arr1DIdxRowM(tmp253, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp253 : 0;
   }
 
   uint64_t *tmp254 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp254
    * at (2692,1-2692,37) */
   uint64_t __tmp_in_tmp254;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp254;
+  if (!binary_input::readArray(
+          tmp254,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp254;
+      }
+      Arr1DIdxRowM(tmp254, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp254 : 0;
     }
-    Arr1DIdxRowM(tmp254, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp254 : 0;
   }
 
   uint64_t *tmp255 =
@@ -5724,16 +6999,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp255
    * at (2695,1-2695,47) */
   uint64_t __tmp_in_tmp255;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp255;
+  if (!binary_input::readArray(
+          tmp255,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp255;
+            }
+            Arr4DIdxRowM(tmp255, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp255 : 0;
           }
-          Arr4DIdxRowM(tmp255, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp255 : 0;
         }
       }
     }
@@ -5743,48 +7023,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp256
    * at (2698,1-2698,37) */
   uint64_t __tmp_in_tmp256;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)448; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp256;
+  if (!binary_input::readArray(
+          tmp256,
+          ((int32_t)1 * (int32_t)448),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)448; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp256;
+      }
+      Arr1DIdxRowM(tmp256, (int32_t)448, i0) =
+          (party == SERVER) ? __tmp_in_tmp256 : 0;
     }
-    Arr1DIdxRowM(tmp256, (int32_t)448, i0) =
-        (party == SERVER) ? __tmp_in_tmp256 : 0;
   }
 
   uint64_t *tmp257 = make_array<uint64_t>((int32_t)448);
   /* Variable to read the clear value corresponding to the input variable tmp257
    * at (2701,1-2701,37) */
   uint64_t __tmp_in_tmp257;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)448; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp257;
+  if (!binary_input::readArray(
+          tmp257,
+          ((int32_t)1 * (int32_t)448),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)448; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp257;
+      }
+      Arr1DIdxRowM(tmp257, (int32_t)448, i0) =
+          (party == SERVER) ? __tmp_in_tmp257 : 0;
     }
-    Arr1DIdxRowM(tmp257, (int32_t)448, i0) =
-        (party == SERVER) ? __tmp_in_tmp257 : 0;
   }
 
   uint64_t *tmp258 = make_array<uint64_t>((int32_t)448);
   /* Variable to read the clear value corresponding to the input variable tmp258
    * at (2704,1-2704,37) */
   uint64_t __tmp_in_tmp258;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)448; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp258;
+  if (!binary_input::readArray(
+          tmp258,
+          ((int32_t)1 * (int32_t)448),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)448; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp258;
+      }
+      Arr1DIdxRowM(tmp258, (int32_t)448, i0) =
+          (party == SERVER) ? __tmp_in_tmp258 : 0;
     }
-    Arr1DIdxRowM(tmp258, (int32_t)448, i0) =
-        (party == SERVER) ? __tmp_in_tmp258 : 0;
   }
 
   uint64_t *tmp259 = make_array<uint64_t>((int32_t)448);
   /* Variable to read the clear value corresponding to the input variable tmp259
    * at (2707,1-2707,37) */
   uint64_t __tmp_in_tmp259;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)448; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp259;
+  if (!binary_input::readArray(
+          tmp259,
+          ((int32_t)1 * (int32_t)448),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)448; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp259;
+      }
+      Arr1DIdxRowM(tmp259, (int32_t)448, i0) =
+          (party == SERVER) ? __tmp_in_tmp259 : 0;
     }
-    Arr1DIdxRowM(tmp259, (int32_t)448, i0) =
-        (party == SERVER) ? __tmp_in_tmp259 : 0;
   }
 
   uint64_t *tmp260 =
@@ -5792,16 +7092,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp260
    * at (2710,1-2710,48) */
   uint64_t __tmp_in_tmp260;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)448; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp260;
+  if (!binary_input::readArray(
+          tmp260,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)448) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)448; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp260;
+            }
+            Arr4DIdxRowM(tmp260, (int32_t)1, (int32_t)1, (int32_t)448,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp260 : 0;
           }
-          Arr4DIdxRowM(tmp260, (int32_t)1, (int32_t)1, (int32_t)448,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp260 : 0;
         }
       }
     }
@@ -5811,48 +7116,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp261
    * at (2713,1-2713,37) */
   uint64_t __tmp_in_tmp261;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp261;
+  if (!binary_input::readArray(
+          tmp261,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp261;
+      }
+      Arr1DIdxRowM(tmp261, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp261 : 0;
     }
-    Arr1DIdxRowM(tmp261, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp261 : 0;
   }
 
   uint64_t *tmp262 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp262
    * at (2716,1-2716,37) */
   uint64_t __tmp_in_tmp262;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp262;
+  if (!binary_input::readArray(
+          tmp262,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp262;
+      }
+      Arr1DIdxRowM(tmp262, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp262 : 0;
     }
-    Arr1DIdxRowM(tmp262, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp262 : 0;
   }
 
   uint64_t *tmp263 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp263
    * at (2719,1-2719,37) */
   uint64_t __tmp_in_tmp263;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp263;
+  if (!binary_input::readArray(
+          tmp263,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp263;
+      }
+      Arr1DIdxRowM(tmp263, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp263 : 0;
     }
-    Arr1DIdxRowM(tmp263, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp263 : 0;
   }
 
   uint64_t *tmp264 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp264
    * at (2722,1-2722,37) */
   uint64_t __tmp_in_tmp264;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp264;
+  if (!binary_input::readArray(
+          tmp264,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp264;
+      }
+      Arr1DIdxRowM(tmp264, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp264 : 0;
     }
-    Arr1DIdxRowM(tmp264, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp264 : 0;
   }
 
   uint64_t *tmp265 =
@@ -5860,16 +7185,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp265
    * at (2725,1-2725,47) */
   uint64_t __tmp_in_tmp265;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp265;
+  if (!binary_input::readArray(
+          tmp265,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp265;
+            }
+            Arr4DIdxRowM(tmp265, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp265 : 0;
           }
-          Arr4DIdxRowM(tmp265, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp265 : 0;
         }
       }
     }
@@ -5879,48 +7209,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp266
    * at (2728,1-2728,37) */
   uint64_t __tmp_in_tmp266;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)480; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp266;
+  if (!binary_input::readArray(
+          tmp266,
+          ((int32_t)1 * (int32_t)480),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)480; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp266;
+      }
+      Arr1DIdxRowM(tmp266, (int32_t)480, i0) =
+          (party == SERVER) ? __tmp_in_tmp266 : 0;
     }
-    Arr1DIdxRowM(tmp266, (int32_t)480, i0) =
-        (party == SERVER) ? __tmp_in_tmp266 : 0;
   }
 
   uint64_t *tmp267 = make_array<uint64_t>((int32_t)480);
   /* Variable to read the clear value corresponding to the input variable tmp267
    * at (2731,1-2731,37) */
   uint64_t __tmp_in_tmp267;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)480; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp267;
+  if (!binary_input::readArray(
+          tmp267,
+          ((int32_t)1 * (int32_t)480),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)480; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp267;
+      }
+      Arr1DIdxRowM(tmp267, (int32_t)480, i0) =
+          (party == SERVER) ? __tmp_in_tmp267 : 0;
     }
-    Arr1DIdxRowM(tmp267, (int32_t)480, i0) =
-        (party == SERVER) ? __tmp_in_tmp267 : 0;
   }
 
   uint64_t *tmp268 = make_array<uint64_t>((int32_t)480);
   /* Variable to read the clear value corresponding to the input variable tmp268
    * at (2734,1-2734,37) */
   uint64_t __tmp_in_tmp268;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)480; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp268;
+  if (!binary_input::readArray(
+          tmp268,
+          ((int32_t)1 * (int32_t)480),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)480; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp268;
+      }
+      Arr1DIdxRowM(tmp268, (int32_t)480, i0) =
+          (party == SERVER) ? __tmp_in_tmp268 : 0;
     }
-    Arr1DIdxRowM(tmp268, (int32_t)480, i0) =
-        (party == SERVER) ? __tmp_in_tmp268 : 0;
   }
 
   uint64_t *tmp269 = make_array<uint64_t>((int32_t)480);
   /* Variable to read the clear value corresponding to the input variable tmp269
    * at (2737,1-2737,37) */
   uint64_t __tmp_in_tmp269;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)480; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp269;
+  if (!binary_input::readArray(
+          tmp269,
+          ((int32_t)1 * (int32_t)480),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)480; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp269;
+      }
+      Arr1DIdxRowM(tmp269, (int32_t)480, i0) =
+          (party == SERVER) ? __tmp_in_tmp269 : 0;
     }
-    Arr1DIdxRowM(tmp269, (int32_t)480, i0) =
-        (party == SERVER) ? __tmp_in_tmp269 : 0;
   }
 
   uint64_t *tmp270 =
@@ -5928,16 +7278,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp270
    * at (2740,1-2740,48) */
   uint64_t __tmp_in_tmp270;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)480; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp270;
+  if (!binary_input::readArray(
+          tmp270,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)480) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)480; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp270;
+            }
+            Arr4DIdxRowM(tmp270, (int32_t)1, (int32_t)1, (int32_t)480,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp270 : 0;
           }
-          Arr4DIdxRowM(tmp270, (int32_t)1, (int32_t)1, (int32_t)480,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp270 : 0;
         }
       }
     }
@@ -5947,48 +7302,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp271
    * at (2743,1-2743,37) */
   uint64_t __tmp_in_tmp271;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp271;
+  if (!binary_input::readArray(
+          tmp271,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp271;
+      }
+      Arr1DIdxRowM(tmp271, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp271 : 0;
     }
-    Arr1DIdxRowM(tmp271, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp271 : 0;
   }
 
   uint64_t *tmp272 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp272
    * at (2746,1-2746,37) */
   uint64_t __tmp_in_tmp272;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp272;
+  if (!binary_input::readArray(
+          tmp272,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp272;
+      }
+      Arr1DIdxRowM(tmp272, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp272 : 0;
     }
-    Arr1DIdxRowM(tmp272, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp272 : 0;
   }
 
   uint64_t *tmp273 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp273
    * at (2749,1-2749,37) */
   uint64_t __tmp_in_tmp273;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp273;
+  if (!binary_input::readArray(
+          tmp273,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp273;
+      }
+      Arr1DIdxRowM(tmp273, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp273 : 0;
     }
-    Arr1DIdxRowM(tmp273, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp273 : 0;
   }
 
   uint64_t *tmp274 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp274
    * at (2752,1-2752,37) */
   uint64_t __tmp_in_tmp274;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp274;
+  if (!binary_input::readArray(
+          tmp274,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp274;
+      }
+      Arr1DIdxRowM(tmp274, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp274 : 0;
     }
-    Arr1DIdxRowM(tmp274, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp274 : 0;
   }
 
   uint64_t *tmp275 =
@@ -5996,16 +7371,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp275
    * at (2755,1-2755,47) */
   uint64_t __tmp_in_tmp275;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp275;
+  if (!binary_input::readArray(
+          tmp275,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp275;
+            }
+            Arr4DIdxRowM(tmp275, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp275 : 0;
           }
-          Arr4DIdxRowM(tmp275, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp275 : 0;
         }
       }
     }
@@ -6015,48 +7395,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp276
    * at (2758,1-2758,37) */
   uint64_t __tmp_in_tmp276;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp276;
+  if (!binary_input::readArray(
+          tmp276,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp276;
+      }
+      Arr1DIdxRowM(tmp276, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp276 : 0;
     }
-    Arr1DIdxRowM(tmp276, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp276 : 0;
   }
 
   uint64_t *tmp277 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp277
    * at (2761,1-2761,37) */
   uint64_t __tmp_in_tmp277;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp277;
+  if (!binary_input::readArray(
+          tmp277,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp277;
+      }
+      Arr1DIdxRowM(tmp277, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp277 : 0;
     }
-    Arr1DIdxRowM(tmp277, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp277 : 0;
   }
 
   uint64_t *tmp278 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp278
    * at (2764,1-2764,37) */
   uint64_t __tmp_in_tmp278;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp278;
+  if (!binary_input::readArray(
+          tmp278,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp278;
+      }
+      Arr1DIdxRowM(tmp278, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp278 : 0;
     }
-    Arr1DIdxRowM(tmp278, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp278 : 0;
   }
 
   uint64_t *tmp279 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp279
    * at (2767,1-2767,37) */
   uint64_t __tmp_in_tmp279;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp279;
+  if (!binary_input::readArray(
+          tmp279,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp279;
+      }
+      Arr1DIdxRowM(tmp279, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp279 : 0;
     }
-    Arr1DIdxRowM(tmp279, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp279 : 0;
   }
 
   uint64_t *tmp280 =
@@ -6064,16 +7464,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp280
    * at (2770,1-2770,48) */
   uint64_t __tmp_in_tmp280;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp280;
+  if (!binary_input::readArray(
+          tmp280,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)512) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp280;
+            }
+            Arr4DIdxRowM(tmp280, (int32_t)1, (int32_t)1, (int32_t)512,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp280 : 0;
           }
-          Arr4DIdxRowM(tmp280, (int32_t)1, (int32_t)1, (int32_t)512,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp280 : 0;
         }
       }
     }
@@ -6083,48 +7488,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp281
    * at (2773,1-2773,37) */
   uint64_t __tmp_in_tmp281;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp281;
+  if (!binary_input::readArray(
+          tmp281,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp281;
+      }
+      Arr1DIdxRowM(tmp281, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp281 : 0;
     }
-    Arr1DIdxRowM(tmp281, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp281 : 0;
   }
 
   uint64_t *tmp282 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp282
    * at (2776,1-2776,37) */
   uint64_t __tmp_in_tmp282;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp282;
+  if (!binary_input::readArray(
+          tmp282,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp282;
+      }
+      Arr1DIdxRowM(tmp282, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp282 : 0;
     }
-    Arr1DIdxRowM(tmp282, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp282 : 0;
   }
 
   uint64_t *tmp283 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp283
    * at (2779,1-2779,37) */
   uint64_t __tmp_in_tmp283;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp283;
+  if (!binary_input::readArray(
+          tmp283,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp283;
+      }
+      Arr1DIdxRowM(tmp283, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp283 : 0;
     }
-    Arr1DIdxRowM(tmp283, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp283 : 0;
   }
 
   uint64_t *tmp284 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp284
    * at (2782,1-2782,37) */
   uint64_t __tmp_in_tmp284;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp284;
+  if (!binary_input::readArray(
+          tmp284,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp284;
+      }
+      Arr1DIdxRowM(tmp284, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp284 : 0;
     }
-    Arr1DIdxRowM(tmp284, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp284 : 0;
   }
 
   uint64_t *tmp285 =
@@ -6132,16 +7557,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp285
    * at (2785,1-2785,47) */
   uint64_t __tmp_in_tmp285;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp285;
+  if (!binary_input::readArray(
+          tmp285,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp285;
+            }
+            Arr4DIdxRowM(tmp285, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp285 : 0;
           }
-          Arr4DIdxRowM(tmp285, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp285 : 0;
         }
       }
     }
@@ -6151,48 +7581,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp286
    * at (2788,1-2788,37) */
   uint64_t __tmp_in_tmp286;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)544; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp286;
+  if (!binary_input::readArray(
+          tmp286,
+          ((int32_t)1 * (int32_t)544),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)544; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp286;
+      }
+      Arr1DIdxRowM(tmp286, (int32_t)544, i0) =
+          (party == SERVER) ? __tmp_in_tmp286 : 0;
     }
-    Arr1DIdxRowM(tmp286, (int32_t)544, i0) =
-        (party == SERVER) ? __tmp_in_tmp286 : 0;
   }
 
   uint64_t *tmp287 = make_array<uint64_t>((int32_t)544);
   /* Variable to read the clear value corresponding to the input variable tmp287
    * at (2791,1-2791,37) */
   uint64_t __tmp_in_tmp287;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)544; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp287;
+  if (!binary_input::readArray(
+          tmp287,
+          ((int32_t)1 * (int32_t)544),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)544; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp287;
+      }
+      Arr1DIdxRowM(tmp287, (int32_t)544, i0) =
+          (party == SERVER) ? __tmp_in_tmp287 : 0;
     }
-    Arr1DIdxRowM(tmp287, (int32_t)544, i0) =
-        (party == SERVER) ? __tmp_in_tmp287 : 0;
   }
 
   uint64_t *tmp288 = make_array<uint64_t>((int32_t)544);
   /* Variable to read the clear value corresponding to the input variable tmp288
    * at (2794,1-2794,37) */
   uint64_t __tmp_in_tmp288;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)544; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp288;
+  if (!binary_input::readArray(
+          tmp288,
+          ((int32_t)1 * (int32_t)544),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)544; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp288;
+      }
+      Arr1DIdxRowM(tmp288, (int32_t)544, i0) =
+          (party == SERVER) ? __tmp_in_tmp288 : 0;
     }
-    Arr1DIdxRowM(tmp288, (int32_t)544, i0) =
-        (party == SERVER) ? __tmp_in_tmp288 : 0;
   }
 
   uint64_t *tmp289 = make_array<uint64_t>((int32_t)544);
   /* Variable to read the clear value corresponding to the input variable tmp289
    * at (2797,1-2797,37) */
   uint64_t __tmp_in_tmp289;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)544; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp289;
+  if (!binary_input::readArray(
+          tmp289,
+          ((int32_t)1 * (int32_t)544),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)544; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp289;
+      }
+      Arr1DIdxRowM(tmp289, (int32_t)544, i0) =
+          (party == SERVER) ? __tmp_in_tmp289 : 0;
     }
-    Arr1DIdxRowM(tmp289, (int32_t)544, i0) =
-        (party == SERVER) ? __tmp_in_tmp289 : 0;
   }
 
   uint64_t *tmp290 =
@@ -6200,16 +7650,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp290
    * at (2800,1-2800,48) */
   uint64_t __tmp_in_tmp290;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)544; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp290;
+  if (!binary_input::readArray(
+          tmp290,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)544) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)544; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp290;
+            }
+            Arr4DIdxRowM(tmp290, (int32_t)1, (int32_t)1, (int32_t)544,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp290 : 0;
           }
-          Arr4DIdxRowM(tmp290, (int32_t)1, (int32_t)1, (int32_t)544,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp290 : 0;
         }
       }
     }
@@ -6219,48 +7674,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp291
    * at (2803,1-2803,37) */
   uint64_t __tmp_in_tmp291;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp291;
+  if (!binary_input::readArray(
+          tmp291,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp291;
+      }
+      Arr1DIdxRowM(tmp291, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp291 : 0;
     }
-    Arr1DIdxRowM(tmp291, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp291 : 0;
   }
 
   uint64_t *tmp292 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp292
    * at (2806,1-2806,37) */
   uint64_t __tmp_in_tmp292;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp292;
+  if (!binary_input::readArray(
+          tmp292,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp292;
+      }
+      Arr1DIdxRowM(tmp292, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp292 : 0;
     }
-    Arr1DIdxRowM(tmp292, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp292 : 0;
   }
 
   uint64_t *tmp293 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp293
    * at (2809,1-2809,37) */
   uint64_t __tmp_in_tmp293;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp293;
+  if (!binary_input::readArray(
+          tmp293,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp293;
+      }
+      Arr1DIdxRowM(tmp293, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp293 : 0;
     }
-    Arr1DIdxRowM(tmp293, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp293 : 0;
   }
 
   uint64_t *tmp294 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp294
    * at (2812,1-2812,37) */
   uint64_t __tmp_in_tmp294;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp294;
+  if (!binary_input::readArray(
+          tmp294,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp294;
+      }
+      Arr1DIdxRowM(tmp294, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp294 : 0;
     }
-    Arr1DIdxRowM(tmp294, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp294 : 0;
   }
 
   uint64_t *tmp295 =
@@ -6268,16 +7743,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp295
    * at (2815,1-2815,47) */
   uint64_t __tmp_in_tmp295;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp295;
+  if (!binary_input::readArray(
+          tmp295,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp295;
+            }
+            Arr4DIdxRowM(tmp295, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp295 : 0;
           }
-          Arr4DIdxRowM(tmp295, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp295 : 0;
         }
       }
     }
@@ -6287,48 +7767,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp296
    * at (2818,1-2818,37) */
   uint64_t __tmp_in_tmp296;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)576; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp296;
+  if (!binary_input::readArray(
+          tmp296,
+          ((int32_t)1 * (int32_t)576),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)576; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp296;
+      }
+      Arr1DIdxRowM(tmp296, (int32_t)576, i0) =
+          (party == SERVER) ? __tmp_in_tmp296 : 0;
     }
-    Arr1DIdxRowM(tmp296, (int32_t)576, i0) =
-        (party == SERVER) ? __tmp_in_tmp296 : 0;
   }
 
   uint64_t *tmp297 = make_array<uint64_t>((int32_t)576);
   /* Variable to read the clear value corresponding to the input variable tmp297
    * at (2821,1-2821,37) */
   uint64_t __tmp_in_tmp297;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)576; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp297;
+  if (!binary_input::readArray(
+          tmp297,
+          ((int32_t)1 * (int32_t)576),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)576; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp297;
+      }
+      Arr1DIdxRowM(tmp297, (int32_t)576, i0) =
+          (party == SERVER) ? __tmp_in_tmp297 : 0;
     }
-    Arr1DIdxRowM(tmp297, (int32_t)576, i0) =
-        (party == SERVER) ? __tmp_in_tmp297 : 0;
   }
 
   uint64_t *tmp298 = make_array<uint64_t>((int32_t)576);
   /* Variable to read the clear value corresponding to the input variable tmp298
    * at (2824,1-2824,37) */
   uint64_t __tmp_in_tmp298;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)576; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp298;
+  if (!binary_input::readArray(
+          tmp298,
+          ((int32_t)1 * (int32_t)576),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)576; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp298;
+      }
+      Arr1DIdxRowM(tmp298, (int32_t)576, i0) =
+          (party == SERVER) ? __tmp_in_tmp298 : 0;
     }
-    Arr1DIdxRowM(tmp298, (int32_t)576, i0) =
-        (party == SERVER) ? __tmp_in_tmp298 : 0;
   }
 
   uint64_t *tmp299 = make_array<uint64_t>((int32_t)576);
   /* Variable to read the clear value corresponding to the input variable tmp299
    * at (2827,1-2827,37) */
   uint64_t __tmp_in_tmp299;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)576; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp299;
+  if (!binary_input::readArray(
+          tmp299,
+          ((int32_t)1 * (int32_t)576),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)576; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp299;
+      }
+      Arr1DIdxRowM(tmp299, (int32_t)576, i0) =
+          (party == SERVER) ? __tmp_in_tmp299 : 0;
     }
-    Arr1DIdxRowM(tmp299, (int32_t)576, i0) =
-        (party == SERVER) ? __tmp_in_tmp299 : 0;
   }
 
   uint64_t *tmp300 =
@@ -6336,16 +7836,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp300
    * at (2830,1-2830,48) */
   uint64_t __tmp_in_tmp300;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)576; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp300;
+  if (!binary_input::readArray(
+          tmp300,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)576) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)576; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp300;
+            }
+            Arr4DIdxRowM(tmp300, (int32_t)1, (int32_t)1, (int32_t)576,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp300 : 0;
           }
-          Arr4DIdxRowM(tmp300, (int32_t)1, (int32_t)1, (int32_t)576,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp300 : 0;
         }
       }
     }
@@ -6355,48 +7860,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp301
    * at (2833,1-2833,37) */
   uint64_t __tmp_in_tmp301;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp301;
+  if (!binary_input::readArray(
+          tmp301,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp301;
+      }
+      Arr1DIdxRowM(tmp301, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp301 : 0;
     }
-    Arr1DIdxRowM(tmp301, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp301 : 0;
   }
 
   uint64_t *tmp302 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp302
    * at (2836,1-2836,37) */
   uint64_t __tmp_in_tmp302;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp302;
+  if (!binary_input::readArray(
+          tmp302,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp302;
+      }
+      Arr1DIdxRowM(tmp302, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp302 : 0;
     }
-    Arr1DIdxRowM(tmp302, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp302 : 0;
   }
 
   uint64_t *tmp303 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp303
    * at (2839,1-2839,37) */
   uint64_t __tmp_in_tmp303;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp303;
+  if (!binary_input::readArray(
+          tmp303,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp303;
+      }
+      Arr1DIdxRowM(tmp303, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp303 : 0;
     }
-    Arr1DIdxRowM(tmp303, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp303 : 0;
   }
 
   uint64_t *tmp304 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp304
    * at (2842,1-2842,37) */
   uint64_t __tmp_in_tmp304;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp304;
+  if (!binary_input::readArray(
+          tmp304,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp304;
+      }
+      Arr1DIdxRowM(tmp304, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp304 : 0;
     }
-    Arr1DIdxRowM(tmp304, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp304 : 0;
   }
 
   uint64_t *tmp305 =
@@ -6404,16 +7929,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp305
    * at (2845,1-2845,47) */
   uint64_t __tmp_in_tmp305;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp305;
+  if (!binary_input::readArray(
+          tmp305,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp305;
+            }
+            Arr4DIdxRowM(tmp305, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp305 : 0;
           }
-          Arr4DIdxRowM(tmp305, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp305 : 0;
         }
       }
     }
@@ -6423,48 +7953,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp306
    * at (2848,1-2848,37) */
   uint64_t __tmp_in_tmp306;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)608; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp306;
+  if (!binary_input::readArray(
+          tmp306,
+          ((int32_t)1 * (int32_t)608),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)608; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp306;
+      }
+      Arr1DIdxRowM(tmp306, (int32_t)608, i0) =
+          (party == SERVER) ? __tmp_in_tmp306 : 0;
     }
-    Arr1DIdxRowM(tmp306, (int32_t)608, i0) =
-        (party == SERVER) ? __tmp_in_tmp306 : 0;
   }
 
   uint64_t *tmp307 = make_array<uint64_t>((int32_t)608);
   /* Variable to read the clear value corresponding to the input variable tmp307
    * at (2851,1-2851,37) */
   uint64_t __tmp_in_tmp307;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)608; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp307;
+  if (!binary_input::readArray(
+          tmp307,
+          ((int32_t)1 * (int32_t)608),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)608; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp307;
+      }
+      Arr1DIdxRowM(tmp307, (int32_t)608, i0) =
+          (party == SERVER) ? __tmp_in_tmp307 : 0;
     }
-    Arr1DIdxRowM(tmp307, (int32_t)608, i0) =
-        (party == SERVER) ? __tmp_in_tmp307 : 0;
   }
 
   uint64_t *tmp308 = make_array<uint64_t>((int32_t)608);
   /* Variable to read the clear value corresponding to the input variable tmp308
    * at (2854,1-2854,37) */
   uint64_t __tmp_in_tmp308;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)608; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp308;
+  if (!binary_input::readArray(
+          tmp308,
+          ((int32_t)1 * (int32_t)608),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)608; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp308;
+      }
+      Arr1DIdxRowM(tmp308, (int32_t)608, i0) =
+          (party == SERVER) ? __tmp_in_tmp308 : 0;
     }
-    Arr1DIdxRowM(tmp308, (int32_t)608, i0) =
-        (party == SERVER) ? __tmp_in_tmp308 : 0;
   }
 
   uint64_t *tmp309 = make_array<uint64_t>((int32_t)608);
   /* Variable to read the clear value corresponding to the input variable tmp309
    * at (2857,1-2857,37) */
   uint64_t __tmp_in_tmp309;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)608; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp309;
+  if (!binary_input::readArray(
+          tmp309,
+          ((int32_t)1 * (int32_t)608),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)608; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp309;
+      }
+      Arr1DIdxRowM(tmp309, (int32_t)608, i0) =
+          (party == SERVER) ? __tmp_in_tmp309 : 0;
     }
-    Arr1DIdxRowM(tmp309, (int32_t)608, i0) =
-        (party == SERVER) ? __tmp_in_tmp309 : 0;
   }
 
   uint64_t *tmp310 =
@@ -6472,16 +8022,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp310
    * at (2860,1-2860,48) */
   uint64_t __tmp_in_tmp310;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)608; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp310;
+  if (!binary_input::readArray(
+          tmp310,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)608) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)608; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp310;
+            }
+            Arr4DIdxRowM(tmp310, (int32_t)1, (int32_t)1, (int32_t)608,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp310 : 0;
           }
-          Arr4DIdxRowM(tmp310, (int32_t)1, (int32_t)1, (int32_t)608,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp310 : 0;
         }
       }
     }
@@ -6491,48 +8046,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp311
    * at (2863,1-2863,37) */
   uint64_t __tmp_in_tmp311;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp311;
+  if (!binary_input::readArray(
+          tmp311,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp311;
+      }
+      Arr1DIdxRowM(tmp311, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp311 : 0;
     }
-    Arr1DIdxRowM(tmp311, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp311 : 0;
   }
 
   uint64_t *tmp312 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp312
    * at (2866,1-2866,37) */
   uint64_t __tmp_in_tmp312;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp312;
+  if (!binary_input::readArray(
+          tmp312,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp312;
+      }
+      Arr1DIdxRowM(tmp312, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp312 : 0;
     }
-    Arr1DIdxRowM(tmp312, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp312 : 0;
   }
 
   uint64_t *tmp313 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp313
    * at (2869,1-2869,37) */
   uint64_t __tmp_in_tmp313;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp313;
+  if (!binary_input::readArray(
+          tmp313,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp313;
+      }
+      Arr1DIdxRowM(tmp313, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp313 : 0;
     }
-    Arr1DIdxRowM(tmp313, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp313 : 0;
   }
 
   uint64_t *tmp314 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp314
    * at (2872,1-2872,37) */
   uint64_t __tmp_in_tmp314;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp314;
+  if (!binary_input::readArray(
+          tmp314,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp314;
+      }
+      Arr1DIdxRowM(tmp314, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp314 : 0;
     }
-    Arr1DIdxRowM(tmp314, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp314 : 0;
   }
 
   uint64_t *tmp315 =
@@ -6540,16 +8115,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp315
    * at (2875,1-2875,47) */
   uint64_t __tmp_in_tmp315;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp315;
+  if (!binary_input::readArray(
+          tmp315,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp315;
+            }
+            Arr4DIdxRowM(tmp315, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp315 : 0;
           }
-          Arr4DIdxRowM(tmp315, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp315 : 0;
         }
       }
     }
@@ -6559,48 +8139,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp316
    * at (2878,1-2878,37) */
   uint64_t __tmp_in_tmp316;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)640; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp316;
+  if (!binary_input::readArray(
+          tmp316,
+          ((int32_t)1 * (int32_t)640),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)640; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp316;
+      }
+      Arr1DIdxRowM(tmp316, (int32_t)640, i0) =
+          (party == SERVER) ? __tmp_in_tmp316 : 0;
     }
-    Arr1DIdxRowM(tmp316, (int32_t)640, i0) =
-        (party == SERVER) ? __tmp_in_tmp316 : 0;
   }
 
   uint64_t *tmp317 = make_array<uint64_t>((int32_t)640);
   /* Variable to read the clear value corresponding to the input variable tmp317
    * at (2881,1-2881,37) */
   uint64_t __tmp_in_tmp317;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)640; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp317;
+  if (!binary_input::readArray(
+          tmp317,
+          ((int32_t)1 * (int32_t)640),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)640; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp317;
+      }
+      Arr1DIdxRowM(tmp317, (int32_t)640, i0) =
+          (party == SERVER) ? __tmp_in_tmp317 : 0;
     }
-    Arr1DIdxRowM(tmp317, (int32_t)640, i0) =
-        (party == SERVER) ? __tmp_in_tmp317 : 0;
   }
 
   uint64_t *tmp318 = make_array<uint64_t>((int32_t)640);
   /* Variable to read the clear value corresponding to the input variable tmp318
    * at (2884,1-2884,37) */
   uint64_t __tmp_in_tmp318;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)640; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp318;
+  if (!binary_input::readArray(
+          tmp318,
+          ((int32_t)1 * (int32_t)640),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)640; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp318;
+      }
+      Arr1DIdxRowM(tmp318, (int32_t)640, i0) =
+          (party == SERVER) ? __tmp_in_tmp318 : 0;
     }
-    Arr1DIdxRowM(tmp318, (int32_t)640, i0) =
-        (party == SERVER) ? __tmp_in_tmp318 : 0;
   }
 
   uint64_t *tmp319 = make_array<uint64_t>((int32_t)640);
   /* Variable to read the clear value corresponding to the input variable tmp319
    * at (2887,1-2887,37) */
   uint64_t __tmp_in_tmp319;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)640; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp319;
+  if (!binary_input::readArray(
+          tmp319,
+          ((int32_t)1 * (int32_t)640),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)640; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp319;
+      }
+      Arr1DIdxRowM(tmp319, (int32_t)640, i0) =
+          (party == SERVER) ? __tmp_in_tmp319 : 0;
     }
-    Arr1DIdxRowM(tmp319, (int32_t)640, i0) =
-        (party == SERVER) ? __tmp_in_tmp319 : 0;
   }
 
   uint64_t *tmp320 =
@@ -6608,16 +8208,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp320
    * at (2890,1-2890,48) */
   uint64_t __tmp_in_tmp320;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)640; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp320;
+  if (!binary_input::readArray(
+          tmp320,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)640) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)640; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp320;
+            }
+            Arr4DIdxRowM(tmp320, (int32_t)1, (int32_t)1, (int32_t)640,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp320 : 0;
           }
-          Arr4DIdxRowM(tmp320, (int32_t)1, (int32_t)1, (int32_t)640,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp320 : 0;
         }
       }
     }
@@ -6627,48 +8232,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp321
    * at (2893,1-2893,37) */
   uint64_t __tmp_in_tmp321;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp321;
+  if (!binary_input::readArray(
+          tmp321,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp321;
+      }
+      Arr1DIdxRowM(tmp321, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp321 : 0;
     }
-    Arr1DIdxRowM(tmp321, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp321 : 0;
   }
 
   uint64_t *tmp322 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp322
    * at (2896,1-2896,37) */
   uint64_t __tmp_in_tmp322;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp322;
+  if (!binary_input::readArray(
+          tmp322,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp322;
+      }
+      Arr1DIdxRowM(tmp322, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp322 : 0;
     }
-    Arr1DIdxRowM(tmp322, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp322 : 0;
   }
 
   uint64_t *tmp323 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp323
    * at (2899,1-2899,37) */
   uint64_t __tmp_in_tmp323;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp323;
+  if (!binary_input::readArray(
+          tmp323,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp323;
+      }
+      Arr1DIdxRowM(tmp323, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp323 : 0;
     }
-    Arr1DIdxRowM(tmp323, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp323 : 0;
   }
 
   uint64_t *tmp324 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp324
    * at (2902,1-2902,37) */
   uint64_t __tmp_in_tmp324;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp324;
+  if (!binary_input::readArray(
+          tmp324,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp324;
+      }
+      Arr1DIdxRowM(tmp324, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp324 : 0;
     }
-    Arr1DIdxRowM(tmp324, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp324 : 0;
   }
 
   uint64_t *tmp325 =
@@ -6676,16 +8301,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp325
    * at (2905,1-2905,47) */
   uint64_t __tmp_in_tmp325;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp325;
+  if (!binary_input::readArray(
+          tmp325,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp325;
+            }
+            Arr4DIdxRowM(tmp325, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp325 : 0;
           }
-          Arr4DIdxRowM(tmp325, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp325 : 0;
         }
       }
     }
@@ -6695,48 +8325,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp326
    * at (2908,1-2908,37) */
   uint64_t __tmp_in_tmp326;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)672; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp326;
+  if (!binary_input::readArray(
+          tmp326,
+          ((int32_t)1 * (int32_t)672),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)672; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp326;
+      }
+      Arr1DIdxRowM(tmp326, (int32_t)672, i0) =
+          (party == SERVER) ? __tmp_in_tmp326 : 0;
     }
-    Arr1DIdxRowM(tmp326, (int32_t)672, i0) =
-        (party == SERVER) ? __tmp_in_tmp326 : 0;
   }
 
   uint64_t *tmp327 = make_array<uint64_t>((int32_t)672);
   /* Variable to read the clear value corresponding to the input variable tmp327
    * at (2911,1-2911,37) */
   uint64_t __tmp_in_tmp327;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)672; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp327;
+  if (!binary_input::readArray(
+          tmp327,
+          ((int32_t)1 * (int32_t)672),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)672; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp327;
+      }
+      Arr1DIdxRowM(tmp327, (int32_t)672, i0) =
+          (party == SERVER) ? __tmp_in_tmp327 : 0;
     }
-    Arr1DIdxRowM(tmp327, (int32_t)672, i0) =
-        (party == SERVER) ? __tmp_in_tmp327 : 0;
   }
 
   uint64_t *tmp328 = make_array<uint64_t>((int32_t)672);
   /* Variable to read the clear value corresponding to the input variable tmp328
    * at (2914,1-2914,37) */
   uint64_t __tmp_in_tmp328;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)672; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp328;
+  if (!binary_input::readArray(
+          tmp328,
+          ((int32_t)1 * (int32_t)672),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)672; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp328;
+      }
+      Arr1DIdxRowM(tmp328, (int32_t)672, i0) =
+          (party == SERVER) ? __tmp_in_tmp328 : 0;
     }
-    Arr1DIdxRowM(tmp328, (int32_t)672, i0) =
-        (party == SERVER) ? __tmp_in_tmp328 : 0;
   }
 
   uint64_t *tmp329 = make_array<uint64_t>((int32_t)672);
   /* Variable to read the clear value corresponding to the input variable tmp329
    * at (2917,1-2917,37) */
   uint64_t __tmp_in_tmp329;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)672; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp329;
+  if (!binary_input::readArray(
+          tmp329,
+          ((int32_t)1 * (int32_t)672),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)672; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp329;
+      }
+      Arr1DIdxRowM(tmp329, (int32_t)672, i0) =
+          (party == SERVER) ? __tmp_in_tmp329 : 0;
     }
-    Arr1DIdxRowM(tmp329, (int32_t)672, i0) =
-        (party == SERVER) ? __tmp_in_tmp329 : 0;
   }
 
   uint64_t *tmp330 =
@@ -6744,16 +8394,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp330
    * at (2920,1-2920,48) */
   uint64_t __tmp_in_tmp330;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)672; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp330;
+  if (!binary_input::readArray(
+          tmp330,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)672) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)672; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp330;
+            }
+            Arr4DIdxRowM(tmp330, (int32_t)1, (int32_t)1, (int32_t)672,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp330 : 0;
           }
-          Arr4DIdxRowM(tmp330, (int32_t)1, (int32_t)1, (int32_t)672,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp330 : 0;
         }
       }
     }
@@ -6763,48 +8418,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp331
    * at (2923,1-2923,37) */
   uint64_t __tmp_in_tmp331;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp331;
+  if (!binary_input::readArray(
+          tmp331,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp331;
+      }
+      Arr1DIdxRowM(tmp331, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp331 : 0;
     }
-    Arr1DIdxRowM(tmp331, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp331 : 0;
   }
 
   uint64_t *tmp332 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp332
    * at (2926,1-2926,37) */
   uint64_t __tmp_in_tmp332;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp332;
+  if (!binary_input::readArray(
+          tmp332,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp332;
+      }
+      Arr1DIdxRowM(tmp332, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp332 : 0;
     }
-    Arr1DIdxRowM(tmp332, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp332 : 0;
   }
 
   uint64_t *tmp333 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp333
    * at (2929,1-2929,37) */
   uint64_t __tmp_in_tmp333;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp333;
+  if (!binary_input::readArray(
+          tmp333,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp333;
+      }
+      Arr1DIdxRowM(tmp333, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp333 : 0;
     }
-    Arr1DIdxRowM(tmp333, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp333 : 0;
   }
 
   uint64_t *tmp334 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp334
    * at (2932,1-2932,37) */
   uint64_t __tmp_in_tmp334;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp334;
+  if (!binary_input::readArray(
+          tmp334,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp334;
+      }
+      Arr1DIdxRowM(tmp334, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp334 : 0;
     }
-    Arr1DIdxRowM(tmp334, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp334 : 0;
   }
 
   uint64_t *tmp335 =
@@ -6812,16 +8487,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp335
    * at (2935,1-2935,47) */
   uint64_t __tmp_in_tmp335;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp335;
+  if (!binary_input::readArray(
+          tmp335,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp335;
+            }
+            Arr4DIdxRowM(tmp335, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp335 : 0;
           }
-          Arr4DIdxRowM(tmp335, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp335 : 0;
         }
       }
     }
@@ -6831,48 +8511,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp336
    * at (2938,1-2938,37) */
   uint64_t __tmp_in_tmp336;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)704; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp336;
+  if (!binary_input::readArray(
+          tmp336,
+          ((int32_t)1 * (int32_t)704),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)704; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp336;
+      }
+      Arr1DIdxRowM(tmp336, (int32_t)704, i0) =
+          (party == SERVER) ? __tmp_in_tmp336 : 0;
     }
-    Arr1DIdxRowM(tmp336, (int32_t)704, i0) =
-        (party == SERVER) ? __tmp_in_tmp336 : 0;
   }
 
   uint64_t *tmp337 = make_array<uint64_t>((int32_t)704);
   /* Variable to read the clear value corresponding to the input variable tmp337
    * at (2941,1-2941,37) */
   uint64_t __tmp_in_tmp337;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)704; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp337;
+  if (!binary_input::readArray(
+          tmp337,
+          ((int32_t)1 * (int32_t)704),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)704; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp337;
+      }
+      Arr1DIdxRowM(tmp337, (int32_t)704, i0) =
+          (party == SERVER) ? __tmp_in_tmp337 : 0;
     }
-    Arr1DIdxRowM(tmp337, (int32_t)704, i0) =
-        (party == SERVER) ? __tmp_in_tmp337 : 0;
   }
 
   uint64_t *tmp338 = make_array<uint64_t>((int32_t)704);
   /* Variable to read the clear value corresponding to the input variable tmp338
    * at (2944,1-2944,37) */
   uint64_t __tmp_in_tmp338;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)704; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp338;
+  if (!binary_input::readArray(
+          tmp338,
+          ((int32_t)1 * (int32_t)704),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)704; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp338;
+      }
+      Arr1DIdxRowM(tmp338, (int32_t)704, i0) =
+          (party == SERVER) ? __tmp_in_tmp338 : 0;
     }
-    Arr1DIdxRowM(tmp338, (int32_t)704, i0) =
-        (party == SERVER) ? __tmp_in_tmp338 : 0;
   }
 
   uint64_t *tmp339 = make_array<uint64_t>((int32_t)704);
   /* Variable to read the clear value corresponding to the input variable tmp339
    * at (2947,1-2947,37) */
   uint64_t __tmp_in_tmp339;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)704; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp339;
+  if (!binary_input::readArray(
+          tmp339,
+          ((int32_t)1 * (int32_t)704),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)704; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp339;
+      }
+      Arr1DIdxRowM(tmp339, (int32_t)704, i0) =
+          (party == SERVER) ? __tmp_in_tmp339 : 0;
     }
-    Arr1DIdxRowM(tmp339, (int32_t)704, i0) =
-        (party == SERVER) ? __tmp_in_tmp339 : 0;
   }
 
   uint64_t *tmp340 =
@@ -6880,16 +8580,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp340
    * at (2950,1-2950,48) */
   uint64_t __tmp_in_tmp340;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)704; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp340;
+  if (!binary_input::readArray(
+          tmp340,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)704) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)704; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp340;
+            }
+            Arr4DIdxRowM(tmp340, (int32_t)1, (int32_t)1, (int32_t)704,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp340 : 0;
           }
-          Arr4DIdxRowM(tmp340, (int32_t)1, (int32_t)1, (int32_t)704,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp340 : 0;
         }
       }
     }
@@ -6899,48 +8604,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp341
    * at (2953,1-2953,37) */
   uint64_t __tmp_in_tmp341;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp341;
+  if (!binary_input::readArray(
+          tmp341,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp341;
+      }
+      Arr1DIdxRowM(tmp341, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp341 : 0;
     }
-    Arr1DIdxRowM(tmp341, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp341 : 0;
   }
 
   uint64_t *tmp342 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp342
    * at (2956,1-2956,37) */
   uint64_t __tmp_in_tmp342;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp342;
+  if (!binary_input::readArray(
+          tmp342,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp342;
+      }
+      Arr1DIdxRowM(tmp342, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp342 : 0;
     }
-    Arr1DIdxRowM(tmp342, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp342 : 0;
   }
 
   uint64_t *tmp343 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp343
    * at (2959,1-2959,37) */
   uint64_t __tmp_in_tmp343;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp343;
+  if (!binary_input::readArray(
+          tmp343,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp343;
+      }
+      Arr1DIdxRowM(tmp343, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp343 : 0;
     }
-    Arr1DIdxRowM(tmp343, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp343 : 0;
   }
 
   uint64_t *tmp344 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp344
    * at (2962,1-2962,37) */
   uint64_t __tmp_in_tmp344;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp344;
+  if (!binary_input::readArray(
+          tmp344,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp344;
+      }
+      Arr1DIdxRowM(tmp344, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp344 : 0;
     }
-    Arr1DIdxRowM(tmp344, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp344 : 0;
   }
 
   uint64_t *tmp345 =
@@ -6948,16 +8673,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp345
    * at (2965,1-2965,47) */
   uint64_t __tmp_in_tmp345;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp345;
+  if (!binary_input::readArray(
+          tmp345,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp345;
+            }
+            Arr4DIdxRowM(tmp345, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp345 : 0;
           }
-          Arr4DIdxRowM(tmp345, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp345 : 0;
         }
       }
     }
@@ -6967,48 +8697,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp346
    * at (2968,1-2968,37) */
   uint64_t __tmp_in_tmp346;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)736; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp346;
+  if (!binary_input::readArray(
+          tmp346,
+          ((int32_t)1 * (int32_t)736),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)736; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp346;
+      }
+      Arr1DIdxRowM(tmp346, (int32_t)736, i0) =
+          (party == SERVER) ? __tmp_in_tmp346 : 0;
     }
-    Arr1DIdxRowM(tmp346, (int32_t)736, i0) =
-        (party == SERVER) ? __tmp_in_tmp346 : 0;
   }
 
   uint64_t *tmp347 = make_array<uint64_t>((int32_t)736);
   /* Variable to read the clear value corresponding to the input variable tmp347
    * at (2971,1-2971,37) */
   uint64_t __tmp_in_tmp347;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)736; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp347;
+  if (!binary_input::readArray(
+          tmp347,
+          ((int32_t)1 * (int32_t)736),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)736; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp347;
+      }
+      Arr1DIdxRowM(tmp347, (int32_t)736, i0) =
+          (party == SERVER) ? __tmp_in_tmp347 : 0;
     }
-    Arr1DIdxRowM(tmp347, (int32_t)736, i0) =
-        (party == SERVER) ? __tmp_in_tmp347 : 0;
   }
 
   uint64_t *tmp348 = make_array<uint64_t>((int32_t)736);
   /* Variable to read the clear value corresponding to the input variable tmp348
    * at (2974,1-2974,37) */
   uint64_t __tmp_in_tmp348;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)736; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp348;
+  if (!binary_input::readArray(
+          tmp348,
+          ((int32_t)1 * (int32_t)736),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)736; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp348;
+      }
+      Arr1DIdxRowM(tmp348, (int32_t)736, i0) =
+          (party == SERVER) ? __tmp_in_tmp348 : 0;
     }
-    Arr1DIdxRowM(tmp348, (int32_t)736, i0) =
-        (party == SERVER) ? __tmp_in_tmp348 : 0;
   }
 
   uint64_t *tmp349 = make_array<uint64_t>((int32_t)736);
   /* Variable to read the clear value corresponding to the input variable tmp349
    * at (2977,1-2977,37) */
   uint64_t __tmp_in_tmp349;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)736; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp349;
+  if (!binary_input::readArray(
+          tmp349,
+          ((int32_t)1 * (int32_t)736),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)736; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp349;
+      }
+      Arr1DIdxRowM(tmp349, (int32_t)736, i0) =
+          (party == SERVER) ? __tmp_in_tmp349 : 0;
     }
-    Arr1DIdxRowM(tmp349, (int32_t)736, i0) =
-        (party == SERVER) ? __tmp_in_tmp349 : 0;
   }
 
   uint64_t *tmp350 =
@@ -7016,16 +8766,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp350
    * at (2980,1-2980,48) */
   uint64_t __tmp_in_tmp350;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)736; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp350;
+  if (!binary_input::readArray(
+          tmp350,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)736) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)736; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp350;
+            }
+            Arr4DIdxRowM(tmp350, (int32_t)1, (int32_t)1, (int32_t)736,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp350 : 0;
           }
-          Arr4DIdxRowM(tmp350, (int32_t)1, (int32_t)1, (int32_t)736,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp350 : 0;
         }
       }
     }
@@ -7035,48 +8790,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp351
    * at (2983,1-2983,37) */
   uint64_t __tmp_in_tmp351;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp351;
+  if (!binary_input::readArray(
+          tmp351,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp351;
+      }
+      Arr1DIdxRowM(tmp351, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp351 : 0;
     }
-    Arr1DIdxRowM(tmp351, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp351 : 0;
   }
 
   uint64_t *tmp352 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp352
    * at (2986,1-2986,37) */
   uint64_t __tmp_in_tmp352;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp352;
+  if (!binary_input::readArray(
+          tmp352,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp352;
+      }
+      Arr1DIdxRowM(tmp352, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp352 : 0;
     }
-    Arr1DIdxRowM(tmp352, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp352 : 0;
   }
 
   uint64_t *tmp353 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp353
    * at (2989,1-2989,37) */
   uint64_t __tmp_in_tmp353;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp353;
+  if (!binary_input::readArray(
+          tmp353,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp353;
+      }
+      Arr1DIdxRowM(tmp353, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp353 : 0;
     }
-    Arr1DIdxRowM(tmp353, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp353 : 0;
   }
 
   uint64_t *tmp354 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp354
    * at (2992,1-2992,37) */
   uint64_t __tmp_in_tmp354;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp354;
+  if (!binary_input::readArray(
+          tmp354,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp354;
+      }
+      Arr1DIdxRowM(tmp354, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp354 : 0;
     }
-    Arr1DIdxRowM(tmp354, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp354 : 0;
   }
 
   uint64_t *tmp355 =
@@ -7084,16 +8859,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp355
    * at (2995,1-2995,47) */
   uint64_t __tmp_in_tmp355;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp355;
+  if (!binary_input::readArray(
+          tmp355,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp355;
+            }
+            Arr4DIdxRowM(tmp355, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp355 : 0;
           }
-          Arr4DIdxRowM(tmp355, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp355 : 0;
         }
       }
     }
@@ -7103,48 +8883,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp356
    * at (2998,1-2998,37) */
   uint64_t __tmp_in_tmp356;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)768; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp356;
+  if (!binary_input::readArray(
+          tmp356,
+          ((int32_t)1 * (int32_t)768),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)768; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp356;
+      }
+      Arr1DIdxRowM(tmp356, (int32_t)768, i0) =
+          (party == SERVER) ? __tmp_in_tmp356 : 0;
     }
-    Arr1DIdxRowM(tmp356, (int32_t)768, i0) =
-        (party == SERVER) ? __tmp_in_tmp356 : 0;
   }
 
   uint64_t *tmp357 = make_array<uint64_t>((int32_t)768);
   /* Variable to read the clear value corresponding to the input variable tmp357
    * at (3001,1-3001,37) */
   uint64_t __tmp_in_tmp357;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)768; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp357;
+  if (!binary_input::readArray(
+          tmp357,
+          ((int32_t)1 * (int32_t)768),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)768; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp357;
+      }
+      Arr1DIdxRowM(tmp357, (int32_t)768, i0) =
+          (party == SERVER) ? __tmp_in_tmp357 : 0;
     }
-    Arr1DIdxRowM(tmp357, (int32_t)768, i0) =
-        (party == SERVER) ? __tmp_in_tmp357 : 0;
   }
 
   uint64_t *tmp358 = make_array<uint64_t>((int32_t)768);
   /* Variable to read the clear value corresponding to the input variable tmp358
    * at (3004,1-3004,37) */
   uint64_t __tmp_in_tmp358;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)768; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp358;
+  if (!binary_input::readArray(
+          tmp358,
+          ((int32_t)1 * (int32_t)768),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)768; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp358;
+      }
+      Arr1DIdxRowM(tmp358, (int32_t)768, i0) =
+          (party == SERVER) ? __tmp_in_tmp358 : 0;
     }
-    Arr1DIdxRowM(tmp358, (int32_t)768, i0) =
-        (party == SERVER) ? __tmp_in_tmp358 : 0;
   }
 
   uint64_t *tmp359 = make_array<uint64_t>((int32_t)768);
   /* Variable to read the clear value corresponding to the input variable tmp359
    * at (3007,1-3007,37) */
   uint64_t __tmp_in_tmp359;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)768; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp359;
+  if (!binary_input::readArray(
+          tmp359,
+          ((int32_t)1 * (int32_t)768),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)768; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp359;
+      }
+      Arr1DIdxRowM(tmp359, (int32_t)768, i0) =
+          (party == SERVER) ? __tmp_in_tmp359 : 0;
     }
-    Arr1DIdxRowM(tmp359, (int32_t)768, i0) =
-        (party == SERVER) ? __tmp_in_tmp359 : 0;
   }
 
   uint64_t *tmp360 =
@@ -7152,16 +8952,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp360
    * at (3010,1-3010,48) */
   uint64_t __tmp_in_tmp360;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)768; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp360;
+  if (!binary_input::readArray(
+          tmp360,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)768) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)768; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp360;
+            }
+            Arr4DIdxRowM(tmp360, (int32_t)1, (int32_t)1, (int32_t)768,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp360 : 0;
           }
-          Arr4DIdxRowM(tmp360, (int32_t)1, (int32_t)1, (int32_t)768,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp360 : 0;
         }
       }
     }
@@ -7171,48 +8976,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp361
    * at (3013,1-3013,37) */
   uint64_t __tmp_in_tmp361;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp361;
+  if (!binary_input::readArray(
+          tmp361,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp361;
+      }
+      Arr1DIdxRowM(tmp361, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp361 : 0;
     }
-    Arr1DIdxRowM(tmp361, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp361 : 0;
   }
 
   uint64_t *tmp362 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp362
    * at (3016,1-3016,37) */
   uint64_t __tmp_in_tmp362;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp362;
+  if (!binary_input::readArray(
+          tmp362,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp362;
+      }
+      Arr1DIdxRowM(tmp362, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp362 : 0;
     }
-    Arr1DIdxRowM(tmp362, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp362 : 0;
   }
 
   uint64_t *tmp363 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp363
    * at (3019,1-3019,37) */
   uint64_t __tmp_in_tmp363;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp363;
+  if (!binary_input::readArray(
+          tmp363,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp363;
+      }
+      Arr1DIdxRowM(tmp363, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp363 : 0;
     }
-    Arr1DIdxRowM(tmp363, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp363 : 0;
   }
 
   uint64_t *tmp364 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp364
    * at (3022,1-3022,37) */
   uint64_t __tmp_in_tmp364;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp364;
+  if (!binary_input::readArray(
+          tmp364,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp364;
+      }
+      Arr1DIdxRowM(tmp364, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp364 : 0;
     }
-    Arr1DIdxRowM(tmp364, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp364 : 0;
   }
 
   uint64_t *tmp365 =
@@ -7220,16 +9045,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp365
    * at (3025,1-3025,47) */
   uint64_t __tmp_in_tmp365;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp365;
+  if (!binary_input::readArray(
+          tmp365,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp365;
+            }
+            Arr4DIdxRowM(tmp365, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp365 : 0;
           }
-          Arr4DIdxRowM(tmp365, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp365 : 0;
         }
       }
     }
@@ -7239,48 +9069,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp366
    * at (3028,1-3028,37) */
   uint64_t __tmp_in_tmp366;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)800; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp366;
+  if (!binary_input::readArray(
+          tmp366,
+          ((int32_t)1 * (int32_t)800),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)800; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp366;
+      }
+      Arr1DIdxRowM(tmp366, (int32_t)800, i0) =
+          (party == SERVER) ? __tmp_in_tmp366 : 0;
     }
-    Arr1DIdxRowM(tmp366, (int32_t)800, i0) =
-        (party == SERVER) ? __tmp_in_tmp366 : 0;
   }
 
   uint64_t *tmp367 = make_array<uint64_t>((int32_t)800);
   /* Variable to read the clear value corresponding to the input variable tmp367
    * at (3031,1-3031,37) */
   uint64_t __tmp_in_tmp367;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)800; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp367;
+  if (!binary_input::readArray(
+          tmp367,
+          ((int32_t)1 * (int32_t)800),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)800; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp367;
+      }
+      Arr1DIdxRowM(tmp367, (int32_t)800, i0) =
+          (party == SERVER) ? __tmp_in_tmp367 : 0;
     }
-    Arr1DIdxRowM(tmp367, (int32_t)800, i0) =
-        (party == SERVER) ? __tmp_in_tmp367 : 0;
   }
 
   uint64_t *tmp368 = make_array<uint64_t>((int32_t)800);
   /* Variable to read the clear value corresponding to the input variable tmp368
    * at (3034,1-3034,37) */
   uint64_t __tmp_in_tmp368;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)800; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp368;
+  if (!binary_input::readArray(
+          tmp368,
+          ((int32_t)1 * (int32_t)800),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)800; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp368;
+      }
+      Arr1DIdxRowM(tmp368, (int32_t)800, i0) =
+          (party == SERVER) ? __tmp_in_tmp368 : 0;
     }
-    Arr1DIdxRowM(tmp368, (int32_t)800, i0) =
-        (party == SERVER) ? __tmp_in_tmp368 : 0;
   }
 
   uint64_t *tmp369 = make_array<uint64_t>((int32_t)800);
   /* Variable to read the clear value corresponding to the input variable tmp369
    * at (3037,1-3037,37) */
   uint64_t __tmp_in_tmp369;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)800; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp369;
+  if (!binary_input::readArray(
+          tmp369,
+          ((int32_t)1 * (int32_t)800),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)800; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp369;
+      }
+      Arr1DIdxRowM(tmp369, (int32_t)800, i0) =
+          (party == SERVER) ? __tmp_in_tmp369 : 0;
     }
-    Arr1DIdxRowM(tmp369, (int32_t)800, i0) =
-        (party == SERVER) ? __tmp_in_tmp369 : 0;
   }
 
   uint64_t *tmp370 =
@@ -7288,16 +9138,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp370
    * at (3040,1-3040,48) */
   uint64_t __tmp_in_tmp370;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)800; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp370;
+  if (!binary_input::readArray(
+          tmp370,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)800) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)800; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp370;
+            }
+            Arr4DIdxRowM(tmp370, (int32_t)1, (int32_t)1, (int32_t)800,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp370 : 0;
           }
-          Arr4DIdxRowM(tmp370, (int32_t)1, (int32_t)1, (int32_t)800,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp370 : 0;
         }
       }
     }
@@ -7307,48 +9162,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp371
    * at (3043,1-3043,37) */
   uint64_t __tmp_in_tmp371;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp371;
+  if (!binary_input::readArray(
+          tmp371,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp371;
+      }
+      Arr1DIdxRowM(tmp371, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp371 : 0;
     }
-    Arr1DIdxRowM(tmp371, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp371 : 0;
   }
 
   uint64_t *tmp372 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp372
    * at (3046,1-3046,37) */
   uint64_t __tmp_in_tmp372;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp372;
+  if (!binary_input::readArray(
+          tmp372,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp372;
+      }
+      Arr1DIdxRowM(tmp372, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp372 : 0;
     }
-    Arr1DIdxRowM(tmp372, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp372 : 0;
   }
 
   uint64_t *tmp373 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp373
    * at (3049,1-3049,37) */
   uint64_t __tmp_in_tmp373;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp373;
+  if (!binary_input::readArray(
+          tmp373,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp373;
+      }
+      Arr1DIdxRowM(tmp373, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp373 : 0;
     }
-    Arr1DIdxRowM(tmp373, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp373 : 0;
   }
 
   uint64_t *tmp374 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp374
    * at (3052,1-3052,37) */
   uint64_t __tmp_in_tmp374;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp374;
+  if (!binary_input::readArray(
+          tmp374,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp374;
+      }
+      Arr1DIdxRowM(tmp374, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp374 : 0;
     }
-    Arr1DIdxRowM(tmp374, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp374 : 0;
   }
 
   uint64_t *tmp375 =
@@ -7356,16 +9231,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp375
    * at (3055,1-3055,47) */
   uint64_t __tmp_in_tmp375;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp375;
+  if (!binary_input::readArray(
+          tmp375,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp375;
+            }
+            Arr4DIdxRowM(tmp375, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp375 : 0;
           }
-          Arr4DIdxRowM(tmp375, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp375 : 0;
         }
       }
     }
@@ -7375,48 +9255,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp376
    * at (3058,1-3058,37) */
   uint64_t __tmp_in_tmp376;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)832; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp376;
+  if (!binary_input::readArray(
+          tmp376,
+          ((int32_t)1 * (int32_t)832),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)832; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp376;
+      }
+      Arr1DIdxRowM(tmp376, (int32_t)832, i0) =
+          (party == SERVER) ? __tmp_in_tmp376 : 0;
     }
-    Arr1DIdxRowM(tmp376, (int32_t)832, i0) =
-        (party == SERVER) ? __tmp_in_tmp376 : 0;
   }
 
   uint64_t *tmp377 = make_array<uint64_t>((int32_t)832);
   /* Variable to read the clear value corresponding to the input variable tmp377
    * at (3061,1-3061,37) */
   uint64_t __tmp_in_tmp377;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)832; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp377;
+  if (!binary_input::readArray(
+          tmp377,
+          ((int32_t)1 * (int32_t)832),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)832; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp377;
+      }
+      Arr1DIdxRowM(tmp377, (int32_t)832, i0) =
+          (party == SERVER) ? __tmp_in_tmp377 : 0;
     }
-    Arr1DIdxRowM(tmp377, (int32_t)832, i0) =
-        (party == SERVER) ? __tmp_in_tmp377 : 0;
   }
 
   uint64_t *tmp378 = make_array<uint64_t>((int32_t)832);
   /* Variable to read the clear value corresponding to the input variable tmp378
    * at (3064,1-3064,37) */
   uint64_t __tmp_in_tmp378;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)832; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp378;
+  if (!binary_input::readArray(
+          tmp378,
+          ((int32_t)1 * (int32_t)832),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)832; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp378;
+      }
+      Arr1DIdxRowM(tmp378, (int32_t)832, i0) =
+          (party == SERVER) ? __tmp_in_tmp378 : 0;
     }
-    Arr1DIdxRowM(tmp378, (int32_t)832, i0) =
-        (party == SERVER) ? __tmp_in_tmp378 : 0;
   }
 
   uint64_t *tmp379 = make_array<uint64_t>((int32_t)832);
   /* Variable to read the clear value corresponding to the input variable tmp379
    * at (3067,1-3067,37) */
   uint64_t __tmp_in_tmp379;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)832; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp379;
+  if (!binary_input::readArray(
+          tmp379,
+          ((int32_t)1 * (int32_t)832),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)832; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp379;
+      }
+      Arr1DIdxRowM(tmp379, (int32_t)832, i0) =
+          (party == SERVER) ? __tmp_in_tmp379 : 0;
     }
-    Arr1DIdxRowM(tmp379, (int32_t)832, i0) =
-        (party == SERVER) ? __tmp_in_tmp379 : 0;
   }
 
   uint64_t *tmp380 =
@@ -7424,16 +9324,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp380
    * at (3070,1-3070,48) */
   uint64_t __tmp_in_tmp380;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)832; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp380;
+  if (!binary_input::readArray(
+          tmp380,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)832) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)832; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp380;
+            }
+            Arr4DIdxRowM(tmp380, (int32_t)1, (int32_t)1, (int32_t)832,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp380 : 0;
           }
-          Arr4DIdxRowM(tmp380, (int32_t)1, (int32_t)1, (int32_t)832,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp380 : 0;
         }
       }
     }
@@ -7443,48 +9348,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp381
    * at (3073,1-3073,37) */
   uint64_t __tmp_in_tmp381;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp381;
+  if (!binary_input::readArray(
+          tmp381,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp381;
+      }
+      Arr1DIdxRowM(tmp381, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp381 : 0;
     }
-    Arr1DIdxRowM(tmp381, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp381 : 0;
   }
 
   uint64_t *tmp382 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp382
    * at (3076,1-3076,37) */
   uint64_t __tmp_in_tmp382;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp382;
+  if (!binary_input::readArray(
+          tmp382,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp382;
+      }
+      Arr1DIdxRowM(tmp382, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp382 : 0;
     }
-    Arr1DIdxRowM(tmp382, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp382 : 0;
   }
 
   uint64_t *tmp383 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp383
    * at (3079,1-3079,37) */
   uint64_t __tmp_in_tmp383;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp383;
+  if (!binary_input::readArray(
+          tmp383,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp383;
+      }
+      Arr1DIdxRowM(tmp383, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp383 : 0;
     }
-    Arr1DIdxRowM(tmp383, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp383 : 0;
   }
 
   uint64_t *tmp384 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp384
    * at (3082,1-3082,37) */
   uint64_t __tmp_in_tmp384;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp384;
+  if (!binary_input::readArray(
+          tmp384,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp384;
+      }
+      Arr1DIdxRowM(tmp384, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp384 : 0;
     }
-    Arr1DIdxRowM(tmp384, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp384 : 0;
   }
 
   uint64_t *tmp385 =
@@ -7492,16 +9417,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp385
    * at (3085,1-3085,47) */
   uint64_t __tmp_in_tmp385;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp385;
+  if (!binary_input::readArray(
+          tmp385,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp385;
+            }
+            Arr4DIdxRowM(tmp385, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp385 : 0;
           }
-          Arr4DIdxRowM(tmp385, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp385 : 0;
         }
       }
     }
@@ -7511,48 +9441,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp386
    * at (3088,1-3088,37) */
   uint64_t __tmp_in_tmp386;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)864; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp386;
+  if (!binary_input::readArray(
+          tmp386,
+          ((int32_t)1 * (int32_t)864),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)864; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp386;
+      }
+      Arr1DIdxRowM(tmp386, (int32_t)864, i0) =
+          (party == SERVER) ? __tmp_in_tmp386 : 0;
     }
-    Arr1DIdxRowM(tmp386, (int32_t)864, i0) =
-        (party == SERVER) ? __tmp_in_tmp386 : 0;
   }
 
   uint64_t *tmp387 = make_array<uint64_t>((int32_t)864);
   /* Variable to read the clear value corresponding to the input variable tmp387
    * at (3091,1-3091,37) */
   uint64_t __tmp_in_tmp387;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)864; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp387;
+  if (!binary_input::readArray(
+          tmp387,
+          ((int32_t)1 * (int32_t)864),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)864; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp387;
+      }
+      Arr1DIdxRowM(tmp387, (int32_t)864, i0) =
+          (party == SERVER) ? __tmp_in_tmp387 : 0;
     }
-    Arr1DIdxRowM(tmp387, (int32_t)864, i0) =
-        (party == SERVER) ? __tmp_in_tmp387 : 0;
   }
 
   uint64_t *tmp388 = make_array<uint64_t>((int32_t)864);
   /* Variable to read the clear value corresponding to the input variable tmp388
    * at (3094,1-3094,37) */
   uint64_t __tmp_in_tmp388;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)864; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp388;
+  if (!binary_input::readArray(
+          tmp388,
+          ((int32_t)1 * (int32_t)864),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)864; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp388;
+      }
+      Arr1DIdxRowM(tmp388, (int32_t)864, i0) =
+          (party == SERVER) ? __tmp_in_tmp388 : 0;
     }
-    Arr1DIdxRowM(tmp388, (int32_t)864, i0) =
-        (party == SERVER) ? __tmp_in_tmp388 : 0;
   }
 
   uint64_t *tmp389 = make_array<uint64_t>((int32_t)864);
   /* Variable to read the clear value corresponding to the input variable tmp389
    * at (3097,1-3097,37) */
   uint64_t __tmp_in_tmp389;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)864; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp389;
+  if (!binary_input::readArray(
+          tmp389,
+          ((int32_t)1 * (int32_t)864),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)864; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp389;
+      }
+      Arr1DIdxRowM(tmp389, (int32_t)864, i0) =
+          (party == SERVER) ? __tmp_in_tmp389 : 0;
     }
-    Arr1DIdxRowM(tmp389, (int32_t)864, i0) =
-        (party == SERVER) ? __tmp_in_tmp389 : 0;
   }
 
   uint64_t *tmp390 =
@@ -7560,16 +9510,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp390
    * at (3100,1-3100,48) */
   uint64_t __tmp_in_tmp390;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)864; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp390;
+  if (!binary_input::readArray(
+          tmp390,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)864) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)864; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp390;
+            }
+            Arr4DIdxRowM(tmp390, (int32_t)1, (int32_t)1, (int32_t)864,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp390 : 0;
           }
-          Arr4DIdxRowM(tmp390, (int32_t)1, (int32_t)1, (int32_t)864,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp390 : 0;
         }
       }
     }
@@ -7579,48 +9534,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp391
    * at (3103,1-3103,37) */
   uint64_t __tmp_in_tmp391;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp391;
+  if (!binary_input::readArray(
+          tmp391,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp391;
+      }
+      Arr1DIdxRowM(tmp391, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp391 : 0;
     }
-    Arr1DIdxRowM(tmp391, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp391 : 0;
   }
 
   uint64_t *tmp392 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp392
    * at (3106,1-3106,37) */
   uint64_t __tmp_in_tmp392;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp392;
+  if (!binary_input::readArray(
+          tmp392,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp392;
+      }
+      Arr1DIdxRowM(tmp392, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp392 : 0;
     }
-    Arr1DIdxRowM(tmp392, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp392 : 0;
   }
 
   uint64_t *tmp393 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp393
    * at (3109,1-3109,37) */
   uint64_t __tmp_in_tmp393;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp393;
+  if (!binary_input::readArray(
+          tmp393,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp393;
+      }
+      Arr1DIdxRowM(tmp393, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp393 : 0;
     }
-    Arr1DIdxRowM(tmp393, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp393 : 0;
   }
 
   uint64_t *tmp394 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp394
    * at (3112,1-3112,37) */
   uint64_t __tmp_in_tmp394;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp394;
+  if (!binary_input::readArray(
+          tmp394,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp394;
+      }
+      Arr1DIdxRowM(tmp394, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp394 : 0;
     }
-    Arr1DIdxRowM(tmp394, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp394 : 0;
   }
 
   uint64_t *tmp395 =
@@ -7628,16 +9603,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp395
    * at (3115,1-3115,47) */
   uint64_t __tmp_in_tmp395;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp395;
+  if (!binary_input::readArray(
+          tmp395,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp395;
+            }
+            Arr4DIdxRowM(tmp395, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp395 : 0;
           }
-          Arr4DIdxRowM(tmp395, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp395 : 0;
         }
       }
     }
@@ -7647,48 +9627,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp396
    * at (3118,1-3118,37) */
   uint64_t __tmp_in_tmp396;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)896; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp396;
+  if (!binary_input::readArray(
+          tmp396,
+          ((int32_t)1 * (int32_t)896),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)896; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp396;
+      }
+      Arr1DIdxRowM(tmp396, (int32_t)896, i0) =
+          (party == SERVER) ? __tmp_in_tmp396 : 0;
     }
-    Arr1DIdxRowM(tmp396, (int32_t)896, i0) =
-        (party == SERVER) ? __tmp_in_tmp396 : 0;
   }
 
   uint64_t *tmp397 = make_array<uint64_t>((int32_t)896);
   /* Variable to read the clear value corresponding to the input variable tmp397
    * at (3121,1-3121,37) */
   uint64_t __tmp_in_tmp397;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)896; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp397;
+  if (!binary_input::readArray(
+          tmp397,
+          ((int32_t)1 * (int32_t)896),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)896; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp397;
+      }
+      Arr1DIdxRowM(tmp397, (int32_t)896, i0) =
+          (party == SERVER) ? __tmp_in_tmp397 : 0;
     }
-    Arr1DIdxRowM(tmp397, (int32_t)896, i0) =
-        (party == SERVER) ? __tmp_in_tmp397 : 0;
   }
 
   uint64_t *tmp398 = make_array<uint64_t>((int32_t)896);
   /* Variable to read the clear value corresponding to the input variable tmp398
    * at (3124,1-3124,37) */
   uint64_t __tmp_in_tmp398;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)896; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp398;
+  if (!binary_input::readArray(
+          tmp398,
+          ((int32_t)1 * (int32_t)896),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)896; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp398;
+      }
+      Arr1DIdxRowM(tmp398, (int32_t)896, i0) =
+          (party == SERVER) ? __tmp_in_tmp398 : 0;
     }
-    Arr1DIdxRowM(tmp398, (int32_t)896, i0) =
-        (party == SERVER) ? __tmp_in_tmp398 : 0;
   }
 
   uint64_t *tmp399 = make_array<uint64_t>((int32_t)896);
   /* Variable to read the clear value corresponding to the input variable tmp399
    * at (3127,1-3127,37) */
   uint64_t __tmp_in_tmp399;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)896; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp399;
+  if (!binary_input::readArray(
+          tmp399,
+          ((int32_t)1 * (int32_t)896),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)896; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp399;
+      }
+      Arr1DIdxRowM(tmp399, (int32_t)896, i0) =
+          (party == SERVER) ? __tmp_in_tmp399 : 0;
     }
-    Arr1DIdxRowM(tmp399, (int32_t)896, i0) =
-        (party == SERVER) ? __tmp_in_tmp399 : 0;
   }
 
   uint64_t *tmp400 =
@@ -7696,16 +9696,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp400
    * at (3130,1-3130,48) */
   uint64_t __tmp_in_tmp400;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)896; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp400;
+  if (!binary_input::readArray(
+          tmp400,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)896) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)896; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp400;
+            }
+            Arr4DIdxRowM(tmp400, (int32_t)1, (int32_t)1, (int32_t)896,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp400 : 0;
           }
-          Arr4DIdxRowM(tmp400, (int32_t)1, (int32_t)1, (int32_t)896,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp400 : 0;
         }
       }
     }
@@ -7715,48 +9720,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp401
    * at (3133,1-3133,37) */
   uint64_t __tmp_in_tmp401;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp401;
+  if (!binary_input::readArray(
+          tmp401,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp401;
+      }
+      Arr1DIdxRowM(tmp401, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp401 : 0;
     }
-    Arr1DIdxRowM(tmp401, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp401 : 0;
   }
 
   uint64_t *tmp402 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp402
    * at (3136,1-3136,37) */
   uint64_t __tmp_in_tmp402;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp402;
+  if (!binary_input::readArray(
+          tmp402,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp402;
+      }
+      Arr1DIdxRowM(tmp402, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp402 : 0;
     }
-    Arr1DIdxRowM(tmp402, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp402 : 0;
   }
 
   uint64_t *tmp403 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp403
    * at (3139,1-3139,37) */
   uint64_t __tmp_in_tmp403;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp403;
+  if (!binary_input::readArray(
+          tmp403,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp403;
+      }
+      Arr1DIdxRowM(tmp403, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp403 : 0;
     }
-    Arr1DIdxRowM(tmp403, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp403 : 0;
   }
 
   uint64_t *tmp404 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp404
    * at (3142,1-3142,37) */
   uint64_t __tmp_in_tmp404;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp404;
+  if (!binary_input::readArray(
+          tmp404,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp404;
+      }
+      Arr1DIdxRowM(tmp404, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp404 : 0;
     }
-    Arr1DIdxRowM(tmp404, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp404 : 0;
   }
 
   uint64_t *tmp405 =
@@ -7764,16 +9789,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp405
    * at (3145,1-3145,47) */
   uint64_t __tmp_in_tmp405;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp405;
+  if (!binary_input::readArray(
+          tmp405,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp405;
+            }
+            Arr4DIdxRowM(tmp405, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp405 : 0;
           }
-          Arr4DIdxRowM(tmp405, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp405 : 0;
         }
       }
     }
@@ -7783,48 +9813,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp406
    * at (3148,1-3148,37) */
   uint64_t __tmp_in_tmp406;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)928; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp406;
+  if (!binary_input::readArray(
+          tmp406,
+          ((int32_t)1 * (int32_t)928),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)928; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp406;
+      }
+      Arr1DIdxRowM(tmp406, (int32_t)928, i0) =
+          (party == SERVER) ? __tmp_in_tmp406 : 0;
     }
-    Arr1DIdxRowM(tmp406, (int32_t)928, i0) =
-        (party == SERVER) ? __tmp_in_tmp406 : 0;
   }
 
   uint64_t *tmp407 = make_array<uint64_t>((int32_t)928);
   /* Variable to read the clear value corresponding to the input variable tmp407
    * at (3151,1-3151,37) */
   uint64_t __tmp_in_tmp407;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)928; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp407;
+  if (!binary_input::readArray(
+          tmp407,
+          ((int32_t)1 * (int32_t)928),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)928; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp407;
+      }
+      Arr1DIdxRowM(tmp407, (int32_t)928, i0) =
+          (party == SERVER) ? __tmp_in_tmp407 : 0;
     }
-    Arr1DIdxRowM(tmp407, (int32_t)928, i0) =
-        (party == SERVER) ? __tmp_in_tmp407 : 0;
   }
 
   uint64_t *tmp408 = make_array<uint64_t>((int32_t)928);
   /* Variable to read the clear value corresponding to the input variable tmp408
    * at (3154,1-3154,37) */
   uint64_t __tmp_in_tmp408;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)928; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp408;
+  if (!binary_input::readArray(
+          tmp408,
+          ((int32_t)1 * (int32_t)928),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)928; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp408;
+      }
+      Arr1DIdxRowM(tmp408, (int32_t)928, i0) =
+          (party == SERVER) ? __tmp_in_tmp408 : 0;
     }
-    Arr1DIdxRowM(tmp408, (int32_t)928, i0) =
-        (party == SERVER) ? __tmp_in_tmp408 : 0;
   }
 
   uint64_t *tmp409 = make_array<uint64_t>((int32_t)928);
   /* Variable to read the clear value corresponding to the input variable tmp409
    * at (3157,1-3157,37) */
   uint64_t __tmp_in_tmp409;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)928; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp409;
+  if (!binary_input::readArray(
+          tmp409,
+          ((int32_t)1 * (int32_t)928),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)928; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp409;
+      }
+      Arr1DIdxRowM(tmp409, (int32_t)928, i0) =
+          (party == SERVER) ? __tmp_in_tmp409 : 0;
     }
-    Arr1DIdxRowM(tmp409, (int32_t)928, i0) =
-        (party == SERVER) ? __tmp_in_tmp409 : 0;
   }
 
   uint64_t *tmp410 =
@@ -7832,16 +9882,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp410
    * at (3160,1-3160,48) */
   uint64_t __tmp_in_tmp410;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)928; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp410;
+  if (!binary_input::readArray(
+          tmp410,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)928) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)928; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp410;
+            }
+            Arr4DIdxRowM(tmp410, (int32_t)1, (int32_t)1, (int32_t)928,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp410 : 0;
           }
-          Arr4DIdxRowM(tmp410, (int32_t)1, (int32_t)1, (int32_t)928,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp410 : 0;
         }
       }
     }
@@ -7851,48 +9906,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp411
    * at (3163,1-3163,37) */
   uint64_t __tmp_in_tmp411;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp411;
+  if (!binary_input::readArray(
+          tmp411,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp411;
+      }
+      Arr1DIdxRowM(tmp411, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp411 : 0;
     }
-    Arr1DIdxRowM(tmp411, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp411 : 0;
   }
 
   uint64_t *tmp412 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp412
    * at (3166,1-3166,37) */
   uint64_t __tmp_in_tmp412;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp412;
+  if (!binary_input::readArray(
+          tmp412,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp412;
+      }
+      Arr1DIdxRowM(tmp412, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp412 : 0;
     }
-    Arr1DIdxRowM(tmp412, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp412 : 0;
   }
 
   uint64_t *tmp413 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp413
    * at (3169,1-3169,37) */
   uint64_t __tmp_in_tmp413;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp413;
+  if (!binary_input::readArray(
+          tmp413,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp413;
+      }
+      Arr1DIdxRowM(tmp413, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp413 : 0;
     }
-    Arr1DIdxRowM(tmp413, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp413 : 0;
   }
 
   uint64_t *tmp414 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp414
    * at (3172,1-3172,37) */
   uint64_t __tmp_in_tmp414;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp414;
+  if (!binary_input::readArray(
+          tmp414,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp414;
+      }
+      Arr1DIdxRowM(tmp414, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp414 : 0;
     }
-    Arr1DIdxRowM(tmp414, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp414 : 0;
   }
 
   uint64_t *tmp415 =
@@ -7900,16 +9975,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp415
    * at (3175,1-3175,47) */
   uint64_t __tmp_in_tmp415;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp415;
+  if (!binary_input::readArray(
+          tmp415,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp415;
+            }
+            Arr4DIdxRowM(tmp415, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp415 : 0;
           }
-          Arr4DIdxRowM(tmp415, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp415 : 0;
         }
       }
     }
@@ -7919,48 +9999,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp416
    * at (3178,1-3178,37) */
   uint64_t __tmp_in_tmp416;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)960; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp416;
+  if (!binary_input::readArray(
+          tmp416,
+          ((int32_t)1 * (int32_t)960),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)960; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp416;
+      }
+      Arr1DIdxRowM(tmp416, (int32_t)960, i0) =
+          (party == SERVER) ? __tmp_in_tmp416 : 0;
     }
-    Arr1DIdxRowM(tmp416, (int32_t)960, i0) =
-        (party == SERVER) ? __tmp_in_tmp416 : 0;
   }
 
   uint64_t *tmp417 = make_array<uint64_t>((int32_t)960);
   /* Variable to read the clear value corresponding to the input variable tmp417
    * at (3181,1-3181,37) */
   uint64_t __tmp_in_tmp417;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)960; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp417;
+  if (!binary_input::readArray(
+          tmp417,
+          ((int32_t)1 * (int32_t)960),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)960; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp417;
+      }
+      Arr1DIdxRowM(tmp417, (int32_t)960, i0) =
+          (party == SERVER) ? __tmp_in_tmp417 : 0;
     }
-    Arr1DIdxRowM(tmp417, (int32_t)960, i0) =
-        (party == SERVER) ? __tmp_in_tmp417 : 0;
   }
 
   uint64_t *tmp418 = make_array<uint64_t>((int32_t)960);
   /* Variable to read the clear value corresponding to the input variable tmp418
    * at (3184,1-3184,37) */
   uint64_t __tmp_in_tmp418;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)960; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp418;
+  if (!binary_input::readArray(
+          tmp418,
+          ((int32_t)1 * (int32_t)960),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)960; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp418;
+      }
+      Arr1DIdxRowM(tmp418, (int32_t)960, i0) =
+          (party == SERVER) ? __tmp_in_tmp418 : 0;
     }
-    Arr1DIdxRowM(tmp418, (int32_t)960, i0) =
-        (party == SERVER) ? __tmp_in_tmp418 : 0;
   }
 
   uint64_t *tmp419 = make_array<uint64_t>((int32_t)960);
   /* Variable to read the clear value corresponding to the input variable tmp419
    * at (3187,1-3187,37) */
   uint64_t __tmp_in_tmp419;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)960; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp419;
+  if (!binary_input::readArray(
+          tmp419,
+          ((int32_t)1 * (int32_t)960),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)960; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp419;
+      }
+      Arr1DIdxRowM(tmp419, (int32_t)960, i0) =
+          (party == SERVER) ? __tmp_in_tmp419 : 0;
     }
-    Arr1DIdxRowM(tmp419, (int32_t)960, i0) =
-        (party == SERVER) ? __tmp_in_tmp419 : 0;
   }
 
   uint64_t *tmp420 =
@@ -7968,16 +10068,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp420
    * at (3190,1-3190,48) */
   uint64_t __tmp_in_tmp420;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)960; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp420;
+  if (!binary_input::readArray(
+          tmp420,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)960) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)960; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp420;
+            }
+            Arr4DIdxRowM(tmp420, (int32_t)1, (int32_t)1, (int32_t)960,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp420 : 0;
           }
-          Arr4DIdxRowM(tmp420, (int32_t)1, (int32_t)1, (int32_t)960,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp420 : 0;
         }
       }
     }
@@ -7987,48 +10092,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp421
    * at (3193,1-3193,37) */
   uint64_t __tmp_in_tmp421;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp421;
+  if (!binary_input::readArray(
+          tmp421,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp421;
+      }
+      Arr1DIdxRowM(tmp421, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp421 : 0;
     }
-    Arr1DIdxRowM(tmp421, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp421 : 0;
   }
 
   uint64_t *tmp422 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp422
    * at (3196,1-3196,37) */
   uint64_t __tmp_in_tmp422;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp422;
+  if (!binary_input::readArray(
+          tmp422,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp422;
+      }
+      Arr1DIdxRowM(tmp422, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp422 : 0;
     }
-    Arr1DIdxRowM(tmp422, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp422 : 0;
   }
 
   uint64_t *tmp423 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp423
    * at (3199,1-3199,37) */
   uint64_t __tmp_in_tmp423;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp423;
+  if (!binary_input::readArray(
+          tmp423,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp423;
+      }
+      Arr1DIdxRowM(tmp423, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp423 : 0;
     }
-    Arr1DIdxRowM(tmp423, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp423 : 0;
   }
 
   uint64_t *tmp424 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp424
    * at (3202,1-3202,37) */
   uint64_t __tmp_in_tmp424;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp424;
+  if (!binary_input::readArray(
+          tmp424,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp424;
+      }
+      Arr1DIdxRowM(tmp424, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp424 : 0;
     }
-    Arr1DIdxRowM(tmp424, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp424 : 0;
   }
 
   uint64_t *tmp425 =
@@ -8036,16 +10161,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp425
    * at (3205,1-3205,47) */
   uint64_t __tmp_in_tmp425;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp425;
+  if (!binary_input::readArray(
+          tmp425,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp425;
+            }
+            Arr4DIdxRowM(tmp425, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp425 : 0;
           }
-          Arr4DIdxRowM(tmp425, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp425 : 0;
         }
       }
     }
@@ -8055,48 +10185,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp426
    * at (3208,1-3208,37) */
   uint64_t __tmp_in_tmp426;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)992; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp426;
+  if (!binary_input::readArray(
+          tmp426,
+          ((int32_t)1 * (int32_t)992),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)992; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp426;
+      }
+      Arr1DIdxRowM(tmp426, (int32_t)992, i0) =
+          (party == SERVER) ? __tmp_in_tmp426 : 0;
     }
-    Arr1DIdxRowM(tmp426, (int32_t)992, i0) =
-        (party == SERVER) ? __tmp_in_tmp426 : 0;
   }
 
   uint64_t *tmp427 = make_array<uint64_t>((int32_t)992);
   /* Variable to read the clear value corresponding to the input variable tmp427
    * at (3211,1-3211,37) */
   uint64_t __tmp_in_tmp427;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)992; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp427;
+  if (!binary_input::readArray(
+          tmp427,
+          ((int32_t)1 * (int32_t)992),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)992; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp427;
+      }
+      Arr1DIdxRowM(tmp427, (int32_t)992, i0) =
+          (party == SERVER) ? __tmp_in_tmp427 : 0;
     }
-    Arr1DIdxRowM(tmp427, (int32_t)992, i0) =
-        (party == SERVER) ? __tmp_in_tmp427 : 0;
   }
 
   uint64_t *tmp428 = make_array<uint64_t>((int32_t)992);
   /* Variable to read the clear value corresponding to the input variable tmp428
    * at (3214,1-3214,37) */
   uint64_t __tmp_in_tmp428;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)992; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp428;
+  if (!binary_input::readArray(
+          tmp428,
+          ((int32_t)1 * (int32_t)992),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)992; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp428;
+      }
+      Arr1DIdxRowM(tmp428, (int32_t)992, i0) =
+          (party == SERVER) ? __tmp_in_tmp428 : 0;
     }
-    Arr1DIdxRowM(tmp428, (int32_t)992, i0) =
-        (party == SERVER) ? __tmp_in_tmp428 : 0;
   }
 
   uint64_t *tmp429 = make_array<uint64_t>((int32_t)992);
   /* Variable to read the clear value corresponding to the input variable tmp429
    * at (3217,1-3217,37) */
   uint64_t __tmp_in_tmp429;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)992; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp429;
+  if (!binary_input::readArray(
+          tmp429,
+          ((int32_t)1 * (int32_t)992),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)992; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp429;
+      }
+      Arr1DIdxRowM(tmp429, (int32_t)992, i0) =
+          (party == SERVER) ? __tmp_in_tmp429 : 0;
     }
-    Arr1DIdxRowM(tmp429, (int32_t)992, i0) =
-        (party == SERVER) ? __tmp_in_tmp429 : 0;
   }
 
   uint64_t *tmp430 =
@@ -8104,16 +10254,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp430
    * at (3220,1-3220,48) */
   uint64_t __tmp_in_tmp430;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)992; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp430;
+  if (!binary_input::readArray(
+          tmp430,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)992) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)992; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp430;
+            }
+            Arr4DIdxRowM(tmp430, (int32_t)1, (int32_t)1, (int32_t)992,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp430 : 0;
           }
-          Arr4DIdxRowM(tmp430, (int32_t)1, (int32_t)1, (int32_t)992,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp430 : 0;
         }
       }
     }
@@ -8123,48 +10278,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp431
    * at (3223,1-3223,37) */
   uint64_t __tmp_in_tmp431;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp431;
+  if (!binary_input::readArray(
+          tmp431,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp431;
+      }
+      Arr1DIdxRowM(tmp431, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp431 : 0;
     }
-    Arr1DIdxRowM(tmp431, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp431 : 0;
   }
 
   uint64_t *tmp432 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp432
    * at (3226,1-3226,37) */
   uint64_t __tmp_in_tmp432;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp432;
+  if (!binary_input::readArray(
+          tmp432,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp432;
+      }
+      Arr1DIdxRowM(tmp432, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp432 : 0;
     }
-    Arr1DIdxRowM(tmp432, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp432 : 0;
   }
 
   uint64_t *tmp433 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp433
    * at (3229,1-3229,37) */
   uint64_t __tmp_in_tmp433;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp433;
+  if (!binary_input::readArray(
+          tmp433,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp433;
+      }
+      Arr1DIdxRowM(tmp433, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp433 : 0;
     }
-    Arr1DIdxRowM(tmp433, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp433 : 0;
   }
 
   uint64_t *tmp434 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp434
    * at (3232,1-3232,37) */
   uint64_t __tmp_in_tmp434;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp434;
+  if (!binary_input::readArray(
+          tmp434,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp434;
+      }
+      Arr1DIdxRowM(tmp434, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp434 : 0;
     }
-    Arr1DIdxRowM(tmp434, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp434 : 0;
   }
 
   uint64_t *tmp435 =
@@ -8172,16 +10347,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp435
    * at (3235,1-3235,47) */
   uint64_t __tmp_in_tmp435;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp435;
+  if (!binary_input::readArray(
+          tmp435,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp435;
+            }
+            Arr4DIdxRowM(tmp435, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp435 : 0;
           }
-          Arr4DIdxRowM(tmp435, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp435 : 0;
         }
       }
     }
@@ -8191,48 +10371,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp436
    * at (3238,1-3238,38) */
   uint64_t __tmp_in_tmp436;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp436;
+  if (!binary_input::readArray(
+          tmp436,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp436;
+      }
+      Arr1DIdxRowM(tmp436, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp436 : 0;
     }
-    Arr1DIdxRowM(tmp436, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp436 : 0;
   }
 
   uint64_t *tmp437 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp437
    * at (3241,1-3241,38) */
   uint64_t __tmp_in_tmp437;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp437;
+  if (!binary_input::readArray(
+          tmp437,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp437;
+      }
+      Arr1DIdxRowM(tmp437, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp437 : 0;
     }
-    Arr1DIdxRowM(tmp437, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp437 : 0;
   }
 
   uint64_t *tmp438 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp438
    * at (3244,1-3244,38) */
   uint64_t __tmp_in_tmp438;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp438;
+  if (!binary_input::readArray(
+          tmp438,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp438;
+      }
+      Arr1DIdxRowM(tmp438, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp438 : 0;
     }
-    Arr1DIdxRowM(tmp438, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp438 : 0;
   }
 
   uint64_t *tmp439 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp439
    * at (3247,1-3247,38) */
   uint64_t __tmp_in_tmp439;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp439;
+  if (!binary_input::readArray(
+          tmp439,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp439;
+      }
+      Arr1DIdxRowM(tmp439, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp439 : 0;
     }
-    Arr1DIdxRowM(tmp439, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp439 : 0;
   }
 
   uint64_t *tmp440 =
@@ -8240,16 +10440,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp440
    * at (3250,1-3250,49) */
   uint64_t __tmp_in_tmp440;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp440;
+  if (!binary_input::readArray(
+          tmp440,
+          (((((int32_t)1 * (int32_t)512) * (int32_t)1024) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp440;
+            }
+            Arr4DIdxRowM(tmp440, (int32_t)1, (int32_t)1, (int32_t)1024,
+                         (int32_t)512, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp440 : 0;
           }
-          Arr4DIdxRowM(tmp440, (int32_t)1, (int32_t)1, (int32_t)1024,
-                       (int32_t)512, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp440 : 0;
         }
       }
     }
@@ -8259,48 +10464,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp441
    * at (3253,1-3253,37) */
   uint64_t __tmp_in_tmp441;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp441;
+  if (!binary_input::readArray(
+          tmp441,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp441;
+      }
+      Arr1DIdxRowM(tmp441, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp441 : 0;
     }
-    Arr1DIdxRowM(tmp441, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp441 : 0;
   }
 
   uint64_t *tmp442 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp442
    * at (3256,1-3256,37) */
   uint64_t __tmp_in_tmp442;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp442;
+  if (!binary_input::readArray(
+          tmp442,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp442;
+      }
+      Arr1DIdxRowM(tmp442, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp442 : 0;
     }
-    Arr1DIdxRowM(tmp442, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp442 : 0;
   }
 
   uint64_t *tmp443 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp443
    * at (3259,1-3259,37) */
   uint64_t __tmp_in_tmp443;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp443;
+  if (!binary_input::readArray(
+          tmp443,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp443;
+      }
+      Arr1DIdxRowM(tmp443, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp443 : 0;
     }
-    Arr1DIdxRowM(tmp443, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp443 : 0;
   }
 
   uint64_t *tmp444 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp444
    * at (3262,1-3262,37) */
   uint64_t __tmp_in_tmp444;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp444;
+  if (!binary_input::readArray(
+          tmp444,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp444;
+      }
+      Arr1DIdxRowM(tmp444, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp444 : 0;
     }
-    Arr1DIdxRowM(tmp444, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp444 : 0;
   }
 
   uint64_t *tmp445 =
@@ -8308,16 +10533,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp445
    * at (3265,1-3265,48) */
   uint64_t __tmp_in_tmp445;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp445;
+  if (!binary_input::readArray(
+          tmp445,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)512) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp445;
+            }
+            Arr4DIdxRowM(tmp445, (int32_t)1, (int32_t)1, (int32_t)512,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp445 : 0;
           }
-          Arr4DIdxRowM(tmp445, (int32_t)1, (int32_t)1, (int32_t)512,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp445 : 0;
         }
       }
     }
@@ -8327,48 +10557,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp446
    * at (3268,1-3268,37) */
   uint64_t __tmp_in_tmp446;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp446;
+  if (!binary_input::readArray(
+          tmp446,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp446;
+      }
+      Arr1DIdxRowM(tmp446, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp446 : 0;
     }
-    Arr1DIdxRowM(tmp446, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp446 : 0;
   }
 
   uint64_t *tmp447 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp447
    * at (3271,1-3271,37) */
   uint64_t __tmp_in_tmp447;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp447;
+  if (!binary_input::readArray(
+          tmp447,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp447;
+      }
+      Arr1DIdxRowM(tmp447, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp447 : 0;
     }
-    Arr1DIdxRowM(tmp447, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp447 : 0;
   }
 
   uint64_t *tmp448 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp448
    * at (3274,1-3274,37) */
   uint64_t __tmp_in_tmp448;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp448;
+  if (!binary_input::readArray(
+          tmp448,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp448;
+      }
+      Arr1DIdxRowM(tmp448, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp448 : 0;
     }
-    Arr1DIdxRowM(tmp448, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp448 : 0;
   }
 
   uint64_t *tmp449 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp449
    * at (3277,1-3277,37) */
   uint64_t __tmp_in_tmp449;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp449;
+  if (!binary_input::readArray(
+          tmp449,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp449;
+      }
+      Arr1DIdxRowM(tmp449, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp449 : 0;
     }
-    Arr1DIdxRowM(tmp449, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp449 : 0;
   }
 
   uint64_t *tmp450 =
@@ -8376,16 +10626,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp450
    * at (3280,1-3280,47) */
   uint64_t __tmp_in_tmp450;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp450;
+  if (!binary_input::readArray(
+          tmp450,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp450;
+            }
+            Arr4DIdxRowM(tmp450, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp450 : 0;
           }
-          Arr4DIdxRowM(tmp450, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp450 : 0;
         }
       }
     }
@@ -8395,48 +10650,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp451
    * at (3283,1-3283,37) */
   uint64_t __tmp_in_tmp451;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)544; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp451;
+  if (!binary_input::readArray(
+          tmp451,
+          ((int32_t)1 * (int32_t)544),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)544; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp451;
+      }
+      Arr1DIdxRowM(tmp451, (int32_t)544, i0) =
+          (party == SERVER) ? __tmp_in_tmp451 : 0;
     }
-    Arr1DIdxRowM(tmp451, (int32_t)544, i0) =
-        (party == SERVER) ? __tmp_in_tmp451 : 0;
   }
 
   uint64_t *tmp452 = make_array<uint64_t>((int32_t)544);
   /* Variable to read the clear value corresponding to the input variable tmp452
    * at (3286,1-3286,37) */
   uint64_t __tmp_in_tmp452;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)544; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp452;
+  if (!binary_input::readArray(
+          tmp452,
+          ((int32_t)1 * (int32_t)544),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)544; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp452;
+      }
+      Arr1DIdxRowM(tmp452, (int32_t)544, i0) =
+          (party == SERVER) ? __tmp_in_tmp452 : 0;
     }
-    Arr1DIdxRowM(tmp452, (int32_t)544, i0) =
-        (party == SERVER) ? __tmp_in_tmp452 : 0;
   }
 
   uint64_t *tmp453 = make_array<uint64_t>((int32_t)544);
   /* Variable to read the clear value corresponding to the input variable tmp453
    * at (3289,1-3289,37) */
   uint64_t __tmp_in_tmp453;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)544; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp453;
+  if (!binary_input::readArray(
+          tmp453,
+          ((int32_t)1 * (int32_t)544),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)544; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp453;
+      }
+      Arr1DIdxRowM(tmp453, (int32_t)544, i0) =
+          (party == SERVER) ? __tmp_in_tmp453 : 0;
     }
-    Arr1DIdxRowM(tmp453, (int32_t)544, i0) =
-        (party == SERVER) ? __tmp_in_tmp453 : 0;
   }
 
   uint64_t *tmp454 = make_array<uint64_t>((int32_t)544);
   /* Variable to read the clear value corresponding to the input variable tmp454
    * at (3292,1-3292,37) */
   uint64_t __tmp_in_tmp454;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)544; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp454;
+  if (!binary_input::readArray(
+          tmp454,
+          ((int32_t)1 * (int32_t)544),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)544; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp454;
+      }
+      Arr1DIdxRowM(tmp454, (int32_t)544, i0) =
+          (party == SERVER) ? __tmp_in_tmp454 : 0;
     }
-    Arr1DIdxRowM(tmp454, (int32_t)544, i0) =
-        (party == SERVER) ? __tmp_in_tmp454 : 0;
   }
 
   uint64_t *tmp455 =
@@ -8444,16 +10719,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp455
    * at (3295,1-3295,48) */
   uint64_t __tmp_in_tmp455;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)544; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp455;
+  if (!binary_input::readArray(
+          tmp455,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)544) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)544; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp455;
+            }
+            Arr4DIdxRowM(tmp455, (int32_t)1, (int32_t)1, (int32_t)544,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp455 : 0;
           }
-          Arr4DIdxRowM(tmp455, (int32_t)1, (int32_t)1, (int32_t)544,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp455 : 0;
         }
       }
     }
@@ -8463,48 +10743,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp456
    * at (3298,1-3298,37) */
   uint64_t __tmp_in_tmp456;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp456;
+  if (!binary_input::readArray(
+          tmp456,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp456;
+      }
+      Arr1DIdxRowM(tmp456, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp456 : 0;
     }
-    Arr1DIdxRowM(tmp456, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp456 : 0;
   }
 
   uint64_t *tmp457 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp457
    * at (3301,1-3301,37) */
   uint64_t __tmp_in_tmp457;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp457;
+  if (!binary_input::readArray(
+          tmp457,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp457;
+      }
+      Arr1DIdxRowM(tmp457, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp457 : 0;
     }
-    Arr1DIdxRowM(tmp457, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp457 : 0;
   }
 
   uint64_t *tmp458 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp458
    * at (3304,1-3304,37) */
   uint64_t __tmp_in_tmp458;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp458;
+  if (!binary_input::readArray(
+          tmp458,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp458;
+      }
+      Arr1DIdxRowM(tmp458, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp458 : 0;
     }
-    Arr1DIdxRowM(tmp458, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp458 : 0;
   }
 
   uint64_t *tmp459 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp459
    * at (3307,1-3307,37) */
   uint64_t __tmp_in_tmp459;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp459;
+  if (!binary_input::readArray(
+          tmp459,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp459;
+      }
+      Arr1DIdxRowM(tmp459, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp459 : 0;
     }
-    Arr1DIdxRowM(tmp459, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp459 : 0;
   }
 
   uint64_t *tmp460 =
@@ -8512,16 +10812,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp460
    * at (3310,1-3310,47) */
   uint64_t __tmp_in_tmp460;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp460;
+  if (!binary_input::readArray(
+          tmp460,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp460;
+            }
+            Arr4DIdxRowM(tmp460, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp460 : 0;
           }
-          Arr4DIdxRowM(tmp460, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp460 : 0;
         }
       }
     }
@@ -8531,48 +10836,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp461
    * at (3313,1-3313,37) */
   uint64_t __tmp_in_tmp461;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)576; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp461;
+  if (!binary_input::readArray(
+          tmp461,
+          ((int32_t)1 * (int32_t)576),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)576; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp461;
+      }
+      Arr1DIdxRowM(tmp461, (int32_t)576, i0) =
+          (party == SERVER) ? __tmp_in_tmp461 : 0;
     }
-    Arr1DIdxRowM(tmp461, (int32_t)576, i0) =
-        (party == SERVER) ? __tmp_in_tmp461 : 0;
   }
 
   uint64_t *tmp462 = make_array<uint64_t>((int32_t)576);
   /* Variable to read the clear value corresponding to the input variable tmp462
    * at (3316,1-3316,37) */
   uint64_t __tmp_in_tmp462;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)576; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp462;
+  if (!binary_input::readArray(
+          tmp462,
+          ((int32_t)1 * (int32_t)576),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)576; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp462;
+      }
+      Arr1DIdxRowM(tmp462, (int32_t)576, i0) =
+          (party == SERVER) ? __tmp_in_tmp462 : 0;
     }
-    Arr1DIdxRowM(tmp462, (int32_t)576, i0) =
-        (party == SERVER) ? __tmp_in_tmp462 : 0;
   }
 
   uint64_t *tmp463 = make_array<uint64_t>((int32_t)576);
   /* Variable to read the clear value corresponding to the input variable tmp463
    * at (3319,1-3319,37) */
   uint64_t __tmp_in_tmp463;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)576; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp463;
+  if (!binary_input::readArray(
+          tmp463,
+          ((int32_t)1 * (int32_t)576),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)576; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp463;
+      }
+      Arr1DIdxRowM(tmp463, (int32_t)576, i0) =
+          (party == SERVER) ? __tmp_in_tmp463 : 0;
     }
-    Arr1DIdxRowM(tmp463, (int32_t)576, i0) =
-        (party == SERVER) ? __tmp_in_tmp463 : 0;
   }
 
   uint64_t *tmp464 = make_array<uint64_t>((int32_t)576);
   /* Variable to read the clear value corresponding to the input variable tmp464
    * at (3322,1-3322,37) */
   uint64_t __tmp_in_tmp464;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)576; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp464;
+  if (!binary_input::readArray(
+          tmp464,
+          ((int32_t)1 * (int32_t)576),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)576; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp464;
+      }
+      Arr1DIdxRowM(tmp464, (int32_t)576, i0) =
+          (party == SERVER) ? __tmp_in_tmp464 : 0;
     }
-    Arr1DIdxRowM(tmp464, (int32_t)576, i0) =
-        (party == SERVER) ? __tmp_in_tmp464 : 0;
   }
 
   uint64_t *tmp465 =
@@ -8580,16 +10905,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp465
    * at (3325,1-3325,48) */
   uint64_t __tmp_in_tmp465;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)576; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp465;
+  if (!binary_input::readArray(
+          tmp465,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)576) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)576; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp465;
+            }
+            Arr4DIdxRowM(tmp465, (int32_t)1, (int32_t)1, (int32_t)576,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp465 : 0;
           }
-          Arr4DIdxRowM(tmp465, (int32_t)1, (int32_t)1, (int32_t)576,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp465 : 0;
         }
       }
     }
@@ -8599,48 +10929,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp466
    * at (3328,1-3328,37) */
   uint64_t __tmp_in_tmp466;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp466;
+  if (!binary_input::readArray(
+          tmp466,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp466;
+      }
+      Arr1DIdxRowM(tmp466, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp466 : 0;
     }
-    Arr1DIdxRowM(tmp466, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp466 : 0;
   }
 
   uint64_t *tmp467 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp467
    * at (3331,1-3331,37) */
   uint64_t __tmp_in_tmp467;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp467;
+  if (!binary_input::readArray(
+          tmp467,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp467;
+      }
+      Arr1DIdxRowM(tmp467, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp467 : 0;
     }
-    Arr1DIdxRowM(tmp467, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp467 : 0;
   }
 
   uint64_t *tmp468 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp468
    * at (3334,1-3334,37) */
   uint64_t __tmp_in_tmp468;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp468;
+  if (!binary_input::readArray(
+          tmp468,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp468;
+      }
+      Arr1DIdxRowM(tmp468, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp468 : 0;
     }
-    Arr1DIdxRowM(tmp468, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp468 : 0;
   }
 
   uint64_t *tmp469 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp469
    * at (3337,1-3337,37) */
   uint64_t __tmp_in_tmp469;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp469;
+  if (!binary_input::readArray(
+          tmp469,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp469;
+      }
+      Arr1DIdxRowM(tmp469, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp469 : 0;
     }
-    Arr1DIdxRowM(tmp469, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp469 : 0;
   }
 
   uint64_t *tmp470 =
@@ -8648,16 +10998,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp470
    * at (3340,1-3340,47) */
   uint64_t __tmp_in_tmp470;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp470;
+  if (!binary_input::readArray(
+          tmp470,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp470;
+            }
+            Arr4DIdxRowM(tmp470, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp470 : 0;
           }
-          Arr4DIdxRowM(tmp470, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp470 : 0;
         }
       }
     }
@@ -8667,48 +11022,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp471
    * at (3343,1-3343,37) */
   uint64_t __tmp_in_tmp471;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)608; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp471;
+  if (!binary_input::readArray(
+          tmp471,
+          ((int32_t)1 * (int32_t)608),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)608; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp471;
+      }
+      Arr1DIdxRowM(tmp471, (int32_t)608, i0) =
+          (party == SERVER) ? __tmp_in_tmp471 : 0;
     }
-    Arr1DIdxRowM(tmp471, (int32_t)608, i0) =
-        (party == SERVER) ? __tmp_in_tmp471 : 0;
   }
 
   uint64_t *tmp472 = make_array<uint64_t>((int32_t)608);
   /* Variable to read the clear value corresponding to the input variable tmp472
    * at (3346,1-3346,37) */
   uint64_t __tmp_in_tmp472;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)608; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp472;
+  if (!binary_input::readArray(
+          tmp472,
+          ((int32_t)1 * (int32_t)608),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)608; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp472;
+      }
+      Arr1DIdxRowM(tmp472, (int32_t)608, i0) =
+          (party == SERVER) ? __tmp_in_tmp472 : 0;
     }
-    Arr1DIdxRowM(tmp472, (int32_t)608, i0) =
-        (party == SERVER) ? __tmp_in_tmp472 : 0;
   }
 
   uint64_t *tmp473 = make_array<uint64_t>((int32_t)608);
   /* Variable to read the clear value corresponding to the input variable tmp473
    * at (3349,1-3349,37) */
   uint64_t __tmp_in_tmp473;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)608; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp473;
+  if (!binary_input::readArray(
+          tmp473,
+          ((int32_t)1 * (int32_t)608),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)608; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp473;
+      }
+      Arr1DIdxRowM(tmp473, (int32_t)608, i0) =
+          (party == SERVER) ? __tmp_in_tmp473 : 0;
     }
-    Arr1DIdxRowM(tmp473, (int32_t)608, i0) =
-        (party == SERVER) ? __tmp_in_tmp473 : 0;
   }
 
   uint64_t *tmp474 = make_array<uint64_t>((int32_t)608);
   /* Variable to read the clear value corresponding to the input variable tmp474
    * at (3352,1-3352,37) */
   uint64_t __tmp_in_tmp474;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)608; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp474;
+  if (!binary_input::readArray(
+          tmp474,
+          ((int32_t)1 * (int32_t)608),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)608; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp474;
+      }
+      Arr1DIdxRowM(tmp474, (int32_t)608, i0) =
+          (party == SERVER) ? __tmp_in_tmp474 : 0;
     }
-    Arr1DIdxRowM(tmp474, (int32_t)608, i0) =
-        (party == SERVER) ? __tmp_in_tmp474 : 0;
   }
 
   uint64_t *tmp475 =
@@ -8716,16 +11091,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp475
    * at (3355,1-3355,48) */
   uint64_t __tmp_in_tmp475;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)608; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp475;
+  if (!binary_input::readArray(
+          tmp475,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)608) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)608; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp475;
+            }
+            Arr4DIdxRowM(tmp475, (int32_t)1, (int32_t)1, (int32_t)608,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp475 : 0;
           }
-          Arr4DIdxRowM(tmp475, (int32_t)1, (int32_t)1, (int32_t)608,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp475 : 0;
         }
       }
     }
@@ -8735,48 +11115,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp476
    * at (3358,1-3358,37) */
   uint64_t __tmp_in_tmp476;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp476;
+  if (!binary_input::readArray(
+          tmp476,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp476;
+      }
+      Arr1DIdxRowM(tmp476, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp476 : 0;
     }
-    Arr1DIdxRowM(tmp476, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp476 : 0;
   }
 
   uint64_t *tmp477 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp477
    * at (3361,1-3361,37) */
   uint64_t __tmp_in_tmp477;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp477;
+  if (!binary_input::readArray(
+          tmp477,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp477;
+      }
+      Arr1DIdxRowM(tmp477, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp477 : 0;
     }
-    Arr1DIdxRowM(tmp477, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp477 : 0;
   }
 
   uint64_t *tmp478 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp478
    * at (3364,1-3364,37) */
   uint64_t __tmp_in_tmp478;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp478;
+  if (!binary_input::readArray(
+          tmp478,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp478;
+      }
+      Arr1DIdxRowM(tmp478, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp478 : 0;
     }
-    Arr1DIdxRowM(tmp478, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp478 : 0;
   }
 
   uint64_t *tmp479 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp479
    * at (3367,1-3367,37) */
   uint64_t __tmp_in_tmp479;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp479;
+  if (!binary_input::readArray(
+          tmp479,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp479;
+      }
+      Arr1DIdxRowM(tmp479, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp479 : 0;
     }
-    Arr1DIdxRowM(tmp479, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp479 : 0;
   }
 
   uint64_t *tmp480 =
@@ -8784,16 +11184,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp480
    * at (3370,1-3370,47) */
   uint64_t __tmp_in_tmp480;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp480;
+  if (!binary_input::readArray(
+          tmp480,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp480;
+            }
+            Arr4DIdxRowM(tmp480, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp480 : 0;
           }
-          Arr4DIdxRowM(tmp480, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp480 : 0;
         }
       }
     }
@@ -8803,48 +11208,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp481
    * at (3373,1-3373,37) */
   uint64_t __tmp_in_tmp481;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)640; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp481;
+  if (!binary_input::readArray(
+          tmp481,
+          ((int32_t)1 * (int32_t)640),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)640; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp481;
+      }
+      Arr1DIdxRowM(tmp481, (int32_t)640, i0) =
+          (party == SERVER) ? __tmp_in_tmp481 : 0;
     }
-    Arr1DIdxRowM(tmp481, (int32_t)640, i0) =
-        (party == SERVER) ? __tmp_in_tmp481 : 0;
   }
 
   uint64_t *tmp482 = make_array<uint64_t>((int32_t)640);
   /* Variable to read the clear value corresponding to the input variable tmp482
    * at (3376,1-3376,37) */
   uint64_t __tmp_in_tmp482;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)640; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp482;
+  if (!binary_input::readArray(
+          tmp482,
+          ((int32_t)1 * (int32_t)640),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)640; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp482;
+      }
+      Arr1DIdxRowM(tmp482, (int32_t)640, i0) =
+          (party == SERVER) ? __tmp_in_tmp482 : 0;
     }
-    Arr1DIdxRowM(tmp482, (int32_t)640, i0) =
-        (party == SERVER) ? __tmp_in_tmp482 : 0;
   }
 
   uint64_t *tmp483 = make_array<uint64_t>((int32_t)640);
   /* Variable to read the clear value corresponding to the input variable tmp483
    * at (3379,1-3379,37) */
   uint64_t __tmp_in_tmp483;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)640; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp483;
+  if (!binary_input::readArray(
+          tmp483,
+          ((int32_t)1 * (int32_t)640),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)640; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp483;
+      }
+      Arr1DIdxRowM(tmp483, (int32_t)640, i0) =
+          (party == SERVER) ? __tmp_in_tmp483 : 0;
     }
-    Arr1DIdxRowM(tmp483, (int32_t)640, i0) =
-        (party == SERVER) ? __tmp_in_tmp483 : 0;
   }
 
   uint64_t *tmp484 = make_array<uint64_t>((int32_t)640);
   /* Variable to read the clear value corresponding to the input variable tmp484
    * at (3382,1-3382,37) */
   uint64_t __tmp_in_tmp484;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)640; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp484;
+  if (!binary_input::readArray(
+          tmp484,
+          ((int32_t)1 * (int32_t)640),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)640; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp484;
+      }
+      Arr1DIdxRowM(tmp484, (int32_t)640, i0) =
+          (party == SERVER) ? __tmp_in_tmp484 : 0;
     }
-    Arr1DIdxRowM(tmp484, (int32_t)640, i0) =
-        (party == SERVER) ? __tmp_in_tmp484 : 0;
   }
 
   uint64_t *tmp485 =
@@ -8852,16 +11277,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp485
    * at (3385,1-3385,48) */
   uint64_t __tmp_in_tmp485;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)640; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp485;
+  if (!binary_input::readArray(
+          tmp485,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)640) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)640; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp485;
+            }
+            Arr4DIdxRowM(tmp485, (int32_t)1, (int32_t)1, (int32_t)640,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp485 : 0;
           }
-          Arr4DIdxRowM(tmp485, (int32_t)1, (int32_t)1, (int32_t)640,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp485 : 0;
         }
       }
     }
@@ -8871,48 +11301,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp486
    * at (3388,1-3388,37) */
   uint64_t __tmp_in_tmp486;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp486;
+  if (!binary_input::readArray(
+          tmp486,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp486;
+      }
+      Arr1DIdxRowM(tmp486, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp486 : 0;
     }
-    Arr1DIdxRowM(tmp486, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp486 : 0;
   }
 
   uint64_t *tmp487 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp487
    * at (3391,1-3391,37) */
   uint64_t __tmp_in_tmp487;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp487;
+  if (!binary_input::readArray(
+          tmp487,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp487;
+      }
+      Arr1DIdxRowM(tmp487, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp487 : 0;
     }
-    Arr1DIdxRowM(tmp487, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp487 : 0;
   }
 
   uint64_t *tmp488 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp488
    * at (3394,1-3394,37) */
   uint64_t __tmp_in_tmp488;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp488;
+  if (!binary_input::readArray(
+          tmp488,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp488;
+      }
+      Arr1DIdxRowM(tmp488, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp488 : 0;
     }
-    Arr1DIdxRowM(tmp488, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp488 : 0;
   }
 
   uint64_t *tmp489 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp489
    * at (3397,1-3397,37) */
   uint64_t __tmp_in_tmp489;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp489;
+  if (!binary_input::readArray(
+          tmp489,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp489;
+      }
+      Arr1DIdxRowM(tmp489, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp489 : 0;
     }
-    Arr1DIdxRowM(tmp489, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp489 : 0;
   }
 
   uint64_t *tmp490 =
@@ -8920,16 +11370,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp490
    * at (3400,1-3400,47) */
   uint64_t __tmp_in_tmp490;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp490;
+  if (!binary_input::readArray(
+          tmp490,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp490;
+            }
+            Arr4DIdxRowM(tmp490, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp490 : 0;
           }
-          Arr4DIdxRowM(tmp490, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp490 : 0;
         }
       }
     }
@@ -8939,48 +11394,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp491
    * at (3403,1-3403,37) */
   uint64_t __tmp_in_tmp491;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)672; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp491;
+  if (!binary_input::readArray(
+          tmp491,
+          ((int32_t)1 * (int32_t)672),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)672; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp491;
+      }
+      Arr1DIdxRowM(tmp491, (int32_t)672, i0) =
+          (party == SERVER) ? __tmp_in_tmp491 : 0;
     }
-    Arr1DIdxRowM(tmp491, (int32_t)672, i0) =
-        (party == SERVER) ? __tmp_in_tmp491 : 0;
   }
 
   uint64_t *tmp492 = make_array<uint64_t>((int32_t)672);
   /* Variable to read the clear value corresponding to the input variable tmp492
    * at (3406,1-3406,37) */
   uint64_t __tmp_in_tmp492;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)672; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp492;
+  if (!binary_input::readArray(
+          tmp492,
+          ((int32_t)1 * (int32_t)672),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)672; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp492;
+      }
+      Arr1DIdxRowM(tmp492, (int32_t)672, i0) =
+          (party == SERVER) ? __tmp_in_tmp492 : 0;
     }
-    Arr1DIdxRowM(tmp492, (int32_t)672, i0) =
-        (party == SERVER) ? __tmp_in_tmp492 : 0;
   }
 
   uint64_t *tmp493 = make_array<uint64_t>((int32_t)672);
   /* Variable to read the clear value corresponding to the input variable tmp493
    * at (3409,1-3409,37) */
   uint64_t __tmp_in_tmp493;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)672; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp493;
+  if (!binary_input::readArray(
+          tmp493,
+          ((int32_t)1 * (int32_t)672),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)672; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp493;
+      }
+      Arr1DIdxRowM(tmp493, (int32_t)672, i0) =
+          (party == SERVER) ? __tmp_in_tmp493 : 0;
     }
-    Arr1DIdxRowM(tmp493, (int32_t)672, i0) =
-        (party == SERVER) ? __tmp_in_tmp493 : 0;
   }
 
   uint64_t *tmp494 = make_array<uint64_t>((int32_t)672);
   /* Variable to read the clear value corresponding to the input variable tmp494
    * at (3412,1-3412,37) */
   uint64_t __tmp_in_tmp494;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)672; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp494;
+  if (!binary_input::readArray(
+          tmp494,
+          ((int32_t)1 * (int32_t)672),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)672; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp494;
+      }
+      Arr1DIdxRowM(tmp494, (int32_t)672, i0) =
+          (party == SERVER) ? __tmp_in_tmp494 : 0;
     }
-    Arr1DIdxRowM(tmp494, (int32_t)672, i0) =
-        (party == SERVER) ? __tmp_in_tmp494 : 0;
   }
 
   uint64_t *tmp495 =
@@ -8988,16 +11463,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp495
    * at (3415,1-3415,48) */
   uint64_t __tmp_in_tmp495;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)672; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp495;
+  if (!binary_input::readArray(
+          tmp495,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)672) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)672; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp495;
+            }
+            Arr4DIdxRowM(tmp495, (int32_t)1, (int32_t)1, (int32_t)672,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp495 : 0;
           }
-          Arr4DIdxRowM(tmp495, (int32_t)1, (int32_t)1, (int32_t)672,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp495 : 0;
         }
       }
     }
@@ -9007,48 +11487,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp496
    * at (3418,1-3418,37) */
   uint64_t __tmp_in_tmp496;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp496;
+  if (!binary_input::readArray(
+          tmp496,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp496;
+      }
+      Arr1DIdxRowM(tmp496, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp496 : 0;
     }
-    Arr1DIdxRowM(tmp496, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp496 : 0;
   }
 
   uint64_t *tmp497 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp497
    * at (3421,1-3421,37) */
   uint64_t __tmp_in_tmp497;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp497;
+  if (!binary_input::readArray(
+          tmp497,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp497;
+      }
+      Arr1DIdxRowM(tmp497, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp497 : 0;
     }
-    Arr1DIdxRowM(tmp497, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp497 : 0;
   }
 
   uint64_t *tmp498 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp498
    * at (3424,1-3424,37) */
   uint64_t __tmp_in_tmp498;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp498;
+  if (!binary_input::readArray(
+          tmp498,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp498;
+      }
+      Arr1DIdxRowM(tmp498, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp498 : 0;
     }
-    Arr1DIdxRowM(tmp498, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp498 : 0;
   }
 
   uint64_t *tmp499 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp499
    * at (3427,1-3427,37) */
   uint64_t __tmp_in_tmp499;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp499;
+  if (!binary_input::readArray(
+          tmp499,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp499;
+      }
+      Arr1DIdxRowM(tmp499, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp499 : 0;
     }
-    Arr1DIdxRowM(tmp499, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp499 : 0;
   }
 
   uint64_t *tmp500 =
@@ -9056,16 +11556,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp500
    * at (3430,1-3430,47) */
   uint64_t __tmp_in_tmp500;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp500;
+  if (!binary_input::readArray(
+          tmp500,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp500;
+            }
+            Arr4DIdxRowM(tmp500, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp500 : 0;
           }
-          Arr4DIdxRowM(tmp500, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp500 : 0;
         }
       }
     }
@@ -9075,48 +11580,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp501
    * at (3433,1-3433,37) */
   uint64_t __tmp_in_tmp501;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)704; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp501;
+  if (!binary_input::readArray(
+          tmp501,
+          ((int32_t)1 * (int32_t)704),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)704; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp501;
+      }
+      Arr1DIdxRowM(tmp501, (int32_t)704, i0) =
+          (party == SERVER) ? __tmp_in_tmp501 : 0;
     }
-    Arr1DIdxRowM(tmp501, (int32_t)704, i0) =
-        (party == SERVER) ? __tmp_in_tmp501 : 0;
   }
 
   uint64_t *tmp502 = make_array<uint64_t>((int32_t)704);
   /* Variable to read the clear value corresponding to the input variable tmp502
    * at (3436,1-3436,37) */
   uint64_t __tmp_in_tmp502;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)704; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp502;
+  if (!binary_input::readArray(
+          tmp502,
+          ((int32_t)1 * (int32_t)704),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)704; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp502;
+      }
+      Arr1DIdxRowM(tmp502, (int32_t)704, i0) =
+          (party == SERVER) ? __tmp_in_tmp502 : 0;
     }
-    Arr1DIdxRowM(tmp502, (int32_t)704, i0) =
-        (party == SERVER) ? __tmp_in_tmp502 : 0;
   }
 
   uint64_t *tmp503 = make_array<uint64_t>((int32_t)704);
   /* Variable to read the clear value corresponding to the input variable tmp503
    * at (3439,1-3439,37) */
   uint64_t __tmp_in_tmp503;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)704; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp503;
+  if (!binary_input::readArray(
+          tmp503,
+          ((int32_t)1 * (int32_t)704),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)704; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp503;
+      }
+      Arr1DIdxRowM(tmp503, (int32_t)704, i0) =
+          (party == SERVER) ? __tmp_in_tmp503 : 0;
     }
-    Arr1DIdxRowM(tmp503, (int32_t)704, i0) =
-        (party == SERVER) ? __tmp_in_tmp503 : 0;
   }
 
   uint64_t *tmp504 = make_array<uint64_t>((int32_t)704);
   /* Variable to read the clear value corresponding to the input variable tmp504
    * at (3442,1-3442,37) */
   uint64_t __tmp_in_tmp504;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)704; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp504;
+  if (!binary_input::readArray(
+          tmp504,
+          ((int32_t)1 * (int32_t)704),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)704; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp504;
+      }
+      Arr1DIdxRowM(tmp504, (int32_t)704, i0) =
+          (party == SERVER) ? __tmp_in_tmp504 : 0;
     }
-    Arr1DIdxRowM(tmp504, (int32_t)704, i0) =
-        (party == SERVER) ? __tmp_in_tmp504 : 0;
   }
 
   uint64_t *tmp505 =
@@ -9124,16 +11649,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp505
    * at (3445,1-3445,48) */
   uint64_t __tmp_in_tmp505;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)704; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp505;
+  if (!binary_input::readArray(
+          tmp505,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)704) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)704; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp505;
+            }
+            Arr4DIdxRowM(tmp505, (int32_t)1, (int32_t)1, (int32_t)704,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp505 : 0;
           }
-          Arr4DIdxRowM(tmp505, (int32_t)1, (int32_t)1, (int32_t)704,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp505 : 0;
         }
       }
     }
@@ -9143,48 +11673,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp506
    * at (3448,1-3448,37) */
   uint64_t __tmp_in_tmp506;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp506;
+  if (!binary_input::readArray(
+          tmp506,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp506;
+      }
+      Arr1DIdxRowM(tmp506, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp506 : 0;
     }
-    Arr1DIdxRowM(tmp506, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp506 : 0;
   }
 
   uint64_t *tmp507 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp507
    * at (3451,1-3451,37) */
   uint64_t __tmp_in_tmp507;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp507;
+  if (!binary_input::readArray(
+          tmp507,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp507;
+      }
+      Arr1DIdxRowM(tmp507, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp507 : 0;
     }
-    Arr1DIdxRowM(tmp507, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp507 : 0;
   }
 
   uint64_t *tmp508 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp508
    * at (3454,1-3454,37) */
   uint64_t __tmp_in_tmp508;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp508;
+  if (!binary_input::readArray(
+          tmp508,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp508;
+      }
+      Arr1DIdxRowM(tmp508, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp508 : 0;
     }
-    Arr1DIdxRowM(tmp508, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp508 : 0;
   }
 
   uint64_t *tmp509 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp509
    * at (3457,1-3457,37) */
   uint64_t __tmp_in_tmp509;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp509;
+  if (!binary_input::readArray(
+          tmp509,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp509;
+      }
+      Arr1DIdxRowM(tmp509, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp509 : 0;
     }
-    Arr1DIdxRowM(tmp509, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp509 : 0;
   }
 
   uint64_t *tmp510 =
@@ -9192,16 +11742,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp510
    * at (3460,1-3460,47) */
   uint64_t __tmp_in_tmp510;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp510;
+  if (!binary_input::readArray(
+          tmp510,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp510;
+            }
+            Arr4DIdxRowM(tmp510, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp510 : 0;
           }
-          Arr4DIdxRowM(tmp510, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp510 : 0;
         }
       }
     }
@@ -9211,48 +11766,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp511
    * at (3463,1-3463,37) */
   uint64_t __tmp_in_tmp511;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)736; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp511;
+  if (!binary_input::readArray(
+          tmp511,
+          ((int32_t)1 * (int32_t)736),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)736; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp511;
+      }
+      Arr1DIdxRowM(tmp511, (int32_t)736, i0) =
+          (party == SERVER) ? __tmp_in_tmp511 : 0;
     }
-    Arr1DIdxRowM(tmp511, (int32_t)736, i0) =
-        (party == SERVER) ? __tmp_in_tmp511 : 0;
   }
 
   uint64_t *tmp512 = make_array<uint64_t>((int32_t)736);
   /* Variable to read the clear value corresponding to the input variable tmp512
    * at (3466,1-3466,37) */
   uint64_t __tmp_in_tmp512;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)736; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp512;
+  if (!binary_input::readArray(
+          tmp512,
+          ((int32_t)1 * (int32_t)736),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)736; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp512;
+      }
+      Arr1DIdxRowM(tmp512, (int32_t)736, i0) =
+          (party == SERVER) ? __tmp_in_tmp512 : 0;
     }
-    Arr1DIdxRowM(tmp512, (int32_t)736, i0) =
-        (party == SERVER) ? __tmp_in_tmp512 : 0;
   }
 
   uint64_t *tmp513 = make_array<uint64_t>((int32_t)736);
   /* Variable to read the clear value corresponding to the input variable tmp513
    * at (3469,1-3469,37) */
   uint64_t __tmp_in_tmp513;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)736; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp513;
+  if (!binary_input::readArray(
+          tmp513,
+          ((int32_t)1 * (int32_t)736),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)736; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp513;
+      }
+      Arr1DIdxRowM(tmp513, (int32_t)736, i0) =
+          (party == SERVER) ? __tmp_in_tmp513 : 0;
     }
-    Arr1DIdxRowM(tmp513, (int32_t)736, i0) =
-        (party == SERVER) ? __tmp_in_tmp513 : 0;
   }
 
   uint64_t *tmp514 = make_array<uint64_t>((int32_t)736);
   /* Variable to read the clear value corresponding to the input variable tmp514
    * at (3472,1-3472,37) */
   uint64_t __tmp_in_tmp514;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)736; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp514;
+  if (!binary_input::readArray(
+          tmp514,
+          ((int32_t)1 * (int32_t)736),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)736; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp514;
+      }
+      Arr1DIdxRowM(tmp514, (int32_t)736, i0) =
+          (party == SERVER) ? __tmp_in_tmp514 : 0;
     }
-    Arr1DIdxRowM(tmp514, (int32_t)736, i0) =
-        (party == SERVER) ? __tmp_in_tmp514 : 0;
   }
 
   uint64_t *tmp515 =
@@ -9260,16 +11835,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp515
    * at (3475,1-3475,48) */
   uint64_t __tmp_in_tmp515;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)736; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp515;
+  if (!binary_input::readArray(
+          tmp515,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)736) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)736; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp515;
+            }
+            Arr4DIdxRowM(tmp515, (int32_t)1, (int32_t)1, (int32_t)736,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp515 : 0;
           }
-          Arr4DIdxRowM(tmp515, (int32_t)1, (int32_t)1, (int32_t)736,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp515 : 0;
         }
       }
     }
@@ -9279,48 +11859,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp516
    * at (3478,1-3478,37) */
   uint64_t __tmp_in_tmp516;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp516;
+  if (!binary_input::readArray(
+          tmp516,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp516;
+      }
+      Arr1DIdxRowM(tmp516, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp516 : 0;
     }
-    Arr1DIdxRowM(tmp516, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp516 : 0;
   }
 
   uint64_t *tmp517 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp517
    * at (3481,1-3481,37) */
   uint64_t __tmp_in_tmp517;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp517;
+  if (!binary_input::readArray(
+          tmp517,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp517;
+      }
+      Arr1DIdxRowM(tmp517, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp517 : 0;
     }
-    Arr1DIdxRowM(tmp517, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp517 : 0;
   }
 
   uint64_t *tmp518 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp518
    * at (3484,1-3484,37) */
   uint64_t __tmp_in_tmp518;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp518;
+  if (!binary_input::readArray(
+          tmp518,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp518;
+      }
+      Arr1DIdxRowM(tmp518, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp518 : 0;
     }
-    Arr1DIdxRowM(tmp518, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp518 : 0;
   }
 
   uint64_t *tmp519 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp519
    * at (3487,1-3487,37) */
   uint64_t __tmp_in_tmp519;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp519;
+  if (!binary_input::readArray(
+          tmp519,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp519;
+      }
+      Arr1DIdxRowM(tmp519, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp519 : 0;
     }
-    Arr1DIdxRowM(tmp519, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp519 : 0;
   }
 
   uint64_t *tmp520 =
@@ -9328,16 +11928,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp520
    * at (3490,1-3490,47) */
   uint64_t __tmp_in_tmp520;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp520;
+  if (!binary_input::readArray(
+          tmp520,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp520;
+            }
+            Arr4DIdxRowM(tmp520, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp520 : 0;
           }
-          Arr4DIdxRowM(tmp520, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp520 : 0;
         }
       }
     }
@@ -9347,48 +11952,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp521
    * at (3493,1-3493,37) */
   uint64_t __tmp_in_tmp521;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)768; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp521;
+  if (!binary_input::readArray(
+          tmp521,
+          ((int32_t)1 * (int32_t)768),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)768; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp521;
+      }
+      Arr1DIdxRowM(tmp521, (int32_t)768, i0) =
+          (party == SERVER) ? __tmp_in_tmp521 : 0;
     }
-    Arr1DIdxRowM(tmp521, (int32_t)768, i0) =
-        (party == SERVER) ? __tmp_in_tmp521 : 0;
   }
 
   uint64_t *tmp522 = make_array<uint64_t>((int32_t)768);
   /* Variable to read the clear value corresponding to the input variable tmp522
    * at (3496,1-3496,37) */
   uint64_t __tmp_in_tmp522;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)768; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp522;
+  if (!binary_input::readArray(
+          tmp522,
+          ((int32_t)1 * (int32_t)768),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)768; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp522;
+      }
+      Arr1DIdxRowM(tmp522, (int32_t)768, i0) =
+          (party == SERVER) ? __tmp_in_tmp522 : 0;
     }
-    Arr1DIdxRowM(tmp522, (int32_t)768, i0) =
-        (party == SERVER) ? __tmp_in_tmp522 : 0;
   }
 
   uint64_t *tmp523 = make_array<uint64_t>((int32_t)768);
   /* Variable to read the clear value corresponding to the input variable tmp523
    * at (3499,1-3499,37) */
   uint64_t __tmp_in_tmp523;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)768; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp523;
+  if (!binary_input::readArray(
+          tmp523,
+          ((int32_t)1 * (int32_t)768),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)768; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp523;
+      }
+      Arr1DIdxRowM(tmp523, (int32_t)768, i0) =
+          (party == SERVER) ? __tmp_in_tmp523 : 0;
     }
-    Arr1DIdxRowM(tmp523, (int32_t)768, i0) =
-        (party == SERVER) ? __tmp_in_tmp523 : 0;
   }
 
   uint64_t *tmp524 = make_array<uint64_t>((int32_t)768);
   /* Variable to read the clear value corresponding to the input variable tmp524
    * at (3502,1-3502,37) */
   uint64_t __tmp_in_tmp524;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)768; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp524;
+  if (!binary_input::readArray(
+          tmp524,
+          ((int32_t)1 * (int32_t)768),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)768; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp524;
+      }
+      Arr1DIdxRowM(tmp524, (int32_t)768, i0) =
+          (party == SERVER) ? __tmp_in_tmp524 : 0;
     }
-    Arr1DIdxRowM(tmp524, (int32_t)768, i0) =
-        (party == SERVER) ? __tmp_in_tmp524 : 0;
   }
 
   uint64_t *tmp525 =
@@ -9396,16 +12021,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp525
    * at (3505,1-3505,48) */
   uint64_t __tmp_in_tmp525;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)768; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp525;
+  if (!binary_input::readArray(
+          tmp525,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)768) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)768; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp525;
+            }
+            Arr4DIdxRowM(tmp525, (int32_t)1, (int32_t)1, (int32_t)768,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp525 : 0;
           }
-          Arr4DIdxRowM(tmp525, (int32_t)1, (int32_t)1, (int32_t)768,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp525 : 0;
         }
       }
     }
@@ -9415,48 +12045,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp526
    * at (3508,1-3508,37) */
   uint64_t __tmp_in_tmp526;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp526;
+  if (!binary_input::readArray(
+          tmp526,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp526;
+      }
+      Arr1DIdxRowM(tmp526, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp526 : 0;
     }
-    Arr1DIdxRowM(tmp526, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp526 : 0;
   }
 
   uint64_t *tmp527 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp527
    * at (3511,1-3511,37) */
   uint64_t __tmp_in_tmp527;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp527;
+  if (!binary_input::readArray(
+          tmp527,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp527;
+      }
+      Arr1DIdxRowM(tmp527, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp527 : 0;
     }
-    Arr1DIdxRowM(tmp527, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp527 : 0;
   }
 
   uint64_t *tmp528 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp528
    * at (3514,1-3514,37) */
   uint64_t __tmp_in_tmp528;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp528;
+  if (!binary_input::readArray(
+          tmp528,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp528;
+      }
+      Arr1DIdxRowM(tmp528, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp528 : 0;
     }
-    Arr1DIdxRowM(tmp528, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp528 : 0;
   }
 
   uint64_t *tmp529 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp529
    * at (3517,1-3517,37) */
   uint64_t __tmp_in_tmp529;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp529;
+  if (!binary_input::readArray(
+          tmp529,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp529;
+      }
+      Arr1DIdxRowM(tmp529, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp529 : 0;
     }
-    Arr1DIdxRowM(tmp529, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp529 : 0;
   }
 
   uint64_t *tmp530 =
@@ -9464,16 +12114,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp530
    * at (3520,1-3520,47) */
   uint64_t __tmp_in_tmp530;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp530;
+  if (!binary_input::readArray(
+          tmp530,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp530;
+            }
+            Arr4DIdxRowM(tmp530, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp530 : 0;
           }
-          Arr4DIdxRowM(tmp530, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp530 : 0;
         }
       }
     }
@@ -9483,48 +12138,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp531
    * at (3523,1-3523,37) */
   uint64_t __tmp_in_tmp531;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)800; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp531;
+  if (!binary_input::readArray(
+          tmp531,
+          ((int32_t)1 * (int32_t)800),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)800; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp531;
+      }
+      Arr1DIdxRowM(tmp531, (int32_t)800, i0) =
+          (party == SERVER) ? __tmp_in_tmp531 : 0;
     }
-    Arr1DIdxRowM(tmp531, (int32_t)800, i0) =
-        (party == SERVER) ? __tmp_in_tmp531 : 0;
   }
 
   uint64_t *tmp532 = make_array<uint64_t>((int32_t)800);
   /* Variable to read the clear value corresponding to the input variable tmp532
    * at (3526,1-3526,37) */
   uint64_t __tmp_in_tmp532;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)800; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp532;
+  if (!binary_input::readArray(
+          tmp532,
+          ((int32_t)1 * (int32_t)800),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)800; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp532;
+      }
+      Arr1DIdxRowM(tmp532, (int32_t)800, i0) =
+          (party == SERVER) ? __tmp_in_tmp532 : 0;
     }
-    Arr1DIdxRowM(tmp532, (int32_t)800, i0) =
-        (party == SERVER) ? __tmp_in_tmp532 : 0;
   }
 
   uint64_t *tmp533 = make_array<uint64_t>((int32_t)800);
   /* Variable to read the clear value corresponding to the input variable tmp533
    * at (3529,1-3529,37) */
   uint64_t __tmp_in_tmp533;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)800; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp533;
+  if (!binary_input::readArray(
+          tmp533,
+          ((int32_t)1 * (int32_t)800),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)800; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp533;
+      }
+      Arr1DIdxRowM(tmp533, (int32_t)800, i0) =
+          (party == SERVER) ? __tmp_in_tmp533 : 0;
     }
-    Arr1DIdxRowM(tmp533, (int32_t)800, i0) =
-        (party == SERVER) ? __tmp_in_tmp533 : 0;
   }
 
   uint64_t *tmp534 = make_array<uint64_t>((int32_t)800);
   /* Variable to read the clear value corresponding to the input variable tmp534
    * at (3532,1-3532,37) */
   uint64_t __tmp_in_tmp534;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)800; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp534;
+  if (!binary_input::readArray(
+          tmp534,
+          ((int32_t)1 * (int32_t)800),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)800; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp534;
+      }
+      Arr1DIdxRowM(tmp534, (int32_t)800, i0) =
+          (party == SERVER) ? __tmp_in_tmp534 : 0;
     }
-    Arr1DIdxRowM(tmp534, (int32_t)800, i0) =
-        (party == SERVER) ? __tmp_in_tmp534 : 0;
   }
 
   uint64_t *tmp535 =
@@ -9532,16 +12207,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp535
    * at (3535,1-3535,48) */
   uint64_t __tmp_in_tmp535;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)800; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp535;
+  if (!binary_input::readArray(
+          tmp535,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)800) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)800; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp535;
+            }
+            Arr4DIdxRowM(tmp535, (int32_t)1, (int32_t)1, (int32_t)800,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp535 : 0;
           }
-          Arr4DIdxRowM(tmp535, (int32_t)1, (int32_t)1, (int32_t)800,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp535 : 0;
         }
       }
     }
@@ -9551,48 +12231,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp536
    * at (3538,1-3538,37) */
   uint64_t __tmp_in_tmp536;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp536;
+  if (!binary_input::readArray(
+          tmp536,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp536;
+      }
+      Arr1DIdxRowM(tmp536, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp536 : 0;
     }
-    Arr1DIdxRowM(tmp536, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp536 : 0;
   }
 
   uint64_t *tmp537 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp537
    * at (3541,1-3541,37) */
   uint64_t __tmp_in_tmp537;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp537;
+  if (!binary_input::readArray(
+          tmp537,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp537;
+      }
+      Arr1DIdxRowM(tmp537, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp537 : 0;
     }
-    Arr1DIdxRowM(tmp537, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp537 : 0;
   }
 
   uint64_t *tmp538 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp538
    * at (3544,1-3544,37) */
   uint64_t __tmp_in_tmp538;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp538;
+  if (!binary_input::readArray(
+          tmp538,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp538;
+      }
+      Arr1DIdxRowM(tmp538, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp538 : 0;
     }
-    Arr1DIdxRowM(tmp538, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp538 : 0;
   }
 
   uint64_t *tmp539 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp539
    * at (3547,1-3547,37) */
   uint64_t __tmp_in_tmp539;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp539;
+  if (!binary_input::readArray(
+          tmp539,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp539;
+      }
+      Arr1DIdxRowM(tmp539, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp539 : 0;
     }
-    Arr1DIdxRowM(tmp539, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp539 : 0;
   }
 
   uint64_t *tmp540 =
@@ -9600,16 +12300,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp540
    * at (3550,1-3550,47) */
   uint64_t __tmp_in_tmp540;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp540;
+  if (!binary_input::readArray(
+          tmp540,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp540;
+            }
+            Arr4DIdxRowM(tmp540, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp540 : 0;
           }
-          Arr4DIdxRowM(tmp540, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp540 : 0;
         }
       }
     }
@@ -9619,48 +12324,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp541
    * at (3553,1-3553,37) */
   uint64_t __tmp_in_tmp541;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)832; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp541;
+  if (!binary_input::readArray(
+          tmp541,
+          ((int32_t)1 * (int32_t)832),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)832; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp541;
+      }
+      Arr1DIdxRowM(tmp541, (int32_t)832, i0) =
+          (party == SERVER) ? __tmp_in_tmp541 : 0;
     }
-    Arr1DIdxRowM(tmp541, (int32_t)832, i0) =
-        (party == SERVER) ? __tmp_in_tmp541 : 0;
   }
 
   uint64_t *tmp542 = make_array<uint64_t>((int32_t)832);
   /* Variable to read the clear value corresponding to the input variable tmp542
    * at (3556,1-3556,37) */
   uint64_t __tmp_in_tmp542;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)832; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp542;
+  if (!binary_input::readArray(
+          tmp542,
+          ((int32_t)1 * (int32_t)832),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)832; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp542;
+      }
+      Arr1DIdxRowM(tmp542, (int32_t)832, i0) =
+          (party == SERVER) ? __tmp_in_tmp542 : 0;
     }
-    Arr1DIdxRowM(tmp542, (int32_t)832, i0) =
-        (party == SERVER) ? __tmp_in_tmp542 : 0;
   }
 
   uint64_t *tmp543 = make_array<uint64_t>((int32_t)832);
   /* Variable to read the clear value corresponding to the input variable tmp543
    * at (3559,1-3559,37) */
   uint64_t __tmp_in_tmp543;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)832; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp543;
+  if (!binary_input::readArray(
+          tmp543,
+          ((int32_t)1 * (int32_t)832),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)832; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp543;
+      }
+      Arr1DIdxRowM(tmp543, (int32_t)832, i0) =
+          (party == SERVER) ? __tmp_in_tmp543 : 0;
     }
-    Arr1DIdxRowM(tmp543, (int32_t)832, i0) =
-        (party == SERVER) ? __tmp_in_tmp543 : 0;
   }
 
   uint64_t *tmp544 = make_array<uint64_t>((int32_t)832);
   /* Variable to read the clear value corresponding to the input variable tmp544
    * at (3562,1-3562,37) */
   uint64_t __tmp_in_tmp544;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)832; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp544;
+  if (!binary_input::readArray(
+          tmp544,
+          ((int32_t)1 * (int32_t)832),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)832; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp544;
+      }
+      Arr1DIdxRowM(tmp544, (int32_t)832, i0) =
+          (party == SERVER) ? __tmp_in_tmp544 : 0;
     }
-    Arr1DIdxRowM(tmp544, (int32_t)832, i0) =
-        (party == SERVER) ? __tmp_in_tmp544 : 0;
   }
 
   uint64_t *tmp545 =
@@ -9668,16 +12393,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp545
    * at (3565,1-3565,48) */
   uint64_t __tmp_in_tmp545;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)832; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp545;
+  if (!binary_input::readArray(
+          tmp545,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)832) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)832; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp545;
+            }
+            Arr4DIdxRowM(tmp545, (int32_t)1, (int32_t)1, (int32_t)832,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp545 : 0;
           }
-          Arr4DIdxRowM(tmp545, (int32_t)1, (int32_t)1, (int32_t)832,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp545 : 0;
         }
       }
     }
@@ -9687,48 +12417,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp546
    * at (3568,1-3568,37) */
   uint64_t __tmp_in_tmp546;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp546;
+  if (!binary_input::readArray(
+          tmp546,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp546;
+      }
+      Arr1DIdxRowM(tmp546, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp546 : 0;
     }
-    Arr1DIdxRowM(tmp546, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp546 : 0;
   }
 
   uint64_t *tmp547 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp547
    * at (3571,1-3571,37) */
   uint64_t __tmp_in_tmp547;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp547;
+  if (!binary_input::readArray(
+          tmp547,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp547;
+      }
+      Arr1DIdxRowM(tmp547, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp547 : 0;
     }
-    Arr1DIdxRowM(tmp547, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp547 : 0;
   }
 
   uint64_t *tmp548 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp548
    * at (3574,1-3574,37) */
   uint64_t __tmp_in_tmp548;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp548;
+  if (!binary_input::readArray(
+          tmp548,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp548;
+      }
+      Arr1DIdxRowM(tmp548, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp548 : 0;
     }
-    Arr1DIdxRowM(tmp548, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp548 : 0;
   }
 
   uint64_t *tmp549 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp549
    * at (3577,1-3577,37) */
   uint64_t __tmp_in_tmp549;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp549;
+  if (!binary_input::readArray(
+          tmp549,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp549;
+      }
+      Arr1DIdxRowM(tmp549, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp549 : 0;
     }
-    Arr1DIdxRowM(tmp549, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp549 : 0;
   }
 
   uint64_t *tmp550 =
@@ -9736,16 +12486,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp550
    * at (3580,1-3580,47) */
   uint64_t __tmp_in_tmp550;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp550;
+  if (!binary_input::readArray(
+          tmp550,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp550;
+            }
+            Arr4DIdxRowM(tmp550, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp550 : 0;
           }
-          Arr4DIdxRowM(tmp550, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp550 : 0;
         }
       }
     }
@@ -9755,48 +12510,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp551
    * at (3583,1-3583,37) */
   uint64_t __tmp_in_tmp551;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)864; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp551;
+  if (!binary_input::readArray(
+          tmp551,
+          ((int32_t)1 * (int32_t)864),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)864; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp551;
+      }
+      Arr1DIdxRowM(tmp551, (int32_t)864, i0) =
+          (party == SERVER) ? __tmp_in_tmp551 : 0;
     }
-    Arr1DIdxRowM(tmp551, (int32_t)864, i0) =
-        (party == SERVER) ? __tmp_in_tmp551 : 0;
   }
 
   uint64_t *tmp552 = make_array<uint64_t>((int32_t)864);
   /* Variable to read the clear value corresponding to the input variable tmp552
    * at (3586,1-3586,37) */
   uint64_t __tmp_in_tmp552;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)864; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp552;
+  if (!binary_input::readArray(
+          tmp552,
+          ((int32_t)1 * (int32_t)864),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)864; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp552;
+      }
+      Arr1DIdxRowM(tmp552, (int32_t)864, i0) =
+          (party == SERVER) ? __tmp_in_tmp552 : 0;
     }
-    Arr1DIdxRowM(tmp552, (int32_t)864, i0) =
-        (party == SERVER) ? __tmp_in_tmp552 : 0;
   }
 
   uint64_t *tmp553 = make_array<uint64_t>((int32_t)864);
   /* Variable to read the clear value corresponding to the input variable tmp553
    * at (3589,1-3589,37) */
   uint64_t __tmp_in_tmp553;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)864; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp553;
+  if (!binary_input::readArray(
+          tmp553,
+          ((int32_t)1 * (int32_t)864),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)864; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp553;
+      }
+      Arr1DIdxRowM(tmp553, (int32_t)864, i0) =
+          (party == SERVER) ? __tmp_in_tmp553 : 0;
     }
-    Arr1DIdxRowM(tmp553, (int32_t)864, i0) =
-        (party == SERVER) ? __tmp_in_tmp553 : 0;
   }
 
   uint64_t *tmp554 = make_array<uint64_t>((int32_t)864);
   /* Variable to read the clear value corresponding to the input variable tmp554
    * at (3592,1-3592,37) */
   uint64_t __tmp_in_tmp554;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)864; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp554;
+  if (!binary_input::readArray(
+          tmp554,
+          ((int32_t)1 * (int32_t)864),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)864; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp554;
+      }
+      Arr1DIdxRowM(tmp554, (int32_t)864, i0) =
+          (party == SERVER) ? __tmp_in_tmp554 : 0;
     }
-    Arr1DIdxRowM(tmp554, (int32_t)864, i0) =
-        (party == SERVER) ? __tmp_in_tmp554 : 0;
   }
 
   uint64_t *tmp555 =
@@ -9804,16 +12579,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp555
    * at (3595,1-3595,48) */
   uint64_t __tmp_in_tmp555;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)864; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp555;
+  if (!binary_input::readArray(
+          tmp555,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)864) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)864; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp555;
+            }
+            Arr4DIdxRowM(tmp555, (int32_t)1, (int32_t)1, (int32_t)864,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp555 : 0;
           }
-          Arr4DIdxRowM(tmp555, (int32_t)1, (int32_t)1, (int32_t)864,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp555 : 0;
         }
       }
     }
@@ -9823,48 +12603,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp556
    * at (3598,1-3598,37) */
   uint64_t __tmp_in_tmp556;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp556;
+  if (!binary_input::readArray(
+          tmp556,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp556;
+      }
+      Arr1DIdxRowM(tmp556, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp556 : 0;
     }
-    Arr1DIdxRowM(tmp556, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp556 : 0;
   }
 
   uint64_t *tmp557 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp557
    * at (3601,1-3601,37) */
   uint64_t __tmp_in_tmp557;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp557;
+  if (!binary_input::readArray(
+          tmp557,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp557;
+      }
+      Arr1DIdxRowM(tmp557, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp557 : 0;
     }
-    Arr1DIdxRowM(tmp557, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp557 : 0;
   }
 
   uint64_t *tmp558 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp558
    * at (3604,1-3604,37) */
   uint64_t __tmp_in_tmp558;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp558;
+  if (!binary_input::readArray(
+          tmp558,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp558;
+      }
+      Arr1DIdxRowM(tmp558, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp558 : 0;
     }
-    Arr1DIdxRowM(tmp558, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp558 : 0;
   }
 
   uint64_t *tmp559 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp559
    * at (3607,1-3607,37) */
   uint64_t __tmp_in_tmp559;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp559;
+  if (!binary_input::readArray(
+          tmp559,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp559;
+      }
+      Arr1DIdxRowM(tmp559, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp559 : 0;
     }
-    Arr1DIdxRowM(tmp559, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp559 : 0;
   }
 
   uint64_t *tmp560 =
@@ -9872,16 +12672,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp560
    * at (3610,1-3610,47) */
   uint64_t __tmp_in_tmp560;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp560;
+  if (!binary_input::readArray(
+          tmp560,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp560;
+            }
+            Arr4DIdxRowM(tmp560, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp560 : 0;
           }
-          Arr4DIdxRowM(tmp560, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp560 : 0;
         }
       }
     }
@@ -9891,48 +12696,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp561
    * at (3613,1-3613,37) */
   uint64_t __tmp_in_tmp561;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)896; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp561;
+  if (!binary_input::readArray(
+          tmp561,
+          ((int32_t)1 * (int32_t)896),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)896; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp561;
+      }
+      Arr1DIdxRowM(tmp561, (int32_t)896, i0) =
+          (party == SERVER) ? __tmp_in_tmp561 : 0;
     }
-    Arr1DIdxRowM(tmp561, (int32_t)896, i0) =
-        (party == SERVER) ? __tmp_in_tmp561 : 0;
   }
 
   uint64_t *tmp562 = make_array<uint64_t>((int32_t)896);
   /* Variable to read the clear value corresponding to the input variable tmp562
    * at (3616,1-3616,37) */
   uint64_t __tmp_in_tmp562;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)896; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp562;
+  if (!binary_input::readArray(
+          tmp562,
+          ((int32_t)1 * (int32_t)896),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)896; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp562;
+      }
+      Arr1DIdxRowM(tmp562, (int32_t)896, i0) =
+          (party == SERVER) ? __tmp_in_tmp562 : 0;
     }
-    Arr1DIdxRowM(tmp562, (int32_t)896, i0) =
-        (party == SERVER) ? __tmp_in_tmp562 : 0;
   }
 
   uint64_t *tmp563 = make_array<uint64_t>((int32_t)896);
   /* Variable to read the clear value corresponding to the input variable tmp563
    * at (3619,1-3619,37) */
   uint64_t __tmp_in_tmp563;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)896; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp563;
+  if (!binary_input::readArray(
+          tmp563,
+          ((int32_t)1 * (int32_t)896),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)896; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp563;
+      }
+      Arr1DIdxRowM(tmp563, (int32_t)896, i0) =
+          (party == SERVER) ? __tmp_in_tmp563 : 0;
     }
-    Arr1DIdxRowM(tmp563, (int32_t)896, i0) =
-        (party == SERVER) ? __tmp_in_tmp563 : 0;
   }
 
   uint64_t *tmp564 = make_array<uint64_t>((int32_t)896);
   /* Variable to read the clear value corresponding to the input variable tmp564
    * at (3622,1-3622,37) */
   uint64_t __tmp_in_tmp564;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)896; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp564;
+  if (!binary_input::readArray(
+          tmp564,
+          ((int32_t)1 * (int32_t)896),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)896; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp564;
+      }
+      Arr1DIdxRowM(tmp564, (int32_t)896, i0) =
+          (party == SERVER) ? __tmp_in_tmp564 : 0;
     }
-    Arr1DIdxRowM(tmp564, (int32_t)896, i0) =
-        (party == SERVER) ? __tmp_in_tmp564 : 0;
   }
 
   uint64_t *tmp565 =
@@ -9940,16 +12765,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp565
    * at (3625,1-3625,48) */
   uint64_t __tmp_in_tmp565;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)896; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp565;
+  if (!binary_input::readArray(
+          tmp565,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)896) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)896; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp565;
+            }
+            Arr4DIdxRowM(tmp565, (int32_t)1, (int32_t)1, (int32_t)896,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp565 : 0;
           }
-          Arr4DIdxRowM(tmp565, (int32_t)1, (int32_t)1, (int32_t)896,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp565 : 0;
         }
       }
     }
@@ -9959,48 +12789,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp566
    * at (3628,1-3628,37) */
   uint64_t __tmp_in_tmp566;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp566;
+  if (!binary_input::readArray(
+          tmp566,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp566;
+      }
+      Arr1DIdxRowM(tmp566, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp566 : 0;
     }
-    Arr1DIdxRowM(tmp566, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp566 : 0;
   }
 
   uint64_t *tmp567 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp567
    * at (3631,1-3631,37) */
   uint64_t __tmp_in_tmp567;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp567;
+  if (!binary_input::readArray(
+          tmp567,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp567;
+      }
+      Arr1DIdxRowM(tmp567, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp567 : 0;
     }
-    Arr1DIdxRowM(tmp567, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp567 : 0;
   }
 
   uint64_t *tmp568 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp568
    * at (3634,1-3634,37) */
   uint64_t __tmp_in_tmp568;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp568;
+  if (!binary_input::readArray(
+          tmp568,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp568;
+      }
+      Arr1DIdxRowM(tmp568, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp568 : 0;
     }
-    Arr1DIdxRowM(tmp568, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp568 : 0;
   }
 
   uint64_t *tmp569 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp569
    * at (3637,1-3637,37) */
   uint64_t __tmp_in_tmp569;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp569;
+  if (!binary_input::readArray(
+          tmp569,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp569;
+      }
+      Arr1DIdxRowM(tmp569, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp569 : 0;
     }
-    Arr1DIdxRowM(tmp569, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp569 : 0;
   }
 
   uint64_t *tmp570 =
@@ -10008,16 +12858,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp570
    * at (3640,1-3640,47) */
   uint64_t __tmp_in_tmp570;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp570;
+  if (!binary_input::readArray(
+          tmp570,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp570;
+            }
+            Arr4DIdxRowM(tmp570, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp570 : 0;
           }
-          Arr4DIdxRowM(tmp570, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp570 : 0;
         }
       }
     }
@@ -10027,48 +12882,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp571
    * at (3643,1-3643,37) */
   uint64_t __tmp_in_tmp571;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)928; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp571;
+  if (!binary_input::readArray(
+          tmp571,
+          ((int32_t)1 * (int32_t)928),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)928; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp571;
+      }
+      Arr1DIdxRowM(tmp571, (int32_t)928, i0) =
+          (party == SERVER) ? __tmp_in_tmp571 : 0;
     }
-    Arr1DIdxRowM(tmp571, (int32_t)928, i0) =
-        (party == SERVER) ? __tmp_in_tmp571 : 0;
   }
 
   uint64_t *tmp572 = make_array<uint64_t>((int32_t)928);
   /* Variable to read the clear value corresponding to the input variable tmp572
    * at (3646,1-3646,37) */
   uint64_t __tmp_in_tmp572;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)928; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp572;
+  if (!binary_input::readArray(
+          tmp572,
+          ((int32_t)1 * (int32_t)928),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)928; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp572;
+      }
+      Arr1DIdxRowM(tmp572, (int32_t)928, i0) =
+          (party == SERVER) ? __tmp_in_tmp572 : 0;
     }
-    Arr1DIdxRowM(tmp572, (int32_t)928, i0) =
-        (party == SERVER) ? __tmp_in_tmp572 : 0;
   }
 
   uint64_t *tmp573 = make_array<uint64_t>((int32_t)928);
   /* Variable to read the clear value corresponding to the input variable tmp573
    * at (3649,1-3649,37) */
   uint64_t __tmp_in_tmp573;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)928; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp573;
+  if (!binary_input::readArray(
+          tmp573,
+          ((int32_t)1 * (int32_t)928),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)928; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp573;
+      }
+      Arr1DIdxRowM(tmp573, (int32_t)928, i0) =
+          (party == SERVER) ? __tmp_in_tmp573 : 0;
     }
-    Arr1DIdxRowM(tmp573, (int32_t)928, i0) =
-        (party == SERVER) ? __tmp_in_tmp573 : 0;
   }
 
   uint64_t *tmp574 = make_array<uint64_t>((int32_t)928);
   /* Variable to read the clear value corresponding to the input variable tmp574
    * at (3652,1-3652,37) */
   uint64_t __tmp_in_tmp574;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)928; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp574;
+  if (!binary_input::readArray(
+          tmp574,
+          ((int32_t)1 * (int32_t)928),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)928; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp574;
+      }
+      Arr1DIdxRowM(tmp574, (int32_t)928, i0) =
+          (party == SERVER) ? __tmp_in_tmp574 : 0;
     }
-    Arr1DIdxRowM(tmp574, (int32_t)928, i0) =
-        (party == SERVER) ? __tmp_in_tmp574 : 0;
   }
 
   uint64_t *tmp575 =
@@ -10076,16 +12951,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp575
    * at (3655,1-3655,48) */
   uint64_t __tmp_in_tmp575;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)928; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp575;
+  if (!binary_input::readArray(
+          tmp575,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)928) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)928; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp575;
+            }
+            Arr4DIdxRowM(tmp575, (int32_t)1, (int32_t)1, (int32_t)928,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp575 : 0;
           }
-          Arr4DIdxRowM(tmp575, (int32_t)1, (int32_t)1, (int32_t)928,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp575 : 0;
         }
       }
     }
@@ -10095,48 +12975,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp576
    * at (3658,1-3658,37) */
   uint64_t __tmp_in_tmp576;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp576;
+  if (!binary_input::readArray(
+          tmp576,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp576;
+      }
+      Arr1DIdxRowM(tmp576, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp576 : 0;
     }
-    Arr1DIdxRowM(tmp576, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp576 : 0;
   }
 
   uint64_t *tmp577 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp577
    * at (3661,1-3661,37) */
   uint64_t __tmp_in_tmp577;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp577;
+  if (!binary_input::readArray(
+          tmp577,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp577;
+      }
+      Arr1DIdxRowM(tmp577, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp577 : 0;
     }
-    Arr1DIdxRowM(tmp577, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp577 : 0;
   }
 
   uint64_t *tmp578 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp578
    * at (3664,1-3664,37) */
   uint64_t __tmp_in_tmp578;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp578;
+  if (!binary_input::readArray(
+          tmp578,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp578;
+      }
+      Arr1DIdxRowM(tmp578, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp578 : 0;
     }
-    Arr1DIdxRowM(tmp578, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp578 : 0;
   }
 
   uint64_t *tmp579 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp579
    * at (3667,1-3667,37) */
   uint64_t __tmp_in_tmp579;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp579;
+  if (!binary_input::readArray(
+          tmp579,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp579;
+      }
+      Arr1DIdxRowM(tmp579, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp579 : 0;
     }
-    Arr1DIdxRowM(tmp579, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp579 : 0;
   }
 
   uint64_t *tmp580 =
@@ -10144,16 +13044,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp580
    * at (3670,1-3670,47) */
   uint64_t __tmp_in_tmp580;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp580;
+  if (!binary_input::readArray(
+          tmp580,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp580;
+            }
+            Arr4DIdxRowM(tmp580, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp580 : 0;
           }
-          Arr4DIdxRowM(tmp580, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp580 : 0;
         }
       }
     }
@@ -10163,48 +13068,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp581
    * at (3673,1-3673,37) */
   uint64_t __tmp_in_tmp581;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)960; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp581;
+  if (!binary_input::readArray(
+          tmp581,
+          ((int32_t)1 * (int32_t)960),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)960; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp581;
+      }
+      Arr1DIdxRowM(tmp581, (int32_t)960, i0) =
+          (party == SERVER) ? __tmp_in_tmp581 : 0;
     }
-    Arr1DIdxRowM(tmp581, (int32_t)960, i0) =
-        (party == SERVER) ? __tmp_in_tmp581 : 0;
   }
 
   uint64_t *tmp582 = make_array<uint64_t>((int32_t)960);
   /* Variable to read the clear value corresponding to the input variable tmp582
    * at (3676,1-3676,37) */
   uint64_t __tmp_in_tmp582;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)960; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp582;
+  if (!binary_input::readArray(
+          tmp582,
+          ((int32_t)1 * (int32_t)960),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)960; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp582;
+      }
+      Arr1DIdxRowM(tmp582, (int32_t)960, i0) =
+          (party == SERVER) ? __tmp_in_tmp582 : 0;
     }
-    Arr1DIdxRowM(tmp582, (int32_t)960, i0) =
-        (party == SERVER) ? __tmp_in_tmp582 : 0;
   }
 
   uint64_t *tmp583 = make_array<uint64_t>((int32_t)960);
   /* Variable to read the clear value corresponding to the input variable tmp583
    * at (3679,1-3679,37) */
   uint64_t __tmp_in_tmp583;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)960; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp583;
+  if (!binary_input::readArray(
+          tmp583,
+          ((int32_t)1 * (int32_t)960),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)960; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp583;
+      }
+      Arr1DIdxRowM(tmp583, (int32_t)960, i0) =
+          (party == SERVER) ? __tmp_in_tmp583 : 0;
     }
-    Arr1DIdxRowM(tmp583, (int32_t)960, i0) =
-        (party == SERVER) ? __tmp_in_tmp583 : 0;
   }
 
   uint64_t *tmp584 = make_array<uint64_t>((int32_t)960);
   /* Variable to read the clear value corresponding to the input variable tmp584
    * at (3682,1-3682,37) */
   uint64_t __tmp_in_tmp584;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)960; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp584;
+  if (!binary_input::readArray(
+          tmp584,
+          ((int32_t)1 * (int32_t)960),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)960; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp584;
+      }
+      Arr1DIdxRowM(tmp584, (int32_t)960, i0) =
+          (party == SERVER) ? __tmp_in_tmp584 : 0;
     }
-    Arr1DIdxRowM(tmp584, (int32_t)960, i0) =
-        (party == SERVER) ? __tmp_in_tmp584 : 0;
   }
 
   uint64_t *tmp585 =
@@ -10212,16 +13137,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp585
    * at (3685,1-3685,48) */
   uint64_t __tmp_in_tmp585;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)960; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp585;
+  if (!binary_input::readArray(
+          tmp585,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)960) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)960; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp585;
+            }
+            Arr4DIdxRowM(tmp585, (int32_t)1, (int32_t)1, (int32_t)960,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp585 : 0;
           }
-          Arr4DIdxRowM(tmp585, (int32_t)1, (int32_t)1, (int32_t)960,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp585 : 0;
         }
       }
     }
@@ -10231,48 +13161,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp586
    * at (3688,1-3688,37) */
   uint64_t __tmp_in_tmp586;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp586;
+  if (!binary_input::readArray(
+          tmp586,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp586;
+      }
+      Arr1DIdxRowM(tmp586, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp586 : 0;
     }
-    Arr1DIdxRowM(tmp586, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp586 : 0;
   }
 
   uint64_t *tmp587 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp587
    * at (3691,1-3691,37) */
   uint64_t __tmp_in_tmp587;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp587;
+  if (!binary_input::readArray(
+          tmp587,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp587;
+      }
+      Arr1DIdxRowM(tmp587, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp587 : 0;
     }
-    Arr1DIdxRowM(tmp587, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp587 : 0;
   }
 
   uint64_t *tmp588 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp588
    * at (3694,1-3694,37) */
   uint64_t __tmp_in_tmp588;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp588;
+  if (!binary_input::readArray(
+          tmp588,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp588;
+      }
+      Arr1DIdxRowM(tmp588, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp588 : 0;
     }
-    Arr1DIdxRowM(tmp588, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp588 : 0;
   }
 
   uint64_t *tmp589 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp589
    * at (3697,1-3697,37) */
   uint64_t __tmp_in_tmp589;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp589;
+  if (!binary_input::readArray(
+          tmp589,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp589;
+      }
+      Arr1DIdxRowM(tmp589, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp589 : 0;
     }
-    Arr1DIdxRowM(tmp589, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp589 : 0;
   }
 
   uint64_t *tmp590 =
@@ -10280,16 +13230,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp590
    * at (3700,1-3700,47) */
   uint64_t __tmp_in_tmp590;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp590;
+  if (!binary_input::readArray(
+          tmp590,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp590;
+            }
+            Arr4DIdxRowM(tmp590, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp590 : 0;
           }
-          Arr4DIdxRowM(tmp590, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp590 : 0;
         }
       }
     }
@@ -10299,48 +13254,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp591
    * at (3703,1-3703,37) */
   uint64_t __tmp_in_tmp591;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)992; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp591;
+  if (!binary_input::readArray(
+          tmp591,
+          ((int32_t)1 * (int32_t)992),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)992; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp591;
+      }
+      Arr1DIdxRowM(tmp591, (int32_t)992, i0) =
+          (party == SERVER) ? __tmp_in_tmp591 : 0;
     }
-    Arr1DIdxRowM(tmp591, (int32_t)992, i0) =
-        (party == SERVER) ? __tmp_in_tmp591 : 0;
   }
 
   uint64_t *tmp592 = make_array<uint64_t>((int32_t)992);
   /* Variable to read the clear value corresponding to the input variable tmp592
    * at (3706,1-3706,37) */
   uint64_t __tmp_in_tmp592;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)992; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp592;
+  if (!binary_input::readArray(
+          tmp592,
+          ((int32_t)1 * (int32_t)992),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)992; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp592;
+      }
+      Arr1DIdxRowM(tmp592, (int32_t)992, i0) =
+          (party == SERVER) ? __tmp_in_tmp592 : 0;
     }
-    Arr1DIdxRowM(tmp592, (int32_t)992, i0) =
-        (party == SERVER) ? __tmp_in_tmp592 : 0;
   }
 
   uint64_t *tmp593 = make_array<uint64_t>((int32_t)992);
   /* Variable to read the clear value corresponding to the input variable tmp593
    * at (3709,1-3709,37) */
   uint64_t __tmp_in_tmp593;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)992; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp593;
+  if (!binary_input::readArray(
+          tmp593,
+          ((int32_t)1 * (int32_t)992),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)992; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp593;
+      }
+      Arr1DIdxRowM(tmp593, (int32_t)992, i0) =
+          (party == SERVER) ? __tmp_in_tmp593 : 0;
     }
-    Arr1DIdxRowM(tmp593, (int32_t)992, i0) =
-        (party == SERVER) ? __tmp_in_tmp593 : 0;
   }
 
   uint64_t *tmp594 = make_array<uint64_t>((int32_t)992);
   /* Variable to read the clear value corresponding to the input variable tmp594
    * at (3712,1-3712,37) */
   uint64_t __tmp_in_tmp594;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)992; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp594;
+  if (!binary_input::readArray(
+          tmp594,
+          ((int32_t)1 * (int32_t)992),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)992; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp594;
+      }
+      Arr1DIdxRowM(tmp594, (int32_t)992, i0) =
+          (party == SERVER) ? __tmp_in_tmp594 : 0;
     }
-    Arr1DIdxRowM(tmp594, (int32_t)992, i0) =
-        (party == SERVER) ? __tmp_in_tmp594 : 0;
   }
 
   uint64_t *tmp595 =
@@ -10348,16 +13323,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp595
    * at (3715,1-3715,48) */
   uint64_t __tmp_in_tmp595;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)992; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp595;
+  if (!binary_input::readArray(
+          tmp595,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)992) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)992; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp595;
+            }
+            Arr4DIdxRowM(tmp595, (int32_t)1, (int32_t)1, (int32_t)992,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp595 : 0;
           }
-          Arr4DIdxRowM(tmp595, (int32_t)1, (int32_t)1, (int32_t)992,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp595 : 0;
         }
       }
     }
@@ -10367,48 +13347,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp596
    * at (3718,1-3718,37) */
   uint64_t __tmp_in_tmp596;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp596;
+  if (!binary_input::readArray(
+          tmp596,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp596;
+      }
+      Arr1DIdxRowM(tmp596, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp596 : 0;
     }
-    Arr1DIdxRowM(tmp596, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp596 : 0;
   }
 
   uint64_t *tmp597 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp597
    * at (3721,1-3721,37) */
   uint64_t __tmp_in_tmp597;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp597;
+  if (!binary_input::readArray(
+          tmp597,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp597;
+      }
+      Arr1DIdxRowM(tmp597, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp597 : 0;
     }
-    Arr1DIdxRowM(tmp597, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp597 : 0;
   }
 
   uint64_t *tmp598 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp598
    * at (3724,1-3724,37) */
   uint64_t __tmp_in_tmp598;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp598;
+  if (!binary_input::readArray(
+          tmp598,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp598;
+      }
+      Arr1DIdxRowM(tmp598, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp598 : 0;
     }
-    Arr1DIdxRowM(tmp598, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp598 : 0;
   }
 
   uint64_t *tmp599 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp599
    * at (3727,1-3727,37) */
   uint64_t __tmp_in_tmp599;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp599;
+  if (!binary_input::readArray(
+          tmp599,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp599;
+      }
+      Arr1DIdxRowM(tmp599, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp599 : 0;
     }
-    Arr1DIdxRowM(tmp599, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp599 : 0;
   }
 
   uint64_t *tmp600 =
@@ -10416,16 +13416,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp600
    * at (3730,1-3730,47) */
   uint64_t __tmp_in_tmp600;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp600;
+  if (!binary_input::readArray(
+          tmp600,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp600;
+            }
+            Arr4DIdxRowM(tmp600, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)32, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp600 : 0;
           }
-          Arr4DIdxRowM(tmp600, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)32, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp600 : 0;
         }
       }
     }
@@ -10435,48 +13440,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp601
    * at (3733,1-3733,38) */
   uint64_t __tmp_in_tmp601;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp601;
+  if (!binary_input::readArray(
+          tmp601,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp601;
+      }
+      Arr1DIdxRowM(tmp601, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp601 : 0;
     }
-    Arr1DIdxRowM(tmp601, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp601 : 0;
   }
 
   uint64_t *tmp602 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp602
    * at (3736,1-3736,38) */
   uint64_t __tmp_in_tmp602;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp602;
+  if (!binary_input::readArray(
+          tmp602,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp602;
+      }
+      Arr1DIdxRowM(tmp602, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp602 : 0;
     }
-    Arr1DIdxRowM(tmp602, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp602 : 0;
   }
 
   uint64_t *tmp603 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp603
    * at (3739,1-3739,38) */
   uint64_t __tmp_in_tmp603;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp603;
+  if (!binary_input::readArray(
+          tmp603,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp603;
+      }
+      Arr1DIdxRowM(tmp603, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp603 : 0;
     }
-    Arr1DIdxRowM(tmp603, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp603 : 0;
   }
 
   uint64_t *tmp604 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp604
    * at (3742,1-3742,38) */
   uint64_t __tmp_in_tmp604;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp604;
+  if (!binary_input::readArray(
+          tmp604,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp604;
+      }
+      Arr1DIdxRowM(tmp604, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp604 : 0;
     }
-    Arr1DIdxRowM(tmp604, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp604 : 0;
   }
 
   uint64_t *tmp605 = make_array<uint64_t>((int32_t)1, (int32_t)1, (int32_t)1024,
@@ -10484,16 +13509,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp605
    * at (3745,1-3745,50) */
   uint64_t __tmp_in_tmp605;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1000; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp605;
+  if (!binary_input::readArray(
+          tmp605,
+          (((((int32_t)1 * (int32_t)1000) * (int32_t)1024) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1000; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp605;
+            }
+            Arr4DIdxRowM(tmp605, (int32_t)1, (int32_t)1, (int32_t)1024,
+                         (int32_t)1000, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp605 : 0;
           }
-          Arr4DIdxRowM(tmp605, (int32_t)1, (int32_t)1, (int32_t)1024,
-                       (int32_t)1000, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp605 : 0;
         }
       }
     }
@@ -10503,12 +13533,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp606
    * at (3748,1-3748,38) */
   uint64_t __tmp_in_tmp606;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1000; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp606;
+  if (!binary_input::readArray(
+          tmp606,
+          ((int32_t)1 * (int32_t)1000),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1000; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp606;
+      }
+      Arr1DIdxRowM(tmp606, (int32_t)1000, i0) =
+          (party == SERVER) ? __tmp_in_tmp606 : 0;
     }
-    Arr1DIdxRowM(tmp606, (int32_t)1000, i0) =
-        (party == SERVER) ? __tmp_in_tmp606 : 0;
   }
   StartComputation();
 
@@ -2276,15 +2276,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp0
    * at (1583,1-1583,44) */
   uint64_t __tmp_in_tmp0;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)32; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)32; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)3; i3++) {
-          if ((party == CLIENT)) {
-            cin >> __tmp_in_tmp0;
+  if (!binary_input::readArray(
+          tmp0,
+          (((((int32_t)1 * (int32_t)3) * (int32_t)32) * (int32_t)32) * (int32_t)1),
+          (party == CLIENT))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)32; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)32; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)3; i3++) {
+            if ((party == CLIENT)) {
+              cin >> __tmp_in_tmp0;
+            }
+            Arr4DIdxRowM(tmp0, (int32_t)1, (int32_t)32, (int32_t)32, (int32_t)3,
+                         i0, i1, i2, i3) = (party == CLIENT) ? __tmp_in_tmp0 : 0;
           }
-          Arr4DIdxRowM(tmp0, (int32_t)1, (int32_t)32, (int32_t)32, (int32_t)3,
-                       i0, i1, i2, i3) = (party == CLIENT) ? __tmp_in_tmp0 : 0;
         }
       }
     }
@@ -2295,15 +2300,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp1
    * at (1586,1-1586,43) */
   uint64_t __tmp_in_tmp1;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)3; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp1;
+  if (!binary_input::readArray(
+          tmp1,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)3) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)3; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp1;
+            }
+            Arr4DIdxRowM(tmp1, (int32_t)3, (int32_t)3, (int32_t)3, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp1 : 0;
           }
-          Arr4DIdxRowM(tmp1, (int32_t)3, (int32_t)3, (int32_t)3, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp1 : 0;
         }
       }
     }
@@ -2314,15 +2324,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp2
    * at (1589,1-1589,44) */
   uint64_t __tmp_in_tmp2;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp2;
+  if (!binary_input::readArray(
+          tmp2,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)64) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp2;
+            }
+            Arr4DIdxRowM(tmp2, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp2 : 0;
           }
-          Arr4DIdxRowM(tmp2, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp2 : 0;
         }
       }
     }
@@ -2333,15 +2348,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp3
    * at (1592,1-1592,44) */
   uint64_t __tmp_in_tmp3;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp3;
+  if (!binary_input::readArray(
+          tmp3,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)64) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp3;
+            }
+            Arr4DIdxRowM(tmp3, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp3 : 0;
           }
-          Arr4DIdxRowM(tmp3, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp3 : 0;
         }
       }
     }
@@ -2352,15 +2372,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp4
    * at (1595,1-1595,44) */
   uint64_t __tmp_in_tmp4;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp4;
+  if (!binary_input::readArray(
+          tmp4,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)64) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp4;
+            }
+            Arr4DIdxRowM(tmp4, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp4 : 0;
           }
-          Arr4DIdxRowM(tmp4, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp4 : 0;
         }
       }
     }
@@ -2371,15 +2396,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp5
    * at (1598,1-1598,44) */
   uint64_t __tmp_in_tmp5;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp5;
+  if (!binary_input::readArray(
+          tmp5,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)64) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp5;
+            }
+            Arr4DIdxRowM(tmp5, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp5 : 0;
           }
-          Arr4DIdxRowM(tmp5, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp5 : 0;
         }
       }
     }
@@ -2390,15 +2420,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp6
    * at (1601,1-1601,44) */
   uint64_t __tmp_in_tmp6;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp6;
+  if (!binary_input::readArray(
+          tmp6,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)64) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp6;
+            }
+            Arr4DIdxRowM(tmp6, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp6 : 0;
           }
-          Arr4DIdxRowM(tmp6, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp6 : 0;
         }
       }
     }
@@ -2409,15 +2444,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp7
    * at (1604,1-1604,44) */
   uint64_t __tmp_in_tmp7;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)16; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp7;
+  if (!binary_input::readArray(
+          tmp7,
+          (((((int32_t)1 * (int32_t)16) * (int32_t)64) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)16; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp7;
+            }
+            Arr4DIdxRowM(tmp7, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)16,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp7 : 0;
           }
-          Arr4DIdxRowM(tmp7, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)16,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp7 : 0;
         }
       }
     }
@@ -2427,13 +2467,18 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp8
    * at (1607,1-1607,40) */
   uint64_t __tmp_in_tmp8;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)10; i1++) {
-      if ((party == SERVER)) {
-        cin >> __tmp_in_tmp8;
+  if (!binary_input::readArray(
+          tmp8,
+          (((int32_t)1 * (int32_t)10) * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)10; i1++) {
+        if ((party == SERVER)) {
+          cin >> __tmp_in_tmp8;
+        }
+        Arr2DIdxRowM(tmp8, (int32_t)1024, (int32_t)10, i0, i1) =
+            (party == SERVER) ? __tmp_in_tmp8 : 0;
       }
-      Arr2DIdxRowM(tmp8, (int32_t)1024, (int32_t)10, i0, i1) =
-          (party == SERVER) ? __tmp_in_tmp8 : 0;
     }
   }
 
@@ -2441,11 +2486,16 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp9
    * at (1610,1-1610,34) */
   uint64_t __tmp_in_tmp9;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)10; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp9;
+  if (!binary_input::readArray(
+          tmp9,
+          ((int32_t)1 * (int32_t)10),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)10; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp9;
+      }
+      Arr1DIdxRowM(tmp9, (int32_t)10, i0) = (party == SERVER) ? __tmp_in_tmp9 : 0;
     }
-    Arr1DIdxRowM(tmp9, (int32_t)10, i0) = (party == SERVER) ? __tmp_in_tmp9 : 0;
   }
   StartComputation();
 
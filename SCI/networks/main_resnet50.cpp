@@ -2276,15 +2276,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp0
    * at (1930,1-1930,46) */
   uint64_t __tmp_in_tmp0;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)224; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)224; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)3; i3++) {
-          if ((party == CLIENT)) {
-            cin >> __tmp_in_tmp0;
+  if (!binary_input::readArray(
+          tmp0,
+          (((((int32_t)1 * (int32_t)3) * (int32_t)224) * (int32_t)224) * (int32_t)1),
+          (party == CLIENT))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)224; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)224; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)3; i3++) {
+            if ((party == CLIENT)) {
+              cin >> __tmp_in_tmp0;
+            }
+            Arr4DIdxRowM(tmp0, (int32_t)1, (int32_t)224, (int32_t)224, (int32_t)3,
+                         i0, i1, i2, i3) = (party == CLIENT) ? __tmp_in_tmp0 : 0;
           }
-          Arr4DIdxRowM(tmp0, (int32_t)1, (int32_t)224, (int32_t)224, (int32_t)3,
-                       i0, i1, i2, i3) = (party == CLIENT) ? __tmp_in_tmp0 : 0;
         }
       }
     }
@@ -2295,15 +2300,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp1
    * at (1933,1-1933,43) */
   uint64_t __tmp_in_tmp1;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)7; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)7; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)3; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp1;
+  if (!binary_input::readArray(
+          tmp1,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)3) * (int32_t)7) * (int32_t)7),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)7; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)7; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)3; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp1;
+            }
+            Arr4DIdxRowM(tmp1, (int32_t)7, (int32_t)7, (int32_t)3, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp1 : 0;
           }
-          Arr4DIdxRowM(tmp1, (int32_t)7, (int32_t)7, (int32_t)3, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp1 : 0;
         }
       }
     }
@@ -2313,44 +2323,64 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp2
    * at (1936,1-1936,34) */
   uint64_t __tmp_in_tmp2;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp2;
+  if (!binary_input::readArray(
+          tmp2,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp2;
+      }
+      Arr1DIdxRowM(tmp2, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp2 : 0;
     }
-    Arr1DIdxRowM(tmp2, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp2 : 0;
   }
 
   uint64_t *tmp3 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp3
    * at (1939,1-1939,34) */
   uint64_t __tmp_in_tmp3;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp3;
+  if (!binary_input::readArray(
+          tmp3,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp3;
+      }
+      Arr1DIdxRowM(tmp3, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp3 : 0;
     }
-    Arr1DIdxRowM(tmp3, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp3 : 0;
   }
 
   uint64_t *tmp4 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp4
    * at (1942,1-1942,34) */
   uint64_t __tmp_in_tmp4;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp4;
+  if (!binary_input::readArray(
+          tmp4,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp4;
+      }
+      Arr1DIdxRowM(tmp4, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp4 : 0;
     }
-    Arr1DIdxRowM(tmp4, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp4 : 0;
   }
 
   uint64_t *tmp5 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp5
    * at (1945,1-1945,34) */
   uint64_t __tmp_in_tmp5;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp5;
+  if (!binary_input::readArray(
+          tmp5,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp5;
+      }
+      Arr1DIdxRowM(tmp5, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp5 : 0;
     }
-    Arr1DIdxRowM(tmp5, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp5 : 0;
   }
 
   uint64_t *tmp6 =
@@ -2358,15 +2388,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp6
    * at (1948,1-1948,45) */
   uint64_t __tmp_in_tmp6;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp6;
+  if (!binary_input::readArray(
+          tmp6,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)64) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp6;
+            }
+            Arr4DIdxRowM(tmp6, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)256,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp6 : 0;
           }
-          Arr4DIdxRowM(tmp6, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)256,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp6 : 0;
         }
       }
     }
@@ -2377,15 +2412,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp7
    * at (1951,1-1951,44) */
   uint64_t __tmp_in_tmp7;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp7;
+  if (!binary_input::readArray(
+          tmp7,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)64) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp7;
+            }
+            Arr4DIdxRowM(tmp7, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp7 : 0;
           }
-          Arr4DIdxRowM(tmp7, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp7 : 0;
         }
       }
     }
@@ -2395,46 +2435,66 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp8
    * at (1954,1-1954,34) */
   uint64_t __tmp_in_tmp8;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp8;
+  if (!binary_input::readArray(
+          tmp8,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp8;
+      }
+      Arr1DIdxRowM(tmp8, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp8 : 0;
     }
-    Arr1DIdxRowM(tmp8, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp8 : 0;
   }
 
   uint64_t *tmp9 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp9
    * at (1957,1-1957,34) */
   uint64_t __tmp_in_tmp9;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp9;
+  if (!binary_input::readArray(
+          tmp9,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp9;
+      }
+      Arr1DIdxRowM(tmp9, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp9 : 0;
     }
-    Arr1DIdxRowM(tmp9, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp9 : 0;
   }
 
   uint64_t *tmp10 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp10
    * at (1960,1-1960,35) */
   uint64_t __tmp_in_tmp10;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp10;
+  if (!binary_input::readArray(
+          tmp10,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp10;
+      }
+      Arr1DIdxRowM(tmp10, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp10 : 0;
     }
-    Arr1DIdxRowM(tmp10, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp10 : 0;
   }
 
   uint64_t *tmp11 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp11
    * at (1963,1-1963,35) */
   uint64_t __tmp_in_tmp11;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp11;
+  if (!binary_input::readArray(
+          tmp11,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp11;
+      }
+      Arr1DIdxRowM(tmp11, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp11 : 0;
     }
-    Arr1DIdxRowM(tmp11, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp11 : 0;
   }
 
   uint64_t *tmp12 =
@@ -2442,15 +2502,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp12
    * at (1966,1-1966,45) */
   uint64_t __tmp_in_tmp12;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp12;
+  if (!binary_input::readArray(
+          tmp12,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)64) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp12;
+            }
+            Arr4DIdxRowM(tmp12, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp12 : 0;
           }
-          Arr4DIdxRowM(tmp12, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp12 : 0;
         }
       }
     }
@@ -2460,48 +2525,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp13
    * at (1969,1-1969,35) */
   uint64_t __tmp_in_tmp13;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp13;
+  if (!binary_input::readArray(
+          tmp13,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp13;
+      }
+      Arr1DIdxRowM(tmp13, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp13 : 0;
     }
-    Arr1DIdxRowM(tmp13, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp13 : 0;
   }
 
   uint64_t *tmp14 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp14
    * at (1972,1-1972,35) */
   uint64_t __tmp_in_tmp14;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp14;
+  if (!binary_input::readArray(
+          tmp14,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp14;
+      }
+      Arr1DIdxRowM(tmp14, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp14 : 0;
     }
-    Arr1DIdxRowM(tmp14, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp14 : 0;
   }
 
   uint64_t *tmp15 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp15
    * at (1975,1-1975,35) */
   uint64_t __tmp_in_tmp15;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp15;
+  if (!binary_input::readArray(
+          tmp15,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp15;
+      }
+      Arr1DIdxRowM(tmp15, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp15 : 0;
     }
-    Arr1DIdxRowM(tmp15, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp15 : 0;
   }
 
   uint64_t *tmp16 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp16
    * at (1978,1-1978,35) */
   uint64_t __tmp_in_tmp16;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp16;
+  if (!binary_input::readArray(
+          tmp16,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp16;
+      }
+      Arr1DIdxRowM(tmp16, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp16 : 0;
     }
-    Arr1DIdxRowM(tmp16, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp16 : 0;
   }
 
   uint64_t *tmp17 =
@@ -2509,15 +2594,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp17
    * at (1981,1-1981,46) */
   uint64_t __tmp_in_tmp17;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp17;
+  if (!binary_input::readArray(
+          tmp17,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)64) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp17;
+            }
+            Arr4DIdxRowM(tmp17, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)256,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp17 : 0;
           }
-          Arr4DIdxRowM(tmp17, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)256,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp17 : 0;
         }
       }
     }
@@ -2527,48 +2617,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp18
    * at (1984,1-1984,36) */
   uint64_t __tmp_in_tmp18;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp18;
+  if (!binary_input::readArray(
+          tmp18,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp18;
+      }
+      Arr1DIdxRowM(tmp18, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp18 : 0;
     }
-    Arr1DIdxRowM(tmp18, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp18 : 0;
   }
 
   uint64_t *tmp19 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp19
    * at (1987,1-1987,36) */
   uint64_t __tmp_in_tmp19;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp19;
+  if (!binary_input::readArray(
+          tmp19,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp19;
+      }
+      Arr1DIdxRowM(tmp19, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp19 : 0;
     }
-    Arr1DIdxRowM(tmp19, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp19 : 0;
   }
 
   uint64_t *tmp20 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp20
    * at (1990,1-1990,36) */
   uint64_t __tmp_in_tmp20;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp20;
+  if (!binary_input::readArray(
+          tmp20,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp20;
+      }
+      Arr1DIdxRowM(tmp20, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp20 : 0;
     }
-    Arr1DIdxRowM(tmp20, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp20 : 0;
   }
 
   uint64_t *tmp21 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp21
    * at (1993,1-1993,36) */
   uint64_t __tmp_in_tmp21;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp21;
+  if (!binary_input::readArray(
+          tmp21,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp21;
+      }
+      Arr1DIdxRowM(tmp21, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp21 : 0;
     }
-    Arr1DIdxRowM(tmp21, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp21 : 0;
   }
 
   uint64_t *tmp22 =
@@ -2576,15 +2686,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp22
    * at (1996,1-1996,46) */
   uint64_t __tmp_in_tmp22;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp22;
+  if (!binary_input::readArray(
+          tmp22,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)256) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp22;
+            }
+            Arr4DIdxRowM(tmp22, (int32_t)1, (int32_t)1, (int32_t)256, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp22 : 0;
           }
-          Arr4DIdxRowM(tmp22, (int32_t)1, (int32_t)1, (int32_t)256, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp22 : 0;
         }
       }
     }
@@ -2594,48 +2709,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp23
    * at (1999,1-1999,35) */
   uint64_t __tmp_in_tmp23;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp23;
+  if (!binary_input::readArray(
+          tmp23,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp23;
+      }
+      Arr1DIdxRowM(tmp23, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp23 : 0;
     }
-    Arr1DIdxRowM(tmp23, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp23 : 0;
   }
 
   uint64_t *tmp24 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp24
    * at (2002,1-2002,35) */
   uint64_t __tmp_in_tmp24;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp24;
+  if (!binary_input::readArray(
+          tmp24,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp24;
+      }
+      Arr1DIdxRowM(tmp24, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp24 : 0;
     }
-    Arr1DIdxRowM(tmp24, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp24 : 0;
   }
 
   uint64_t *tmp25 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp25
    * at (2005,1-2005,35) */
   uint64_t __tmp_in_tmp25;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp25;
+  if (!binary_input::readArray(
+          tmp25,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp25;
+      }
+      Arr1DIdxRowM(tmp25, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp25 : 0;
     }
-    Arr1DIdxRowM(tmp25, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp25 : 0;
   }
 
   uint64_t *tmp26 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp26
    * at (2008,1-2008,35) */
   uint64_t __tmp_in_tmp26;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp26;
+  if (!binary_input::readArray(
+          tmp26,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp26;
+      }
+      Arr1DIdxRowM(tmp26, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp26 : 0;
     }
-    Arr1DIdxRowM(tmp26, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp26 : 0;
   }
 
   uint64_t *tmp27 =
@@ -2643,15 +2778,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp27
    * at (2011,1-2011,45) */
   uint64_t __tmp_in_tmp27;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp27;
+  if (!binary_input::readArray(
+          tmp27,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)64) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp27;
+            }
+            Arr4DIdxRowM(tmp27, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp27 : 0;
           }
-          Arr4DIdxRowM(tmp27, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp27 : 0;
         }
       }
     }
@@ -2661,48 +2801,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp28
    * at (2014,1-2014,35) */
   uint64_t __tmp_in_tmp28;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp28;
+  if (!binary_input::readArray(
+          tmp28,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp28;
+      }
+      Arr1DIdxRowM(tmp28, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp28 : 0;
     }
-    Arr1DIdxRowM(tmp28, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp28 : 0;
   }
 
   uint64_t *tmp29 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp29
    * at (2017,1-2017,35) */
   uint64_t __tmp_in_tmp29;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp29;
+  if (!binary_input::readArray(
+          tmp29,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp29;
+      }
+      Arr1DIdxRowM(tmp29, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp29 : 0;
     }
-    Arr1DIdxRowM(tmp29, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp29 : 0;
   }
 
   uint64_t *tmp30 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp30
    * at (2020,1-2020,35) */
   uint64_t __tmp_in_tmp30;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp30;
+  if (!binary_input::readArray(
+          tmp30,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp30;
+      }
+      Arr1DIdxRowM(tmp30, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp30 : 0;
     }
-    Arr1DIdxRowM(tmp30, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp30 : 0;
   }
 
   uint64_t *tmp31 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp31
    * at (2023,1-2023,35) */
   uint64_t __tmp_in_tmp31;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp31;
+  if (!binary_input::readArray(
+          tmp31,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp31;
+      }
+      Arr1DIdxRowM(tmp31, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp31 : 0;
     }
-    Arr1DIdxRowM(tmp31, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp31 : 0;
   }
 
   uint64_t *tmp32 =
@@ -2710,15 +2870,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp32
    * at (2026,1-2026,46) */
   uint64_t __tmp_in_tmp32;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp32;
+  if (!binary_input::readArray(
+          tmp32,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)64) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp32;
+            }
+            Arr4DIdxRowM(tmp32, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)256,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp32 : 0;
           }
-          Arr4DIdxRowM(tmp32, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)256,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp32 : 0;
         }
       }
     }
@@ -2728,48 +2893,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp33
    * at (2029,1-2029,36) */
   uint64_t __tmp_in_tmp33;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp33;
+  if (!binary_input::readArray(
+          tmp33,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp33;
+      }
+      Arr1DIdxRowM(tmp33, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp33 : 0;
     }
-    Arr1DIdxRowM(tmp33, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp33 : 0;
   }
 
   uint64_t *tmp34 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp34
    * at (2032,1-2032,36) */
   uint64_t __tmp_in_tmp34;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp34;
+  if (!binary_input::readArray(
+          tmp34,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp34;
+      }
+      Arr1DIdxRowM(tmp34, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp34 : 0;
     }
-    Arr1DIdxRowM(tmp34, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp34 : 0;
   }
 
   uint64_t *tmp35 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp35
    * at (2035,1-2035,36) */
   uint64_t __tmp_in_tmp35;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp35;
+  if (!binary_input::readArray(
+          tmp35,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp35;
+      }
+      Arr1DIdxRowM(tmp35, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp35 : 0;
     }
-    Arr1DIdxRowM(tmp35, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp35 : 0;
   }
 
   uint64_t *tmp36 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp36
    * at (2038,1-2038,36) */
   uint64_t __tmp_in_tmp36;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp36;
+  if (!binary_input::readArray(
+          tmp36,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp36;
+      }
+      Arr1DIdxRowM(tmp36, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp36 : 0;
     }
-    Arr1DIdxRowM(tmp36, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp36 : 0;
   }
 
   uint64_t *tmp37 =
@@ -2777,15 +2962,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp37
    * at (2041,1-2041,46) */
   uint64_t __tmp_in_tmp37;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp37;
+  if (!binary_input::readArray(
+          tmp37,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)256) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp37;
+            }
+            Arr4DIdxRowM(tmp37, (int32_t)1, (int32_t)1, (int32_t)256, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp37 : 0;
           }
-          Arr4DIdxRowM(tmp37, (int32_t)1, (int32_t)1, (int32_t)256, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp37 : 0;
         }
       }
     }
@@ -2795,48 +2985,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp38
    * at (2044,1-2044,35) */
   uint64_t __tmp_in_tmp38;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp38;
+  if (!binary_input::readArray(
+          tmp38,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp38;
+      }
+      Arr1DIdxRowM(tmp38, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp38 : 0;
     }
-    Arr1DIdxRowM(tmp38, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp38 : 0;
   }
 
   uint64_t *tmp39 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp39
    * at (2047,1-2047,35) */
   uint64_t __tmp_in_tmp39;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp39;
+  if (!binary_input::readArray(
+          tmp39,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp39;
+      }
+      Arr1DIdxRowM(tmp39, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp39 : 0;
     }
-    Arr1DIdxRowM(tmp39, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp39 : 0;
   }
 
   uint64_t *tmp40 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp40
    * at (2050,1-2050,35) */
   uint64_t __tmp_in_tmp40;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp40;
+  if (!binary_input::readArray(
+          tmp40,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp40;
+      }
+      Arr1DIdxRowM(tmp40, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp40 : 0;
     }
-    Arr1DIdxRowM(tmp40, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp40 : 0;
   }
 
   uint64_t *tmp41 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp41
    * at (2053,1-2053,35) */
   uint64_t __tmp_in_tmp41;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp41;
+  if (!binary_input::readArray(
+          tmp41,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp41;
+      }
+      Arr1DIdxRowM(tmp41, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp41 : 0;
     }
-    Arr1DIdxRowM(tmp41, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp41 : 0;
   }
 
   uint64_t *tmp42 =
@@ -2844,15 +3054,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp42
    * at (2056,1-2056,45) */
   uint64_t __tmp_in_tmp42;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp42;
+  if (!binary_input::readArray(
+          tmp42,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)64) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp42;
+            }
+            Arr4DIdxRowM(tmp42, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp42 : 0;
           }
-          Arr4DIdxRowM(tmp42, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp42 : 0;
         }
       }
     }
@@ -2862,48 +3077,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp43
    * at (2059,1-2059,35) */
   uint64_t __tmp_in_tmp43;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp43;
+  if (!binary_input::readArray(
+          tmp43,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp43;
+      }
+      Arr1DIdxRowM(tmp43, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp43 : 0;
     }
-    Arr1DIdxRowM(tmp43, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp43 : 0;
   }
 
   uint64_t *tmp44 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp44
    * at (2062,1-2062,35) */
   uint64_t __tmp_in_tmp44;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp44;
+  if (!binary_input::readArray(
+          tmp44,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp44;
+      }
+      Arr1DIdxRowM(tmp44, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp44 : 0;
     }
-    Arr1DIdxRowM(tmp44, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp44 : 0;
   }
 
   uint64_t *tmp45 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp45
    * at (2065,1-2065,35) */
   uint64_t __tmp_in_tmp45;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp45;
+  if (!binary_input::readArray(
+          tmp45,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp45;
+      }
+      Arr1DIdxRowM(tmp45, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp45 : 0;
     }
-    Arr1DIdxRowM(tmp45, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp45 : 0;
   }
 
   uint64_t *tmp46 = make_array<uint64_t>((int32_t)64);
   /* Variable to read the clear value corresponding to the input variable tmp46
    * at (2068,1-2068,35) */
   uint64_t __tmp_in_tmp46;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp46;
+  if (!binary_input::readArray(
+          tmp46,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp46;
+      }
+      Arr1DIdxRowM(tmp46, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp46 : 0;
     }
-    Arr1DIdxRowM(tmp46, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp46 : 0;
   }
 
   uint64_t *tmp47 =
@@ -2911,15 +3146,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp47
    * at (2071,1-2071,46) */
   uint64_t __tmp_in_tmp47;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp47;
+  if (!binary_input::readArray(
+          tmp47,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)64) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp47;
+            }
+            Arr4DIdxRowM(tmp47, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)256,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp47 : 0;
           }
-          Arr4DIdxRowM(tmp47, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)256,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp47 : 0;
         }
       }
     }
@@ -2929,48 +3169,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp48
    * at (2074,1-2074,36) */
   uint64_t __tmp_in_tmp48;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp48;
+  if (!binary_input::readArray(
+          tmp48,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp48;
+      }
+      Arr1DIdxRowM(tmp48, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp48 : 0;
     }
-    Arr1DIdxRowM(tmp48, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp48 : 0;
   }
 
   uint64_t *tmp49 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp49
    * at (2077,1-2077,36) */
   uint64_t __tmp_in_tmp49;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp49;
+  if (!binary_input::readArray(
+          tmp49,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp49;
+      }
+      Arr1DIdxRowM(tmp49, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp49 : 0;
     }
-    Arr1DIdxRowM(tmp49, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp49 : 0;
   }
 
   uint64_t *tmp50 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp50
    * at (2080,1-2080,36) */
   uint64_t __tmp_in_tmp50;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp50;
+  if (!binary_input::readArray(
+          tmp50,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp50;
+      }
+      Arr1DIdxRowM(tmp50, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp50 : 0;
     }
-    Arr1DIdxRowM(tmp50, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp50 : 0;
   }
 
   uint64_t *tmp51 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp51
    * at (2083,1-2083,36) */
   uint64_t __tmp_in_tmp51;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp51;
+  if (!binary_input::readArray(
+          tmp51,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp51;
+      }
+      Arr1DIdxRowM(tmp51, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp51 : 0;
     }
-    Arr1DIdxRowM(tmp51, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp51 : 0;
   }
 
   uint64_t *tmp52 =
@@ -2978,16 +3238,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp52
    * at (2086,1-2086,47) */
   uint64_t __tmp_in_tmp52;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp52;
+  if (!binary_input::readArray(
+          tmp52,
+          (((((int32_t)1 * (int32_t)512) * (int32_t)256) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp52;
+            }
+            Arr4DIdxRowM(tmp52, (int32_t)1, (int32_t)1, (int32_t)256,
+                         (int32_t)512, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp52 : 0;
           }
-          Arr4DIdxRowM(tmp52, (int32_t)1, (int32_t)1, (int32_t)256,
-                       (int32_t)512, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp52 : 0;
         }
       }
     }
@@ -2998,16 +3263,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp53
    * at (2089,1-2089,47) */
   uint64_t __tmp_in_tmp53;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp53;
+  if (!binary_input::readArray(
+          tmp53,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)256) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp53;
+            }
+            Arr4DIdxRowM(tmp53, (int32_t)1, (int32_t)1, (int32_t)256,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp53 : 0;
           }
-          Arr4DIdxRowM(tmp53, (int32_t)1, (int32_t)1, (int32_t)256,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp53 : 0;
         }
       }
     }
@@ -3017,48 +3287,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp54
    * at (2092,1-2092,36) */
   uint64_t __tmp_in_tmp54;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp54;
+  if (!binary_input::readArray(
+          tmp54,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp54;
+      }
+      Arr1DIdxRowM(tmp54, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp54 : 0;
     }
-    Arr1DIdxRowM(tmp54, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp54 : 0;
   }
 
   uint64_t *tmp55 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp55
    * at (2095,1-2095,36) */
   uint64_t __tmp_in_tmp55;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp55;
+  if (!binary_input::readArray(
+          tmp55,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp55;
+      }
+      Arr1DIdxRowM(tmp55, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp55 : 0;
     }
-    Arr1DIdxRowM(tmp55, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp55 : 0;
   }
 
   uint64_t *tmp56 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp56
    * at (2098,1-2098,36) */
   uint64_t __tmp_in_tmp56;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp56;
+  if (!binary_input::readArray(
+          tmp56,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp56;
+      }
+      Arr1DIdxRowM(tmp56, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp56 : 0;
     }
-    Arr1DIdxRowM(tmp56, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp56 : 0;
   }
 
   uint64_t *tmp57 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp57
    * at (2101,1-2101,36) */
   uint64_t __tmp_in_tmp57;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp57;
+  if (!binary_input::readArray(
+          tmp57,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp57;
+      }
+      Arr1DIdxRowM(tmp57, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp57 : 0;
     }
-    Arr1DIdxRowM(tmp57, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp57 : 0;
   }
 
   uint64_t *tmp58 =
@@ -3066,16 +3356,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp58
    * at (2104,1-2104,47) */
   uint64_t __tmp_in_tmp58;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp58;
+  if (!binary_input::readArray(
+          tmp58,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp58;
+            }
+            Arr4DIdxRowM(tmp58, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp58 : 0;
           }
-          Arr4DIdxRowM(tmp58, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp58 : 0;
         }
       }
     }
@@ -3085,48 +3380,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp59
    * at (2107,1-2107,36) */
   uint64_t __tmp_in_tmp59;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp59;
+  if (!binary_input::readArray(
+          tmp59,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp59;
+      }
+      Arr1DIdxRowM(tmp59, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp59 : 0;
     }
-    Arr1DIdxRowM(tmp59, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp59 : 0;
   }
 
   uint64_t *tmp60 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp60
    * at (2110,1-2110,36) */
   uint64_t __tmp_in_tmp60;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp60;
+  if (!binary_input::readArray(
+          tmp60,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp60;
+      }
+      Arr1DIdxRowM(tmp60, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp60 : 0;
     }
-    Arr1DIdxRowM(tmp60, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp60 : 0;
   }
 
   uint64_t *tmp61 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp61
    * at (2113,1-2113,36) */
   uint64_t __tmp_in_tmp61;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp61;
+  if (!binary_input::readArray(
+          tmp61,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp61;
+      }
+      Arr1DIdxRowM(tmp61, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp61 : 0;
     }
-    Arr1DIdxRowM(tmp61, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp61 : 0;
   }
 
   uint64_t *tmp62 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp62
    * at (2116,1-2116,36) */
   uint64_t __tmp_in_tmp62;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp62;
+  if (!binary_input::readArray(
+          tmp62,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp62;
+      }
+      Arr1DIdxRowM(tmp62, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp62 : 0;
     }
-    Arr1DIdxRowM(tmp62, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp62 : 0;
   }
 
   uint64_t *tmp63 =
@@ -3134,16 +3449,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp63
    * at (2119,1-2119,47) */
   uint64_t __tmp_in_tmp63;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp63;
+  if (!binary_input::readArray(
+          tmp63,
+          (((((int32_t)1 * (int32_t)512) * (int32_t)128) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp63;
+            }
+            Arr4DIdxRowM(tmp63, (int32_t)1, (int32_t)1, (int32_t)128,
+                         (int32_t)512, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp63 : 0;
           }
-          Arr4DIdxRowM(tmp63, (int32_t)1, (int32_t)1, (int32_t)128,
-                       (int32_t)512, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp63 : 0;
         }
       }
     }
@@ -3153,48 +3473,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp64
    * at (2122,1-2122,36) */
   uint64_t __tmp_in_tmp64;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp64;
+  if (!binary_input::readArray(
+          tmp64,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp64;
+      }
+      Arr1DIdxRowM(tmp64, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp64 : 0;
     }
-    Arr1DIdxRowM(tmp64, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp64 : 0;
   }
 
   uint64_t *tmp65 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp65
    * at (2125,1-2125,36) */
   uint64_t __tmp_in_tmp65;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp65;
+  if (!binary_input::readArray(
+          tmp65,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp65;
+      }
+      Arr1DIdxRowM(tmp65, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp65 : 0;
     }
-    Arr1DIdxRowM(tmp65, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp65 : 0;
   }
 
   uint64_t *tmp66 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp66
    * at (2128,1-2128,36) */
   uint64_t __tmp_in_tmp66;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp66;
+  if (!binary_input::readArray(
+          tmp66,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp66;
+      }
+      Arr1DIdxRowM(tmp66, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp66 : 0;
     }
-    Arr1DIdxRowM(tmp66, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp66 : 0;
   }
 
   uint64_t *tmp67 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp67
    * at (2131,1-2131,36) */
   uint64_t __tmp_in_tmp67;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp67;
+  if (!binary_input::readArray(
+          tmp67,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp67;
+      }
+      Arr1DIdxRowM(tmp67, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp67 : 0;
     }
-    Arr1DIdxRowM(tmp67, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp67 : 0;
   }
 
   uint64_t *tmp68 =
@@ -3202,16 +3542,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp68
    * at (2134,1-2134,47) */
   uint64_t __tmp_in_tmp68;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp68;
+  if (!binary_input::readArray(
+          tmp68,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)512) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp68;
+            }
+            Arr4DIdxRowM(tmp68, (int32_t)1, (int32_t)1, (int32_t)512,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp68 : 0;
           }
-          Arr4DIdxRowM(tmp68, (int32_t)1, (int32_t)1, (int32_t)512,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp68 : 0;
         }
       }
     }
@@ -3221,48 +3566,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp69
    * at (2137,1-2137,36) */
   uint64_t __tmp_in_tmp69;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp69;
+  if (!binary_input::readArray(
+          tmp69,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp69;
+      }
+      Arr1DIdxRowM(tmp69, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp69 : 0;
     }
-    Arr1DIdxRowM(tmp69, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp69 : 0;
   }
 
   uint64_t *tmp70 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp70
    * at (2140,1-2140,36) */
   uint64_t __tmp_in_tmp70;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp70;
+  if (!binary_input::readArray(
+          tmp70,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp70;
+      }
+      Arr1DIdxRowM(tmp70, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp70 : 0;
     }
-    Arr1DIdxRowM(tmp70, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp70 : 0;
   }
 
   uint64_t *tmp71 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp71
    * at (2143,1-2143,36) */
   uint64_t __tmp_in_tmp71;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp71;
+  if (!binary_input::readArray(
+          tmp71,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp71;
+      }
+      Arr1DIdxRowM(tmp71, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp71 : 0;
     }
-    Arr1DIdxRowM(tmp71, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp71 : 0;
   }
 
   uint64_t *tmp72 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp72
    * at (2146,1-2146,36) */
   uint64_t __tmp_in_tmp72;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp72;
+  if (!binary_input::readArray(
+          tmp72,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp72;
+      }
+      Arr1DIdxRowM(tmp72, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp72 : 0;
     }
-    Arr1DIdxRowM(tmp72, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp72 : 0;
   }
 
   uint64_t *tmp73 =
@@ -3270,16 +3635,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp73
    * at (2149,1-2149,47) */
   uint64_t __tmp_in_tmp73;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp73;
+  if (!binary_input::readArray(
+          tmp73,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp73;
+            }
+            Arr4DIdxRowM(tmp73, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp73 : 0;
           }
-          Arr4DIdxRowM(tmp73, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp73 : 0;
         }
       }
     }
@@ -3289,48 +3659,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp74
    * at (2152,1-2152,36) */
   uint64_t __tmp_in_tmp74;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp74;
+  if (!binary_input::readArray(
+          tmp74,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp74;
+      }
+      Arr1DIdxRowM(tmp74, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp74 : 0;
     }
-    Arr1DIdxRowM(tmp74, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp74 : 0;
   }
 
   uint64_t *tmp75 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp75
    * at (2155,1-2155,36) */
   uint64_t __tmp_in_tmp75;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp75;
+  if (!binary_input::readArray(
+          tmp75,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp75;
+      }
+      Arr1DIdxRowM(tmp75, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp75 : 0;
     }
-    Arr1DIdxRowM(tmp75, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp75 : 0;
   }
 
   uint64_t *tmp76 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp76
    * at (2158,1-2158,36) */
   uint64_t __tmp_in_tmp76;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp76;
+  if (!binary_input::readArray(
+          tmp76,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp76;
+      }
+      Arr1DIdxRowM(tmp76, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp76 : 0;
     }
-    Arr1DIdxRowM(tmp76, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp76 : 0;
   }
 
   uint64_t *tmp77 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp77
    * at (2161,1-2161,36) */
   uint64_t __tmp_in_tmp77;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp77;
+  if (!binary_input::readArray(
+          tmp77,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp77;
+      }
+      Arr1DIdxRowM(tmp77, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp77 : 0;
     }
-    Arr1DIdxRowM(tmp77, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp77 : 0;
   }
 
   uint64_t *tmp78 =
@@ -3338,16 +3728,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp78
    * at (2164,1-2164,47) */
   uint64_t __tmp_in_tmp78;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp78;
+  if (!binary_input::readArray(
+          tmp78,
+          (((((int32_t)1 * (int32_t)512) * (int32_t)128) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp78;
+            }
+            Arr4DIdxRowM(tmp78, (int32_t)1, (int32_t)1, (int32_t)128,
+                         (int32_t)512, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp78 : 0;
           }
-          Arr4DIdxRowM(tmp78, (int32_t)1, (int32_t)1, (int32_t)128,
-                       (int32_t)512, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp78 : 0;
         }
       }
     }
@@ -3357,48 +3752,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp79
    * at (2167,1-2167,36) */
   uint64_t __tmp_in_tmp79;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp79;
+  if (!binary_input::readArray(
+          tmp79,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp79;
+      }
+      Arr1DIdxRowM(tmp79, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp79 : 0;
     }
-    Arr1DIdxRowM(tmp79, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp79 : 0;
   }
 
   uint64_t *tmp80 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp80
    * at (2170,1-2170,36) */
   uint64_t __tmp_in_tmp80;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp80;
+  if (!binary_input::readArray(
+          tmp80,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp80;
+      }
+      Arr1DIdxRowM(tmp80, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp80 : 0;
     }
-    Arr1DIdxRowM(tmp80, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp80 : 0;
   }
 
   uint64_t *tmp81 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp81
    * at (2173,1-2173,36) */
   uint64_t __tmp_in_tmp81;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp81;
+  if (!binary_input::readArray(
+          tmp81,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp81;
+      }
+      Arr1DIdxRowM(tmp81, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp81 : 0;
     }
-    Arr1DIdxRowM(tmp81, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp81 : 0;
   }
 
   uint64_t *tmp82 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp82
    * at (2176,1-2176,36) */
   uint64_t __tmp_in_tmp82;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp82;
+  if (!binary_input::readArray(
+          tmp82,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp82;
+      }
+      Arr1DIdxRowM(tmp82, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp82 : 0;
     }
-    Arr1DIdxRowM(tmp82, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp82 : 0;
   }
 
   uint64_t *tmp83 =
@@ -3406,16 +3821,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp83
    * at (2179,1-2179,47) */
   uint64_t __tmp_in_tmp83;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp83;
+  if (!binary_input::readArray(
+          tmp83,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)512) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp83;
+            }
+            Arr4DIdxRowM(tmp83, (int32_t)1, (int32_t)1, (int32_t)512,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp83 : 0;
           }
-          Arr4DIdxRowM(tmp83, (int32_t)1, (int32_t)1, (int32_t)512,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp83 : 0;
         }
       }
     }
@@ -3425,48 +3845,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp84
    * at (2182,1-2182,36) */
   uint64_t __tmp_in_tmp84;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp84;
+  if (!binary_input::readArray(
+          tmp84,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp84;
+      }
+      Arr1DIdxRowM(tmp84, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp84 : 0;
     }
-    Arr1DIdxRowM(tmp84, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp84 : 0;
   }
 
   uint64_t *tmp85 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp85
    * at (2185,1-2185,36) */
   uint64_t __tmp_in_tmp85;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp85;
+  if (!binary_input::readArray(
+          tmp85,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp85;
+      }
+      Arr1DIdxRowM(tmp85, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp85 : 0;
     }
-    Arr1DIdxRowM(tmp85, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp85 : 0;
   }
 
   uint64_t *tmp86 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp86
    * at (2188,1-2188,36) */
   uint64_t __tmp_in_tmp86;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp86;
+  if (!binary_input::readArray(
+          tmp86,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp86;
+      }
+      Arr1DIdxRowM(tmp86, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp86 : 0;
     }
-    Arr1DIdxRowM(tmp86, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp86 : 0;
   }
 
   uint64_t *tmp87 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp87
    * at (2191,1-2191,36) */
   uint64_t __tmp_in_tmp87;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp87;
+  if (!binary_input::readArray(
+          tmp87,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp87;
+      }
+      Arr1DIdxRowM(tmp87, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp87 : 0;
     }
-    Arr1DIdxRowM(tmp87, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp87 : 0;
   }
 
   uint64_t *tmp88 =
@@ -3474,16 +3914,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp88
    * at (2194,1-2194,47) */
   uint64_t __tmp_in_tmp88;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp88;
+  if (!binary_input::readArray(
+          tmp88,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp88;
+            }
+            Arr4DIdxRowM(tmp88, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp88 : 0;
           }
-          Arr4DIdxRowM(tmp88, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp88 : 0;
         }
       }
     }
@@ -3493,48 +3938,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp89
    * at (2197,1-2197,36) */
   uint64_t __tmp_in_tmp89;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp89;
+  if (!binary_input::readArray(
+          tmp89,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp89;
+      }
+      Arr1DIdxRowM(tmp89, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp89 : 0;
     }
-    Arr1DIdxRowM(tmp89, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp89 : 0;
   }
 
   uint64_t *tmp90 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp90
    * at (2200,1-2200,36) */
   uint64_t __tmp_in_tmp90;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp90;
+  if (!binary_input::readArray(
+          tmp90,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp90;
+      }
+      Arr1DIdxRowM(tmp90, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp90 : 0;
     }
-    Arr1DIdxRowM(tmp90, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp90 : 0;
   }
 
   uint64_t *tmp91 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp91
    * at (2203,1-2203,36) */
   uint64_t __tmp_in_tmp91;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp91;
+  if (!binary_input::readArray(
+          tmp91,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp91;
+      }
+      Arr1DIdxRowM(tmp91, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp91 : 0;
     }
-    Arr1DIdxRowM(tmp91, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp91 : 0;
   }
 
   uint64_t *tmp92 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp92
    * at (2206,1-2206,36) */
   uint64_t __tmp_in_tmp92;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp92;
+  if (!binary_input::readArray(
+          tmp92,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp92;
+      }
+      Arr1DIdxRowM(tmp92, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp92 : 0;
     }
-    Arr1DIdxRowM(tmp92, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp92 : 0;
   }
 
   uint64_t *tmp93 =
@@ -3542,16 +4007,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp93
    * at (2209,1-2209,47) */
   uint64_t __tmp_in_tmp93;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp93;
+  if (!binary_input::readArray(
+          tmp93,
+          (((((int32_t)1 * (int32_t)512) * (int32_t)128) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp93;
+            }
+            Arr4DIdxRowM(tmp93, (int32_t)1, (int32_t)1, (int32_t)128,
+                         (int32_t)512, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp93 : 0;
           }
-          Arr4DIdxRowM(tmp93, (int32_t)1, (int32_t)1, (int32_t)128,
-                       (int32_t)512, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp93 : 0;
         }
       }
     }
@@ -3561,48 +4031,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp94
    * at (2212,1-2212,36) */
   uint64_t __tmp_in_tmp94;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp94;
+  if (!binary_input::readArray(
+          tmp94,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp94;
+      }
+      Arr1DIdxRowM(tmp94, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp94 : 0;
     }
-    Arr1DIdxRowM(tmp94, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp94 : 0;
   }
 
   uint64_t *tmp95 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp95
    * at (2215,1-2215,36) */
   uint64_t __tmp_in_tmp95;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp95;
+  if (!binary_input::readArray(
+          tmp95,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp95;
+      }
+      Arr1DIdxRowM(tmp95, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp95 : 0;
     }
-    Arr1DIdxRowM(tmp95, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp95 : 0;
   }
 
   uint64_t *tmp96 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp96
    * at (2218,1-2218,36) */
   uint64_t __tmp_in_tmp96;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp96;
+  if (!binary_input::readArray(
+          tmp96,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp96;
+      }
+      Arr1DIdxRowM(tmp96, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp96 : 0;
     }
-    Arr1DIdxRowM(tmp96, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp96 : 0;
   }
 
   uint64_t *tmp97 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp97
    * at (2221,1-2221,36) */
   uint64_t __tmp_in_tmp97;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp97;
+  if (!binary_input::readArray(
+          tmp97,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp97;
+      }
+      Arr1DIdxRowM(tmp97, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp97 : 0;
     }
-    Arr1DIdxRowM(tmp97, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp97 : 0;
   }
 
   uint64_t *tmp98 =
@@ -3610,16 +4100,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp98
    * at (2224,1-2224,47) */
   uint64_t __tmp_in_tmp98;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp98;
+  if (!binary_input::readArray(
+          tmp98,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)512) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp98;
+            }
+            Arr4DIdxRowM(tmp98, (int32_t)1, (int32_t)1, (int32_t)512,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp98 : 0;
           }
-          Arr4DIdxRowM(tmp98, (int32_t)1, (int32_t)1, (int32_t)512,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp98 : 0;
         }
       }
     }
@@ -3629,48 +4124,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp99
    * at (2227,1-2227,36) */
   uint64_t __tmp_in_tmp99;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp99;
+  if (!binary_input::readArray(
+          tmp99,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp99;
+      }
+      Arr1DIdxRowM(tmp99, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp99 : 0;
     }
-    Arr1DIdxRowM(tmp99, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp99 : 0;
   }
 
   uint64_t *tmp100 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp100
    * at (2230,1-2230,37) */
   uint64_t __tmp_in_tmp100;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp100;
+  if (!binary_input::readArray(
+          tmp100,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp100;
+      }
+      Arr1DIdxRowM(tmp100, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp100 : 0;
     }
-    Arr1DIdxRowM(tmp100, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp100 : 0;
   }
 
   uint64_t *tmp101 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp101
    * at (2233,1-2233,37) */
   uint64_t __tmp_in_tmp101;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp101;
+  if (!binary_input::readArray(
+          tmp101,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp101;
+      }
+      Arr1DIdxRowM(tmp101, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp101 : 0;
     }
-    Arr1DIdxRowM(tmp101, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp101 : 0;
   }
 
   uint64_t *tmp102 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp102
    * at (2236,1-2236,37) */
   uint64_t __tmp_in_tmp102;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp102;
+  if (!binary_input::readArray(
+          tmp102,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp102;
+      }
+      Arr1DIdxRowM(tmp102, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp102 : 0;
     }
-    Arr1DIdxRowM(tmp102, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp102 : 0;
   }
 
   uint64_t *tmp103 =
@@ -3678,16 +4193,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp103
    * at (2239,1-2239,48) */
   uint64_t __tmp_in_tmp103;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp103;
+  if (!binary_input::readArray(
+          tmp103,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)128) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp103;
+            }
+            Arr4DIdxRowM(tmp103, (int32_t)3, (int32_t)3, (int32_t)128,
+                         (int32_t)128, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp103 : 0;
           }
-          Arr4DIdxRowM(tmp103, (int32_t)3, (int32_t)3, (int32_t)128,
-                       (int32_t)128, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp103 : 0;
         }
       }
     }
@@ -3697,48 +4217,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp104
    * at (2242,1-2242,37) */
   uint64_t __tmp_in_tmp104;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp104;
+  if (!binary_input::readArray(
+          tmp104,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp104;
+      }
+      Arr1DIdxRowM(tmp104, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp104 : 0;
     }
-    Arr1DIdxRowM(tmp104, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp104 : 0;
   }
 
   uint64_t *tmp105 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp105
    * at (2245,1-2245,37) */
   uint64_t __tmp_in_tmp105;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp105;
+  if (!binary_input::readArray(
+          tmp105,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp105;
+      }
+      Arr1DIdxRowM(tmp105, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp105 : 0;
     }
-    Arr1DIdxRowM(tmp105, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp105 : 0;
   }
 
   uint64_t *tmp106 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp106
    * at (2248,1-2248,37) */
   uint64_t __tmp_in_tmp106;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp106;
+  if (!binary_input::readArray(
+          tmp106,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp106;
+      }
+      Arr1DIdxRowM(tmp106, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp106 : 0;
     }
-    Arr1DIdxRowM(tmp106, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp106 : 0;
   }
 
   uint64_t *tmp107 = make_array<uint64_t>((int32_t)128);
   /* Variable to read the clear value corresponding to the input variable tmp107
    * at (2251,1-2251,37) */
   uint64_t __tmp_in_tmp107;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp107;
+  if (!binary_input::readArray(
+          tmp107,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp107;
+      }
+      Arr1DIdxRowM(tmp107, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp107 : 0;
     }
-    Arr1DIdxRowM(tmp107, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp107 : 0;
   }
 
   uint64_t *tmp108 =
@@ -3746,16 +4286,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp108
    * at (2254,1-2254,48) */
   uint64_t __tmp_in_tmp108;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp108;
+  if (!binary_input::readArray(
+          tmp108,
+          (((((int32_t)1 * (int32_t)512) * (int32_t)128) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp108;
+            }
+            Arr4DIdxRowM(tmp108, (int32_t)1, (int32_t)1, (int32_t)128,
+                         (int32_t)512, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp108 : 0;
           }
-          Arr4DIdxRowM(tmp108, (int32_t)1, (int32_t)1, (int32_t)128,
-                       (int32_t)512, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp108 : 0;
         }
       }
     }
@@ -3765,48 +4310,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp109
    * at (2257,1-2257,37) */
   uint64_t __tmp_in_tmp109;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp109;
+  if (!binary_input::readArray(
+          tmp109,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp109;
+      }
+      Arr1DIdxRowM(tmp109, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp109 : 0;
     }
-    Arr1DIdxRowM(tmp109, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp109 : 0;
   }
 
   uint64_t *tmp110 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp110
    * at (2260,1-2260,37) */
   uint64_t __tmp_in_tmp110;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp110;
+  if (!binary_input::readArray(
+          tmp110,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp110;
+      }
+      Arr1DIdxRowM(tmp110, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp110 : 0;
     }
-    Arr1DIdxRowM(tmp110, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp110 : 0;
   }
 
   uint64_t *tmp111 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp111
    * at (2263,1-2263,37) */
   uint64_t __tmp_in_tmp111;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp111;
+  if (!binary_input::readArray(
+          tmp111,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp111;
+      }
+      Arr1DIdxRowM(tmp111, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp111 : 0;
     }
-    Arr1DIdxRowM(tmp111, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp111 : 0;
   }
 
   uint64_t *tmp112 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp112
    * at (2266,1-2266,37) */
   uint64_t __tmp_in_tmp112;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp112;
+  if (!binary_input::readArray(
+          tmp112,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp112;
+      }
+      Arr1DIdxRowM(tmp112, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp112 : 0;
     }
-    Arr1DIdxRowM(tmp112, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp112 : 0;
   }
 
   uint64_t *tmp113 =
@@ -3814,16 +4379,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp113
    * at (2269,1-2269,49) */
   uint64_t __tmp_in_tmp113;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1024; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp113;
+  if (!binary_input::readArray(
+          tmp113,
+          (((((int32_t)1 * (int32_t)1024) * (int32_t)512) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1024; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp113;
+            }
+            Arr4DIdxRowM(tmp113, (int32_t)1, (int32_t)1, (int32_t)512,
+                         (int32_t)1024, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp113 : 0;
           }
-          Arr4DIdxRowM(tmp113, (int32_t)1, (int32_t)1, (int32_t)512,
-                       (int32_t)1024, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp113 : 0;
         }
       }
     }
@@ -3834,16 +4404,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp114
    * at (2272,1-2272,48) */
   uint64_t __tmp_in_tmp114;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp114;
+  if (!binary_input::readArray(
+          tmp114,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)512) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp114;
+            }
+            Arr4DIdxRowM(tmp114, (int32_t)1, (int32_t)1, (int32_t)512,
+                         (int32_t)256, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp114 : 0;
           }
-          Arr4DIdxRowM(tmp114, (int32_t)1, (int32_t)1, (int32_t)512,
-                       (int32_t)256, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp114 : 0;
         }
       }
     }
@@ -3853,48 +4428,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp115
    * at (2275,1-2275,37) */
   uint64_t __tmp_in_tmp115;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp115;
+  if (!binary_input::readArray(
+          tmp115,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp115;
+      }
+      Arr1DIdxRowM(tmp115, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp115 : 0;
     }
-    Arr1DIdxRowM(tmp115, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp115 : 0;
   }
 
   uint64_t *tmp116 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp116
    * at (2278,1-2278,37) */
   uint64_t __tmp_in_tmp116;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp116;
+  if (!binary_input::readArray(
+          tmp116,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp116;
+      }
+      Arr1DIdxRowM(tmp116, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp116 : 0;
     }
-    Arr1DIdxRowM(tmp116, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp116 : 0;
   }
 
   uint64_t *tmp117 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp117
    * at (2281,1-2281,37) */
   uint64_t __tmp_in_tmp117;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp117;
+  if (!binary_input::readArray(
+          tmp117,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp117;
+      }
+      Arr1DIdxRowM(tmp117, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp117 : 0;
     }
-    Arr1DIdxRowM(tmp117, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp117 : 0;
   }
 
   uint64_t *tmp118 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp118
    * at (2284,1-2284,37) */
   uint64_t __tmp_in_tmp118;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp118;
+  if (!binary_input::readArray(
+          tmp118,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp118;
+      }
+      Arr1DIdxRowM(tmp118, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp118 : 0;
     }
-    Arr1DIdxRowM(tmp118, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp118 : 0;
   }
 
   uint64_t *tmp119 =
@@ -3902,16 +4497,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp119
    * at (2287,1-2287,48) */
   uint64_t __tmp_in_tmp119;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp119;
+  if (!binary_input::readArray(
+          tmp119,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)256) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp119;
+            }
+            Arr4DIdxRowM(tmp119, (int32_t)3, (int32_t)3, (int32_t)256,
+                         (int32_t)256, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp119 : 0;
           }
-          Arr4DIdxRowM(tmp119, (int32_t)3, (int32_t)3, (int32_t)256,
-                       (int32_t)256, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp119 : 0;
         }
       }
     }
@@ -3921,48 +4521,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp120
    * at (2290,1-2290,37) */
   uint64_t __tmp_in_tmp120;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp120;
+  if (!binary_input::readArray(
+          tmp120,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp120;
+      }
+      Arr1DIdxRowM(tmp120, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp120 : 0;
     }
-    Arr1DIdxRowM(tmp120, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp120 : 0;
   }
 
   uint64_t *tmp121 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp121
    * at (2293,1-2293,37) */
   uint64_t __tmp_in_tmp121;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp121;
+  if (!binary_input::readArray(
+          tmp121,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp121;
+      }
+      Arr1DIdxRowM(tmp121, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp121 : 0;
     }
-    Arr1DIdxRowM(tmp121, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp121 : 0;
   }
 
   uint64_t *tmp122 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp122
    * at (2296,1-2296,37) */
   uint64_t __tmp_in_tmp122;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp122;
+  if (!binary_input::readArray(
+          tmp122,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp122;
+      }
+      Arr1DIdxRowM(tmp122, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp122 : 0;
     }
-    Arr1DIdxRowM(tmp122, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp122 : 0;
   }
 
   uint64_t *tmp123 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp123
    * at (2299,1-2299,37) */
   uint64_t __tmp_in_tmp123;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp123;
+  if (!binary_input::readArray(
+          tmp123,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp123;
+      }
+      Arr1DIdxRowM(tmp123, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp123 : 0;
     }
-    Arr1DIdxRowM(tmp123, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp123 : 0;
   }
 
   uint64_t *tmp124 =
@@ -3970,16 +4590,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp124
    * at (2302,1-2302,49) */
   uint64_t __tmp_in_tmp124;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1024; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp124;
+  if (!binary_input::readArray(
+          tmp124,
+          (((((int32_t)1 * (int32_t)1024) * (int32_t)256) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1024; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp124;
+            }
+            Arr4DIdxRowM(tmp124, (int32_t)1, (int32_t)1, (int32_t)256,
+                         (int32_t)1024, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp124 : 0;
           }
-          Arr4DIdxRowM(tmp124, (int32_t)1, (int32_t)1, (int32_t)256,
-                       (int32_t)1024, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp124 : 0;
         }
       }
     }
@@ -3989,48 +4614,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp125
    * at (2305,1-2305,38) */
   uint64_t __tmp_in_tmp125;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp125;
+  if (!binary_input::readArray(
+          tmp125,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp125;
+      }
+      Arr1DIdxRowM(tmp125, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp125 : 0;
     }
-    Arr1DIdxRowM(tmp125, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp125 : 0;
   }
 
   uint64_t *tmp126 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp126
    * at (2308,1-2308,38) */
   uint64_t __tmp_in_tmp126;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp126;
+  if (!binary_input::readArray(
+          tmp126,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp126;
+      }
+      Arr1DIdxRowM(tmp126, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp126 : 0;
     }
-    Arr1DIdxRowM(tmp126, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp126 : 0;
   }
 
   uint64_t *tmp127 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp127
    * at (2311,1-2311,38) */
   uint64_t __tmp_in_tmp127;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp127;
+  if (!binary_input::readArray(
+          tmp127,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp127;
+      }
+      Arr1DIdxRowM(tmp127, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp127 : 0;
     }
-    Arr1DIdxRowM(tmp127, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp127 : 0;
   }
 
   uint64_t *tmp128 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp128
    * at (2314,1-2314,38) */
   uint64_t __tmp_in_tmp128;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp128;
+  if (!binary_input::readArray(
+          tmp128,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp128;
+      }
+      Arr1DIdxRowM(tmp128, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp128 : 0;
     }
-    Arr1DIdxRowM(tmp128, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp128 : 0;
   }
 
   uint64_t *tmp129 =
@@ -4038,16 +4683,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp129
    * at (2317,1-2317,49) */
   uint64_t __tmp_in_tmp129;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp129;
+  if (!binary_input::readArray(
+          tmp129,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)1024) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp129;
+            }
+            Arr4DIdxRowM(tmp129, (int32_t)1, (int32_t)1, (int32_t)1024,
+                         (int32_t)256, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp129 : 0;
           }
-          Arr4DIdxRowM(tmp129, (int32_t)1, (int32_t)1, (int32_t)1024,
-                       (int32_t)256, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp129 : 0;
         }
       }
     }
@@ -4057,48 +4707,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp130
    * at (2320,1-2320,37) */
   uint64_t __tmp_in_tmp130;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp130;
+  if (!binary_input::readArray(
+          tmp130,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp130;
+      }
+      Arr1DIdxRowM(tmp130, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp130 : 0;
     }
-    Arr1DIdxRowM(tmp130, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp130 : 0;
   }
 
   uint64_t *tmp131 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp131
    * at (2323,1-2323,37) */
   uint64_t __tmp_in_tmp131;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp131;
+  if (!binary_input::readArray(
+          tmp131,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp131;
+      }
+      Arr1DIdxRowM(tmp131, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp131 : 0;
     }
-    Arr1DIdxRowM(tmp131, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp131 : 0;
   }
 
   uint64_t *tmp132 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp132
    * at (2326,1-2326,37) */
   uint64_t __tmp_in_tmp132;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp132;
+  if (!binary_input::readArray(
+          tmp132,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp132;
+      }
+      Arr1DIdxRowM(tmp132, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp132 : 0;
     }
-    Arr1DIdxRowM(tmp132, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp132 : 0;
   }
 
   uint64_t *tmp133 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp133
    * at (2329,1-2329,37) */
   uint64_t __tmp_in_tmp133;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp133;
+  if (!binary_input::readArray(
+          tmp133,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp133;
+      }
+      Arr1DIdxRowM(tmp133, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp133 : 0;
     }
-    Arr1DIdxRowM(tmp133, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp133 : 0;
   }
 
   uint64_t *tmp134 =
@@ -4106,16 +4776,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp134
    * at (2332,1-2332,48) */
   uint64_t __tmp_in_tmp134;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp134;
+  if (!binary_input::readArray(
+          tmp134,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)256) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp134;
+            }
+            Arr4DIdxRowM(tmp134, (int32_t)3, (int32_t)3, (int32_t)256,
+                         (int32_t)256, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp134 : 0;
           }
-          Arr4DIdxRowM(tmp134, (int32_t)3, (int32_t)3, (int32_t)256,
-                       (int32_t)256, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp134 : 0;
         }
       }
     }
@@ -4125,48 +4800,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp135
    * at (2335,1-2335,37) */
   uint64_t __tmp_in_tmp135;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp135;
+  if (!binary_input::readArray(
+          tmp135,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp135;
+      }
+      Arr1DIdxRowM(tmp135, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp135 : 0;
     }
-    Arr1DIdxRowM(tmp135, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp135 : 0;
   }
 
   uint64_t *tmp136 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp136
    * at (2338,1-2338,37) */
   uint64_t __tmp_in_tmp136;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp136;
+  if (!binary_input::readArray(
+          tmp136,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp136;
+      }
+      Arr1DIdxRowM(tmp136, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp136 : 0;
     }
-    Arr1DIdxRowM(tmp136, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp136 : 0;
   }
 
   uint64_t *tmp137 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp137
    * at (2341,1-2341,37) */
   uint64_t __tmp_in_tmp137;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp137;
+  if (!binary_input::readArray(
+          tmp137,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp137;
+      }
+      Arr1DIdxRowM(tmp137, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp137 : 0;
     }
-    Arr1DIdxRowM(tmp137, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp137 : 0;
   }
 
   uint64_t *tmp138 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp138
    * at (2344,1-2344,37) */
   uint64_t __tmp_in_tmp138;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp138;
+  if (!binary_input::readArray(
+          tmp138,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp138;
+      }
+      Arr1DIdxRowM(tmp138, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp138 : 0;
     }
-    Arr1DIdxRowM(tmp138, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp138 : 0;
   }
 
   uint64_t *tmp139 =
@@ -4174,16 +4869,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp139
    * at (2347,1-2347,49) */
   uint64_t __tmp_in_tmp139;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1024; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp139;
+  if (!binary_input::readArray(
+          tmp139,
+          (((((int32_t)1 * (int32_t)1024) * (int32_t)256) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1024; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp139;
+            }
+            Arr4DIdxRowM(tmp139, (int32_t)1, (int32_t)1, (int32_t)256,
+                         (int32_t)1024, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp139 : 0;
           }
-          Arr4DIdxRowM(tmp139, (int32_t)1, (int32_t)1, (int32_t)256,
-                       (int32_t)1024, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp139 : 0;
         }
       }
     }
@@ -4193,48 +4893,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp140
    * at (2350,1-2350,38) */
   uint64_t __tmp_in_tmp140;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp140;
+  if (!binary_input::readArray(
+          tmp140,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp140;
+      }
+      Arr1DIdxRowM(tmp140, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp140 : 0;
     }
-    Arr1DIdxRowM(tmp140, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp140 : 0;
   }
 
   uint64_t *tmp141 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp141
    * at (2353,1-2353,38) */
   uint64_t __tmp_in_tmp141;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp141;
+  if (!binary_input::readArray(
+          tmp141,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp141;
+      }
+      Arr1DIdxRowM(tmp141, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp141 : 0;
     }
-    Arr1DIdxRowM(tmp141, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp141 : 0;
   }
 
   uint64_t *tmp142 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp142
    * at (2356,1-2356,38) */
   uint64_t __tmp_in_tmp142;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp142;
+  if (!binary_input::readArray(
+          tmp142,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp142;
+      }
+      Arr1DIdxRowM(tmp142, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp142 : 0;
     }
-    Arr1DIdxRowM(tmp142, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp142 : 0;
   }
 
   uint64_t *tmp143 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp143
    * at (2359,1-2359,38) */
   uint64_t __tmp_in_tmp143;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp143;
+  if (!binary_input::readArray(
+          tmp143,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp143;
+      }
+      Arr1DIdxRowM(tmp143, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp143 : 0;
     }
-    Arr1DIdxRowM(tmp143, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp143 : 0;
   }
 
   uint64_t *tmp144 =
@@ -4242,16 +4962,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp144
    * at (2362,1-2362,49) */
   uint64_t __tmp_in_tmp144;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp144;
+  if (!binary_input::readArray(
+          tmp144,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)1024) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp144;
+            }
+            Arr4DIdxRowM(tmp144, (int32_t)1, (int32_t)1, (int32_t)1024,
+                         (int32_t)256, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp144 : 0;
           }
-          Arr4DIdxRowM(tmp144, (int32_t)1, (int32_t)1, (int32_t)1024,
-                       (int32_t)256, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp144 : 0;
         }
       }
     }
@@ -4261,48 +4986,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp145
    * at (2365,1-2365,37) */
   uint64_t __tmp_in_tmp145;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp145;
+  if (!binary_input::readArray(
+          tmp145,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp145;
+      }
+      Arr1DIdxRowM(tmp145, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp145 : 0;
     }
-    Arr1DIdxRowM(tmp145, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp145 : 0;
   }
 
   uint64_t *tmp146 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp146
    * at (2368,1-2368,37) */
   uint64_t __tmp_in_tmp146;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp146;
+  if (!binary_input::readArray(
+          tmp146,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp146;
+      }
+      Arr1DIdxRowM(tmp146, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp146 : 0;
     }
-    Arr1DIdxRowM(tmp146, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp146 : 0;
   }
 
   uint64_t *tmp147 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp147
    * at (2371,1-2371,37) */
   uint64_t __tmp_in_tmp147;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp147;
+  if (!binary_input::readArray(
+          tmp147,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp147;
+      }
+      Arr1DIdxRowM(tmp147, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp147 : 0;
     }
-    Arr1DIdxRowM(tmp147, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp147 : 0;
   }
 
   uint64_t *tmp148 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp148
    * at (2374,1-2374,37) */
   uint64_t __tmp_in_tmp148;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp148;
+  if (!binary_input::readArray(
+          tmp148,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp148;
+      }
+      Arr1DIdxRowM(tmp148, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp148 : 0;
     }
-    Arr1DIdxRowM(tmp148, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp148 : 0;
   }
 
   uint64_t *tmp149 =
@@ -4310,16 +5055,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp149
    * at (2377,1-2377,48) */
   uint64_t __tmp_in_tmp149;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp149;
+  if (!binary_input::readArray(
+          tmp149,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)256) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp149;
+            }
+            Arr4DIdxRowM(tmp149, (int32_t)3, (int32_t)3, (int32_t)256,
+                         (int32_t)256, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp149 : 0;
           }
-          Arr4DIdxRowM(tmp149, (int32_t)3, (int32_t)3, (int32_t)256,
-                       (int32_t)256, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp149 : 0;
         }
       }
     }
@@ -4329,48 +5079,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp150
    * at (2380,1-2380,37) */
   uint64_t __tmp_in_tmp150;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp150;
+  if (!binary_input::readArray(
+          tmp150,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp150;
+      }
+      Arr1DIdxRowM(tmp150, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp150 : 0;
     }
-    Arr1DIdxRowM(tmp150, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp150 : 0;
   }
 
   uint64_t *tmp151 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp151
    * at (2383,1-2383,37) */
   uint64_t __tmp_in_tmp151;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp151;
+  if (!binary_input::readArray(
+          tmp151,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp151;
+      }
+      Arr1DIdxRowM(tmp151, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp151 : 0;
     }
-    Arr1DIdxRowM(tmp151, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp151 : 0;
   }
 
   uint64_t *tmp152 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp152
    * at (2386,1-2386,37) */
   uint64_t __tmp_in_tmp152;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp152;
+  if (!binary_input::readArray(
+          tmp152,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp152;
+      }
+      Arr1DIdxRowM(tmp152, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp152 : 0;
     }
-    Arr1DIdxRowM(tmp152, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp152 : 0;
   }
 
   uint64_t *tmp153 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp153
    * at (2389,1-2389,37) */
   uint64_t __tmp_in_tmp153;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp153;
+  if (!binary_input::readArray(
+          tmp153,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp153;
+      }
+      Arr1DIdxRowM(tmp153, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp153 : 0;
     }
-    Arr1DIdxRowM(tmp153, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp153 : 0;
   }
 
   uint64_t *tmp154 =
@@ -4378,16 +5148,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp154
    * at (2392,1-2392,49) */
   uint64_t __tmp_in_tmp154;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1024; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp154;
+  if (!binary_input::readArray(
+          tmp154,
+          (((((int32_t)1 * (int32_t)1024) * (int32_t)256) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1024; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp154;
+            }
+            Arr4DIdxRowM(tmp154, (int32_t)1, (int32_t)1, (int32_t)256,
+                         (int32_t)1024, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp154 : 0;
           }
-          Arr4DIdxRowM(tmp154, (int32_t)1, (int32_t)1, (int32_t)256,
-                       (int32_t)1024, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp154 : 0;
         }
       }
     }
@@ -4397,48 +5172,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp155
    * at (2395,1-2395,38) */
   uint64_t __tmp_in_tmp155;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp155;
+  if (!binary_input::readArray(
+          tmp155,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp155;
+      }
+      Arr1DIdxRowM(tmp155, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp155 : 0;
     }
-    Arr1DIdxRowM(tmp155, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp155 : 0;
   }
 
   uint64_t *tmp156 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp156
    * at (2398,1-2398,38) */
   uint64_t __tmp_in_tmp156;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp156;
+  if (!binary_input::readArray(
+          tmp156,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp156;
+      }
+      Arr1DIdxRowM(tmp156, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp156 : 0;
     }
-    Arr1DIdxRowM(tmp156, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp156 : 0;
   }
 
   uint64_t *tmp157 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp157
    * at (2401,1-2401,38) */
   uint64_t __tmp_in_tmp157;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp157;
+  if (!binary_input::readArray(
+          tmp157,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp157;
+      }
+      Arr1DIdxRowM(tmp157, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp157 : 0;
     }
-    Arr1DIdxRowM(tmp157, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp157 : 0;
   }
 
   uint64_t *tmp158 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp158
    * at (2404,1-2404,38) */
   uint64_t __tmp_in_tmp158;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp158;
+  if (!binary_input::readArray(
+          tmp158,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp158;
+      }
+      Arr1DIdxRowM(tmp158, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp158 : 0;
     }
-    Arr1DIdxRowM(tmp158, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp158 : 0;
   }
 
   uint64_t *tmp159 =
@@ -4446,16 +5241,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp159
    * at (2407,1-2407,49) */
   uint64_t __tmp_in_tmp159;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp159;
+  if (!binary_input::readArray(
+          tmp159,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)1024) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp159;
+            }
+            Arr4DIdxRowM(tmp159, (int32_t)1, (int32_t)1, (int32_t)1024,
+                         (int32_t)256, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp159 : 0;
           }
-          Arr4DIdxRowM(tmp159, (int32_t)1, (int32_t)1, (int32_t)1024,
-                       (int32_t)256, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp159 : 0;
         }
       }
     }
@@ -4465,48 +5265,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp160
    * at (2410,1-2410,37) */
   uint64_t __tmp_in_tmp160;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp160;
+  if (!binary_input::readArray(
+          tmp160,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp160;
+      }
+      Arr1DIdxRowM(tmp160, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp160 : 0;
     }
-    Arr1DIdxRowM(tmp160, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp160 : 0;
   }
 
   uint64_t *tmp161 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp161
    * at (2413,1-2413,37) */
   uint64_t __tmp_in_tmp161;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp161;
+  if (!binary_input::readArray(
+          tmp161,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp161;
+      }
+      Arr1DIdxRowM(tmp161, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp161 : 0;
     }
-    Arr1DIdxRowM(tmp161, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp161 : 0;
   }
 
   uint64_t *tmp162 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp162
    * at (2416,1-2416,37) */
   uint64_t __tmp_in_tmp162;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp162;
+  if (!binary_input::readArray(
+          tmp162,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp162;
+      }
+      Arr1DIdxRowM(tmp162, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp162 : 0;
     }
-    Arr1DIdxRowM(tmp162, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp162 : 0;
   }
 
   uint64_t *tmp163 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp163
    * at (2419,1-2419,37) */
   uint64_t __tmp_in_tmp163;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp163;
+  if (!binary_input::readArray(
+          tmp163,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp163;
+      }
+      Arr1DIdxRowM(tmp163, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp163 : 0;
     }
-    Arr1DIdxRowM(tmp163, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp163 : 0;
   }
 
   uint64_t *tmp164 =
@@ -4514,16 +5334,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp164
    * at (2422,1-2422,48) */
   uint64_t __tmp_in_tmp164;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp164;
+  if (!binary_input::readArray(
+          tmp164,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)256) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp164;
+            }
+            Arr4DIdxRowM(tmp164, (int32_t)3, (int32_t)3, (int32_t)256,
+                         (int32_t)256, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp164 : 0;
           }
-          Arr4DIdxRowM(tmp164, (int32_t)3, (int32_t)3, (int32_t)256,
-                       (int32_t)256, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp164 : 0;
         }
       }
     }
@@ -4533,48 +5358,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp165
    * at (2425,1-2425,37) */
   uint64_t __tmp_in_tmp165;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp165;
+  if (!binary_input::readArray(
+          tmp165,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp165;
+      }
+      Arr1DIdxRowM(tmp165, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp165 : 0;
     }
-    Arr1DIdxRowM(tmp165, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp165 : 0;
   }
 
   uint64_t *tmp166 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp166
    * at (2428,1-2428,37) */
   uint64_t __tmp_in_tmp166;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp166;
+  if (!binary_input::readArray(
+          tmp166,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp166;
+      }
+      Arr1DIdxRowM(tmp166, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp166 : 0;
     }
-    Arr1DIdxRowM(tmp166, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp166 : 0;
   }
 
   uint64_t *tmp167 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp167
    * at (2431,1-2431,37) */
   uint64_t __tmp_in_tmp167;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp167;
+  if (!binary_input::readArray(
+          tmp167,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp167;
+      }
+      Arr1DIdxRowM(tmp167, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp167 : 0;
     }
-    Arr1DIdxRowM(tmp167, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp167 : 0;
   }
 
   uint64_t *tmp168 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp168
    * at (2434,1-2434,37) */
   uint64_t __tmp_in_tmp168;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp168;
+  if (!binary_input::readArray(
+          tmp168,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp168;
+      }
+      Arr1DIdxRowM(tmp168, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp168 : 0;
     }
-    Arr1DIdxRowM(tmp168, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp168 : 0;
   }
 
   uint64_t *tmp169 =
@@ -4582,16 +5427,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp169
    * at (2437,1-2437,49) */
   uint64_t __tmp_in_tmp169;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1024; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp169;
+  if (!binary_input::readArray(
+          tmp169,
+          (((((int32_t)1 * (int32_t)1024) * (int32_t)256) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1024; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp169;
+            }
+            Arr4DIdxRowM(tmp169, (int32_t)1, (int32_t)1, (int32_t)256,
+                         (int32_t)1024, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp169 : 0;
           }
-          Arr4DIdxRowM(tmp169, (int32_t)1, (int32_t)1, (int32_t)256,
-                       (int32_t)1024, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp169 : 0;
         }
       }
     }
@@ -4601,48 +5451,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp170
    * at (2440,1-2440,38) */
   uint64_t __tmp_in_tmp170;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp170;
+  if (!binary_input::readArray(
+          tmp170,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp170;
+      }
+      Arr1DIdxRowM(tmp170, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp170 : 0;
     }
-    Arr1DIdxRowM(tmp170, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp170 : 0;
   }
 
   uint64_t *tmp171 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp171
    * at (2443,1-2443,38) */
   uint64_t __tmp_in_tmp171;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp171;
+  if (!binary_input::readArray(
+          tmp171,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp171;
+      }
+      Arr1DIdxRowM(tmp171, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp171 : 0;
     }
-    Arr1DIdxRowM(tmp171, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp171 : 0;
   }
 
   uint64_t *tmp172 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp172
    * at (2446,1-2446,38) */
   uint64_t __tmp_in_tmp172;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp172;
+  if (!binary_input::readArray(
+          tmp172,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp172;
+      }
+      Arr1DIdxRowM(tmp172, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp172 : 0;
     }
-    Arr1DIdxRowM(tmp172, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp172 : 0;
   }
 
   uint64_t *tmp173 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp173
    * at (2449,1-2449,38) */
   uint64_t __tmp_in_tmp173;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp173;
+  if (!binary_input::readArray(
+          tmp173,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp173;
+      }
+      Arr1DIdxRowM(tmp173, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp173 : 0;
     }
-    Arr1DIdxRowM(tmp173, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp173 : 0;
   }
 
   uint64_t *tmp174 =
@@ -4650,16 +5520,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp174
    * at (2452,1-2452,49) */
   uint64_t __tmp_in_tmp174;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp174;
+  if (!binary_input::readArray(
+          tmp174,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)1024) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp174;
+            }
+            Arr4DIdxRowM(tmp174, (int32_t)1, (int32_t)1, (int32_t)1024,
+                         (int32_t)256, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp174 : 0;
           }
-          Arr4DIdxRowM(tmp174, (int32_t)1, (int32_t)1, (int32_t)1024,
-                       (int32_t)256, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp174 : 0;
         }
       }
     }
@@ -4669,48 +5544,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp175
    * at (2455,1-2455,37) */
   uint64_t __tmp_in_tmp175;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp175;
+  if (!binary_input::readArray(
+          tmp175,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp175;
+      }
+      Arr1DIdxRowM(tmp175, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp175 : 0;
     }
-    Arr1DIdxRowM(tmp175, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp175 : 0;
   }
 
   uint64_t *tmp176 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp176
    * at (2458,1-2458,37) */
   uint64_t __tmp_in_tmp176;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp176;
+  if (!binary_input::readArray(
+          tmp176,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp176;
+      }
+      Arr1DIdxRowM(tmp176, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp176 : 0;
     }
-    Arr1DIdxRowM(tmp176, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp176 : 0;
   }
 
   uint64_t *tmp177 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp177
    * at (2461,1-2461,37) */
   uint64_t __tmp_in_tmp177;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp177;
+  if (!binary_input::readArray(
+          tmp177,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp177;
+      }
+      Arr1DIdxRowM(tmp177, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp177 : 0;
     }
-    Arr1DIdxRowM(tmp177, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp177 : 0;
   }
 
   uint64_t *tmp178 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp178
    * at (2464,1-2464,37) */
   uint64_t __tmp_in_tmp178;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp178;
+  if (!binary_input::readArray(
+          tmp178,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp178;
+      }
+      Arr1DIdxRowM(tmp178, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp178 : 0;
     }
-    Arr1DIdxRowM(tmp178, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp178 : 0;
   }
 
   uint64_t *tmp179 =
@@ -4718,16 +5613,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp179
    * at (2467,1-2467,48) */
   uint64_t __tmp_in_tmp179;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp179;
+  if (!binary_input::readArray(
+          tmp179,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)256) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp179;
+            }
+            Arr4DIdxRowM(tmp179, (int32_t)3, (int32_t)3, (int32_t)256,
+                         (int32_t)256, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp179 : 0;
           }
-          Arr4DIdxRowM(tmp179, (int32_t)3, (int32_t)3, (int32_t)256,
-                       (int32_t)256, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp179 : 0;
         }
       }
     }
@@ -4737,48 +5637,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp180
    * at (2470,1-2470,37) */
   uint64_t __tmp_in_tmp180;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp180;
+  if (!binary_input::readArray(
+          tmp180,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp180;
+      }
+      Arr1DIdxRowM(tmp180, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp180 : 0;
     }
-    Arr1DIdxRowM(tmp180, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp180 : 0;
   }
 
   uint64_t *tmp181 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp181
    * at (2473,1-2473,37) */
   uint64_t __tmp_in_tmp181;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp181;
+  if (!binary_input::readArray(
+          tmp181,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp181;
+      }
+      Arr1DIdxRowM(tmp181, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp181 : 0;
     }
-    Arr1DIdxRowM(tmp181, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp181 : 0;
   }
 
   uint64_t *tmp182 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp182
    * at (2476,1-2476,37) */
   uint64_t __tmp_in_tmp182;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp182;
+  if (!binary_input::readArray(
+          tmp182,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp182;
+      }
+      Arr1DIdxRowM(tmp182, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp182 : 0;
     }
-    Arr1DIdxRowM(tmp182, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp182 : 0;
   }
 
   uint64_t *tmp183 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp183
    * at (2479,1-2479,37) */
   uint64_t __tmp_in_tmp183;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp183;
+  if (!binary_input::readArray(
+          tmp183,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp183;
+      }
+      Arr1DIdxRowM(tmp183, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp183 : 0;
     }
-    Arr1DIdxRowM(tmp183, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp183 : 0;
   }
 
   uint64_t *tmp184 =
@@ -4786,16 +5706,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp184
    * at (2482,1-2482,49) */
   uint64_t __tmp_in_tmp184;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1024; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp184;
+  if (!binary_input::readArray(
+          tmp184,
+          (((((int32_t)1 * (int32_t)1024) * (int32_t)256) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1024; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp184;
+            }
+            Arr4DIdxRowM(tmp184, (int32_t)1, (int32_t)1, (int32_t)256,
+                         (int32_t)1024, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp184 : 0;
           }
-          Arr4DIdxRowM(tmp184, (int32_t)1, (int32_t)1, (int32_t)256,
-                       (int32_t)1024, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp184 : 0;
         }
       }
     }
@@ -4805,48 +5730,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp185
    * at (2485,1-2485,38) */
   uint64_t __tmp_in_tmp185;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp185;
+  if (!binary_input::readArray(
+          tmp185,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp185;
+      }
+      Arr1DIdxRowM(tmp185, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp185 : 0;
     }
-    Arr1DIdxRowM(tmp185, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp185 : 0;
   }
 
   uint64_t *tmp186 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp186
    * at (2488,1-2488,38) */
   uint64_t __tmp_in_tmp186;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp186;
+  if (!binary_input::readArray(
+          tmp186,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp186;
+      }
+      Arr1DIdxRowM(tmp186, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp186 : 0;
     }
-    Arr1DIdxRowM(tmp186, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp186 : 0;
   }
 
   uint64_t *tmp187 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp187
    * at (2491,1-2491,38) */
   uint64_t __tmp_in_tmp187;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp187;
+  if (!binary_input::readArray(
+          tmp187,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp187;
+      }
+      Arr1DIdxRowM(tmp187, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp187 : 0;
     }
-    Arr1DIdxRowM(tmp187, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp187 : 0;
   }
 
   uint64_t *tmp188 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp188
    * at (2494,1-2494,38) */
   uint64_t __tmp_in_tmp188;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp188;
+  if (!binary_input::readArray(
+          tmp188,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp188;
+      }
+      Arr1DIdxRowM(tmp188, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp188 : 0;
     }
-    Arr1DIdxRowM(tmp188, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp188 : 0;
   }
 
   uint64_t *tmp189 =
@@ -4854,16 +5799,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp189
    * at (2497,1-2497,49) */
   uint64_t __tmp_in_tmp189;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp189;
+  if (!binary_input::readArray(
+          tmp189,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)1024) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp189;
+            }
+            Arr4DIdxRowM(tmp189, (int32_t)1, (int32_t)1, (int32_t)1024,
+                         (int32_t)256, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp189 : 0;
           }
-          Arr4DIdxRowM(tmp189, (int32_t)1, (int32_t)1, (int32_t)1024,
-                       (int32_t)256, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp189 : 0;
         }
       }
     }
@@ -4873,48 +5823,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp190
    * at (2500,1-2500,37) */
   uint64_t __tmp_in_tmp190;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp190;
+  if (!binary_input::readArray(
+          tmp190,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp190;
+      }
+      Arr1DIdxRowM(tmp190, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp190 : 0;
     }
-    Arr1DIdxRowM(tmp190, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp190 : 0;
   }
 
   uint64_t *tmp191 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp191
    * at (2503,1-2503,37) */
   uint64_t __tmp_in_tmp191;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp191;
+  if (!binary_input::readArray(
+          tmp191,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp191;
+      }
+      Arr1DIdxRowM(tmp191, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp191 : 0;
     }
-    Arr1DIdxRowM(tmp191, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp191 : 0;
   }
 
   uint64_t *tmp192 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp192
    * at (2506,1-2506,37) */
   uint64_t __tmp_in_tmp192;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp192;
+  if (!binary_input::readArray(
+          tmp192,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp192;
+      }
+      Arr1DIdxRowM(tmp192, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp192 : 0;
     }
-    Arr1DIdxRowM(tmp192, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp192 : 0;
   }
 
   uint64_t *tmp193 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp193
    * at (2509,1-2509,37) */
   uint64_t __tmp_in_tmp193;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp193;
+  if (!binary_input::readArray(
+          tmp193,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp193;
+      }
+      Arr1DIdxRowM(tmp193, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp193 : 0;
     }
-    Arr1DIdxRowM(tmp193, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp193 : 0;
   }
 
   uint64_t *tmp194 =
@@ -4922,16 +5892,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp194
    * at (2512,1-2512,48) */
   uint64_t __tmp_in_tmp194;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp194;
+  if (!binary_input::readArray(
+          tmp194,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)256) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp194;
+            }
+            Arr4DIdxRowM(tmp194, (int32_t)3, (int32_t)3, (int32_t)256,
+                         (int32_t)256, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp194 : 0;
           }
-          Arr4DIdxRowM(tmp194, (int32_t)3, (int32_t)3, (int32_t)256,
-                       (int32_t)256, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp194 : 0;
         }
       }
     }
@@ -4941,48 +5916,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp195
    * at (2515,1-2515,37) */
   uint64_t __tmp_in_tmp195;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp195;
+  if (!binary_input::readArray(
+          tmp195,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp195;
+      }
+      Arr1DIdxRowM(tmp195, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp195 : 0;
     }
-    Arr1DIdxRowM(tmp195, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp195 : 0;
   }
 
   uint64_t *tmp196 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp196
    * at (2518,1-2518,37) */
   uint64_t __tmp_in_tmp196;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp196;
+  if (!binary_input::readArray(
+          tmp196,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp196;
+      }
+      Arr1DIdxRowM(tmp196, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp196 : 0;
     }
-    Arr1DIdxRowM(tmp196, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp196 : 0;
   }
 
   uint64_t *tmp197 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp197
    * at (2521,1-2521,37) */
   uint64_t __tmp_in_tmp197;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp197;
+  if (!binary_input::readArray(
+          tmp197,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp197;
+      }
+      Arr1DIdxRowM(tmp197, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp197 : 0;
     }
-    Arr1DIdxRowM(tmp197, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp197 : 0;
   }
 
   uint64_t *tmp198 = make_array<uint64_t>((int32_t)256);
   /* Variable to read the clear value corresponding to the input variable tmp198
    * at (2524,1-2524,37) */
   uint64_t __tmp_in_tmp198;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp198;
+  if (!binary_input::readArray(
+          tmp198,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp198;
+      }
+      Arr1DIdxRowM(tmp198, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp198 : 0;
     }
-    Arr1DIdxRowM(tmp198, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp198 : 0;
   }
 
   uint64_t *tmp199 =
@@ -4990,16 +5985,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp199
    * at (2527,1-2527,49) */
   uint64_t __tmp_in_tmp199;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1024; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp199;
+  if (!binary_input::readArray(
+          tmp199,
+          (((((int32_t)1 * (int32_t)1024) * (int32_t)256) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1024; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp199;
+            }
+            Arr4DIdxRowM(tmp199, (int32_t)1, (int32_t)1, (int32_t)256,
+                         (int32_t)1024, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp199 : 0;
           }
-          Arr4DIdxRowM(tmp199, (int32_t)1, (int32_t)1, (int32_t)256,
-                       (int32_t)1024, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp199 : 0;
         }
       }
     }
@@ -5009,48 +6009,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp200
    * at (2530,1-2530,38) */
   uint64_t __tmp_in_tmp200;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp200;
+  if (!binary_input::readArray(
+          tmp200,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp200;
+      }
+      Arr1DIdxRowM(tmp200, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp200 : 0;
     }
-    Arr1DIdxRowM(tmp200, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp200 : 0;
   }
 
   uint64_t *tmp201 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp201
    * at (2533,1-2533,38) */
   uint64_t __tmp_in_tmp201;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp201;
+  if (!binary_input::readArray(
+          tmp201,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp201;
+      }
+      Arr1DIdxRowM(tmp201, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp201 : 0;
     }
-    Arr1DIdxRowM(tmp201, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp201 : 0;
   }
 
   uint64_t *tmp202 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp202
    * at (2536,1-2536,38) */
   uint64_t __tmp_in_tmp202;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp202;
+  if (!binary_input::readArray(
+          tmp202,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp202;
+      }
+      Arr1DIdxRowM(tmp202, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp202 : 0;
     }
-    Arr1DIdxRowM(tmp202, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp202 : 0;
   }
 
   uint64_t *tmp203 = make_array<uint64_t>((int32_t)1024);
   /* Variable to read the clear value corresponding to the input variable tmp203
    * at (2539,1-2539,38) */
   uint64_t __tmp_in_tmp203;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp203;
+  if (!binary_input::readArray(
+          tmp203,
+          ((int32_t)1 * (int32_t)1024),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1024; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp203;
+      }
+      Arr1DIdxRowM(tmp203, (int32_t)1024, i0) =
+          (party == SERVER) ? __tmp_in_tmp203 : 0;
     }
-    Arr1DIdxRowM(tmp203, (int32_t)1024, i0) =
-        (party == SERVER) ? __tmp_in_tmp203 : 0;
   }
 
   uint64_t *tmp204 = make_array<uint64_t>((int32_t)1, (int32_t)1, (int32_t)1024,
@@ -5058,16 +6078,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp204
    * at (2542,1-2542,50) */
   uint64_t __tmp_in_tmp204;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)2048; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp204;
+  if (!binary_input::readArray(
+          tmp204,
+          (((((int32_t)1 * (int32_t)2048) * (int32_t)1024) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)2048; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp204;
+            }
+            Arr4DIdxRowM(tmp204, (int32_t)1, (int32_t)1, (int32_t)1024,
+                         (int32_t)2048, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp204 : 0;
           }
-          Arr4DIdxRowM(tmp204, (int32_t)1, (int32_t)1, (int32_t)1024,
-                       (int32_t)2048, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp204 : 0;
         }
       }
     }
@@ -5078,16 +6103,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp205
    * at (2545,1-2545,49) */
   uint64_t __tmp_in_tmp205;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp205;
+  if (!binary_input::readArray(
+          tmp205,
+          (((((int32_t)1 * (int32_t)512) * (int32_t)1024) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)1024; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp205;
+            }
+            Arr4DIdxRowM(tmp205, (int32_t)1, (int32_t)1, (int32_t)1024,
+                         (int32_t)512, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp205 : 0;
           }
-          Arr4DIdxRowM(tmp205, (int32_t)1, (int32_t)1, (int32_t)1024,
-                       (int32_t)512, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp205 : 0;
         }
       }
     }
@@ -5097,48 +6127,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp206
    * at (2548,1-2548,37) */
   uint64_t __tmp_in_tmp206;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp206;
+  if (!binary_input::readArray(
+          tmp206,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp206;
+      }
+      Arr1DIdxRowM(tmp206, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp206 : 0;
     }
-    Arr1DIdxRowM(tmp206, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp206 : 0;
   }
 
   uint64_t *tmp207 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp207
    * at (2551,1-2551,37) */
   uint64_t __tmp_in_tmp207;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp207;
+  if (!binary_input::readArray(
+          tmp207,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp207;
+      }
+      Arr1DIdxRowM(tmp207, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp207 : 0;
     }
-    Arr1DIdxRowM(tmp207, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp207 : 0;
   }
 
   uint64_t *tmp208 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp208
    * at (2554,1-2554,37) */
   uint64_t __tmp_in_tmp208;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp208;
+  if (!binary_input::readArray(
+          tmp208,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp208;
+      }
+      Arr1DIdxRowM(tmp208, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp208 : 0;
     }
-    Arr1DIdxRowM(tmp208, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp208 : 0;
   }
 
   uint64_t *tmp209 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp209
    * at (2557,1-2557,37) */
   uint64_t __tmp_in_tmp209;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp209;
+  if (!binary_input::readArray(
+          tmp209,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp209;
+      }
+      Arr1DIdxRowM(tmp209, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp209 : 0;
     }
-    Arr1DIdxRowM(tmp209, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp209 : 0;
   }
 
   uint64_t *tmp210 =
@@ -5146,16 +6196,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp210
    * at (2560,1-2560,48) */
   uint64_t __tmp_in_tmp210;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp210;
+  if (!binary_input::readArray(
+          tmp210,
+          (((((int32_t)1 * (int32_t)512) * (int32_t)512) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp210;
+            }
+            Arr4DIdxRowM(tmp210, (int32_t)3, (int32_t)3, (int32_t)512,
+                         (int32_t)512, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp210 : 0;
           }
-          Arr4DIdxRowM(tmp210, (int32_t)3, (int32_t)3, (int32_t)512,
-                       (int32_t)512, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp210 : 0;
         }
       }
     }
@@ -5165,48 +6220,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp211
    * at (2563,1-2563,37) */
   uint64_t __tmp_in_tmp211;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp211;
+  if (!binary_input::readArray(
+          tmp211,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp211;
+      }
+      Arr1DIdxRowM(tmp211, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp211 : 0;
     }
-    Arr1DIdxRowM(tmp211, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp211 : 0;
   }
 
   uint64_t *tmp212 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp212
    * at (2566,1-2566,37) */
   uint64_t __tmp_in_tmp212;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp212;
+  if (!binary_input::readArray(
+          tmp212,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp212;
+      }
+      Arr1DIdxRowM(tmp212, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp212 : 0;
     }
-    Arr1DIdxRowM(tmp212, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp212 : 0;
   }
 
   uint64_t *tmp213 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp213
    * at (2569,1-2569,37) */
   uint64_t __tmp_in_tmp213;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp213;
+  if (!binary_input::readArray(
+          tmp213,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp213;
+      }
+      Arr1DIdxRowM(tmp213, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp213 : 0;
     }
-    Arr1DIdxRowM(tmp213, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp213 : 0;
   }
 
   uint64_t *tmp214 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp214
    * at (2572,1-2572,37) */
   uint64_t __tmp_in_tmp214;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp214;
+  if (!binary_input::readArray(
+          tmp214,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp214;
+      }
+      Arr1DIdxRowM(tmp214, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp214 : 0;
     }
-    Arr1DIdxRowM(tmp214, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp214 : 0;
   }
 
   uint64_t *tmp215 =
@@ -5214,16 +6289,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp215
    * at (2575,1-2575,49) */
   uint64_t __tmp_in_tmp215;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)2048; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp215;
+  if (!binary_input::readArray(
+          tmp215,
+          (((((int32_t)1 * (int32_t)2048) * (int32_t)512) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)2048; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp215;
+            }
+            Arr4DIdxRowM(tmp215, (int32_t)1, (int32_t)1, (int32_t)512,
+                         (int32_t)2048, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp215 : 0;
           }
-          Arr4DIdxRowM(tmp215, (int32_t)1, (int32_t)1, (int32_t)512,
-                       (int32_t)2048, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp215 : 0;
         }
       }
     }
@@ -5233,48 +6313,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp216
    * at (2578,1-2578,38) */
   uint64_t __tmp_in_tmp216;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp216;
+  if (!binary_input::readArray(
+          tmp216,
+          ((int32_t)1 * (int32_t)2048),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp216;
+      }
+      Arr1DIdxRowM(tmp216, (int32_t)2048, i0) =
+          (party == SERVER) ? __tmp_in_tmp216 : 0;
     }
-    Arr1DIdxRowM(tmp216, (int32_t)2048, i0) =
-        (party == SERVER) ? __tmp_in_tmp216 : 0;
   }
 
   uint64_t *tmp217 = make_array<uint64_t>((int32_t)2048);
   /* Variable to read the clear value corresponding to the input variable tmp217
    * at (2581,1-2581,38) */
   uint64_t __tmp_in_tmp217;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp217;
+  if (!binary_input::readArray(
+          tmp217,
+          ((int32_t)1 * (int32_t)2048),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp217;
+      }
+      Arr1DIdxRowM(tmp217, (int32_t)2048, i0) =
+          (party == SERVER) ? __tmp_in_tmp217 : 0;
     }
-    Arr1DIdxRowM(tmp217, (int32_t)2048, i0) =
-        (party == SERVER) ? __tmp_in_tmp217 : 0;
   }
 
   uint64_t *tmp218 = make_array<uint64_t>((int32_t)2048);
   /* Variable to read the clear value corresponding to the input variable tmp218
    * at (2584,1-2584,38) */
   uint64_t __tmp_in_tmp218;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp218;
+  if (!binary_input::readArray(
+          tmp218,
+          ((int32_t)1 * (int32_t)2048),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp218;
+      }
+      Arr1DIdxRowM(tmp218, (int32_t)2048, i0) =
+          (party == SERVER) ? __tmp_in_tmp218 : 0;
     }
-    Arr1DIdxRowM(tmp218, (int32_t)2048, i0) =
-        (party == SERVER) ? __tmp_in_tmp218 : 0;
   }
 
   uint64_t *tmp219 = make_array<uint64_t>((int32_t)2048);
   /* Variable to read the clear value corresponding to the input variable tmp219
    * at (2587,1-2587,38) */
   uint64_t __tmp_in_tmp219;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp219;
+  if (!binary_input::readArray(
+          tmp219,
+          ((int32_t)1 * (int32_t)2048),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp219;
+      }
+      Arr1DIdxRowM(tmp219, (int32_t)2048, i0) =
+          (party == SERVER) ? __tmp_in_tmp219 : 0;
     }
-    Arr1DIdxRowM(tmp219, (int32_t)2048, i0) =
-        (party == SERVER) ? __tmp_in_tmp219 : 0;
   }
 
   uint64_t *tmp220 =
@@ -5282,16 +6382,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp220
    * at (2590,1-2590,49) */
   uint64_t __tmp_in_tmp220;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)2048; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp220;
+  if (!binary_input::readArray(
+          tmp220,
+          (((((int32_t)1 * (int32_t)512) * (int32_t)2048) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)2048; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp220;
+            }
+            Arr4DIdxRowM(tmp220, (int32_t)1, (int32_t)1, (int32_t)2048,
+                         (int32_t)512, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp220 : 0;
           }
-          Arr4DIdxRowM(tmp220, (int32_t)1, (int32_t)1, (int32_t)2048,
-                       (int32_t)512, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp220 : 0;
         }
       }
     }
@@ -5301,48 +6406,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp221
    * at (2593,1-2593,37) */
   uint64_t __tmp_in_tmp221;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp221;
+  if (!binary_input::readArray(
+          tmp221,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp221;
+      }
+      Arr1DIdxRowM(tmp221, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp221 : 0;
     }
-    Arr1DIdxRowM(tmp221, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp221 : 0;
   }
 
   uint64_t *tmp222 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp222
    * at (2596,1-2596,37) */
   uint64_t __tmp_in_tmp222;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp222;
+  if (!binary_input::readArray(
+          tmp222,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp222;
+      }
+      Arr1DIdxRowM(tmp222, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp222 : 0;
     }
-    Arr1DIdxRowM(tmp222, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp222 : 0;
   }
 
   uint64_t *tmp223 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp223
    * at (2599,1-2599,37) */
   uint64_t __tmp_in_tmp223;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp223;
+  if (!binary_input::readArray(
+          tmp223,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp223;
+      }
+      Arr1DIdxRowM(tmp223, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp223 : 0;
     }
-    Arr1DIdxRowM(tmp223, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp223 : 0;
   }
 
   uint64_t *tmp224 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp224
    * at (2602,1-2602,37) */
   uint64_t __tmp_in_tmp224;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp224;
+  if (!binary_input::readArray(
+          tmp224,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp224;
+      }
+      Arr1DIdxRowM(tmp224, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp224 : 0;
     }
-    Arr1DIdxRowM(tmp224, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp224 : 0;
   }
 
   uint64_t *tmp225 =
@@ -5350,16 +6475,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp225
    * at (2605,1-2605,48) */
   uint64_t __tmp_in_tmp225;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp225;
+  if (!binary_input::readArray(
+          tmp225,
+          (((((int32_t)1 * (int32_t)512) * (int32_t)512) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp225;
+            }
+            Arr4DIdxRowM(tmp225, (int32_t)3, (int32_t)3, (int32_t)512,
+                         (int32_t)512, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp225 : 0;
           }
-          Arr4DIdxRowM(tmp225, (int32_t)3, (int32_t)3, (int32_t)512,
-                       (int32_t)512, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp225 : 0;
         }
       }
     }
@@ -5369,48 +6499,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp226
    * at (2608,1-2608,37) */
   uint64_t __tmp_in_tmp226;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp226;
+  if (!binary_input::readArray(
+          tmp226,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp226;
+      }
+      Arr1DIdxRowM(tmp226, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp226 : 0;
     }
-    Arr1DIdxRowM(tmp226, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp226 : 0;
   }
 
   uint64_t *tmp227 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp227
    * at (2611,1-2611,37) */
   uint64_t __tmp_in_tmp227;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp227;
+  if (!binary_input::readArray(
+          tmp227,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp227;
+      }
+      Arr1DIdxRowM(tmp227, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp227 : 0;
     }
-    Arr1DIdxRowM(tmp227, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp227 : 0;
   }
 
   uint64_t *tmp228 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp228
    * at (2614,1-2614,37) */
   uint64_t __tmp_in_tmp228;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp228;
+  if (!binary_input::readArray(
+          tmp228,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp228;
+      }
+      Arr1DIdxRowM(tmp228, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp228 : 0;
     }
-    Arr1DIdxRowM(tmp228, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp228 : 0;
   }
 
   uint64_t *tmp229 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp229
    * at (2617,1-2617,37) */
   uint64_t __tmp_in_tmp229;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp229;
+  if (!binary_input::readArray(
+          tmp229,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp229;
+      }
+      Arr1DIdxRowM(tmp229, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp229 : 0;
     }
-    Arr1DIdxRowM(tmp229, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp229 : 0;
   }
 
   uint64_t *tmp230 =
@@ -5418,16 +6568,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp230
    * at (2620,1-2620,49) */
   uint64_t __tmp_in_tmp230;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)2048; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp230;
+  if (!binary_input::readArray(
+          tmp230,
+          (((((int32_t)1 * (int32_t)2048) * (int32_t)512) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)2048; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp230;
+            }
+            Arr4DIdxRowM(tmp230, (int32_t)1, (int32_t)1, (int32_t)512,
+                         (int32_t)2048, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp230 : 0;
           }
-          Arr4DIdxRowM(tmp230, (int32_t)1, (int32_t)1, (int32_t)512,
-                       (int32_t)2048, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp230 : 0;
         }
       }
     }
@@ -5437,48 +6592,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp231
    * at (2623,1-2623,38) */
   uint64_t __tmp_in_tmp231;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp231;
+  if (!binary_input::readArray(
+          tmp231,
+          ((int32_t)1 * (int32_t)2048),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp231;
+      }
+      Arr1DIdxRowM(tmp231, (int32_t)2048, i0) =
+          (party == SERVER) ? __tmp_in_tmp231 : 0;
     }
-    Arr1DIdxRowM(tmp231, (int32_t)2048, i0) =
-        (party == SERVER) ? __tmp_in_tmp231 : 0;
   }
 
   uint64_t *tmp232 = make_array<uint64_t>((int32_t)2048);
   /* Variable to read the clear value corresponding to the input variable tmp232
    * at (2626,1-2626,38) */
   uint64_t __tmp_in_tmp232;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp232;
+  if (!binary_input::readArray(
+          tmp232,
+          ((int32_t)1 * (int32_t)2048),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp232;
+      }
+      Arr1DIdxRowM(tmp232, (int32_t)2048, i0) =
+          (party == SERVER) ? __tmp_in_tmp232 : 0;
     }
-    Arr1DIdxRowM(tmp232, (int32_t)2048, i0) =
-        (party == SERVER) ? __tmp_in_tmp232 : 0;
   }
 
   uint64_t *tmp233 = make_array<uint64_t>((int32_t)2048);
   /* Variable to read the clear value corresponding to the input variable tmp233
    * at (2629,1-2629,38) */
   uint64_t __tmp_in_tmp233;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp233;
+  if (!binary_input::readArray(
+          tmp233,
+          ((int32_t)1 * (int32_t)2048),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp233;
+      }
+      Arr1DIdxRowM(tmp233, (int32_t)2048, i0) =
+          (party == SERVER) ? __tmp_in_tmp233 : 0;
     }
-    Arr1DIdxRowM(tmp233, (int32_t)2048, i0) =
-        (party == SERVER) ? __tmp_in_tmp233 : 0;
   }
 
   uint64_t *tmp234 = make_array<uint64_t>((int32_t)2048);
   /* Variable to read the clear value corresponding to the input variable tmp234
    * at (2632,1-2632,38) */
   uint64_t __tmp_in_tmp234;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp234;
+  if (!binary_input::readArray(
+          tmp234,
+          ((int32_t)1 * (int32_t)2048),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp234;
+      }
+      Arr1DIdxRowM(tmp234, (int32_t)2048, i0) =
+          (party == SERVER) ? __tmp_in_tmp234 : 0;
     }
-    Arr1DIdxRowM(tmp234, (int32_t)2048, i0) =
-        (party == SERVER) ? __tmp_in_tmp234 : 0;
   }
 
   uint64_t *tmp235 =
@@ -5486,16 +6661,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp235
    * at (2635,1-2635,49) */
   uint64_t __tmp_in_tmp235;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)2048; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp235;
+  if (!binary_input::readArray(
+          tmp235,
+          (((((int32_t)1 * (int32_t)512) * (int32_t)2048) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)2048; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp235;
+            }
+            Arr4DIdxRowM(tmp235, (int32_t)1, (int32_t)1, (int32_t)2048,
+                         (int32_t)512, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp235 : 0;
           }
-          Arr4DIdxRowM(tmp235, (int32_t)1, (int32_t)1, (int32_t)2048,
-                       (int32_t)512, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp235 : 0;
         }
       }
     }
@@ -5505,48 +6685,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp236
    * at (2638,1-2638,37) */
   uint64_t __tmp_in_tmp236;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp236;
+  if (!binary_input::readArray(
+          tmp236,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp236;
+      }
+      Arr1DIdxRowM(tmp236, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp236 : 0;
     }
-    Arr1DIdxRowM(tmp236, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp236 : 0;
   }
 
   uint64_t *tmp237 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp237
    * at (2641,1-2641,37) */
   uint64_t __tmp_in_tmp237;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp237;
+  if (!binary_input::readArray(
+          tmp237,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp237;
+      }
+      Arr1DIdxRowM(tmp237, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp237 : 0;
     }
-    Arr1DIdxRowM(tmp237, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp237 : 0;
   }
 
   uint64_t *tmp238 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp238
    * at (2644,1-2644,37) */
   uint64_t __tmp_in_tmp238;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp238;
+  if (!binary_input::readArray(
+          tmp238,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp238;
+      }
+      Arr1DIdxRowM(tmp238, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp238 : 0;
     }
-    Arr1DIdxRowM(tmp238, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp238 : 0;
   }
 
   uint64_t *tmp239 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp239
    * at (2647,1-2647,37) */
   uint64_t __tmp_in_tmp239;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp239;
+  if (!binary_input::readArray(
+          tmp239,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp239;
+      }
+      Arr1DIdxRowM(tmp239, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp239 : 0;
     }
-    Arr1DIdxRowM(tmp239, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp239 : 0;
   }
 
   uint64_t *tmp240 =
@@ -5554,16 +6754,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp240
    * at (2650,1-2650,48) */
   uint64_t __tmp_in_tmp240;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp240;
+  if (!binary_input::readArray(
+          tmp240,
+          (((((int32_t)1 * (int32_t)512) * (int32_t)512) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)512; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp240;
+            }
+            Arr4DIdxRowM(tmp240, (int32_t)3, (int32_t)3, (int32_t)512,
+                         (int32_t)512, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp240 : 0;
           }
-          Arr4DIdxRowM(tmp240, (int32_t)3, (int32_t)3, (int32_t)512,
-                       (int32_t)512, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp240 : 0;
         }
       }
     }
@@ -5573,48 +6778,68 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp241
    * at (2653,1-2653,37) */
   uint64_t __tmp_in_tmp241;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp241;
+  if (!binary_input::readArray(
+          tmp241,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp241;
+      }
+      Arr1DIdxRowM(tmp241, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp241 : 0;
     }
-    Arr1DIdxRowM(tmp241, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp241 : 0;
   }
 
   uint64_t *tmp242 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp242
    * at (2656,1-2656,37) */
   uint64_t __tmp_in_tmp242;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp242;
+  if (!binary_input::readArray(
+          tmp242,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp242;
+      }
+      Arr1DIdxRowM(tmp242, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp242 : 0;
     }
-    Arr1DIdxRowM(tmp242, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp242 : 0;
   }
 
   uint64_t *tmp243 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp243
    * at (2659,1-2659,37) */
   uint64_t __tmp_in_tmp243;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp243;
+  if (!binary_input::readArray(
+          tmp243,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp243;
+      }
+      Arr1DIdxRowM(tmp243, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp243 : 0;
     }
-    Arr1DIdxRowM(tmp243, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp243 : 0;
   }
 
   uint64_t *tmp244 = make_array<uint64_t>((int32_t)512);
   /* Variable to read the clear value corresponding to the input variable tmp244
    * at (2662,1-2662,37) */
   uint64_t __tmp_in_tmp244;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp244;
+  if (!binary_input::readArray(
+          tmp244,
+          ((int32_t)1 * (int32_t)512),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)512; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp244;
+      }
+      Arr1DIdxRowM(tmp244, (int32_t)512, i0) =
+          (party == SERVER) ? __tmp_in_tmp244 : 0;
     }
-    Arr1DIdxRowM(tmp244, (int32_t)512, i0) =
-        (party == SERVER) ? __tmp_in_tmp244 : 0;
   }
 
   uint64_t *tmp245 =
@@ -5622,16 +6847,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp245
    * at (2665,1-2665,49) */
   uint64_t __tmp_in_tmp245;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)2048; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp245;
+  if (!binary_input::readArray(
+          tmp245,
+          (((((int32_t)1 * (int32_t)2048) * (int32_t)512) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)2048; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp245;
+            }
+            Arr4DIdxRowM(tmp245, (int32_t)1, (int32_t)1, (int32_t)512,
+                         (int32_t)2048, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp245 : 0;
           }
-          Arr4DIdxRowM(tmp245, (int32_t)1, (int32_t)1, (int32_t)512,
-                       (int32_t)2048, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp245 : 0;
         }
       }
     }
@@ -5641,61 +6871,86 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp246
    * at (2668,1-2668,38) */
   uint64_t __tmp_in_tmp246;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp246;
+  if (!binary_input::readArray(
+          tmp246,
+          ((int32_t)1 * (int32_t)2048),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp246;
+      }
+      Arr1DIdxRowM(tmp246, (int32_t)2048, i0) =
+          (party == SERVER) ? __tmp_in_tmp246 : 0;
     }
-    Arr1DIdxRowM(tmp246, (int32_t)2048, i0) =
-        (party == SERVER) ? __tmp_in_tmp246 : 0;
   }
 
   uint64_t *tmp247 = make_array<uint64_t>((int32_t)2048);
   /* Variable to read the clear value corresponding to the input variable tmp247
    * at (2671,1-2671,38) */
   uint64_t __tmp_in_tmp247;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp247;
+  if (!binary_input::readArray(
+          tmp247,
+          ((int32_t)1 * (int32_t)2048),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp247;
+      }
+      Arr1DIdxRowM(tmp247, (int32_t)2048, i0) =
+          (party == SERVER) ? __tmp_in_tmp247 : 0;
     }
-    Arr1DIdxRowM(tmp247, (int32_t)2048, i0) =
-        (party == SERVER) ? __tmp_in_tmp247 : 0;
   }
 
   uint64_t *tmp248 = make_array<uint64_t>((int32_t)2048);
   /* Variable to read the clear value corresponding to the input variable tmp248
    * at (2674,1-2674,38) */
   uint64_t __tmp_in_tmp248;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp248;
+  if (!binary_input::readArray(
+          tmp248,
+          ((int32_t)1 * (int32_t)2048),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp248;
+      }
+      Arr1DIdxRowM(tmp248, (int32_t)2048, i0) =
+          (party == SERVER) ? __tmp_in_tmp248 : 0;
     }
-    Arr1DIdxRowM(tmp248, (int32_t)2048, i0) =
-        (party == SERVER) ? __tmp_in_tmp248 : 0;
   }
 
   uint64_t *tmp249 = make_array<uint64_t>((int32_t)2048);
   /* Variable to read the clear value corresponding to the input variable tmp249
    * at (2677,1-2677,38) */
   uint64_t __tmp_in_tmp249;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp249;
+  if (!binary_input::readArray(
+          tmp249,
+          ((int32_t)1 * (int32_t)2048),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp249;
+      }
+      Arr1DIdxRowM(tmp249, (int32_t)2048, i0) =
+          (party == SERVER) ? __tmp_in_tmp249 : 0;
     }
-    Arr1DIdxRowM(tmp249, (int32_t)2048, i0) =
-        (party == SERVER) ? __tmp_in_tmp249 : 0;
   }
 
   uint64_t *tmp250 = make_array<uint64_t>((int32_t)2048, (int32_t)1001);
   /* Variable to read the clear value corresponding to the input variable tmp250
    * at (2680,1-2680,44) */
   uint64_t __tmp_in_tmp250;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1001; i1++) {
-      if ((party == SERVER)) {
-        cin >> __tmp_in_tmp250;
+  if (!binary_input::readArray(
+          tmp250,
+          (((int32_t)1 * (int32_t)1001) * (int32_t)2048),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)2048; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1001; i1++) {
+        if ((party == SERVER)) {
+          cin >> __tmp_in_tmp250;
+        }
+        Arr2DIdxRowM(tmp250, (int32_t)2048, (int32_t)1001, i0, i1) =
+            (party == SERVER) ? __tmp_in_tmp250 : 0;
       }
-      Arr2DIdxRowM(tmp250, (int32_t)2048, (int32_t)1001, i0, i1) =
-          (party == SERVER) ? __tmp_in_tmp250 : 0;
     }
   }
 
@@ -5703,12 +6958,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp251
    * at (2683,1-2683,38) */
   uint64_t __tmp_in_tmp251;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1001; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp251;
+  if (!binary_input::readArray(
+          tmp251,
+          ((int32_t)1 * (int32_t)1001),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1001; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp251;
+      }
+      Arr1DIdxRowM(tmp251, (int32_t)1001, i0) =
+          (party == SERVER) ? __tmp_in_tmp251 : 0;
     }
-    Arr1DIdxRowM(tmp251, (int32_t)1001, i0) =
-        (party == SERVER) ? __tmp_in_tmp251 : 0;
   }
   StartComputation();
 
@@ -2276,15 +2276,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp0
    * at (1930,1-1930,46) */
   uint64_t __tmp_in_tmp0;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)227; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)227; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)3; i3++) {
-          if ((party == CLIENT)) {
-            cin >> __tmp_in_tmp0;
+  if (!binary_input::readArray(
+          tmp0,
+          (((((int32_t)1 * (int32_t)3) * (int32_t)227) * (int32_t)227) * (int32_t)1),
+          (party == CLIENT))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)227; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)227; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)3; i3++) {
+            if ((party == CLIENT)) {
+              cin >> __tmp_in_tmp0;
+            }
+            Arr4DIdxRowM(tmp0, (int32_t)1, (int32_t)227, (int32_t)227, (int32_t)3,
+                         i0, i1, i2, i3) = (party == CLIENT) ? __tmp_in_tmp0 : 0;
           }
-          Arr4DIdxRowM(tmp0, (int32_t)1, (int32_t)227, (int32_t)227, (int32_t)3,
-                       i0, i1, i2, i3) = (party == CLIENT) ? __tmp_in_tmp0 : 0;
         }
       }
     }
@@ -2295,15 +2300,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp1
    * at (1933,1-1933,43) */
   uint64_t __tmp_in_tmp1;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)3; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp1;
+  if (!binary_input::readArray(
+          tmp1,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)3) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)3; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp1;
+            }
+            Arr4DIdxRowM(tmp1, (int32_t)3, (int32_t)3, (int32_t)3, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp1 : 0;
           }
-          Arr4DIdxRowM(tmp1, (int32_t)3, (int32_t)3, (int32_t)3, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp1 : 0;
         }
       }
     }
@@ -2313,11 +2323,16 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp2
    * at (1936,1-1936,34) */
   uint64_t __tmp_in_tmp2;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp2;
+  if (!binary_input::readArray(
+          tmp2,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp2;
+      }
+      Arr1DIdxRowM(tmp2, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp2 : 0;
     }
-    Arr1DIdxRowM(tmp2, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp2 : 0;
   }
 
   uint64_t *tmp3 =
@@ -2325,15 +2340,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp3
    * at (1939,1-1939,44) */
   uint64_t __tmp_in_tmp3;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)16; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp3;
+  if (!binary_input::readArray(
+          tmp3,
+          (((((int32_t)1 * (int32_t)16) * (int32_t)64) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)16; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp3;
+            }
+            Arr4DIdxRowM(tmp3, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)16,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp3 : 0;
           }
-          Arr4DIdxRowM(tmp3, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)16,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp3 : 0;
         }
       }
     }
@@ -2343,11 +2363,16 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp4
    * at (1942,1-1942,34) */
   uint64_t __tmp_in_tmp4;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)16; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp4;
+  if (!binary_input::readArray(
+          tmp4,
+          ((int32_t)1 * (int32_t)16),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)16; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp4;
+      }
+      Arr1DIdxRowM(tmp4, (int32_t)16, i0) = (party == SERVER) ? __tmp_in_tmp4 : 0;
     }
-    Arr1DIdxRowM(tmp4, (int32_t)16, i0) = (party == SERVER) ? __tmp_in_tmp4 : 0;
   }
 
   uint64_t *tmp5 =
@@ -2355,15 +2380,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp5
    * at (1945,1-1945,44) */
   uint64_t __tmp_in_tmp5;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)16; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp5;
+  if (!binary_input::readArray(
+          tmp5,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)16) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)16; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp5;
+            }
+            Arr4DIdxRowM(tmp5, (int32_t)1, (int32_t)1, (int32_t)16, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp5 : 0;
           }
-          Arr4DIdxRowM(tmp5, (int32_t)1, (int32_t)1, (int32_t)16, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp5 : 0;
         }
       }
     }
@@ -2373,11 +2403,16 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp6
    * at (1948,1-1948,34) */
   uint64_t __tmp_in_tmp6;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp6;
+  if (!binary_input::readArray(
+          tmp6,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp6;
+      }
+      Arr1DIdxRowM(tmp6, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp6 : 0;
     }
-    Arr1DIdxRowM(tmp6, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp6 : 0;
   }
 
   uint64_t *tmp7 =
@@ -2385,15 +2420,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp7
    * at (1951,1-1951,44) */
   uint64_t __tmp_in_tmp7;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)16; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp7;
+  if (!binary_input::readArray(
+          tmp7,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)16) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)16; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp7;
+            }
+            Arr4DIdxRowM(tmp7, (int32_t)3, (int32_t)3, (int32_t)16, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp7 : 0;
           }
-          Arr4DIdxRowM(tmp7, (int32_t)3, (int32_t)3, (int32_t)16, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp7 : 0;
         }
       }
     }
@@ -2403,11 +2443,16 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp8
    * at (1954,1-1954,34) */
   uint64_t __tmp_in_tmp8;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp8;
+  if (!binary_input::readArray(
+          tmp8,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp8;
+      }
+      Arr1DIdxRowM(tmp8, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp8 : 0;
     }
-    Arr1DIdxRowM(tmp8, (int32_t)64, i0) = (party == SERVER) ? __tmp_in_tmp8 : 0;
   }
 
   uint64_t *tmp9 =
@@ -2415,15 +2460,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp9
    * at (1957,1-1957,45) */
   uint64_t __tmp_in_tmp9;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)16; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp9;
+  if (!binary_input::readArray(
+          tmp9,
+          (((((int32_t)1 * (int32_t)16) * (int32_t)128) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)16; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp9;
+            }
+            Arr4DIdxRowM(tmp9, (int32_t)1, (int32_t)1, (int32_t)128, (int32_t)16,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp9 : 0;
           }
-          Arr4DIdxRowM(tmp9, (int32_t)1, (int32_t)1, (int32_t)128, (int32_t)16,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp9 : 0;
         }
       }
     }
@@ -2433,12 +2483,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp10
    * at (1960,1-1960,35) */
   uint64_t __tmp_in_tmp10;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)16; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp10;
+  if (!binary_input::readArray(
+          tmp10,
+          ((int32_t)1 * (int32_t)16),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)16; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp10;
+      }
+      Arr1DIdxRowM(tmp10, (int32_t)16, i0) =
+          (party == SERVER) ? __tmp_in_tmp10 : 0;
     }
-    Arr1DIdxRowM(tmp10, (int32_t)16, i0) =
-        (party == SERVER) ? __tmp_in_tmp10 : 0;
   }
 
   uint64_t *tmp11 =
@@ -2446,15 +2501,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp11
    * at (1963,1-1963,45) */
   uint64_t __tmp_in_tmp11;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)16; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp11;
+  if (!binary_input::readArray(
+          tmp11,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)16) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)16; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp11;
+            }
+            Arr4DIdxRowM(tmp11, (int32_t)1, (int32_t)1, (int32_t)16, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp11 : 0;
           }
-          Arr4DIdxRowM(tmp11, (int32_t)1, (int32_t)1, (int32_t)16, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp11 : 0;
         }
       }
     }
@@ -2464,12 +2524,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp12
    * at (1966,1-1966,35) */
   uint64_t __tmp_in_tmp12;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp12;
+  if (!binary_input::readArray(
+          tmp12,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp12;
+      }
+      Arr1DIdxRowM(tmp12, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp12 : 0;
     }
-    Arr1DIdxRowM(tmp12, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp12 : 0;
   }
 
   uint64_t *tmp13 =
@@ -2477,15 +2542,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp13
    * at (1969,1-1969,45) */
   uint64_t __tmp_in_tmp13;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)16; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp13;
+  if (!binary_input::readArray(
+          tmp13,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)16) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)16; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp13;
+            }
+            Arr4DIdxRowM(tmp13, (int32_t)3, (int32_t)3, (int32_t)16, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp13 : 0;
           }
-          Arr4DIdxRowM(tmp13, (int32_t)3, (int32_t)3, (int32_t)16, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp13 : 0;
         }
       }
     }
@@ -2495,12 +2565,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp14
    * at (1972,1-1972,35) */
   uint64_t __tmp_in_tmp14;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp14;
+  if (!binary_input::readArray(
+          tmp14,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp14;
+      }
+      Arr1DIdxRowM(tmp14, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp14 : 0;
     }
-    Arr1DIdxRowM(tmp14, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp14 : 0;
   }
 
   uint64_t *tmp15 =
@@ -2508,15 +2583,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp15
    * at (1975,1-1975,46) */
   uint64_t __tmp_in_tmp15;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp15;
+  if (!binary_input::readArray(
+          tmp15,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)128) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)128; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp15;
+            }
+            Arr4DIdxRowM(tmp15, (int32_t)1, (int32_t)1, (int32_t)128, (int32_t)32,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp15 : 0;
           }
-          Arr4DIdxRowM(tmp15, (int32_t)1, (int32_t)1, (int32_t)128, (int32_t)32,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp15 : 0;
         }
       }
     }
@@ -2526,12 +2606,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp16
    * at (1978,1-1978,35) */
   uint64_t __tmp_in_tmp16;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)32; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp16;
+  if (!binary_input::readArray(
+          tmp16,
+          ((int32_t)1 * (int32_t)32),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)32; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp16;
+      }
+      Arr1DIdxRowM(tmp16, (int32_t)32, i0) =
+          (party == SERVER) ? __tmp_in_tmp16 : 0;
     }
-    Arr1DIdxRowM(tmp16, (int32_t)32, i0) =
-        (party == SERVER) ? __tmp_in_tmp16 : 0;
   }
 
   uint64_t *tmp17 =
@@ -2539,15 +2624,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp17
    * at (1981,1-1981,46) */
   uint64_t __tmp_in_tmp17;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)32; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp17;
+  if (!binary_input::readArray(
+          tmp17,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)32) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)32; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp17;
+            }
+            Arr4DIdxRowM(tmp17, (int32_t)1, (int32_t)1, (int32_t)32, (int32_t)128,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp17 : 0;
           }
-          Arr4DIdxRowM(tmp17, (int32_t)1, (int32_t)1, (int32_t)32, (int32_t)128,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp17 : 0;
         }
       }
     }
@@ -2557,12 +2647,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp18
    * at (1984,1-1984,36) */
   uint64_t __tmp_in_tmp18;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp18;
+  if (!binary_input::readArray(
+          tmp18,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp18;
+      }
+      Arr1DIdxRowM(tmp18, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp18 : 0;
     }
-    Arr1DIdxRowM(tmp18, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp18 : 0;
   }
 
   uint64_t *tmp19 =
@@ -2570,15 +2665,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp19
    * at (1987,1-1987,46) */
   uint64_t __tmp_in_tmp19;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)32; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp19;
+  if (!binary_input::readArray(
+          tmp19,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)32) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)32; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp19;
+            }
+            Arr4DIdxRowM(tmp19, (int32_t)3, (int32_t)3, (int32_t)32, (int32_t)128,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp19 : 0;
           }
-          Arr4DIdxRowM(tmp19, (int32_t)3, (int32_t)3, (int32_t)32, (int32_t)128,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp19 : 0;
         }
       }
     }
@@ -2588,12 +2688,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp20
    * at (1990,1-1990,36) */
   uint64_t __tmp_in_tmp20;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp20;
+  if (!binary_input::readArray(
+          tmp20,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp20;
+      }
+      Arr1DIdxRowM(tmp20, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp20 : 0;
     }
-    Arr1DIdxRowM(tmp20, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp20 : 0;
   }
 
   uint64_t *tmp21 =
@@ -2601,15 +2706,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp21
    * at (1993,1-1993,46) */
   uint64_t __tmp_in_tmp21;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp21;
+  if (!binary_input::readArray(
+          tmp21,
+          (((((int32_t)1 * (int32_t)32) * (int32_t)256) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)32; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp21;
+            }
+            Arr4DIdxRowM(tmp21, (int32_t)1, (int32_t)1, (int32_t)256, (int32_t)32,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp21 : 0;
           }
-          Arr4DIdxRowM(tmp21, (int32_t)1, (int32_t)1, (int32_t)256, (int32_t)32,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp21 : 0;
         }
       }
     }
@@ -2619,12 +2729,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp22
    * at (1996,1-1996,35) */
   uint64_t __tmp_in_tmp22;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)32; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp22;
+  if (!binary_input::readArray(
+          tmp22,
+          ((int32_t)1 * (int32_t)32),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)32; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp22;
+      }
+      Arr1DIdxRowM(tmp22, (int32_t)32, i0) =
+          (party == SERVER) ? __tmp_in_tmp22 : 0;
     }
-    Arr1DIdxRowM(tmp22, (int32_t)32, i0) =
-        (party == SERVER) ? __tmp_in_tmp22 : 0;
   }
 
   uint64_t *tmp23 =
@@ -2632,15 +2747,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp23
    * at (1999,1-1999,46) */
   uint64_t __tmp_in_tmp23;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)32; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp23;
+  if (!binary_input::readArray(
+          tmp23,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)32) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)32; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp23;
+            }
+            Arr4DIdxRowM(tmp23, (int32_t)1, (int32_t)1, (int32_t)32, (int32_t)128,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp23 : 0;
           }
-          Arr4DIdxRowM(tmp23, (int32_t)1, (int32_t)1, (int32_t)32, (int32_t)128,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp23 : 0;
         }
       }
     }
@@ -2650,12 +2770,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp24
    * at (2002,1-2002,36) */
   uint64_t __tmp_in_tmp24;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp24;
+  if (!binary_input::readArray(
+          tmp24,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp24;
+      }
+      Arr1DIdxRowM(tmp24, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp24 : 0;
     }
-    Arr1DIdxRowM(tmp24, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp24 : 0;
   }
 
   uint64_t *tmp25 =
@@ -2663,15 +2788,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp25
    * at (2005,1-2005,46) */
   uint64_t __tmp_in_tmp25;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)32; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp25;
+  if (!binary_input::readArray(
+          tmp25,
+          (((((int32_t)1 * (int32_t)128) * (int32_t)32) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)32; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)128; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp25;
+            }
+            Arr4DIdxRowM(tmp25, (int32_t)3, (int32_t)3, (int32_t)32, (int32_t)128,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp25 : 0;
           }
-          Arr4DIdxRowM(tmp25, (int32_t)3, (int32_t)3, (int32_t)32, (int32_t)128,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp25 : 0;
         }
       }
     }
@@ -2681,12 +2811,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp26
    * at (2008,1-2008,36) */
   uint64_t __tmp_in_tmp26;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp26;
+  if (!binary_input::readArray(
+          tmp26,
+          ((int32_t)1 * (int32_t)128),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)128; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp26;
+      }
+      Arr1DIdxRowM(tmp26, (int32_t)128, i0) =
+          (party == SERVER) ? __tmp_in_tmp26 : 0;
     }
-    Arr1DIdxRowM(tmp26, (int32_t)128, i0) =
-        (party == SERVER) ? __tmp_in_tmp26 : 0;
   }
 
   uint64_t *tmp27 =
@@ -2694,15 +2829,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp27
    * at (2011,1-2011,46) */
   uint64_t __tmp_in_tmp27;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)48; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp27;
+  if (!binary_input::readArray(
+          tmp27,
+          (((((int32_t)1 * (int32_t)48) * (int32_t)256) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)256; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)48; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp27;
+            }
+            Arr4DIdxRowM(tmp27, (int32_t)1, (int32_t)1, (int32_t)256, (int32_t)48,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp27 : 0;
           }
-          Arr4DIdxRowM(tmp27, (int32_t)1, (int32_t)1, (int32_t)256, (int32_t)48,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp27 : 0;
         }
       }
     }
@@ -2712,12 +2852,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp28
    * at (2014,1-2014,35) */
   uint64_t __tmp_in_tmp28;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)48; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp28;
+  if (!binary_input::readArray(
+          tmp28,
+          ((int32_t)1 * (int32_t)48),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)48; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp28;
+      }
+      Arr1DIdxRowM(tmp28, (int32_t)48, i0) =
+          (party == SERVER) ? __tmp_in_tmp28 : 0;
     }
-    Arr1DIdxRowM(tmp28, (int32_t)48, i0) =
-        (party == SERVER) ? __tmp_in_tmp28 : 0;
   }
 
   uint64_t *tmp29 =
@@ -2725,15 +2870,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp29
    * at (2017,1-2017,46) */
   uint64_t __tmp_in_tmp29;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)48; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)192; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp29;
+  if (!binary_input::readArray(
+          tmp29,
+          (((((int32_t)1 * (int32_t)192) * (int32_t)48) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)48; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)192; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp29;
+            }
+            Arr4DIdxRowM(tmp29, (int32_t)1, (int32_t)1, (int32_t)48, (int32_t)192,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp29 : 0;
           }
-          Arr4DIdxRowM(tmp29, (int32_t)1, (int32_t)1, (int32_t)48, (int32_t)192,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp29 : 0;
         }
       }
     }
@@ -2743,12 +2893,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp30
    * at (2020,1-2020,36) */
   uint64_t __tmp_in_tmp30;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp30;
+  if (!binary_input::readArray(
+          tmp30,
+          ((int32_t)1 * (int32_t)192),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp30;
+      }
+      Arr1DIdxRowM(tmp30, (int32_t)192, i0) =
+          (party == SERVER) ? __tmp_in_tmp30 : 0;
     }
-    Arr1DIdxRowM(tmp30, (int32_t)192, i0) =
-        (party == SERVER) ? __tmp_in_tmp30 : 0;
   }
 
   uint64_t *tmp31 =
@@ -2756,15 +2911,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp31
    * at (2023,1-2023,46) */
   uint64_t __tmp_in_tmp31;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)48; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)192; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp31;
+  if (!binary_input::readArray(
+          tmp31,
+          (((((int32_t)1 * (int32_t)192) * (int32_t)48) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)48; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)192; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp31;
+            }
+            Arr4DIdxRowM(tmp31, (int32_t)3, (int32_t)3, (int32_t)48, (int32_t)192,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp31 : 0;
           }
-          Arr4DIdxRowM(tmp31, (int32_t)3, (int32_t)3, (int32_t)48, (int32_t)192,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp31 : 0;
         }
       }
     }
@@ -2774,12 +2934,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp32
    * at (2026,1-2026,36) */
   uint64_t __tmp_in_tmp32;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp32;
+  if (!binary_input::readArray(
+          tmp32,
+          ((int32_t)1 * (int32_t)192),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp32;
+      }
+      Arr1DIdxRowM(tmp32, (int32_t)192, i0) =
+          (party == SERVER) ? __tmp_in_tmp32 : 0;
     }
-    Arr1DIdxRowM(tmp32, (int32_t)192, i0) =
-        (party == SERVER) ? __tmp_in_tmp32 : 0;
   }
 
   uint64_t *tmp33 =
@@ -2787,15 +2952,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp33
    * at (2029,1-2029,46) */
   uint64_t __tmp_in_tmp33;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)384; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)48; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp33;
+  if (!binary_input::readArray(
+          tmp33,
+          (((((int32_t)1 * (int32_t)48) * (int32_t)384) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)384; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)48; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp33;
+            }
+            Arr4DIdxRowM(tmp33, (int32_t)1, (int32_t)1, (int32_t)384, (int32_t)48,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp33 : 0;
           }
-          Arr4DIdxRowM(tmp33, (int32_t)1, (int32_t)1, (int32_t)384, (int32_t)48,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp33 : 0;
         }
       }
     }
@@ -2805,12 +2975,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp34
    * at (2032,1-2032,35) */
   uint64_t __tmp_in_tmp34;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)48; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp34;
+  if (!binary_input::readArray(
+          tmp34,
+          ((int32_t)1 * (int32_t)48),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)48; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp34;
+      }
+      Arr1DIdxRowM(tmp34, (int32_t)48, i0) =
+          (party == SERVER) ? __tmp_in_tmp34 : 0;
     }
-    Arr1DIdxRowM(tmp34, (int32_t)48, i0) =
-        (party == SERVER) ? __tmp_in_tmp34 : 0;
   }
 
   uint64_t *tmp35 =
@@ -2818,15 +2993,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp35
    * at (2035,1-2035,46) */
   uint64_t __tmp_in_tmp35;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)48; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)192; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp35;
+  if (!binary_input::readArray(
+          tmp35,
+          (((((int32_t)1 * (int32_t)192) * (int32_t)48) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)48; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)192; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp35;
+            }
+            Arr4DIdxRowM(tmp35, (int32_t)1, (int32_t)1, (int32_t)48, (int32_t)192,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp35 : 0;
           }
-          Arr4DIdxRowM(tmp35, (int32_t)1, (int32_t)1, (int32_t)48, (int32_t)192,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp35 : 0;
         }
       }
     }
@@ -2836,12 +3016,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp36
    * at (2038,1-2038,36) */
   uint64_t __tmp_in_tmp36;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp36;
+  if (!binary_input::readArray(
+          tmp36,
+          ((int32_t)1 * (int32_t)192),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp36;
+      }
+      Arr1DIdxRowM(tmp36, (int32_t)192, i0) =
+          (party == SERVER) ? __tmp_in_tmp36 : 0;
     }
-    Arr1DIdxRowM(tmp36, (int32_t)192, i0) =
-        (party == SERVER) ? __tmp_in_tmp36 : 0;
   }
 
   uint64_t *tmp37 =
@@ -2849,15 +3034,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp37
    * at (2041,1-2041,46) */
   uint64_t __tmp_in_tmp37;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)48; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)192; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp37;
+  if (!binary_input::readArray(
+          tmp37,
+          (((((int32_t)1 * (int32_t)192) * (int32_t)48) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)48; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)192; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp37;
+            }
+            Arr4DIdxRowM(tmp37, (int32_t)3, (int32_t)3, (int32_t)48, (int32_t)192,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp37 : 0;
           }
-          Arr4DIdxRowM(tmp37, (int32_t)3, (int32_t)3, (int32_t)48, (int32_t)192,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp37 : 0;
         }
       }
     }
@@ -2867,12 +3057,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp38
    * at (2044,1-2044,36) */
   uint64_t __tmp_in_tmp38;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp38;
+  if (!binary_input::readArray(
+          tmp38,
+          ((int32_t)1 * (int32_t)192),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)192; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp38;
+      }
+      Arr1DIdxRowM(tmp38, (int32_t)192, i0) =
+          (party == SERVER) ? __tmp_in_tmp38 : 0;
     }
-    Arr1DIdxRowM(tmp38, (int32_t)192, i0) =
-        (party == SERVER) ? __tmp_in_tmp38 : 0;
   }
 
   uint64_t *tmp39 =
@@ -2880,15 +3075,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp39
    * at (2047,1-2047,46) */
   uint64_t __tmp_in_tmp39;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)384; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp39;
+  if (!binary_input::readArray(
+          tmp39,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)384) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)384; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp39;
+            }
+            Arr4DIdxRowM(tmp39, (int32_t)1, (int32_t)1, (int32_t)384, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp39 : 0;
           }
-          Arr4DIdxRowM(tmp39, (int32_t)1, (int32_t)1, (int32_t)384, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp39 : 0;
         }
       }
     }
@@ -2898,12 +3098,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp40
    * at (2050,1-2050,35) */
   uint64_t __tmp_in_tmp40;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp40;
+  if (!binary_input::readArray(
+          tmp40,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp40;
+      }
+      Arr1DIdxRowM(tmp40, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp40 : 0;
     }
-    Arr1DIdxRowM(tmp40, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp40 : 0;
   }
 
   uint64_t *tmp41 =
@@ -2911,15 +3116,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp41
    * at (2053,1-2053,46) */
   uint64_t __tmp_in_tmp41;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp41;
+  if (!binary_input::readArray(
+          tmp41,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)64) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp41;
+            }
+            Arr4DIdxRowM(tmp41, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)256,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp41 : 0;
           }
-          Arr4DIdxRowM(tmp41, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)256,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp41 : 0;
         }
       }
     }
@@ -2929,12 +3139,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp42
    * at (2056,1-2056,36) */
   uint64_t __tmp_in_tmp42;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp42;
+  if (!binary_input::readArray(
+          tmp42,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp42;
+      }
+      Arr1DIdxRowM(tmp42, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp42 : 0;
     }
-    Arr1DIdxRowM(tmp42, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp42 : 0;
   }
 
   uint64_t *tmp43 =
@@ -2942,15 +3157,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp43
    * at (2059,1-2059,46) */
   uint64_t __tmp_in_tmp43;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp43;
+  if (!binary_input::readArray(
+          tmp43,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)64) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp43;
+            }
+            Arr4DIdxRowM(tmp43, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)256,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp43 : 0;
           }
-          Arr4DIdxRowM(tmp43, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)256,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp43 : 0;
         }
       }
     }
@@ -2960,12 +3180,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp44
    * at (2062,1-2062,36) */
   uint64_t __tmp_in_tmp44;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp44;
+  if (!binary_input::readArray(
+          tmp44,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp44;
+      }
+      Arr1DIdxRowM(tmp44, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp44 : 0;
     }
-    Arr1DIdxRowM(tmp44, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp44 : 0;
   }
 
   uint64_t *tmp45 =
@@ -2973,15 +3198,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp45
    * at (2065,1-2065,46) */
   uint64_t __tmp_in_tmp45;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp45;
+  if (!binary_input::readArray(
+          tmp45,
+          (((((int32_t)1 * (int32_t)64) * (int32_t)512) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)64; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp45;
+            }
+            Arr4DIdxRowM(tmp45, (int32_t)1, (int32_t)1, (int32_t)512, (int32_t)64,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp45 : 0;
           }
-          Arr4DIdxRowM(tmp45, (int32_t)1, (int32_t)1, (int32_t)512, (int32_t)64,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp45 : 0;
         }
       }
     }
@@ -2991,12 +3221,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp46
    * at (2068,1-2068,35) */
   uint64_t __tmp_in_tmp46;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp46;
+  if (!binary_input::readArray(
+          tmp46,
+          ((int32_t)1 * (int32_t)64),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)64; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp46;
+      }
+      Arr1DIdxRowM(tmp46, (int32_t)64, i0) =
+          (party == SERVER) ? __tmp_in_tmp46 : 0;
     }
-    Arr1DIdxRowM(tmp46, (int32_t)64, i0) =
-        (party == SERVER) ? __tmp_in_tmp46 : 0;
   }
 
   uint64_t *tmp47 =
@@ -3004,15 +3239,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp47
    * at (2071,1-2071,46) */
   uint64_t __tmp_in_tmp47;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp47;
+  if (!binary_input::readArray(
+          tmp47,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)64) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp47;
+            }
+            Arr4DIdxRowM(tmp47, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)256,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp47 : 0;
           }
-          Arr4DIdxRowM(tmp47, (int32_t)1, (int32_t)1, (int32_t)64, (int32_t)256,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp47 : 0;
         }
       }
     }
@@ -3022,12 +3262,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp48
    * at (2074,1-2074,36) */
   uint64_t __tmp_in_tmp48;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp48;
+  if (!binary_input::readArray(
+          tmp48,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp48;
+      }
+      Arr1DIdxRowM(tmp48, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp48 : 0;
     }
-    Arr1DIdxRowM(tmp48, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp48 : 0;
   }
 
   uint64_t *tmp49 =
@@ -3035,15 +3280,20 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp49
    * at (2077,1-2077,46) */
   uint64_t __tmp_in_tmp49;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp49;
+  if (!binary_input::readArray(
+          tmp49,
+          (((((int32_t)1 * (int32_t)256) * (int32_t)64) * (int32_t)3) * (int32_t)3),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)3; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)3; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)64; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)256; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp49;
+            }
+            Arr4DIdxRowM(tmp49, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)256,
+                         i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp49 : 0;
           }
-          Arr4DIdxRowM(tmp49, (int32_t)3, (int32_t)3, (int32_t)64, (int32_t)256,
-                       i0, i1, i2, i3) = (party == SERVER) ? __tmp_in_tmp49 : 0;
         }
       }
     }
@@ -3053,12 +3303,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp50
    * at (2080,1-2080,36) */
   uint64_t __tmp_in_tmp50;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp50;
+  if (!binary_input::readArray(
+          tmp50,
+          ((int32_t)1 * (int32_t)256),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)256; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp50;
+      }
+      Arr1DIdxRowM(tmp50, (int32_t)256, i0) =
+          (party == SERVER) ? __tmp_in_tmp50 : 0;
     }
-    Arr1DIdxRowM(tmp50, (int32_t)256, i0) =
-        (party == SERVER) ? __tmp_in_tmp50 : 0;
   }
 
   uint64_t *tmp51 =
@@ -3066,16 +3321,21 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp51
    * at (2083,1-2083,48) */
   uint64_t __tmp_in_tmp51;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
-    for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
-      for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
-        for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1000; i3++) {
-          if ((party == SERVER)) {
-            cin >> __tmp_in_tmp51;
+  if (!binary_input::readArray(
+          tmp51,
+          (((((int32_t)1 * (int32_t)1000) * (int32_t)512) * (int32_t)1) * (int32_t)1),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1; i0++) {
+      for (uint64_t i1 = (uint64_t)0; i1 < (int32_t)1; i1++) {
+        for (uint64_t i2 = (uint64_t)0; i2 < (int32_t)512; i2++) {
+          for (uint64_t i3 = (uint64_t)0; i3 < (int32_t)1000; i3++) {
+            if ((party == SERVER)) {
+              cin >> __tmp_in_tmp51;
+            }
+            Arr4DIdxRowM(tmp51, (int32_t)1, (int32_t)1, (int32_t)512,
+                         (int32_t)1000, i0, i1, i2, i3) =
+                (party == SERVER) ? __tmp_in_tmp51 : 0;
           }
-          Arr4DIdxRowM(tmp51, (int32_t)1, (int32_t)1, (int32_t)512,
-                       (int32_t)1000, i0, i1, i2, i3) =
-              (party == SERVER) ? __tmp_in_tmp51 : 0;
         }
       }
     }
@@ -3085,12 +3345,17 @@ int main(int argc, char **argv) {
   /* Variable to read the clear value corresponding to the input variable tmp52
    * at (2086,1-2086,37) */
   uint64_t __tmp_in_tmp52;
-  for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1000; i0++) {
-    if ((party == SERVER)) {
-      cin >> __tmp_in_tmp52;
+  if (!binary_input::readArray(
+          tmp52,
+          ((int32_t)1 * (int32_t)1000),
+          (party == SERVER))) {
+    for (uint64_t i0 = (uint64_t)0; i0 < (int32_t)1000; i0++) {
+      if ((party == SERVER)) {
+        cin >> __tmp_in_tmp52;
+      }
+      Arr1DIdxRowM(tmp52, (int32_t)1000, i0) =
+          (party == SERVER) ? __tmp_in_tmp52 : 0;
     }
-    Arr1DIdxRowM(tmp52, (int32_t)1000, i0) =
-        (party == SERVER) ? __tmp_in_tmp52 : 0;
   }
   StartComputation();
 
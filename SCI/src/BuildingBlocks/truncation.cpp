@@ -243,6 +243,103 @@ void Truncation::truncate(int32_t dim, uint64_t *inA, uint64_t *outB,
   return;
 }
 
+void Truncation::relu_truncate(int32_t dim, uint64_t *inA, uint64_t *outB,
+                               int32_t shift, int32_t bw, uint8_t *drelu) {
+  assert(shift >= 0 && (bw - shift - 1) >= 0 &&
+         "Truncation shouldn't truncate the full bitwidth");
+  assert(inA != outB);
+
+  uint64_t mask_bw = (bw == 64 ? -1 : ((1ULL << bw) - 1));
+  uint64_t mask_shift = (shift == 64 ? -1 : ((1ULL << shift) - 1));
+  // The comparison for the carry into the MSB is split into the lower shift
+  // bits (whose carry is the truncation's wrap_lower) and the bw_mid bits
+  // between them and the MSB
+  int32_t bw_mid = bw - shift - 1;
+  uint64_t mask_mid = (bw_mid == 64 ? -1 : ((1ULL << bw_mid) - 1));
+
+  uint8_t *wrap_lower = new uint8_t[dim];
+  uint8_t *carry = new uint8_t[dim];
+  uint8_t *msb = new uint8_t[dim];
+  uint8_t *drelu_x = new uint8_t[dim];
+
+  if (shift > 0) {
+    uint64_t *inA_lower = new uint64_t[dim];
+    for (int i = 0; i < dim; i++) {
+      inA_lower[i] = inA[i] & mask_shift;
+    }
+    this->aux->wrap_computation(inA_lower, wrap_lower, dim, shift);
+    delete[] inA_lower;
+  } else {
+    memset(wrap_lower, 0, dim);
+  }
+
+  if (bw_mid > 0) {
+    uint64_t *inA_mid = new uint64_t[dim];
+    for (int i = 0; i < dim; i++) {
+      inA_mid[i] = (inA[i] >> shift) & mask_mid;
+      if (party == BOB) {
+        inA_mid[i] = (mask_mid - inA_mid[i]) & mask_mid;
+      }
+    }
+    if (shift > 0) {
+      // carry = wrap_mid ^ (eq_mid & wrap_lower)
+      uint8_t *eq_mid = new uint8_t[dim];
+      uint8_t *and_mid = new uint8_t[dim];
+      this->mill_eq->compare_with_eq(carry, eq_mid, inA_mid, dim, bw_mid);
+      this->aux->AND(wrap_lower, eq_mid, and_mid, dim);
+      for (int i = 0; i < dim; i++) {
+        carry[i] ^= and_mid[i];
+      }
+      delete[] eq_mid;
+      delete[] and_mid;
+    } else {
+      this->mill->compare(carry, inA_mid, dim, bw_mid, true);
+    }
+    delete[] inA_mid;
+  } else {
+    memcpy(carry, wrap_lower, dim);
+  }
+
+  for (int i = 0; i < dim; i++) {
+    msb[i] = (carry[i] ^ (inA[i] >> (bw - 1))) & 1;
+    drelu_x[i] = msb[i] ^ (party == ALICE ? 1 : 0);
+  }
+  if (drelu != nullptr) {
+    memcpy(drelu, drelu_x, dim);
+  }
+
+  // Unsigned right shift of x; it agrees with the signed one on x >= 0,
+  // the only inputs the multiplexer keeps
+  uint64_t *tmpB = new uint64_t[dim];
+  if (shift > 0) {
+    uint8_t *wrap_upper = new uint8_t[dim];
+    uint64_t *arith_wrap_upper = new uint64_t[dim];
+    uint64_t *arith_wrap_lower = new uint64_t[dim];
+    this->aux->MSB_to_Wrap(inA, msb, wrap_upper, dim, bw);
+    this->aux->B2A(wrap_upper, arith_wrap_upper, dim, shift);
+    this->aux->B2A(wrap_lower, arith_wrap_lower, dim, bw);
+    for (int i = 0; i < dim; i++) {
+      tmpB[i] = (((inA[i] & mask_bw) >> shift) + arith_wrap_lower[i] -
+                 (1ULL << (bw - shift)) * arith_wrap_upper[i]) &
+                mask_bw;
+    }
+    delete[] wrap_upper;
+    delete[] arith_wrap_upper;
+    delete[] arith_wrap_lower;
+  } else {
+    for (int i = 0; i < dim; i++) {
+      tmpB[i] = inA[i] & mask_bw;
+    }
+  }
+  this->aux->multiplexer(drelu_x, tmpB, outB, dim, bw, bw);
+
+  delete[] wrap_lower;
+  delete[] carry;
+  delete[] msb;
+  delete[] drelu_x;
+  delete[] tmpB;
+}
+
 void Truncation::truncate_red_then_ext(int32_t dim, uint64_t *inA,
                                        uint64_t *outB, int32_t shift,
                                        int32_t bw, bool signed_arithmetic,
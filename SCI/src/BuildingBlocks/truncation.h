@@ -94,6 +94,24 @@ public:
       // msb of input vector elements
       uint8_t *msb_x = nullptr);
 
+  // ReLU followed by truncation by shift in the same ring. The carry into
+  // the MSB (which gives DReLU) and the wrap of the lower shift bits come
+  // from one comparison over bw - 1 bits, split at shift.
+  void relu_truncate(
+      // Size of vector
+      int32_t dim,
+      // input vector
+      uint64_t *inA,
+      // output vector
+      uint64_t *outB,
+      // right shift amount
+      int32_t shift,
+      // Input and output bitwidth
+      int32_t bw,
+      // (optional) shares of DReLU(x), e.g. for a later extension or the
+      // backward pass
+      uint8_t *drelu = nullptr);
+
   // Truncate (right-shift) by shift and go to a smaller ring
   void truncate_and_reduce(
       // Size of vector
@@ -0,0 +1,477 @@
+/*
+Copyright:
+Copyright (c) 2022 Microsoft Research
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "LinearHE/linear-ring.h"
+#include <numeric>
+#include <sstream>
+
+using namespace std;
+using namespace sci;
+using namespace seal;
+
+// BFV parameter sets, smallest first. The last prime only serves key
+// switching; the others hold the data.
+static const size_t ring_poly_degrees[] = {8192, 16384};
+
+static vector<int> ring_coeff_bits(size_t poly_degree) {
+  if (poly_degree == 8192)
+    return {60, 60, 60, 38};
+  return {60, 60, 60, 60, 60, 60, 30};
+}
+
+static int32_t log2_degree(size_t poly_degree) {
+  int32_t r = 0;
+  while ((size_t(1) << r) < poly_degree)
+    r++;
+  return r;
+}
+
+// Results sum at most 2^ring_sum_bits plaintext-ciphertext products: b2
+// blocks for a matrix product, blocks_c for a convolution
+static const int32_t ring_sum_bits = 16;
+
+// Bound, in bits, on the noise of a sum of products. Operands are encoded
+// with & mask, but SEAL lifts plaintext coefficients in the upper half of
+// Z_t to negative values when it encrypts and multiplies, so both operands
+// are centred in [-2^(l-1), 2^(l-1)]. A fresh ciphertext encrypts
+// Delta * m + v with Delta = floor(q / t) and |v| < 2^(log N + 6). The
+// product with a plaintext a gives a * v, at most 2^(l + 2 log N + 5), and
+// Delta * a * m = Delta * [a * m]_t - (q mod t) * k, where |k| <= N 2^(l-2)
+// counts the wraps of a * m mod t. Since t = 2^l does not divide q,
+// q mod t is up to 2^l and this second term is about 2l + log N bits.
+static int32_t ring_noise_bits(int32_t bitlength, size_t poly_degree) {
+  int32_t log_n = log2_degree(poly_degree);
+  int32_t plain_term = bitlength + 2 * log_n + 5;
+  int32_t wrap_term = 2 * bitlength + log_n - 2;
+  return ring_sum_bits + max(plain_term, wrap_term) + 1;
+}
+
+// Flooding hides the product noise with 40 bits of statistical security
+static uint32_t ring_flood_bits(int32_t bitlength, size_t poly_degree) {
+  return ring_noise_bits(bitlength, poly_degree) + 40;
+}
+
+// Decryption needs the flooding noise, times the secret key on c_1, below
+// Delta / 2 = q / 2^(l+1)
+static bool ring_params_fit(int32_t bitlength, size_t poly_degree) {
+  vector<int> bits = ring_coeff_bits(poly_degree);
+  int32_t data_bits = accumulate(bits.begin(), bits.end() - 1, 0);
+  return int32_t(ring_flood_bits(bitlength, poly_degree)) +
+             log2_degree(poly_degree) + 1 <
+         data_bits - bitlength - 1;
+}
+
+static int32_t ceil_div(int32_t a, int32_t b) { return (a + b - 1) / b; }
+
+bool LinearRing::supported(int32_t bitlength) {
+  // SEAL takes plaintext moduli of at most 60 bits
+  if (bitlength <= 0 || bitlength > 59)
+    return false;
+  for (size_t poly_degree : ring_poly_degrees) {
+    if (ring_params_fit(bitlength, poly_degree))
+      return true;
+  }
+  return false;
+}
+
+LinearRing::LinearRing(int party, NetIO *io, int32_t bitlength) {
+  assert(supported(bitlength));
+  this->party = party;
+  this->io = io;
+  this->bitlength = bitlength;
+  this->mask = (1ULL << bitlength) - 1;
+  for (size_t poly_degree : ring_poly_degrees) {
+    this->poly_degree = poly_degree;
+    if (ring_params_fit(bitlength, poly_degree))
+      break;
+  }
+  this->flood_bits = ring_flood_bits(bitlength, poly_degree);
+
+  EncryptionParameters parms(scheme_type::BFV);
+  parms.set_poly_modulus_degree(poly_degree);
+  parms.set_coeff_modulus(
+      CoeffModulus::Create(poly_degree, ring_coeff_bits(poly_degree)));
+  parms.set_plain_modulus(1ULL << bitlength);
+  context = SEALContext::Create(parms, true, sec_level_type::tc128);
+  evaluator = new Evaluator(context);
+
+  KeyGenerator keygen(context);
+  PublicKey pub_key = keygen.public_key();
+  SecretKey sec_key = keygen.secret_key();
+  encryptor = new Encryptor(context, pub_key);
+  decryptor = new Decryptor(context, sec_key);
+
+  // Exchange public keys, ALICE first
+  stringstream os;
+  pub_key.save(os);
+  string keys_ser = os.str();
+  uint64_t pk_size = keys_ser.size();
+  uint64_t other_pk_size;
+  string other_ser;
+  for (int sender = ALICE; sender <= BOB; sender++) {
+    if (party == sender) {
+      io->send_data(&pk_size, sizeof(uint64_t));
+      io->send_data(keys_ser.c_str(), pk_size);
+    } else {
+      io->recv_data(&other_pk_size, sizeof(uint64_t));
+      other_ser.resize(other_pk_size);
+      io->recv_data(&other_ser[0], other_pk_size);
+    }
+  }
+  stringstream is;
+  is.write(other_ser.c_str(), other_pk_size);
+  PublicKey other_pub_key;
+  other_pub_key.load(context, is);
+  other_encryptor = new Encryptor(context, other_pub_key);
+
+  // Results are switched down as far as the rounding noise of modulus
+  // switching (about ||s||_1 / 2) stays well below the plaintext
+  auto context_data = context->first_context_data();
+  input_moduli = context_data->parms().coeff_modulus().size();
+  while (auto next = context_data->next_context_data()) {
+    if (int32_t(next->total_coeff_modulus_bit_count()) <
+        bitlength + log2_degree(poly_degree) + 10)
+      break;
+    context_data = next;
+  }
+  result_parms_id = context_data->parms_id();
+  result_moduli = context_data->parms().coeff_modulus().size();
+}
+
+LinearRing::~LinearRing() {
+  delete evaluator;
+  delete encryptor;
+  delete decryptor;
+  delete other_encryptor;
+}
+
+RingMatMulPlan LinearRing::plan_matmul(int32_t s1, int32_t s2,
+                                       int32_t s3) const {
+  const int32_t N = poly_degree;
+  RingMatMulPlan best = {};
+  int64_t best_cost = -1;
+  for (int32_t n2 = 1; n2 <= min(s2, N); n2++) {
+    for (int32_t n3 = 1; n3 <= min(s3, N / n2); n3++) {
+      RingMatMulPlan p;
+      p.n1 = min(s1, N / (n2 * n3));
+      p.n2 = n2;
+      p.n3 = n3;
+      p.b1 = ceil_div(s1, p.n1);
+      p.b2 = ceil_div(s2, n2);
+      p.b3 = ceil_div(s3, n3);
+      int64_t cost = p.in_ct() * input_moduli + p.out_ct() * result_moduli;
+      if (best_cost < 0 || cost < best_cost ||
+          (cost == best_cost && p.products() < best.products())) {
+        best = p;
+        best_cost = cost;
+      }
+    }
+  }
+  return best;
+}
+
+RingConvPlan LinearRing::plan_conv(int32_t Hp, int32_t Wp, int32_t CI,
+                                   int32_t FH, int32_t FW, int32_t CO) const {
+  const int32_t N = poly_degree;
+  assert(FH <= Hp && FW <= Wp && FH * FW <= N);
+  RingConvPlan best = {};
+  int64_t best_cost = -1, best_products = 0;
+  for (int32_t Hn = FH; Hn <= Hp; Hn++) {
+    for (int32_t Wn = FW; Wn <= Wp && Hn * Wn <= N; Wn++) {
+      RingConvPlan p;
+      p.Hn = Hn;
+      p.Wn = Wn;
+      p.Cn = min(CI, N / (Hn * Wn));
+      p.tiles_h = ceil_div(Hp - FH + 1, Hn - FH + 1);
+      p.tiles_w = ceil_div(Wp - FW + 1, Wn - FW + 1);
+      p.blocks_c = ceil_div(CI, p.Cn);
+      int64_t tiles = int64_t(p.tiles_h) * p.tiles_w;
+      int64_t cost = tiles * (p.blocks_c * int64_t(input_moduli) +
+                              CO * int64_t(result_moduli));
+      int64_t products = tiles * p.blocks_c * CO;
+      if (best_cost < 0 || cost < best_cost ||
+          (cost == best_cost && products < best_products)) {
+        best = p;
+        best_cost = cost;
+        best_products = products;
+      }
+    }
+  }
+  return best;
+}
+
+void LinearRing::matmul_cost(int32_t s1, int32_t s2, int32_t s3,
+                             double &ct_moduli, double &products) const {
+  RingMatMulPlan p = plan_matmul(s1, s2, s3);
+  ct_moduli = double(p.in_ct()) * input_moduli +
+              double(p.out_ct()) * result_moduli;
+  products = p.products();
+}
+
+void LinearRing::mask_result(Ciphertext &result, bool empty, uint64_t *R) {
+  PRG128 prg;
+  prg.random_data(R, poly_degree * sizeof(uint64_t));
+  Plaintext R_pt(poly_degree);
+  for (size_t i = 0; i < poly_degree; i++) {
+    R[i] &= mask;
+    R_pt[i] = R[i];
+  }
+  // The fresh encryption also re-randomizes c_1, which would otherwise
+  // depend on the plaintext operand
+  Ciphertext enc_R;
+  other_encryptor->encrypt(R_pt, enc_R);
+  if (empty) {
+    result = enc_R;
+  } else {
+    evaluator->transform_from_ntt_inplace(result);
+    evaluator->add_inplace(result, enc_R);
+  }
+  auto context_data = context->first_context_data();
+  flood_ciphertext(result, context_data, flood_bits);
+  evaluator->mod_switch_to_inplace(result, result_parms_id);
+  for (size_t i = 0; i < poly_degree; i++) {
+    R[i] = (-R[i]) & mask;
+  }
+}
+
+void LinearRing::matmul(int32_t s1, int32_t s2, int32_t s3, const uint64_t *A,
+                        const uint64_t *B, uint64_t *C, int partyWithA) {
+  RingMatMulPlan p = plan_matmul(s1, s2, s3);
+  assert(p.b2 <= (1 << ring_sum_bits));
+  const int32_t n1 = p.n1, n2 = p.n2, n3 = p.n3;
+  vector<Ciphertext> enc_B(p.in_ct());
+  vector<Ciphertext> enc_C(p.out_ct());
+
+  if (party != partyWithA) {
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+    for (int64_t idx = 0; idx < p.in_ct(); idx++) {
+      int32_t bj = idx / p.b3, bk = idx % p.b3;
+      Plaintext pt(poly_degree);
+      for (int32_t j = 0; j < n2 && bj * n2 + j < s2; j++) {
+        for (int32_t k = 0; k < n3 && bk * n3 + k < s3; k++) {
+          pt[k * n2 + n2 - 1 - j] =
+              B[int64_t(bj * n2 + j) * s3 + bk * n3 + k] & mask;
+        }
+      }
+      encryptor->encrypt(pt, enc_B[idx]);
+    }
+    send_encrypted_vector(io, enc_B);
+
+    recv_encrypted_vector(io, enc_C);
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+    for (int64_t idx = 0; idx < p.out_ct(); idx++) {
+      int32_t bi = idx / p.b3, bk = idx % p.b3;
+      Plaintext pt;
+      decryptor->decrypt(enc_C[idx], pt);
+      for (int32_t i = 0; i < n1 && bi * n1 + i < s1; i++) {
+        for (int32_t k = 0; k < n3 && bk * n3 + k < s3; k++) {
+          C[int64_t(bi * n1 + i) * s3 + bk * n3 + k] =
+              coeff(pt, i * n2 * n3 + k * n2 + n2 - 1);
+        }
+      }
+    }
+  } else {
+    // Blocks of A, in NTT form so that every product is pointwise
+    int64_t num_A = int64_t(p.b1) * p.b2;
+    vector<Plaintext> A_pt(num_A);
+    vector<char> A_zero(num_A);
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+    for (int64_t idx = 0; idx < num_A; idx++) {
+      int32_t bi = idx / p.b2, bj = idx % p.b2;
+      A_pt[idx].resize(poly_degree);
+      A_pt[idx].set_zero();
+      for (int32_t i = 0; i < n1 && bi * n1 + i < s1; i++) {
+        for (int32_t j = 0; j < n2 && bj * n2 + j < s2; j++) {
+          A_pt[idx][i * n2 * n3 + j] =
+              A[int64_t(bi * n1 + i) * s2 + bj * n2 + j] & mask;
+        }
+      }
+      A_zero[idx] = A_pt[idx].is_zero();
+      if (!A_zero[idx])
+        evaluator->transform_to_ntt_inplace(A_pt[idx], context->first_parms_id());
+    }
+
+    recv_encrypted_vector(io, enc_B);
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+    for (int64_t idx = 0; idx < p.in_ct(); idx++) {
+      evaluator->transform_to_ntt_inplace(enc_B[idx]);
+    }
+
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+    for (int64_t idx = 0; idx < p.out_ct(); idx++) {
+      int32_t bi = idx / p.b3, bk = idx % p.b3;
+      bool empty = true;
+      Ciphertext prod;
+      for (int32_t bj = 0; bj < p.b2; bj++) {
+        int64_t a = int64_t(bi) * p.b2 + bj;
+        if (A_zero[a])
+          continue;
+        if (empty) {
+          evaluator->multiply_plain(enc_B[bj * p.b3 + bk], A_pt[a],
+                                    enc_C[idx]);
+          empty = false;
+        } else {
+          evaluator->multiply_plain(enc_B[bj * p.b3 + bk], A_pt[a], prod);
+          evaluator->add_inplace(enc_C[idx], prod);
+        }
+      }
+      vector<uint64_t> R(poly_degree);
+      mask_result(enc_C[idx], empty, R.data());
+      for (int32_t i = 0; i < n1 && bi * n1 + i < s1; i++) {
+        for (int32_t k = 0; k < n3 && bk * n3 + k < s3; k++) {
+          C[int64_t(bi * n1 + i) * s3 + bk * n3 + k] =
+              R[i * n2 * n3 + k * n2 + n2 - 1];
+        }
+      }
+    }
+    send_encrypted_vector(io, enc_C);
+  }
+}
+
+void LinearRing::convolution(int32_t N, int32_t H, int32_t W, int32_t CI,
+                             int32_t FH, int32_t FW, int32_t CO,
+                             int32_t zPadHLeft, int32_t zPadHRight,
+                             int32_t zPadWLeft, int32_t zPadWRight,
+                             int32_t strideH, int32_t strideW,
+                             const uint64_t *input, const uint64_t *filter,
+                             uint64_t *output, int partyWithFilter) {
+  int32_t Hp = H + zPadHLeft + zPadHRight;
+  int32_t Wp = W + zPadWLeft + zPadWRight;
+  // Stride-1 output size, and the size that is kept
+  int32_t OH = Hp - FH + 1, OW = Wp - FW + 1;
+  int32_t newH = (Hp - FH) / strideH + 1, newW = (Wp - FW) / strideW + 1;
+
+  RingConvPlan p = plan_conv(Hp, Wp, CI, FH, FW, CO);
+  assert(p.blocks_c <= (1 << ring_sum_bits));
+  const int32_t Cn = p.Cn, Hn = p.Hn, Wn = p.Wn;
+  const int32_t step_h = Hn - FH + 1, step_w = Wn - FW + 1;
+  const int32_t O = Hn * Wn * (Cn - 1) + Wn * (FH - 1) + FW - 1;
+  int64_t tiles = int64_t(N) * p.tiles_h * p.tiles_w;
+  vector<Ciphertext> enc_in(tiles * p.blocks_c);
+  vector<Ciphertext> enc_out(tiles * CO);
+
+  // Writes the kept outputs of tile t for output channel m from val(pos),
+  // where pos is the coefficient of the stride-1 output (y, x) of the tile
+  auto store_tile = [&](int64_t t, int32_t m, auto val) {
+    int32_t tx = t % p.tiles_w, ty = (t / p.tiles_w) % p.tiles_h;
+    int32_t n = t / (int64_t(p.tiles_w) * p.tiles_h);
+    for (int32_t y = 0; y < step_h; y++) {
+      int32_t oy = ty * step_h + y;
+      if (oy >= OH || oy % strideH != 0)
+        continue;
+      for (int32_t x = 0; x < step_w; x++) {
+        int32_t ox = tx * step_w + x;
+        if (ox >= OW || ox % strideW != 0)
+          continue;
+        output[((int64_t(n) * newH + oy / strideH) * newW + ox / strideW) *
+                   CO +
+               m] = val(O + y * Wn + x);
+      }
+    }
+  };
+
+  if (party != partyWithFilter) {
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+    for (int64_t idx = 0; idx < int64_t(enc_in.size()); idx++) {
+      int32_t cb = idx % p.blocks_c;
+      int64_t t = idx / p.blocks_c;
+      int32_t tx = t % p.tiles_w, ty = (t / p.tiles_w) % p.tiles_h;
+      int32_t n = t / (int64_t(p.tiles_w) * p.tiles_h);
+      Plaintext pt(poly_degree);
+      for (int32_t c = 0; c < Cn && cb * Cn + c < CI; c++) {
+        for (int32_t y = 0; y < Hn; y++) {
+          int32_t h = ty * step_h + y - zPadHLeft;
+          if (h < 0 || h >= H)
+            continue;
+          for (int32_t x = 0; x < Wn; x++) {
+            int32_t w = tx * step_w + x - zPadWLeft;
+            if (w < 0 || w >= W)
+              continue;
+            pt[c * Hn * Wn + y * Wn + x] =
+                input[((int64_t(n) * H + h) * W + w) * CI + cb * Cn + c] &
+                mask;
+          }
+        }
+      }
+      encryptor->encrypt(pt, enc_in[idx]);
+    }
+    send_encrypted_vector(io, enc_in);
+
+    recv_encrypted_vector(io, enc_out);
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+    for (int64_t idx = 0; idx < int64_t(enc_out.size()); idx++) {
+      Plaintext pt;
+      decryptor->decrypt(enc_out[idx], pt);
+      store_tile(idx / CO, idx % CO, [&](int32_t pos) { return coeff(pt, pos); });
+    }
+  } else {
+    recv_encrypted_vector(io, enc_in);
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+    for (int64_t idx = 0; idx < int64_t(enc_in.size()); idx++) {
+      evaluator->transform_to_ntt_inplace(enc_in[idx]);
+    }
+
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+    for (int32_t m = 0; m < CO; m++) {
+      // Filter of output channel m, one plaintext per block of channels
+      vector<Plaintext> K(p.blocks_c);
+      vector<char> K_zero(p.blocks_c);
+      for (int32_t cb = 0; cb < p.blocks_c; cb++) {
+        K[cb].resize(poly_degree);
+        K[cb].set_zero();
+        for (int32_t c = 0; c < Cn && cb * Cn + c < CI; c++) {
+          for (int32_t dy = 0; dy < FH; dy++) {
+            for (int32_t dx = 0; dx < FW; dx++) {
+              K[cb][O - c * Hn * Wn - dy * Wn - dx] =
+                  filter[((int64_t(dy) * FW + dx) * CI + cb * Cn + c) * CO +
+                         m] &
+                  mask;
+            }
+          }
+        }
+        K_zero[cb] = K[cb].is_zero();
+        if (!K_zero[cb])
+          evaluator->transform_to_ntt_inplace(K[cb], context->first_parms_id());
+      }
+
+      vector<uint64_t> R(poly_degree);
+      Ciphertext prod;
+      for (int64_t t = 0; t < tiles; t++) {
+        Ciphertext &result = enc_out[t * CO + m];
+        bool empty = true;
+        for (int32_t cb = 0; cb < p.blocks_c; cb++) {
+          if (K_zero[cb])
+            continue;
+          if (empty) {
+            evaluator->multiply_plain(enc_in[t * p.blocks_c + cb], K[cb],
+                                      result);
+            empty = false;
+          } else {
+            evaluator->multiply_plain(enc_in[t * p.blocks_c + cb], K[cb], prod);
+            evaluator->add_inplace(result, prod);
+          }
+        }
+        mask_result(result, empty, R.data());
+        store_tile(t, m, [&](int32_t pos) { return R[pos]; });
+      }
+    }
+    send_encrypted_vector(io, enc_out);
+  }
+}
@@ -0,0 +1,142 @@
+/*
+Copyright:
+Copyright (c) 2022 Microsoft Research
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef LINEAR_RING_H__
+#define LINEAR_RING_H__
+
+#include "LinearHE/utils-HE.h"
+
+// Linear layers over Z_2^l with BFV and polynomial coefficient encoding, as
+// in Cheetah (Huang et al., USENIX Security 2022).
+//
+// ConvField/FCField work over a prime field with SIMD batching and need
+// Galois rotations to sum across slots. Here the plaintext modulus is 2^l
+// itself and operands are packed into the coefficients of a polynomial, so
+// that a single plaintext-ciphertext product in Z_2^l[X]/(X^N + 1) computes
+// a whole block of inner products: no rotations (and no Galois keys) are
+// needed, and the resulting shares are ordinary ring shares that the
+// existing ring ReLU, truncation etc. consume unchanged.
+//
+// One party (the one holding the input share) encrypts its operand under its
+// own key; the other multiplies by its plaintext operand, adds a fresh
+// encryption of a uniform mask R under the first party's key, floods the
+// noise and sends the result back. The decrypted coefficients and -R are
+// the two shares.
+//
+// Matrix product A (s1 x s2) * B (s2 x s3), in blocks of n1 x n2 and
+// n2 x n3 with n1 * n2 * n3 <= N:
+//   A block:  A[i][j] at X^(i * n2 * n3 + j)
+//   B block:  B[j][k] at X^(k * n2 + n2 - 1 - j)
+//   product:  (A * B)[i][k] at X^(i * n2 * n3 + k * n2 + n2 - 1)
+//
+// Convolution of a Cn x Hn x Wn input tile with an FH x FW filter, with
+// Cn * Hn * Wn <= N and O = Hn * Wn * (Cn - 1) + Wn * (FH - 1) + FW - 1:
+//   input:    T[c][y][x] at X^(c * Hn * Wn + y * Wn + x)
+//   filter:   K[c][dy][dx] at X^(O - c * Hn * Wn - dy * Wn - dx)
+//   output:   out[y][x] at X^(O + y * Wn + x), y <= Hn - FH, x <= Wn - FW
+// Other coefficients of the products hold partial sums; the mask R covers
+// all N coefficients, so they reveal nothing.
+
+// Block sizes of a matrix product and the resulting ciphertext counts
+struct RingMatMulPlan {
+  int32_t n1, n2, n3;
+  int32_t b1, b2, b3; // number of blocks along s1, s2 and s3
+  int64_t in_ct() const { return int64_t(b2) * b3; }
+  int64_t out_ct() const { return int64_t(b1) * b3; }
+  int64_t products() const { return int64_t(b1) * b2 * b3; }
+};
+
+// Tiling of a convolution; the output tile of an Hn x Wn input tile is
+// (Hn - FH + 1) x (Wn - FW + 1) at stride 1
+struct RingConvPlan {
+  int32_t Cn, Hn, Wn;
+  int32_t tiles_h, tiles_w, blocks_c;
+};
+
+class LinearRing {
+public:
+  int party;
+  sci::NetIO *io;
+  int32_t bitlength;
+  uint64_t mask;
+  size_t poly_degree;
+  std::shared_ptr<seal::SEALContext> context;
+  seal::Encryptor *encryptor;       // own public key
+  seal::Decryptor *decryptor;       // own secret key
+  seal::Encryptor *other_encryptor; // the other party's public key
+  seal::Evaluator *evaluator;
+  // Level the results are switched down to before they are sent
+  seal::parms_id_type result_parms_id;
+  size_t input_moduli, result_moduli;
+  // Bits of noise flooding: covers the noise of a sum of plaintext products
+  // with 40 bits of statistical security
+  uint32_t flood_bits;
+
+  // Keys for both directions are generated here: each party encrypts under
+  // its own key when it holds the input, so either may hold the weights
+  LinearRing(int party, sci::NetIO *io, int32_t bitlength);
+
+  ~LinearRing();
+
+  // Whether the ring Z_2^bitlength fits the supported parameter sets
+  static bool supported(int32_t bitlength);
+
+  RingMatMulPlan plan_matmul(int32_t s1, int32_t s2, int32_t s3) const;
+
+  // Hp x Wp is the padded input size
+  RingConvPlan plan_conv(int32_t Hp, int32_t Wp, int32_t CI, int32_t FH,
+                         int32_t FW, int32_t CO) const;
+
+  // Ciphertexts sent (in units of one RNS component, so that inputs and the
+  // mod-switched results are comparable) and plaintext products of
+  // plan_matmul(s1, s2, s3); used by the linear-layer cost model
+  void matmul_cost(int32_t s1, int32_t s2, int32_t s3, double &ct_moduli,
+                   double &products) const;
+
+  // Shares in C (s1 x s3) of A * B, where A (s1 x s2) is held by
+  // partyWithA and B (s2 x s3) by the other party, which encrypts it.
+  // All matrices are row-major with entries in Z_2^bitlength; the argument
+  // of the operand a party does not hold is ignored.
+  void matmul(int32_t s1, int32_t s2, int32_t s3, const uint64_t *A,
+              const uint64_t *B, uint64_t *C, int partyWithA);
+
+  // Shares of the convolution of input (N x H x W x CI, NHWC) with filter
+  // (FH x FW x CI x CO) into output (N x newH x newW x CO), where filter is
+  // held by partyWithFilter and input by the other party, which encrypts
+  // it. Strides are handled by computing the stride-1 output and keeping
+  // every stride-th row and column.
+  void convolution(int32_t N, int32_t H, int32_t W, int32_t CI, int32_t FH,
+                   int32_t FW, int32_t CO, int32_t zPadHLeft,
+                   int32_t zPadHRight, int32_t zPadWLeft, int32_t zPadWRight,
+                   int32_t strideH, int32_t strideW, const uint64_t *input,
+                   const uint64_t *filter, uint64_t *output,
+                   int partyWithFilter);
+
+private:
+  // Masks, floods and switches down result, and returns the evaluating
+  // party's share -R in R
+  void mask_result(seal::Ciphertext &result, bool empty, uint64_t *R);
+
+  uint64_t coeff(const seal::Plaintext &pt, size_t i) const {
+    return (i < pt.coeff_count() ? pt[i] : 0) & mask;
+  }
+};
+
+#endif // LINEAR_RING_H__
@@ -178,7 +178,7 @@ void recv_ciphertext(NetIO *io, Ciphertext &ct) {
 void set_poly_coeffs_uniform(
     uint64_t *poly, uint32_t bitlen, shared_ptr<UniformRandomGenerator> random,
     shared_ptr<const SEALContext::ContextData> &context_data) {
-  assert(bitlen < 128 && bitlen > 0);
+  assert(bitlen < 192 && bitlen > 0);
   auto &parms = context_data->parms();
   auto &coeff_modulus = parms.coeff_modulus();
   size_t coeff_count = parms.poly_modulus_degree();
@@ -194,7 +194,7 @@ void set_poly_coeffs_uniform(
         poly[i + (j * coeff_count)] =
             barrett_reduce_63(noise, coeff_modulus[j]);
       }
-    } else {
+    } else if (bitlen < 128) {
       uint64_t noise[2]; // LSB || MSB
       for (int j = 0; j < 2; j++) {
         noise[0] = (uint64_t(engine()) << 32) | engine();
@@ -205,6 +205,22 @@ void set_poly_coeffs_uniform(
         poly[i + (j * coeff_count)] =
             barrett_reduce_128(noise, coeff_modulus[j]);
       }
+    } else {
+      uint64_t noise[3]; // LSB || ... || MSB
+      for (int j = 0; j < 3; j++) {
+        noise[j] = (uint64_t(engine()) << 32) | engine();
+      }
+      noise[2] &= bitlen_mask;
+      for (size_t j = 0; j < coeff_mod_count; j++) {
+        // Reduce one 64-bit word at a time, most significant first
+        uint64_t rem[2] = {noise[2], 0};
+        rem[1] = barrett_reduce_128(rem, coeff_modulus[j]);
+        rem[0] = noise[1];
+        rem[1] = barrett_reduce_128(rem, coeff_modulus[j]);
+        rem[0] = noise[0];
+        poly[i + (j * coeff_count)] =
+            barrett_reduce_128(rem, coeff_modulus[j]);
+      }
     }
   }
 }
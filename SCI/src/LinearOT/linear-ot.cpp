@@ -27,7 +27,7 @@ SOFTWARE.
 
 #define USE_EIGEN
 #ifdef USE_EIGEN
-#include <Eigen/Dense>
+#include "utils/ring_gemm.h"
 #endif
 
 using namespace std;
@@ -108,33 +108,15 @@ void LinearOT::hadamard_cleartext(int dim, uint64_t *inA, uint64_t *inB,
 
 #ifdef USE_EIGEN
 void matmul_cleartext_eigen(int dim1, int dim2, int dim3, uint64_t *inA,
-                            uint64_t *inB, uint64_t *outC) {
-  Eigen::Matrix<uint64_t, Eigen::Dynamic, Eigen::Dynamic> eigen_A(dim1, dim2);
-  Eigen::Matrix<uint64_t, Eigen::Dynamic, Eigen::Dynamic> eigen_B(dim2, dim3);
-  Eigen::Matrix<uint64_t, Eigen::Dynamic, Eigen::Dynamic> eigen_C(dim1, dim3);
-
-  for (int i = 0; i < dim1; i++) {
-    for (int j = 0; j < dim2; j++) {
-      eigen_A(i, j) = Arr2DIdxRowM(inA, dim1, dim2, i, j);
-    }
-  }
-  for (int i = 0; i < dim2; i++) {
-    for (int j = 0; j < dim3; j++) {
-      eigen_B(i, j) = Arr2DIdxRowM(inB, dim2, dim3, i, j);
-    }
-  }
-  eigen_C = eigen_A * eigen_B;
-  for (int i = 0; i < dim1; i++) {
-    for (int j = 0; j < dim3; j++) {
-      Arr2DIdxRowM(outC, dim1, dim3, i, j) = eigen_C(i, j);
-    }
-  }
+                            uint64_t *inB, uint64_t *outC, int threads) {
+  ring_gemm::matmul<uint64_t>(dim1, dim3, dim2, inA, inB, outC, false, false,
+                              false, 1, threads);
 }
 #endif
 
 void LinearOT::matmul_cleartext(int dim1, int dim2, int dim3, uint64_t *inA,
                                 uint64_t *inB, uint64_t *outC,
-                                bool accumulate) {
+                                bool accumulate, int threads) {
   if (!accumulate) {
     for (int i = 0; i < dim1; i++) {
       for (int j = 0; j < dim3; j++) {
@@ -157,7 +139,7 @@ void LinearOT::matmul_cleartext(int dim1, int dim2, int dim3, uint64_t *inA,
   }
 #else
   assert(accumulate == true && "Eigen not configured for accumulate = false");
-  matmul_cleartext_eigen(dim1, dim2, dim3, inA, inB, outC);
+  matmul_cleartext_eigen(dim1, dim2, dim3, inA, inB, outC, threads);
 #endif
 }
 
@@ -52,8 +52,11 @@ public:
                           uint64_t *outC);
 
   // Outputs the dim1*dim2*dim3 multiplications in inA*inB without accumulating
+  // (the product is computed with up to `threads` threads when accumulating;
+  // 0 uses all cores)
   void matmul_cleartext(int dim1, int dim2, int dim3, uint64_t *inA,
-                        uint64_t *inB, uint64_t *outC, bool accumulate = true);
+                        uint64_t *inB, uint64_t *outC, bool accumulate = true,
+                        int threads = 1);
 
   // Hadamard cross terms A0B1 + A1B0
   void hadamard_cross_terms(int32_t dim, uint64_t *inA, uint64_t *inB,
@@ -24,7 +24,7 @@ SOFTWARE.
 #include <iostream>
 
 #ifdef USE_EIGEN
-#include <Eigen/Dense>
+#include "utils/ring_gemm.h"
 #endif
 
 #include "OT/iknp.h"
@@ -67,32 +67,14 @@ public:
 
 #ifdef USE_EIGEN
   void ideal_func_eigen(int s1, int s2, int s3, const intType *A,
-                        const intType *B, intType *C) {
-    Eigen::Matrix<intType, Eigen::Dynamic, Eigen::Dynamic> eigen_a(s1, s2);
-    Eigen::Matrix<intType, Eigen::Dynamic, Eigen::Dynamic> eigen_b(s2, s3);
-    Eigen::Matrix<intType, Eigen::Dynamic, Eigen::Dynamic> eigen_c(s1, s3);
-
-    for (int i = 0; i < s1; i++) {
-      for (int j = 0; j < s2; j++) {
-        eigen_a(i, j) = Arr2DIdxRowM(A, s1, s2, i, j);
-      }
-    }
-    for (int i = 0; i < s2; i++) {
-      for (int j = 0; j < s3; j++) {
-        eigen_b(i, j) = Arr2DIdxRowM(B, s2, s3, i, j);
-      }
-    }
-    eigen_c = eigen_a * eigen_b;
-    for (int i = 0; i < s1; i++) {
-      for (int j = 0; j < s3; j++) {
-        Arr2DIdxRowM(C, s1, s3, i, j) = eigen_c(i, j);
-      }
-    }
+                        const intType *B, intType *C, int threads) {
+    ring_gemm::matmul<intType>(s1, s3, s2, A, B, C, false, false, false, 1,
+                               threads);
   }
 #endif
 
   void ideal_func(int s1, int s2, int s3, const intType *A, const intType *B,
-                  intType *C) {
+                  intType *C, int threads = 1) {
 #ifndef USE_EIGEN
     for (int i = 0; i < s1; i++) {
       for (int j = 0; j < s3; j++) {
@@ -104,7 +86,7 @@ public:
       }
     }
 #else
-    ideal_func_eigen(s1, s2, s3, A, B, C);
+    ideal_func_eigen(s1, s2, s3, A, B, C, threads);
 #endif
     for (int i = 0; i < s1 * s3; i++) {
       C[i] = C[i] & moduloMask;
@@ -26,6 +26,11 @@ using namespace sci;
 
 #define KKOT_LIMIT 8
 #define SQRT_LOOKUP_SCALE 2
+// sigmoid(GELU_C1 * x + GELU_C3 * x^3) saturates beyond |x| = GELU_CLAMP
+#define GELU_CLAMP 8
+#define SOFTMAX_GUARD_BITS 4
+#define GELU_C1 1.5957691216057308
+#define GELU_C3 0.0713548162726009
 
 MathFunctions::MathFunctions(int party, IOPack *iopack, OTPack *otpack) {
   this->party = party;
@@ -887,3 +892,405 @@ void MathFunctions::ReLU(int32_t dim, uint64_t *x, uint64_t *y, int32_t bw_x,
   delete[] tmp;
   delete[] tmp_msb;
 }
+
+void MathFunctions::row_max(int32_t rows, int32_t cols, uint64_t *x,
+                            uint64_t *y, int32_t bw_x) {
+  uint64_t mask_x = (bw_x == 64 ? -1 : ((1ULL << bw_x) - 1));
+  int32_t half = cols / 2;
+  uint64_t *curr = new uint64_t[rows * cols];
+  uint64_t *next = new uint64_t[rows * cols];
+  uint64_t *diff = new uint64_t[rows * half];
+  uint8_t *geq = new uint8_t[rows * half];
+  memcpy(curr, x, rows * cols * sizeof(uint64_t));
+
+  // All rows are reduced together, so every level of the tree costs a single
+  // MSB and multiplexer invocation irrespective of the number of rows
+  for (int32_t width = cols; width > 1; width -= half) {
+    half = width / 2;
+    // Element j is paired with element (width - half + j); for odd widths, the
+    // middle element is carried over to the next level as is
+    int32_t offset = width - half;
+    for (int i = 0; i < rows; i++) {
+      for (int j = 0; j < half; j++) {
+        diff[i * half + j] =
+            (curr[i * width + j] - curr[i * width + offset + j]) & mask_x;
+      }
+    }
+    aux->MSB(diff, geq, rows * half, bw_x);
+    if (party == ALICE) {
+      for (int i = 0; i < rows * half; i++) {
+        geq[i] ^= 1;
+      }
+    }
+    // max(a, b) = b + (a >= b) * (a - b)
+    aux->multiplexer(geq, diff, diff, rows * half, bw_x, bw_x);
+    for (int i = 0; i < rows; i++) {
+      for (int j = 0; j < half; j++) {
+        next[i * offset + j] =
+            (curr[i * width + offset + j] + diff[i * half + j]) & mask_x;
+      }
+      if (offset > half) {
+        next[i * offset + half] = curr[i * width + half];
+      }
+    }
+    std::swap(curr, next);
+  }
+  memcpy(y, curr, rows * sizeof(uint64_t));
+
+  delete[] curr;
+  delete[] next;
+  delete[] diff;
+  delete[] geq;
+}
+
+void MathFunctions::softmax(int32_t rows, int32_t cols, uint64_t *x,
+                            uint64_t *y, int32_t bw_x, int32_t bw_y,
+                            int32_t s_x, int32_t s_y) {
+  int32_t dim = rows * cols;
+  // The exponentials are rounded down and their errors add up in the row sum,
+  // so they carry SOFTMAX_GUARD_BITS more fractional bits than the output
+  int32_t s_exp = s_y + SOFTMAX_GUARD_BITS;
+  // exp(x - max) <= 1, so the row sum needs log(cols) bits on top
+  int32_t bw_sum = s_exp + 2 + ceil(log2(cols));
+  assert(bw_sum <= 64);
+  uint64_t mask_x = (bw_x == 64 ? -1 : ((1ULL << bw_x) - 1));
+  uint64_t mask_y = (bw_y == 64 ? -1 : ((1ULL << bw_y) - 1));
+  uint64_t mask_sum = (bw_sum == 64 ? -1 : ((1ULL << bw_sum) - 1));
+  uint64_t mask_exp_out = (1ULL << (s_exp + 2)) - 1;
+  uint8_t *zero_shares = new uint8_t[dim];
+  for (int i = 0; i < dim; i++) {
+    zero_shares[i] = 0;
+  }
+
+  // x_max: bw = bw_x, scale = s_x
+  uint64_t *x_max = new uint64_t[rows];
+  row_max(rows, cols, x, x_max, bw_x);
+
+  // tmp_1 = x - x_max (always non-positive)
+  uint64_t *tmp_1 = new uint64_t[dim];
+  uint64_t *tmp_2 = new uint64_t[dim];
+  for (int i = 0; i < dim; i++) {
+    tmp_1[i] = (x[i] - x_max[i / cols]) & mask_x;
+  }
+
+  // exp_x: bw = bw_sum, scale = s_exp
+  uint64_t *exp_x = new uint64_t[dim];
+  lookup_table_exp(dim, tmp_1, exp_x, bw_x, bw_sum, s_x, s_exp);
+
+  // sum: bw = bw_sum, scale = s_exp
+  // sum >= 1 as the maximum of every row contributes exp(0)
+  uint64_t *sum = new uint64_t[rows];
+  uint64_t *one = new uint64_t[rows];
+  for (int i = 0; i < rows; i++) {
+    sum[i] = 0;
+    for (int j = 0; j < cols; j++) {
+      sum[i] += exp_x[i * cols + j];
+    }
+    sum[i] &= mask_sum;
+    one[i] = (party == ALICE ? 1 : 0);
+  }
+  // inv_sum: bw = s_exp + 2, scale = s_exp
+  // Only one division per row; the row is normalized with a multiplication
+  uint64_t *inv_sum = new uint64_t[rows];
+  div(rows, one, sum, inv_sum, 2, bw_sum, s_exp + 2, 0, s_exp, s_exp, true,
+      true);
+
+  for (int i = 0; i < dim; i++) {
+    tmp_1[i] = exp_x[i] & mask_exp_out;
+    tmp_2[i] = inv_sum[i / cols];
+  }
+  // tmp_2: bw = s_y + 2, scale = s_y
+  mult->hadamard_product(dim, tmp_1, tmp_2, exp_x, s_exp + 2, s_exp + 2,
+                         2 * s_exp + 2, false, false, MultMode::None,
+                         zero_shares, zero_shares);
+  trunc->truncate_and_reduce(dim, exp_x, tmp_2, 2 * s_exp - s_y,
+                             2 * s_exp + 2);
+
+  if (bw_y <= (s_y + 2)) {
+    for (int i = 0; i < dim; i++) {
+      y[i] = tmp_2[i] & mask_y;
+    }
+  } else {
+    xt->z_extend(dim, tmp_2, y, s_y + 2, bw_y, zero_shares);
+  }
+
+  delete[] zero_shares;
+  delete[] x_max;
+  delete[] tmp_1;
+  delete[] tmp_2;
+  delete[] exp_x;
+  delete[] sum;
+  delete[] one;
+  delete[] inv_sum;
+}
+
+void MathFunctions::gelu(int32_t dim, uint64_t *x, uint64_t *y, int32_t bw_x,
+                         int32_t bw_y, int32_t s_x, int32_t s_y) {
+  // Scale of the public coefficients of the cubic
+  int32_t s_c = s_x;
+  // abs_x <= 8, x_sq <= 64, poly < 8, z < 50
+  int32_t bw_abs = s_x + 5;
+  int32_t bw_sq = s_x + 8;
+  int32_t bw_poly = s_x + s_c + 4;
+  int32_t bw_z = s_x + 9;
+  // sig is multiplied with |x| <= 8 before it is meaningful, so it carries
+  // three more fractional bits than the output
+  int32_t s_sig = s_y + 3;
+  int32_t bw_out = bw_x + s_y - s_x;
+  assert(bw_x >= bw_abs);
+  assert(bw_poly >= bw_sq);
+  assert((bw_abs + bw_poly) <= 64);
+  assert((bw_x + s_sig) <= 64);
+  uint64_t mask_x = (bw_x == 64 ? -1 : ((1ULL << bw_x) - 1));
+  uint64_t mask_z = (1ULL << bw_z) - 1;
+  uint64_t mask_poly = (1ULL << bw_poly) - 1;
+  uint64_t mask_sig = (1ULL << (s_sig + 2)) - 1;
+  uint8_t *zero_shares = new uint8_t[dim];
+  for (int i = 0; i < dim; i++) {
+    zero_shares[i] = 0;
+  }
+
+  // GELU(x) = x * sig, where sig = 1 - q for x >= 0 and sig = q otherwise,
+  // and q = sigmoid(-z(|x|)). Unlike sigmoid(z(x)), q is exactly 0 once the
+  // sigmoid saturates, so large inputs pass through without error
+  uint8_t *msb_x = new uint8_t[dim];
+  uint8_t *sel = new uint8_t[dim];
+  uint64_t *tmp_1 = new uint64_t[dim];
+  uint64_t *tmp_2 = new uint64_t[dim];
+  aux->MSB(x, msb_x, dim, bw_x);
+  // tmp_1 = |x| = x - msb_x * (2x)
+  for (int i = 0; i < dim; i++) {
+    tmp_2[i] = (-2 * x[i]) & mask_x;
+  }
+  aux->multiplexer(msb_x, tmp_2, tmp_1, dim, bw_x, bw_x);
+  // abs_x = min(|x|, 8): bw = bw_abs, scale = s_x
+  // Beyond the clamp q is already 0, so it only bounds the cubic's bitwidths
+  uint64_t clamp = uint64_t(GELU_CLAMP) << s_x;
+  for (int i = 0; i < dim; i++) {
+    tmp_1[i] = (tmp_1[i] + x[i] - (party == ALICE ? clamp : 0)) & mask_x;
+  }
+  aux->MSB(tmp_1, sel, dim, bw_x);
+  aux->multiplexer(sel, tmp_1, tmp_2, dim, bw_x, bw_x);
+  uint64_t *abs_x = new uint64_t[dim];
+  for (int i = 0; i < dim; i++) {
+    tmp_2[i] = (tmp_2[i] + (party == ALICE ? clamp : 0)) & mask_x;
+  }
+  aux->reduce(dim, tmp_2, abs_x, bw_x, bw_abs);
+
+  // x_sq: bw = bw_sq, scale = s_x
+  mult->hadamard_product(dim, abs_x, abs_x, tmp_1, bw_abs, bw_abs, 2 * bw_abs,
+                         false, false, MultMode::None, zero_shares,
+                         zero_shares);
+  trunc->truncate_and_reduce(dim, tmp_1, tmp_2, s_x, 2 * bw_abs);
+  aux->reduce(dim, tmp_2, tmp_2, 2 * bw_abs - s_x, bw_sq);
+
+  // poly = C1 + C3 * x_sq: bw = bw_poly, scale = s_x + s_c
+  uint64_t c1 = uint64_t(GELU_C1 * (1ULL << (s_x + s_c)));
+  uint64_t c3 = uint64_t(GELU_C3 * (1ULL << s_c));
+  uint64_t *poly = new uint64_t[dim];
+  xt->z_extend(dim, tmp_2, tmp_1, bw_sq, bw_poly, zero_shares);
+  for (int i = 0; i < dim; i++) {
+    poly[i] = (tmp_1[i] * c3 + (party == ALICE ? c1 : 0)) & mask_poly;
+  }
+
+  // z = abs_x * poly: bw = bw_z, scale = s_x
+  uint64_t *z = new uint64_t[dim];
+  mult->hadamard_product(dim, abs_x, poly, tmp_1, bw_abs, bw_poly,
+                         bw_abs + bw_poly, false, false, MultMode::None,
+                         zero_shares, zero_shares);
+  trunc->truncate_and_reduce(dim, tmp_1, z, s_x + s_c, bw_abs + bw_poly);
+  for (int i = 0; i < dim; i++) {
+    z[i] = (-1 * z[i]) & mask_z;
+  }
+
+  // q = sigmoid(-z) <= 1/2: bw = s_sig + 2, scale = s_sig
+  uint64_t *q = new uint64_t[dim];
+  sigmoid(dim, z, q, bw_z, s_sig + 2, s_x, s_sig);
+
+  // sig = q + (x >= 0) * (1 - 2q): bw = s_sig + 2, scale = s_sig
+  uint64_t *sig = new uint64_t[dim];
+  for (int i = 0; i < dim; i++) {
+    sel[i] = (party == ALICE ? msb_x[i] ^ 1 : msb_x[i]);
+    tmp_1[i] = ((party == ALICE ? 1ULL << s_sig : 0) - 2 * q[i]) & mask_sig;
+  }
+  aux->multiplexer(sel, tmp_1, sig, dim, s_sig + 2, s_sig + 2);
+  for (int i = 0; i < dim; i++) {
+    sig[i] = (sig[i] + q[i]) & mask_sig;
+  }
+
+  // tmp_2 = x * sig: bw = bw_out, scale = s_y
+  // Mixed mult with sig unsigned
+  mult->hadamard_product(dim, x, sig, tmp_1, bw_x, s_sig + 2, bw_x + s_sig,
+                         true, false, MultMode::None, msb_x, zero_shares);
+  trunc->truncate_and_reduce(dim, tmp_1, tmp_2, s_x + s_sig - s_y,
+                             bw_x + s_sig);
+  if (bw_y > bw_out) {
+    xt->s_extend(dim, tmp_2, y, bw_out, bw_y);
+  } else {
+    aux->reduce(dim, tmp_2, y, bw_out, bw_y);
+  }
+
+  delete[] zero_shares;
+  delete[] msb_x;
+  delete[] sel;
+  delete[] tmp_1;
+  delete[] tmp_2;
+  delete[] abs_x;
+  delete[] poly;
+  delete[] z;
+  delete[] q;
+  delete[] sig;
+}
+
+void MathFunctions::layer_norm(int32_t rows, int32_t cols, uint64_t *x,
+                               uint64_t *y, uint64_t *gamma, uint64_t *beta,
+                               int32_t bw_x, int32_t bw_y, int32_t s_x,
+                               int32_t s_y, double eps) {
+  assert(bw_x <= 32);
+  int32_t dim = rows * cols;
+  int32_t lg_cols = ceil(log2(cols));
+  int32_t half_lg_cols = ceil(lg_cols / 2.0);
+  uint64_t mask_x = (bw_x == 64 ? -1 : ((1ULL << bw_x) - 1));
+  uint64_t mask_y = (bw_y == 64 ? -1 : ((1ULL << bw_y) - 1));
+  uint8_t *zero_shares = new uint8_t[dim];
+  for (int i = 0; i < dim; i++) {
+    zero_shares[i] = 0;
+  }
+
+  // inv_cols = 2^(lg_cols + s_x)/cols: bw = bw_inv_cols, scale = lg_cols + s_x
+  // Public, so it is known to ALICE and BOB's share is 0
+  int32_t bw_inv_cols = s_x + 2;
+  uint64_t inv_cols_val = round(double(1ULL << (lg_cols + s_x)) / cols);
+  uint64_t *inv_cols = new uint64_t[cols];
+  for (int j = 0; j < cols; j++) {
+    inv_cols[j] = (party == ALICE ? inv_cols_val : 0);
+  }
+  // mean = (x . inv_cols) / 2^(lg_cols + s_x): bw = bw_x, scale = s_x
+  // The row sums are accumulated by the matrix product with the public
+  // inv_cols, which also takes care of extending x and returns the sums
+  // divided by 2^lg_cols
+  int32_t bw_mean = bw_x + bw_inv_cols;
+  assert((bw_mean + lg_cols) <= 64);
+  uint64_t *tmp_1 = new uint64_t[dim];
+  uint64_t *tmp_2 = new uint64_t[dim];
+  uint64_t *mean = new uint64_t[rows];
+  mult->matrix_multiplication(rows, cols, 1, x, inv_cols, tmp_1, bw_x,
+                              bw_inv_cols, bw_mean, true, false, true,
+                              MultMode::Alice_has_B);
+  trunc->truncate_and_reduce(rows, tmp_1, mean, s_x, bw_mean);
+
+  // centered = x - mean: bw = bw_x, scale = s_x
+  uint64_t *centered = new uint64_t[dim];
+  for (int i = 0; i < dim; i++) {
+    centered[i] = (x[i] - mean[i / cols]) & mask_x;
+  }
+
+  // sq = centered^2 < 2^(2*bw_x - 2): bw = bw_sq, scale = s_x
+  int32_t bw_sq = 2 * bw_x - 2 - s_x;
+  mult->hadamard_product(dim, centered, centered, tmp_1, bw_x, bw_x,
+                         2 * bw_x - 2, true, true, MultMode::None);
+  trunc->truncate_and_reduce(dim, tmp_1, tmp_2, s_x, 2 * bw_x - 2);
+  // var = (sum(sq) + cols * eps) / cols: bw = bw_var, scale = s_x + lg_cols
+  // The row sum is interpreted at scale s_x + lg_cols, which divides it by
+  // 2^lg_cols for free; the remaining factor cols/2^lg_cols is applied to
+  // the inverse standard deviation
+  int32_t bw_var = bw_sq + lg_cols + 1;
+  int32_t s_var = s_x + lg_cols;
+  assert(bw_var <= 64);
+  uint64_t mask_var = (bw_var == 64 ? -1 : ((1ULL << bw_var) - 1));
+  // At least one ulp, so that the inverse square root is always defined
+  double eps_var = eps * cols * (1ULL << s_x);
+  uint64_t eps_fixed = (eps_var < 1.0 ? 1 : uint64_t(round(eps_var)));
+  xt->z_extend(dim, tmp_2, tmp_1, bw_sq, bw_var, zero_shares);
+  uint64_t *var = new uint64_t[rows];
+  for (int i = 0; i < rows; i++) {
+    var[i] = (party == ALICE ? eps_fixed : 0);
+    for (int j = 0; j < cols; j++) {
+      var[i] += tmp_1[i * cols + j];
+    }
+    var[i] &= mask_var;
+  }
+
+  // inv_std = 1/sqrt(var): bw = bw_inv_std, scale = s_inv_std
+  // var >= eps_fixed/2^s_var bounds inv_std, and the scale of inv_std uses up
+  // whatever the final multiplication with centered leaves in 64 bits
+  double max_inv_std = std::sqrt(double(1ULL << s_var) / double(eps_fixed));
+  int32_t lg_inv_std = (max_inv_std > 1.0 ? ceil(log2(max_inv_std)) : 0);
+  // sqrt's lookup table takes at most 8 bits, which limits its scale to 28
+  int32_t s_inv_std = 64 - bw_x - lg_inv_std - 1;
+  s_inv_std = (s_inv_std > 28 ? 28 : s_inv_std);
+  s_inv_std = (s_inv_std > bw_var - 2 ? bw_var - 2 : s_inv_std);
+  int32_t bw_inv_std = s_inv_std + lg_inv_std + 1;
+  assert(s_inv_std >= s_y);
+  uint64_t *inv_std = new uint64_t[rows];
+  sqrt(rows, var, inv_std, bw_var, bw_inv_std, s_var, s_inv_std, true);
+  if (cols != (1 << lg_cols)) {
+    // inv_std = inv_std * sqrt(cols/2^lg_cols)
+    int32_t s_adjust = 63 - bw_inv_std;
+    s_adjust = (s_adjust > s_inv_std ? s_inv_std : s_adjust);
+    double sqrt_frac = std::sqrt(double(cols) / double(1ULL << lg_cols));
+    uint64_t adjust_val = round(sqrt_frac * (1ULL << s_adjust));
+    uint64_t *adjust = new uint64_t[rows];
+    for (int i = 0; i < rows; i++) {
+      adjust[i] = (party == ALICE ? adjust_val : 0);
+    }
+    mult->hadamard_product(rows, inv_std, adjust, tmp_1, bw_inv_std,
+                           s_adjust + 1, bw_inv_std + s_adjust + 1, false,
+                           false, MultMode::Alice_has_B);
+    trunc->truncate_and_reduce(rows, tmp_1, inv_std, s_adjust,
+                               bw_inv_std + s_adjust + 1);
+    aux->reduce(rows, inv_std, inv_std, bw_inv_std + 1, bw_inv_std);
+    delete[] adjust;
+  }
+
+  // norm = centered * inv_std: bw = bw_norm, scale = s_y
+  // |norm| <= sqrt(cols)
+  int32_t bw_prod = bw_x + bw_inv_std;
+  int32_t bw_norm = s_y + half_lg_cols + 2;
+  for (int i = 0; i < dim; i++) {
+    tmp_2[i] = inv_std[i / cols];
+  }
+  // Mixed mult with inv_std unsigned
+  mult->hadamard_product(dim, centered, tmp_2, tmp_1, bw_x, bw_inv_std,
+                         bw_prod, true, false, MultMode::None, nullptr,
+                         zero_shares);
+  trunc->truncate_and_reduce(dim, tmp_1, tmp_2, s_x + s_inv_std - s_y,
+                             bw_prod);
+  bw_prod -= s_x + s_inv_std - s_y;
+  if (bw_prod < bw_norm) {
+    bw_norm = bw_prod;
+  }
+  uint64_t *norm = new uint64_t[dim];
+  aux->reduce(dim, tmp_2, norm, bw_prod, bw_norm);
+
+  if (gamma != nullptr) {
+    assert((bw_norm + bw_y) <= 64);
+    // tmp_2 = norm * gamma: bw = bw_norm + bw_y - s_y, scale = s_y
+    for (int i = 0; i < dim; i++) {
+      tmp_1[i] = gamma[i % cols];
+    }
+    mult->hadamard_product(dim, norm, tmp_1, tmp_2, bw_norm, bw_y,
+                           bw_norm + bw_y, true, true, MultMode::None);
+    trunc->truncate_and_reduce(dim, tmp_2, tmp_1, s_y, bw_norm + bw_y);
+    aux->reduce(dim, tmp_1, y, bw_norm + bw_y - s_y, bw_y);
+  } else if (bw_y > bw_norm) {
+    xt->s_extend(dim, norm, y, bw_norm, bw_y);
+  } else {
+    aux->reduce(dim, norm, y, bw_norm, bw_y);
+  }
+  if (beta != nullptr) {
+    for (int i = 0; i < dim; i++) {
+      y[i] = (y[i] + beta[i % cols]) & mask_y;
+    }
+  }
+
+  delete[] zero_shares;
+  delete[] inv_cols;
+  delete[] tmp_1;
+  delete[] tmp_2;
+  delete[] mean;
+  delete[] centered;
+  delete[] var;
+  delete[] inv_std;
+  delete[] norm;
+}
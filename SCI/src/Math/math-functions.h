@@ -77,6 +77,28 @@ public:
   // bw_y = bw_x
   void ReLU(int32_t dim, uint64_t *x, uint64_t *y, int32_t bw_x,
             uint64_t six = 0);
+
+  // x is a (rows x cols) row-major matrix; y[i] = max_j x[i][j]
+  // Assumes |x| < 2^(bw_x - 2), so that pairwise differences don't wrap
+  void row_max(int32_t rows, int32_t cols, uint64_t *x, uint64_t *y,
+               int32_t bw_x);
+
+  // Row-wise softmax of the (rows x cols) row-major matrix x
+  // Assumes |x| < 2^(bw_x - 2)
+  void softmax(int32_t rows, int32_t cols, uint64_t *x, uint64_t *y,
+               int32_t bw_x, int32_t bw_y, int32_t s_x, int32_t s_y);
+
+  // GELU in its tanh form: x * sigmoid(1.5957691 * x + 0.0713548 * x^3)
+  void gelu(int32_t dim, uint64_t *x, uint64_t *y, int32_t bw_x, int32_t bw_y,
+            int32_t s_x, int32_t s_y);
+
+  // Normalizes every row of the (rows x cols) row-major matrix x to zero mean
+  // and unit variance, followed by the optional affine transform
+  // gamma[j] * y + beta[j]; gamma and beta have bitwidth bw_y and scale s_y.
+  // Assumes |x| < 2^(bw_x - 2) and bw_x <= 32
+  void layer_norm(int32_t rows, int32_t cols, uint64_t *x, uint64_t *y,
+                  uint64_t *gamma, uint64_t *beta, int32_t bw_x, int32_t bw_y,
+                  int32_t s_x, int32_t s_y, double eps = 1e-5);
 };
 
 #endif
@@ -22,6 +22,7 @@ SOFTWARE.
 #ifndef TRIPLE_GENERATOR_H__
 #define TRIPLE_GENERATOR_H__
 #include "OT/ot_pack.h"
+#include "utils/arena.h"
 
 enum TripleGenMethod {
   Ideal,          // (Insecure) Ideal Functionality
@@ -37,8 +38,12 @@ public:
   uint8_t *bi;
   uint8_t *ci;
   int num_triples, num_bytes, offset;
+  bool owned;
 
-  Triple(int num_triples, bool packed = false, int offset = 0) {
+  // If arena is provided, the shares are carved out of it and remain valid
+  // until the arena is reset
+  Triple(int num_triples, bool packed = false, int offset = 0,
+         sci::ScratchArena *arena = nullptr) {
     assert((offset < num_triples) || (num_triples == 0));
     this->num_triples = num_triples;
     this->packed = packed;
@@ -53,15 +58,24 @@ public:
     else
       this->offset = offset;
     assert((num_triples % this->offset) == 0);
-    this->ai = new uint8_t[num_bytes];
-    this->bi = new uint8_t[num_bytes];
-    this->ci = new uint8_t[num_bytes];
+    this->owned = (arena == nullptr);
+    if (owned) {
+      this->ai = new uint8_t[num_bytes];
+      this->bi = new uint8_t[num_bytes];
+      this->ci = new uint8_t[num_bytes];
+    } else {
+      this->ai = arena->alloc<uint8_t>(num_bytes);
+      this->bi = arena->alloc<uint8_t>(num_bytes);
+      this->ci = arena->alloc<uint8_t>(num_bytes);
+    }
   }
 
   ~Triple() {
-    delete[] ai;
-    delete[] bi;
-    delete[] ci;
+    if (owned) {
+      delete[] ai;
+      delete[] bi;
+      delete[] ci;
+    }
   }
 };
 
@@ -71,6 +85,8 @@ public:
   sci::OTPack *otpack;
   sci::PRG128 *prg;
   int party;
+  // scratch space for generate(); reset on every call
+  sci::ScratchArena arena;
 
   TripleGenerator(int party, sci::IOPack *iopack, sci::OTPack *otpack) {
     this->iopack = iopack;
@@ -85,13 +101,14 @@ public:
                 int offset = 1) {
     if (!num_triples)
       return;
+    arena.reset();
     switch (method) {
     case Ideal: {
       int num_bytes = ceil((double)num_triples / 8);
       if (party == sci::ALICE) {
-        uint8_t *a = new uint8_t[num_bytes];
-        uint8_t *b = new uint8_t[num_bytes];
-        uint8_t *c = new uint8_t[num_bytes];
+        uint8_t *a = arena.alloc<uint8_t>(num_bytes);
+        uint8_t *b = arena.alloc<uint8_t>(num_bytes);
+        uint8_t *c = arena.alloc<uint8_t>(num_bytes);
         if (packed) {
           prg->random_data(ai, num_bytes);
           prg->random_data(bi, num_bytes);
@@ -128,18 +145,15 @@ public:
         iopack->io->send_data(a, num_bytes);
         iopack->io->send_data(b, num_bytes);
         iopack->io->send_data(c, num_bytes);
-        delete[] a;
-        delete[] b;
-        delete[] c;
       } else {
         if (packed) {
           iopack->io->recv_data(ai, num_bytes);
           iopack->io->recv_data(bi, num_bytes);
           iopack->io->recv_data(ci, num_bytes);
         } else {
-          uint8_t *a = new uint8_t[num_bytes];
-          uint8_t *b = new uint8_t[num_bytes];
-          uint8_t *c = new uint8_t[num_bytes];
+          uint8_t *a = arena.alloc<uint8_t>(num_bytes);
+          uint8_t *b = arena.alloc<uint8_t>(num_bytes);
+          uint8_t *c = arena.alloc<uint8_t>(num_bytes);
           iopack->io->recv_data(a, num_bytes);
           iopack->io->recv_data(b, num_bytes);
           iopack->io->recv_data(c, num_bytes);
@@ -155,9 +169,6 @@ public:
               sci::uint8_to_bool(ci + i, c[i / 8], num_triples - i);
             }
           }
-          delete[] a;
-          delete[] b;
-          delete[] c;
         }
       }
       break;
@@ -170,9 +181,9 @@ public:
       assert((num_triples & 1) == 0); // num_triples is even
       uint8_t *a, *b, *c;
       if (packed) {
-        a = new uint8_t[num_triples];
-        b = new uint8_t[num_triples];
-        c = new uint8_t[num_triples];
+        a = arena.alloc<uint8_t>(num_triples);
+        b = arena.alloc<uint8_t>(num_triples);
+        c = arena.alloc<uint8_t>(num_triples);
       } else {
         a = ai;
         b = bi;
@@ -184,9 +195,7 @@ public:
       case sci::ALICE: {
         prg->random_bool((bool *)c, num_triples);
         uint8_t **ot_messages; // (num_triples/2) X 16
-        ot_messages = new uint8_t *[num_triples / 2];
-        for (int i = 0; i < num_triples; i += 2)
-          ot_messages[i / 2] = new uint8_t[16];
+        ot_messages = arena.alloc_2d<uint8_t>(num_triples / 2, 16);
         for (int j = 0; j < 16; j++) {
           uint8_t bits_j[4]; // a01 || b01 || a11 || b11 (LSB->MSB)
           sci::uint8_to_bool(bits_j, j, 4);
@@ -199,14 +208,11 @@ public:
         }
         // otpack->kkot_16->send(ot_messages, num_triples/2, 2);
         otpack->kkot[3]->send(ot_messages, num_triples / 2, 2);
-        for (int i = 0; i < num_triples; i += 2)
-          delete[] ot_messages[i / 2];
-        delete[] ot_messages;
         break;
       }
       case sci::BOB: {
-        uint8_t *ot_selection = new uint8_t[(size_t)num_triples / 2];
-        uint8_t *ot_result = new uint8_t[(size_t)num_triples / 2];
+        uint8_t *ot_selection = arena.alloc<uint8_t>((size_t)num_triples / 2);
+        uint8_t *ot_result = arena.alloc<uint8_t>((size_t)num_triples / 2);
         for (int i = 0; i < num_triples; i += 2) {
           ot_selection[i / 2] =
               (b[i + 1] << 3) | (a[i + 1] << 2) | (b[i] << 1) | a[i];
@@ -217,8 +223,6 @@ public:
           c[i] = ot_result[i / 2] & 1;
           c[i + 1] = ot_result[i / 2] >> 1;
         }
-        delete[] ot_selection;
-        delete[] ot_result;
         break;
       }
       }
@@ -228,9 +232,6 @@ public:
           bi[i / 8] = sci::bool_to_uint8(b + i, 8);
           ci[i / 8] = sci::bool_to_uint8(c + i, 8);
         }
-        delete[] a;
-        delete[] b;
-        delete[] c;
       }
       break;
     }
@@ -238,9 +239,9 @@ public:
       assert((num_triples & 1) == 0); // num_triples is even
       uint8_t *a, *b, *c;
       if (packed) {
-        a = new uint8_t[num_triples];
-        b = new uint8_t[num_triples];
-        c = new uint8_t[num_triples];
+        a = arena.alloc<uint8_t>(num_triples);
+        b = arena.alloc<uint8_t>(num_triples);
+        c = arena.alloc<uint8_t>(num_triples);
       } else {
         a = ai;
         b = bi;
@@ -255,9 +256,7 @@ public:
       case sci::ALICE: {
         prg->random_bool((bool *)c, num_triples);
         uint8_t **ot_messages; // (num_triples/2) X 8
-        ot_messages = new uint8_t *[num_triples / 2];
-        for (int i = 0; i < num_triples; i += 2)
-          ot_messages[i / 2] = new uint8_t[8];
+        ot_messages = arena.alloc_2d<uint8_t>(num_triples / 2, 8);
         for (int j = 0; j < 8; j++) {
           uint8_t bits_j[3]; // a01 || b01 || b11 (LSB->MSB)
           sci::uint8_to_bool(bits_j, j, 3);
@@ -274,14 +273,11 @@ public:
         }
         // otpack->kkot_8->send(ot_messages, num_triples/2, 2);
         otpack->kkot[2]->send(ot_messages, num_triples / 2, 2);
-        for (int i = 0; i < num_triples; i += 2)
-          delete[] ot_messages[i / 2];
-        delete[] ot_messages;
         break;
       }
       case sci::BOB: {
-        uint8_t *ot_selection = new uint8_t[(size_t)num_triples / 2];
-        uint8_t *ot_result = new uint8_t[(size_t)num_triples / 2];
+        uint8_t *ot_selection = arena.alloc<uint8_t>((size_t)num_triples / 2);
+        uint8_t *ot_result = arena.alloc<uint8_t>((size_t)num_triples / 2);
         for (int i = 0; i < num_triples; i += 2 * offset) {
           for (int k = 0; k < offset; k++)
             ot_selection[i / 2 + k] =
@@ -295,8 +291,6 @@ public:
             c[i + offset + k] = ot_result[i / 2 + k] >> 1;
           }
         }
-        delete[] ot_selection;
-        delete[] ot_result;
         break;
       }
       }
@@ -306,9 +300,6 @@ public:
           bi[i / 8] = sci::bool_to_uint8(b + i, 8);
           ci[i / 8] = sci::bool_to_uint8(c + i, 8);
         }
-        delete[] a;
-        delete[] b;
-        delete[] c;
       }
       break;
     }
@@ -40,6 +40,9 @@ public:
   int num_digits, num_triples_corr, num_triples_std, log_num_digits;
   int num_triples;
   uint8_t mask_beta, mask_r;
+  // scratch space for compare() and traverse_and_compute_ANDs(); reset on
+  // every compare() call, callers of the latter use reset_scratch()
+  sci::ScratchArena arena;
 
   MillionaireProtocol(int party, sci::IOPack *iopack, sci::OTPack *otpack,
                       int bitlength = 32, int radix_base = MILL_PARAM) {
@@ -73,50 +76,41 @@ public:
 
   ~MillionaireProtocol() { delete triple_gen; }
 
+  void reset_scratch() { arena.reset(); }
+
   void compare(uint8_t *res, uint64_t *data, int num_cmps, int bitlength,
                bool greater_than = true, bool equality = false,
                int radix_base = MILL_PARAM) {
     configure(bitlength, radix_base);
+    arena.reset();
 
     if (bitlength <= beta) {
-      uint8_t N = 1 << bitlength;
+      int N = 1 << bitlength;
       uint8_t mask = N - 1;
+      uint8_t *choice = arena.alloc<uint8_t>(num_cmps);
+      for (int i = 0; i < num_cmps; i++) {
+        choice[i] = data[i] & mask;
+      }
       if (party == sci::ALICE) {
         sci::PRG128 prg;
         prg.random_data(res, num_cmps * sizeof(uint8_t));
-        uint8_t **leaf_messages = new uint8_t *[num_cmps];
         for (int i = 0; i < num_cmps; i++) {
           res[i] &= 1;
-          leaf_messages[i] = new uint8_t[N];
-          for (int j = 0; j < N; j++) {
-            if (greater_than) {
-              leaf_messages[i][j] = ((uint8_t(data[i] & mask) > j) ^ res[i]);
-            } else {
-              leaf_messages[i][j] = ((uint8_t(data[i] & mask) < j) ^ res[i]);
-            }
-          }
         }
+        uint8_t **leaf_messages = arena.alloc_2d<uint8_t>(num_cmps, N);
+        set_leaf_ot_messages_batch(leaf_messages[0], choice, num_cmps, N, res,
+                                   nullptr, greater_than, false);
         if (bitlength > 1) {
           otpack->kkot[bitlength - 1]->send(leaf_messages, num_cmps, 1);
         } else {
           otpack->iknp_straight->send(leaf_messages, num_cmps, 1);
         }
-
-        for (int i = 0; i < num_cmps; i++)
-          delete[] leaf_messages[i];
-        delete[] leaf_messages;
       } else { // party == BOB
-        uint8_t *choice = new uint8_t[num_cmps];
-        for (int i = 0; i < num_cmps; i++) {
-          choice[i] = data[i] & mask;
-        }
         if (bitlength > 1) {
           otpack->kkot[bitlength - 1]->recv(res, choice, num_cmps, 1);
         } else {
           otpack->iknp_straight->recv(res, choice, num_cmps, 1);
         }
-
-        delete[] choice;
       }
       return;
     }
@@ -129,7 +123,7 @@ public:
     if (old_num_cmps == num_cmps)
       data_ext = data;
     else {
-      data_ext = new uint64_t[num_cmps];
+      data_ext = arena.alloc<uint64_t>(num_cmps);
       memcpy(data_ext, data, old_num_cmps * sizeof(uint64_t));
       memset(data_ext + old_num_cmps, 0,
              (num_cmps - old_num_cmps) * sizeof(uint64_t));
@@ -139,9 +133,9 @@ public:
     uint8_t *leaf_res_cmp; // num_digits * num_cmps
     uint8_t *leaf_res_eq;  // num_digits * num_cmps
 
-    digits = new uint8_t[num_digits * num_cmps];
-    leaf_res_cmp = new uint8_t[num_digits * num_cmps];
-    leaf_res_eq = new uint8_t[num_digits * num_cmps];
+    digits = arena.alloc<uint8_t>(num_digits * num_cmps);
+    leaf_res_cmp = arena.alloc<uint8_t>(num_digits * num_cmps);
+    leaf_res_eq = arena.alloc<uint8_t>(num_digits * num_cmps);
 
     // Extract radix-digits from data
     for (int i = 0; i < num_digits; i++) // Stored from LSB to MSB
@@ -156,40 +150,36 @@ public:
     if (party == sci::ALICE) {
       uint8_t *
           *leaf_ot_messages; // (num_digits * num_cmps) X beta_pow (=2^beta)
-      leaf_ot_messages = new uint8_t *[num_digits * num_cmps];
-      for (int i = 0; i < num_digits * num_cmps; i++)
-        leaf_ot_messages[i] = new uint8_t[beta_pow];
+      leaf_ot_messages =
+          arena.alloc_2d<uint8_t>(num_digits * num_cmps, beta_pow);
 
       // Set Leaf OT messages
       triple_gen->prg->random_bool((bool *)leaf_res_cmp, num_digits * num_cmps);
       triple_gen->prg->random_bool((bool *)leaf_res_eq, num_digits * num_cmps);
-      for (int i = 0; i < num_digits; i++) {
-        for (int j = 0; j < num_cmps; j++) {
-          if (i == 0) {
-            set_leaf_ot_messages(leaf_ot_messages[i * num_cmps + j],
-                                 digits[i * num_cmps + j], beta_pow,
-                                 leaf_res_cmp[i * num_cmps + j], 0,
-                                 greater_than, false);
-          } else if (i == (num_digits - 1) && (r > 0)) {
+      // The LSB digit only needs the comparison bit; for the MSB digit, only
+      // the first 2^r messages are meaningful, but under WAN_EXEC all digits
+      // share a single 1oo2^beta KKOT
+      set_leaf_ot_messages_batch(leaf_ot_messages[0], digits, num_cmps,
+                                 beta_pow, leaf_res_cmp, nullptr, greater_than,
+                                 false);
 #ifdef WAN_EXEC
-            set_leaf_ot_messages(leaf_ot_messages[i * num_cmps + j],
-                                 digits[i * num_cmps + j], beta_pow,
-                                 leaf_res_cmp[i * num_cmps + j],
-                                 leaf_res_eq[i * num_cmps + j], greater_than);
+      int num_full_digits = num_digits - 1;
 #else
-            set_leaf_ot_messages(leaf_ot_messages[i * num_cmps + j],
-                                 digits[i * num_cmps + j], 1 << r,
-                                 leaf_res_cmp[i * num_cmps + j],
-                                 leaf_res_eq[i * num_cmps + j], greater_than);
-#endif
-          } else {
-            set_leaf_ot_messages(leaf_ot_messages[i * num_cmps + j],
-                                 digits[i * num_cmps + j], beta_pow,
-                                 leaf_res_cmp[i * num_cmps + j],
-                                 leaf_res_eq[i * num_cmps + j], greater_than);
-          }
+      int num_full_digits = (r > 0) ? num_digits - 2 : num_digits - 1;
+      if (r > 0) {
+        int i = num_digits - 1;
+        for (int j = 0; j < num_cmps; j++) {
+          set_leaf_ot_messages(leaf_ot_messages[i * num_cmps + j],
+                               digits[i * num_cmps + j], 1 << r,
+                               leaf_res_cmp[i * num_cmps + j],
+                               leaf_res_eq[i * num_cmps + j], greater_than);
         }
       }
+#endif
+      set_leaf_ot_messages_batch(
+          leaf_ot_messages[num_cmps], digits + num_cmps,
+          num_full_digits * num_cmps, beta_pow, leaf_res_cmp + num_cmps,
+          leaf_res_eq + num_cmps, greater_than);
 
       // Perform Leaf OTs
 #ifdef WAN_EXEC
@@ -220,10 +210,6 @@ public:
                                      num_cmps * (num_digits - 1), 2);
       }
 #endif
-      // Cleanup
-      for (int i = 0; i < num_digits * num_cmps; i++)
-        delete[] leaf_ot_messages[i];
-      delete[] leaf_ot_messages;
     } else // party = sci::BOB
     {
       // Perform Leaf OTs
@@ -270,13 +256,6 @@ public:
 
     for (int i = 0; i < old_num_cmps; i++)
       res[i] = leaf_res_cmp[i];
-
-    // Cleanup
-    if (old_num_cmps != num_cmps)
-      delete[] data_ext;
-    delete[] digits;
-    delete[] leaf_res_cmp;
-    delete[] leaf_res_eq;
   }
 
   void set_leaf_ot_messages(uint8_t *ot_messages, uint8_t digit, int N,
@@ -294,6 +273,89 @@ public:
     }
   }
 
+  // Batched version of set_leaf_ot_messages for n digits. ot_messages is a
+  // flat n X N table (N = 2^bits) whose i-th row holds the N messages for
+  // digits[i]. mask_eq is only read if eq is true.
+  void set_leaf_ot_messages_batch(uint8_t *ot_messages, const uint8_t *digits,
+                                  int n, int N, const uint8_t *mask_cmp,
+                                  const uint8_t *mask_eq, bool greater_than,
+                                  bool eq = true) {
+    int i = 0;
+#ifdef __AVX2__
+    const __m256i zero = _mm256_setzero_si256();
+    if (N >= 32) {
+      const __m256i iota = _mm256_setr_epi8(
+          0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+          20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+      for (; i < n; i++) {
+        __m256i d = _mm256_set1_epi8((char)digits[i]);
+        __m256i mc = _mm256_set1_epi8((char)mask_cmp[i]);
+        __m256i me = eq ? _mm256_set1_epi8((char)mask_eq[i]) : zero;
+        for (int j = 0; j < N; j += 32) {
+          __m256i idx = _mm256_add_epi8(iota, _mm256_set1_epi8((char)j));
+          _mm256_storeu_si256(
+              (__m256i *)(ot_messages + (size_t)i * N + j),
+              leaf_ot_messages_avx2(d, idx, mc, me, greater_than, eq));
+        }
+      }
+    } else if (N >= 2) {
+      // Each vector holds the tables of k = 32/N consecutive digits: lane l
+      // is message (l % N) of digit (l / N). Digits and masks are broadcast
+      // to their lanes with a byte shuffle over a 16-byte load.
+      const int k = 32 / N;
+      alignas(32) uint8_t lane_digit[32], lane_msg[32];
+      for (int l = 0; l < 32; l++) {
+        lane_digit[l] = l / N;
+        lane_msg[l] = l % N;
+      }
+      const __m256i sel = _mm256_load_si256((const __m256i *)lane_digit);
+      const __m256i idx = _mm256_load_si256((const __m256i *)lane_msg);
+      auto spread = [&sel](const uint8_t *x) {
+        return _mm256_shuffle_epi8(
+            _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)x)),
+            sel);
+      };
+      for (; i + 16 <= n; i += k) {
+        __m256i d = spread(digits + i);
+        __m256i mc = spread(mask_cmp + i);
+        __m256i me = eq ? spread(mask_eq + i) : zero;
+        _mm256_storeu_si256(
+            (__m256i *)(ot_messages + (size_t)i * N),
+            leaf_ot_messages_avx2(d, idx, mc, me, greater_than, eq));
+      }
+    }
+#endif
+    for (; i < n; i++) {
+      set_leaf_ot_messages(ot_messages + (size_t)i * N, digits[i], N,
+                           mask_cmp[i], (eq ? mask_eq[i] : 0), greater_than,
+                           eq);
+    }
+  }
+
+#ifdef __AVX2__
+  // Leaf messages for 32 (digit, index) pairs; masks are 0/1 bytes
+  static inline __m256i leaf_ot_messages_avx2(__m256i digit, __m256i idx,
+                                              __m256i mask_cmp,
+                                              __m256i mask_eq,
+                                              bool greater_than, bool eq) {
+    // unsigned byte comparison via signed comparison on MSB-flipped inputs
+    const __m256i msb = _mm256_set1_epi8((char)0x80);
+    const __m256i one = _mm256_set1_epi8(1);
+    __m256i d = _mm256_xor_si256(digit, msb);
+    __m256i x = _mm256_xor_si256(idx, msb);
+    __m256i cmp =
+        greater_than ? _mm256_cmpgt_epi8(d, x) : _mm256_cmpgt_epi8(x, d);
+    __m256i res = _mm256_xor_si256(_mm256_and_si256(cmp, one), mask_cmp);
+    if (eq) {
+      __m256i res_eq = _mm256_and_si256(_mm256_cmpeq_epi8(digit, idx), one);
+      // res is 0/1 per byte, so a 16-bit shift does not cross bytes
+      res = _mm256_or_si256(_mm256_slli_epi16(res, 1),
+                            _mm256_xor_si256(res_eq, mask_eq));
+    }
+    return res;
+  }
+#endif
+
   /**************************************************************************************************
    *                         AND computation related functions
    **************************************************************************************************/
@@ -301,10 +363,10 @@ public:
   void traverse_and_compute_ANDs(int num_cmps, uint8_t *leaf_res_eq,
                                  uint8_t *leaf_res_cmp) {
 #ifdef WAN_EXEC
-    Triple triples_std((num_triples)*num_cmps, true);
+    Triple triples_std((num_triples)*num_cmps, true, 0, &arena);
 #else
-    Triple triples_corr(num_triples_corr * num_cmps, true, num_cmps);
-    Triple triples_std(num_triples_std * num_cmps, true);
+    Triple triples_corr(num_triples_corr * num_cmps, true, num_cmps, &arena);
+    Triple triples_std(num_triples_std * num_cmps, true, 0, &arena);
 #endif
     // Generate required Bit-Triples
 #ifdef WAN_EXEC
@@ -320,10 +382,10 @@ public:
     int counter_std = 0, old_counter_std = 0;
     int counter_corr = 0, old_counter_corr = 0;
     int counter_combined = 0, old_counter_combined = 0;
-    uint8_t *ei = new uint8_t[(num_triples * num_cmps) / 8];
-    uint8_t *fi = new uint8_t[(num_triples * num_cmps) / 8];
-    uint8_t *e = new uint8_t[(num_triples * num_cmps) / 8];
-    uint8_t *f = new uint8_t[(num_triples * num_cmps) / 8];
+    uint8_t *ei = arena.alloc<uint8_t>((num_triples * num_cmps) / 8);
+    uint8_t *fi = arena.alloc<uint8_t>((num_triples * num_cmps) / 8);
+    uint8_t *e = arena.alloc<uint8_t>((num_triples * num_cmps) / 8);
+    uint8_t *f = arena.alloc<uint8_t>((num_triples * num_cmps) / 8);
 
     for (int i = 1; i < num_digits; i *= 2) {
       for (int j = 0; j < num_digits and j + i < num_digits; j += 2 * i) {
@@ -517,12 +579,6 @@ public:
     assert(counter_std == num_triples_std);
     assert(2 * counter_corr == num_triples_corr);
 #endif
-
-    // cleanup
-    delete[] ei;
-    delete[] fi;
-    delete[] e;
-    delete[] f;
   }
 
   void AND_step_1(uint8_t *ei, // evaluates batch of 8 ANDs
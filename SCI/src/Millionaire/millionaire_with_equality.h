@@ -72,35 +72,37 @@ public:
   void bitlen_lt_beta(uint8_t *res_cmp, uint8_t *res_eq, uint64_t *data,
                       int num_cmps, int bitlength, bool greater_than = true,
                       int radix_base = MILL_PARAM) {
-    uint8_t N = 1 << bitlength;
+    int N = 1 << bitlength;
     uint8_t mask = N - 1;
+    uint8_t *choice = new uint8_t[num_cmps];
+    for (int i = 0; i < num_cmps; i++) {
+      choice[i] = data[i] & mask;
+    }
     if (party == sci::ALICE) {
       sci::PRG128 prg;
       prg.random_data(res_cmp, num_cmps * sizeof(uint8_t));
       prg.random_data(res_eq, num_cmps * sizeof(uint8_t));
-      uint8_t **leaf_messages = new uint8_t *[num_cmps];
       for (int i = 0; i < num_cmps; i++) {
         res_cmp[i] &= 1;
         res_eq[i] &= 1;
-        leaf_messages[i] = new uint8_t[N];
-        this->mill->set_leaf_ot_messages(leaf_messages[i], (data[i] & mask), N,
-                                         res_cmp[i], res_eq[i], greater_than,
-                                         true);
       }
+      uint8_t *leaf_messages_flat = new uint8_t[(size_t)num_cmps * N];
+      uint8_t **leaf_messages = new uint8_t *[num_cmps];
+      for (int i = 0; i < num_cmps; i++) {
+        leaf_messages[i] = leaf_messages_flat + (size_t)i * N;
+      }
+      this->mill->set_leaf_ot_messages_batch(leaf_messages_flat, choice,
+                                             num_cmps, N, res_cmp, res_eq,
+                                             greater_than, true);
       if (bitlength > 1) {
         otpack->kkot[bitlength - 1]->send(leaf_messages, num_cmps, 2);
       } else {
         otpack->iknp_straight->send(leaf_messages, num_cmps, 2);
       }
 
-      for (int i = 0; i < num_cmps; i++)
-        delete[] leaf_messages[i];
+      delete[] leaf_messages_flat;
       delete[] leaf_messages;
     } else { // party == BOB
-      uint8_t *choice = new uint8_t[num_cmps];
-      for (int i = 0; i < num_cmps; i++) {
-        choice[i] = data[i] & mask;
-      }
       if (bitlength > 1) {
         otpack->kkot[bitlength - 1]->recv(res_cmp, choice, num_cmps, 2);
       } else {
@@ -110,8 +112,8 @@ public:
         res_eq[i] = res_cmp[i] & 1;
         res_cmp[i] >>= 1;
       }
-      delete[] choice;
     }
+    delete[] choice;
     return;
   }
 
@@ -164,27 +166,31 @@ public:
     if (party == sci::ALICE) {
       uint8_t *
           *leaf_ot_messages; // (num_digits * num_cmps) X beta_pow (=2^beta)
+      // Digits with a full radix take beta_pow messages each; the MSB digit
+      // takes 2^r messages if r > 0. Rows are laid out back to back.
+      int num_full_digits = (r > 0) ? num_digits - 1 : num_digits;
+      int N_last = (r > 0) ? (1 << r) : beta_pow;
+      size_t full_size = (size_t)num_full_digits * num_cmps * beta_pow;
+      uint8_t *leaf_ot_messages_flat =
+          new uint8_t[full_size + (r > 0 ? (size_t)num_cmps * N_last : 0)];
       leaf_ot_messages = new uint8_t *[num_digits * num_cmps];
-      for (int i = 0; i < num_digits * num_cmps; i++)
-        leaf_ot_messages[i] = new uint8_t[beta_pow];
+      for (int i = 0; i < num_full_digits * num_cmps; i++)
+        leaf_ot_messages[i] = leaf_ot_messages_flat + (size_t)i * beta_pow;
+      for (int i = 0; (r > 0) && (i < num_cmps); i++)
+        leaf_ot_messages[num_full_digits * num_cmps + i] =
+            leaf_ot_messages_flat + full_size + (size_t)i * N_last;
 
       // Set Leaf OT messages
       triple_gen->prg->random_bool((bool *)leaf_res_cmp, num_digits * num_cmps);
       triple_gen->prg->random_bool((bool *)leaf_res_eq, num_digits * num_cmps);
-      for (int i = 0; i < num_digits; i++) {
-        for (int j = 0; j < num_cmps; j++) {
-          if (i == (num_digits - 1) && (r > 0)) {
-            this->mill->set_leaf_ot_messages(
-                leaf_ot_messages[i * num_cmps + j], digits[i * num_cmps + j],
-                1ULL << r, leaf_res_cmp[i * num_cmps + j],
-                leaf_res_eq[i * num_cmps + j], greater_than);
-          } else {
-            this->mill->set_leaf_ot_messages(
-                leaf_ot_messages[i * num_cmps + j], digits[i * num_cmps + j],
-                beta_pow, leaf_res_cmp[i * num_cmps + j],
-                leaf_res_eq[i * num_cmps + j], greater_than);
-          }
-        }
+      this->mill->set_leaf_ot_messages_batch(
+          leaf_ot_messages_flat, digits, num_full_digits * num_cmps, beta_pow,
+          leaf_res_cmp, leaf_res_eq, greater_than);
+      if (r > 0) {
+        int offset = num_full_digits * num_cmps;
+        this->mill->set_leaf_ot_messages_batch(
+            leaf_ot_messages_flat + full_size, digits + offset, num_cmps,
+            N_last, leaf_res_cmp + offset, leaf_res_eq + offset, greater_than);
       }
 
       // Perform Leaf OTs with comparison and equality
@@ -209,8 +215,7 @@ public:
       }
 
       // Cleanup
-      for (int i = 0; i < num_digits * num_cmps; i++)
-        delete[] leaf_ot_messages[i];
+      delete[] leaf_ot_messages_flat;
       delete[] leaf_ot_messages;
     } else // party = sci::BOB
     {
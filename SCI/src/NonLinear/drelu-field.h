@@ -270,6 +270,7 @@ public:
 
     // Generate required Bit-Triples and traverse tree to compute the results of
     // comparsions
+    millionaire->reset_scratch();
     millionaire->traverse_and_compute_ANDs(num_cmps, leaf_res_eq, leaf_res_cmp);
 
     if (party == sci::ALICE) {
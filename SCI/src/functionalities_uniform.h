@@ -209,6 +209,13 @@ void funcReLUThread(int tid, intType *outp, intType *inp, int numRelu,
   reluArr[tid]->relu(outp, inp, numRelu, drelu_res, skip_ot);
 }
 
+#ifdef SCI_OT
+void funcReluTruncateThread(int tid, intType *outp, intType *inp, int size,
+                            int sf) {
+  truncationArr[tid]->relu_truncate(size, inp, outp, sf, bitlength);
+}
+#endif
+
 void funcMaxpoolThread(int tid, int rows, int cols, intType *inpArr,
                        intType *maxi, intType *maxiIdx) {
   maxpoolArr[tid]->funcMaxMPC(rows, cols, inpArr, maxi, maxiIdx);
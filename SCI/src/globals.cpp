@@ -38,6 +38,8 @@ MaxPoolProtocol<intType> *maxpool;
 // Additional classes for Athos
 #ifdef SCI_OT
 MatMulUniform<sci::NetIO, intType, sci::IKNP<sci::NetIO>> *multUniform;
+LinearCostModel *linearCostModel = nullptr;
+LinearRing *he_ring = nullptr;
 #endif
 #ifdef SCI_HE
 ConvField *he_conv;
@@ -30,12 +30,15 @@ SOFTWARE.
 #include "NonLinear/relu-interface.h"
 #include "defines.h"
 #include "defines_uniform.h"
+#include "utils/trace.h"
 #include <chrono>
 #include <cstdint>
 #include <thread>
 #ifdef SCI_OT
+#include "LinearHE/linear-ring.h"
 #include "LinearOT/linear-ot.h"
 #include "LinearOT/linear-uniform.h"
+#include "linear_autotune.h"
 #endif
 // Additional Headers for Athos
 #ifdef SCI_HE
@@ -65,6 +68,11 @@ extern MaxPoolProtocol<intType> *maxpool;
 // Additional classes for Athos
 #ifdef SCI_OT
 extern MatMulUniform<sci::NetIO, intType, sci::IKNP<sci::NetIO>> *multUniform;
+// Per-layer linear protocol selection; null unless EZPC_LINEAR_AUTOTUNE is set
+extern LinearCostModel *linearCostModel;
+// Coefficient-encoded HE linear layers; null until LinearRing is validated
+// against SEAL (see tests/test_ring_linear_he.cpp)
+extern LinearRing *he_ring;
 #endif
 #ifdef SCI_HE
 extern ConvField *he_conv;
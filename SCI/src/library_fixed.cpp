@@ -338,6 +338,7 @@ void reconstruct(uint64_t *A, int64_t *B, int32_t I, int32_t J, int bwA) {
 
 void AdjustScaleShr(uint64_t *A, uint64_t *B, int32_t I, int32_t J, int32_t bwA,
                     int32_t scale) {
+  TRACE_LAYER("AdjustScaleShr");
 #ifdef LOG_LAYERWISE
   INIT_TIMER;
   INIT_ALL_IO_DATA_SENT;
@@ -364,6 +365,7 @@ void AdjustScaleShr(uint64_t *A, uint64_t *B, int32_t I, int32_t J, int32_t bwA,
 void MatAdd(uint64_t *A, uint64_t *B, uint64_t *C, int32_t I, int32_t J,
             int32_t bwA, int32_t bwB, int32_t bwC, int32_t bwTemp, int32_t shrA,
             int32_t shrB, int32_t shrC, int32_t demote, bool subroutine) {
+  TRACE_LAYER("MatAdd");
 #ifdef LOG_LAYERWISE
   INIT_TIMER;
   INIT_ALL_IO_DATA_SENT;
@@ -423,6 +425,7 @@ void MatAddBroadCast(uint64_t *A, uint64_t *B, uint64_t *C, int32_t I,
                      int32_t J, int32_t bwA, int32_t bwB, int32_t bwC,
                      int32_t bwTemp, int32_t shrA, int32_t shrB, int32_t shrC,
                      int32_t demote, bool scalar_A) {
+  TRACE_LAYER("MatAddBroadCast");
 #ifdef LOG_LAYERWISE
   INIT_TIMER;
   INIT_ALL_IO_DATA_SENT;
@@ -477,6 +480,7 @@ void AddOrSubCir(uint64_t *A, uint64_t *B, uint64_t *C, int32_t I, int32_t J,
                  int32_t bwA, int32_t bwB, int32_t bwC, int32_t bwTemp,
                  int32_t shrA, int32_t shrB, int32_t shrC, bool add,
                  int32_t demote) {
+  TRACE_LAYER("AddOrSubCir");
 #ifdef LOG_LAYERWISE
   INIT_TIMER;
   INIT_ALL_IO_DATA_SENT;
@@ -519,6 +523,7 @@ void AddOrSubCir(uint64_t *A, uint64_t *B, uint64_t *C, int32_t I, int32_t J,
 void ScalarMul(uint64_t *A, uint64_t *B, uint64_t *C, int32_t I, int32_t J,
                int32_t bwA, int32_t bwB, int32_t bwTemp, int32_t bwC,
                int32_t shrA, int32_t shrB, int32_t demote) {
+  TRACE_LAYER("ScalarMul");
 #ifdef LOG_LAYERWISE
   INIT_TIMER;
   INIT_ALL_IO_DATA_SENT;
@@ -585,6 +590,7 @@ void MulCir_thread(int32_t tid, uint64_t *A, uint64_t *B, uint64_t *C,
 void MulCir(int64_t I, int64_t J, int64_t shrA, int64_t shrB, int64_t demote,
             int64_t bwA, int64_t bwB, int64_t bwTemp, int64_t bwC, uint64_t *A,
             uint64_t *B, uint64_t *C) {
+  TRACE_LAYER("MulCir");
 #ifdef LOG_LAYERWISE
   std::cout << ctr++ << ". MulCir (" << I << " x " << J << ")" << std::endl;
   INIT_TIMER;
@@ -695,6 +701,7 @@ void MatMul(int64_t I, int64_t K, int64_t J, int64_t shrA, int64_t shrB,
             int64_t H1, int64_t H2, int64_t demote, int32_t bwA, int32_t bwB,
             int32_t bwTemp, int32_t bwC, uint64_t *A, uint64_t *B, uint64_t *C,
             uint64_t *tmp, bool verbose) {
+  TRACE_LAYER("MatMul");
 #ifdef LOG_LAYERWISE
   if (verbose)
     std::cout << ctr++ << ". MatMul (" << I << " x " << K << " x " << J << ")"
@@ -837,6 +844,7 @@ void Sigmoid_thread(int32_t tid, uint64_t *A, uint64_t *B, int32_t dim,
 
 void Sigmoid(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
              int64_t bwA, int64_t bwB, uint64_t *A, uint64_t *B) {
+  TRACE_LAYER("Sigmoid");
 #ifdef LOG_LAYERWISE
   std::cout << ctr++ << ". Sigmoid (" << I << " x " << J << ")" << std::endl;
   INIT_TIMER;
@@ -910,6 +918,7 @@ void TanH_thread(int32_t tid, uint64_t *A, uint64_t *B, int32_t dim,
 
 void TanH(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
           int64_t bwA, int64_t bwB, uint64_t *A, uint64_t *B) {
+  TRACE_LAYER("TanH");
 #ifdef LOG_LAYERWISE
   std::cout << ctr++ << ". TanH (" << I << " x " << J << ")" << std::endl;
   INIT_TIMER;
@@ -981,6 +990,7 @@ void Sqrt_thread(int32_t tid, uint64_t *A, uint64_t *B, int32_t dim,
 
 void Sqrt(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
           int64_t bwA, int64_t bwB, bool inverse, uint64_t *A, uint64_t *B) {
+  TRACE_LAYER("Sqrt");
 #ifdef LOG_LAYERWISE
   std::cout << ctr++ << ". Sqrt (" << I << " x " << J << ")" << std::endl;
   INIT_TIMER;
@@ -1042,6 +1052,128 @@ void Sqrt(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
 #endif
 }
 
+void Softmax_thread(int32_t tid, uint64_t *A, uint64_t *B, int32_t rows,
+                    int32_t cols, int32_t bwA, int32_t bwB, int32_t sA,
+                    int32_t sB) {
+  mathArr[tid]->softmax(rows, cols, A, B, bwA, bwB, sA, sB);
+}
+
+void Softmax(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
+             int64_t bwA, int64_t bwB, uint64_t *A, uint64_t *B) {
+  TRACE_LAYER("Softmax");
+#ifdef LOG_LAYERWISE
+  std::cout << ctr++ << ". Softmax (" << I << " x " << J << ")" << std::endl;
+  INIT_TIMER;
+#endif
+
+  int32_t s_A = log2(scale_in);
+  int32_t s_B = log2(scale_out);
+
+  // Rows are normalized as a whole, so threads split the rows
+  int min_chunk_size = ceil(THREADING_MIN_CHUNK_SIZE / double(J));
+  std::vector<int> chunks_per_thread =
+      divide_instances(::num_threads, I, min_chunk_size);
+
+  int offset = 0;
+  int lnum_threads = chunks_per_thread.size();
+  std::thread threads[lnum_threads];
+  for (int i = 0; i < lnum_threads; i++) {
+    threads[i] =
+        std::thread(Softmax_thread, i, A + offset * J, B + offset * J,
+                    chunks_per_thread[i], J, bwA, bwB, s_A, s_B);
+    offset += chunks_per_thread[i];
+  }
+  for (int i = 0; i < lnum_threads; ++i) {
+    threads[i].join();
+  }
+#ifdef LOG_LAYERWISE
+  auto temp = TIMER_TILL_NOW;
+  std::cout << "Time in sec for current Softmax = " << (temp / 1000.0)
+            << std::endl;
+#endif
+}
+
+void Gelu_thread(int32_t tid, uint64_t *A, uint64_t *B, int32_t dim,
+                 int32_t bwA, int32_t bwB, int32_t sA, int32_t sB) {
+  mathArr[tid]->gelu(dim, A, B, bwA, bwB, sA, sB);
+}
+
+void Gelu(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
+          int64_t bwA, int64_t bwB, uint64_t *A, uint64_t *B) {
+  TRACE_LAYER("Gelu");
+#ifdef LOG_LAYERWISE
+  std::cout << ctr++ << ". Gelu (" << I << " x " << J << ")" << std::endl;
+  INIT_TIMER;
+#endif
+
+  int32_t s_A = log2(scale_in);
+  int32_t s_B = log2(scale_out);
+
+  int min_chunk_size = THREADING_MIN_CHUNK_SIZE;
+  std::vector<int> chunks_per_thread =
+      divide_instances(::num_threads, I * J, min_chunk_size);
+
+  int offset = 0;
+  int lnum_threads = chunks_per_thread.size();
+  std::thread threads[lnum_threads];
+  for (int i = 0; i < lnum_threads; i++) {
+    threads[i] = std::thread(Gelu_thread, i, A + offset, B + offset,
+                             chunks_per_thread[i], bwA, bwB, s_A, s_B);
+    offset += chunks_per_thread[i];
+  }
+  for (int i = 0; i < lnum_threads; ++i) {
+    threads[i].join();
+  }
+#ifdef LOG_LAYERWISE
+  auto temp = TIMER_TILL_NOW;
+  std::cout << "Time in sec for current Gelu = " << (temp / 1000.0)
+            << std::endl;
+#endif
+}
+
+void LayerNorm_thread(int32_t tid, uint64_t *A, uint64_t *gamma,
+                      uint64_t *beta, uint64_t *B, int32_t rows, int32_t cols,
+                      int32_t bwA, int32_t bwB, int32_t sA, int32_t sB) {
+  mathArr[tid]->layer_norm(rows, cols, A, B, gamma, beta, bwA, bwB, sA, sB);
+}
+
+void LayerNorm(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
+               int64_t bwA, int64_t bwB, uint64_t *A, uint64_t *gamma,
+               uint64_t *beta, uint64_t *B) {
+  TRACE_LAYER("LayerNorm");
+#ifdef LOG_LAYERWISE
+  std::cout << ctr++ << ". LayerNorm (" << I << " x " << J << ")"
+            << std::endl;
+  INIT_TIMER;
+#endif
+
+  int32_t s_A = log2(scale_in);
+  int32_t s_B = log2(scale_out);
+
+  // Rows are normalized as a whole, so threads split the rows
+  int min_chunk_size = ceil(THREADING_MIN_CHUNK_SIZE / double(J));
+  std::vector<int> chunks_per_thread =
+      divide_instances(::num_threads, I, min_chunk_size);
+
+  int offset = 0;
+  int lnum_threads = chunks_per_thread.size();
+  std::thread threads[lnum_threads];
+  for (int i = 0; i < lnum_threads; i++) {
+    threads[i] = std::thread(LayerNorm_thread, i, A + offset * J, gamma, beta,
+                             B + offset * J, chunks_per_thread[i], J, bwA, bwB,
+                             s_A, s_B);
+    offset += chunks_per_thread[i];
+  }
+  for (int i = 0; i < lnum_threads; ++i) {
+    threads[i].join();
+  }
+#ifdef LOG_LAYERWISE
+  auto temp = TIMER_TILL_NOW;
+  std::cout << "Time in sec for current LayerNorm = " << (temp / 1000.0)
+            << std::endl;
+#endif
+}
+
 void Exp(uint64_t *A, uint64_t *B, int32_t I, int32_t J, int32_t bwA,
          int32_t bwB, int32_t sA, int32_t sB) {
   math->lookup_table_exp(I * J, A, B, bwA, bwB, sA, sB);
@@ -1055,6 +1187,7 @@ void Div(uint64_t *A, uint64_t *B, uint64_t *C, int32_t I, int32_t J,
 
 void ArgMax(uint64_t *A, int32_t I, int32_t J, int32_t bwA, int32_t bw_index,
             uint64_t *index) {
+  TRACE_LAYER("ArgMax");
 #ifdef LOG_LAYERWISE
   INIT_TIMER;
   INIT_ALL_IO_DATA_SENT;
@@ -1082,6 +1215,7 @@ void ArgMax(uint64_t *A, int32_t I, int32_t J, int32_t bwA, int32_t bw_index,
 
 void MaxPool2D(uint64_t *A, int32_t I, int32_t J, int32_t bwA, int32_t bwB,
                uint64_t *B) {
+  TRACE_LAYER("MaxPool2D");
 #ifdef LOG_LAYERWISE
   INIT_TIMER;
   INIT_ALL_IO_DATA_SENT;
@@ -1312,6 +1446,7 @@ void Convolution(int32_t N, int32_t H, int32_t W, int32_t CIN, int32_t HF,
 
 void ReLU(uint64_t *A, uint64_t *B, int32_t I, int32_t J, int32_t bwA,
           int32_t bwB, uint64_t six, int32_t div) {
+  TRACE_LAYER("ReLU");
 #ifdef LOG_LAYERWISE
   INIT_TIMER;
   INIT_ALL_IO_DATA_SENT;
@@ -1352,6 +1487,7 @@ void ReLU(uint64_t *A, uint64_t *B, int32_t I, int32_t J, int32_t bwA,
 void BNorm(uint64_t *A, uint64_t *BNW, uint64_t *BNB, uint64_t *B, int32_t I,
            int32_t J, int32_t bwA, int32_t bwBNW, int32_t bwBNB, int32_t bwTemp,
            int32_t bwB, int32_t shA, int32_t shBNB, int32_t shB) {
+  TRACE_LAYER("BNorm");
 #ifdef LOG_LAYERWISE
   INIT_TIMER;
   INIT_ALL_IO_DATA_SENT;
@@ -1429,6 +1565,7 @@ void BNorm(uint64_t *A, uint64_t *BNW, uint64_t *BNB, uint64_t *B, int32_t I,
 
 void NormaliseL2(uint64_t *A, uint64_t *B, int32_t I, int32_t J, int32_t bwA,
                  int32_t scaleA, int32_t shrA) {
+  TRACE_LAYER("NormaliseL2");
 #ifdef LOG_LAYERWISE
   INIT_TIMER;
   INIT_ALL_IO_DATA_SENT;
@@ -245,6 +245,19 @@ void TanH(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
 void Sqrt(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
           int64_t bwA, int64_t bwB, bool inverse, uint64_t *A, uint64_t *B);
 
+// Row-wise softmax of the I x J matrix A
+void Softmax(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
+             int64_t bwA, int64_t bwB, uint64_t *A, uint64_t *B);
+
+void Gelu(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
+          int64_t bwA, int64_t bwB, uint64_t *A, uint64_t *B);
+
+// Normalizes the rows of the I x J matrix A; gamma and beta hold J values of
+// bitwidth bwB and scale scale_out, and may be nullptr
+void LayerNorm(int64_t I, int64_t J, int64_t scale_in, int64_t scale_out,
+               int64_t bwA, int64_t bwB, uint64_t *A, uint64_t *gamma,
+               uint64_t *beta, uint64_t *B);
+
 void reconstruct(int64_t *A, int64_t *B, int32_t I, int32_t J, int bwA);
 
 // template<class int64_t>
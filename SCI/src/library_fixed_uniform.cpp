@@ -22,6 +22,7 @@ SOFTWARE.
 #include "library_fixed_uniform.h"
 #include "functionalities_uniform.h"
 #include "library_fixed_common.h"
+#include "utils/ring_gemm.h"
 #ifdef SCI_HE
 uint64_t prime_mod = sci::default_prime_mod.at(bitlength);
 #elif SCI_OT
@@ -51,8 +52,119 @@ uint64_t getRingElt(int64_t x) {
 
 using namespace std;
 
+#ifdef SCI_OT
+#ifdef USE_LINEAR_RING_HE
+#error "USE_LINEAR_RING_HE: LinearRingHE has not been validated against SEAL yet; run linear_he-OT at bitlengths <= 32 (N = 8192) and > 32 (N = 16384) first"
+#endif
+#if defined(MULTITHREADED_MATMUL)
+const LinearProtocol defaultLinearProtocol = LinearProtocol::Multithreaded;
+#elif defined(USE_LINEAR_UNIFORM)
+const LinearProtocol defaultLinearProtocol = LinearProtocol::Uniform;
+#else
+const LinearProtocol defaultLinearProtocol = LinearProtocol::CrossTerms;
+#endif
+
+// Shares of the cross terms of A*B (everything except ALICE's local A*B) into
+// C, using the given protocol
+static void MatMulCrossTerms(LinearProtocol protocol, int32_t s1, int32_t s2,
+                             int32_t s3, const intType *A, const intType *B,
+                             intType *C, int partyWithAInAB_mul,
+                             bool modelIsA) {
+  switch (protocol) {
+  case LinearProtocol::Uniform: {
+    if (partyWithAInAB_mul == sci::ALICE) {
+      if (party == sci::ALICE) {
+        multUniform->funcOTSenderInputA(s1, s2, s3, A, C, iknpOT);
+      } else {
+        multUniform->funcOTReceiverInputB(s1, s2, s3, B, C, iknpOT);
+      }
+    } else {
+      if (party == sci::BOB) {
+        multUniform->funcOTSenderInputA(s1, s2, s3, A, C, iknpOTRoleReversed);
+      } else {
+        multUniform->funcOTReceiverInputB(s1, s2, s3, B, C,
+                                          iknpOTRoleReversed);
+      }
+    }
+    break;
+  }
+  case LinearProtocol::CrossTerms: {
+#ifdef TRAINING
+    mult->matmul_cross_terms(s1, s2, s3, (intType *)A, (intType *)B, C,
+                             bitlength, bitlength, bitlength, true,
+                             MultMode::None);
+#else
+    if (modelIsA) {
+      mult->matmul_cross_terms(s1, s2, s3, (intType *)A, (intType *)B, C,
+                               bitlength, bitlength, bitlength, true,
+                               MultMode::Alice_has_A);
+    } else {
+      mult->matmul_cross_terms(s1, s2, s3, (intType *)A, (intType *)B, C,
+                               bitlength, bitlength, bitlength, true,
+                               MultMode::Alice_has_B);
+    }
+#endif
+    break;
+  }
+  case LinearProtocol::Multithreaded: {
+    int required_num_threads = num_threads;
+    if (s2 < num_threads) {
+      required_num_threads = s2;
+    }
+    intType *C_ans_arr[required_num_threads];
+    std::thread matmulThreads[required_num_threads];
+    for (int i = 0; i < required_num_threads; i++) {
+      C_ans_arr[i] = new intType[s1 * s3];
+      matmulThreads[i] =
+          std::thread(funcMatmulThread, i, required_num_threads, s1, s2, s3,
+                      (intType *)A, (intType *)B, (intType *)C_ans_arr[i],
+                      partyWithAInAB_mul);
+    }
+    for (int i = 0; i < required_num_threads; i++) {
+      matmulThreads[i].join();
+    }
+    for (int i = 0; i < s1 * s3; i++) {
+      C[i] = 0;
+    }
+    for (int i = 0; i < required_num_threads; i++) {
+      for (int j = 0; j < s1 * s3; j++) {
+        C[j] += C_ans_arr[i][j];
+      }
+      delete[] C_ans_arr[i];
+    }
+    break;
+  }
+  case LinearProtocol::RingHE: {
+#ifdef TRAINING
+    // Both cross terms, with each party holding the plaintext operand once
+    intType *CTemp = new intType[s1 * s3];
+    he_ring->matmul(s1, s2, s3, A, B, C, sci::ALICE);
+    he_ring->matmul(s1, s2, s3, A, B, CTemp, sci::BOB);
+    sci::elemWiseAdd<intType>(s1 * s3, C, CTemp, C);
+    delete[] CTemp;
+#else
+    he_ring->matmul(s1, s2, s3, A, B, C, partyWithAInAB_mul);
+#endif
+    break;
+  }
+  }
+}
+
+// Protocol for an (s1 x s2) * (s2 x s3) product: the calibrated choice with
+// EZPC_LINEAR_AUTOTUNE, the compile-time default otherwise
+static LinearProtocol ChooseLinearProtocol(int32_t s1, int32_t s2,
+                                           int32_t s3) {
+  LinearProtocol protocol = defaultLinearProtocol;
+  assert(protocol != LinearProtocol::RingHE || he_ring != nullptr);
+  if (linearCostModel != nullptr)
+    protocol = linearCostModel->choose(s1, s2, s3, protocol);
+  return protocol;
+}
+#endif
+
 void MatMul2D(int32_t s1, int32_t s2, int32_t s3, const intType *A,
               const intType *B, intType *C, bool modelIsA) {
+  TRACE_LAYER("MatMul2D");
 #ifdef LOG_LAYERWISE
   INIT_ALL_IO_DATA_SENT;
   INIT_TIMER;
@@ -72,35 +184,13 @@ void MatMul2D(int32_t s1, int32_t s2, int32_t s3, const intType *A,
   }
 
 #if defined(SCI_OT)
-#ifndef MULTITHREADED_MATMUL
-#ifdef USE_LINEAR_UNIFORM
-  if (partyWithAInAB_mul == sci::ALICE) {
-    if (party == sci::ALICE) {
-      multUniform->funcOTSenderInputA(s1, s2, s3, A, C, iknpOT);
-    } else {
-      multUniform->funcOTReceiverInputB(s1, s2, s3, B, C, iknpOT);
-    }
-  } else {
-    if (party == sci::BOB) {
-      multUniform->funcOTSenderInputA(s1, s2, s3, A, C, iknpOTRoleReversed);
-    } else {
-      multUniform->funcOTReceiverInputB(s1, s2, s3, B, C, iknpOTRoleReversed);
-    }
-  }
-#else  // USE_LINEAR_UNIFORM
-#ifdef TRAINING
-  mult->matmul_cross_terms(s1, s2, s3, A, B, C, bitlength, bitlength,
-                           bitlength, true, MultMode::None);
-#else
-  if (modelIsA) {
-    mult->matmul_cross_terms(s1, s2, s3, A, B, C, bitlength, bitlength,
-                             bitlength, true, MultMode::Alice_has_A);
-  } else {
-    mult->matmul_cross_terms(s1, s2, s3, A, B, C, bitlength, bitlength,
-                             bitlength, true, MultMode::Alice_has_B);
-  }
+  LinearProtocol protocol = ChooseLinearProtocol(s1, s2, s3);
+#ifdef LOG_LAYERWISE
+  std::cout << "Matmul protocol: " << linearProtocolName(protocol)
+            << std::endl;
 #endif
-#endif // USE_LINEAR_UNIFORM
+  MatMulCrossTerms(protocol, s1, s2, s3, A, B, C, partyWithAInAB_mul,
+                   modelIsA);
 
   if (party == sci::ALICE) {
     // Now irrespective of whether A is the model or B is the model and whether
@@ -109,57 +199,10 @@ void MatMul2D(int32_t s1, int32_t s2, int32_t s3, const intType *A,
     // Add also A*own share of B
     intType *CTemp = new intType[s1 * s3];
 #ifdef USE_LINEAR_UNIFORM
-    multUniform->ideal_func(s1, s2, s3, A, B, CTemp);
-#else  // USE_LINEAR_UNIFORM
-    mult->matmul_cleartext(s1, s2, s3, A, B, CTemp, true);
-#endif // USE_LINEAR_UNIFORM
-    sci::elemWiseAdd<intType>(s1 * s3, C, CTemp, C);
-    delete[] CTemp;
-  } else {
-    // For minionn kind of hacky runs, switch this off
-#ifndef HACKY_RUN
-    if (modelIsA) {
-      for (int i = 0; i < s1 * s2; i++)
-        assert(A[i] == 0);
-    } else {
-      for (int i = 0; i < s1 * s2; i++)
-        assert(B[i] == 0);
-    }
-#endif
-  }
-
-#else // MULTITHREADED_MATMUL is ON
-  int required_num_threads = num_threads;
-  if (s2 < num_threads) {
-    required_num_threads = s2;
-  }
-  intType *C_ans_arr[required_num_threads];
-  std::thread matmulThreads[required_num_threads];
-  for (int i = 0; i < required_num_threads; i++) {
-    C_ans_arr[i] = new intType[s1 * s3];
-    matmulThreads[i] = std::thread(funcMatmulThread, i, required_num_threads,
-                                   s1, s2, s3, (intType *)A, (intType *)B,
-                                   (intType *)C_ans_arr[i], partyWithAInAB_mul);
-  }
-  for (int i = 0; i < required_num_threads; i++) {
-    matmulThreads[i].join();
-  }
-  for (int i = 0; i < s1 * s3; i++) {
-    C[i] = 0;
-  }
-  for (int i = 0; i < required_num_threads; i++) {
-    for (int j = 0; j < s1 * s3; j++) {
-      C[j] += C_ans_arr[i][j];
-    }
-    delete[] C_ans_arr[i];
-  }
-
-  if (party == sci::ALICE) {
-    intType *CTemp = new intType[s1 * s3];
-#ifdef USE_LINEAR_UNIFORM
-    multUniform->ideal_func(s1, s2, s3, A, B, CTemp);
+    multUniform->ideal_func(s1, s2, s3, A, B, CTemp, num_threads);
 #else  // USE_LINEAR_UNIFORM
-    mult->matmul_cleartext(s1, s2, s3, (intType*)A, (intType*)B, CTemp, true);
+    mult->matmul_cleartext(s1, s2, s3, (intType *)A, (intType *)B, CTemp,
+                           true, num_threads);
 #endif // USE_LINEAR_UNIFORM
     sci::elemWiseAdd<intType>(s1 * s3, C, CTemp, C);
     delete[] CTemp;
@@ -175,7 +218,6 @@ void MatMul2D(int32_t s1, int32_t s2, int32_t s3, const intType *A,
     }
 #endif
   }
-#endif
   intType moduloMask = (1ULL << bitlength) - 1;
   if (bitlength == 64)
     moduloMask = -1;
@@ -281,6 +323,50 @@ void MatMul2D(int32_t s1, int32_t s2, int32_t s3, const intType *A,
 #endif
 }
 
+#ifdef SCI_OT
+// Conv2D with the cross terms from the native convolution of LinearRing,
+// which avoids the FH*FW-fold blow-up of the im2col input. As in MatMul2D,
+// the filter is the model, and ALICE adds the product of her own shares.
+static void Conv2DRingHE(int32_t N, int32_t H, int32_t W, int32_t CI,
+                         int32_t FH, int32_t FW, int32_t CO, int32_t zPadHLeft,
+                         int32_t zPadHRight, int32_t zPadWLeft,
+                         int32_t zPadWRight, int32_t strideH, int32_t strideW,
+                         int32_t newH, int32_t newW, uint64_t *inputArr,
+                         uint64_t *filterArr, uint64_t *outArr) {
+  int32_t outSize = N * newH * newW * CO;
+#ifdef TRAINING
+  intType *outTemp = new intType[outSize];
+  he_ring->convolution(N, H, W, CI, FH, FW, CO, zPadHLeft, zPadHRight,
+                       zPadWLeft, zPadWRight, strideH, strideW, inputArr,
+                       filterArr, outArr, sci::ALICE);
+  he_ring->convolution(N, H, W, CI, FH, FW, CO, zPadHLeft, zPadHRight,
+                       zPadWLeft, zPadWRight, strideH, strideW, inputArr,
+                       filterArr, outTemp, sci::BOB);
+  sci::elemWiseAdd<intType>(outSize, outArr, outTemp, outArr);
+  delete[] outTemp;
+#else
+  he_ring->convolution(N, H, W, CI, FH, FW, CO, zPadHLeft, zPadHRight,
+                       zPadWLeft, zPadWRight, strideH, strideW, inputArr,
+                       filterArr, outArr, sci::ALICE);
+#endif
+  if (party == sci::ALICE) {
+    // The FH x FW x CI x CO filter is the (FH * FW * CI) x CO right operand
+    ring_gemm::Im2col<uint64_t> patches{inputArr, size_t(H),  size_t(W),
+                                        size_t(CI), size_t(FH), size_t(FW),
+                                        size_t(newH), size_t(newW),
+                                        size_t(zPadHLeft), size_t(zPadWLeft),
+                                        size_t(strideH), size_t(strideW)};
+    ring_gemm::Strided<uint64_t> filterKC{filterArr, size_t(CO), 1};
+    ring_gemm::gemmSources<uint64_t>(N * newH * newW, CO, FH * FW * CI,
+                                     patches, filterKC, outArr, CO, true, 1,
+                                     num_threads);
+  }
+  for (int32_t i = 0; i < outSize; i++) {
+    outArr[i] &= moduloMask;
+  }
+}
+#endif
+
 static void Conv2D(int32_t N, int32_t H, int32_t W, int32_t CI, int32_t FH,
                    int32_t FW, int32_t CO, int32_t zPadHLeft,
                    int32_t zPadHRight, int32_t zPadWLeft, int32_t zPadWRight,
@@ -301,6 +387,20 @@ static void Conv2D(int32_t N, int32_t H, int32_t W, int32_t CI, int32_t FH,
 
   int32_t reshapedIPCols = ((N * newH) * newW);
 
+#ifdef SCI_OT
+  if (ChooseLinearProtocol(reshapedFilterRows, reshapedFilterCols,
+                           reshapedIPCols) == LinearProtocol::RingHE) {
+#ifdef LOG_LAYERWISE
+    std::cout << "Conv protocol: "
+              << linearProtocolName(LinearProtocol::RingHE) << std::endl;
+#endif
+    Conv2DRingHE(N, H, W, CI, FH, FW, CO, zPadHLeft, zPadHRight, zPadWLeft,
+                 zPadWRight, strideH, strideW, newH, newW, inputArr, filterArr,
+                 outArr);
+    return;
+  }
+#endif
+
   uint64_t *filterReshaped =
       make_array<uint64_t>(reshapedFilterRows, reshapedFilterCols);
 
@@ -327,6 +427,7 @@ void Conv2DWrapper(signedIntType N, signedIntType H, signedIntType W,
                    signedIntType zPadWRight, signedIntType strideH,
                    signedIntType strideW, intType *inputArr, intType *filterArr,
                    intType *outArr) {
+  TRACE_LAYER("Conv2DWrapper");
 #ifdef LOG_LAYERWISE
   INIT_ALL_IO_DATA_SENT;
   INIT_TIMER;
@@ -519,6 +620,7 @@ void Conv2DGroupWrapper(signedIntType N, signedIntType H, signedIntType W,
                         signedIntType strideW, signedIntType G,
                         intType *inputArr, intType *filterArr,
                         intType *outArr) {
+  TRACE_LAYER("Conv2DGroupWrapper");
 #ifdef LOG_LAYERWISE
   INIT_ALL_IO_DATA_SENT;
   INIT_TIMER;
@@ -600,6 +702,7 @@ void ConvTranspose2DWrapper(int32_t N, int32_t HPrime, int32_t WPrime,
                                int32_t strideH, int32_t strideW,
                                uint64_t* inArr, uint64_t* filterArr,
                                uint64_t* outArr){
+  TRACE_LAYER("ConvTranspose2DWrapper");
   #ifdef LOG_LAYERWISE
     INIT_ALL_IO_DATA_SENT;
     INIT_TIMER;
@@ -641,6 +744,7 @@ void ConvTranspose2DWrapper(int32_t N, int32_t HPrime, int32_t WPrime,
 
 void ElemWiseActModelVectorMult(int32_t size, intType *inArr,
                                 intType *multArrVec, intType *outputArr) {
+  TRACE_LAYER("ElemWiseActModelVectorMult");
 #ifdef LOG_LAYERWISE
   INIT_ALL_IO_DATA_SENT;
   INIT_TIMER;
@@ -785,6 +889,7 @@ void ElemWiseActModelVectorMult(int32_t size, intType *inArr,
 }
 
 void ArgMax(int32_t s1, int32_t s2, intType *inArr, intType *outArr) {
+  TRACE_LAYER("ArgMax");
 #ifdef LOG_LAYERWISE
   INIT_ALL_IO_DATA_SENT;
   INIT_TIMER;
@@ -937,6 +1042,13 @@ void HardSigmoid(int32_t size, intType *inArr, intType *outArr, int32_t sf, bool
 
 void Relu(int32_t size, intType *inArr, intType *outArr, int sf,
           bool doTruncation) {
+#ifdef SCI_OT
+  if (doTruncation) {
+    ReluTruncate(size, inArr, outArr, sf);
+    return;
+  }
+#endif
+  TRACE_LAYER("Relu");
 #ifdef LOG_LAYERWISE
   INIT_ALL_IO_DATA_SENT;
   INIT_TIMER;
@@ -1086,11 +1198,105 @@ void Relu(int32_t size, intType *inArr, intType *outArr, int sf,
   delete[] msbShare;
 }
 
+void ReluTruncate(int32_t size, intType *inArr, intType *outArr, int sf) {
+#ifndef SCI_OT
+  Relu(size, inArr, outArr, sf, true);
+#else
+  TRACE_LAYER("ReluTruncate");
+#ifdef LOG_LAYERWISE
+  INIT_ALL_IO_DATA_SENT;
+  INIT_TIMER;
+#endif
+
+  static int ctr = 1;
+  std::cout << "ReluTruncate " << ctr << " called size=" << size << std::endl;
+  ctr++;
+
+  // One comparison per element gives both the DReLU bit and the wrap of the
+  // lower sf bits, which Relu followed by a truncation computes separately
+  intType moduloMask = sci::all1Mask(bitlength);
+  for (int i = 0; i < size; i++) {
+    inArr[i] = inArr[i] & moduloMask;
+  }
+
+#ifndef MULTITHREADED_NONLIN
+  truncation->relu_truncate(size, inArr, outArr, sf, bitlength);
+#else
+  std::thread relu_threads[num_threads];
+  int chunk_size = size / num_threads;
+  for (int i = 0; i < num_threads; ++i) {
+    int offset = i * chunk_size;
+    int lnum_relu;
+    if (i == (num_threads - 1)) {
+      lnum_relu = size - offset;
+    } else {
+      lnum_relu = chunk_size;
+    }
+    relu_threads[i] = std::thread(funcReluTruncateThread, i, outArr + offset,
+                                  inArr + offset, lnum_relu, sf);
+  }
+  for (int i = 0; i < num_threads; ++i) {
+    relu_threads[i].join();
+  }
+#endif
+
+#ifdef LOG_LAYERWISE
+  auto temp = TIMER_TILL_NOW;
+  ReluTimeInMilliSec += temp;
+  std::cout << "Time in sec for current relu = " << (temp / 1000.0)
+            << std::endl;
+  uint64_t curComm;
+  FIND_ALL_IO_TILL_NOW(curComm);
+  ReluCommSent += curComm;
+#endif
+
+#ifdef VERIFY_LAYERWISE
+  if (party == SERVER) {
+    funcReconstruct2PCCons(nullptr, inArr, size);
+    funcReconstruct2PCCons(nullptr, outArr, size);
+  } else {
+    signedIntType *VinArr = new signedIntType[size];
+    funcReconstruct2PCCons(VinArr, inArr, size);
+    signedIntType *VoutArr = new signedIntType[size];
+    funcReconstruct2PCCons(VoutArr, outArr, size);
+
+    std::vector<uint64_t> VinVec;
+    VinVec.resize(size, 0);
+
+    std::vector<uint64_t> VoutVec;
+    VoutVec.resize(size, 0);
+
+    for (int i = 0; i < size; i++) {
+      VinVec[i] = getRingElt(VinArr[i]);
+    }
+
+    Relu_pt(size, VinVec, VoutVec, 0, false); // sf = 0
+    ScaleDown_pt(size, VoutVec, sf);
+
+    bool pass = true;
+    for (int i = 0; i < size; i++) {
+      if (VoutArr[i] != getSignedVal(VoutVec[i])) {
+        pass = false;
+      }
+    }
+    if (pass == true)
+      std::cout << GREEN << "ReluTruncate Output Matches" << RESET << std::endl;
+    else
+      std::cout << RED << "ReluTruncate Output Mismatch" << RESET << std::endl;
+
+    delete[] VinArr;
+    delete[] VoutArr;
+  }
+#endif
+#endif
+}
+
 void MaxPool(int32_t N, int32_t H, int32_t W, int32_t C, int32_t ksizeH,
              int32_t ksizeW, int32_t zPadHLeft, int32_t zPadHRight,
              int32_t zPadWLeft, int32_t zPadWRight, int32_t strideH,
              int32_t strideW, int32_t N1, int32_t imgH, int32_t imgW,
              int32_t C1, intType *inArr, intType *outArr) {
+  TRACE_LAYER("MaxPool");
 #ifdef LOG_LAYERWISE
   INIT_ALL_IO_DATA_SENT;
   INIT_TIMER;
@@ -1274,6 +1480,7 @@ void AvgPool(int32_t N, int32_t H, int32_t W, int32_t C, int32_t ksizeH,
              int32_t zPadWLeft, int32_t zPadWRight, int32_t strideH,
              int32_t strideW, int32_t N1, int32_t imgH, int32_t imgW,
              int32_t C1, intType *inArr, intType *outArr) {
+  TRACE_LAYER("AvgPool");
 #ifdef LOG_LAYERWISE
   INIT_ALL_IO_DATA_SENT;
   INIT_TIMER;
@@ -1446,6 +1653,7 @@ void AvgPool(int32_t N, int32_t H, int32_t W, int32_t C, int32_t ksizeH,
 }
 
 void ScaleDown(int32_t size, intType *inArr, int32_t sf) {
+  TRACE_LAYER("ScaleDown");
 #ifdef LOG_LAYERWISE
   INIT_ALL_IO_DATA_SENT;
   INIT_TIMER;
@@ -1530,6 +1738,177 @@ void ScaleUp(int32_t size, intType *arr, int32_t sf) {
   }
 }
 
+#ifdef SCI_OT
+static void RingHEFeatures(int s1, int s2, int s3, double &f1, double &f2) {
+  he_ring->matmul_cost(s1, s2, s3, f1, f2);
+}
+
+// Measures the round-trip time and bandwidth of the main channel and runs
+// every linear protocol on the calibration shapes of LinearCostModel. ALICE
+// fits the model from the measurements of both parties and sends it to BOB,
+// so that both pick the same protocol for every layer in MatMul2D.
+static void CalibrateLinearProtocols() {
+  typedef std::chrono::steady_clock clock;
+  auto elapsedUs = [](clock::time_point t0) {
+    return std::chrono::duration<double, std::micro>(clock::now() - t0)
+        .count();
+  };
+  const int numShapes = LinearCostModel::numShapes;
+
+  // Round-trip time
+  const int numPings = 16;
+  char byte = 0;
+  io->sync();
+  auto t0 = clock::now();
+  for (int i = 0; i < numPings; i++) {
+    if (party == sci::ALICE) {
+      io->send_data(&byte, 1);
+      io->recv_data(&byte, 1);
+    } else {
+      io->recv_data(&byte, 1);
+      io->send_data(&byte, 1);
+    }
+  }
+  double rttUs = elapsedUs(t0) / numPings;
+
+  // Bandwidth: each party times the transfer it sends
+  const int bulkBytes = 1 << 20;
+  uint8_t *bulk = new uint8_t[bulkBytes];
+  memset(bulk, 0, bulkBytes);
+  double transferUs = 1;
+  for (int sender = sci::ALICE; sender <= sci::BOB; sender++) {
+    io->sync();
+    if (party == sender) {
+      t0 = clock::now();
+      io->send_data(bulk, bulkBytes);
+      io->recv_data(&byte, 1);
+      transferUs = std::max(1.0, elapsedUs(t0) - rttUs);
+    } else {
+      io->recv_data(bulk, bulkBytes);
+      io->send_data(&byte, 1);
+    }
+  }
+  delete[] bulk;
+
+  // Protocol microbenchmarks: wall time, bytes sent and rounds, per shape
+  bool available[NumLinearProtocols];
+  available[int(LinearProtocol::Multithreaded)] = (num_threads > 1);
+  available[int(LinearProtocol::CrossTerms)] = true;
+  available[int(LinearProtocol::Uniform)] = true;
+  available[int(LinearProtocol::RingHE)] = (he_ring != nullptr);
+  linearCostModel = new LinearCostModel();
+  if (he_ring != nullptr) {
+    linearCostModel->features[int(LinearProtocol::RingHE)] = RingHEFeatures;
+  }
+  const int numMeasurements = NumLinearProtocols * numShapes * 3 + 1;
+  double measured[numMeasurements];
+  memset(measured, 0, sizeof(measured));
+  for (int p = 0; p < NumLinearProtocols; p++) {
+    if (!available[p])
+      continue;
+    const int(*shapes)[3] = LinearCostModel::calibrationShapes(LinearProtocol(p));
+    for (int k = 0; k < numShapes; k++) {
+      int s1 = shapes[k][0];
+      int s2 = shapes[k][1];
+      int s3 = shapes[k][2];
+      intType *A = new intType[s1 * s2];
+      intType *B = new intType[s2 * s3];
+      intType *C = new intType[s1 * s3];
+      prg128Instance->random_data(A, s1 * s2 * sizeof(intType));
+      prg128Instance->random_data(B, s2 * s3 * sizeof(intType));
+      for (int i = 0; i < s1 * s2; i++)
+        A[i] = getRingElt(A[i]);
+      for (int i = 0; i < s2 * s3; i++)
+        B[i] = getRingElt(B[i]);
+
+      uint64_t comm = 0, rounds[MAX_THREADS];
+      for (int i = 0; i < num_threads; i++) {
+        comm -= iopackArr[i]->get_comm();
+        rounds[i] = iopackArr[i]->get_rounds();
+      }
+      io->sync();
+      t0 = clock::now();
+      MatMulCrossTerms(LinearProtocol(p), s1, s2, s3, A, B, C, sci::BOB,
+                       false);
+      double *m = measured + 3 * (p * numShapes + k);
+      m[0] = elapsedUs(t0);
+      uint64_t maxRounds = 0;
+      for (int i = 0; i < num_threads; i++) {
+        comm += iopackArr[i]->get_comm();
+        maxRounds =
+            std::max<uint64_t>(maxRounds, iopackArr[i]->get_rounds() - rounds[i]);
+      }
+      m[1] = comm;
+      m[2] = maxRounds;
+      delete[] A;
+      delete[] B;
+      delete[] C;
+    }
+  }
+  measured[numMeasurements - 1] = transferUs;
+
+  double serialized[LinearCostModel::numDoubles];
+  if (party == sci::ALICE) {
+    double other[numMeasurements];
+    io->recv_data(other, sizeof(other));
+    LinearCostModel &model = *linearCostModel;
+    model.rttUs = rttUs;
+    // Both directions share the model; assume the slower one
+    model.bytesPerUs = bulkBytes / std::max(measured[numMeasurements - 1],
+                                            other[numMeasurements - 1]);
+    for (int p = 0; p < NumLinearProtocols; p++) {
+      LinearCostModel::ProtocolModel &pm = model.protocols[p];
+      pm.available = available[p];
+      if (!available[p])
+        continue;
+      const int(*shapes)[3] =
+          LinearCostModel::calibrationShapes(LinearProtocol(p));
+      double f1[numShapes], f2[numShapes], bytes[numShapes],
+          compute[numShapes];
+      pm.rounds = 0;
+      for (int k = 0; k < numShapes; k++) {
+        model.featuresOf(LinearProtocol(p), shapes[k][0], shapes[k][1],
+                         shapes[k][2], f1[k], f2[k]);
+        double *mine = measured + 3 * (p * numShapes + k);
+        double *theirs = other + 3 * (p * numShapes + k);
+        double wall = std::max(mine[0], theirs[0]);
+        double rounds = std::max(mine[2], theirs[2]);
+        bytes[k] = std::max(mine[1], theirs[1]);
+        compute[k] = std::max(0.0, wall - rounds * model.rttUs / 2 -
+                                       bytes[k] / model.bytesPerUs);
+        pm.rounds += rounds / numShapes;
+      }
+      pm.bytes = LinearCostModel::fit(f1, f2, bytes);
+      pm.computeUs = LinearCostModel::fit(f1, f2, compute);
+    }
+    model.serialize(serialized);
+    io->send_data(serialized, sizeof(serialized));
+  } else {
+    io->send_data(measured, sizeof(measured));
+    io->recv_data(serialized, sizeof(serialized));
+    linearCostModel->deserialize(serialized);
+  }
+
+  std::cout << "Linear protocol autotuning: RTT = " << linearCostModel->rttUs
+            << " us, bandwidth = " << linearCostModel->bytesPerUs
+            << " MB/s" << std::endl;
+  for (int p = 0; p < NumLinearProtocols; p++) {
+    const LinearCostModel::ProtocolModel &pm = linearCostModel->protocols[p];
+    if (!pm.available)
+      continue;
+    bool ringHE = (LinearProtocol(p) == LinearProtocol::RingHE);
+    const char *f1 = ringHE ? " * ciphertexts + " : " * s1*s2 + ";
+    const char *f2 = ringHE ? " * products" : " * s1*s2*s3";
+    std::cout << "  " << linearProtocolName(LinearProtocol(p))
+              << ": rounds = " << pm.rounds << ", bytes = " << pm.bytes.c0
+              << " + " << pm.bytes.c1 << f1 << pm.bytes.c2 << f2
+              << ", compute (us) = " << pm.computeUs.c0 << " + "
+              << pm.computeUs.c1 << f1 << pm.computeUs.c2 << f2
+              << std::endl;
+  }
+}
+#endif
+
 void StartComputation() {
   assert(bitlength < 64 && bitlength > 0);
   assert(num_threads <= MAX_THREADS);
@@ -1669,6 +2048,14 @@ void StartComputation() {
     iknpOTRoleReversed->setup_send();
   }
 
+#ifdef SCI_OT
+  // he_ring stays null, keeping LinearRingHE out of the autotuner's
+  // candidates, until linear_he-OT has been run against SEAL at both poly
+  // degrees
+  if (linearAutotuneRequested())
+    CalibrateLinearProtocols();
+#endif
+
   cout << "After base ots, communication = " << (iopack->get_comm()) << " bytes"
        << endl;
   start_time = std::chrono::high_resolution_clock::now();
@@ -1682,6 +2069,19 @@ void StartComputation() {
   std::cout << "-----------Syncronizing-----------" << std::endl;
   io->sync();
   num_rounds = iopack->get_rounds();
+
+  // Layer-wise traces (enabled through EZPC_TRACE) report the traffic of all
+  // threads and the rounds on the main thread, same as EndComputation
+  trace::Tracer::instance().setParty(party);
+  trace::Tracer::instance().setCounterSource([]() {
+    trace::Counters c;
+    for (int i = 0; i < num_threads; i++) {
+      c.bytesSent += iopackArr[i]->get_comm();
+      c.bytesReceived += iopackArr[i]->get_comm_recv();
+    }
+    c.rounds = iopack->get_rounds();
+    return c;
+  });
   std::cout << "-----------Syncronized - now starting execution-----------"
             << std::endl;
 }
@@ -1957,6 +2357,7 @@ void EndComputation() {
     io->send_data(&NormaliseL2CommSent, sizeof(uint64_t));
   }
 #endif
+  trace::Tracer::instance().close();
 }
 
 intType SecretAdd(intType x, intType y) {
@@ -1998,6 +2399,7 @@ void ElemWiseVectorPublicDiv(int32_t s1, intType *arr1, int32_t divisor,
 
 void ElemWiseSecretSharedVectorMult(int32_t size, intType *inArr,
                                     intType *multArrVec, intType *outputArr) {
+  TRACE_LAYER("ElemWiseSecretSharedVectorMult");
 #ifdef LOG_LAYERWISE
   INIT_ALL_IO_DATA_SENT;
   INIT_TIMER;
@@ -24,6 +24,7 @@ SOFTWARE.
 
 #include "defines_uniform.h"
 #include "utils/ArgMapping/ArgMapping.h"
+#include "utils/binary_input.h"
 
 // Note of the bracket around each expression use -- if this is not there, not
 // macro expansion
@@ -84,6 +85,10 @@ void Max(int32_t size, intType *inArr, int32_t alpha, intType *outArr, int sf, b
 void Relu(int32_t size, intType *inArr, intType *outArr, int sf,
           bool doTruncation);
 
+// Relu(size, inArr, outArr, sf, true) with the DReLU and truncation
+// comparisons fused; Relu with doTruncation uses it in the ring
+void ReluTruncate(int32_t size, intType *inArr, intType *outArr, int sf);
+
 // void Clip(int32_t size, int64_t alpha, int64_t beta, intType *inArr, intType *outArr, int sf, bool doTruncation) ;
 
 void HardSigmoid(int32_t size, intType *inArr, intType *outArr, int sf, bool doTruncation);
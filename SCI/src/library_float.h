@@ -45,6 +45,9 @@ extern FPMath *__fp_math; // float math operations
 extern int __m_bits; // mantissa bits
 extern int __e_bits; // exponent bits
 
+// Memory budget (in MB) for the intermediate products of MatMul
+extern int __matmul_mem;
+
 // Handy globals ;
 extern int BATCH;
 extern int __sz1 ;
@@ -174,6 +177,27 @@ auto make_vector_float_rand(int party, size_t first, Args... sizes)
 /********************* Extern functions *********************/
 
 vector<int> get_chunks(int items, int slots);
+
+// Tile sizes of an m x n x p matrix product: mt x nt tiles of A times nt x pt
+// tiles of B
+struct MatMulTiling {
+	int mt, nt, pt;
+};
+
+// Shrinks the tiles until there are at least slots of them and the products
+// of one tile fit in a slots-th of __matmul_mem
+MatMulTiling get_matmul_tiling(int m, int n, int p, int slots, long long bytes_per_product);
+
+// Product of an A tile and a B tile on thread tid
+typedef FPMatrix (*MatMulTileFn)(int tid, const FPMatrix &A, const FPMatrix &B);
+
+// MatMul over tiles of get_matmul_tiling spread across the threads; the
+// partial sums along n are merged with a secure tree reduction
+void MatMulTiled(int32_t m, int32_t n, int32_t p,
+	vector<vector<FPArray>> &A,
+	vector<vector<FPArray>> &B,
+	vector<vector<FPArray>> &C,
+	MatMulTileFn tile_fn, long long bytes_per_product);
 tuple<BoolArray,BoolArray,FixArray,FixArray> get_components(int tid, const FPArray &x);
 
 void Transpose(int32_t s1, int32_t s2, vector<vector<FPArray>> &inArr, vector<vector<FPArray>> &outArr) ;
@@ -364,4 +388,4 @@ void computeMSELoss(int32_t m, int32_t s, vector<vector<FPArray>> &target, vecto
 void Gelu(int32_t s1, vector<FPArray> &inArr, vector<FPArray> &outArr) ;
 
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
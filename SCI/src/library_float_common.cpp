@@ -47,6 +47,7 @@ int __e_bits = 8 ;					// exponent bits
 int __nt = MAX_THREADS ;
 int __party = 0 ;
 extern int __chunk_exp ;
+int __matmul_mem = 4096 ;
 
 // Handy globals for experiments
 int __sz1 = 0 ;
@@ -74,6 +75,7 @@ void __init(int __argc, char **__argv) {
 	__amap.arg("mbits", __m_bits, "mantissa bits") ;
 	__amap.arg("ebits", __e_bits, "exponent bits") ;
 	__amap.arg("chunk", __chunk_exp, "Chunk Size (in powers of 2) for computation breakdown") ;
+	__amap.arg("matmul_mem", __matmul_mem, "Memory budget (in MB) for the intermediate products of MatMul") ;
 	__amap.arg("port", __port, "port") ;
 	__amap.arg("add", __address, "address") ;
 
@@ -235,6 +237,231 @@ vector<int> get_chunks(int items, int slots) {
 	return ret ;
 }
 
+MatMulTiling get_matmul_tiling(int m, int n, int p, int slots, long long bytes_per_product) {
+	long long budget = ((long long)__matmul_mem << 20) / (bytes_per_product * slots) ;
+	budget = max(budget, 1LL << 10) ;
+
+	MatMulTiling t = {m, n, p} ;
+	auto tiles = [&]() {
+		return (long long)((m + t.mt - 1)/t.mt) * ((n + t.nt - 1)/t.nt) * ((p + t.pt - 1)/t.pt) ;
+	} ;
+	while ((long long)t.mt*t.nt*t.pt > budget || tiles() < slots) {
+		// Rows and columns first: splitting the reduction costs a merge
+		// step (though no extra additions)
+		if (t.mt > 1 && t.mt >= t.pt)
+			t.mt = (t.mt + 1)/2 ;
+		else if (t.pt > 1)
+			t.pt = (t.pt + 1)/2 ;
+		else if (t.nt > 1) {
+			// Powers of two, so that the tree reduction of the partial sums
+			// adds in the same order as a single treesum over n
+			int pow2 = 1 ;
+			while (2*pow2 < t.nt)
+				pow2 *= 2 ;
+			t.nt = pow2 ;
+		}
+		else
+			break ;
+	}
+	return t ;
+}
+
+void MatMulTiled_thread(
+	int tid, int m, int n, int p, int m_bits, int e_bits, MatMulTiling t, MatMulTileFn tile_fn,
+	uint8_t *A_s, uint8_t *A_z, uint64_t *A_m, uint64_t *A_e,
+	uint8_t *B_s, uint8_t *B_z, uint64_t *B_m, uint64_t *B_e,
+	uint8_t **part_s, uint8_t **part_z, uint64_t **part_m, uint64_t **part_e
+	) {
+	int tiles_m = (m + t.mt - 1)/t.mt ;
+	int tiles_n = (n + t.nt - 1)/t.nt ;
+	int tiles_p = (p + t.pt - 1)/t.pt ;
+	int num_tiles = tiles_m*tiles_n*tiles_p ;
+
+	uint8_t *a_s = new uint8_t[t.mt*t.nt] ;
+	uint8_t *a_z = new uint8_t[t.mt*t.nt] ;
+	uint64_t *a_m = new uint64_t[t.mt*t.nt] ;
+	uint64_t *a_e = new uint64_t[t.mt*t.nt] ;
+	uint8_t *b_s = new uint8_t[t.nt*t.pt] ;
+	uint8_t *b_z = new uint8_t[t.nt*t.pt] ;
+	uint64_t *b_m = new uint64_t[t.nt*t.pt] ;
+	uint64_t *b_e = new uint64_t[t.nt*t.pt] ;
+
+	for (int tile = tid ; tile < num_tiles ; tile += __nt) {
+		int kb = tile % tiles_n ;
+		int jb = (tile / tiles_n) % tiles_p ;
+		int ib = tile / (tiles_n*tiles_p) ;
+		int i0 = ib*t.mt, k0 = kb*t.nt, j0 = jb*t.pt ;
+		int mt = min(t.mt, m - i0), nt = min(t.nt, n - k0), pt = min(t.pt, p - j0) ;
+
+		for (int i = 0, x = 0 ; i < mt ; i++) {
+			for (int k = 0 ; k < nt ; k++, x++) {
+				int y = (i0 + i)*n + k0 + k ;
+				a_s[x] = A_s[y] ; a_z[x] = A_z[y] ; a_m[x] = A_m[y] ; a_e[x] = A_e[y] ;
+			}
+		}
+		for (int k = 0, x = 0 ; k < nt ; k++) {
+			for (int j = 0 ; j < pt ; j++, x++) {
+				int y = (k0 + k)*p + j0 + j ;
+				b_s[x] = B_s[y] ; b_z[x] = B_z[y] ; b_m[x] = B_m[y] ; b_e[x] = B_e[y] ;
+			}
+		}
+
+		FPMatrix A_tile = fpopArr[tid]->input(WHICHPARTY, mt, nt, a_s, a_z, a_m, a_e, m_bits, e_bits) ;
+		FPMatrix B_tile = fpopArr[tid]->input(WHICHPARTY, nt, pt, b_s, b_z, b_m, b_e, m_bits, e_bits) ;
+		FPMatrix res = tile_fn(tid, A_tile, B_tile) ;
+
+		for (int i = 0, x = 0 ; i < mt ; i++) {
+			for (int j = 0 ; j < pt ; j++, x++) {
+				int y = (i0 + i)*p + j0 + j ;
+				part_s[kb][y] = res.s[x] ; part_z[kb][y] = res.z[x] ;
+				part_m[kb][y] = res.m[x] ; part_e[kb][y] = res.e[x] ;
+			}
+		}
+	}
+
+	delete[] a_s ; delete[] a_z ; delete[] a_m ; delete[] a_e ;
+	delete[] b_s ; delete[] b_z ; delete[] b_m ; delete[] b_e ;
+}
+
+void MatMulMerge_thread(
+	int tid, int chunk, int offset, int q, int m_bits, int e_bits,
+	uint8_t **part_s, uint8_t **part_z, uint64_t **part_m, uint64_t **part_e,
+	uint8_t *res_s, uint8_t *res_z, uint64_t *res_m, uint64_t *res_e
+	) {
+	uint8_t *s = new uint8_t[q] ;
+	uint8_t *z = new uint8_t[q] ;
+	uint64_t *mn = new uint64_t[q] ;
+	uint64_t *e = new uint64_t[q] ;
+	vector<FPArray> partials ;
+	for (int i = 0 ; i < chunk ; i++) {
+		for (int kb = 0 ; kb < q ; kb++) {
+			s[kb] = part_s[kb][offset + i] ; z[kb] = part_z[kb][offset + i] ;
+			mn[kb] = part_m[kb][offset + i] ; e[kb] = part_e[kb][offset + i] ;
+		}
+		partials.push_back(fpopArr[tid]->input(WHICHPARTY, q, s, z, mn, e, m_bits, e_bits)) ;
+	}
+	FPArray out = fpopArr[tid]->treesum(partials) ;
+
+	memcpy(res_s, out.s, chunk*sizeof(uint8_t)) ;
+	memcpy(res_z, out.z, chunk*sizeof(uint8_t)) ;
+	memcpy(res_m, out.m, chunk*sizeof(uint64_t)) ;
+	memcpy(res_e, out.e, chunk*sizeof(uint64_t)) ;
+
+	delete[] s ; delete[] z ; delete[] mn ; delete[] e ;
+}
+
+void MatMulTiled(int32_t m, int32_t n, int32_t p,
+	vector<vector<FPArray>> &A,
+	vector<vector<FPArray>> &B,
+	vector<vector<FPArray>> &C,
+	MatMulTileFn tile_fn, long long bytes_per_product) {
+	int m_bits = A[0][0].m_bits ;
+	int e_bits = A[0][0].e_bits ;
+
+	uint8_t *A_s = new uint8_t[m*n] ;
+	uint8_t *A_z = new uint8_t[m*n] ;
+	uint64_t *A_m = new uint64_t[m*n] ;
+	uint64_t *A_e = new uint64_t[m*n] ;
+	for (int i = 0, k = 0 ; i < m ; i++) {
+		for (int j = 0 ; j < n ; j++, k++) {
+			A_s[k] = A[i][j].s[0] ;
+			A_z[k] = A[i][j].z[0] ;
+			A_m[k] = A[i][j].m[0] ;
+			A_e[k] = A[i][j].e[0] ;
+		}
+	}
+
+	uint8_t *B_s = new uint8_t[n*p] ;
+	uint8_t *B_z = new uint8_t[n*p] ;
+	uint64_t *B_m = new uint64_t[n*p] ;
+	uint64_t *B_e = new uint64_t[n*p] ;
+	for (int i = 0, k = 0 ; i < n ; i++) {
+		for (int j = 0 ; j < p ; j++, k++) {
+			B_s[k] = B[i][j].s[0] ;
+			B_z[k] = B[i][j].z[0] ;
+			B_m[k] = B[i][j].m[0] ;
+			B_e[k] = B[i][j].e[0] ;
+		}
+	}
+
+	MatMulTiling t = get_matmul_tiling(m, n, p, __nt, bytes_per_product) ;
+	int q = (n + t.nt - 1)/t.nt ;
+
+	// Partial sums of each slice of the reduction dimension
+	uint8_t **part_s = new uint8_t*[q] ;
+	uint8_t **part_z = new uint8_t*[q] ;
+	uint64_t **part_m = new uint64_t*[q] ;
+	uint64_t **part_e = new uint64_t*[q] ;
+	for (int kb = 0 ; kb < q ; kb++) {
+		part_s[kb] = new uint8_t[m*p] ;
+		part_z[kb] = new uint8_t[m*p] ;
+		part_m[kb] = new uint64_t[m*p] ;
+		part_e[kb] = new uint64_t[m*p] ;
+	}
+
+	thread threads[MAX_THREADS] ;
+	for (int i = 0 ; i < __nt ; i++) {
+		threads[i] = thread(MatMulTiled_thread,
+			i, m, n, p, m_bits, e_bits, t, tile_fn,
+			A_s, A_z, A_m, A_e,
+			B_s, B_z, B_m, B_e,
+			part_s, part_z, part_m, part_e
+		) ;
+	}
+	for (int i = 0 ; i < __nt ; i++)
+		threads[i].join() ;
+
+	uint8_t *res_s = part_s[0] ;
+	uint8_t *res_z = part_z[0] ;
+	uint64_t *res_m = part_m[0] ;
+	uint64_t *res_e = part_e[0] ;
+	if (q > 1) {
+		res_s = new uint8_t[m*p] ;
+		res_z = new uint8_t[m*p] ;
+		res_m = new uint64_t[m*p] ;
+		res_e = new uint64_t[m*p] ;
+
+		vector<int> chunks = get_chunks(m*p, __nt) ;
+		int offset = 0 ;
+		for (int i = 0 ; i < __nt ; i++) {
+			if (chunks[i] > 0) {
+				threads[i] = thread(MatMulMerge_thread,
+					i, chunks[i], offset, q, m_bits, e_bits,
+					part_s, part_z, part_m, part_e,
+					res_s + offset, res_z + offset, res_m + offset, res_e + offset
+				) ;
+				offset += chunks[i] ;
+			}
+		}
+		for (int i = 0 ; i < __nt ; i++) {
+			if (chunks[i] > 0)
+				threads[i].join() ;
+		}
+	}
+
+	for (int i = 0, k = 0 ; i < m ; i++) {
+		for (int j = 0 ; j < p ; j++, k++) {
+			C[i][j].m_bits = m_bits ;
+			C[i][j].e_bits = e_bits ;
+
+			C[i][j].s[0] = res_s[k] ;
+			C[i][j].z[0] = res_z[k] ;
+			C[i][j].m[0] = res_m[k] ;
+			C[i][j].e[0] = res_e[k] ;
+		}
+	}
+
+	if (q > 1) {
+		delete[] res_s ; delete[] res_z ; delete[] res_m ; delete[] res_e ;
+	}
+	for (int kb = 0 ; kb < q ; kb++) {
+		delete[] part_s[kb] ; delete[] part_z[kb] ; delete[] part_m[kb] ; delete[] part_e[kb] ;
+	}
+	delete[] part_s ; delete[] part_z ; delete[] part_m ; delete[] part_e ;
+	delete[] A_s ; delete[] A_z ; delete[] A_m ; delete[] A_e ;
+	delete[] B_s ; delete[] B_z ; delete[] B_m ; delete[] B_e ;
+}
+
 tuple<BoolArray,BoolArray,FixArray,FixArray> get_components(int tid, const FPArray &x) {
   BoolArray x_s = boolopArr[tid]->input(x.party, x.size, x.s);
   BoolArray x_z = boolopArr[tid]->input(x.party, x.size, x.z);
@@ -0,0 +1,210 @@
+/*
+Copyright:
+Copyright (c) 2022 Microsoft Research
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef LINEAR_AUTOTUNE_H__
+#define LINEAR_AUTOTUNE_H__
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+// Protocols that MatMul2D (and hence Conv2D, which lowers to it) can use in
+// the OT build. All compute shares of the same cross terms, so the choice
+// can be made independently for every layer.
+enum class LinearProtocol {
+  Multithreaded = 0, // s2 split across num_threads (funcMatmulThread)
+  CrossTerms = 1,    // LinearOT on the main thread
+  Uniform = 2,       // MatMulUniform (IKNP) on the main thread
+  RingHE = 3,        // LinearRing (coefficient-encoded BFV over Z_2^l)
+};
+
+const int NumLinearProtocols = 4;
+
+inline const char *linearProtocolName(LinearProtocol p) {
+  switch (p) {
+  case LinearProtocol::Multithreaded:
+    return "Multithreaded";
+  case LinearProtocol::CrossTerms:
+    return "LinearOT";
+  case LinearProtocol::Uniform:
+    return "MatMulUniform";
+  case LinearProtocol::RingHE:
+    return "LinearRingHE";
+  }
+  return "?";
+}
+
+// Cost model for the linear-layer protocols, calibrated at startup.
+//
+// For a (s1 x s2) * (s2 x s3) product, communication and local compute of
+// every protocol are modelled as c0 + c1 * f1 + c2 * f2, and the number of
+// rounds as a constant. For the OT protocols f1 = s1*s2 counts OT instances
+// and f2 = s1*s2*s3 the payload they carry; RingHE costs grow with the
+// number of polynomial blocks instead, so it supplies its own features
+// (ciphertexts sent and plaintext products). The coefficients are fit from
+// three calibration runs per protocol; the predicted time of a layer is then
+//   rounds * rtt / 2 + bytes / bandwidth + compute.
+//
+// Both parties must pick the same protocol for every layer, so ALICE fits
+// the model from the measurements of both parties and sends it to BOB.
+struct LinearCostModel {
+  struct Fit {
+    double c0 = 0, c1 = 0, c2 = 0;
+
+    double eval(double f1, double f2) const { return c0 + c1 * f1 + c2 * f2; }
+  };
+
+  struct ProtocolModel {
+    bool available = false;
+    Fit bytes;      // bytes sent by the busier party
+    Fit computeUs;  // time not explained by rounds and bytes
+    double rounds = 0;
+  };
+
+  // Features of a product under a protocol; set locally by each party,
+  // null for the OT features
+  typedef void (*FeatureFn)(int s1, int s2, int s3, double &f1, double &f2);
+
+  double rttUs = 0;
+  double bytesPerUs = 0;
+  ProtocolModel protocols[NumLinearProtocols];
+  FeatureFn features[NumLinearProtocols] = {};
+
+  // Calibration shapes: (s1, s2, s3). The OT shapes are all too small to
+  // tell apart in polynomial blocks, so RingHE has its own: one block, one
+  // input block per 8192 rows of s2, and many blocks on both sides.
+  static constexpr int numShapes = 3;
+  static constexpr int shapes[numShapes][3] = {
+      {16, 64, 1}, {16, 64, 32}, {64, 64, 1}};
+  static constexpr int ringHEShapes[numShapes][3] = {
+      {1, 64, 1}, {1, 32768, 1}, {128, 128, 128}};
+
+  static const int (*calibrationShapes(LinearProtocol p))[3] {
+    return p == LinearProtocol::RingHE ? ringHEShapes : shapes;
+  }
+
+  void featuresOf(LinearProtocol p, int s1, int s2, int s3, double &f1,
+                  double &f2) const {
+    if (features[int(p)] != nullptr) {
+      features[int(p)](s1, s2, s3, f1, f2);
+    } else {
+      f1 = double(s1) * s2;
+      f2 = f1 * s3;
+    }
+  }
+
+  double predictUs(LinearProtocol p, int s1, int s2, int s3) const {
+    const ProtocolModel &m = protocols[int(p)];
+    double f1, f2;
+    featuresOf(p, s1, s2, s3, f1, f2);
+    double us = m.rounds * rttUs / 2 + m.computeUs.eval(f1, f2);
+    if (bytesPerUs > 0)
+      us += m.bytes.eval(f1, f2) / bytesPerUs;
+    return us;
+  }
+
+  LinearProtocol choose(int s1, int s2, int s3,
+                        LinearProtocol fallback) const {
+    LinearProtocol best = fallback;
+    double bestUs = -1;
+    for (int i = 0; i < NumLinearProtocols; i++) {
+      if (!protocols[i].available)
+        continue;
+      double us = predictUs(LinearProtocol(i), s1, s2, s3);
+      if (bestUs < 0 || us < bestUs) {
+        best = LinearProtocol(i);
+        bestUs = us;
+      }
+    }
+    return best;
+  }
+
+  // Fits c0 + c1 * f1 + c2 * f2 to the measurements y[] at the features
+  // f1[], f2[] of the calibration shapes. A coefficient that comes out
+  // negative is clamped at 0 and the others are refit, so that noise in
+  // small measurements cannot produce negative costs for large layers.
+  static Fit fit(const double f1[numShapes], const double f2[numShapes],
+                 const double y[numShapes]) {
+    // Shapes 0 and 1 differ in f2 at least, shapes 0 and 2 in f1
+    Fit r;
+    double d1[2] = {f1[1] - f1[0], f1[2] - f1[0]};
+    double d2[2] = {f2[1] - f2[0], f2[2] - f2[0]};
+    double dy[2] = {y[1] - y[0], y[2] - y[0]};
+    double det = d1[0] * d2[1] - d1[1] * d2[0];
+    if (det != 0) {
+      r.c1 = (dy[0] * d2[1] - dy[1] * d2[0]) / det;
+      r.c2 = (d1[0] * dy[1] - d1[1] * dy[0]) / det;
+    }
+    if (det == 0 || r.c2 < 0) {
+      r.c2 = 0;
+      r.c1 = std::max(0.0, dy[1] / d1[1]);
+    } else if (r.c1 < 0) {
+      r.c1 = 0;
+      r.c2 = std::max(0.0, dy[0] / d2[0]);
+    }
+    r.c0 = std::max(0.0, y[0] - r.c1 * f1[0] - r.c2 * f2[0]);
+    return r;
+  }
+
+  // Raw layout used to ship the fitted model from ALICE to BOB
+  static constexpr int numDoubles = 2 + NumLinearProtocols * 8;
+
+  void serialize(double *out) const {
+    int k = 0;
+    out[k++] = rttUs;
+    out[k++] = bytesPerUs;
+    for (int i = 0; i < NumLinearProtocols; i++) {
+      const ProtocolModel &m = protocols[i];
+      out[k++] = m.available ? 1 : 0;
+      out[k++] = m.rounds;
+      out[k++] = m.bytes.c0;
+      out[k++] = m.bytes.c1;
+      out[k++] = m.bytes.c2;
+      out[k++] = m.computeUs.c0;
+      out[k++] = m.computeUs.c1;
+      out[k++] = m.computeUs.c2;
+    }
+  }
+
+  void deserialize(const double *in) {
+    int k = 0;
+    rttUs = in[k++];
+    bytesPerUs = in[k++];
+    for (int i = 0; i < NumLinearProtocols; i++) {
+      ProtocolModel &m = protocols[i];
+      m.available = in[k++] != 0;
+      m.rounds = in[k++];
+      m.bytes.c0 = in[k++];
+      m.bytes.c1 = in[k++];
+      m.bytes.c2 = in[k++];
+      m.computeUs.c0 = in[k++];
+      m.computeUs.c1 = in[k++];
+      m.computeUs.c2 = in[k++];
+    }
+  }
+};
+
+// Per-layer selection is opt-in: set EZPC_LINEAR_AUTOTUNE=1 on both parties
+inline bool linearAutotuneRequested() {
+  const char *v = std::getenv("EZPC_LINEAR_AUTOTUNE");
+  return v != nullptr && v[0] != '\0' && v[0] != '0';
+}
+
+#endif // LINEAR_AUTOTUNE_H__
@@ -101,15 +101,92 @@ AES_set_encrypt_key(const block128 userkey, AES_KEY *key) {
   key->rounds = 10;
 }
 
+// Number of blocks kept in flight by the AES-NI kernel: enough independent
+// aesenc chains to cover the instruction latency
+#define AES_NI_INTERLEAVE 8
+// Number of blocks kept in flight by the VAES kernel (8 zmm registers of 4
+// blocks each)
+#define AES_VAES_INTERLEAVE 32
+
+// Encrypts groups of AES_NI_INTERLEAVE blocks with all rounds applied while
+// the blocks stay in registers, instead of sweeping every round over the
+// whole (up to AES_BATCH_SIZE blocks) buffer
 inline void __attribute__((target("aes,sse2")))
-AES_ecb_encrypt_blks(block128 *blks, unsigned int nblks, const AES_KEY *key) {
-  for (unsigned int i = 0; i < nblks; ++i)
-    blks[i] = _mm_xor_si128(blks[i], key->rd_key[0]);
-  for (unsigned int j = 1; j < key->rounds; ++j)
-    for (unsigned int i = 0; i < nblks; ++i)
-      blks[i] = _mm_aesenc_si128(blks[i], key->rd_key[j]);
-  for (unsigned int i = 0; i < nblks; ++i)
-    blks[i] = _mm_aesenclast_si128(blks[i], key->rd_key[key->rounds]);
+AES_ecb_encrypt_blks_ni(block128 *blks, unsigned int nblks,
+                        const AES_KEY *key) {
+  const unsigned int rounds = key->rounds;
+  unsigned int i = 0;
+  for (; i + AES_NI_INTERLEAVE <= nblks; i += AES_NI_INTERLEAVE) {
+    block128 x[AES_NI_INTERLEAVE];
+    for (int k = 0; k < AES_NI_INTERLEAVE; ++k)
+      x[k] = _mm_xor_si128(_mm_loadu_si128(blks + i + k), key->rd_key[0]);
+    for (unsigned int j = 1; j < rounds; ++j)
+      for (int k = 0; k < AES_NI_INTERLEAVE; ++k)
+        x[k] = _mm_aesenc_si128(x[k], key->rd_key[j]);
+    for (int k = 0; k < AES_NI_INTERLEAVE; ++k)
+      _mm_storeu_si128(blks + i + k,
+                       _mm_aesenclast_si128(x[k], key->rd_key[rounds]));
+  }
+  for (; i < nblks; ++i) {
+    block128 x = _mm_xor_si128(blks[i], key->rd_key[0]);
+    for (unsigned int j = 1; j < rounds; ++j)
+      x = _mm_aesenc_si128(x, key->rd_key[j]);
+    blks[i] = _mm_aesenclast_si128(x, key->rd_key[rounds]);
+  }
+}
+
+#ifdef __x86_64__
+// VAES: four blocks per instruction with the round keys broadcast to all
+// four lanes; the tail is handled with masked loads and stores
+inline void __attribute__((target("aes,vaes,avx512f")))
+AES_ecb_encrypt_blks_vaes(block128 *blks, unsigned int nblks,
+                          const AES_KEY *key) {
+  const unsigned int rounds = key->rounds;
+  const int lanes = AES_VAES_INTERLEAVE / 4;
+  __m512i rk[15];
+  for (unsigned int j = 0; j <= rounds; ++j)
+    rk[j] = _mm512_broadcast_i32x4(key->rd_key[j]);
+  unsigned int i = 0;
+  for (; i + AES_VAES_INTERLEAVE <= nblks; i += AES_VAES_INTERLEAVE) {
+    __m512i x[lanes];
+    for (int k = 0; k < lanes; ++k)
+      x[k] = _mm512_xor_si512(_mm512_loadu_si512(blks + i + 4 * k), rk[0]);
+    for (unsigned int j = 1; j < rounds; ++j)
+      for (int k = 0; k < lanes; ++k)
+        x[k] = _mm512_aesenc_epi128(x[k], rk[j]);
+    for (int k = 0; k < lanes; ++k)
+      _mm512_storeu_si512(blks + i + 4 * k,
+                          _mm512_aesenclast_epi128(x[k], rk[rounds]));
+  }
+  for (; i < nblks; i += 4) {
+    const __mmask8 m =
+        (nblks - i >= 4) ? 0xFF : (__mmask8)((1 << (2 * (nblks - i))) - 1);
+    __m512i x =
+        _mm512_xor_si512(_mm512_maskz_loadu_epi64(m, blks + i), rk[0]);
+    for (unsigned int j = 1; j < rounds; ++j)
+      x = _mm512_aesenc_epi128(x, rk[j]);
+    _mm512_mask_storeu_epi64(blks + i, m,
+                             _mm512_aesenclast_epi128(x, rk[rounds]));
+  }
+}
+
+// Whether the CPU we are running on has 512-bit VAES; checked once
+inline bool AES_has_vaes() {
+  static const bool has_vaes =
+      __builtin_cpu_supports("vaes") && __builtin_cpu_supports("avx512f");
+  return has_vaes;
+}
+#endif
+
+inline void AES_ecb_encrypt_blks(block128 *blks, unsigned int nblks,
+                                 const AES_KEY *key) {
+#ifdef __x86_64__
+  if (nblks >= 4 && AES_has_vaes()) {
+    AES_ecb_encrypt_blks_vaes(blks, nblks, key);
+    return;
+  }
+#endif
+  AES_ecb_encrypt_blks_ni(blks, nblks, key);
 }
 
 inline void __attribute__((target("aes,sse2")))
@@ -0,0 +1,194 @@
+/*
+Copyright:
+Copyright (c) 2022 Microsoft Research
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// AES-128 under many keys at once, shared by FSS and LLAMA/sytorch, which
+// include it as utils/aes_multikey.h.
+//
+// Most AES calls in the DCF use a fresh key (the seed of a tree node) for
+// only two to four blocks, so the key schedule costs more than the
+// encryption and, done one key at a time as by osuCrypto::AES, is a single
+// dependent chain of aeskeygenassist. encrypt() expands the schedules of
+// many keys at once, round by round and interleaved with the encryptions
+// under them, so that nothing but the current round key is kept.
+// With VAES (AVX-512) four keys share one instruction; otherwise AES-NI is
+// used with eight keys in flight. The choice is made once at runtime.
+
+#ifndef EZPC_AES_MULTIKEY_H__
+#define EZPC_AES_MULTIKEY_H__
+#include <cassert>
+#include <immintrin.h>
+
+namespace aes_multikey {
+
+// The most blocks encrypted under one key
+constexpr int maxBlocks = 4;
+
+// Round constants of the AES-128 key schedule
+constexpr int rcons[10] = {0x01, 0x02, 0x04, 0x08, 0x10,
+                           0x20, 0x40, 0x80, 0x1b, 0x36};
+
+// One step of the AES-128 key schedule. aeskeygenassist has no 512-bit form
+// and a low throughput, so SubWord(RotWord(w3)) ^ rcon is computed instead
+// by broadcasting RotWord(w3) to all four columns (which makes ShiftRows a
+// no-op) and applying aesenclast with rcon as the round key.
+inline __attribute__((target("aes,ssse3"))) __m128i expandNI(__m128i k,
+                                                             __m128i rcon) {
+  const __m128i rot = _mm_set1_epi32(0x0c0f0e0d);
+  __m128i t = _mm_aesenclast_si128(_mm_shuffle_epi8(k, rot), rcon);
+  k = _mm_xor_si128(k, _mm_slli_si128(k, 4));
+  k = _mm_xor_si128(k, _mm_slli_si128(k, 8));
+  return _mm_xor_si128(k, t);
+}
+
+// G keys with B blocks each
+template <int G, int B>
+__attribute__((target("aes,ssse3"))) void
+encryptNI(const __m128i *keys, const __m128i *pt, __m128i *ct) {
+  __m128i k[G], x[G][B];
+  for (int g = 0; g < G; ++g) {
+    k[g] = keys[g];
+    for (int b = 0; b < B; ++b)
+      x[g][b] = _mm_xor_si128(pt[g * B + b], k[g]);
+  }
+  for (int r = 0; r < 10; ++r) {
+    const __m128i rcon = _mm_set1_epi32(rcons[r]);
+    for (int g = 0; g < G; ++g)
+      k[g] = expandNI(k[g], rcon);
+    for (int g = 0; g < G; ++g)
+      for (int b = 0; b < B; ++b)
+        x[g][b] = (r < 9) ? _mm_aesenc_si128(x[g][b], k[g])
+                          : _mm_aesenclast_si128(x[g][b], k[g]);
+  }
+  for (int g = 0; g < G; ++g)
+    for (int b = 0; b < B; ++b)
+      ct[g * B + b] = x[g][b];
+}
+
+inline __attribute__((target("aes,vaes,avx512f,avx512bw"))) __m512i
+expandVAES(__m512i k, __m512i rcon) {
+  const __m512i rot = _mm512_set1_epi32(0x0c0f0e0d);
+  __m512i t = _mm512_aesenclast_epi128(_mm512_shuffle_epi8(k, rot), rcon);
+  k = _mm512_xor_si512(k, _mm512_bslli_epi128(k, 4));
+  k = _mm512_xor_si512(k, _mm512_bslli_epi128(k, 8));
+  return _mm512_xor_si512(k, t);
+}
+
+// 4 * Z keys with B blocks each; lane l of the z-th register holds key
+// 4 * z + l, and the b-th data register of a group its b-th blocks
+template <int Z, int B>
+__attribute__((target("aes,vaes,avx512f,avx512bw"))) void
+encryptVAES(const __m128i *keys, const __m128i *pt, __m128i *ct) {
+  __m512i k[Z], x[Z][B];
+  for (int z = 0; z < Z; ++z) {
+    k[z] = _mm512_loadu_si512(keys + 4 * z);
+    for (int b = 0; b < B; ++b) {
+      const __m128i *p = pt + 4 * z * B + b;
+      __m512i v = _mm512_castsi128_si512(p[0]);
+      v = _mm512_inserti32x4(v, p[B], 1);
+      v = _mm512_inserti32x4(v, p[2 * B], 2);
+      v = _mm512_inserti32x4(v, p[3 * B], 3);
+      x[z][b] = _mm512_xor_si512(v, k[z]);
+    }
+  }
+  for (int r = 0; r < 10; ++r) {
+    const __m512i rcon = _mm512_set1_epi32(rcons[r]);
+    for (int z = 0; z < Z; ++z)
+      k[z] = expandVAES(k[z], rcon);
+    for (int z = 0; z < Z; ++z)
+      for (int b = 0; b < B; ++b)
+        x[z][b] = (r < 9) ? _mm512_aesenc_epi128(x[z][b], k[z])
+                          : _mm512_aesenclast_epi128(x[z][b], k[z]);
+  }
+  for (int z = 0; z < Z; ++z)
+    for (int b = 0; b < B; ++b) {
+      __m128i *c = ct + 4 * z * B + b;
+      c[0] = _mm512_extracti32x4_epi32(x[z][b], 0);
+      c[B] = _mm512_extracti32x4_epi32(x[z][b], 1);
+      c[2 * B] = _mm512_extracti32x4_epi32(x[z][b], 2);
+      c[3 * B] = _mm512_extracti32x4_epi32(x[z][b], 3);
+    }
+}
+
+inline bool hasVAES() {
+  static const bool has = __builtin_cpu_supports("vaes") &&
+                          __builtin_cpu_supports("avx512f") &&
+                          __builtin_cpu_supports("avx512bw");
+  return has;
+}
+
+template <int B>
+void encryptB(int n, const __m128i *keys, const __m128i *pt, __m128i *ct) {
+  int i = 0;
+  if (hasVAES()) {
+    // 16 keys in flight, then groups of 4 with the last one padded
+    for (; i + 16 <= n; i += 16)
+      encryptVAES<4, B>(keys + i, pt + i * B, ct + i * B);
+    for (; i + 4 <= n; i += 4)
+      encryptVAES<1, B>(keys + i, pt + i * B, ct + i * B);
+    if (i < n) {
+      __m128i k[4], x[4 * B];
+      for (int j = 0; j < 4; ++j)
+        k[j] = (i + j < n) ? keys[i + j] : _mm_setzero_si128();
+      for (int j = 0; j < 4 * B; ++j)
+        x[j] = (i * B + j < n * B) ? pt[i * B + j] : _mm_setzero_si128();
+      encryptVAES<1, B>(k, x, x);
+      for (int j = 0; i * B + j < n * B; ++j)
+        ct[i * B + j] = x[j];
+    }
+    return;
+  }
+  // enough independent aesenc chains to cover the latency without
+  // running out of xmm registers
+  const int G = (B == 1) ? 8 : (B == 2) ? 4 : 2;
+  for (; i + G <= n; i += G)
+    encryptNI<G, B>(keys + i, pt + i * B, ct + i * B);
+  for (; i < n; ++i)
+    encryptNI<1, B>(keys + i, pt + i * B, ct + i * B);
+}
+
+// For i < n, encrypts pt[i * blocksPerKey + j] (j < blocksPerKey) under the
+// AES-128 key keys[i] into ct[i * blocksPerKey + j]; the result is the same
+// as osuCrypto::AES(keys[i]).ecbEncBlocks. pt and ct may alias.
+inline void encrypt(int n, const __m128i *keys, const __m128i *pt,
+                    int blocksPerKey, __m128i *ct) {
+  switch (blocksPerKey) {
+  case 1:
+    encryptB<1>(n, keys, pt, ct);
+    break;
+  case 2:
+    encryptB<2>(n, keys, pt, ct);
+    break;
+  case 3:
+    encryptB<3>(n, keys, pt, ct);
+    break;
+  case 4:
+    encryptB<4>(n, keys, pt, ct);
+    break;
+  default:
+    assert(false && "aes_multikey::encrypt: too many blocks per key");
+  }
+}
+
+// Which of the kernels above is in use: "vaes" or "aes-ni"
+inline const char *engine() { return hasVAES() ? "vaes" : "aes-ni"; }
+
+} // namespace aes_multikey
+
+#endif // EZPC_AES_MULTIKEY_H__
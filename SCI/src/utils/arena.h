@@ -0,0 +1,121 @@
+/*
+Copyright:
+Copyright (c) 2022 Microsoft Research
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef SCI_ARENA_H__
+#define SCI_ARENA_H__
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace sci {
+
+// Bump allocator for scratch buffers whose lifetime is a single protocol call.
+// Pointers returned by alloc() stay valid until the next reset(). When a call
+// needs more memory than is available, a new chunk is appended (existing
+// pointers are untouched); reset() then coalesces all chunks into one, so
+// once the arena has seen the largest call size, the hot path performs no
+// heap allocations.
+class ScratchArena {
+public:
+  static constexpr size_t alignment = 64;
+  static constexpr size_t min_chunk_size = 1 << 12;
+
+  ScratchArena(size_t initial_bytes = 0) {
+    if (initial_bytes)
+      add_chunk(initial_bytes);
+  }
+
+  ~ScratchArena() { release(); }
+
+  ScratchArena(const ScratchArena &) = delete;
+  ScratchArena &operator=(const ScratchArena &) = delete;
+
+  // Uninitialized, 64-byte aligned buffer of n elements of type T
+  template <typename T> T *alloc(size_t n) {
+    size_t nbytes = round_up(n * sizeof(T));
+    if (chunks.empty() || (used + nbytes > chunks.back().size)) {
+      add_chunk(std::max(nbytes, capacity()));
+    }
+    T *ptr = reinterpret_cast<T *>(chunks.back().data + used);
+    used += nbytes;
+    return ptr;
+  }
+
+  // rows X cols matrix backed by one flat buffer; returns the row pointers
+  // (as expected by the OT send APIs)
+  template <typename T> T **alloc_2d(size_t rows, size_t cols) {
+    T *flat = alloc<T>(rows * cols);
+    T **ptrs = alloc<T *>(rows);
+    for (size_t i = 0; i < rows; i++)
+      ptrs[i] = flat + i * cols;
+    return ptrs;
+  }
+
+  // Invalidates all outstanding buffers
+  void reset() {
+    if (chunks.size() > 1) {
+      size_t total = capacity();
+      release();
+      add_chunk(total);
+    }
+    used = 0;
+  }
+
+  size_t capacity() const {
+    size_t total = 0;
+    for (auto &c : chunks)
+      total += c.size;
+    return total;
+  }
+
+private:
+  struct Chunk {
+    uint8_t *data;
+    size_t size;
+  };
+  std::vector<Chunk> chunks;
+  size_t used = 0;
+
+  static size_t round_up(size_t nbytes) {
+    return (nbytes + alignment - 1) & ~(alignment - 1);
+  }
+
+  void add_chunk(size_t nbytes) {
+    nbytes = round_up(std::max(nbytes, min_chunk_size));
+    uint8_t *data = (uint8_t *)std::aligned_alloc(alignment, nbytes);
+    if (data == nullptr)
+      throw std::bad_alloc();
+    chunks.push_back({data, nbytes});
+    used = 0;
+  }
+
+  void release() {
+    for (auto &c : chunks)
+      std::free(c.data);
+    chunks.clear();
+    used = 0;
+  }
+};
+
+} // namespace sci
+#endif // SCI_ARENA_H__
@@ -0,0 +1,221 @@
+/*
+Copyright:
+Copyright (c) 2022 Microsoft Research
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Binary fixed-point inputs for EzPC-generated programs, shared by SCI and
+// FSS (which includes it from here as "utils/binary_input.h").
+//
+// By default generated programs read their inputs (model weights on the
+// server, the image on the client) as decimal integers from stdin. If
+// EZPC_INPUT_FILE names a binary input file, the values are taken from that
+// file instead: it is mmapped and every input array is bulk-copied out of
+// it, so loading a large model costs little more than reading the file.
+//
+// The file holds the same sequence of values that would be fed on stdin,
+// i.e. the inputs owned by this party in program order. Layout (all
+// integers little-endian):
+//
+//   char     magic[8] = "EZPCINP1"
+//   records, each with a 16 byte header
+//     uint32 kind    0: raw, 1: PRG
+//     uint32 bits    PRG only: values are uniform in [-2^(bits-1), 2^(bits-1))
+//     uint64 count   number of values in the record
+//   followed by
+//     raw: count int64 values
+//     PRG: uint64 seed; value i is expand(seed, i), see prgValue()
+//
+// Record boundaries need not match input boundaries. PRG records let a
+// party feed random weights/inputs of any size (e.g. for benchmarking)
+// from a file of a few bytes. Athos/CompilerScripts/convert_fixedpt_to_binary.py
+// writes both kinds.
+
+#ifndef EZPC_BINARY_INPUT_H__
+#define EZPC_BINARY_INPUT_H__
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+
+namespace binary_input {
+
+const char magic[8] = {'E', 'Z', 'P', 'C', 'I', 'N', 'P', '1'};
+
+enum RecordKind : uint32_t { Raw = 0, PRG = 1 };
+
+struct RecordHeader {
+  uint32_t kind;
+  uint32_t bits;
+  uint64_t count;
+};
+static_assert(sizeof(RecordHeader) == 16, "unexpected RecordHeader layout");
+
+// splitmix64 on seed + (i + 1) * golden ratio; cheap, stateless per index,
+// and easy to reproduce in the conversion script
+inline int64_t prgValue(uint64_t seed, uint64_t i, uint32_t bits) {
+  uint64_t z = seed + (i + 1) * 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z ^= z >> 31;
+  if (bits == 0 || bits >= 64)
+    return int64_t(z);
+  // sign-extend the low `bits` bits
+  uint64_t m = uint64_t(1) << (bits - 1);
+  z &= (m << 1) - 1;
+  return int64_t((z ^ m) - m);
+}
+
+class Reader {
+public:
+  // Returns the reader for EZPC_INPUT_FILE, or null if it is not set
+  static Reader *instance() {
+    static Reader *reader = fromEnv();
+    return reader;
+  }
+
+  Reader(const std::string &path) : path(path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      perror(("binary_input: " + path).c_str());
+      exit(1);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || size_t(st.st_size) < sizeof(magic)) {
+      fprintf(stderr, "binary_input: %s is not an input file\n",
+              path.c_str());
+      exit(1);
+    }
+    size = st.st_size;
+    void *p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+      perror(("binary_input: mmap " + path).c_str());
+      exit(1);
+    }
+    madvise(p, size, MADV_SEQUENTIAL);
+    base = (const uint8_t *)p;
+    if (memcmp(base, magic, sizeof(magic)) != 0) {
+      fprintf(stderr, "binary_input: %s: bad magic\n", path.c_str());
+      exit(1);
+    }
+    pos = sizeof(magic);
+  }
+
+  ~Reader() { munmap((void *)base, size); }
+
+  Reader(const Reader &) = delete;
+  Reader &operator=(const Reader &) = delete;
+
+  // Copies the next n values into out, converting to T
+  template <typename T> void read(T *out, size_t n) {
+    while (n > 0) {
+      if (left == 0)
+        nextRecord();
+      size_t k = (n < left) ? n : left;
+      if (cur.kind == Raw) {
+        const int64_t *src = (const int64_t *)(base + pos) + done;
+        if constexpr (std::is_integral<T>::value &&
+                      sizeof(T) == sizeof(int64_t)) {
+          memcpy(out, src, k * sizeof(int64_t));
+        } else {
+          for (size_t i = 0; i < k; i++)
+            out[i] = T(src[i]);
+        }
+      } else {
+        for (size_t i = 0; i < k; i++)
+          out[i] = T(prgValue(seed, done + i, cur.bits));
+      }
+      out += k;
+      n -= k;
+      done += k;
+      left -= k;
+      if (left == 0 && cur.kind == Raw)
+        pos += cur.count * sizeof(int64_t);
+    }
+  }
+
+private:
+  std::string path;
+  const uint8_t *base = nullptr;
+  size_t size = 0;
+  size_t pos = 0; // start of the current record's payload
+  RecordHeader cur = {Raw, 0, 0};
+  uint64_t seed = 0;
+  uint64_t done = 0, left = 0;
+
+  static Reader *fromEnv() {
+    const char *path = std::getenv("EZPC_INPUT_FILE");
+    if (path == nullptr || path[0] == '\0')
+      return nullptr;
+    return new Reader(path);
+  }
+
+  void need(size_t n) {
+    if (pos + n > size) {
+      fprintf(stderr, "binary_input: %s: ran out of input values\n",
+              path.c_str());
+      exit(1);
+    }
+  }
+
+  void nextRecord() {
+    do {
+      need(sizeof(RecordHeader));
+      memcpy(&cur, base + pos, sizeof(RecordHeader));
+      pos += sizeof(RecordHeader);
+      if (cur.kind == Raw) {
+        need(cur.count * sizeof(int64_t));
+      } else if (cur.kind == PRG) {
+        need(sizeof(seed));
+        memcpy(&seed, base + pos, sizeof(seed));
+        pos += sizeof(seed);
+      } else {
+        fprintf(stderr, "binary_input: %s: unknown record kind %u\n",
+                path.c_str(), cur.kind);
+        exit(1);
+      }
+      done = 0;
+      left = cur.count;
+    } while (left == 0);
+  }
+};
+
+// Fills the n values of an input that this party owns (owner) from the
+// binary input file, or zeros them if it does not. Returns false if no
+// binary input file was given; the caller then reads stdin as before.
+template <typename T> bool readArray(T *out, size_t n, bool owner) {
+  Reader *reader = Reader::instance();
+  if (reader == nullptr)
+    return false;
+  if (owner)
+    reader->read(out, n);
+  else
+    std::fill(out, out + n, T(0));
+  return true;
+}
+
+} // namespace binary_input
+
+#endif // EZPC_BINARY_INPUT_H__
@@ -26,6 +26,7 @@ Enquiries about further applications and development opportunities are welcome.
 #define NETWORK_IO_CHANNEL
 
 #include "utils/io_channel.h"
+#include "utils/netem.h"
 #include <iostream>
 #include <stdio.h>
 #include <stdlib.h>
@@ -58,9 +59,12 @@ public:
   string addr;
   int port;
   uint64_t counter = 0;
+  uint64_t recv_counter = 0;
   uint64_t num_rounds = 0;
   bool FBF_mode;
   LastCall last_call = LastCall::None;
+  // Emulated link (see utils/netem.h); null unless EZPC_NETEM is set
+  netem::Link *link = nullptr;
   NetIO(const char *address, int port, bool full_buffer = false,
         bool quiet = false) {
     this->port = port;
@@ -120,6 +124,7 @@ public:
       setvbuf(stream, buffer, _IONBF, NETWORK_BUFFER_SIZE);
     }
     this->FBF_mode = full_buffer;
+    link = netem::Link::fromEnv(consocket);
     if (!quiet)
       std::cout << "connected\n";
   }
@@ -138,6 +143,7 @@ public:
 
   ~NetIO() {
     fflush(stream);
+    delete link;
     close(consocket);
     delete[] buffer;
   }
@@ -170,6 +176,11 @@ public:
       last_call = LastCall::Send;
     }
     counter += len;
+    has_sent = true;
+    if (link != nullptr) {
+      link->send(data, len);
+      return;
+    }
     int sent = 0;
     while (sent < len) {
       int res = fwrite(sent + (char *)data, 1, len - sent, stream);
@@ -178,7 +189,6 @@ public:
       else
         fprintf(stderr, "error: net_send_data %d\n", res);
     }
-    has_sent = true;
   }
 
   void recv_data(void *data, int len) {
@@ -189,6 +199,7 @@ public:
     if (has_sent)
       fflush(stream);
     has_sent = false;
+    recv_counter += len;
     int sent = 0;
     while (sent < len) {
       int res = fread(sent + (char *)data, 1, len - sent, stream);
@@ -0,0 +1,311 @@
+/*
+Copyright:
+Copyright (c) 2022 Microsoft Research
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Network emulation shared by SCI (NetIO), FSS and LLAMA (Peer). FSS and
+// LLAMA include it from SCI/src.
+//
+// Emulation is off unless EZPC_NETEM is set in the environment, e.g.
+//   EZPC_NETEM=wan                      named profile (see namedProfile())
+//   EZPC_NETEM=rtt=40,bw=1000,jitter=2  RTT/jitter in ms, bandwidth in Mbit/s
+//   EZPC_NETEM=wan,bw=100               named profile with overrides
+// Both parties must set the same profile: each side delays its own outgoing
+// traffic by half the RTT, so a send followed by the reply costs one RTT.
+//
+// Outgoing bytes are not written to the socket directly. send() stamps them
+// with a delivery time (one-way latency + jitter + serialization at the
+// configured bandwidth, queued behind earlier traffic) and a writer thread
+// hands them to the socket once that time is reached. Byte order is
+// preserved, and the caller never blocks, so parallel send/recv code paths
+// behave as they would on a real link.
+
+#ifndef EZPC_NETEM_H__
+#define EZPC_NETEM_H__
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <set>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <vector>
+
+namespace netem {
+
+struct Profile {
+  std::string name;
+  double rttMs = 0;         // round-trip latency
+  double bandwidthMbps = 0; // per direction; 0 means unlimited
+  double jitterMs = 0;      // uniform in [0, jitterMs] per message
+
+  bool active() const { return rttMs > 0 || bandwidthMbps > 0 || jitterMs > 0; }
+};
+
+// Rough figures for the settings reported in the CrypTFlow2 / SIRNN papers
+// plus a metro-area link in between.
+inline bool namedProfile(const std::string &name, Profile &p) {
+  if (name == "lan") {
+    p.rttMs = 0.3;
+    p.bandwidthMbps = 3000;
+  } else if (name == "metro") {
+    p.rttMs = 10;
+    p.bandwidthMbps = 1000;
+  } else if (name == "wan") {
+    p.rttMs = 80;
+    p.bandwidthMbps = 320;
+  } else if (name == "none") {
+    p.rttMs = p.bandwidthMbps = p.jitterMs = 0;
+  } else {
+    return false;
+  }
+  p.name = name;
+  return true;
+}
+
+inline bool applyProfileToken(const std::string &tok, Profile &p) {
+  size_t eq = tok.find('=');
+  if (eq == std::string::npos) {
+    std::string name = p.name;
+    bool ok = namedProfile(tok, p);
+    p.name = name;
+    return ok;
+  }
+  char *rest = nullptr;
+  double v = std::strtod(tok.c_str() + eq + 1, &rest);
+  if (rest == tok.c_str() + eq + 1 || *rest != '\0' || v < 0)
+    return false;
+  std::string key = tok.substr(0, eq);
+  if (key == "rtt")
+    p.rttMs = v;
+  else if (key == "bw")
+    p.bandwidthMbps = v;
+  else if (key == "jitter")
+    p.jitterMs = v;
+  else
+    return false;
+  return true;
+}
+
+// Parses "<name>", "key=value,..." or "<name>,key=value,...". Keys are rtt,
+// bw and jitter. Returns false (and leaves p inactive) on malformed input.
+inline bool parseProfile(const std::string &spec, Profile &p) {
+  p = Profile();
+  p.name = spec;
+  size_t pos = 0;
+  while (pos < spec.size()) {
+    size_t end = spec.find(',', pos);
+    if (end == std::string::npos)
+      end = spec.size();
+    std::string tok = spec.substr(pos, end - pos);
+    pos = end + 1;
+    if (!tok.empty() && !applyProfileToken(tok, p)) {
+      fprintf(stderr, "netem: could not parse profile \"%s\"\n", spec.c_str());
+      p = Profile();
+      return false;
+    }
+  }
+  return true;
+}
+
+inline Profile profileFromEnv() {
+  Profile p;
+  const char *spec = std::getenv("EZPC_NETEM");
+  if (spec != nullptr && spec[0] != '\0')
+    parseProfile(spec, p);
+  return p;
+}
+
+class Link;
+
+// Live links, drained at exit: the SCI tests and several drivers exit
+// without tearing down their channels, and bytes still in the delay queue
+// would otherwise be lost.
+class Registry {
+public:
+  static Registry &instance() {
+    static Registry registry;
+    return registry;
+  }
+
+  void add(Link *l) {
+    std::lock_guard<std::mutex> lock(mtx);
+    links.insert(l);
+  }
+
+  void remove(Link *l) {
+    std::lock_guard<std::mutex> lock(mtx);
+    links.erase(l);
+  }
+
+  inline ~Registry();
+
+private:
+  std::mutex mtx;
+  std::set<Link *> links;
+};
+
+// One direction of an emulated link, wrapping an already connected socket.
+class Link {
+public:
+  typedef std::chrono::steady_clock clock;
+
+  Link(int fd, const Profile &profile)
+      : fd(fd), profile(profile), rng(fd * 7919 + 1) {
+    writer = std::thread(&Link::run, this);
+    Registry::instance().add(this);
+  }
+
+  ~Link() {
+    Registry::instance().remove(this);
+    drain();
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      stopping = true;
+    }
+    cv.notify_all();
+    writer.join();
+  }
+
+  Link(const Link &) = delete;
+  Link &operator=(const Link &) = delete;
+
+  // Returns a link for fd if EZPC_NETEM selects an active profile
+  static Link *fromEnv(int fd) {
+    Profile p = profileFromEnv();
+    return p.active() ? new Link(fd, p) : nullptr;
+  }
+
+  const Profile &getProfile() const { return profile; }
+
+  void send(const void *data, size_t len) {
+    if (len == 0)
+      return;
+    std::lock_guard<std::mutex> lock(mtx);
+    clock::time_point now = clock::now();
+    linkFree = std::max(now, linkFree) + transmitTime(len);
+    clock::time_point deliver = linkFree + oneWay();
+    deliver = std::max(deliver, lastDeliver);
+    lastDeliver = deliver;
+    // Coalesce bursts of small writes (e.g. per-element sends) into one
+    // syscall; this delays earlier bytes by at most coalesceWindow
+    if (!queue.empty() && deliver - queue.back().first < coalesceWindow) {
+      Message &m = queue.back();
+      m.deliver = deliver;
+      m.bytes.insert(m.bytes.end(), (const uint8_t *)data,
+                     (const uint8_t *)data + len);
+    } else {
+      queue.push_back({deliver, deliver, std::vector<uint8_t>(
+                                             (const uint8_t *)data,
+                                             (const uint8_t *)data + len)});
+    }
+    cv.notify_all();
+  }
+
+  // Blocks until all queued bytes have been handed to the socket
+  void drain() {
+    std::unique_lock<std::mutex> lock(mtx);
+    cv.wait(lock, [this] { return queue.empty() && !writing; });
+  }
+
+private:
+  struct Message {
+    clock::time_point first;
+    clock::time_point deliver;
+    std::vector<uint8_t> bytes;
+  };
+
+  static constexpr std::chrono::microseconds coalesceWindow{20};
+
+  int fd;
+  Profile profile;
+  std::mt19937_64 rng;
+  std::mutex mtx;
+  std::condition_variable cv;
+  std::deque<Message> queue;
+  bool writing = false;
+  bool stopping = false;
+  clock::time_point linkFree;
+  clock::time_point lastDeliver;
+  std::thread writer;
+
+  clock::duration transmitTime(size_t len) const {
+    if (profile.bandwidthMbps <= 0)
+      return clock::duration::zero();
+    double us = (8.0 * len) / profile.bandwidthMbps;
+    return std::chrono::duration_cast<clock::duration>(
+        std::chrono::duration<double, std::micro>(us));
+  }
+
+  clock::duration oneWay() {
+    double ms = profile.rttMs / 2;
+    if (profile.jitterMs > 0)
+      ms += std::uniform_real_distribution<double>(0, profile.jitterMs)(rng);
+    return std::chrono::duration_cast<clock::duration>(
+        std::chrono::duration<double, std::milli>(ms));
+  }
+
+  void run() {
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) {
+      cv.wait(lock, [this] { return stopping || !queue.empty(); });
+      if (queue.empty())
+        return;
+      clock::time_point deliver = queue.front().deliver;
+      if (clock::now() < deliver) {
+        // Re-check on wake-up: a coalesced write may have pushed it back
+        cv.wait_until(lock, deliver);
+        continue;
+      }
+      Message m = std::move(queue.front());
+      queue.pop_front();
+      writing = true;
+      lock.unlock();
+      size_t sent = 0;
+      while (sent < m.bytes.size()) {
+        ssize_t res = ::send(fd, m.bytes.data() + sent, m.bytes.size() - sent,
+                             MSG_NOSIGNAL);
+        if (res < 0) {
+          perror("netem: send");
+          break;
+        }
+        sent += res;
+      }
+      lock.lock();
+      writing = false;
+      cv.notify_all();
+    }
+  }
+};
+
+inline Registry::~Registry() {
+  std::lock_guard<std::mutex> lock(mtx);
+  for (Link *l : links)
+    l->drain();
+}
+
+} // namespace netem
+
+#endif // EZPC_NETEM_H__
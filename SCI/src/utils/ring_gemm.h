@@ -0,0 +1,362 @@
+/*
+Copyright:
+Copyright (c) 2022 Microsoft Research
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Matrix multiplication over Z_2^32 / Z_2^64 (uint32_t / uint64_t with
+// wrap-around), shared by SCI, LLAMA/sytorch and Porthos. The other two
+// include it from here as utils/ring_gemm.h.
+//
+// Eigen has no tuned integer GEMM, so the cleartext products of the linear
+// layers used to run far below what the machine can do. This is a
+// cache-blocked GEMM in the usual Goto/BLIS structure: B is packed into
+// KC x NR panels that stay in L3, A into MC x KC blocks of MR-row panels
+// that stay in L2, and a register-blocked MR x NR micro-kernel accumulates
+// in vector registers. The micro-kernel is written with GCC vector
+// extensions; with -mavx2 it uses 256-bit vectors, with -mavx512f 512-bit
+// ones (uint64 multiplies become vpmullq with AVX-512DQ and are emulated
+// with vpmuludq otherwise).
+//
+// Large products are split across threads by rows (or columns, for short
+// and wide products). conv2d() multiplies with an implicit im2col: panels
+// of the patch matrix are gathered from the NHWC input while packing, so
+// the patch matrix is never materialised.
+
+#ifndef EZPC_RING_GEMM_H__
+#define EZPC_RING_GEMM_H__
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ring_gemm {
+
+#if defined(__AVX512F__)
+constexpr int vecBytes = 64;
+#else
+constexpr int vecBytes = 32;
+#endif
+
+template <typename T> struct Params {
+  static_assert(std::is_same<T, uint32_t>::value ||
+                    std::is_same<T, uint64_t>::value,
+                "ring_gemm supports uint32_t and uint64_t");
+  typedef T vec __attribute__((vector_size(vecBytes)));
+  static constexpr int lanes = vecBytes / sizeof(T);
+  static constexpr int MR = 4;
+  static constexpr int NV = 2; // vectors per micro-tile row
+  static constexpr int NR = NV * lanes;
+  static constexpr size_t KC = 256;
+  static constexpr size_t MC = 64;
+  static constexpr size_t NC = 2048;
+};
+
+// Products with fewer multiply-adds than this run on the calling thread
+constexpr size_t minWorkPerThread = size_t(1) << 20;
+
+inline std::atomic<int> &defaultThreadsRef() {
+  static std::atomic<int> n{int(std::max(1u, std::thread::hardware_concurrency()))};
+  return n;
+}
+
+// Thread count used when a call passes threads = 0
+inline void setNumThreads(int n) { defaultThreadsRef() = std::max(1, n); }
+inline int numThreads() { return defaultThreadsRef(); }
+
+// Element (r, c) at p[r * rs + c * cs]
+template <typename T> struct Strided {
+  const T *p;
+  size_t rs, cs;
+
+  // A panel: rows [i0, i0 + mr) x cols [k0, k0 + kc) into dst[kk * MR + r]
+  void packA(size_t i0, size_t mr, size_t k0, size_t kc, T *dst) const {
+    const int MR = Params<T>::MR;
+    for (size_t r = 0; r < size_t(MR); r++) {
+      if (r >= mr) {
+        for (size_t kk = 0; kk < kc; kk++)
+          dst[kk * MR + r] = 0;
+        continue;
+      }
+      const T *src = p + (i0 + r) * rs + k0 * cs;
+      for (size_t kk = 0; kk < kc; kk++)
+        dst[kk * MR + r] = src[kk * cs];
+    }
+  }
+
+  // B panel: rows [k0, k0 + kc) x cols [j0, j0 + nr) into dst[kk * NR + c]
+  void packB(size_t j0, size_t nr, size_t k0, size_t kc, T *dst) const {
+    const int NR = Params<T>::NR;
+    if (cs == 1 && nr == size_t(NR)) {
+      for (size_t kk = 0; kk < kc; kk++)
+        memcpy(dst + kk * NR, p + (k0 + kk) * rs + j0, NR * sizeof(T));
+      return;
+    }
+    for (size_t c = 0; c < size_t(NR); c++) {
+      if (c >= nr) {
+        for (size_t kk = 0; kk < kc; kk++)
+          dst[kk * NR + c] = 0;
+        continue;
+      }
+      const T *src = p + k0 * rs + (j0 + c) * cs;
+      for (size_t kk = 0; kk < kc; kk++)
+        dst[kk * NR + c] = src[kk * rs];
+    }
+  }
+};
+
+// The (N * OH * OW) x (FH * FW * CI) patch matrix of an NHWC input, rows in
+// (n, oh, ow) order and columns in (fh, fw, ci) order; padding reads as 0
+template <typename T> struct Im2col {
+  const T *in;
+  size_t H, W, CI, FH, FW, OH, OW;
+  size_t padH, padW, strideH, strideW;
+
+  void packA(size_t i0, size_t mr, size_t k0, size_t kc, T *dst) const {
+    const int MR = Params<T>::MR;
+    for (size_t r = 0; r < size_t(MR); r++) {
+      if (r >= mr) {
+        for (size_t kk = 0; kk < kc; kk++)
+          dst[kk * MR + r] = 0;
+        continue;
+      }
+      size_t i = i0 + r;
+      size_t ow = i % OW, oh = (i / OW) % OH, n = i / (OW * OH);
+      // signed: the window may start in the padding
+      long ih0 = long(oh * strideH) - long(padH);
+      long iw0 = long(ow * strideW) - long(padW);
+      const T *img = in + n * H * W * CI;
+      size_t ci = k0 % CI, fw = (k0 / CI) % FW, fh = k0 / (CI * FW);
+      for (size_t kk = 0; kk < kc; kk++) {
+        long ih = ih0 + long(fh), iw = iw0 + long(fw);
+        bool inside = ih >= 0 && ih < long(H) && iw >= 0 && iw < long(W);
+        dst[kk * MR + r] = inside ? img[(size_t(ih) * W + size_t(iw)) * CI + ci] : 0;
+        if (++ci == CI) {
+          ci = 0;
+          if (++fw == FW) {
+            fw = 0;
+            fh++;
+          }
+        }
+      }
+    }
+  }
+};
+
+template <typename T>
+inline void microKernel(size_t kc, const T *Ap, const T *Bp, T *C, size_t ldc,
+                        size_t mr, size_t nr, bool overwrite, T alpha) {
+  typedef typename Params<T>::vec vec;
+  const int MR = Params<T>::MR, NV = Params<T>::NV, NR = Params<T>::NR;
+  const int lanes = Params<T>::lanes;
+  vec acc[MR][NV];
+  for (int r = 0; r < MR; r++)
+    for (int v = 0; v < NV; v++)
+      acc[r][v] = vec{};
+  for (size_t kk = 0; kk < kc; kk++) {
+    vec b[NV];
+    for (int v = 0; v < NV; v++)
+      memcpy(&b[v], Bp + kk * NR + v * lanes, sizeof(vec));
+    for (int r = 0; r < MR; r++) {
+      T a = Ap[kk * MR + r];
+      for (int v = 0; v < NV; v++)
+        acc[r][v] += b[v] * a;
+    }
+  }
+  if (alpha != T(1)) {
+    for (int r = 0; r < MR; r++)
+      for (int v = 0; v < NV; v++)
+        acc[r][v] *= alpha;
+  }
+  if (mr == size_t(MR) && nr == size_t(NR)) {
+    for (int r = 0; r < MR; r++) {
+      for (int v = 0; v < NV; v++) {
+        T *c = C + r * ldc + v * lanes;
+        if (!overwrite) {
+          vec old;
+          memcpy(&old, c, sizeof(vec));
+          acc[r][v] += old;
+        }
+        memcpy(c, &acc[r][v], sizeof(vec));
+      }
+    }
+    return;
+  }
+  T tile[MR][NR];
+  memcpy(tile, acc, sizeof(tile));
+  for (size_t r = 0; r < mr; r++)
+    for (size_t c = 0; c < nr; c++)
+      C[r * ldc + c] = overwrite ? tile[r][c] : T(C[r * ldc + c] + tile[r][c]);
+}
+
+template <typename T> inline std::vector<T> &packBuffer(int which) {
+  static thread_local std::vector<T> buf[2];
+  return buf[which];
+}
+
+// Single-threaded C[m0:m1, n0:n1] (+)= alpha * A * B
+template <typename T, typename SrcA, typename SrcB>
+void gemmBlock(size_t m0, size_t m1, size_t n0, size_t n1, size_t k,
+               const SrcA &A, const SrcB &B, T *C, size_t ldc, bool accumulate,
+               T alpha) {
+  typedef Params<T> P;
+  const size_t MR = P::MR, NR = P::NR;
+  if (k == 0) {
+    if (!accumulate)
+      for (size_t i = m0; i < m1; i++)
+        std::fill(C + i * ldc + n0, C + i * ldc + n1, T(0));
+    return;
+  }
+  std::vector<T> &Ap = packBuffer<T>(0);
+  std::vector<T> &Bp = packBuffer<T>(1);
+  size_t kcMax = std::min(P::KC, k);
+  Ap.resize(P::MC * kcMax);
+  Bp.resize(std::min(P::NC, (n1 - n0 + NR - 1) / NR * NR) * kcMax);
+
+  for (size_t jc = n0; jc < n1; jc += P::NC) {
+    size_t nc = std::min(P::NC, n1 - jc);
+    for (size_t pc = 0; pc < k; pc += P::KC) {
+      size_t kc = std::min(P::KC, k - pc);
+      bool overwrite = !accumulate && pc == 0;
+      for (size_t jr = 0; jr < nc; jr += NR)
+        B.packB(jc + jr, std::min(NR, nc - jr), pc, kc, Bp.data() + jr * kc);
+      for (size_t ic = m0; ic < m1; ic += P::MC) {
+        size_t mc = std::min(P::MC, m1 - ic);
+        for (size_t ir = 0; ir < mc; ir += MR)
+          A.packA(ic + ir, std::min(MR, mc - ir), pc, kc, Ap.data() + ir * kc);
+        for (size_t jr = 0; jr < nc; jr += NR) {
+          for (size_t ir = 0; ir < mc; ir += MR) {
+            microKernel<T>(kc, Ap.data() + ir * kc, Bp.data() + jr * kc,
+                           C + (ic + ir) * ldc + jc + jr, ldc,
+                           std::min(MR, mc - ir), std::min(NR, nc - jr),
+                           overwrite, alpha);
+          }
+        }
+      }
+    }
+  }
+}
+
+// A few rows times a row-major B (e.g. a fully connected layer on one
+// image): packing B would cost as much as the product, so stream B instead
+template <typename T>
+void gemmFewRows(size_t m, size_t n, size_t k, const Strided<T> &A,
+                 const Strided<T> &B, T *C, size_t ldc, bool accumulate,
+                 T alpha) {
+  for (size_t i = 0; i < m; i++) {
+    T *c = C + i * ldc;
+    if (!accumulate)
+      std::fill(c, c + n, T(0));
+    for (size_t p = 0; p < k; p++) {
+      T a = T(alpha * A.p[i * A.rs + p * A.cs]);
+      const T *b = B.p + p * B.rs;
+      for (size_t j = 0; j < n; j++)
+        c[j] += a * b[j];
+    }
+  }
+}
+
+template <typename T, typename SrcA, typename SrcB>
+bool tryFewRows(size_t, size_t, size_t, const SrcA &, const SrcB &, T *,
+                size_t, bool, T) {
+  return false;
+}
+
+template <typename T>
+bool tryFewRows(size_t m, size_t n, size_t k, const Strided<T> &A,
+                const Strided<T> &B, T *C, size_t ldc, bool accumulate,
+                T alpha) {
+  if (m >= size_t(Params<T>::MR) || B.cs != 1)
+    return false;
+  gemmFewRows<T>(m, n, k, A, B, C, ldc, accumulate, alpha);
+  return true;
+}
+
+// C (+)= alpha * A * B with C row-major m x n (row stride ldc), A m x k and
+// B k x n given as sources (Strided or Im2col)
+template <typename T, typename SrcA, typename SrcB>
+void gemmSources(size_t m, size_t n, size_t k, const SrcA &A, const SrcB &B,
+                 T *C, size_t ldc, bool accumulate = false, T alpha = 1,
+                 int threads = 0) {
+  if (m == 0 || n == 0)
+    return;
+  if (tryFewRows<T>(m, n, k, A, B, C, ldc, accumulate, alpha))
+    return;
+  if (threads <= 0)
+    threads = numThreads();
+  size_t work = m * n * std::max<size_t>(k, 1);
+  size_t t = std::min<size_t>(threads, std::max<size_t>(1, work / minWorkPerThread));
+  // Split by rows in multiples of MC, or by columns in multiples of NR when
+  // there are too few rows to go around
+  bool byRows = m >= t * Params<T>::MC || m >= n;
+  size_t unit = byRows ? Params<T>::MC : Params<T>::NR;
+  size_t extent = byRows ? m : n;
+  t = std::min(t, (extent + unit - 1) / unit);
+  if (t <= 1) {
+    gemmBlock<T>(0, m, 0, n, k, A, B, C, ldc, accumulate, alpha);
+    return;
+  }
+  size_t units = (extent + unit - 1) / unit;
+  std::vector<std::thread> pool;
+  auto run = [&](size_t tid) {
+    size_t b = std::min(extent, (units * tid / t) * unit);
+    size_t e = std::min(extent, (units * (tid + 1) / t) * unit);
+    if (byRows)
+      gemmBlock<T>(b, e, 0, n, k, A, B, C, ldc, accumulate, alpha);
+    else
+      gemmBlock<T>(0, m, b, e, k, A, B, C, ldc, accumulate, alpha);
+  };
+  for (size_t i = 1; i < t; i++)
+    pool.emplace_back(run, i);
+  run(0);
+  for (auto &th : pool)
+    th.join();
+}
+
+// Row-major C (m x n) (+)= alpha * op(A) * op(B), where op(A) is m x k and
+// op(B) is k x n; with transA/transB the operands are stored transposed
+template <typename T>
+void matmul(size_t m, size_t n, size_t k, const T *A, const T *B, T *C,
+            bool transA = false, bool transB = false, bool accumulate = false,
+            T alpha = 1, int threads = 0) {
+  Strided<T> a{A, transA ? 1 : k, transA ? m : 1};
+  Strided<T> b{B, transB ? 1 : n, transB ? k : 1};
+  gemmSources<T>(m, n, k, a, b, C, n, accumulate, alpha, threads);
+}
+
+// NHWC convolution: output (N x OH x OW x CO) (+)= input * filter, with the
+// filter stored as CO x (FH * FW * CI) row-major. Padding on the bottom and
+// right is implied by OH and OW.
+template <typename T>
+void conv2d(size_t N, size_t H, size_t W, size_t CI, size_t FH, size_t FW,
+            size_t CO, size_t padH, size_t padW, size_t strideH,
+            size_t strideW, size_t OH, size_t OW, const T *input,
+            const T *filter, T *output, bool accumulate = false, int threads = 0) {
+  Im2col<T> a{input, H, W, CI, FH, FW, OH, OW, padH, padW, strideH, strideW};
+  size_t K = FH * FW * CI;
+  Strided<T> b{filter, 1, K};
+  gemmSources<T>(N * OH * OW, CO, K, a, b, output, CO, accumulate, T(1),
+                 threads);
+}
+
+} // namespace ring_gemm
+
+#endif // EZPC_RING_GEMM_H__
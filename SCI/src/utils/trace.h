@@ -0,0 +1,224 @@
+/*
+Copyright:
+Copyright (c) 2022 Microsoft Research
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Layer-wise tracing shared by SCI, FSS and LLAMA, so that their traces can
+// be merged. FSS and LLAMA include it from SCI/src.
+//
+// Tracing is off unless EZPC_TRACE is set in the environment (or
+// trace::Tracer::instance().open() is called). The output format is
+// picked from the file extension: ".json" produces Chrome trace events
+// (load in chrome://tracing or Perfetto), anything else produces CSV.
+// A disabled TRACE_LAYER costs a single load and branch.
+//
+// Every layer invocation records wall time, process CPU time, bytes
+// sent/received and rounds (as reported by the backend's counter source)
+// and the time spent reading keys, reported via trace::addKeyRead().
+
+#ifndef EZPC_TRACE_H__
+#define EZPC_TRACE_H__
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace trace {
+
+struct Counters {
+  uint64_t bytesSent = 0;
+  uint64_t bytesReceived = 0;
+  uint64_t rounds = 0;
+};
+
+typedef Counters (*CounterSource)();
+
+class Tracer {
+public:
+  static Tracer &instance() {
+    static Tracer tracer;
+    return tracer;
+  }
+
+  bool enabled() const { return active.load(std::memory_order_relaxed); }
+
+  bool open(const std::string &path) {
+    std::lock_guard<std::mutex> lock(mtx);
+    closeLocked();
+    out = fopen(path.c_str(), "w");
+    if (out == nullptr) {
+      fprintf(stderr, "trace: could not open %s\n", path.c_str());
+      return false;
+    }
+    chrome = (path.size() >= 5) &&
+             (path.compare(path.size() - 5, 5, ".json") == 0);
+    numEvents = 0;
+    if (chrome)
+      fprintf(out, "{\"traceEvents\":[\n");
+    else
+      fprintf(out, "name,party,thread,start_us,wall_us,cpu_us,bytes_sent,"
+                   "bytes_received,rounds,keyread_us\n");
+    active.store(true, std::memory_order_relaxed);
+    return true;
+  }
+
+  void close() {
+    std::lock_guard<std::mutex> lock(mtx);
+    closeLocked();
+  }
+
+  void setCounterSource(CounterSource src) { source = src; }
+  void setParty(int p) { party = p; }
+
+  Counters counters() const { return source ? source() : Counters(); }
+
+  uint64_t nowMicroseconds() const {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - epoch)
+        .count();
+  }
+
+  void record(const char *name, uint64_t start, uint64_t wall, uint64_t cpu,
+              const Counters &c, uint64_t keyread) {
+    size_t tid = std::hash<std::thread::id>()(std::this_thread::get_id()) %
+                 1000000;
+    std::lock_guard<std::mutex> lock(mtx);
+    if (out == nullptr)
+      return;
+    if (chrome) {
+      fprintf(out,
+              "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%zu,"
+              "\"ts\":%llu,\"dur\":%llu,\"args\":{\"cpu_us\":%llu,"
+              "\"bytes_sent\":%llu,\"bytes_received\":%llu,\"rounds\":%llu,"
+              "\"keyread_us\":%llu}}",
+              numEvents ? ",\n" : "", name, party, tid, (ull)start, (ull)wall,
+              (ull)cpu, (ull)c.bytesSent, (ull)c.bytesReceived,
+              (ull)c.rounds, (ull)keyread);
+    } else {
+      fprintf(out, "%s,%d,%zu,%llu,%llu,%llu,%llu,%llu,%llu,%llu\n", name,
+              party, tid, (ull)start, (ull)wall, (ull)cpu, (ull)c.bytesSent,
+              (ull)c.bytesReceived, (ull)c.rounds, (ull)keyread);
+    }
+    numEvents++;
+  }
+
+  ~Tracer() { close(); }
+
+private:
+  typedef unsigned long long ull;
+
+  std::atomic<bool> active{false};
+  std::mutex mtx;
+  FILE *out = nullptr;
+  bool chrome = false;
+  uint64_t numEvents = 0;
+  CounterSource source = nullptr;
+  int party = 0;
+  std::chrono::steady_clock::time_point epoch;
+
+  Tracer() {
+    epoch = std::chrono::steady_clock::now();
+    const char *path = std::getenv("EZPC_TRACE");
+    if (path != nullptr && path[0] != '\0')
+      open(path);
+  }
+
+  void closeLocked() {
+    active.store(false, std::memory_order_relaxed);
+    if (out == nullptr)
+      return;
+    if (chrome)
+      fprintf(out, "\n]}\n");
+    fclose(out);
+    out = nullptr;
+  }
+};
+
+inline uint64_t cpuMicroseconds() {
+  timespec ts;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return uint64_t(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Records one layer invocation from construction to destruction. Scopes
+// nest per thread; key-read time is charged to every open scope.
+class Scope {
+public:
+  explicit Scope(const char *name) : name(name) {
+    if (!Tracer::instance().enabled())
+      return;
+    Tracer &t = Tracer::instance();
+    live = true;
+    parent = current();
+    current() = this;
+    start = t.nowMicroseconds();
+    cpuStart = cpuMicroseconds();
+    c0 = t.counters();
+  }
+
+  ~Scope() {
+    if (!live)
+      return;
+    Tracer &t = Tracer::instance();
+    Counters c1 = t.counters();
+    Counters diff;
+    diff.bytesSent = c1.bytesSent - c0.bytesSent;
+    diff.bytesReceived = c1.bytesReceived - c0.bytesReceived;
+    diff.rounds = c1.rounds - c0.rounds;
+    t.record(name, start, t.nowMicroseconds() - start,
+             cpuMicroseconds() - cpuStart, diff, keyread);
+    current() = parent;
+  }
+
+  Scope(const Scope &) = delete;
+  Scope &operator=(const Scope &) = delete;
+
+  static Scope *&current() {
+    static thread_local Scope *scope = nullptr;
+    return scope;
+  }
+
+  uint64_t keyread = 0;
+  Scope *parent = nullptr;
+
+private:
+  const char *name;
+  bool live = false;
+  uint64_t start = 0, cpuStart = 0;
+  Counters c0;
+};
+
+inline void addKeyRead(uint64_t microseconds) {
+  for (Scope *s = Scope::current(); s != nullptr; s = s->parent)
+    s->keyread += microseconds;
+}
+
+} // namespace trace
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_LAYER(name)                                                      \
+  trace::Scope TRACE_CONCAT(__trace_scope_, __LINE__)(name)
+
+#endif // EZPC_TRACE_H__
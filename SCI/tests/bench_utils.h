@@ -0,0 +1,224 @@
+/*
+Copyright:
+Copyright (c) 2022 Microsoft Research
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Shared harness of the bench-* programs. Both parties run in one process,
+// as two threads talking over loopback, so that a single invocation sweeps a
+// grid of problem sizes. Every point is reported as a JSON object or a CSV
+// row with the wall time, the bytes sent by both parties and the rounds of
+// the busiest channel. EZPC_NETEM applies as it does across processes (see
+// utils/netem.h).
+
+#ifndef BENCH_UTILS_H__
+#define BENCH_UTILS_H__
+
+#include "OT/ot_pack.h"
+#include "utils/ArgMapping/ArgMapping.h"
+#include "utils/io_pack.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define BENCH_MAX_THREADS 16
+
+struct BenchPoint {
+  int dim;   // problem size; its meaning depends on the op
+  int bw;    // bitwidth of the inputs
+  int nt;    // threads (and channels) per party
+  int batch; // elements per protocol call in each thread; 0 for all at once
+};
+
+struct BenchResult {
+  std::string op;
+  BenchPoint p;
+  double time_ms;
+  uint64_t bytes;
+  uint64_t rounds;
+};
+
+// "1024,4096" -> {1024, 4096}
+inline std::vector<std::string> bench_split(const std::string &s) {
+  std::vector<std::string> out;
+  std::stringstream ss(s);
+  std::string item;
+  while (std::getline(ss, item, ','))
+    if (!item.empty())
+      out.push_back(item);
+  return out;
+}
+
+inline std::vector<int> bench_ints(const std::string &s) {
+  std::vector<int> out;
+  for (auto &item : bench_split(s))
+    out.push_back(std::stoi(item));
+  return out;
+}
+
+// All combinations of the given values, in the order they are listed
+inline std::vector<BenchPoint> bench_grid(const std::vector<int> &dims,
+                                          const std::vector<int> &bws,
+                                          const std::vector<int> &nts,
+                                          const std::vector<int> &batches) {
+  std::vector<BenchPoint> grid;
+  for (int dim : dims)
+    for (int bw : bws)
+      for (int nt : nts)
+        for (int batch : batches)
+          grid.push_back({dim, bw, nt, batch});
+  return grid;
+}
+
+// The share of n elements that thread tid of nt handles, split as the tests
+// do: equal chunks, with the remainder going to the last thread
+inline void bench_chunk(int n, int nt, int tid, int &offset, int &size) {
+  int chunk = n / nt;
+  offset = tid * chunk;
+  size = (tid == nt - 1) ? n - offset : chunk;
+}
+
+// Calls fn(offset, size) over [0, n) in pieces of at most batch elements
+template <typename F> void bench_batches(int n, int batch, F fn) {
+  if (batch <= 0)
+    batch = std::max(n, 1);
+  for (int offset = 0; offset < n; offset += batch)
+    fn(offset, std::min(batch, n - offset));
+}
+
+// One party's channels. Thread i uses port + i and plays the other party's
+// role when i is odd, as in the tests, so that both parties do the same work
+// when the threads are busy.
+class BenchParty {
+public:
+  int party;
+  int max_threads;
+  sci::IOPack *iopack[BENCH_MAX_THREADS];
+  sci::OTPack *otpack[BENCH_MAX_THREADS];
+
+  BenchParty(int party, int port, int max_threads, bool base_ots = true) {
+    assert(max_threads <= BENCH_MAX_THREADS);
+    this->party = party;
+    this->max_threads = max_threads;
+    for (int i = 0; i < max_threads; i++) {
+      iopack[i] = new sci::IOPack(party, port + i, "127.0.0.1");
+      otpack[i] = base_ots ? new sci::OTPack(iopack[i], role(i)) : nullptr;
+    }
+  }
+
+  ~BenchParty() {
+    for (int i = 0; i < max_threads; i++) {
+      delete otpack[i];
+      delete iopack[i];
+    }
+  }
+
+  int role(int tid) { return (tid & 1) ? 3 - party : party; }
+
+  // Runs fn(tid) on nt threads, e.g. to secret-share the inputs of a
+  // benchmark outside of its measurement
+  template <typename F> void run(int nt, F fn) {
+    assert(nt <= max_threads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < nt; i++)
+      threads.emplace_back(fn, i);
+    for (auto &t : threads)
+      t.join();
+  }
+
+  // Runs fn(tid) on p.nt threads, once both parties are ready, and measures
+  // this party's side of it
+  template <typename F>
+  BenchResult measure(const std::string &op, const BenchPoint &p, F fn) {
+    assert(p.nt <= max_threads);
+    iopack[0]->io->sync();
+    uint64_t comm[BENCH_MAX_THREADS], rounds[BENCH_MAX_THREADS];
+    for (int i = 0; i < p.nt; i++) {
+      comm[i] = iopack[i]->get_comm();
+      rounds[i] = iopack[i]->get_rounds();
+    }
+    auto start = sci::clock_start();
+    run(p.nt, fn);
+    double t = sci::time_from(start);
+
+    BenchResult res = {op, p, t / 1000.0, 0, 0};
+    for (int i = 0; i < p.nt; i++) {
+      res.bytes += iopack[i]->get_comm() - comm[i];
+      res.rounds = std::max(res.rounds, iopack[i]->get_rounds() - rounds[i]);
+    }
+    return res;
+  }
+};
+
+// Runs party_fn(party) for ALICE and BOB on two threads; each returns what
+// it measured, point by point in the same order. The wall time of a point is
+// that of the slower party.
+template <typename F> std::vector<BenchResult> bench_run_parties(F party_fn) {
+  std::vector<BenchResult> res[2];
+  std::thread alice([&] { res[0] = party_fn(sci::ALICE); });
+  std::thread bob([&] { res[1] = party_fn(sci::BOB); });
+  alice.join();
+  bob.join();
+  assert(res[0].size() == res[1].size());
+  for (size_t i = 0; i < res[0].size(); i++) {
+    res[0][i].time_ms = std::max(res[0][i].time_ms, res[1][i].time_ms);
+    res[0][i].bytes += res[1][i].bytes;
+    res[0][i].rounds = std::max(res[0][i].rounds, res[1][i].rounds);
+  }
+  return res[0];
+}
+
+inline void bench_print(const BenchResult &r) {
+  std::cout << r.op << "\tdim=" << r.p.dim << "\tbw=" << r.p.bw
+            << "\tnt=" << r.p.nt << "\tbatch=" << r.p.batch << "\t"
+            << r.time_ms << " ms\t" << r.bytes << " bytes\t" << r.rounds
+            << " rounds" << std::endl;
+}
+
+// Writes a JSON array if file ends in .json and CSV otherwise
+inline void bench_write(const std::vector<BenchResult> &results,
+                        const std::string &file) {
+  std::ofstream out(file);
+  bool json = file.size() >= 5 && file.substr(file.size() - 5) == ".json";
+  if (json)
+    out << "[\n";
+  else
+    out << "op,dim,bw,threads,batch,time_ms,bytes,rounds\n";
+  for (size_t i = 0; i < results.size(); i++) {
+    auto &r = results[i];
+    if (json) {
+      out << "  {\"op\": \"" << r.op << "\", \"dim\": " << r.p.dim
+          << ", \"bw\": " << r.p.bw << ", \"threads\": " << r.p.nt
+          << ", \"batch\": " << r.p.batch << ", \"time_ms\": " << r.time_ms
+          << ", \"bytes\": " << r.bytes << ", \"rounds\": " << r.rounds
+          << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    } else {
+      out << r.op << "," << r.p.dim << "," << r.p.bw << "," << r.p.nt << ","
+          << r.p.batch << "," << r.time_ms << "," << r.bytes << ","
+          << r.rounds << "\n";
+    }
+  }
+  if (json)
+    out << "]\n";
+  std::cout << "Results written to " << file << std::endl;
+}
+
+#endif // BENCH_UTILS_H__
@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+"""
+Runs two-party benchmarks under a grid of emulated network profiles.
+
+Each benchmark is a pair of processes (one per party) talking over loopback.
+The EZPC_NETEM environment variable is set for both (see
+SCI/src/utils/netem.h) so that SCI's NetIO and LLAMA/FSS's Peer delay their
+outgoing traffic as a link with the given RTT, bandwidth and jitter would.
+The end-to-end wall time of each run is reported, and so is the slowdown
+relative to the first profile in the grid.
+
+The LLAMA benchmarks run one layer of sytorch/benchmarks/llama_ops.cpp
+(build sytorch with -DSYTORCH_BUILD_BENCHMARKS=ON). Before each of their
+runs the dealer writes the key files, without emulation and outside the
+timed region; then the server and the client run over the emulated link.
+ReLU and maxpool there are DCF comparisons. Benchmarks whose binary is
+missing are reported as skipped.
+
+Examples:
+  # SCI tests built in SCI/build/bin, sytorch built in sytorch/build
+  python3 netem_bench.py --bin-dir ../build/bin
+
+  # custom profiles; one extra binary
+  python3 netem_bench.py --bin-dir ../build/bin \\
+      --profiles "none;lan;rtt=20,bw=500" \\
+      --op "mine=./my_bench {party} {ip} {port}" --ops relu,mine
+
+Benchmark commands are templates with {party} (1 or 2), {ip} and {port}.
+"""
+
+import argparse
+import csv
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+# Existing SCI tests, run with their default problem sizes
+DEFAULT_OPS = {
+    "relu": "{bin}/relu-OT r={party} ip={ip} p={port}",
+    "truncation": "{bin}/truncation-OT r={party} ip={ip} p={port}",
+    "matmul": "{bin}/matmul-OT r={party} ip={ip} p={port}",
+    "conv-HE": "{bin}/conv-HE r={party} ip={ip} p={port}",
+    "relu-HE": "{bin}/relu-HE r={party} ip={ip} p={port}",
+}
+
+# LLAMA layers as (dealer command, evaluator command). The evaluators are
+# LLAMA's parties 2 (server) and 3 (client); the server listens on LLAMA's
+# fixed port, so {port} is unused.
+LLAMA_OPS = {
+    name + "-LLAMA": ("{llama} %s 1" % name, "{llama} %s {party} {ip}" % name)
+    for name in ("relu", "maxpool", "matmul", "conv")
+}
+LLAMA_PARTIES = (2, 3)
+
+DEFAULT_BENCHMARKS = "relu,truncation,matmul,conv-HE,relu-LLAMA,maxpool-LLAMA,matmul-LLAMA,conv-LLAMA"
+
+DEFAULT_PROFILES = "none;lan;metro;wan"
+
+
+def run_setup(cmd, cwd, timeout):
+    try:
+        p = subprocess.run(
+            cmd.split(),
+            cwd=cwd,
+            stdout=subprocess.DEVNULL,
+            stderr=subprocess.PIPE,
+            timeout=timeout,
+        )
+    except subprocess.TimeoutExpired:
+        return False
+    if p.returncode != 0:
+        sys.stderr.write(p.stderr.decode(errors="replace")[-2000:])
+    return p.returncode == 0
+
+
+def run_pair(cmd, profile, ip, port, timeout, parties=(1, 2), cwd=None):
+    env = dict(os.environ)
+    env["EZPC_NETEM"] = profile
+    procs = []
+    start = time.monotonic()
+    for party in parties:
+        argv = cmd.format(party=party, ip=ip, port=port).split()
+        procs.append(
+            subprocess.Popen(
+                argv,
+                cwd=cwd,
+                env=env,
+                stdout=subprocess.DEVNULL,
+                stderr=subprocess.PIPE,
+            )
+        )
+    ok = True
+    for p in procs:
+        try:
+            _, err = p.communicate(timeout=max(1, timeout - (time.monotonic() - start)))
+            if p.returncode != 0:
+                sys.stderr.write(err.decode(errors="replace")[-2000:])
+                ok = False
+        except subprocess.TimeoutExpired:
+            ok = False
+    for p in procs:
+        if p.poll() is None:
+            p.kill()
+            p.wait()
+    return (time.monotonic() - start) if ok else None
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+    parser.add_argument("--bin-dir", default="build/bin", help="directory with the SCI test binaries")
+    parser.add_argument(
+        "--llama-bin",
+        default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "../../sytorch/build/llama-ops"),
+        help="the llama-ops benchmark binary",
+    )
+    parser.add_argument("--ops", default=DEFAULT_BENCHMARKS, help="comma separated benchmark names")
+    parser.add_argument("--op", action="append", default=[], metavar="NAME=CMD", help="add or override a benchmark")
+    parser.add_argument("--profiles", default=DEFAULT_PROFILES, help="';' separated EZPC_NETEM profiles")
+    parser.add_argument("--ip", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=32000)
+    parser.add_argument("--repeat", type=int, default=1, help="runs per cell; the median is reported")
+    parser.add_argument("--timeout", type=float, default=1800, help="seconds per run")
+    parser.add_argument("--csv", help="also write the results to this file")
+    args = parser.parse_args()
+
+    # name -> (setup command or None, command, parties)
+    ops = {k: (None, v.replace("{bin}", args.bin_dir), (1, 2)) for k, v in DEFAULT_OPS.items()}
+    # LLAMA runs in a scratch directory
+    llama_bin = os.path.abspath(args.llama_bin)
+    for k, (setup, cmd) in LLAMA_OPS.items():
+        ops[k] = (setup.replace("{llama}", llama_bin), cmd.replace("{llama}", llama_bin), LLAMA_PARTIES)
+    for spec in args.op:
+        name, _, cmd = spec.partition("=")
+        if not cmd:
+            parser.error("--op expects NAME=CMD, got " + spec)
+        ops[name] = (None, cmd, (1, 2))
+    names = [n for n in args.ops.split(",") if n]
+    for n in names:
+        if n not in ops:
+            parser.error("unknown benchmark " + n)
+    profiles = [p for p in args.profiles.split(";") if p]
+
+    rows = []
+    port = args.port
+    for name in names:
+        setup, cmd, parties = ops[name]
+        binary = cmd.split()[0]
+        if os.sep in binary and not os.path.exists(binary):
+            print("%-12s skipped, %s not found" % (name, binary), file=sys.stderr)
+            continue
+        # Key files of the LLAMA dealer go there
+        workdir = tempfile.mkdtemp(prefix="netem_bench_") if setup else None
+        base = None
+        for profile in profiles:
+            times = []
+            for _ in range(args.repeat):
+                if setup and not run_setup(setup.format(ip=args.ip), workdir, args.timeout):
+                    times = []
+                    break
+                t = run_pair(cmd, profile, args.ip, port, args.timeout, parties, workdir)
+                # Fresh ports every run: the tests bind several consecutive
+                # ports and do not set SO_REUSEADDR on all of them
+                port += 100
+                if t is None:
+                    times = []
+                    break
+                times.append(t)
+            t = statistics.median(times) if times else None
+            if base is None:
+                base = t
+            slowdown = (t / base) if (t is not None and base) else None
+            rows.append((name, profile, t, slowdown))
+            print(
+                "%-12s %-24s %s" % (name, profile, "failed" if t is None else "%.2f s" % t),
+                file=sys.stderr,
+            )
+        if workdir:
+            shutil.rmtree(workdir, ignore_errors=True)
+
+    w_name = max([len("benchmark")] + [len(r[0]) for r in rows])
+    w_prof = max([len("profile")] + [len(r[1]) for r in rows])
+    print("| %-*s | %-*s | %10s | %8s |" % (w_name, "benchmark", w_prof, "profile", "wall (s)", "slowdown"))
+    print("|-%s-|-%s-|-%s:|-%s:|" % ("-" * w_name, "-" * w_prof, "-" * 10, "-" * 8))
+    for name, profile, t, slowdown in rows:
+        print(
+            "| %-*s | %-*s | %10s | %8s |"
+            % (
+                w_name,
+                name,
+                w_prof,
+                profile,
+                "failed" if t is None else "%.2f" % t,
+                "-" if slowdown is None else "%.2fx" % slowdown,
+            )
+        )
+
+    if args.csv:
+        with open(args.csv, "w", newline="") as f:
+            writer = csv.writer(f)
+            writer.writerow(["benchmark", "profile", "wall_s", "slowdown"])
+            for name, profile, t, slowdown in rows:
+                writer.writerow([name, profile, "" if t is None else "%.4f" % t, "" if slowdown is None else "%.4f" % slowdown])
+
+
+if __name__ == "__main__":
+    main()
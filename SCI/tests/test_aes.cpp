@@ -0,0 +1,162 @@
+/*
+Copyright:
+Copyright (c) 2022 Microsoft Research
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Checks the AES-NI and VAES kernels behind AES_ecb_encrypt_blks against the
+// FIPS-197 test vector and against each other, and measures their throughput
+// together with PRG128 and CRH. Runs as a single process.
+
+#include "utils/ArgMapping/ArgMapping.h"
+#include "utils/crh.h"
+#include "utils/prg.h"
+#include "utils/ubuntu_terminal_colors.h"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+using namespace sci;
+using namespace std;
+
+int num_blocks = 1 << 20;
+int iters = 16;
+
+// Reference: every round applied to the whole batch before the next one
+void encrypt_ref(block128 *blks, unsigned int nblks, const AES_KEY *key) {
+  for (unsigned int i = 0; i < nblks; ++i)
+    blks[i] = _mm_xor_si128(blks[i], key->rd_key[0]);
+  for (unsigned int j = 1; j < key->rounds; ++j)
+    for (unsigned int i = 0; i < nblks; ++i)
+      blks[i] = _mm_aesenc_si128(blks[i], key->rd_key[j]);
+  for (unsigned int i = 0; i < nblks; ++i)
+    blks[i] = _mm_aesenclast_si128(blks[i], key->rd_key[key->rounds]);
+}
+
+typedef void (*EncryptFn)(block128 *, unsigned int, const AES_KEY *);
+
+bool check_kat(EncryptFn fn) {
+  uint8_t key[16], pt[16];
+  const uint8_t ct[16] = {0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+                          0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a};
+  for (int i = 0; i < 16; i++) {
+    key[i] = i;
+    pt[i] = (i << 4) | i;
+  }
+  AES_KEY aes;
+  AES_set_encrypt_key(_mm_loadu_si128((block128 *)key), &aes);
+  // the test vector in every position of a batch that exercises both the
+  // interleaved and the tail code paths
+  const int n = 37;
+  block128 blks[n];
+  for (int i = 0; i < n; i++)
+    blks[i] = _mm_loadu_si128((block128 *)pt);
+  fn(blks, n, &aes);
+  for (int i = 0; i < n; i++)
+    if (memcmp(&blks[i], ct, 16) != 0)
+      return false;
+  return true;
+}
+
+bool check_random(EncryptFn fn, PRG128 &prg) {
+  AES_KEY aes;
+  block128 key;
+  prg.random_block(&key, 1);
+  AES_set_encrypt_key(key, &aes);
+  const int max_n = 300;
+  block128 in[max_n], expected[max_n], got[max_n];
+  prg.random_block(in, max_n);
+  for (int n = 0; n <= max_n; n += (n < 70 ? 1 : 23)) {
+    memcpy(expected, in, n * sizeof(block128));
+    memcpy(got, in, n * sizeof(block128));
+    encrypt_ref(expected, n, &aes);
+    fn(got, n, &aes);
+    if (memcmp(expected, got, n * sizeof(block128)) != 0)
+      return false;
+  }
+  return true;
+}
+
+void bench(const string &name, EncryptFn fn, block128 *data) {
+  AES_KEY aes;
+  AES_set_encrypt_key(makeBlock128(1, 2), &aes);
+  auto start = chrono::high_resolution_clock::now();
+  for (int it = 0; it < iters; it++)
+    for (int i = 0; i < num_blocks; i += AES_BATCH_SIZE)
+      fn(data + i, min(AES_BATCH_SIZE, num_blocks - i), &aes);
+  double t = chrono::duration<double>(chrono::high_resolution_clock::now() -
+                                      start)
+                 .count();
+  cout << name << ": " << (double(num_blocks) * iters * 16 / t) / (1 << 30)
+       << " GiB/s" << endl;
+}
+
+int main(int argc, char **argv) {
+  ArgMapping amap;
+  amap.arg("N", num_blocks, "Number of blocks per iteration");
+  amap.arg("it", iters, "Number of iterations");
+  amap.parse(argc, argv);
+
+  PRG128 prg;
+  bool ok = true;
+  ok &= check_kat(encrypt_ref);
+  ok &= check_kat(AES_ecb_encrypt_blks_ni);
+  ok &= check_random(AES_ecb_encrypt_blks_ni, prg);
+  ok &= check_kat(AES_ecb_encrypt_blks);
+  ok &= check_random(AES_ecb_encrypt_blks, prg);
+  bool vaes = AES_has_vaes();
+  if (vaes) {
+    ok &= check_kat(AES_ecb_encrypt_blks_vaes);
+    ok &= check_random(AES_ecb_encrypt_blks_vaes, prg);
+  }
+  cout << "VAES " << (vaes ? "available" : "not available") << endl;
+  if (!ok) {
+    cout << RED << "AES kernels do not match the reference" << RESET << endl;
+    return 1;
+  }
+  cout << GREEN << "AES kernels match the reference" << RESET << endl;
+
+  block128 *data = new block128[num_blocks];
+  prg.random_block(data, num_blocks);
+  bench("AES reference", encrypt_ref, data);
+  bench("AES-NI x" + to_string(AES_NI_INTERLEAVE), AES_ecb_encrypt_blks_ni,
+        data);
+  if (vaes)
+    bench("VAES x" + to_string(AES_VAES_INTERLEAVE),
+          AES_ecb_encrypt_blks_vaes, data);
+
+  auto start = chrono::high_resolution_clock::now();
+  for (int it = 0; it < iters; it++)
+    prg.random_block(data, num_blocks);
+  double t = chrono::duration<double>(chrono::high_resolution_clock::now() -
+                                      start)
+                 .count();
+  cout << "PRG128: " << (double(num_blocks) * iters * 16 / t) / (1 << 30)
+       << " GiB/s" << endl;
+
+  CRH crh;
+  start = chrono::high_resolution_clock::now();
+  for (int it = 0; it < iters; it++)
+    for (int i = 0; i + AES_BATCH_SIZE <= num_blocks; i += AES_BATCH_SIZE)
+      crh.H<AES_BATCH_SIZE>(data + i, data + i);
+  t = chrono::duration<double>(chrono::high_resolution_clock::now() - start)
+          .count();
+  cout << "CRH: " << (double(num_blocks) * iters * 16 / t) / (1 << 30)
+       << " GiB/s" << endl;
+  delete[] data;
+  return 0;
+}
@@ -0,0 +1,158 @@
+/*
+Copyright:
+Copyright (c) 2022 Microsoft Research
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Micro-benchmarks of the HE convolution and fully-connected layers over a
+// grid of sizes, bitwidths and thread counts (see bench_utils.h). For example
+//   ./bench-HE ops=conv N=14,28 l=32,37 nt=1,4 out=he.csv
+// dim is the height and width of the image for conv (CI input and CO output
+// channels, FH x FH filter, stride 1 and same padding) and the size of the
+// square weight matrix for fc. Both run over one channel and parallelize
+// over num_threads OpenMP threads, so there are no batches; the key setup
+// is not measured.
+
+#include "LinearHE/conv-field.h"
+#include "LinearHE/fc-field.h"
+#include "bench_utils.h"
+
+using namespace std;
+using namespace seal;
+using namespace sci;
+
+int party = 0;
+int bitlength = 32;
+int num_threads = 4;
+string ops = "conv,fc";
+string dims = "14";
+string bws = "32";
+string threads = "1,4";
+int inp_chans = 64;
+int out_chans = 64;
+int filter_h = 3;
+int filter_precision = 12;
+int port = 8000;
+string out_file = "bench-HE.json";
+
+template <typename T> using Tensor4 = vector<vector<vector<vector<T>>>>;
+
+template <typename T> Tensor4<T> tensor4(int d0, int d1, int d2, int d3) {
+  return Tensor4<T>(d0, vector<vector<vector<T>>>(
+                            d1, vector<vector<T>>(d2, vector<T>(d3))));
+}
+
+BenchResult bench_conv(BenchParty &P, const BenchPoint &p, ConvField &he) {
+  int H = p.dim, pad = filter_h / 2;
+  auto image = tensor4<uint64_t>(1, H, H, inp_chans);
+  auto filter = tensor4<uint64_t>(filter_h, filter_h, inp_chans, out_chans);
+  auto output = tensor4<uint64_t>(1, H, H, out_chans);
+  PRG128 prg;
+  for (auto &row : image[0])
+    for (auto &pixel : row)
+      prg.random_mod_p<uint64_t>(pixel.data(), inp_chans, prime_mod);
+  if (P.party == ALICE) {
+    for (auto &a : filter)
+      for (auto &b : a)
+        for (auto &c : b) {
+          prg.random_data(c.data(), out_chans * sizeof(uint64_t));
+          for (auto &w : c)
+            w = ((int64_t)w) >> (64 - filter_precision);
+        }
+  }
+  return P.measure("conv", p, [&](int tid) {
+    he.convolution(1, H, H, inp_chans, filter_h, filter_h, out_chans, pad, pad,
+                   pad, pad, 1, 1, image, filter, output);
+  });
+}
+
+BenchResult bench_fc(BenchParty &P, const BenchPoint &p, FCField &he) {
+  int n = p.dim;
+  vector<vector<uint64_t>> A(n, vector<uint64_t>(n));
+  vector<vector<uint64_t>> B(n, vector<uint64_t>(1));
+  vector<vector<uint64_t>> C(n, vector<uint64_t>(1));
+  PRG128 prg;
+  if (P.party == ALICE) {
+    for (auto &row : A) {
+      prg.random_data(row.data(), n * sizeof(uint64_t));
+      for (auto &w : row)
+        w = ((int64_t)w) >> (64 - filter_precision);
+    }
+  }
+  for (auto &row : B)
+    prg.random_mod_p<uint64_t>(row.data(), 1, prime_mod);
+  return P.measure("fc", p, [&](int tid) {
+    he.matrix_multiplication(n, n, 1, A, B, C);
+  });
+}
+
+int main(int argc, char **argv) {
+  ArgMapping amap;
+  amap.arg("ops", ops, "Comma-separated layers to run");
+  amap.arg("N", dims, "Image heights/widths (conv) and matrix sizes (fc)");
+  amap.arg("l", bws, "Bitwidths");
+  amap.arg("nt", threads, "Thread counts");
+  amap.arg("i", inp_chans, "Input Channels");
+  amap.arg("o", out_chans, "Ouput Channels");
+  amap.arg("f", filter_h, "Filter Height/Width");
+  amap.arg("fp", filter_precision, "Filter Precision");
+  amap.arg("p", port, "Port Number");
+  amap.arg("out", out_file, "Output file (.json for JSON, CSV otherwise)");
+  amap.parse(argc, argv);
+
+  auto results = bench_run_parties([&](int party) {
+    BenchParty P(party, port, 1, false);
+    vector<BenchResult> res;
+    for (auto &op : bench_split(ops)) {
+      for (auto &p : bench_grid(bench_ints(dims), bench_ints(bws),
+                                bench_ints(threads), {0})) {
+        // the parameters are globals shared by both parties: ALICE sets
+        // them, and BOB waits until she has
+        if (party == ALICE) {
+          bitlength = p.bw;
+          prime_mod = sci::default_prime_mod.at(p.bw);
+          num_threads = p.nt;
+        }
+        P.iopack[0]->io->sync();
+        // one channel, whatever the number of threads
+        BenchPoint one = p;
+        one.nt = 1;
+        BenchResult r;
+        if (op == "conv") {
+          ConvField he(party, P.iopack[0]->io);
+          r = bench_conv(P, one, he);
+        } else if (op == "fc") {
+          FCField he(party, P.iopack[0]->io);
+          r = bench_fc(P, one, he);
+        } else {
+          cerr << "Unknown op " << op << endl;
+          exit(1);
+        }
+        r.p = p;
+        res.push_back(r);
+        if (party == ALICE)
+          cout << "." << flush;
+      }
+    }
+    return res;
+  });
+  cout << endl;
+  for (auto &r : results)
+    bench_print(r);
+  bench_write(results, out_file);
+  return 0;
+}
@@ -84,9 +84,16 @@ void field_relu_thread(int tid, uint64_t *z, uint64_t *x, int lnum_relu) {
         party, FIELD, iopackArr[tid], bitlength, b, prime_mod, otpackArr[tid]);
   }
   if (batch_size) {
+    // the millionaire scratch arena must not grow across same-sized batches
+    sci::ScratchArena &arena =
+        relu_oracle->relu_triple_compare_oracle->millionaire->arena;
+    size_t arena_capacity = 0;
     for (int j = 0; j < lnum_relu; j += batch_size) {
       if (batch_size <= lnum_relu - j) {
         relu_oracle->relu(z + j, x + j, batch_size);
+        if (j == 0)
+          arena_capacity = arena.capacity();
+        assert(arena.capacity() == arena_capacity);
       } else {
         relu_oracle->relu(z + j, x + j, lnum_relu - j);
       }
@@ -0,0 +1,125 @@
+/*
+Copyright:
+Copyright (c) 2022 Microsoft Research
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Micro-benchmarks of SecFloat operations on FP32 over a grid of sizes,
+// thread counts and batch sizes (see bench_utils.h). For example
+//   ./bench-float ops=add,mul,exp N=1024,16384 nt=1,4 out=float.csv
+// The inputs are secret-shared before the measurement starts.
+
+#include "FloatingPoint/floating-point.h"
+#include "FloatingPoint/fp-math.h"
+#include "bench_utils.h"
+#include <random>
+
+using namespace sci;
+using namespace std;
+
+string ops = "add,mul,div,lt,sqrt,exp,ln";
+string dims = "16384";
+string threads = "1,4";
+string batches = "0";
+int port = 32000;
+string out_file = "bench-float.json";
+
+BenchResult bench_fp(BenchParty &P, const string &op, const BenchPoint &p) {
+  vector<FPOp *> fp_op(p.nt);
+  vector<FPMath *> fp_math(p.nt);
+  // the batches of each thread, as pairs of operands
+  vector<vector<pair<FPArray, FPArray>>> in(p.nt);
+  P.run(p.nt, [&](int tid) {
+    fp_op[tid] = new FPOp(P.role(tid), P.iopack[tid], P.otpack[tid]);
+    fp_math[tid] = new FPMath(P.role(tid), P.iopack[tid], P.otpack[tid]);
+    int offset, n;
+    bench_chunk(p.dim, p.nt, tid, offset, n);
+    // positive and in range for every op
+    std::mt19937 gen(tid);
+    std::uniform_real_distribution<float> dist(0.5f, 2.0f);
+    bench_batches(n, p.batch, [&](int o, int m) {
+      vector<float> x(m), y(m);
+      for (int i = 0; i < m; i++) {
+        x[i] = dist(gen);
+        y[i] = dist(gen);
+      }
+      in[tid].emplace_back(fp_op[tid]->input<float>(ALICE, m, x.data()),
+                           fp_op[tid]->input<float>(BOB, m, y.data()));
+    });
+  });
+  auto res = P.measure(op, p, [&](int tid) {
+    for (auto &xy : in[tid]) {
+      auto &x = xy.first;
+      auto &y = xy.second;
+      if (op == "add")
+        fp_op[tid]->add(x, y);
+      else if (op == "mul")
+        fp_op[tid]->mul(x, y);
+      else if (op == "div")
+        fp_op[tid]->div(x, y);
+      else if (op == "lt")
+        fp_op[tid]->LT(x, y);
+      else if (op == "sqrt")
+        fp_op[tid]->sqrt(x);
+      else if (op == "exp")
+        fp_math[tid]->exp(x);
+      else if (op == "ln")
+        fp_math[tid]->ln(x);
+      else {
+        cerr << "Unknown op " << op << endl;
+        exit(1);
+      }
+    }
+  });
+  for (int i = 0; i < p.nt; i++) {
+    delete fp_math[i];
+    delete fp_op[i];
+  }
+  return res;
+}
+
+int main(int argc, char **argv) {
+  ArgMapping amap;
+  amap.arg("ops", ops, "Comma-separated operations to run");
+  amap.arg("N", dims, "Numbers of elements");
+  amap.arg("nt", threads, "Thread counts");
+  amap.arg("batch", batches, "Elements per call in each thread; 0 for all");
+  amap.arg("p", port, "First port; each thread uses its own");
+  amap.arg("out", out_file, "Output file (.json for JSON, CSV otherwise)");
+  amap.parse(argc, argv);
+
+  vector<int> nts = bench_ints(threads);
+  int max_threads = *max_element(nts.begin(), nts.end());
+  auto results = bench_run_parties([&](int party) {
+    BenchParty P(party, port, max_threads);
+    vector<BenchResult> res;
+    for (auto &op : bench_split(ops)) {
+      for (auto &p : bench_grid(bench_ints(dims), {32}, nts,
+                                bench_ints(batches))) {
+        res.push_back(bench_fp(P, op, p));
+        if (party == ALICE)
+          cout << "." << flush;
+      }
+    }
+    return res;
+  });
+  cout << endl;
+  for (auto &r : results)
+    bench_print(r);
+  bench_write(results, out_file);
+  return 0;
+}
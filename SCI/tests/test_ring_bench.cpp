@@ -0,0 +1,282 @@
+/*
+Copyright:
+Copyright (c) 2022 Microsoft Research
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Micro-benchmarks of the OT-based ring protocols over a grid of sizes,
+// bitwidths, thread counts and batch sizes (see bench_utils.h). For example
+//   ./bench-OT ops=relu,truncation N=4096,65536 l=32,41 nt=1,4 out=ring.csv
+// dim is the number of elements, except for maxpool (windows of ws elements)
+// and matmul (an M x M by M x M product of the server's and the client's
+// matrices, as MatMulUniform computes the cross terms).
+
+#include "BuildingBlocks/truncation.h"
+#include "Millionaire/millionaire.h"
+#include "NonLinear/maxpool.h"
+#include "NonLinear/relu-ring.h"
+#include "bench_utils.h"
+#include "defines.h"
+#include "LinearOT/linear-uniform.h"
+
+using namespace sci;
+using namespace std;
+
+string ops = "ot,cot,millionaire,truncation,relu,maxpool,matmul";
+string dims = "65536";
+string mm_dims = "64,256";
+string bws = "32";
+string threads = "1,4";
+string batches = "0";
+int shift = 12;
+int window = 9;
+int port = 32000;
+string out_file = "bench-OT.json";
+
+uint64_t bw_mask(int bw) { return bw == 64 ? -1ULL : (1ULL << bw) - 1; }
+
+uint64_t *random_shares(int n, int bw) {
+  PRG128 prg;
+  uint64_t *x = new uint64_t[n];
+  prg.random_data(x, n * sizeof(uint64_t));
+  for (int i = 0; i < n; i++)
+    x[i] &= bw_mask(bw);
+  return x;
+}
+
+// 1-out-of-2 OTs of bw-bit messages
+BenchResult bench_ot(BenchParty &P, const BenchPoint &p) {
+  return P.measure("ot", p, [&](int tid) {
+    int offset, n;
+    bench_chunk(p.dim, p.nt, tid, offset, n);
+    uint64_t *msgs = random_shares(2 * n, p.bw);
+    uint8_t *choice = new uint8_t[n];
+    uint64_t *res = new uint64_t[n];
+    uint64_t **pairs = new uint64_t *[n];
+    PRG128 prg;
+    prg.random_bool((bool *)choice, n);
+    for (int i = 0; i < n; i++)
+      pairs[i] = msgs + 2 * i;
+    bench_batches(n, p.batch, [&](int o, int m) {
+      if (P.role(tid) == ALICE)
+        P.otpack[tid]->iknp_straight->send(pairs + o, m, p.bw);
+      else
+        P.otpack[tid]->iknp_straight->recv(res + o, choice + o, m, p.bw);
+    });
+    delete[] pairs;
+    delete[] res;
+    delete[] choice;
+    delete[] msgs;
+  });
+}
+
+// Correlated OTs of bw-bit messages
+BenchResult bench_cot(BenchParty &P, const BenchPoint &p) {
+  return P.measure("cot", p, [&](int tid) {
+    int offset, n;
+    bench_chunk(p.dim, p.nt, tid, offset, n);
+    uint64_t *corr = random_shares(n, p.bw);
+    uint64_t *res = new uint64_t[n];
+    bool *choice = new bool[n];
+    PRG128 prg;
+    prg.random_bool(choice, n);
+    bench_batches(n, p.batch, [&](int o, int m) {
+      if (P.role(tid) == ALICE)
+        P.otpack[tid]->iknp_straight->send_cot(res + o, corr + o, m, p.bw);
+      else
+        P.otpack[tid]->iknp_straight->recv_cot(res + o, choice + o, m, p.bw);
+    });
+    delete[] choice;
+    delete[] res;
+    delete[] corr;
+  });
+}
+
+BenchResult bench_millionaire(BenchParty &P, const BenchPoint &p) {
+  vector<MillionaireProtocol *> mill(p.nt);
+  for (int i = 0; i < p.nt; i++)
+    mill[i] = new MillionaireProtocol(P.role(i), P.iopack[i], P.otpack[i]);
+  auto res = P.measure("millionaire", p, [&](int tid) {
+    int offset, n;
+    bench_chunk(p.dim, p.nt, tid, offset, n);
+    uint64_t *x = random_shares(n, p.bw);
+    uint8_t *cmp = new uint8_t[n];
+    bench_batches(n, p.batch, [&](int o, int m) {
+      mill[tid]->compare(cmp + o, x + o, m, p.bw);
+    });
+    delete[] cmp;
+    delete[] x;
+  });
+  for (auto m : mill)
+    delete m;
+  return res;
+}
+
+BenchResult bench_truncation(BenchParty &P, const BenchPoint &p) {
+  vector<Truncation *> trunc(p.nt);
+  for (int i = 0; i < p.nt; i++)
+    trunc[i] = new Truncation(P.role(i), P.iopack[i], P.otpack[i]);
+  auto res = P.measure("truncation", p, [&](int tid) {
+    int offset, n;
+    bench_chunk(p.dim, p.nt, tid, offset, n);
+    uint64_t *x = random_shares(n, p.bw);
+    uint64_t *y = new uint64_t[n];
+    bench_batches(n, p.batch, [&](int o, int m) {
+      trunc[tid]->truncate(m, x + o, y + o, shift, p.bw);
+    });
+    delete[] y;
+    delete[] x;
+  });
+  for (auto t : trunc)
+    delete t;
+  return res;
+}
+
+BenchResult bench_relu(BenchParty &P, const BenchPoint &p) {
+  vector<ReLURingProtocol<uint64_t> *> relu(p.nt);
+  for (int i = 0; i < p.nt; i++)
+    relu[i] = new ReLURingProtocol<uint64_t>(P.role(i), RING, P.iopack[i],
+                                             p.bw, MILL_PARAM, P.otpack[i]);
+  auto res = P.measure("relu", p, [&](int tid) {
+    int offset, n;
+    bench_chunk(p.dim, p.nt, tid, offset, n);
+    uint64_t *x = random_shares(n, p.bw);
+    uint64_t *y = new uint64_t[n];
+    bench_batches(n, p.batch,
+                  [&](int o, int m) { relu[tid]->relu(y + o, x + o, m); });
+    delete[] y;
+    delete[] x;
+  });
+  for (auto r : relu)
+    delete r;
+  return res;
+}
+
+// dim windows of ws elements each; batch counts windows
+BenchResult bench_maxpool(BenchParty &P, const BenchPoint &p) {
+  vector<MaxPoolProtocol<uint64_t> *> maxpool(p.nt);
+  for (int i = 0; i < p.nt; i++)
+    maxpool[i] = new MaxPoolProtocol<uint64_t>(
+        P.role(i), RING, P.iopack[i], p.bw, MILL_PARAM, 0, P.otpack[i]);
+  auto res = P.measure("maxpool", p, [&](int tid) {
+    int offset, n;
+    bench_chunk(p.dim, p.nt, tid, offset, n);
+    uint64_t *x = random_shares(n * window, p.bw);
+    uint64_t *y = new uint64_t[n];
+    bench_batches(n, p.batch, [&](int o, int m) {
+      maxpool[tid]->funcMaxMPC(m, window, x + o * window, y + o, nullptr);
+    });
+    delete[] y;
+    delete[] x;
+  });
+  for (auto m : maxpool)
+    delete m;
+  return res;
+}
+
+// The rows of the server's matrix are split over the threads; batch counts
+// rows
+BenchResult bench_matmul(BenchParty &P, const BenchPoint &p) {
+  int d = p.dim;
+  vector<IKNP<NetIO> *> iknp(p.nt);
+  vector<MatMulUniform<NetIO, uint64_t, IKNP<NetIO>> *> mult(p.nt);
+  for (int i = 0; i < p.nt; i++) {
+    iknp[i] = new IKNP<NetIO>(P.iopack[i]->io);
+    if (P.role(i) == ALICE)
+      iknp[i]->setup_send();
+    else
+      iknp[i]->setup_recv();
+    mult[i] = new MatMulUniform<NetIO, uint64_t, IKNP<NetIO>>(
+        P.role(i), p.bw, P.iopack[i]->io, iknp[i], nullptr);
+  }
+  auto res = P.measure("matmul", p, [&](int tid) {
+    int offset, rows;
+    bench_chunk(d, p.nt, tid, offset, rows);
+    uint64_t *A = random_shares(rows * d, p.bw);
+    uint64_t *B = random_shares(d * d, p.bw);
+    uint64_t *C = new uint64_t[rows * d];
+    bench_batches(rows, p.batch, [&](int o, int m) {
+      if (P.role(tid) == ALICE)
+        mult[tid]->funcOTSenderInputA(m, d, d, A + o * d, C + o * d,
+                                      iknp[tid]);
+      else
+        mult[tid]->funcOTReceiverInputB(m, d, d, B, C + o * d, iknp[tid]);
+    });
+    delete[] C;
+    delete[] B;
+    delete[] A;
+  });
+  for (int i = 0; i < p.nt; i++) {
+    delete mult[i];
+    delete iknp[i];
+  }
+  return res;
+}
+
+int main(int argc, char **argv) {
+  ArgMapping amap;
+  amap.arg("ops", ops, "Comma-separated protocols to run");
+  amap.arg("N", dims, "Numbers of elements (windows for maxpool)");
+  amap.arg("M", mm_dims, "Matrix dimensions for matmul");
+  amap.arg("l", bws, "Bitwidths");
+  amap.arg("nt", threads, "Thread counts");
+  amap.arg("batch", batches, "Elements per call in each thread; 0 for all");
+  amap.arg("s", shift, "Shift for truncation");
+  amap.arg("ws", window, "Window size for maxpool");
+  amap.arg("p", port, "First port; each thread uses its own");
+  amap.arg("out", out_file, "Output file (.json for JSON, CSV otherwise)");
+  amap.parse(argc, argv);
+
+  vector<int> nts = bench_ints(threads);
+  int max_threads = *max_element(nts.begin(), nts.end());
+  auto results = bench_run_parties([&](int party) {
+    BenchParty P(party, port, max_threads);
+    vector<BenchResult> res;
+    for (auto &op : bench_split(ops)) {
+      auto grid = bench_grid(bench_ints(op == "matmul" ? mm_dims : dims),
+                             bench_ints(bws), nts, bench_ints(batches));
+      for (auto &p : grid) {
+        if (op == "ot")
+          res.push_back(bench_ot(P, p));
+        else if (op == "cot")
+          res.push_back(bench_cot(P, p));
+        else if (op == "millionaire")
+          res.push_back(bench_millionaire(P, p));
+        else if (op == "truncation")
+          res.push_back(bench_truncation(P, p));
+        else if (op == "relu")
+          res.push_back(bench_relu(P, p));
+        else if (op == "maxpool")
+          res.push_back(bench_maxpool(P, p));
+        else if (op == "matmul")
+          res.push_back(bench_matmul(P, p));
+        else {
+          cerr << "Unknown op " << op << endl;
+          exit(1);
+        }
+        if (party == ALICE)
+          cout << "." << flush;
+      }
+    }
+    return res;
+  });
+  cout << endl;
+  for (auto &r : results)
+    bench_print(r);
+  bench_write(results, out_file);
+  return 0;
+}
@@ -0,0 +1,248 @@
+/*
+Authors: Deevashwer Rathee
+Copyright:
+Copyright (c) 2021 Microsoft Research
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "Math/math-functions.h"
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+using namespace sci;
+using namespace std;
+
+#define MAX_THREADS 4
+
+int party, port = 32000;
+int num_threads = 4;
+string address = "127.0.0.1";
+
+int rows = 100;
+int cols = 768;
+int bw_x = 24;
+int bw_y = 24;
+int s_x = 12;
+int s_y = 12;
+// x \in [-8, 8), gamma, beta \in [-2, 2)
+int bw_in = s_x + 4;
+int bw_affine = s_y + 2;
+
+uint64_t mask_x = (bw_x == 64 ? -1 : ((1ULL << bw_x) - 1));
+uint64_t mask_y = (bw_y == 64 ? -1 : ((1ULL << bw_y) - 1));
+
+IOPack *iopackArr[MAX_THREADS];
+OTPack *otpackArr[MAX_THREADS];
+
+uint64_t computeULPErr(double calc, double actual, int SCALE) {
+  int64_t calc_fixed = (double(calc) * (1ULL << SCALE));
+  int64_t actual_fixed = (double(actual) * (1ULL << SCALE));
+  uint64_t ulp_err = (calc_fixed - actual_fixed) > 0
+                         ? (calc_fixed - actual_fixed)
+                         : (actual_fixed - calc_fixed);
+  return ulp_err;
+}
+
+// Secret shares values in [-2^(bw_in - 1), 2^(bw_in - 1)) between the parties
+void share_inputs(PRG128 &prg, uint64_t *x, int size, int bw_in, int bw) {
+  uint64_t mask = (bw == 64 ? -1 : ((1ULL << bw) - 1));
+  uint64_t mask_in = (1ULL << bw_in) - 1;
+  prg.random_data(x, size * sizeof(uint64_t));
+  if (party == ALICE) {
+    iopackArr[0]->io->send_data(x, size * sizeof(uint64_t));
+  } else {
+    uint64_t *x0 = new uint64_t[size];
+    iopackArr[0]->io->recv_data(x0, size * sizeof(uint64_t));
+    for (int i = 0; i < size; i++) {
+      x[i] = (x[i] & mask_in) - (1ULL << (bw_in - 1));
+      x[i] = (x[i] - x0[i]);
+    }
+    delete[] x0;
+  }
+  for (int i = 0; i < size; i++) {
+    x[i] &= mask;
+  }
+}
+
+void layer_norm_thread(int tid, uint64_t *x, uint64_t *y, uint64_t *gamma,
+                       uint64_t *beta, int num_rows) {
+  MathFunctions *math;
+  if (tid & 1) {
+    math = new MathFunctions(3 - party, iopackArr[tid], otpackArr[tid]);
+  } else {
+    math = new MathFunctions(party, iopackArr[tid], otpackArr[tid]);
+  }
+  math->layer_norm(num_rows, cols, x, y, gamma, beta, bw_x, bw_y, s_x,
+                   s_y);
+
+  delete math;
+}
+
+int main(int argc, char **argv) {
+  /************* Argument Parsing  ************/
+  /********************************************/
+  ArgMapping amap;
+  amap.arg("r", party, "Role of party: ALICE = 1; BOB = 2");
+  amap.arg("p", port, "Port Number");
+  amap.arg("N", rows, "Number of rows");
+  amap.arg("C", cols, "Number of columns");
+  amap.arg("nt", num_threads, "Number of threads");
+  amap.arg("ip", address, "IP Address of server (ALICE)");
+
+  amap.parse(argc, argv);
+
+  assert(num_threads <= MAX_THREADS);
+
+  /********** Setup IO and Base OTs ***********/
+  /********************************************/
+  for (int i = 0; i < num_threads; i++) {
+    iopackArr[i] = new IOPack(party, port + i, address);
+    if (i & 1) {
+      otpackArr[i] = new OTPack(iopackArr[i], 3 - party);
+    } else {
+      otpackArr[i] = new OTPack(iopackArr[i], party);
+    }
+  }
+  std::cout << "All Base OTs Done" << std::endl;
+
+  /************ Generate Test Data ************/
+  /********************************************/
+  PRG128 prg(fix_key);
+
+  int dim = rows * cols;
+  uint64_t *x = new uint64_t[dim];
+  uint64_t *y = new uint64_t[dim];
+  uint64_t *gamma = new uint64_t[cols];
+  uint64_t *beta = new uint64_t[cols];
+
+  share_inputs(prg, x, dim, bw_in, bw_x);
+  share_inputs(prg, gamma, cols, bw_affine, bw_y);
+  share_inputs(prg, beta, cols, bw_affine, bw_y);
+
+  /************** Fork Threads ****************/
+  /********************************************/
+  uint64_t total_comm = 0;
+  uint64_t thread_comm[num_threads];
+  for (int i = 0; i < num_threads; i++) {
+    thread_comm[i] = iopackArr[i]->get_comm();
+  }
+
+  auto start = clock_start();
+  std::thread layer_norm_threads[num_threads];
+  int chunk_size = rows / num_threads;
+  for (int i = 0; i < num_threads; ++i) {
+    int offset = i * chunk_size;
+    int lnum_rows;
+    if (i == (num_threads - 1)) {
+      lnum_rows = rows - offset;
+    } else {
+      lnum_rows = chunk_size;
+    }
+    layer_norm_threads[i] =
+        std::thread(layer_norm_thread, i, x + offset * cols, y + offset * cols,
+                    gamma, beta, lnum_rows);
+  }
+  for (int i = 0; i < num_threads; ++i) {
+    layer_norm_threads[i].join();
+  }
+  long long t = time_from(start);
+
+  for (int i = 0; i < num_threads; i++) {
+    thread_comm[i] = iopackArr[i]->get_comm() - thread_comm[i];
+    total_comm += thread_comm[i];
+  }
+
+  /************** Verification ****************/
+  /********************************************/
+  if (party == ALICE) {
+    iopackArr[0]->io->send_data(x, dim * sizeof(uint64_t));
+    iopackArr[0]->io->send_data(y, dim * sizeof(uint64_t));
+    iopackArr[0]->io->send_data(gamma, cols * sizeof(uint64_t));
+    iopackArr[0]->io->send_data(beta, cols * sizeof(uint64_t));
+  } else { // party == BOB
+    uint64_t *x0 = new uint64_t[dim];
+    uint64_t *y0 = new uint64_t[dim];
+    uint64_t *gamma0 = new uint64_t[cols];
+    uint64_t *beta0 = new uint64_t[cols];
+    iopackArr[0]->io->recv_data(x0, dim * sizeof(uint64_t));
+    iopackArr[0]->io->recv_data(y0, dim * sizeof(uint64_t));
+    iopackArr[0]->io->recv_data(gamma0, cols * sizeof(uint64_t));
+    iopackArr[0]->io->recv_data(beta0, cols * sizeof(uint64_t));
+
+    uint64_t total_err = 0;
+    uint64_t max_ULP_err = 0;
+    double *dbl_x = new double[cols];
+    for (int i = 0; i < rows; i++) {
+      double mean = 0, var = 0;
+      for (int j = 0; j < cols; j++) {
+        dbl_x[j] = (signed_val(x0[i * cols + j] + x[i * cols + j], bw_x)) /
+                   double(1LL << s_x);
+        mean += dbl_x[j];
+      }
+      mean /= cols;
+      for (int j = 0; j < cols; j++) {
+        var += (dbl_x[j] - mean) * (dbl_x[j] - mean);
+      }
+      var /= cols;
+      for (int j = 0; j < cols; j++) {
+        double dbl_gamma =
+            (signed_val(gamma0[j] + gamma[j], bw_y)) / double(1LL << s_y);
+        double dbl_beta =
+            (signed_val(beta0[j] + beta[j], bw_y)) / double(1LL << s_y);
+        double dbl_y =
+            (signed_val(y0[i * cols + j] + y[i * cols + j], bw_y)) /
+            double(1LL << s_y);
+        double layer_norm_x =
+            dbl_gamma * (dbl_x[j] - mean) / sqrt(var + 1e-5) + dbl_beta;
+        uint64_t err = computeULPErr(dbl_y, layer_norm_x, s_y);
+        if (err > 8) {
+          cout << "ULP Error: " << dbl_x[j] << "," << dbl_y << ","
+               << layer_norm_x << "," << err << endl;
+        }
+        total_err += err;
+        max_ULP_err = std::max(max_ULP_err, err);
+      }
+    }
+
+    cerr << "Average ULP error: " << total_err / dim << endl;
+    cerr << "Max ULP error: " << max_ULP_err << endl;
+    cerr << "Number of tests: " << rows << " x " << cols << endl;
+
+    delete[] x0;
+    delete[] y0;
+    delete[] gamma0;
+    delete[] beta0;
+    delete[] dbl_x;
+  }
+
+  cout << "Number of LayerNorm rows/s:\t" << (double(rows) / t) * 1e6
+       << std::endl;
+  cout << "LayerNorm Time\t" << t / (1000.0) << " ms" << endl;
+  cout << "LayerNorm Bytes Sent\t" << total_comm << " bytes" << endl;
+
+  /******************* Cleanup ****************/
+  /********************************************/
+  delete[] x;
+  delete[] y;
+  delete[] gamma;
+  delete[] beta;
+  for (int i = 0; i < num_threads; i++) {
+    delete iopackArr[i];
+    delete otpackArr[i];
+  }
+}
@@ -0,0 +1,176 @@
+/*
+Copyright:
+Copyright (c) 2022 Microsoft Research
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "LinearHE/linear-ring.h"
+#include <iostream>
+
+using namespace sci;
+using namespace std;
+
+int party, port = 32000;
+string address = "127.0.0.1";
+uint64_t prime_mod;
+int32_t bitlength = 37;
+int32_t num_threads = 4;
+NetIO *io;
+LinearRing *he_ring;
+uint64_t mask;
+
+int dim1 = 64;
+int dim2 = 147;
+int dim3 = 300;
+
+int N = 1, H = 30, W = 30, CI = 16, FH = 3, FW = 3, CO = 8;
+int zPad = 1, stride = 2;
+
+// Sends this party's shares to BOB, which returns them added to its own
+void reconstruct(uint64_t *out, int64_t n) {
+  if (party == ALICE) {
+    io->send_data(out, n * sizeof(uint64_t));
+  } else { // party == BOB
+    uint64_t *out0 = new uint64_t[n];
+    io->recv_data(out0, n * sizeof(uint64_t));
+    for (int64_t i = 0; i < n; i++) {
+      out[i] = (out[i] + out0[i]) & mask;
+    }
+    delete[] out0;
+  }
+}
+
+void test_matmul(uint64_t *inA, uint64_t *inB) {
+  uint64_t *outC = new uint64_t[dim1 * dim3];
+
+  INIT_TIMER;
+  START_TIMER;
+  uint64_t comm_start = io->counter;
+  he_ring->matmul(dim1, dim2, dim3, inA, inB, outC, ALICE);
+  cout << "Bytes Sent: " << (io->counter - comm_start) << endl;
+  STOP_TIMER("Total time for matmul");
+
+  // BOB knows the operands: both are generated from the same seed
+  reconstruct(outC, dim1 * dim3);
+  if (party == BOB) {
+    for (int i = 0; i < dim1; i++) {
+      for (int k = 0; k < dim3; k++) {
+        uint64_t res = 0;
+        for (int j = 0; j < dim2; j++) {
+          res += inA[i * dim2 + j] * inB[j * dim3 + k];
+        }
+        assert((res & mask) == outC[i * dim3 + k]);
+      }
+    }
+    cout << "MatMul Tests Passed" << endl;
+  }
+  delete[] outC;
+}
+
+void test_convolution(uint64_t *input, uint64_t *filter) {
+  int newH = (H + 2 * zPad - FH) / stride + 1;
+  int newW = (W + 2 * zPad - FW) / stride + 1;
+  uint64_t *output = new uint64_t[N * newH * newW * CO];
+
+  INIT_TIMER;
+  START_TIMER;
+  uint64_t comm_start = io->counter;
+  he_ring->convolution(N, H, W, CI, FH, FW, CO, zPad, zPad, zPad, zPad,
+                       stride, stride, input, filter, output, ALICE);
+  cout << "Bytes Sent: " << (io->counter - comm_start) << endl;
+  STOP_TIMER("Total time for convolution");
+
+  reconstruct(output, N * newH * newW * CO);
+  if (party == BOB) {
+    for (int n = 0; n < N; n++) {
+      for (int y = 0; y < newH; y++) {
+        for (int x = 0; x < newW; x++) {
+          for (int m = 0; m < CO; m++) {
+            uint64_t res = 0;
+            for (int dy = 0; dy < FH; dy++) {
+              for (int dx = 0; dx < FW; dx++) {
+                int h = y * stride + dy - zPad, w = x * stride + dx - zPad;
+                if (h < 0 || h >= H || w < 0 || w >= W)
+                  continue;
+                for (int c = 0; c < CI; c++) {
+                  res += input[((n * H + h) * W + w) * CI + c] *
+                         filter[((dy * FW + dx) * CI + c) * CO + m];
+                }
+              }
+            }
+            assert((res & mask) ==
+                   output[((n * newH + y) * newW + x) * CO + m]);
+          }
+        }
+      }
+    }
+    cout << "Convolution Tests Passed" << endl;
+  }
+  delete[] output;
+}
+
+int main(int argc, char **argv) {
+  ArgMapping amap;
+  amap.arg("r", party, "Role of party: ALICE = 1; BOB = 2");
+  amap.arg("p", port, "Port Number");
+  amap.arg("ip", address, "IP Address of server (ALICE)");
+  amap.arg("l", bitlength, "Bitlength of the ring");
+  amap.arg("nt", num_threads, "Number of threads");
+  amap.parse(argc, argv);
+  prime_mod = 1ULL << bitlength;
+  mask = prime_mod - 1;
+
+  io = new NetIO(party == ALICE ? nullptr : address.c_str(), port);
+  he_ring = new LinearRing(party, io, bitlength);
+  cout << "Poly degree: " << he_ring->poly_degree << endl;
+
+  // Fixed seed, so that BOB can check the result
+  block128 seed = makeBlock128(0, 42);
+  PRG128 prg(&seed);
+
+  uint64_t *inA = new uint64_t[dim1 * dim2];
+  uint64_t *inB = new uint64_t[dim2 * dim3];
+  prg.random_data(inA, dim1 * dim2 * sizeof(uint64_t));
+  prg.random_data(inB, dim2 * dim3 * sizeof(uint64_t));
+  for (int i = 0; i < dim1 * dim2; i++) {
+    inA[i] &= mask;
+  }
+  for (int i = 0; i < dim2 * dim3; i++) {
+    inB[i] &= mask;
+  }
+  test_matmul(inA, inB);
+
+  uint64_t *input = new uint64_t[N * H * W * CI];
+  uint64_t *filter = new uint64_t[FH * FW * CI * CO];
+  prg.random_data(input, N * H * W * CI * sizeof(uint64_t));
+  prg.random_data(filter, FH * FW * CI * CO * sizeof(uint64_t));
+  for (int i = 0; i < N * H * W * CI; i++) {
+    input[i] &= mask;
+  }
+  for (int i = 0; i < FH * FW * CI * CO; i++) {
+    filter[i] &= mask;
+  }
+  test_convolution(input, filter);
+
+  delete[] inA;
+  delete[] inB;
+  delete[] input;
+  delete[] filter;
+  delete he_ring;
+  io->flush();
+  return 0;
+}
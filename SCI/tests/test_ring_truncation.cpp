@@ -111,6 +111,46 @@ void trunc(bool signed_arithmetic = true) {
   }
 }
 
+void relu_trunc() {
+  uint64_t *inA = new uint64_t[dim];
+  uint64_t *outB = new uint64_t[dim];
+  uint8_t *drelu = new uint8_t[dim];
+
+  prg.random_data(inA, dim * sizeof(uint64_t));
+
+  for (int i = 0; i < dim; i++) {
+    inA[i] &= mask_bw;
+    outB[i] = 0;
+  }
+
+  trunc_oracle->relu_truncate(dim, inA, outB, shift, bw, drelu);
+
+  if (party == ALICE) {
+    uint64_t *inA_bob = new uint64_t[dim];
+    uint64_t *outB_bob = new uint64_t[dim];
+    uint8_t *drelu_bob = new uint8_t[dim];
+    iopack->io->recv_data(inA_bob, sizeof(uint64_t) * dim);
+    iopack->io->recv_data(outB_bob, sizeof(uint64_t) * dim);
+    iopack->io->recv_data(drelu_bob, sizeof(uint8_t) * dim);
+    for (int i = 0; i < dim; i++) {
+      inA[i] = (inA[i] + inA_bob[i]) & mask_bw;
+      outB[i] = (outB[i] + outB_bob[i]) & mask_bw;
+      drelu[i] ^= drelu_bob[i];
+    }
+    cout << "Testing for correctness..." << endl;
+    for (int i = 0; i < dim; i++) {
+      int64_t x = signed_val(inA[i], bw);
+      assert(drelu[i] == (x >= 0));
+      assert((x >= 0 ? (x >> shift) : 0) == signed_val(outB[i], bw));
+    }
+    cout << "Correct!" << endl;
+  } else { // BOB
+    iopack->io->send_data(inA, sizeof(uint64_t) * dim);
+    iopack->io->send_data(outB, sizeof(uint64_t) * dim);
+    iopack->io->send_data(drelu, sizeof(uint8_t) * dim);
+  }
+}
+
 void div_pow2(bool signed_arithmetic = true) {
   uint64_t *inA = new uint64_t[dim];
   uint64_t *outB = new uint64_t[dim];
@@ -178,6 +218,12 @@ int main(int argc, char **argv) {
 
   cout << "<><><><> (Signed) Truncate <><><><>" << endl;
   trunc(true);
+  cout << "<><><><> ReLU & Truncate <><><><>" << endl;
+  num_rounds = iopack->get_rounds();
+  relu_trunc();
+  num_rounds = iopack->get_rounds() - num_rounds;
+  cout << "Num rounds (ReLU-Trunc): " << num_rounds << endl;
+
   cout << "<><><><> (Unsigned) Division by power of 2 <><><><>" << endl;
   num_rounds = iopack->get_rounds();
   div_pow2(false);
@@ -0,0 +1,102 @@
+// Runs one LLAMA layer on an all-zero input, as a per-operator benchmark for
+// SCI/tests/netem_bench.py:
+//
+//   llama-ops <op> 1 [ip] [nt]     dealer, writes server.dat and client.dat
+//   llama-ops <op> 2 [ip] [nt]     server
+//   llama-ops <op> 3 [ip] [nt]     client, connects to the server at ip
+//
+// <op> is one of relu, maxpool, matmul and conv. ReLU and maxpool are DCF
+// comparisons; matmul and conv include the truncation that follows them.
+
+#include <sytorch/backend/llama_extended.h>
+#include <sytorch/layers/layers.h>
+#include <sytorch/module.h>
+#include <sytorch/utils.h>
+
+template <typename T>
+class SingleLayer : public SytorchModule<T> {
+public:
+    Layer<T> *layer;
+
+    SingleLayer(Layer<T> *layer) : layer(layer) {}
+
+    Tensor<T> &_forward(Tensor<T> &input)
+    {
+        return layer->forward(input);
+    }
+};
+
+template <typename T>
+Layer<T> *makeLayer(const std::string &op, std::vector<u64> &shape)
+{
+    if (op == "relu") {
+        shape = {1, 32, 32, 16};
+        return new ReLU<T>();
+    }
+    if (op == "maxpool") {
+        shape = {1, 32, 32, 16};
+        return new MaxPool2D<T>(2, 0, 2);
+    }
+    if (op == "matmul") {
+        shape = {8, 1024};
+        return new FC<T>(1024, 1024, false);
+    }
+    if (op == "conv") {
+        shape = {1, 32, 32, 32};
+        return new Conv2D<T>(32, 32, 3, 1, 1, false);
+    }
+    throw std::runtime_error("unknown op " + op);
+}
+
+int main(int __argc, char **__argv)
+{
+    if (__argc < 3) {
+        std::cerr << "usage: " << __argv[0] << " relu|maxpool|matmul|conv <party> [ip] [nt]" << std::endl;
+        return 1;
+    }
+    prngWeights.SetSeed(osuCrypto::toBlock(0, 0));
+    prngStr.SetSeed(osuCrypto::toBlock(time(NULL)));
+
+    std::string op = __argv[1];
+    int party = atoi(__argv[2]);
+    std::string ip = "127.0.0.1";
+    int nt = 4;
+    if (__argc > 3) {
+        ip = __argv[3];
+    }
+    if (__argc > 4) {
+        nt = atoi(__argv[4]);
+    }
+
+    const u64 scale = 12;
+    LlamaConfig::bitlength = 40;
+    LlamaConfig::party = party;
+    LlamaConfig::stochasticT = true;
+    LlamaConfig::stochasticRT = true;
+    LlamaConfig::serverKnownWeights = true;
+    LlamaConfig::num_threads = nt;
+
+    using LlamaVersion = LlamaExtended<u64>;
+    LlamaVersion *llama = new LlamaVersion();
+    llama->init(ip, false);
+
+    std::vector<u64> shape;
+    SingleLayer<u64> net(makeLayer<u64>(op, shape));
+    net.init(scale);
+    net.setBackend(llama);
+    net.optimize();
+    net.zero();
+    llama->initializeInferencePartyA(net.root);
+
+    Tensor<u64> input(shape);
+    input.zero();
+    llama->initializeInferencePartyB(input);
+
+    llama::start();
+    net.forward(input);
+    llama::end();
+
+    llama->outputA(net.activation);
+    llama->finalize();
+    return 0;
+}
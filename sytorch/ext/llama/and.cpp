@@ -1,4 +1,5 @@
 #include "and.h"
+#include <algorithm>
 
 // 64 ANDs at a time
 std::pair<BitwiseAndKeyPack, BitwiseAndKeyPack> keyGenBitwiseAnd(GroupElement rin1, GroupElement rin2, GroupElement rout)
@@ -11,10 +12,10 @@ std::pair<BitwiseAndKeyPack, BitwiseAndKeyPack> keyGenBitwiseAnd(GroupElement ri
     t[2] = ((ones ^ rin1) & (0 ^ rin2)) ^ rout;
     t[3] = ((ones ^ rin1) & (ones ^ rin2)) ^ rout;
 
-    auto t0Pair = splitShareXor(t[0], 64);
-    auto t1Pair = splitShareXor(t[1], 64);
-    auto t2Pair = splitShareXor(t[2], 64);
-    auto t3Pair = splitShareXor(t[3], 64);
+    auto t0Pair = splitShareXorCommonPRNG(t[0], 64);
+    auto t1Pair = splitShareXorCommonPRNG(t[1], 64);
+    auto t2Pair = splitShareXorCommonPRNG(t[2], 64);
+    auto t3Pair = splitShareXorCommonPRNG(t[3], 64);
 
     k0.t[0] = t0Pair.first;
     k0.t[1] = t1Pair.first;
@@ -29,26 +30,68 @@ std::pair<BitwiseAndKeyPack, BitwiseAndKeyPack> keyGenBitwiseAnd(GroupElement ri
     return std::make_pair(k0, k1);
 }
 
-// 64 ANDs at a time
+// 64 ANDs at a time: lane i of the result is lane i of t[2 * x_i + y_i],
+// selected with word-wide masks instead of a lookup per lane
 GroupElement evalBitwiseAnd(int party, GroupElement x, GroupElement y, const BitwiseAndKeyPack &key)
 {
-    GroupElement res = 0;
-    for(uint64_t i = 0; i < 64; ++i)
-    {
-        uint8_t xBit = (x >> i) & 1;
-        uint8_t yBit = (y >> i) & 1;
-        GroupElement t = key.t[xBit * 2 + yBit];
-        t = t & (1ULL << i);
-        res = res ^ t;
-    }
-    return res;
+    return (~x & ~y & key.t[0]) | (~x & y & key.t[1]) | (x & ~y & key.t[2]) | (x & y & key.t[3]);
 }
 
 GroupElement evalAnd(int party, GroupElement x, GroupElement y, const BitwiseAndKeyPack &key)
 {
-    uint8_t xBit = x & 1;
-    uint8_t yBit = y & 1;
-    GroupElement t = key.t[xBit * 2 + yBit] & 1;
-    GroupElement res = res ^ t;
-    return res;
+    return evalBitwiseAnd(party, x, y, key) & 1;
+}
+
+void packBits(int size, const GroupElement *bits, GroupElement *words)
+{
+    int numWords = (size + 63) / 64;
+    for (int w = 0; w < numWords; ++w) {
+        GroupElement word = 0;
+        int lanes = std::min(64, size - 64 * w);
+        for (int i = 0; i < lanes; ++i) {
+            word |= (bits[64 * w + i] & 1) << i;
+        }
+        words[w] = word;
+    }
+}
+
+void unpackBits(int size, const GroupElement *words, GroupElement *bits)
+{
+    for (int i = 0; i < size; ++i) {
+        bits[i] = (words[i / 64] >> (i % 64)) & 1;
+    }
+}
+
+void keyGenBitwiseAnd(int size, const GroupElement *rin1, const GroupElement *rin2, GroupElement *rout, BitwiseAndKeyPack *k0, BitwiseAndKeyPack *k1)
+{
+    int numWords = bitwiseAndKeyCount(size);
+    GroupElement *r1 = new GroupElement[3 * numWords];
+    GroupElement *r2 = r1 + numWords;
+    GroupElement *r3 = r2 + numWords;
+    packBits(size, rin1, r1);
+    packBits(size, rin2, r2);
+    for (int w = 0; w < numWords; ++w) {
+        r3[w] = random_ge(64);
+        auto keys = keyGenBitwiseAnd(r1[w], r2[w], r3[w]);
+        k0[w] = keys.first;
+        k1[w] = keys.second;
+    }
+    unpackBits(size, r3, rout);
+    delete[] r1;
+}
+
+void evalBitwiseAnd(int party, int size, const GroupElement *x, const GroupElement *y, const BitwiseAndKeyPack *keys, GroupElement *out)
+{
+    int numWords = bitwiseAndKeyCount(size);
+    GroupElement *xw = new GroupElement[3 * numWords];
+    GroupElement *yw = xw + numWords;
+    GroupElement *ow = yw + numWords;
+    packBits(size, x, xw);
+    packBits(size, y, yw);
+    #pragma omp simd
+    for (int w = 0; w < numWords; ++w) {
+        ow[w] = evalBitwiseAnd(party, xw[w], yw[w], keys[w]);
+    }
+    unpackBits(size, ow, out);
+    delete[] xw;
 }
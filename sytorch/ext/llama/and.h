@@ -5,3 +5,14 @@
 std::pair<BitwiseAndKeyPack, BitwiseAndKeyPack> keyGenBitwiseAnd(GroupElement rin1, GroupElement rin2, GroupElement rout);
 GroupElement evalBitwiseAnd(int party, GroupElement x, GroupElement y, const BitwiseAndKeyPack &key);
 GroupElement evalAnd(int party, GroupElement x, GroupElement y, const BitwiseAndKeyPack &key);
+
+// ANDs of size single-bit lanes (one bit per GroupElement), 64 lanes per key.
+// Keys: bitwiseAndKeyCount(size) per party; the output masks are drawn into rout.
+// Eval: x, y are masked bits and out gets XOR shares of the masked AND.
+inline int bitwiseAndKeyCount(int size) { return (size + 63) / 64; }
+void keyGenBitwiseAnd(int size, const GroupElement *rin1, const GroupElement *rin2, GroupElement *rout, BitwiseAndKeyPack *k0, BitwiseAndKeyPack *k1);
+void evalBitwiseAnd(int party, int size, const GroupElement *x, const GroupElement *y, const BitwiseAndKeyPack *keys, GroupElement *out);
+
+// Lane i of the bit array is bit i % 64 of word i / 64
+void packBits(int size, const GroupElement *bits, GroupElement *words);
+void unpackBits(int size, const GroupElement *words, GroupElement *bits);
@@ -27,6 +27,7 @@ SOFTWARE.
 #include <llama/assert.h>
 #include <llama/freekey.h>
 #include <llama/api.h>
+#include <utils/trace.h>
 #include "and.h"
 #include "conv.h"
 #include "mult.h"
@@ -83,6 +84,21 @@ void llama::start()
         auto commonSeed = dealer->recv_block();
         prngShared.SetSeed(commonSeed);
     }
+
+    // layer-wise traces, enabled through EZPC_TRACE
+    trace::Tracer::instance().setParty(party);
+    trace::Tracer::instance().setCounterSource([]() {
+        trace::Counters c;
+        if (party == DEALER) {
+            c.bytesSent = server->bytesSent + client->bytesSent;
+        }
+        else {
+            c.bytesSent = peer->bytesSent;
+            c.bytesReceived = peer->bytesReceived;
+            c.rounds = numRounds;
+        }
+        return c;
+    });
 }
 
 void llama::end()
@@ -116,75 +132,51 @@ void llama::end()
         std::cerr << "Offline Time = " << (dealerMicroseconds + accumulatedInputTimeOffline) / 1000.0 << " milliseconds\n";
     }
     std::cerr << "=========\n";
+    trace::Tracer::instance().close();
 }
 
-const bool parallel_reconstruct = true;
-void reconstruct(int32_t size, GroupElement *arr, int bw)
+void reconstruct(std::initializer_list<SharesToOpen> parts)
 {
-    uint64_t *tmp = new uint64_t[size];
-    if (parallel_reconstruct)
-    {
-        std::thread send_thread(&Peer::send_batched_input, peer, arr, size, bw);
-        std::thread recv_thread(&Peer::recv_batched_input, peer, tmp, size, bw);
-        send_thread.join();
-        recv_thread.join();
+    // One frame each way: every part packed at exactly its bitwidth, back to
+    // back, exchanged on this thread
+    size_t bytes = 0;
+    int32_t maxSize = 0;
+    for (auto &p : parts) {
+        bytes += packedBytes(p.size, p.bw);
+        maxSize = std::max(maxSize, p.size);
     }
-    else
-    {
-        peer->send_batched_input(arr, size, bw);
-        peer->recv_batched_input(tmp, size, bw);
+    uint8_t *sendBuf = new uint8_t[bytes];
+    uint8_t *recvBuf = new uint8_t[bytes];
+    size_t offset = 0;
+    for (auto &p : parts) {
+        packFixedWidth(p.arr, p.size, p.bw, sendBuf + offset);
+        offset += packedBytes(p.size, p.bw);
     }
-    for (int i = 0; i < size; i++)
-    {
-        arr[i] = arr[i] + tmp[i];
+    peer->exchange_bytes(sendBuf, recvBuf, bytes);
+    GroupElement *tmp = new GroupElement[maxSize];
+    offset = 0;
+    for (auto &p : parts) {
+        unpackFixedWidth(recvBuf + offset, p.size, p.bw, tmp);
+        offset += packedBytes(p.size, p.bw);
+        for (int i = 0; i < p.size; i++) {
+            p.arr[i] = p.arr[i] + tmp[i];
+        }
     }
     delete[] tmp;
+    delete[] sendBuf;
+    delete[] recvBuf;
     numRounds += 1;
 }
 
+void reconstruct(int32_t size, GroupElement *arr, int bw)
+{
+    reconstruct({{arr, size, bw}});
+}
+
 void reconstructRT(int32_t size, GroupElement *arr, int bw)
 {
-    uint64_t *tmp = new uint64_t[size];
-    int bitarraySize = size % 8 == 0 ? size / 8 : size / 8 + 1;
-    // std::cerr << "bitarraySize = " << bitarraySize << "\n";
-    uint8_t *tmp2 = new uint8_t[bitarraySize];
-    uint8_t *tmp3 = new uint8_t[bitarraySize];
-    // std::cerr << "bits = ";
-    // for(int i = 0; i < size; ++i)
-    // {
-    //     std::cerr << arr[i + size] << "  ";
-    // }
-    // std::cerr << "\n";
-    packBitArray(arr + size, size, tmp2);
-    // std::cerr << "encoded = " << (int)tmp2[0] << "\n";
-    if (parallel_reconstruct)
-    {
-        std::thread send_thread(&Peer::send_batched_input, peer, arr, size, bw);
-        std::thread recv_thread(&Peer::recv_batched_input, peer, tmp, size, bw);
-        send_thread.join();
-        recv_thread.join();
-        std::thread send_thread2(&Peer::send_uint8_array, peer, tmp2, bitarraySize);
-        std::thread recv_thread2(&Peer::recv_uint8_array, peer, tmp3, bitarraySize);
-        send_thread2.join();
-        recv_thread2.join();
-    }
-    else
-    {
-        peer->send_batched_input(arr, size, bw);
-        peer->send_uint8_array(tmp2, bitarraySize);
-        peer->recv_batched_input(tmp, size, bw);
-        peer->recv_uint8_array(tmp3, bitarraySize);
-    }
-    // std::cerr << "bits = ";
-    for (int i = 0; i < size; i++)
-    {
-        arr[i] = arr[i] + tmp[i];
-        // std::cerr << ((tmp3[i / 8] >> (i % 8)) & 1) << "  ";
-        arr[i + size] = arr[i + size] + ((tmp3[i / 8] >> (i % 8)) & 1);
-    }
-    // std::cerr << "\n";
-    delete[] tmp;
-    numRounds += 1;
+    // values in arr[0, size) and bits in arr[size, 2 * size)
+    reconstruct({{arr, size, bw}, {arr + size, size, 1}});
 }
 
 inline std::pair<int32_t, int32_t> get_start_end(int32_t size, int32_t thread_idx)
@@ -206,9 +198,10 @@ void Conv2DWrapper(int32_t N, int32_t H, int32_t W,
                    int32_t zPadHRight, int32_t zPadWLeft,
                    int32_t zPadWRight, int32_t strideH,
                    int32_t strideW, MASK_PAIR(GroupElement *inputArr), MASK_PAIR(GroupElement *filterArr),
-                   MASK_PAIR(GroupElement *outArr))
+                   MASK_PAIR(GroupElement *outArr), bool serverWeights)
 {
     std::cerr << ">> Conv2D - Start" << "\n";
+    TRACE_LAYER("Conv2D");
     int d0 = N;
     int d1 = ((H - FH + (zPadHLeft + zPadHRight)) / strideH) + 1;
     int d2 = ((W - FW + (zPadWLeft + zPadWRight)) / strideW) + 1;
@@ -226,9 +219,13 @@ void Conv2DWrapper(int32_t N, int32_t H, int32_t W,
             }
         }
 
-        auto keys = KeyGenConv2D(bitlength, bitlength, N, H, W, CI, FH, FW, CO,
-            zPadHLeft, zPadHRight, zPadWLeft, zPadWRight, strideH, strideW, 
-            inputArr_mask, filterArr_mask, outArr_mask);
+        auto keys = serverWeights ?
+            KeyGenConv2DServerWeights(bitlength, bitlength, N, H, W, CI, FH, FW, CO,
+                zPadHLeft, zPadHRight, zPadWLeft, zPadWRight, strideH, strideW, 
+                inputArr_mask, filterArr_mask, outArr_mask) :
+            KeyGenConv2D(bitlength, bitlength, N, H, W, CI, FH, FW, CO,
+                zPadHLeft, zPadHRight, zPadWLeft, zPadWRight, strideH, strideW, 
+                inputArr_mask, filterArr_mask, outArr_mask);
         
         auto local_end = std::chrono::high_resolution_clock::now();
         
@@ -244,15 +241,19 @@ void Conv2DWrapper(int32_t N, int32_t H, int32_t W,
     else {
 
         auto keyread_start = std::chrono::high_resolution_clock::now();
-        auto key = dealer->recv_conv2d_key(bitlength, bitlength, N, H, W, CI, FH, FW, CO, zPadHLeft, zPadHRight, zPadWLeft, zPadWRight, strideH, strideW);
+        auto key = dealer->recv_conv2d_key(bitlength, bitlength, N, H, W, CI, FH, FW, CO, zPadHLeft, zPadHRight, zPadWLeft, zPadWRight, strideH, strideW, serverWeights);
         auto keyread_end = std::chrono::high_resolution_clock::now();
+        trace::addKeyRead(std::chrono::duration_cast<std::chrono::microseconds>(keyread_end - keyread_start).count());
         auto keyread_time_taken = std::chrono::duration_cast<std::chrono::milliseconds>(keyread_end -
                                                             keyread_start).count();
 
         peer->sync();
         uint64_t eigen_start = eigenMicroseconds;
         auto local_start = std::chrono::high_resolution_clock::now();
-        EvalConv2D(party, key, N, H, W, CI, FH, FW, CO, zPadHLeft, zPadHRight, zPadWLeft, zPadWRight, strideH, strideW, inputArr, filterArr, outArr);
+        if (serverWeights)
+            EvalConv2DServerWeights(party, key, N, H, W, CI, FH, FW, CO, zPadHLeft, zPadHRight, zPadWLeft, zPadWRight, strideH, strideW, inputArr, filterArr, outArr);
+        else
+            EvalConv2D(party, key, N, H, W, CI, FH, FW, CO, zPadHLeft, zPadHRight, zPadWLeft, zPadWRight, strideH, strideW, inputArr, filterArr, outArr);
         auto t1 = std::chrono::high_resolution_clock::now();
         uint64_t onlineComm0 = peer->bytesReceived + peer->bytesSent;
         reconstruct(d0 * d1 * d2 * d3, outArr, bitlength);
@@ -288,6 +289,7 @@ void Conv3DWrapper(int32_t N, int32_t D, int32_t H, int32_t W,
             GroupElement *outArr)
 {
     std::cerr << ">> Conv3D - Start" << "\n";
+    TRACE_LAYER("Conv3D");
     int d0 = N;
     int d1 = ((D - FD + (zPadDLeft + zPadDRight)) / strideD) + 1;
     int d2 = ((H - FH + (zPadHLeft + zPadHRight)) / strideH) + 1;
@@ -322,6 +324,7 @@ void Conv3DWrapper(int32_t N, int32_t D, int32_t H, int32_t W,
         auto keyread_start = std::chrono::high_resolution_clock::now();
         auto key = dealer->recv_conv3d_key(bitlength, bitlength, N, D, H, W, CI, FD, FH, FW, CO, zPadDLeft, zPadDRight, zPadHLeft, zPadHRight, zPadWLeft, zPadWRight, strideD, strideH, strideW);
         auto keyread_end = std::chrono::high_resolution_clock::now();
+        trace::addKeyRead(std::chrono::duration_cast<std::chrono::microseconds>(keyread_end - keyread_start).count());
         auto keyread_time_taken = std::chrono::duration_cast<std::chrono::milliseconds>(keyread_end - keyread_start).count();
 
         peer->sync();
@@ -414,16 +417,19 @@ void ars_threads_helper(int thread_idx, int32_t size, GroupElement *inArr, Group
         evalMicroseconds += (reconstruct_time + compute_time);
         lolEvalMicroseconds += (reconstruct_time + compute_time);
 */
-void ARS(int32_t size, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *outArr), int32_t shift)
+void ARS(int32_t size, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *outArr), int32_t shift, int effectiveInputBw)
 {
     std::cerr << ">> Truncate" << (LlamaConfig::stochasticT ? " (stochastic)" : "") << " - Start" << "\n";
+    TRACE_LAYER("Truncate");
+    int bin = (effectiveInputBw > 0) ? effectiveInputBw : bitlength;
+    always_assert(bin > shift && bin <= bitlength);
     if (party == DEALER) {
         pair<ARSKeyPack> *keys = new pair<ARSKeyPack>[size];
         auto dealer_start = std::chrono::high_resolution_clock::now();
         //#pragma omp parallel for
         for (int i = 0; i < size; i++) {
             GroupElement rout = random_ge(bitlength);
-            keys[i] = keyGenARS(bitlength, bitlength, shift, inArr_mask[i], rout);
+            keys[i] = keyGenARS(bin, bitlength, shift, inArr_mask[i], rout);
             outArr_mask[i] = rout;
         }
         auto dealer_end = std::chrono::high_resolution_clock::now();
@@ -443,9 +449,10 @@ void ARS(int32_t size, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *o
         ARSKeyPack *keys = new ARSKeyPack[size];
         auto keyread_start = std::chrono::high_resolution_clock::now();
         for (int i = 0; i < size; i++) {
-            keys[i] = dealer->recv_ars_key(bitlength, bitlength, shift);
+            keys[i] = dealer->recv_ars_key(bin, bitlength, shift);
         }
         auto keyread_end = std::chrono::high_resolution_clock::now();
+        trace::addKeyRead(std::chrono::duration_cast<std::chrono::microseconds>(keyread_end - keyread_start).count());
         auto keyread_time_taken = std::chrono::duration_cast<std::chrono::milliseconds>(keyread_end -
                                                             keyread_start).count();
 
@@ -488,6 +495,7 @@ void ARS(int32_t size, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *o
 void ScaleDown(int32_t size, MASK_PAIR(GroupElement *inArr), int32_t sf)
 {
     std::cerr << ">> ScaleDown - Start " << "\n";
+    TRACE_LAYER("ScaleDown");
 
     if (localTruncation) {
         uint64_t m = ((1L << sf) - 1) << (bitlength - sf);
@@ -554,9 +562,10 @@ inline void matmul2d_client_helper(int thread_idx, int s1, int s2, int s3, Group
 }
 
 void MatMul2D(int32_t s1, int32_t s2, int32_t s3, MASK_PAIR(GroupElement *A),
-            MASK_PAIR(GroupElement *B), MASK_PAIR(GroupElement *C), bool modelIsA)
+            MASK_PAIR(GroupElement *B), MASK_PAIR(GroupElement *C), bool modelIsA, bool serverWeights)
 {
     std::cerr << ">> MatMul2D - Start" << "\n";
+    TRACE_LAYER("MatMul2D");
     if (party == DEALER) {
 
         auto dealer_start = std::chrono::high_resolution_clock::now();
@@ -566,7 +575,9 @@ void MatMul2D(int32_t s1, int32_t s2, int32_t s3, MASK_PAIR(GroupElement *A),
             }
         }
 
-        auto keys = KeyGenMatMul(bitlength, bitlength, s1, s2, s3, A_mask, B_mask, C_mask);
+        auto keys = serverWeights ?
+            KeyGenMatMulServerWeights(bitlength, bitlength, s1, s2, s3, A_mask, B_mask, C_mask) :
+            KeyGenMatMul(bitlength, bitlength, s1, s2, s3, A_mask, B_mask, C_mask);
         auto dealer_end = std::chrono::high_resolution_clock::now();
 
         // server->send_matmul_key(keys.first);
@@ -579,15 +590,19 @@ void MatMul2D(int32_t s1, int32_t s2, int32_t s3, MASK_PAIR(GroupElement *A),
     else {
 
         auto keyread_start = std::chrono::high_resolution_clock::now();
-        auto key = dealer->recv_matmul_key(bitlength, bitlength, s1, s2, s3);
+        auto key = dealer->recv_matmul_key(bitlength, bitlength, s1, s2, s3, serverWeights);
         auto keyread_end = std::chrono::high_resolution_clock::now();
+        trace::addKeyRead(std::chrono::duration_cast<std::chrono::microseconds>(keyread_end - keyread_start).count());
         auto keyread_time_taken = std::chrono::duration_cast<std::chrono::milliseconds>(keyread_end -
                                                             keyread_start).count();
 
         peer->sync();
         uint64_t eigen_start = eigenMicroseconds;
         auto start = std::chrono::high_resolution_clock::now();
-        matmul_eval_helper(party, s1, s2, s3, A, B, C, key.a, key.b, key.c);
+        if (serverWeights)
+            EvalMatMulServerWeights(party, key, s1, s2, s3, A, B, C);
+        else
+            matmul_eval_helper(party, s1, s2, s3, A, B, C, key.a, key.b, key.c);
         auto mid = std::chrono::high_resolution_clock::now();
         uint64_t onlineComm0 = peer->bytesReceived + peer->bytesSent;
         reconstruct(s1 * s3, C, bitlength);
@@ -624,6 +639,7 @@ void ArgMax(int32_t rows, int32_t cols, MASK_PAIR(GroupElement *inp), MASK_PAIR(
     // column chunk of elements. Result maxidx is stored in out (size: rows)
 
     std::cerr << ">> ArgMax - Start" << "\n";
+    TRACE_LAYER("ArgMax");
     always_assert(rows == 1);
     if (party == DEALER)
     { 
@@ -800,6 +816,7 @@ void AvgPool(int32_t N, int32_t H, int32_t W, int32_t C, int32_t ksizeH,
 {
     // taken from the equivalent function in Porthos/src/EzPCFunctionalities.cpp
     std::cerr << ">> AvgPool - Start" << "\n";
+    TRACE_LAYER("AvgPool");
     int rows = N*H*W*C;
 	std::vector<GroupElement> filterAvg(rows, 0);
     std::vector<GroupElement> filterAvg_mask(rows, 0);
@@ -951,6 +968,7 @@ void ElemWiseSecretSharedVectorMult(int32_t size, MASK_PAIR(GroupElement *inArr)
             keys[i] = dealer->recv_mult_key();
         }
         auto keyread_end = std::chrono::high_resolution_clock::now();
+        trace::addKeyRead(std::chrono::duration_cast<std::chrono::microseconds>(keyread_end - keyread_start).count());
         auto keyread_time_taken = std::chrono::duration_cast<std::chrono::milliseconds>(keyread_end -
                                                             keyread_start).count();
 
@@ -1025,6 +1043,7 @@ void MaxPool(int32_t N, int32_t H, int32_t W, int32_t C, int32_t FH,
              int32_t C1, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *outArr), GroupElement *oneHot) 
 {
     std::cerr << ">> MaxPool - Start" << "\n";
+    TRACE_LAYER("MaxPool");
     int d1 = ((imgH - FH + (zPadHLeft + zPadHRight)) / strideH) + 1;
     int d2 = ((imgW - FW + (zPadWLeft + zPadWRight)) / strideW) + 1;
     always_assert(d1 == H);
@@ -1115,6 +1134,7 @@ void MaxPool(int32_t N, int32_t H, int32_t W, int32_t C, int32_t FH,
             }
         }
         auto keyread_end = std::chrono::high_resolution_clock::now();
+        trace::addKeyRead(std::chrono::duration_cast<std::chrono::microseconds>(keyread_end - keyread_start).count());
         auto keyread_time = std::chrono::duration_cast<std::chrono::microseconds>(keyread_end - keyread_start).count();
         auto keysize = dealer->bytesReceived - keysize_start;
 
@@ -1165,19 +1185,24 @@ void MaxPool(int32_t N, int32_t H, int32_t W, int32_t C, int32_t FH,
 
                 auto t2 = std::chrono::high_resolution_clock::now();
 
-                if (!(fh == 0 && fw == 0)) {
+                if (fh != FH - 1 || fw != FW - 1) {
                     reconstruct(N * C * H * W, maxUntilNow, bitlength);
                 }
+                else {
+                    // the last maximum goes out with the one-hot bits
+                    reconstruct({{maxUntilNow, N * C * H * W, bitlength},
+                                 {oneHot, N * C * H * W * (FH * FW - 1), 1}});
+                    for (int i = 0; i < N * C * H * W * (FH * FW - 1); i++) {
+                        mod(oneHot[i], 1);
+                    }
+                }
                 auto t3 = std::chrono::high_resolution_clock::now();
                 timeCompute += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
                 timeReconstruct += std::chrono::duration_cast<std::chrono::microseconds>(t3 - t2).count();
                 
             }
         }
-        auto t4 = std::chrono::high_resolution_clock::now();
-        reconstruct(N * C * H * W * (FH * FW - 1), oneHot, 1);
         auto end = std::chrono::high_resolution_clock::now();
-        timeReconstruct += std::chrono::duration_cast<std::chrono::microseconds>(end - t4).count();
         auto eval_time = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
         evalMicroseconds += eval_time;
         maxpoolEvalMicroseconds += eval_time;
@@ -1218,6 +1243,7 @@ void relu_dealer_threads_helper(int thread_idx, int32_t size, GroupElement *inAr
 void Relu(int32_t size, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *outArr), GroupElement *drelu)
 {
     std::cerr << ">> Relu (Spline) - Start" << "\n";
+    TRACE_LAYER("Relu");
     // todo: handle doTruncation param
     if (party == DEALER) {
         uint64_t dealer_total_time = 0;
@@ -1250,6 +1276,7 @@ void Relu(int32_t size, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *
             keys[i] = dealer->recv_relu_key(bitlength, bitlength);
         }
         auto keyread_end = std::chrono::high_resolution_clock::now();
+        trace::addKeyRead(std::chrono::duration_cast<std::chrono::microseconds>(keyread_end - keyread_start).count());
         auto keyread_time_taken = std::chrono::duration_cast<std::chrono::milliseconds>(keyread_end -
                                                             keyread_start).count();
         // Step 2: Online Local ReLU Eval
@@ -1274,8 +1301,7 @@ void Relu(int32_t size, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *
         auto mid = std::chrono::high_resolution_clock::now();
         // Step 3: Online Communication
         uint64_t onlineComm0 = peer->bytesReceived + peer->bytesSent;
-        reconstruct(size, outArr, bitlength);
-        reconstruct(size, drelu, 1);
+        reconstruct({{outArr, size, bitlength}, {drelu, size, 1}});
         uint64_t onlineComm1 = peer->bytesReceived + peer->bytesSent;
         reluOnlineComm += (onlineComm1 - onlineComm0);
         auto end = std::chrono::high_resolution_clock::now();
@@ -1293,6 +1319,96 @@ void Relu(int32_t size, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *
     std::cerr << ">> Relu (Spline) - End " << "\n";
 }
 
+void relu2RoundHelper(int thread_idx, int32_t size, GroupElement *inArr, GroupElement *outArr, GroupElement *drelu, Relu2RoundKeyPack *keys, bool mult)
+{
+    auto p = get_start_end(size, thread_idx);
+    for(int i = p.first; i < p.second; i += 1){
+        if (!mult) {
+            drelu[i] = evalRelu2_drelu(party - 2, inArr[i], keys[i]);
+        }
+        else {
+            outArr[i] = evalRelu2_mult(party - 2, drelu[i], inArr[i], keys[i]);
+            freeRelu2RoundKeyPack(keys[i]);
+        }
+    }
+}
+
+void Relu2Round(int32_t size, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *outArr), GroupElement *drelu_cache, int effectiveInputBw)
+{
+    std::cerr << ">> Relu (2 Round, " << effectiveInputBw << " bits) - Start" << "\n";
+    TRACE_LAYER("Relu");
+    always_assert(effectiveInputBw > 1 && effectiveInputBw <= bitlength);
+    if (party == DEALER) {
+        std::pair<Relu2RoundKeyPack, Relu2RoundKeyPack> *keys = new std::pair<Relu2RoundKeyPack, Relu2RoundKeyPack>[size];
+        auto start = std::chrono::high_resolution_clock::now();
+        for(int i = 0; i < size; i += 1){
+            auto rout = random_ge(bitlength);
+            drelu_cache[i] = random_ge(1);
+            keys[i] = keyGenRelu2Round(effectiveInputBw, bitlength, inArr_mask[i], drelu_cache[i], rout);
+            outArr_mask[i] = rout;
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto dealer_total_time = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        for(int i = 0; i < size; ++i) {
+            server->send_relu_2round_key(keys[i].first);
+            client->send_relu_2round_key(keys[i].second);
+            freeRelu2RoundKeyPackPair(keys[i]);
+        }
+        delete[] keys;
+        dealerMicroseconds += dealer_total_time;
+        std::cerr << "   Dealer time = " << dealer_total_time / 1000.0 << " milliseconds" << "\n";
+    }
+    else {
+        Relu2RoundKeyPack *keys = new Relu2RoundKeyPack[size];
+        auto keyread_start = std::chrono::high_resolution_clock::now();
+        for(int i = 0; i < size; i++){
+            keys[i] = dealer->recv_relu_2round_key(effectiveInputBw, bitlength);
+        }
+        auto keyread_end = std::chrono::high_resolution_clock::now();
+        trace::addKeyRead(std::chrono::duration_cast<std::chrono::microseconds>(keyread_end - keyread_start).count());
+        auto keyread_time_taken = std::chrono::duration_cast<std::chrono::milliseconds>(keyread_end -
+                                                            keyread_start).count();
+        peer->sync();
+        auto start = std::chrono::high_resolution_clock::now();
+        uint64_t onlineComm0 = peer->bytesReceived + peer->bytesSent;
+        // Round 1: the masked sign bits; Round 2: the masked outputs
+        for (bool mult : {false, true}) {
+            if (num_threads == 1) {
+                relu2RoundHelper(0, size, inArr, outArr, drelu_cache, keys, mult);
+            }
+            else {
+                std::thread thread_pool[num_threads];
+                for(int thread_idx = 0; thread_idx < num_threads; thread_idx++)
+                {
+                    thread_pool[thread_idx] = std::thread(relu2RoundHelper, thread_idx, size, inArr, outArr, drelu_cache, keys, mult);
+                }
+                for(int thread_idx = 0; thread_idx < num_threads; thread_idx++)
+                {
+                    thread_pool[thread_idx].join();
+                }
+            }
+            if (!mult) {
+                reconstruct(size, drelu_cache, 1);
+            }
+            else {
+                reconstruct(size, outArr, bitlength);
+            }
+        }
+        uint64_t onlineComm1 = peer->bytesReceived + peer->bytesSent;
+        reluOnlineComm += (onlineComm1 - onlineComm0);
+        auto end = std::chrono::high_resolution_clock::now();
+        auto online_time = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        std::cerr << "   Key Read Time = " << keyread_time_taken << " milliseconds\n";
+        std::cerr << "   Online Time = " << online_time / 1000.0 << " milliseconds\n";
+        std::cerr << "   Online Comm = " << (onlineComm1 - onlineComm0) << " bytes\n";
+        evalMicroseconds += online_time;
+        reluEvalMicroseconds += online_time;
+        delete[] keys;
+    }
+    std::cerr << ">> Relu (2 Round) - End " << "\n";
+}
+
 #define BIG_LOOPY(e) for(int n = 0; n < N; ++n) {\
         for(int h = 0; h < H; ++h) {\
             for(int w = 0; w < W; ++w) {\
@@ -1304,38 +1420,21 @@ void Relu(int32_t size, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *
     }
 
 
-void maxpool_onehot_threads_helper(int thread_idx, int f, int32_t N, int32_t H, int32_t W, int32_t C, int32_t FH,
-             int32_t FW, GroupElement *maxBits, GroupElement *curr, GroupElement *oneHot, BitwiseAndKeyPack *keys)
-{
-    auto p = get_start_end(N * H * W * C, thread_idx);
-    for(int i = p.first; i < p.second; i += 1) {
-        int curridx = i;
-        int c = curridx % C;
-        curridx = curridx / C;
-        int w = curridx % W;
-        curridx = curridx / W;
-        int h = curridx % H;
-        curridx = curridx / H;
-        int n = curridx % N;
-        curridx = curridx / N;
-
-        auto max = Arr5DIdx(maxBits, FH * FW - 1, N, H, W, C, f - 1, n, h, w, c);
-        auto c1 = Arr4DIdx(curr, N, H, W, C, n, h, w, c);
-        auto key = keys[(FH * FW - 2 - f) * N * H * W * C + n * H * W * C + h * W * C + w * C + c];
-        Arr5DIdx(oneHot, FH * FW, N, H, W, C, f, n, h, w, c) = evalAnd(party - 2, max, 1 ^ c1, key);
-        mod(Arr5DIdx(oneHot, FH * FW, N, H, W, C, f, n, h, w, c), 1);
-    }
-}
-
 // maxBits contains all the comparison bits from maxpool and converts them to one hot
 // For eg - in a filter of size 5, if the numbers where 3, 2, 5, 4, 7  MaxPool would have set the maxBits array to be 0, 1, 0, 1
 // this functionality converts this to 0, 0, 0, 1 (retains the last 1 and makes the rest 0)
 // This is compatible with both MaxPool and MaxPoolDouble
+// The ANDs of a step are bit-packed, 64 to a key
 void MaxPoolOneHot(int32_t N, int32_t H, int32_t W, int32_t C, int32_t FH, int32_t FW, GroupElement *maxBits, GroupElement *oneHot)
 {
     std::cerr << ">> MaxPoolOneHot - Start" << "\n";
-    GroupElement *curr = make_array<GroupElement>(N * H * W * C);
+    TRACE_LAYER("MaxPoolOneHot");
+    const int32_t S = N * H * W * C;
+    const int32_t numKeys = bitwiseAndKeyCount(S);
+    GroupElement *curr = make_array<GroupElement>(S);
     if (party == DEALER) {
+        BitwiseAndKeyPack *k0 = new BitwiseAndKeyPack[numKeys];
+        BitwiseAndKeyPack *k1 = new BitwiseAndKeyPack[numKeys];
         BIG_LOOPY(
             auto m = Arr5DIdx(maxBits, FH * FW - 1, N, H, W, C, FH * FW - 2, n, h, w, c);
             Arr4DIdx(curr, N, H, W, C, n, h, w, c) = m;
@@ -1344,15 +1443,12 @@ void MaxPoolOneHot(int32_t N, int32_t H, int32_t W, int32_t C, int32_t FH, int32
 
         for(int f = FH * FW - 2; f >= 1; --f) {
             // out[f] = max[f - 1] ^ !curr
-            BIG_LOOPY(
-                auto max = Arr5DIdx(maxBits, FH * FW - 1, N, H, W, C, f - 1, n, h, w, c);
-                auto c1 = Arr4DIdx(curr, N, H, W, C, n, h, w, c);
-                auto rout = random_ge(1);
-                auto keys = keyGenBitwiseAnd(max, c1, rout);
-                server->send_bitwise_and_key(keys.first);
-                client->send_bitwise_and_key(keys.second);
-                Arr5DIdx(oneHot, FH * FW, N, H, W, C, f, n, h, w, c) = rout;
-            )
+            // !curr has the same mask as curr
+            keyGenBitwiseAnd(S, maxBits + (f - 1) * S, curr, oneHot + f * S, k0, k1);
+            for(int i = 0; i < numKeys; ++i) {
+                server->send_bitwise_and_key(k0[i]);
+                client->send_bitwise_and_key(k1[i]);
+            }
             
             BIG_LOOPY(
                 Arr4DIdx(curr, N, H, W, C, n, h, w, c) = Arr4DIdx(curr, N, H, W, C, n, h, w, c) ^ Arr5DIdx(oneHot, FH * FW, N, H, W, C, f, n, h, w, c);
@@ -1362,18 +1458,22 @@ void MaxPoolOneHot(int32_t N, int32_t H, int32_t W, int32_t C, int32_t FH, int32
         BIG_LOOPY(
             Arr5DIdx(oneHot, FH * FW, N, H, W, C, 0, n, h, w, c) = Arr4DIdx(curr, N, H, W, C, n, h, w, c);
         )
+        delete[] k0;
+        delete[] k1;
     }
     else {
-        BitwiseAndKeyPack *keys = new BitwiseAndKeyPack[(FH * FW - 2) * N * H * W * C];
+        BitwiseAndKeyPack *keys = new BitwiseAndKeyPack[(FH * FW - 2) * numKeys];
         auto keyread_start = std::chrono::high_resolution_clock::now();
-        for(int i = 0; i < (FH * FW - 2) * N * H * W * C; ++i) {
+        for(int i = 0; i < (FH * FW - 2) * numKeys; ++i) {
             keys[i] = dealer->recv_bitwise_and_key();
         }
         auto keyread_end = std::chrono::high_resolution_clock::now();
+        trace::addKeyRead(std::chrono::duration_cast<std::chrono::microseconds>(keyread_end - keyread_start).count());
         auto keyread_time = std::chrono::duration_cast<std::chrono::microseconds>(keyread_end - keyread_start).count();
 
         peer->sync();
         auto start = std::chrono::high_resolution_clock::now();
+        GroupElement *notCurr = make_array<GroupElement>(S);
         BIG_LOOPY(
             auto m = Arr5DIdx(maxBits, FH * FW - 1, N, H, W, C, FH * FW - 2, n, h, w, c);
             Arr4DIdx(curr, N, H, W, C, n, h, w, c) = m;
@@ -1383,26 +1483,14 @@ void MaxPoolOneHot(int32_t N, int32_t H, int32_t W, int32_t C, int32_t FH, int32
         for(int f = FH * FW - 2; f >= 1; --f) {
             
             // out[f] = max[f - 1] ^ !curr
-            BIG_LOOPY(
-                auto max = Arr5DIdx(maxBits, FH * FW - 1, N, H, W, C, f - 1, n, h, w, c);
-                auto c1 = Arr4DIdx(curr, N, H, W, C, n, h, w, c);
-                auto key = keys[(FH * FW - 2 - f) * N * H * W * C + n * H * W * C + h * W * C + w * C + c];
-                Arr5DIdx(oneHot, FH * FW, N, H, W, C, f, n, h, w, c) = evalAnd(party - 2, max, 1 ^ c1, key);
-                mod(Arr5DIdx(oneHot, FH * FW, N, H, W, C, f, n, h, w, c), 1);
-            )
-            /* testing to be done
-            // std::thread thread_pool[num_threads];
-            // for(int i = 0; i < num_threads; ++i) {
-            //     thread_pool[i] = std::thread(maxpool_onehot_threads_helper, i, f, N, H, W, C, FH, FW, maxBits, curr, oneHot, keys);
-            // }
-
-            // for(int i = 0; i < num_threads; ++i) {
-            //     thread_pool[i].join();
-            // }
-            */
-            reconstruct(N * H * W * C, oneHot + f * N * H * W * C, 1);
+            for(int i = 0; i < S; ++i) {
+                notCurr[i] = 1 ^ curr[i];
+            }
+            evalBitwiseAnd(party - 2, S, maxBits + (f - 1) * S, notCurr, keys + (FH * FW - 2 - f) * numKeys, oneHot + f * S);
+            reconstruct(S, oneHot + f * S, 1);
             
             BIG_LOOPY(
+                mod(Arr5DIdx(oneHot, FH * FW, N, H, W, C, f, n, h, w, c), 1);
                 Arr4DIdx(curr, N, H, W, C, n, h, w, c) = Arr4DIdx(curr, N, H, W, C, n, h, w, c) ^ Arr5DIdx(oneHot, FH * FW, N, H, W, C, f, n, h, w, c);
             )
         }
@@ -1417,11 +1505,266 @@ void MaxPoolOneHot(int32_t N, int32_t H, int32_t W, int32_t C, int32_t FH, int32
         std::cerr << "   Key Read Time = " << keyread_time / 1000.0 << " miliseconds" << "\n";
         std::cerr << "   Online Time = " << eval_time / 1000.0 << " miliseconds" << "\n";
         delete[] keys;
+        delete[] notCurr;
     }
     delete[] curr;
     std::cerr << ">> MaxPoolOneHot - End" << "\n";
 }
 
+void maxpool_tree_threads_helper(int thread_idx, int32_t size, int32_t S, GroupElement *vals, GroupElement *next, GroupElement *bits, MaxpoolKeyPack *keys)
+{
+    auto p = get_start_end(size, thread_idx);
+    for(int idx = p.first; idx < p.second; idx += 1) {
+        int j = idx / S;
+        int i = idx % S;
+        next[idx] = evalMaxpool(party - 2, vals[2 * j * S + i], vals[(2 * j + 1) * S + i], keys[idx], bits[idx]);
+        freeMaxpoolKeyPack(keys[idx]);
+    }
+}
+
+// MaxPool as a tournament over the FH * FW window elements: every level compares
+// disjoint pairs with the same keys as MaxPool, so the window maximum is found in
+// ceil(log2(FH * FW)) rounds instead of FH * FW - 1. Element f of the window is
+// leaf f of the tree; with an odd count the last node moves up a level unchanged.
+//
+// If oneHot is non-null it receives the FH * FW x N x H x W x C one-hot encoding of
+// the argmax in the layout of MaxPoolOneHot, obtained top-down from the comparison
+// bits with FH * FW - 2 ANDs per window in ceil(log2(FH * FW)) - 1 more rounds. Inference does
+// not need it and passes nullptr, which skips those keys and rounds altogether.
+// The ANDs of a level are bit-packed, 64 to a key.
+void MaxPoolTree(int32_t N, int32_t H, int32_t W, int32_t C, int32_t FH,
+             int32_t FW, int32_t zPadHLeft, int32_t zPadHRight,
+             int32_t zPadWLeft, int32_t zPadWRight, int32_t strideH,
+             int32_t strideW, int32_t N1, int32_t imgH, int32_t imgW,
+             int32_t C1, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *outArr), GroupElement *oneHot)
+{
+    std::cerr << ">> MaxPoolTree - Start" << "\n";
+    TRACE_LAYER("MaxPoolTree");
+    int d1 = ((imgH - FH + (zPadHLeft + zPadHRight)) / strideH) + 1;
+    int d2 = ((imgW - FW + (zPadWLeft + zPadWRight)) / strideW) + 1;
+    always_assert(d1 == H);
+    always_assert(d2 == W);
+    always_assert(N1 == N);
+    always_assert(C1 == C);
+
+    const int32_t K = FH * FW;
+    const int32_t S = N * H * W * C;
+    const bool needOneHot = (oneHot != nullptr) && (K > 1);
+    // node counts per level, from the K leaves up to the root
+    std::vector<int32_t> count = {K};
+    while (count.back() > 1) {
+        count.push_back((count.back() + 1) / 2);
+    }
+    const int levels = count.size() - 1;
+
+    // The window elements are the leaves; padding is a public 0
+    GroupElement *vals = make_array<GroupElement>(K * S);
+    GroupElement *in = (party == DEALER) ? inArr_mask : inArr;
+    for (int f = 0; f < K; f++) {
+        int fh = f / FW;
+        int fw = f % FW;
+        BIG_LOOPY(
+            int curPosH = h * strideH - zPadHLeft + fh;
+            int curPosW = w * strideW - zPadWLeft + fw;
+            GroupElement v = 0;
+            if (curPosH >= 0 && curPosH < imgH && curPosW >= 0 && curPosW < imgW) {
+                v = Arr4DIdx(in, N1, imgH, imgW, C1, n, curPosH, curPosW, c);
+            }
+            Arr5DIdx(vals, K, N, H, W, C, f, n, h, w, c) = v;
+        )
+    }
+    // comparison bits of all levels, level by level: 1 where the right node wins
+    GroupElement *bits = make_array<GroupElement>((K - 1) * S);
+    GroupElement *next = make_array<GroupElement>(((K + 1) / 2) * S);
+
+    if (party == DEALER) {
+        auto dealer_start = std::chrono::high_resolution_clock::now();
+        uint64_t dealer_file_write_time = 0;
+        int32_t bitsOff = 0;
+        for (int l = 0; l < levels; l++) {
+            int32_t half = count[l] / 2;
+            for (int32_t idx = 0; idx < half * S; idx++) {
+                int j = idx / S;
+                int i = idx % S;
+                GroupElement rout = random_ge(bitlength);
+                GroupElement routBit = random_ge(1);
+                auto keys = keyGenMaxpool(bitlength, bitlength, vals[2 * j * S + i], vals[(2 * j + 1) * S + i], rout, routBit);
+                next[idx] = rout;
+                bits[bitsOff * S + idx] = routBit;
+                auto write_start = std::chrono::high_resolution_clock::now();
+                server->send_maxpool_key(keys.first);
+                client->send_maxpool_key(keys.second);
+                freeMaxpoolKeyPackPair(keys);
+                auto write_end = std::chrono::high_resolution_clock::now();
+                dealer_file_write_time += std::chrono::duration_cast<std::chrono::microseconds>(write_end - write_start).count();
+            }
+            if (count[l] % 2 == 1) {
+                memcpy(next + half * S, vals + (count[l] - 1) * S, S * sizeof(GroupElement));
+            }
+            memcpy(vals, next, count[l + 1] * S * sizeof(GroupElement));
+            bitsOff += half;
+        }
+        memcpy(outArr_mask, vals, S * sizeof(GroupElement));
+        auto dealer_end = std::chrono::high_resolution_clock::now();
+        auto dealer_time = std::chrono::duration_cast<std::chrono::microseconds>(dealer_end - dealer_start).count() - dealer_file_write_time;
+        dealerMicroseconds += dealer_time;
+        std::cerr << "   Dealer time: " << dealer_time / 1000.0 << " milliseconds" << "\n";
+    }
+    else {
+        MaxpoolKeyPack *keys = new MaxpoolKeyPack[(K - 1) * S];
+        uint64_t keysize_start = dealer->bytesReceived;
+        auto keyread_start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < (K - 1) * S; i++) {
+            keys[i] = dealer->recv_maxpool_key(bitlength, bitlength);
+        }
+        auto keyread_end = std::chrono::high_resolution_clock::now();
+        trace::addKeyRead(std::chrono::duration_cast<std::chrono::microseconds>(keyread_end - keyread_start).count());
+        auto keyread_time = std::chrono::duration_cast<std::chrono::microseconds>(keyread_end - keyread_start).count();
+        auto keysize = dealer->bytesReceived - keysize_start;
+
+        peer->sync();
+        uint64_t timeCompute = 0;
+        uint64_t timeReconstruct = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        // maxima and comparison bits of a level, reconstructed in the same round
+        GroupElement *level = make_array<GroupElement>(2 * (K / 2) * S);
+        int32_t bitsOff = 0;
+        for (int l = 0; l < levels; l++) {
+            int32_t half = count[l] / 2;
+            auto t1 = std::chrono::high_resolution_clock::now();
+            std::thread thread_pool[num_threads];
+            for(int i = 0; i < num_threads; ++i) {
+                thread_pool[i] = std::thread(maxpool_tree_threads_helper, i, half * S, S, vals, level, level + half * S, keys + bitsOff * S);
+            }
+            for(int i = 0; i < num_threads; ++i) {
+                thread_pool[i].join();
+            }
+            auto t2 = std::chrono::high_resolution_clock::now();
+            if (needOneHot) {
+                reconstructRT(half * S, level, bitlength);
+            }
+            else {
+                reconstruct(half * S, level, bitlength);
+            }
+            auto t3 = std::chrono::high_resolution_clock::now();
+            for (int32_t idx = 0; idx < half * S; idx++) {
+                bits[bitsOff * S + idx] = level[half * S + idx];
+                mod(bits[bitsOff * S + idx], 1);
+            }
+            memcpy(next, level, half * S * sizeof(GroupElement));
+            if (count[l] % 2 == 1) {
+                memcpy(next + half * S, vals + (count[l] - 1) * S, S * sizeof(GroupElement));
+            }
+            memcpy(vals, next, count[l + 1] * S * sizeof(GroupElement));
+            bitsOff += half;
+            timeCompute += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+            timeReconstruct += std::chrono::duration_cast<std::chrono::microseconds>(t3 - t2).count();
+        }
+        memcpy(outArr, vals, S * sizeof(GroupElement));
+        delete[] level;
+        delete[] keys;
+        auto end = std::chrono::high_resolution_clock::now();
+        auto eval_time = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        evalMicroseconds += eval_time;
+        maxpoolEvalMicroseconds += eval_time;
+        std::cerr << "   Key Read Time = " << keyread_time / 1000.0 << " milliseconds" << "\n";
+        std::cerr << "   Key Size = " << keysize / (1024.0 * 1024.0) << " MB" << "\n";
+        std::cerr << "   Compute Time = " << timeCompute / 1000.0 << " milliseconds" << "\n";
+        std::cerr << "   Reconstruct Time = " << timeReconstruct / 1000.0 << " milliseconds" << "\n";
+        std::cerr << "   Online Time = " << eval_time / 1000.0 << " miliseconds" << "\n";
+    }
+
+    if (oneHot != nullptr && K == 1) {
+        // a 1x1 window always selects its only element
+        for (int i = 0; i < S; i++) {
+            oneHot[i] = (party == DEALER) ? 0 : 1;
+        }
+    }
+    else if (needOneHot) {
+        // Selection bit of every node, top-down: the root is selected, the right
+        // child of a selected node is selected iff its comparison bit is set and
+        // the left child gets the rest. Values are masked bits as in MaxPoolOneHot.
+        int32_t bitsOff = K - 1;
+        GroupElement *parent = make_array<GroupElement>(K * S);
+        GroupElement *child = make_array<GroupElement>(K * S);
+        // one packed key per 64 ANDs of a level
+        int32_t numKeys = 0;
+        for (int l = 0; l < levels - 1; l++) {
+            numKeys += bitwiseAndKeyCount((count[l] / 2) * S);
+        }
+        BitwiseAndKeyPack *keys = new BitwiseAndKeyPack[numKeys];
+        BitwiseAndKeyPack *keys1 = nullptr;
+        if (party == DEALER) {
+            keys1 = new BitwiseAndKeyPack[numKeys];
+        }
+        else {
+            for (int i = 0; i < numKeys; i++) {
+                keys[i] = dealer->recv_bitwise_and_key();
+            }
+            peer->sync();
+        }
+        auto start = std::chrono::high_resolution_clock::now();
+        int32_t kidx = 0;
+        for (int l = levels - 1; l >= 0; l--) {
+            int32_t half = count[l] / 2;
+            bitsOff -= half;
+            GroupElement *b = bits + bitsOff * S;
+            if (l == levels - 1) {
+                // the root compares the two nodes below it and is always selected
+                for (int i = 0; i < S; i++) {
+                    child[S + i] = b[i];
+                    child[i] = (party == DEALER) ? b[i] : (b[i] ^ 1);
+                }
+            }
+            else {
+                // right children of the level, gathered in next
+                if (party == DEALER) {
+                    keyGenBitwiseAnd(half * S, parent, b, next, keys + kidx, keys1 + kidx);
+                    for (int i = 0; i < bitwiseAndKeyCount(half * S); i++) {
+                        server->send_bitwise_and_key(keys[kidx + i]);
+                        client->send_bitwise_and_key(keys1[kidx + i]);
+                    }
+                }
+                else {
+                    evalBitwiseAnd(party - 2, half * S, parent, b, keys + kidx, next);
+                    reconstruct(half * S, next, 1);
+                }
+                kidx += bitwiseAndKeyCount(half * S);
+                for (int32_t idx = 0; idx < half * S; idx++) {
+                    int j = idx / S;
+                    int i = idx % S;
+                    GroupElement right = next[idx];
+                    mod(right, 1);
+                    child[(2 * j + 1) * S + i] = right;
+                    child[2 * j * S + i] = parent[idx] ^ right;
+                }
+            }
+            if (count[l] % 2 == 1) {
+                memcpy(child + (count[l] - 1) * S, parent + half * S, S * sizeof(GroupElement));
+            }
+            std::swap(parent, child);
+        }
+        memcpy(oneHot, parent, K * S * sizeof(GroupElement));
+        auto end = std::chrono::high_resolution_clock::now();
+        auto eval_time = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        if (party == DEALER) {
+            dealerMicroseconds += eval_time;
+        }
+        else {
+            evalMicroseconds += eval_time;
+            selectEvalMicroseconds += eval_time;
+        }
+        delete[] keys;
+        delete[] keys1;
+        delete[] parent;
+        delete[] child;
+    }
+    delete[] vals;
+    delete[] bits;
+    delete[] next;
+    std::cerr << ">> MaxPoolTree - End" << "\n";
+}
+
 void ConvTranspose3DWrapper(int64_t N, 
     int64_t D, 
     int64_t H, 
@@ -1448,6 +1791,7 @@ void ConvTranspose3DWrapper(int64_t N,
     GroupElement* outArr)
 {
     std::cerr << ">> ConvTranspose3D - Start" << "\n";
+    TRACE_LAYER("ConvTranspose3D");
     always_assert(outD == (D - 1) * strideD - zPadDLeft - zPadDRight + FD);
     always_assert(outH == (H - 1) * strideH - zPadHLeft - zPadHRight + FH);
     always_assert(outW == (W - 1) * strideW - zPadWLeft - zPadWRight + FW);
@@ -1476,6 +1820,7 @@ void ConvTranspose3DWrapper(int64_t N,
         auto keyread_start = std::chrono::high_resolution_clock::now();
         auto key = dealer->recv_triple_key(bitlength, N * D * H * W * CI, CI * FD * FH * FW * CO, N * outD * outH * outW * CO);
         auto keyread_end = std::chrono::high_resolution_clock::now();
+        trace::addKeyRead(std::chrono::duration_cast<std::chrono::microseconds>(keyread_end - keyread_start).count());
         auto keyread_time_taken = std::chrono::duration_cast<std::chrono::milliseconds>(keyread_end - keyread_start).count();
 
         peer->sync();
@@ -1532,6 +1877,7 @@ void ConvTranspose2DWrapper(int64_t N,
                             GroupElement *outArr)
 {
     std::cerr << ">> ConvTranspose2D - Start" << std::endl;
+    TRACE_LAYER("ConvTranspose2D");
     always_assert(outH == (H - 1) * strideH - zPadHLeft - zPadHRight + FH);
     always_assert(outW == (W - 1) * strideW - zPadWLeft - zPadWRight + FW);
 
@@ -1563,6 +1909,7 @@ void ConvTranspose2DWrapper(int64_t N,
         auto keyread_start = std::chrono::high_resolution_clock::now();
         auto key = dealer->recv_triple_key(bitlength, N * H * W * CI, CI * FH * FW * CO, N * outH * outW * CO);
         auto keyread_end = std::chrono::high_resolution_clock::now();
+        trace::addKeyRead(std::chrono::duration_cast<std::chrono::microseconds>(keyread_end - keyread_start).count());
         auto keyread_time_taken = std::chrono::duration_cast<std::chrono::milliseconds>(keyread_end - keyread_start).count();
 
         peer->sync();
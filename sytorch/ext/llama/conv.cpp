@@ -205,6 +205,150 @@ void EvalConv2D(int party, const Conv2DKey &key,
     freeConv2DCache(cache);
 }
 
+std::pair<MatMulKey, MatMulKey> KeyGenMatMulServerWeights(int Bin, int Bout, int s1, int s2, int s3, GroupElement *rin1, GroupElement *rin2, GroupElement *rout){
+    MatMulKey k0;
+    MatMulKey k1;
+
+    k0.Bin = Bin; k1.Bin = Bin;
+    k0.Bout = Bout; k1.Bout = Bout;
+    k0.s1 = s1; k0.s2 = s2; k0.s3 = s3;
+    k1.s1 = s1; k1.s2 = s2; k1.s3 = s3;
+
+    k0.a = make_array<GroupElement>(s1, s2);
+    k0.b = nullptr;
+    k0.c = make_array<GroupElement>(s1, s3);
+
+    k1.a = make_array<GroupElement>(s1, s2);
+    k1.b = nullptr;
+    k1.c = make_array<GroupElement>(s1, s3);
+
+    for (int i = 0; i < s1 * s2; i++)
+    {
+        auto rin1_split = splitShareCommonPRNG(rin1[i], Bin);
+        k0.a[i] = rin1_split.first;
+        k1.a[i] = rin1_split.second;
+    }
+
+    // the client multiplies a1 with the masked weight, so c absorbs a1 * rin2
+    GroupElement *c = make_array<GroupElement>(s1, s3);
+    MatMul(s1, s2, s3, k1.a, rin2, c);
+    MatAdd(s1, s3, c, rout, c);
+
+    for (int i = 0; i < s1 * s3; i++)
+    {
+        auto rout_split = splitShareCommonPRNG(c[i], Bout);
+        k0.c[i] = rout_split.first;
+        k1.c[i] = rout_split.second;
+    }
+
+    delete[] c;
+
+    return std::make_pair(k0, k1);
+}
+
+void EvalMatMulServerWeights(int party, const MatMulKey &key, int s1, int s2, int s3, GroupElement *A, GroupElement *B, GroupElement *C)
+{
+    if (party == SERVER)
+    {
+        GroupElement *tmp = make_array<GroupElement>(s1, s2);
+        MatSub(s1, s2, A, key.a, tmp);
+        MatMul(s1, s2, s3, tmp, B, C);
+        MatAdd(s1, s3, C, key.c, C);
+        delete[] tmp;
+    }
+    else
+    {
+        MatMul(s1, s2, s3, key.a, B, C);
+        MatSub(s1, s3, key.c, C, C);
+    }
+}
+
+std::pair<Conv2DKey, Conv2DKey> KeyGenConv2DServerWeights(
+    int Bin, int Bout,
+    int N, int H, int W, int CI, int FH, int FW, int CO,
+    int zPadHLeft, int zPadHRight, 
+    int zPadWLeft, int zPadWRight,
+    int strideH, int strideW,
+    GroupElement *rin1,  GroupElement * rin2, GroupElement * rout)
+{
+    Conv2DKey k0;
+    Conv2DKey k1;
+
+    k0.Bin = Bin; k1.Bin = Bin;
+    k0.Bout = Bout; k1.Bout = Bout;
+
+    int d0 = N;
+    int d1 = ((H - FH + (zPadHLeft + zPadHRight)) / strideH) + 1;
+    int d2 = ((W - FW + (zPadWLeft + zPadWRight)) / strideW) + 1;
+    int d3 = CO;
+    k0.a = make_array<GroupElement>(N, H, W, CI);
+    k1.a = make_array<GroupElement>(N, H, W, CI);
+    k0.b = nullptr;
+    k1.b = nullptr;
+    k0.c = make_array<GroupElement>(d0, d1, d2, d3);
+    k1.c = make_array<GroupElement>(d0, d1, d2, d3);
+    k0.N = N; k0.H = H; k0.W = W; k0.CI = CI; k0.FH = FH; k0.FW = FW; k0.CO = CO; 
+    k1.N = N; k1.H = H; k1.W = W; k1.CI = CI; k1.FH = FH; k1.FW = FW; k1.CO = CO;
+    k0.strideH = strideH; k0.strideW = strideW; k0.zPadHLeft = zPadHLeft; k0.zPadHRight = zPadHRight; k0.zPadWLeft = zPadWLeft; k0.zPadWRight = zPadWRight;
+    k1.strideH = strideH; k1.strideW = strideW; k1.zPadHLeft = zPadHLeft; k1.zPadHRight = zPadHRight; k1.zPadWLeft = zPadWLeft; k1.zPadWRight = zPadWRight;
+
+    for (int i = 0; i < N * H * W * CI; ++i) {
+        auto rin1_split = splitShareCommonPRNG(rin1[i], Bin);
+        k0.a[i] = rin1_split.first;
+        k1.a[i] = rin1_split.second;
+    }
+
+    // the client convolves a1 with the masked filter, so c absorbs a1 * rin2
+    GroupElement* c = make_array<GroupElement>(d0 * d1 * d2 * d3);
+    Conv2DPlaintext(N, H, W, CI, FH, FW, CO,
+        zPadHLeft, zPadHRight, 
+        zPadWLeft, zPadWRight,
+        strideH, strideW, k1.a, rin2, c);
+    MatAdd4(d0, d1, d2, d3, c, rout, c);
+
+    for (int i = 0; i < d0 * d1 * d2 * d3; ++i) {
+        auto c_split = splitShareCommonPRNG(c[i], Bout);
+        k0.c[i] = c_split.first;
+        k1.c[i] = c_split.second;
+    }
+
+    delete[] c;
+
+    return std::make_pair(k0, k1);
+}
+
+void EvalConv2DServerWeights(int party, const Conv2DKey &key,
+    int N, int H, int W, int CI, int FH, int FW, int CO,
+    int zPadHLeft, int zPadHRight, 
+    int zPadWLeft, int zPadWRight,
+    int strideH, int strideW, GroupElement* input, GroupElement* filter, GroupElement* output)
+{
+    int d0 = N;
+    int d1 = ((H - FH + (zPadHLeft + zPadHRight)) / strideH) + 1;
+    int d2 = ((W - FW + (zPadWLeft + zPadWRight)) / strideW) + 1;
+    int d3 = CO;
+
+    if (party == SERVER)
+    {
+        GroupElement *tempInput = make_array<GroupElement>(N, H, W, CI);
+        MatSub4(N, H, W, CI, input, key.a, tempInput);
+        Conv2DPlaintext(N, H, W, CI, FH, FW, CO,
+            zPadHLeft, zPadHRight, 
+            zPadWLeft, zPadWRight,
+            strideH, strideW, tempInput, filter, output);
+        MatAdd4(d0, d1, d2, d3, output, key.c, output);
+        delete[] tempInput;
+    }
+    else
+    {
+        Conv2DPlaintext(N, H, W, CI, FH, FW, CO,
+            zPadHLeft, zPadHRight, 
+            zPadWLeft, zPadWRight,
+            strideH, strideW, key.a, filter, output);
+        MatSub4(d0, d1, d2, d3, key.c, output, output);
+    }
+}
+
 std::pair<Conv3DKey, Conv3DKey> KeyGenConv3D(
     int Bin, int Bout,
     int N, int D, int H, int W, int CI, int FD, int FH, int FW, int CO,
@@ -38,6 +38,29 @@ void EvalConv2D(int party, const Conv2DKey &key,
     int zPadWLeft, int zPadWRight,
     int strideH, int strideW, GroupElement* input, GroupElement* filter, GroupElement* output);
 
+// Server-known weights: the server holds the weight (rin2 is its input mask)
+// in the clear, the client only its masked value. The keys carry no weight
+// mask (b is null), and each party evaluates a single local product:
+//   server: (x^ - a0) * W + c0,  client: c1 - a1 * W^,  c = rout + a1 * rin2
+std::pair<MatMulKey, MatMulKey> KeyGenMatMulServerWeights(int Bin, int Bout, int s1, int s2, int s3, GroupElement *rin1, GroupElement *rin2, GroupElement *rout);
+
+// B is the clear weight on the server and the masked weight on the client
+void EvalMatMulServerWeights(int party, const MatMulKey &key, int s1, int s2, int s3, GroupElement *A, GroupElement *B, GroupElement *C);
+
+std::pair<Conv2DKey, Conv2DKey> KeyGenConv2DServerWeights(
+    int Bin, int Bout,
+    int N, int H, int W, int CI, int FH, int FW, int CO,
+    int zPadHLeft, int zPadHRight, 
+    int zPadWLeft, int zPadWRight,
+    int strideH, int strideW,
+    GroupElement *rin1,  GroupElement * rin2, GroupElement * rout);
+
+void EvalConv2DServerWeights(int party, const Conv2DKey &key,
+    int N, int H, int W, int CI, int FH, int FW, int CO,
+    int zPadHLeft, int zPadHRight, 
+    int zPadWLeft, int zPadWRight,
+    int strideH, int strideW, GroupElement* input, GroupElement* filter, GroupElement* output);
+
 std::pair<Conv3DKey, Conv3DKey> KeyGenConv3D(
     int Bin, int Bout,
     int N, int D, int H, int W, int CI, int FD, int FH, int FW, int CO,
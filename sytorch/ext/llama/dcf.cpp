@@ -20,6 +20,7 @@ SOFTWARE.
 */
 
 #include "dcf.h"
+#include <utils/aes_multikey.h>
 #include <omp.h>
 
 using namespace osuCrypto;
@@ -59,13 +60,18 @@ void convert(const int bitsize, const int groupSize, const block &b, uint64_t *o
     }
     else {
         int numblocks = totalBys % 16 == 0 ? totalBys / 16 : (totalBys / 16) + 1;
-        AES aes(b);
         block pt[numblocks];
         block ct[numblocks];
         for(int i = 0; i < numblocks; i++) {
             pt[i] = toBlock(0, i);
         }
-        aes.ecbEncBlocks(pt, numblocks, ct);
+        if (numblocks <= aes_multikey::maxBlocks) {
+            aes_multikey::encrypt(1, &b, pt, numblocks, ct);
+        }
+        else {
+            AES aes(b);
+            aes.ecbEncBlocks(pt, numblocks, ct);
+        }
         uint8_t *bptr = (uint8_t *)ct;
         for(int i = 0; i < groupSize; i++) {
             out[i] = *(uint64_t *)(bptr + i * bys);
@@ -98,8 +104,7 @@ block traverseOneDCF(int Bin, int Bout, int groupSize, int party,
     const auto mask = zeroAndAllOne[t_previous];
     auto ss = s & notThreeBlock;
 
-    AES ak(ss);
-    ak.ecbEncTwoBlocks(blocks + 2 * keep, ct);
+    aes_multikey::encrypt(1, &ss, blocks + 2 * keep, 2, ct);
 
     stcw = ((scw ^ ds[keep]) & mask) ^ ct[0];
     uint64_t sign = (party == SERVER1) ? -1 : 1;
@@ -166,7 +171,7 @@ std::pair<DCFKeyPack, DCFKeyPack> keyGenDCF(int Bin, int Bout, int groupSize,
     s[0] = (s[0] & notOneBlock) ^ ((s[1] & OneBlock) ^ OneBlock);
     k0[0] = s[0];
     k1[0] = s[1];
-    block ct[4];
+    block ct[8];
 
     for (int i = 0; i < Bin; ++i)
     {
@@ -176,18 +181,17 @@ std::pair<DCFKeyPack, DCFKeyPack> keyGenDCF(int Bin, int Bout, int groupSize,
         auto ss0 = s[0] & notThreeBlock;
         auto ss1 = s[1] & notThreeBlock;
 
-        AES ak0(ss0);
-        AES ak1(ss1);
-        ak0.ecbEncFourBlocks(pt, ct);
+        const block ks[2] = {ss0, ss1};
+        const block pts[8] = {pt[0], pt[1], pt[2], pt[3], pt[0], pt[1], pt[2], pt[3]};
+        aes_multikey::encrypt(2, ks, pts, 4, ct);
         si[0][0] = ct[0];
         si[0][1] = ct[1];
         vi[0][0] = ct[2];
         vi[0][1] = ct[3];
-        ak1.ecbEncFourBlocks(pt, ct);
-        si[1][0] = ct[0];
-        si[1][1] = ct[1];
-        vi[1][0] = ct[2];
-        vi[1][1] = ct[3];
+        si[1][0] = ct[4];
+        si[1][1] = ct[5];
+        vi[1][0] = ct[6];
+        vi[1][1] = ct[7];
 
         auto ti0 = lsb(s[0]);
         auto ti1 = lsb(s[1]);
@@ -336,7 +340,7 @@ std::pair<DualDCFKeyPack, DualDCFKeyPack> keyGenDualDCF(int Bin, int Bout, int g
     key1.sb = new GroupElement[groupSize];
 
     for (int i = 0; i < groupSize; i++) {
-        auto payload2_split = splitShare(payload2[i], Bout);
+        auto payload2_split = splitShareCommonPRNG(payload2[i], Bout);
         key0.sb[i] = payload2_split.first; key1.sb[i] = payload2_split.second;
     }
 
@@ -22,6 +22,7 @@ SOFTWARE.
 #pragma once
 
 #include <llama/group_element.h>
+#include <initializer_list>
 
 #define MASK_PAIR(x) x, x##_mask
 
@@ -30,8 +31,10 @@ namespace llama {
     void end();
 }
 
+// serverWeights: B (resp. the filter) is a weight the server holds in the
+// clear, passed unmasked on the server; see KeyGenConv2DServerWeights
 void MatMul2D(int32_t s1, int32_t s2, int32_t s3, MASK_PAIR(GroupElement *A),
-            MASK_PAIR(GroupElement *B), MASK_PAIR(GroupElement *C), bool modelIsA);
+            MASK_PAIR(GroupElement *B), MASK_PAIR(GroupElement *C), bool modelIsA, bool serverWeights = false);
 
 void Conv2DWrapper(int32_t N, int32_t H, int32_t W,
                    int32_t CI, int32_t FH, int32_t FW,
@@ -39,7 +42,7 @@ void Conv2DWrapper(int32_t N, int32_t H, int32_t W,
                    int32_t zPadHRight, int32_t zPadWLeft,
                    int32_t zPadWRight, int32_t strideH,
                    int32_t strideW, MASK_PAIR(GroupElement *inputArr), MASK_PAIR(GroupElement *filterArr),
-                   MASK_PAIR(GroupElement *outArr));
+                   MASK_PAIR(GroupElement *outArr), bool serverWeights = false);
 
 void Conv2DGroupWrapper(int64_t N, int64_t H, int64_t W,
                         int64_t CI, int64_t FH, int64_t FW,
@@ -92,10 +95,14 @@ void Floor(int32_t s1, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *o
 
 void PiranhaSoftmax(int32_t s1, int32_t s2, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *outArr), int32_t sf);
 
-void ARS(int32_t size, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *outArr), int32_t shift);
+// effectiveInputBw: the inputs are known to be signed values of that many
+// bits, and the comparisons inside run on that many bits only (0: bitlength)
+void ARS(int32_t size, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *outArr), int32_t shift, int effectiveInputBw = 0);
 
 void Select(int32_t size, GroupElement *s, GroupElement *x, GroupElement *out);
 
+// ReLU in two rounds: the sign bit is computed on the low effectiveInputBw
+// bits of the input, which must hold its signed value, and opened first
 void Relu2Round(int32_t size, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *outArr), GroupElement *drelu_cache, int effectiveInputBw);
 
 void MaxPoolDouble(int32_t N, int32_t H, int32_t W, int32_t C, int32_t FH,
@@ -106,6 +113,12 @@ void MaxPoolDouble(int32_t N, int32_t H, int32_t W, int32_t C, int32_t FH,
 
 void MaxPoolOneHot(int32_t N, int32_t H, int32_t W, int32_t C, int32_t FH, int32_t FW, GroupElement *maxBits, GroupElement *oneHot);
 
+void MaxPoolTree(int32_t N, int32_t H, int32_t W, int32_t C, int32_t FH,
+             int32_t FW, int32_t zPadHLeft, int32_t zPadHRight,
+             int32_t zPadWLeft, int32_t zPadWRight, int32_t strideH,
+             int32_t strideW, int32_t N1, int32_t imgH, int32_t imgW,
+             int32_t C1, MASK_PAIR(GroupElement *inArr), MASK_PAIR(GroupElement *outArr), GroupElement *oneHot);
+
 void MaxPoolBackward(int32_t N, int32_t H, int32_t W, int32_t C, int32_t FH,
              int32_t FW, int32_t zPadHLeft, int32_t zPadHRight,
              int32_t zPadWLeft, int32_t zPadWRight, int32_t strideH,
@@ -163,3 +176,14 @@ void ConvTranspose2DWrapper(int64_t N,
                             GroupElement *outArr);
 
 void reconstruct(int32_t size, GroupElement *arr, int bw);
+
+// size shares of bw bits each, opened in place by reconstruct()
+struct SharesToOpen {
+    GroupElement *arr;
+    int32_t size;
+    int bw;
+};
+
+// Opens independent arrays of shares together, in one round and one message
+// each way; each is sent at exactly its bitwidth
+void reconstruct(std::initializer_list<SharesToOpen> parts);
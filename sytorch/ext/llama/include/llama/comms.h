@@ -25,6 +25,7 @@ SOFTWARE.
 #include <iostream>
 #include <llama/keypack.h>
 #include <llama/array.h>
+#include <utils/netem.h>
 
 #include <arpa/inet.h>
 #include <netinet/in.h>
@@ -39,35 +40,88 @@ SOFTWARE.
 #include <stdio.h>
 #include <string.h>
 #include <fstream>
+#include <vector>
 
 #define DEALER 1
 #define SERVER 2
 #define CLIENT 3
 
+// Stream buffer over a socket that carries keys from a concurrently running
+// dealer to an evaluator (LlamaConfig::streamKeys), in place of the key
+// files. Writes and reads go through a fixed buffer; TCP flow control stops
+// the dealer once the evaluator's socket and this buffer are full, so an
+// evaluator holds at most a bounded window of keys it has not yet read.
+class KeyStreamBuf : public std::streambuf {
+public:
+    // The dealer's server and client streams are siblings: before a stream
+    // blocks on a full socket it hands the other's pending bytes to the
+    // kernel, so neither evaluator waits on keys held back in this buffer
+    KeyStreamBuf *sibling = nullptr;
+
+    KeyStreamBuf(int socket, size_t bufferSize = 1 << 20);
+    ~KeyStreamBuf();
+
+    void close();
+
+protected:
+    int_type overflow(int_type c) override;
+    int sync() override;
+    int_type underflow() override;
+
+private:
+    int socket;
+    std::vector<char> buffer;
+    bool flushPending();
+};
+
 class Peer {
 public:
     int sendsocket, recvsocket;
+    // Keys are written to file: backed by fileBuf, or by keyStream when they
+    // are streamed to the evaluator
     bool useFile = false;
-    std::fstream file;
+    std::iostream file{nullptr};
+    std::filebuf fileBuf;
+    KeyStreamBuf *keyStream = nullptr;
     uint64_t bytesSent = 0;
     uint64_t bytesReceived = 0;
+    // Emulated outgoing link (see netem.h); null unless EZPC_NETEM is set
+    netem::Link *link = nullptr;
     
 
     Peer(std::string ip, int port);
     Peer(int sendsocket, int recvsocket) {
         this->sendsocket = sendsocket;
         this->recvsocket = recvsocket;
+        this->link = netem::Link::fromEnv(sendsocket);
     }
     Peer(std::string filename) {
         this->useFile = true;
-        this->file.open(filename, std::ios::out | std::ios::binary);
+        this->fileBuf.open(filename, std::ios::out | std::ios::binary);
+        this->file.rdbuf(&fileBuf);
+    }
+    // Dealer's end of a key stream, see waitForKeyStream()
+    Peer(KeyStreamBuf *keyStream) {
+        this->useFile = true;
+        this->keyStream = keyStream;
+        this->file.rdbuf(keyStream);
     }
 
     void close();
 
+    void send_bytes(const void *data, size_t size);
+
+    // Sends size bytes from out while receiving as many into in, on the
+    // calling thread; both parties call it with their own buffers
+    void exchange_bytes(const void *out, void *in, size_t size);
+
     void send_ge(const GroupElement &g, int bw);
     void send_ge_array(const GroupElement *g, int size);
 
+    // Share split with splitShareCommonPRNG/splitShareXorCommonPRNG: the
+    // server derives its half from prngShared, so only the client's is sent
+    void send_share(const GroupElement &g, int bw);
+
     void send_block(const osuCrypto::block &b);
 
     void send_mask(const GroupElement &g);
@@ -146,11 +200,19 @@ public:
 
 Peer* waitForPeer(int port);
 
+// Accepts an evaluator's key stream on port; the server connects to
+// LlamaConfig::port and the client to LlamaConfig::port + 1
+Peer* waitForKeyStream(int port);
+
 class Dealer {
 public:
     int consocket;
+    // Keys are read from file: backed by fileBuf, by keyStream when they are
+    // streamed from the dealer, or bypassed by the mmapped ramdisk
     bool useFile = true;
-    std::fstream file;
+    std::iostream file{nullptr};
+    std::filebuf fileBuf;
+    KeyStreamBuf *keyStream = nullptr;
     uint64_t bytesSent = 0;
     uint64_t bytesReceived = 0;
     bool ramdisk =true;
@@ -158,13 +220,23 @@ public:
     char *ramdiskStart;
     int ramdiskSize;
     bool ramdisk_path = false;
+    // Of the key file, to tell it from the one of another run; 0 for
+    // streamed keys. The modification time is in nanoseconds
+    uint64_t keyFileSize = 0;
+    uint64_t keyFileMtime = 0;
 
+    // Keys streamed from the dealer at ip, see waitForKeyStream()
     Dealer(std::string ip, int port);
 
     Dealer(std::string filename, bool ramdisk,bool ramdisk_path) {
         this->useFile = true;
         this->ramdisk = ramdisk;
         this->ramdisk_path = ramdisk_path;
+        struct stat st;
+        if (stat(filename.c_str(), &st) == 0) {
+            keyFileSize = st.st_size;
+            keyFileMtime = (uint64_t) st.st_mtim.tv_sec * 1000000000ULL + st.st_mtim.tv_nsec;
+        }
         if (ramdisk && ramdisk_path) {
             int fd = open(filename.c_str(), O_RDWR | O_CREAT, 0);
             struct stat sb;
@@ -178,12 +250,18 @@ public:
             ::close(fd);
         }
         else {
-            this->file.open(filename, std::ios::in | std::ios::binary);
+            this->fileBuf.open(filename, std::ios::in | std::ios::binary);
+            this->file.rdbuf(&fileBuf);
         }
     }
 
     void close();
 
+    // Position in the key file, to resume a run from a checkpoint; not
+    // available for streamed keys
+    uint64_t keyOffset();
+    void seekKeys(uint64_t offset);
+
     GroupElement recv_mask();
 
     MultKey recv_mult_key();
@@ -192,6 +270,9 @@ public:
 
     GroupElement recv_ge(int bw);
 
+    // Counterpart of Peer::send_share, drawn in the order the dealer split
+    GroupElement recv_share(int bw);
+
     void recv_ge_array(const GroupElement *g, int size);
 
     void recv_ge_array(int bw, int size, GroupElement *arr);
@@ -200,14 +281,14 @@ public:
 
     DualDCFKeyPack recv_ddcf_keypack(int Bin, int Bout, int groupSize);
 
-    MatMulKey recv_matmul_key(int bin, int bout, int s1, int s2, int s3);
+    MatMulKey recv_matmul_key(int bin, int bout, int s1, int s2, int s3, bool serverWeights = false);
 
     Conv2DKey recv_conv2d_key(int bin, int bout, int64_t N, int64_t H, int64_t W,
                    int64_t CI, int64_t FH, int64_t FW,
                    int64_t CO, int64_t zPadHLeft,
                    int64_t zPadHRight, int64_t zPadWLeft,
                    int64_t zPadWRight, int64_t strideH,
-                   int64_t strideW);
+                   int64_t strideW, bool serverWeights = false);
 
     Conv3DKey recv_conv3d_key(int bin, int bout, int64_t N, int64_t D, int64_t H, int64_t W,
                    int64_t CI, int64_t FD, int64_t FH, int64_t FW, int64_t CO,
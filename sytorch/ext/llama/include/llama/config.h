@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 class Peer;
 class Dealer;
 namespace LlamaConfig {
@@ -15,4 +17,12 @@ namespace LlamaConfig {
     extern bool stochasticRT;
     extern bool stochasticT;
     extern bool ramdisk_path;
+    // Conv2D/FC weights are held in the clear by the server; see
+    // KeyGenConv2DServerWeights
+    extern bool serverKnownWeights;
+    // Keys are streamed over sockets from a dealer running alongside the
+    // evaluators, which reach it at dealerIp, instead of going through
+    // server.dat/client.dat
+    extern bool streamKeys;
+    extern std::string dealerIp;
 }
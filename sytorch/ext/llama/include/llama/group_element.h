@@ -76,6 +76,15 @@ inline std::pair<GroupElement, GroupElement> splitShareCommonPRNG(const GroupEle
     return std::make_pair(a1, a2);
 }
 
+inline std::pair<GroupElement, GroupElement> splitShareXorCommonPRNG(const GroupElement& a, int bw)
+{
+    GroupElement a1, a2;
+    a1 = prngShared.get<uint64_t>();
+    mod(a1, bw);
+    a2 = a ^ a1;
+    return std::make_pair(a1, a2);
+}
+
 inline GroupElement pow(GroupElement x, uint64_t e)
 {
     if (e == 0)
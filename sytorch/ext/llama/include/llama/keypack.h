@@ -58,6 +58,8 @@ struct MultKey{
     GroupElement a, b, c;
 };
 
+// b is null in keys for a weight known in the clear to the server
+// (KeyGenMatMulServerWeights / KeyGenConv2DServerWeights)
 struct MatMulKey{
     int Bin, Bout;
     int s1, s2, s3;
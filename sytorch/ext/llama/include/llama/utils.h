@@ -60,11 +60,15 @@ void matmul_eval_helper(int party, int dim1, int dim2, int dim3, GroupElement *A
                             GroupElement *B, GroupElement *C, GroupElement *ka, GroupElement *kb, GroupElement *kc);
 
 void packBitArray(GroupElement *A, int size, uint8_t *out);
+void unpackBitArray(const uint8_t *A, int size, GroupElement *out);
+
+// The low bw bits of each of size values, back to back and least significant
+// bit first, in packedBytes(size, bw) bytes
+inline size_t packedBytes(int64_t size, int bw) { return (size * bw + 7) / 8; }
+void packFixedWidth(const GroupElement *A, int size, int bw, uint8_t *out);
+void unpackFixedWidth(const uint8_t *A, int size, int bw, GroupElement *out);
 
 struct Conv2DCache {
-    eigenMatrix reshapedFilter;
-    eigenMatrix reshapedInput;
-    eigenMatrix matmulResult;
     GroupElement *temp;
 };
 
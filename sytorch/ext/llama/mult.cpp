@@ -34,9 +34,9 @@ std::pair<MultKey, MultKey> MultGen(GroupElement rin1, GroupElement rin2, GroupE
     // k1.Bout = Bout; k2.Bout = Bout;
 
     GroupElement c  = rin1 * rin2 + rout;
-    auto a_split = splitShare(rin1, 64);
-    auto b_split = splitShare(rin2, 64);
-    auto c_split = splitShare(c, 64);
+    auto a_split = splitShareCommonPRNG(rin1, 64);
+    auto b_split = splitShareCommonPRNG(rin2, 64);
+    auto c_split = splitShareCommonPRNG(c, 64);
     
     k1.a = (a_split.first);
     k1.b = (b_split.first);
@@ -41,7 +41,7 @@ std::pair<ScmpKeyPack, ScmpKeyPack> keyGenSCMP(int Bin, int Bout, GroupElement r
     auto keys = keyGenDualDCF(Bin-1, Bout, y_idx, payload1, payload2);
     key0.dualDcfKey = keys.first; 
     key1.dualDcfKey = keys.second;
-    auto rout_split = splitShare(rout, Bout);
+    auto rout_split = splitShareCommonPRNG(rout, Bout);
     key0.rb = rout_split.first; key1.rb = rout_split.second;
     return std::make_pair(key0, key1);
 }
@@ -91,11 +91,11 @@ std::pair<ARSKeyPack, ARSKeyPack> keyGenARS(int Bin, int Bout, uint64_t shift, G
         payload2[1] = y_msb;
         auto dualDcfKeys = keyGenDualDCF(Bin - 1, Bout, 2, alpha_n, payload1, payload2);
         k0.dualDcfKey = dualDcfKeys.first; k1.dualDcfKey = dualDcfKeys.second;
-        auto rb_split = splitShare(rout + (alpha_n >> shift), Bout);
+        auto rb_split = splitShareCommonPRNG(rout + (alpha_n >> shift), Bout);
         k0.rb = rb_split.first; k1.rb = rb_split.second;
     }
     else {
-        auto rb_split = splitShare(rout + GroupElement(y >> shift), Bout);
+        auto rb_split = splitShareCommonPRNG(rout + GroupElement(y >> shift), Bout);
         k0.rb = rb_split.first; k1.rb = rb_split.second;
     }
 
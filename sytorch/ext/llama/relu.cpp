@@ -53,27 +53,27 @@ std::pair<ReluKeyPack, ReluKeyPack> keyGenRelu(int Bin, int Bout,
 
     GroupElement val;
     val = beta[0] * cr;
-    auto val_split = splitShare(val, Bin);
+    auto val_split = splitShareCommonPRNG(val, Bin);
     k0.e_b0 = val_split.first;
     k1.e_b0 = val_split.second;
 
     val = beta[1] * cr;
-    val_split = splitShare(val, Bin);
+    val_split = splitShareCommonPRNG(val, Bin);
     k0.e_b1 = val_split.first;
     k1.e_b1 = val_split.second;
 
-    auto beta_split = splitShare(beta[0], Bin);
+    auto beta_split = splitShareCommonPRNG(beta[0], Bin);
     k0.beta_b0 = beta_split.first;
     k1.beta_b0 = beta_split.second;
 
-    beta_split = splitShare(beta[1], Bin);
+    beta_split = splitShareCommonPRNG(beta[1], Bin);
     k0.beta_b1 = beta_split.first;
     k1.beta_b1 = beta_split.second;
 
 
-    auto rout_split = splitShare(rout, Bout);
+    auto rout_split = splitShareCommonPRNG(rout, Bout);
     k0.r_b = rout_split.first; k1.r_b = rout_split.second;
-    auto drelu_split = splitShare(routDrelu, 1);
+    auto drelu_split = splitShareCommonPRNG(routDrelu, 1);
     k0.drelu = drelu_split.first; k1.drelu = drelu_split.second;
     k0.k = dcfKeys.first.k;
     k0.g = dcfKeys.first.g;
@@ -136,7 +136,7 @@ std::pair<MaxpoolKeyPack, MaxpoolKeyPack> keyGenMaxpool(int Bin, int Bout, Group
     k0.reluKey = reluKeys.first; 
     k1.reluKey = reluKeys.second;
 
-    auto rb_split = splitShare(-rin1 + rout, Bout);
+    auto rb_split = splitShareCommonPRNG(-rin1 + rout, Bout);
     k0.rb = rb_split.first; k1.rb = rb_split.second;
 
     return std::make_pair(k0, k1);
@@ -21,6 +21,9 @@ SOFTWARE.
 
 #include <llama/comms.h>
 #include <llama/assert.h>
+#include <llama/utils.h>
+#include <errno.h>
+#include <poll.h>
 
 using namespace LlamaConfig;
 
@@ -66,20 +69,153 @@ Peer::Peer(std::string ip, int port) {
         const int one = 1;
         setsockopt(sendsocket, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
     }
+    link = netem::Link::fromEnv(sendsocket);
     std::cerr << "connected" << "\n";
 
 }
 
+KeyStreamBuf::KeyStreamBuf(int socket, size_t bufferSize) : socket(socket), buffer(bufferSize) {
+    // a stream is either written (by the dealer) or read (by an evaluator)
+    setp(buffer.data(), buffer.data() + buffer.size());
+    setg(buffer.data(), buffer.data(), buffer.data());
+}
+
+KeyStreamBuf::~KeyStreamBuf() {
+    close();
+}
+
+bool KeyStreamBuf::flushPending() {
+    const char *buf = pbase();
+    size_t size = pptr() - pbase();
+    while (size > 0) {
+        ssize_t res = send(socket, buf, size, 0);
+        if (res <= 0) {
+            return false;
+        }
+        buf += res;
+        size -= res;
+    }
+    setp(buffer.data(), buffer.data() + buffer.size());
+    return true;
+}
+
+KeyStreamBuf::int_type KeyStreamBuf::overflow(int_type c) {
+    if (sibling != nullptr) {
+        sibling->flushPending();
+    }
+    if (!flushPending()) {
+        return traits_type::eof();
+    }
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(c);
+        pbump(1);
+    }
+    return traits_type::not_eof(c);
+}
+
+int KeyStreamBuf::sync() {
+    return flushPending() ? 0 : -1;
+}
+
+KeyStreamBuf::int_type KeyStreamBuf::underflow() {
+    if (gptr() < egptr()) {
+        return traits_type::to_int_type(*gptr());
+    }
+    ssize_t res = recv(socket, buffer.data(), buffer.size(), 0);
+    if (res <= 0) {
+        return traits_type::eof();
+    }
+    setg(buffer.data(), buffer.data(), buffer.data() + res);
+    return traits_type::to_int_type(*gptr());
+}
+
+void KeyStreamBuf::close() {
+    if (socket < 0) {
+        return;
+    }
+    flushPending();
+    if (sibling != nullptr) {
+        sibling->sibling = nullptr;
+        sibling = nullptr;
+    }
+    ::close(socket);
+    socket = -1;
+}
+
 void Peer::close() {
-    if (useFile) {
-        file.close();
+    if (keyStream != nullptr) {
+        file.flush();
+        delete keyStream;
+        keyStream = nullptr;
+    }
+    else if (useFile) {
+        fileBuf.close();
     }
     else {
+        delete link;
+        link = nullptr;
         ::close(sendsocket);
         ::close(recvsocket);
     }
 }
 
+void Peer::send_bytes(const void *data, size_t size) {
+    if (link != nullptr) {
+        link->send(data, size);
+        return;
+    }
+    const char *buf = (const char *)data;
+    while (size > 0) {
+        ssize_t res = send(sendsocket, buf, size, 0);
+        always_assert(res > 0);
+        buf += res;
+        size -= res;
+    }
+}
+
+void Peer::exchange_bytes(const void *out, void *in, size_t size) {
+    always_assert(!useFile);
+    bytesSent += size;
+    bytesReceived += size;
+    if (link != nullptr) {
+        // the emulated link never blocks the sender
+        send_bytes(out, size);
+        always_assert(size == 0 || recv(recvsocket, in, size, MSG_WAITALL) == (ssize_t)size);
+        return;
+    }
+    // Both parties send before they receive, so a blocking send of more than
+    // the socket buffers would deadlock: interleave the two directions
+    const char *sbuf = (const char *)out;
+    char *rbuf = (char *)in;
+    size_t sent = 0, received = 0;
+    while (sent < size || received < size) {
+        struct pollfd fds[2];
+        int nfds = 0;
+        int sidx = -1, ridx = -1;
+        if (sent < size) {
+            sidx = nfds;
+            fds[nfds++] = {sendsocket, POLLOUT, 0};
+        }
+        if (received < size) {
+            ridx = nfds;
+            fds[nfds++] = {recvsocket, POLLIN, 0};
+        }
+        always_assert(poll(fds, nfds, -1) > 0);
+        if (sidx >= 0 && (fds[sidx].revents & (POLLOUT | POLLERR | POLLHUP))) {
+            ssize_t res = send(sendsocket, sbuf + sent, size - sent, MSG_DONTWAIT);
+            always_assert(res > 0 || (res < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)));
+            if (res > 0)
+                sent += res;
+        }
+        if (ridx >= 0 && (fds[ridx].revents & (POLLIN | POLLERR | POLLHUP))) {
+            ssize_t res = recv(recvsocket, rbuf + received, size - received, MSG_DONTWAIT);
+            always_assert(res > 0 || (res < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)));
+            if (res > 0)
+                received += res;
+        }
+    }
+}
+
 Peer* waitForPeer(int port) {
     int sendsocket, recvsocket;
     std::cerr << "waiting for connection from client...";
@@ -140,6 +276,33 @@ Peer* waitForPeer(int port) {
     return new Peer(sendsocket, recvsocket);
 }
 
+Peer* waitForKeyStream(int port) {
+    std::cerr << "waiting for key stream connection...";
+    struct sockaddr_in dest;
+    struct sockaddr_in serv;
+    socklen_t socksize = sizeof(struct sockaddr_in);
+    memset(&serv, 0, sizeof(serv));
+    serv.sin_family = AF_INET;
+    serv.sin_addr.s_addr = htonl(INADDR_ANY);
+    serv.sin_port = htons(port);
+    int mysocket = socket(AF_INET, SOCK_STREAM, 0);
+    int reuse = 1;
+    setsockopt(mysocket, SOL_SOCKET, SO_REUSEADDR, (const char *)&reuse,
+                sizeof(reuse));
+    if (::bind(mysocket, (struct sockaddr *)&serv, sizeof(struct sockaddr)) < 0) {
+        perror("error: bind");
+        exit(1);
+    }
+    if (listen(mysocket, 1) < 0) {
+        perror("error: listen");
+        exit(1);
+    }
+    int keysocket = accept(mysocket, (struct sockaddr *)&dest, &socksize);
+    close(mysocket);
+    std::cerr << "connected" << "\n";
+    return new Peer(new KeyStreamBuf(keysocket));
+}
+
 
 void Peer::send_ge(const GroupElement &g, int bw) {
     if (bw > 32) {
@@ -147,7 +310,7 @@ void Peer::send_ge(const GroupElement &g, int bw) {
         if (useFile) {
             this->file.write(buf, 8);
         } else {
-            send(sendsocket, buf, 8, 0);
+            send_bytes(buf, 8);
         }
         bytesSent += 8;
     }
@@ -156,7 +319,7 @@ void Peer::send_ge(const GroupElement &g, int bw) {
         if (useFile) {
             this->file.write(buf, 4);
         } else {
-            send(sendsocket, buf, 4, 0);
+            send_bytes(buf, 4);
         }
         bytesSent += 4;
     }
@@ -165,7 +328,7 @@ void Peer::send_ge(const GroupElement &g, int bw) {
         if (useFile) {
             this->file.write(buf, 2);
         } else {
-            send(sendsocket, buf, 2, 0);
+            send_bytes(buf, 2);
         }
         bytesSent += 2;
     }
@@ -174,7 +337,7 @@ void Peer::send_ge(const GroupElement &g, int bw) {
         if (useFile) {
             this->file.write(buf, 1);
         } else {
-            send(sendsocket, buf, 1, 0);
+            send_bytes(buf, 1);
         }
         bytesSent += 1;
     }
@@ -186,17 +349,23 @@ void Peer::send_ge_array(const GroupElement *g, int size) {
     if (useFile) {
         this->file.write(buf, 8*size);
     } else {
-        send(sendsocket, buf, 8*size, 0);
+        send_bytes(buf, 8*size);
     }
     bytesSent += (8*size);
 }
 
+void Peer::send_share(const GroupElement &g, int bw) {
+    if (this != server) {
+        send_ge(g, bw);
+    }
+}
+
 void Peer::send_block(const osuCrypto::block &b) {
     char *buf = (char *)(&b);
     if (useFile) {
         this->file.write(buf, sizeof(osuCrypto::block));
     } else {
-        send(sendsocket, buf, sizeof(osuCrypto::block), 0);
+        send_bytes(buf, sizeof(osuCrypto::block));
     }
     bytesSent += sizeof(osuCrypto::block);
 }
@@ -211,7 +380,21 @@ void Peer::send_input(const GroupElement &g) {
 
 void Peer::send_batched_input(GroupElement *g, int size, int bw)
 {
-    if (bw > 32) {
+    if (bw == 1) {
+        // shares of single bits, 8 to a byte
+        int bytes = (size + 7) / 8;
+        uint8_t *temp = new uint8_t[bytes];
+        packBitArray(g, size, temp);
+        char *buf = (char *)(temp);
+        if (useFile) {
+            this->file.write(buf, bytes);
+        } else {
+            send_bytes(buf, bytes);
+        }
+        delete[] temp;
+        bytesSent += bytes;
+    }
+    else if (bw > 32) {
         uint64_t *temp = new uint64_t[size];
         for (int i = 0; i < size; i++) {
             temp[i] = g[i];
@@ -220,7 +403,7 @@ void Peer::send_batched_input(GroupElement *g, int size, int bw)
         if (useFile) {
             this->file.write(buf, 8*size);
         } else {
-            send(sendsocket, buf, 8*size, 0);
+            send_bytes(buf, 8*size);
         }
         delete[] temp;
         bytesSent += 8*size;
@@ -234,7 +417,7 @@ void Peer::send_batched_input(GroupElement *g, int size, int bw)
         if (useFile) {
             this->file.write(buf, 4*size);
         } else {
-            send(sendsocket, buf, 4*size, 0);
+            send_bytes(buf, 4*size);
         }
         delete[] temp;
         bytesSent += 4*size;
@@ -248,7 +431,7 @@ void Peer::send_batched_input(GroupElement *g, int size, int bw)
         if (useFile) {
             this->file.write(buf, 2*size);
         } else {
-            send(sendsocket, buf, 2*size, 0);
+            send_bytes(buf, 2*size);
         }
         delete[] temp;
         bytesSent += 2*size;
@@ -262,7 +445,7 @@ void Peer::send_batched_input(GroupElement *g, int size, int bw)
         if (useFile) {
             this->file.write(buf, size);
         } else {
-            send(sendsocket, buf, size, 0);
+            send_bytes(buf, size);
         }
         delete[] temp;
         bytesSent += size;
@@ -271,11 +454,23 @@ void Peer::send_batched_input(GroupElement *g, int size, int bw)
 
 void Peer::recv_batched_input(uint64_t *g, int size, int bw)
 {
-    if (bw > 32) {
+    if (bw == 1) {
+        int bytes = (size + 7) / 8;
+        uint8_t *tmp = new uint8_t[bytes];
+        if (useFile) {
+            this->file.read((char *)tmp, bytes);
+        } else {
+            always_assert(recv(recvsocket, (char *)tmp, bytes, MSG_WAITALL) == (ssize_t)bytes);
+        }
+        unpackBitArray(tmp, size, g);
+        delete[] tmp;
+        bytesReceived += bytes;
+    }
+    else if (bw > 32) {
         if (useFile) {
             this->file.read((char *)g, 8*size);
         } else {
-            recv(recvsocket, (char *)g, 8*size, MSG_WAITALL);
+            always_assert(recv(recvsocket, (char *)g, 8*size, MSG_WAITALL) == (ssize_t)(8*size));
         }
         bytesReceived += 8*size;
     }
@@ -284,7 +479,7 @@ void Peer::recv_batched_input(uint64_t *g, int size, int bw)
         if (useFile) {
             this->file.read((char *)tmp, 4*size);
         } else {
-            recv(recvsocket, (char *)tmp, 4*size, MSG_WAITALL);
+            always_assert(recv(recvsocket, (char *)tmp, 4*size, MSG_WAITALL) == (ssize_t)(4*size));
         }
         for (int i = 0; i < size; i++) {
             g[i] = tmp[i];
@@ -297,7 +492,7 @@ void Peer::recv_batched_input(uint64_t *g, int size, int bw)
         if (useFile) {
             this->file.read((char *)tmp, 2*size);
         } else {
-            recv(recvsocket, (char *)tmp, 2*size, MSG_WAITALL);
+            always_assert(recv(recvsocket, (char *)tmp, 2*size, MSG_WAITALL) == (ssize_t)(2*size));
         }
         for (int i = 0; i < size; i++) {
             g[i] = tmp[i];
@@ -310,7 +505,7 @@ void Peer::recv_batched_input(uint64_t *g, int size, int bw)
         if (useFile) {
             this->file.read((char *)tmp, size);
         } else {
-            recv(recvsocket, (char *)tmp, size, MSG_WAITALL);
+            always_assert(recv(recvsocket, (char *)tmp, size, MSG_WAITALL) == (ssize_t)size);
         }
         for (int i = 0; i < size; i++) {
             g[i] = tmp[i];
@@ -321,13 +516,9 @@ void Peer::recv_batched_input(uint64_t *g, int size, int bw)
 }
 
 void Peer::send_mult_key(const MultKey &k) {
-    char *buf = (char *)(&k);
-    if (useFile) {
-        this->file.write(buf, sizeof(MultKey));
-    } else {
-        send(sendsocket, buf, sizeof(MultKey), 0);
-    }
-    bytesSent += sizeof(MultKey);
+    send_share(k.a, 64);
+    send_share(k.b, 64);
+    send_share(k.c, 64);
 }
 
 void Peer::send_matmul_key(const MatMulKey &k) {
@@ -341,9 +532,11 @@ void Peer::send_matmul_key(const MatMulKey &k) {
         }
     }
 
-    for(int i = 0; i < s2; i++) {
-        for(int j = 0; j < s3; j++) {
-            send_ge(Arr2DIdx(k.b, s2, s3, i, j), k.Bin);
+    if (k.b != nullptr) {
+        for(int i = 0; i < s2; i++) {
+            for(int j = 0; j < s3; j++) {
+                send_ge(Arr2DIdx(k.b, s2, s3, i, j), k.Bin);
+            }
         }
     }
 
@@ -385,11 +578,13 @@ void Peer::send_conv2d_key(const Conv2DKey &k) {
         }
     }
 
-    for(int fh = 0; fh < FH; ++fh) {
-        for(int fw = 0; fw < FW; ++fw) {
-            for(int ci = 0; ci < CI; ++ci) {
-                for(int co = 0; co < CO; ++co) {
-                    send_ge(Arr4DIdx(k.b, FH, FW, CI, CO, fh, fw, ci, co), k.Bin);
+    if (k.b != nullptr) {
+        for(int fh = 0; fh < FH; ++fh) {
+            for(int fw = 0; fw < FW; ++fw) {
+                for(int ci = 0; ci < CI; ++ci) {
+                    for(int co = 0; co < CO; ++co) {
+                        send_ge(Arr4DIdx(k.b, FH, FW, CI, CO, fh, fw, ci, co), k.Bin);
+                    }
                 }
             }
         }
@@ -463,7 +658,7 @@ void Peer::send_dcf_keypack(const DCFKeyPack &kp) {
 void Peer::send_ddcf_keypack(const DualDCFKeyPack &kp) {
     send_dcf_keypack(kp.dcfKey);
     for (int i = 0; i < kp.groupSize; ++i) {
-        send_ge(kp.sb[i], kp.Bout);
+        send_share(kp.sb[i], kp.Bout);
     }
 }
 
@@ -490,17 +685,17 @@ void Peer::send_relu_key(const ReluKeyPack &kp) {
     for(int i = 0; i < Bin * groupSize; ++i) {
         send_ge(kp.v[i], kp.Bout);
     }
-    send_ge(kp.e_b0, kp.Bout);
-    send_ge(kp.e_b1, kp.Bout);
-    send_ge(kp.beta_b0, kp.Bout);
-    send_ge(kp.beta_b1, kp.Bout);
-    send_ge(kp.r_b, kp.Bout);
-    send_ge(kp.drelu, 1);
+    send_share(kp.e_b0, kp.Bout);
+    send_share(kp.e_b1, kp.Bout);
+    send_share(kp.beta_b0, kp.Bout);
+    send_share(kp.beta_b1, kp.Bout);
+    send_share(kp.r_b, kp.Bout);
+    send_share(kp.drelu, 1);
 }
 
 void Peer::send_maxpool_key(const MaxpoolKeyPack &kp) {
     send_relu_key(kp.reluKey);
-    send_ge(kp.rb, kp.Bout);
+    send_share(kp.rb, kp.Bout);
 }
 
 void Peer::send_maxpool_double_key(const MaxpoolDoubleKeyPack &kp) {
@@ -510,7 +705,7 @@ void Peer::send_maxpool_double_key(const MaxpoolDoubleKeyPack &kp) {
 
 void Peer::send_scmp_keypack(const ScmpKeyPack &kp) {
     send_ddcf_keypack(kp.dualDcfKey);
-    send_ge(kp.rb, kp.Bout);
+    send_share(kp.rb, kp.Bout);
 }
 
 void Peer::send_pubdiv_key(const PublicDivKeyPack &kp) {
@@ -525,7 +720,7 @@ void Peer::send_ars_key(const ARSKeyPack &kp) {
     if (kp.Bout > kp.Bin - kp.shift) {
         send_ddcf_keypack(kp.dualDcfKey);
     }
-    send_ge(kp.rb, kp.Bout);
+    send_share(kp.rb, kp.Bout);
 }
 
 void Peer::send_spline_key(const SplineKeyPack &kp)
@@ -624,10 +819,10 @@ void Peer::send_taylor_key(const TaylorKeyPack &kp, int bl, int m) {
 
 void Peer::send_bitwise_and_key(const BitwiseAndKeyPack &kp)
 {
-    send_ge(kp.t[0], 64);
-    send_ge(kp.t[1], 64);
-    send_ge(kp.t[2], 64);
-    send_ge(kp.t[3], 64);
+    send_share(kp.t[0], 64);
+    send_share(kp.t[1], 64);
+    send_share(kp.t[2], 64);
+    send_share(kp.t[3], 64);
 }
 
 void Peer::send_mic_key(const MICKeyPack &kp, int bin, int bout, int m)
@@ -705,7 +900,7 @@ GroupElement Peer::recv_input() {
         std::cerr << "Can't recv from peer in file mode\n";
         exit(1);
     } else {
-        recv(recvsocket, buf, 8, MSG_WAITALL);
+        always_assert(recv(recvsocket, buf, 8, MSG_WAITALL) == 8);
     }
     GroupElement g =*(uint64_t *)buf;
     bytesReceived += 8;
@@ -714,7 +909,7 @@ GroupElement Peer::recv_input() {
 
 void Peer::send_uint8_array(const uint8_t *data, int size)
 {
-    always_assert(size == send(sendsocket, data, size, 0));
+    send_bytes(data, size);
     bytesSent += size;
 }
 
@@ -725,25 +920,38 @@ void Peer::recv_uint8_array(uint8_t *data, int size)
 }
 
 Dealer::Dealer(std::string ip, int port) {
-    this->consocket = socket(AF_INET, SOCK_STREAM, 0);
-    if (consocket < 0) {
-        perror("socket");
-        exit(1);
-    }
     struct sockaddr_in addr;
     addr.sin_family = AF_INET;
     addr.sin_port = htons(port);
     addr.sin_addr.s_addr = inet_addr(ip.c_str());
-    if (connect(consocket, (struct sockaddr *) &addr, sizeof(addr)) < 0) {
-        perror("connect");
-        exit(1);
+    // the dealer may not be listening yet
+    while (1) {
+        this->consocket = socket(AF_INET, SOCK_STREAM, 0);
+        if (consocket < 0) {
+            perror("socket");
+            exit(1);
+        }
+        if (connect(consocket, (struct sockaddr *) &addr, sizeof(addr)) == 0) {
+            break;
+        }
+        ::close(consocket);
+        usleep(1000);
     }
+    // keys are read through file, as from a key file
+    this->useFile = true;
+    this->ramdisk = false;
+    this->keyStream = new KeyStreamBuf(consocket);
+    this->file.rdbuf(keyStream);
 }
 
 void Dealer::close() {
-    if (useFile) {
+    if (keyStream != nullptr) {
+        delete keyStream;
+        keyStream = nullptr;
+    }
+    else if (useFile) {
         if (!ramdisk && ramdisk_path) {
-            file.close();
+            fileBuf.close();
         }
         else {
             // std::cout << (int)(ramdiskBuffer - ramdiskStart) << "bytes read" << "\n";
@@ -755,6 +963,25 @@ void Dealer::close() {
     }
 }
 
+uint64_t Dealer::keyOffset() {
+    always_assert(keyStream == nullptr);
+    if (ramdisk && ramdisk_path) {
+        return ramdiskBuffer - ramdiskStart;
+    }
+    return (uint64_t) file.tellg();
+}
+
+void Dealer::seekKeys(uint64_t offset) {
+    always_assert(keyStream == nullptr);
+    if (ramdisk && ramdisk_path) {
+        always_assert(offset <= (uint64_t) ramdiskSize);
+        ramdiskBuffer = ramdiskStart + offset;
+        return;
+    }
+    file.seekg(offset);
+    always_assert(file.good());
+}
+
 GroupElement Dealer::recv_mask() {
     char buf[8];
     if (useFile) {
@@ -776,22 +1003,12 @@ GroupElement Dealer::recv_mask() {
 }
 
 MultKey Dealer::recv_mult_key() {
-    char buf[sizeof(MultKey)];
-    if (useFile) {
-        if (ramdisk && ramdisk_path) {
-            MultKey k=(*(MultKey *)ramdiskBuffer);
-            ramdiskBuffer += sizeof(MultKey);
-            bytesReceived += sizeof(MultKey);
-            return k;
-        }
-        this->file.read(buf, sizeof(MultKey));
-        //std::cout<< "dealer recv mult key" << "\n";
-    } else {
-        //recv(consocket, buf, sizeof(MultKey), MSG_WAITALL);
-        std::cout << "dealer recv mask" << "\n";
-    }
-    MultKey k(*(MultKey *)buf);
-    bytesReceived += sizeof(MultKey);
+    MultKey k;
+    k.Bin = 64;
+    k.Bout = 64;
+    k.a = recv_share(64);
+    k.b = recv_share(64);
+    k.c = recv_share(64);
     return k;
 }
 
@@ -904,6 +1121,14 @@ GroupElement Dealer::recv_ge(int bl) {
     }
 }
 
+GroupElement Dealer::recv_share(int bw) {
+    if (party == SERVER) {
+        GroupElement g = prngShared.get<uint64_t>();
+        mod(g, bw);
+        return g;
+    }
+    return recv_ge(bw);
+}
 
 void Dealer::recv_ge_array(const GroupElement *g, int size) {
     char *buf = (char *)g;
@@ -967,7 +1192,7 @@ DualDCFKeyPack Dealer::recv_ddcf_keypack(int Bin, int Bout, int groupSize) {
     kp.dcfKey = recv_dcf_keypack(Bin, Bout, groupSize);
     kp.sb = new GroupElement[groupSize];
     for (int i = 0; i < groupSize; ++i) {
-        kp.sb[i] = recv_ge(Bout);
+        kp.sb[i] = recv_share(Bout);
     }
     return kp;
 }
@@ -986,7 +1211,7 @@ MultKeyNew Dealer::recv_new_mult_key(int bw1, int bw2)
     return kp;
 }
 
-MatMulKey Dealer::recv_matmul_key(int Bin, int Bout, int s1, int s2, int s3) {
+MatMulKey Dealer::recv_matmul_key(int Bin, int Bout, int s1, int s2, int s3, bool serverWeights) {
     MatMulKey k;
     k.Bin = Bin;
     k.Bout = Bout;
@@ -995,7 +1220,7 @@ MatMulKey Dealer::recv_matmul_key(int Bin, int Bout, int s1, int s2, int s3) {
     k.s3 = s3;
 
     k.a = make_array<GroupElement>(s1, s2);
-    k.b = make_array<GroupElement>(s2, s3);
+    k.b = serverWeights ? nullptr : make_array<GroupElement>(s2, s3);
     k.c = make_array<GroupElement>(s1, s3);
 
     for(int i = 0; i < s1; ++i) {
@@ -1005,7 +1230,7 @@ MatMulKey Dealer::recv_matmul_key(int Bin, int Bout, int s1, int s2, int s3) {
         }
     }
     
-    for(int i = 0; i < s2; ++i) {
+    for(int i = 0; i < s2 && !serverWeights; ++i) {
         for(int j = 0; j < s3; ++j) {
             Arr2DIdx(k.b, s2, s3, i, j) = (party == SERVER ? GroupElement(prngShared.get<uint64_t>()) : recv_ge(Bin));
             mod(Arr2DIdx(k.b, s2, s3, i, j), Bin);
@@ -1027,7 +1252,7 @@ Conv2DKey Dealer::recv_conv2d_key(int Bin, int Bout, int64_t N, int64_t H, int64
                 int64_t CO, int64_t zPadHLeft,
                 int64_t zPadHRight, int64_t zPadWLeft,
                 int64_t zPadWRight, int64_t strideH,
-                int64_t strideW) {
+                int64_t strideW, bool serverWeights) {
     Conv2DKey k;
     k.Bin = Bin;
     k.Bout = Bout;
@@ -1051,7 +1276,7 @@ Conv2DKey Dealer::recv_conv2d_key(int Bin, int Bout, int64_t N, int64_t H, int64
     int d3 = CO;
 
     k.a = make_array<GroupElement>(N, H, W, CI);
-    k.b = make_array<GroupElement>(FH, FW, CI, CO);
+    k.b = serverWeights ? nullptr : make_array<GroupElement>(FH, FW, CI, CO);
     k.c = make_array<GroupElement>(d0, d1, d2, d3);
 
     for(int n = 0; n < N; ++n) {
@@ -1065,7 +1290,7 @@ Conv2DKey Dealer::recv_conv2d_key(int Bin, int Bout, int64_t N, int64_t H, int64
         }
     }
 
-    for(int fh = 0; fh < FH; ++fh) {
+    for(int fh = 0; fh < FH && !serverWeights; ++fh) {
         for(int fw = 0; fw < FW; ++fw) {
             for(int ci = 0; ci < CI; ++ci) {
                 for(int co = 0; co < CO; ++co) {
@@ -1174,12 +1399,12 @@ ReluKeyPack Dealer::recv_relu_key(int Bin, int Bout) {
             kp.v[i] = recv_ge(Bout);
         }
     }
-    kp.e_b0 = recv_ge(Bout);
-    kp.e_b1 = recv_ge(Bout);
-    kp.beta_b0 = recv_ge(Bout);
-    kp.beta_b1 = recv_ge(Bout);
-    kp.r_b = recv_ge(Bout);
-    kp.drelu = recv_ge(1);
+    kp.e_b0 = recv_share(Bout);
+    kp.e_b1 = recv_share(Bout);
+    kp.beta_b0 = recv_share(Bout);
+    kp.beta_b1 = recv_share(Bout);
+    kp.r_b = recv_share(Bout);
+    kp.drelu = recv_share(1);
     return kp;
 }
 
@@ -1188,7 +1413,7 @@ MaxpoolKeyPack Dealer::recv_maxpool_key(int Bin, int Bout) {
     kp.Bin = Bin; 
     kp.Bout = Bout;
     kp.reluKey = recv_relu_key(Bin, Bout);
-    kp.rb = recv_ge(Bout);
+    kp.rb = recv_share(Bout);
     return kp;
 }
 
@@ -1207,7 +1432,7 @@ ScmpKeyPack Dealer::recv_scmp_keypack(int Bin, int Bout) {
     kp.Bin = Bin;
     kp.Bout = Bout;
     kp.dualDcfKey = recv_ddcf_keypack(Bin-1, Bout, groupSize);
-    kp.rb = recv_ge(Bout);
+    kp.rb = recv_share(Bout);
     return kp;
 }
 
@@ -1234,14 +1459,14 @@ ARSKeyPack Dealer::recv_ars_key(int Bin, int Bout, int shift) {
     if (Bout > Bin - shift) {
         kp.dualDcfKey = recv_ddcf_keypack(Bin - 1, Bout, ddcfGroupSize);
     }
-    kp.rb = recv_ge(Bout);
+    kp.rb = recv_share(Bout);
     return kp;
 }
 
 void Peer::sync() {
     char buf[1] = {1};
-    send(sendsocket, buf, 1, 0);
-    recv(recvsocket, buf, 1, MSG_WAITALL);
+    send_bytes(buf, 1);
+    always_assert(recv(recvsocket, buf, 1, MSG_WAITALL) == 1);
     bytesReceived += 1;
     bytesSent += 1;
     always_assert(buf[0] == 1);
@@ -1421,10 +1646,10 @@ TaylorKeyPack Dealer::recv_taylor_key(int bl, int m, int sf) {
 BitwiseAndKeyPack Dealer::recv_bitwise_and_key()
 {
     BitwiseAndKeyPack kp;
-    kp.t[0] = recv_ge(64);
-    kp.t[1] = recv_ge(64);
-    kp.t[2] = recv_ge(64);
-    kp.t[3] = recv_ge(64);
+    kp.t[0] = recv_share(64);
+    kp.t[1] = recv_share(64);
+    kp.t[2] = recv_share(64);
+    kp.t[3] = recv_share(64);
     return kp;
 }
 
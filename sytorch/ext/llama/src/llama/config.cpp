@@ -12,4 +12,7 @@ namespace LlamaConfig {
     bool stochasticRT = false;
     bool stochasticT  = false;
     bool ramdisk_path = false;
+    bool serverKnownWeights = false;
+    bool streamKeys = false;
+    std::string dealerIp = "127.0.0.1";
 }
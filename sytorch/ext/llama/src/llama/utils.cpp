@@ -22,8 +22,10 @@ SOFTWARE.
 #include <llama/utils.h>
 #include <llama/array.h>
 #include <llama/comms.h>
+#include <llama/assert.h>
 #include <assert.h>
 #include <iostream>
+#include <utils/ring_gemm.h>
 #include <Eigen/Dense>
 #include <math.h>
 #include <chrono>
@@ -81,7 +83,11 @@ void MatSub5(int s0, int s1, int s2, int s3, int s4, GroupElement* A, GroupEleme
 void MatMul(int s1, int s2, int s3, eigenMatrix &A, eigenMatrix &B, eigenMatrix &C)
 {
     auto start = std::chrono::high_resolution_clock::now();
-    C = A * B;
+    // column-major C = A * B is row-major C^T = B^T * A^T
+    C.resize(s1, s3);
+    ring_gemm::Strided<uint64_t> bt{B.data(), (size_t)s2, 1};
+    ring_gemm::Strided<uint64_t> at{A.data(), (size_t)s1, 1};
+    ring_gemm::gemmSources<uint64_t>(s3, s1, s2, bt, at, C.data(), s1);
     auto end = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
     eigenMicroseconds += duration.count();
@@ -91,10 +97,7 @@ void MatMul(int s1, int s2, int s3, eigenMatrix &A, eigenMatrix &B, eigenMatrix
 void matmul_cleartext_eigen_llama(int dim1, int dim2, int dim3, GroupElement *inA,
                             GroupElement *inB, GroupElement *outC) {
   auto start = std::chrono::high_resolution_clock::now();
-  Eigen::Map<Eigen::Matrix<uint64_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> eA(inA, dim1, dim2);
-  Eigen::Map<Eigen::Matrix<uint64_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> eB(inB, dim2, dim3);
-  Eigen::Map<Eigen::Matrix<uint64_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> eC(outC, dim1, dim3);
-  eC = eA * eB;
+  ring_gemm::matmul<uint64_t>(dim1, dim3, dim2, inA, inB, outC);
   auto end = std::chrono::high_resolution_clock::now();
   auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
   eigenMicroseconds += duration.count();
@@ -225,52 +228,32 @@ void Conv2DPlaintext(int N, int H, int W, int CI,
 				   GroupElement * filterArr, 
 				   GroupElement * outArr)
 {
-    size_t reshapedFilterRows = CO;
-	size_t reshapedFilterCols = FH*FW*CI;
-	size_t reshapedIPRows = FH*FW*CI;
 	size_t newH = (((H + (zPadHLeft+zPadHRight) - FH)/strideH) + 1);
 	size_t newW = (((W + (zPadWLeft+zPadWRight) - FW)/strideW) + 1);
-	size_t reshapedIPCols = N * newH * newW;
-
-    GroupElement *filterReshaped = filterArr;
-	GroupElement *inputReshaped = make_array<GroupElement>(reshapedIPRows, reshapedIPCols);
-	GroupElement *matmulOP = make_array<GroupElement>(reshapedFilterRows, reshapedIPCols);
-    
-    Conv2DReshapeInput(N, H, W, CI, FH, FW, zPadHLeft, zPadHRight, zPadWLeft, zPadWRight, strideH, strideW, reshapedIPRows, reshapedIPCols, inputArr, inputReshaped);
-    // Conv2DReshapeFilter(FH, FW, CI, CO, filterArr, filterReshaped);
-    MatMul(reshapedFilterRows, reshapedFilterCols, reshapedIPCols, filterReshaped, inputReshaped, matmulOP);
-    Conv2DReshapeOutput(N, newH, newW, CO, matmulOP, outArr);
-
-    // delete[] filterReshaped;
-    delete[] inputReshaped;
-    delete[] matmulOP;
 
+    // filterArr is already CO x (FH*FW*CI); the input patches are gathered
+    // while packing, so there is no reshaped input or output to allocate
+    auto start = std::chrono::high_resolution_clock::now();
+    ring_gemm::conv2d<uint64_t>(N, H, W, CI, FH, FW, CO, zPadHLeft, zPadWLeft, strideH, strideW,
+        newH, newW, inputArr, filterArr, outArr);
+    auto end = std::chrono::high_resolution_clock::now();
+    eigenMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
 }
 
 Conv2DCache allocateConv2DCache(int N, int H, int W, int CI, 
                                 int FH, int FW, int CO, 
                                 int zPadHLeft, int zPadHRight, int zPadWLeft, int zPadWRight, 
                                 int strideH, int strideW) {
-    int reshapedFilterRows = CO;
-	int reshapedFilterCols = FH*FW*CI;
-	int reshapedIPRows = reshapedFilterCols;
 	int newH = (((H + (zPadHLeft+zPadHRight) - FH)/strideH) + 1);
 	int newW = (((W + (zPadWLeft+zPadWRight) - FW)/strideW) + 1);
-	int reshapedIPCols = newH * newW;
 
     Conv2DCache cache;
-    cache.reshapedFilter = eigenMatrix(reshapedFilterRows, reshapedFilterCols);
-	cache.reshapedInput = eigenMatrix(reshapedIPRows, reshapedIPCols);
-	cache.matmulResult = eigenMatrix(reshapedFilterRows, reshapedIPCols);
     cache.temp = make_array<GroupElement>(N, newH, newW, CO);
 
     return cache;
 }
 
 void freeConv2DCache(const Conv2DCache &cache) {
-    // cache.reshapedFilter.resize(0, 0);
-    // cache.reshapedInput.resize(0, 0);
-    // cache.matmulResult.resize(0, 0);
     delete[] cache.temp;
 }
 
@@ -283,19 +266,8 @@ void Conv2DPlaintext(int N, int H, int W, int CI,
 				   GroupElement * outArr,
                    Conv2DCache &cache)
 {
-    int reshapedFilterRows = CO;
-	int reshapedFilterCols = FH*FW*CI;
-	int reshapedIPRows = FH*FW*CI;
-	int newH = (((H + (zPadHLeft+zPadHRight) - FH)/strideH) + 1);
-	int newW = (((W + (zPadWLeft+zPadWRight) - FW)/strideW) + 1);
-	int reshapedIPCols = newH * newW;
-
-    Conv2DReshapeFilter(FH, FW, CI, CO, filterArr, cache.reshapedFilter);
-    for(int i = 0; i < N; ++i) {
-        Conv2DReshapeInputPartial(N, H, W, CI, FH, FW, zPadHLeft, zPadHRight, zPadWLeft, zPadWRight, strideH, strideW, reshapedIPRows, reshapedIPCols, inputArr, cache.reshapedInput, i);
-        MatMul(reshapedFilterRows, reshapedFilterCols, reshapedIPCols, cache.reshapedFilter, cache.reshapedInput, cache.matmulResult);
-        Conv2DReshapeOutputPartial(N, newH, newW, CO, cache.matmulResult, outArr, i);
-    }
+    Conv2DPlaintext(N, H, W, CI, FH, FW, CO, zPadHLeft, zPadHRight, zPadWLeft, zPadWRight,
+        strideH, strideW, inputArr, filterArr, outArr);
 }
 
 void VecCopy(int s, GroupElement *input, GroupElement *output)
@@ -316,19 +288,20 @@ void MatCopy5(int s1, int s2, int s3, int s4, int s5, GroupElement *input, Group
 void matmul_eval_helper(int party, int dim1, int dim2, int dim3, GroupElement *A,
                             GroupElement *B, GroupElement *C, GroupElement *ka, GroupElement *kb, GroupElement *kc) {
     auto start = std::chrono::high_resolution_clock::now();
-    Eigen::Map<Eigen::Matrix<uint64_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> eigen_A(A, dim1, dim2);
-    Eigen::Map<Eigen::Matrix<uint64_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> eigen_ka(ka, dim1, dim2);
-    Eigen::Map<Eigen::Matrix<uint64_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> eigen_B(B, dim2, dim3);
-    Eigen::Map<Eigen::Matrix<uint64_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> eigen_kb(kb, dim2, dim3);
-    Eigen::Map<Eigen::Matrix<uint64_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> eigen_C(C, dim1, dim3);
-    Eigen::Map<Eigen::Matrix<uint64_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> eigen_kc(kc, dim1, dim3);
-
+    // server: C = (A - ka) * B - A * kb + kc
+    // client: C = kc - ka * B - A * kb
+    const GroupElement minusOne = -1;
+    MatCopy4(dim1, dim3, 1, 1, kc, C);
     if (party == SERVER) {
-        eigen_C = (eigen_A - eigen_ka) * eigen_B - eigen_A * eigen_kb + eigen_kc;
+        GroupElement *tmp = make_array<GroupElement>(dim1, dim2);
+        MatSub(dim1, dim2, A, ka, tmp);
+        ring_gemm::matmul<uint64_t>(dim1, dim3, dim2, tmp, B, C, false, false, true);
+        delete[] tmp;
     }
     else {
-        eigen_C = eigen_kc - eigen_ka * eigen_B - eigen_A * eigen_kb;
+        ring_gemm::matmul<uint64_t>(dim1, dim3, dim2, ka, B, C, false, false, true, minusOne);
     }
+    ring_gemm::matmul<uint64_t>(dim1, dim3, dim2, A, kb, C, false, false, true, minusOne);
 
     auto end = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
@@ -345,6 +318,67 @@ void packBitArray(GroupElement *A, int size, uint8_t *out) {
     }
 }
 
+void unpackBitArray(const uint8_t *A, int size, GroupElement *out) {
+    for (int i = 0; i < size; i++) {
+        out[i] = (A[i / 8] >> (i % 8)) & 1;
+    }
+}
+
+void packFixedWidth(const GroupElement *A, int size, int bw, uint8_t *out) {
+    always_assert(bw >= 1 && bw <= 64);
+    const uint64_t mask = (bw == 64) ? -1 : ((uint64_t(1) << bw) - 1);
+    // acc holds the pending bits, fewer than 8 between values
+    uint64_t acc = 0;
+    int accBits = 0;
+    for (int i = 0; i < size; i++) {
+        uint64_t v = A[i] & mask;
+        acc |= v << accBits;
+        int total = accBits + bw;
+        if (total >= 64) {
+            memcpy(out, &acc, 8);
+            out += 8;
+            acc = (accBits == 0) ? 0 : v >> (64 - accBits);
+            total -= 64;
+        }
+        while (total >= 8) {
+            *out++ = acc & 0xff;
+            acc >>= 8;
+            total -= 8;
+        }
+        accBits = total;
+    }
+    if (accBits > 0) {
+        *out = acc & 0xff;
+    }
+}
+
+void unpackFixedWidth(const uint8_t *A, int size, int bw, GroupElement *out) {
+    always_assert(bw >= 1 && bw <= 64);
+    const uint64_t mask = (bw == 64) ? -1 : ((uint64_t(1) << bw) - 1);
+    // acc holds accBits bits read ahead, never more than the values need
+    uint64_t acc = 0;
+    int accBits = 0;
+    for (int i = 0; i < size; i++) {
+        while (accBits < bw && accBits <= 56) {
+            acc |= uint64_t(*A++) << accBits;
+            accBits += 8;
+        }
+        if (accBits >= bw) {
+            out[i] = acc & mask;
+            acc = (bw == 64) ? 0 : acc >> bw;
+            accBits -= bw;
+        }
+        else {
+            // more than 56 bits wide: the rest comes from the next byte
+            uint64_t next = *A++;
+            int used = bw - accBits;
+            out[i] = (acc | (next << accBits)) & mask;
+            acc = next >> used;
+            accBits = 8 - used;
+        }
+    }
+}
+
 
 
 // 3d
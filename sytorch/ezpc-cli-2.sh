@@ -5,6 +5,8 @@ BACKEND="LLAMA"
 SCALE="15"
 BITLENGTH="40"
 NUMTHREADS="4"
+BATCH="1"
+COLLECT_TIMEOUT="10"
 
 # Parse command-line arguments
 while [[ $# -gt 0 ]]
@@ -51,6 +53,16 @@ do
             shift # past argument
             shift # past value
             ;;
+        -batch|--batch)
+            BATCH="$2"
+            shift # past argument
+            shift # past value
+            ;;
+        -timeout|--timeout)
+            COLLECT_TIMEOUT="$2"
+            shift # past argument
+            shift # past value
+            ;;
         -preprocess|--preprocess)
             PREPROCESS="$2"
             shift # past argument
@@ -74,7 +86,7 @@ then
     echo "server IP"
     echo "-------------------       --------------" | column -t -s $'\t'
     echo "Usage: $0 -m <full-path/model.onnx> -preprocess <full-path/preprocess_image_file> -s <server-ip>  -d <dealer-ip>"
-    echo "Optional: [-b <backend>] [-scale <scale>] [-bl <bitlength>] [-nt <numthreads>]"
+    echo "Optional: [-b <backend>] [-scale <scale>] [-bl <bitlength>] [-nt <numthreads>] [-batch <queries per inference>] [-timeout <seconds to collect a batch>]"
     exit 1
 fi
 
@@ -84,6 +96,8 @@ echo "SERVER Details:"
 echo "Model path: $MODEL_PATH"
 echo "Preprocess path: $PREPROCESS"
 echo "Server IP: $SERVER_IP"
+echo "Queries per inference: $BATCH"
+echo "Batch collection timeout: $COLLECT_TIMEOUT s"
 echo ------------------------------
 echo "CLIENT Details:"
 echo "Image path: $IMAGE_PATH"
@@ -101,6 +115,10 @@ Model_Name=${File_NAME%.*}
 # Get preprocess file name
 preprocess_image_file=$(basename $PREPROCESS)
 
+# Client queries batched into one inference; the keys depend on it, so the
+# server, dealer and client scripts export the same value
+BATCH_ENV="export EZPC_BATCH=$BATCH"
+
 # Generating Server Script
 SERVER_SCRIPT="server.sh"
 echo "Generating Server Script for $Model_Name:"
@@ -117,6 +135,8 @@ bg_magenta='\033[0;45m'
 bg_cyan='\033[0;46m'
 clear='\033[0m'
 
+$BATCH_ENV
+
 if [ "\$1" = "clean" ]; then
   shopt -s extglob
   echo -e "\${bg_yellow}Cleaning up\${clear}"
@@ -203,6 +223,8 @@ bg_magenta='\033[0;45m'
 bg_cyan='\033[0;46m'
 clear='\033[0m'
 
+$BATCH_ENV
+
 if [ "\$1" = "clean" ]; then
   shopt -s extglob
   echo -e "\${bg_yellow}Cleaning up\${clear}"
@@ -290,6 +312,7 @@ echo "Finished generating Dealer Script"
 # Generating Client Script
 CLIENT_OFFLINE_SCRIPT="client-offline.sh"
 CLIENT_ONLINE_SCRIPT="client-online.sh"
+CLIENT_COLLECTOR_SCRIPT="client-collector.sh"
 echo "Generating Client Script"
 # Script accepts 1 argument: path to sytorch
 cat <<EOF > $CLIENT_OFFLINE_SCRIPT
@@ -304,11 +327,13 @@ bg_magenta='\033[0;45m'
 bg_cyan='\033[0;46m'
 clear='\033[0m'
 
+$BATCH_ENV
+
 if [ "\$1" = "clean" ]; then
   shopt -s extglob
   echo -e "\${bg_yellow}Cleaning up\${clear}"
-  find . -type f -not -name 'client-o*' -delete
-  find . -type d -not -name 'client-o*' -delete
+  find . -type f -not -name 'client-*.sh' -delete
+  find . -type d -not -name 'client-*.sh' -delete
   echo -e "\${bg_green}Cleaned up\${clear}"
   shopt -u extglob
   exit 0
@@ -389,22 +414,23 @@ bg_magenta='\033[0;45m'
 bg_cyan='\033[0;46m'
 clear='\033[0m'
 
+$BATCH_ENV
+
 if [ "\$1" = "clean" ]; then
   shopt -s extglob
   echo -e "\${bg_yellow}Cleaning up\${clear}"
-  find . -type f -not -name 'client-o*' -delete
-  find . -type d -not -name 'client-o*' -delete
+  find . -type f -not -name 'client-*.sh' -delete
+  find . -type d -not -name 'client-*.sh' -delete
   echo -e "\${bg_green}Cleaned up\${clear}"
   shopt -u extglob
   exit 0
 fi
 
-# if Image is not provided
-if [ -z "\$1" ]; then
-    echo "Error: Image not provided."
+# if Images are not provided
+if [ "\$#" -ne $BATCH ]; then
+    echo "Error: expected $BATCH image(s), one per query of the batch."
     exit 1
 fi
-IMAGE_PATH=\$1
 
 current_dir=\$(pwd)
 sytorch="\$current_dir/EzPC/sytorch"
@@ -420,27 +446,77 @@ python \$sytorch/scripts/download_keys.py \$Dealer_url client client client.dat
 wait
 echo -e "\${bg_green}Downloaded Dealer Keys File\${clear}"
 
-# Copy the input image
-cp \$IMAGE_PATH .
-# get input file name
-File_NAME=\$(basename \$IMAGE_PATH)
-Image_Name=\${File_NAME%.*}
-
-# Prepare the input
+# Prepare the inputs, queries are read by the model one after the other
 echo -e "\${bg_green}Preparing the input\${clear}"
-python $preprocess_image_file \$File_NAME
-wait
-python \$onnxbridge/helper/convert_np_to_float_inp.py --inp \$Image_Name.npy --out \$Image_Name.inp
-
+Image_Names=()
+rm -f input.inp
+for IMAGE_PATH in "\$@"; do
+    # Copy the input image
+    cp \$IMAGE_PATH .
+    # get input file name
+    File_NAME=\$(basename \$IMAGE_PATH)
+    Image_Name=\${File_NAME%.*}
+    Image_Names+=("\$Image_Name")
+
+    python $preprocess_image_file \$File_NAME
+    wait
+    python \$onnxbridge/helper/convert_np_to_float_inp.py --inp \$Image_Name.npy --out \$Image_Name.inp
+    cat \$Image_Name.inp >> input.inp
+    echo >> input.inp
+done
 
 # Run the model
 echo -e "\${bg_green}Running the model\${clear}"
-./${Model_Name}_${BACKEND}_${SCALE} 3 $SERVER_IP ${NUMTHREADS} < \$Image_Name.inp > output.txt
+./${Model_Name}_${BACKEND}_${SCALE} 3 $SERVER_IP ${NUMTHREADS} < input.inp > output.txt
 
-# Print the output
+# Print the output, split back per query when batched
 echo -e "\${bg_green}Printing the output\${clear}"
-cat output.txt
+if [ $BATCH -gt 1 ]; then
+    awk '/^# query /{ f = "output_" \$3 ".txt"; next } { print > f }' output.txt
+    for i in "\${!Image_Names[@]}"; do
+        mv output_\$i.txt \${Image_Names[\$i]}_output.txt
+        echo -e "\${bg_green}\${Image_Names[\$i]}\${clear}"
+        cat \${Image_Names[\$i]}_output.txt
+    done
+else
+    cat output.txt
+fi
 echo -e "\${bg_green}Finished\${clear}"
 
+EOF
+cat <<EOF > $CLIENT_COLLECTOR_SCRIPT
+#!/bin/bash
+
+# Color variables
+bg_red='\033[0;41m'
+bg_green='\033[0;42m'
+bg_yellow='\033[0;43m'
+bg_blue='\033[0;44m'
+bg_magenta='\033[0;45m'
+bg_cyan='\033[0;46m'
+clear='\033[0m'
+
+$BATCH_ENV
+
+if [ "\$1" = "clean" ]; then
+  shopt -s extglob
+  echo -e "\${bg_yellow}Cleaning up\${clear}"
+  find . -type f -not -name 'client-*.sh' -delete
+  find . -type d -not -name 'client-*.sh' -delete
+  echo -e "\${bg_green}Cleaned up\${clear}"
+  shopt -u extglob
+  exit 0
+fi
+
+current_dir=\$(pwd)
+sytorch="\$current_dir/EzPC/sytorch"
+
+# Gather queries from several clients into one inference: each client sends
+#   curl --data-binary @<image> "http://<this machine>:5000/inference?name=<image>"
+# and gets its own output back. A batch runs once $BATCH queries are waiting or
+# $COLLECT_TIMEOUT seconds after its first query, padded to $BATCH queries.
+echo -e "\${bg_green}Collecting queries in batches of $BATCH\${clear}"
+python \$sytorch/scripts/collector.py $BATCH $COLLECT_TIMEOUT 5000
+
 EOF
 echo "Finished generating Client Script"
\ No newline at end of file
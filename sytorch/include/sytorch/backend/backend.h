@@ -30,6 +30,14 @@ public:
     virtual void truncateForward(const Tensor<T> &in, u64 shift, u8 mode = 0) {
         truncate(in.data, in.data, shift, in.size(), mode);
     }
+
+    // Forward truncations of independent layers (see SytorchModule's graph
+    // executor), which a backend may evaluate in one go
+    virtual void truncateForwardBatch(const std::vector<Tensor<T> *> &in, u64 shift, u8 mode = 0) {
+        for (auto &t : in) {
+            truncateForward(*t, shift, mode);
+        }
+    }
     
     void truncate(const Tensor2D<T> &in, u64 shift, u8 mode = 0) {
         truncate(in.data, in.data, shift, in.d1 * in.d2, mode);
@@ -54,6 +62,11 @@ public:
 
     // relu API
     virtual void relu(const Tensor<T> &in, const Tensor<T> &out, const Tensor<T> &drelu, u64 scale, int mode) NOT_IMPLEMENTED;
+    virtual void reluBatch(const std::vector<Tensor<T> *> &in, const std::vector<Tensor<T> *> &out, const std::vector<Tensor<T> *> &drelu, u64 scale, int mode) {
+        for (size_t i = 0; i < in.size(); ++i) {
+            relu(*in[i], *out[i], *drelu[i], scale, mode);
+        }
+    }
 
     // leakyrelu API
     virtual void leakyRelu(const Tensor<T> &in, const Tensor<T> &out, const Tensor<T> &drelu, u64 scale, int mode, T alpha) NOT_IMPLEMENTED;
@@ -63,7 +76,7 @@ public:
     virtual void sumPool2D(u64 ks, u64 padding, u64 stride, const Tensor4D<T> &in, Tensor4D<T> &out) NOT_IMPLEMENTED;
     virtual void avgPool2D(u64 ks, u64 padding, u64 stride, const Tensor4D<T> &in, Tensor4D<T> &out, u64 scale) NOT_IMPLEMENTED;
     
-    // maxpool API
+    // maxpool API; maxIdx is empty when no backward pass needs the argmax
     virtual void maxPool2D(u64 ks, u64 padding, u64 stride, const Tensor4D<T> &in, Tensor4D<T> &out, Tensor4D<u64> &maxIdx, u64 scale, u8 mode) NOT_IMPLEMENTED;
 
     virtual void batchNormInference(const Tensor1D<T> &A, const Tensor1D<T> &B, const Tensor<T> &x, Tensor<T> &y, u64 scale) NOT_IMPLEMENTED;
@@ -78,6 +91,26 @@ public:
     virtual void addbias(Tensor<T> &x, const Tensor1D<T> &bias) NOT_IMPLEMENTED;
     virtual void scalarmul(Tensor<T> &x, T scalar, Tensor<T> &y) NOT_IMPLEMENTED;
 
+    // Whether independent layers may run on separate threads. Backends that
+    // talk over a single connection and consume keys in order run them one
+    // after another
+    virtual bool concurrentLayers() { return false; }
+
+    // Layer-boundary checkpoints, see SytorchModule::forwardGraph. Besides
+    // the activations, a run depends on state of the backend (such as the
+    // position in its keys), which it saves and restores itself.
+    virtual bool checkpoints() { return false; }
+    virtual void saveCheckpoint(std::ostream &out) NOT_IMPLEMENTED;
+    virtual void loadCheckpoint(std::istream &in) NOT_IMPLEMENTED;
+    // Identifies what that state belongs to (such as the key file); a
+    // checkpoint taken with another one is not resumed from
+    virtual u64 checkpointId() NOT_IMPLEMENTED;
+    // Returns once every party has finished the layers before the checkpoint
+    virtual void checkpointBarrier() NOT_IMPLEMENTED;
+    // Given the waves of the (at most two) checkpoints this party holds, the
+    // latest one that every party holds, or 0 if there is none
+    virtual u64 agreeCheckpoint(const std::vector<u64> &waves) NOT_IMPLEMENTED;
+
     virtual void optimize(LayerGraphNode<T> *root)
     {
         
@@ -90,4 +90,6 @@ public:
     void layernorm(const Tensor1D<T> &A, const Tensor1D<T> &B, const Tensor<T> &x, Tensor<T> &y, u64 scale);
     void addbias(Tensor<T> &x, const Tensor1D<T> &bias);
     void scalarmul(Tensor<T> &x, T scalar, Tensor<T> &y);
+
+    bool concurrentLayers() { return true; }
 };
@@ -5,8 +5,12 @@
 #include <llama/input_prng.h>
 #include <llama/comms.h>
 #include <llama/api.h>
+#include <llama/prng.h>
+#include <llama/stats.h>
 #include "backend.h"
 #include <sytorch/layers/layers.h>
+#include <algorithm>
+#include <set>
 
 template <typename T>
 class Sequential;
@@ -15,6 +19,10 @@ template <typename T>
 class LlamaBase : public Backend<T> {
 public:
     const bool useLocalTruncation = false;
+    // Conv2D/FC weights that the server keeps in the clear when
+    // LlamaConfig::serverKnownWeights is set; products with them use the
+    // server-known-weights keys
+    std::set<T *> serverWeights;
 
     void init(std::string ip, bool ramdisk = true,bool ramdisk_path=false)
     {
@@ -22,7 +30,10 @@ public:
         for(int i = 0; i < 256; ++i) {
             LlamaConfig::prngs[i].SetSeed(osuCrypto::toBlock(i, seedKey));
         }
-        if (LlamaConfig::party == 1) {
+        if (LlamaConfig::streamKeys) {
+            init_key_streams(ip);
+        }
+        else if (LlamaConfig::party == 1) {
             std::cerr<<ramdisk<<ramdisk_path<<"\n";
             if (ramdisk && ramdisk_path)
             {
@@ -65,6 +76,31 @@ public:
         input_prng_init();
     }
 
+    // The dealer runs alongside the evaluators and pushes each key as it is
+    // generated; see KeyStreamBuf
+    void init_key_streams(std::string ip)
+    {
+        if (LlamaConfig::party == 1) {
+            LlamaConfig::server = waitForKeyStream(LlamaConfig::port);
+            LlamaConfig::client = waitForKeyStream(LlamaConfig::port + 1);
+            LlamaConfig::server->keyStream->sibling = LlamaConfig::client->keyStream;
+            LlamaConfig::client->keyStream->sibling = LlamaConfig::server->keyStream;
+        }
+        else if (LlamaConfig::party == 2) {
+            LlamaConfig::dealer = new Dealer(LlamaConfig::dealerIp, LlamaConfig::port);
+            LlamaConfig::client = waitForPeer(42005);
+            LlamaConfig::peer = LlamaConfig::client;
+        }
+        else if (LlamaConfig::party == 3) {
+            LlamaConfig::dealer = new Dealer(LlamaConfig::dealerIp, LlamaConfig::port + 1);
+            LlamaConfig::server = new Peer(ip, 42005);
+            LlamaConfig::peer = LlamaConfig::server;
+        }
+        else {
+            throw std::runtime_error("Invalid party");
+        }
+    }
+
     void finalize()
     {
         switch (LlamaConfig::party)
@@ -83,6 +119,65 @@ public:
 		}
     }
 
+    // The evaluators checkpoint their position in the key file, in the
+    // PRNG shared with the dealer and in the round count; streamed keys
+    // cannot be rewound, and the dealer restarts from the beginning
+    bool checkpoints()
+    {
+        return (LlamaConfig::party == SERVER || LlamaConfig::party == CLIENT) && !LlamaConfig::streamKeys;
+    }
+
+    void saveCheckpoint(std::ostream &out)
+    {
+        u64 state[4] = {LlamaConfig::dealer->keyOffset(), prngShared.mBlockIdx, prngShared.mBytesIdx, (u64) numRounds};
+        out.write((char *) state, sizeof(state));
+    }
+
+    void loadCheckpoint(std::istream &in)
+    {
+        u64 state[4];
+        in.read((char *) state, sizeof(state));
+        always_assert(in.good());
+        LlamaConfig::dealer->seekKeys(state[0]);
+        if (LlamaConfig::party == SERVER) {
+            // the server's PRNG is keyed by then (llama::start); regenerate
+            // the buffer that was current when the checkpoint was taken
+            prngShared.mBlockIdx = state[1] - prngShared.mBuffer.size();
+            prngShared.refillBuffer();
+            prngShared.mBytesIdx = state[2];
+        }
+        numRounds = state[3];
+    }
+
+    // The dealer writes new key files for every run; a checkpoint taken with
+    // other keys would resume at a key offset that means nothing
+    u64 checkpointId()
+    {
+        return (LlamaConfig::dealer->keyFileSize * 0x100000001b3ULL) ^ LlamaConfig::dealer->keyFileMtime;
+    }
+
+    void checkpointBarrier()
+    {
+        LlamaConfig::peer->sync();
+    }
+
+    u64 agreeCheckpoint(const std::vector<u64> &waves)
+    {
+        always_assert(waves.size() <= 2);
+        u64 mine[2] = {0, 0}, theirs[2];
+        std::copy(waves.begin(), waves.end(), mine);
+        LlamaConfig::peer->exchange_bytes(mine, theirs, sizeof(mine));
+        u64 agreed = 0;
+        for (auto a : mine) {
+            for (auto b : theirs) {
+                if (a == b) {
+                    agreed = std::max(agreed, a);
+                }
+            }
+        }
+        return agreed;
+    }
+
     void initializeInferencePartyB(Tensor<T>&data){
         u64 size = data.size();
         if(LlamaConfig::party == 1){
@@ -107,12 +202,27 @@ public:
             auto layer = node->layer;
             auto weights = layer->getweights();
             auto bias = layer->getbias();
+            bool clearOnServer = LlamaConfig::serverKnownWeights && (layer->name == "Conv2D" || layer->name == "FC");
+            if (clearOnServer && weights.size > 0) {
+                serverWeights.insert(weights.data);
+            }
             if(LlamaConfig::party == 1){
                 input_layer(nullptr, weights.data, weights.size, 2);
                 if (layer->useBias) {
                     input_layer(nullptr, bias.data, bias.size, 2);
                 }
             }
+            else if (clearOnServer && LlamaConfig::party == 2) {
+                // the client gets the masked weights, the server keeps its own
+                Tensor1D<T> masked(weights.size);
+                Tensor1D<T> tmp(weights.size);
+                std::copy(weights.data, weights.data + weights.size, masked.data);
+                input_layer(masked.data, tmp.data, weights.size, 2);
+                if(layer->useBias){
+                    Tensor1D<T> tmp2(bias.size);
+                    input_layer(bias.data, tmp2.data, bias.size, 2);
+                }
+            }
             else{
                 Tensor1D<T> tmp(weights.size);
                 input_layer(weights.data, tmp.data, weights.size, 2);
@@ -221,7 +331,7 @@ public:
         assert(a.d2 == b.d1);
         assert(c.d1 == a.d1);
         assert(c.d2 == b.d2);
-        MatMul2D(a.d1, a.d2, b.d2, a.data, a.data, b.data, b.data, c.data, c.data, true);
+        MatMul2D(a.d1, a.d2, b.d2, a.data, a.data, b.data, b.data, c.data, c.data, true, serverWeights.count(b.data) > 0);
     }
 
     void matmulTransposeA(const Tensor2D<T> &a, const Tensor2D<T> &b, Tensor2D<T> &c) {
@@ -261,7 +371,7 @@ public:
 
         Conv2DWrapper(input.d1, input.d2, input.d3, input.d4, fh, fw, co, 
             padding, padding, padding, padding, stride, stride, 
-            input.data, input.data, filter.data, filter.data, output.data, output.data);
+            input.data, input.data, filter.data, filter.data, output.data, output.data, serverWeights.count(filter.data) > 0);
     }
 
     void conv3D(u64 fd, u64 fh, u64 fw, u64 pd, u64 ph, u64 pw, u64 sd, u64 sh, u64 sw, u64 dd, u64 dh, u64 dw, u64 ci, u64 co, const Tensor5D<T> &input, const Tensor2D<T> &filter, Tensor5D<T> &output)
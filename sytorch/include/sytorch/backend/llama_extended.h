@@ -7,12 +7,101 @@ class Sequential;
 template <typename T>
 class LlamaExtended : public LlamaBase<T> {
 public:
+    // Nodes whose forward truncation doOptimize moved to a child
+    std::set<LayerGraphNode<T> *> deferredTruncation;
+
+    // With a calibrated model (see SytorchModule::calibrate), the ReLUs and
+    // forward truncations compare only as many bits as their inputs need.
+    // The shares stay at LlamaConfig::bitlength, so no extension is needed
+    // between layers; the keys and the DCF evaluations shrink with the width.
+    // The outputs of deferredTruncation nodes are at twice the scale.
+    int reluInputBitwidth(const Tensor<T> &in, u64 scale) {
+        bool deferred = deferredTruncation.count(in.graphNode) > 0;
+        return calibratedBitwidth(in.graphNode, deferred ? 2 * scale : scale);
+    }
 
-    void relu(const Tensor<T> &in, const Tensor<T> &out, const Tensor<T> &drelu, u64 scale, int mode) {
+    // A forward truncation sees the layer's output at scale + shift
+    int truncateInputBitwidth(const Tensor<T> &in, u64 shift) {
+        if (in.graphNode == nullptr) {
+            return 0;
+        }
+        return calibratedBitwidth(in.graphNode, in.graphNode->layer->scale + shift);
+    }
+
+    void relu(const Tensor<T> &in, const Tensor<T> &out, const Tensor<T> &drelu, int bw) {
         assert(in.is_same_shape(out));
         assert(in.is_same_shape(drelu));
         int sz = in.size();
-        Relu(sz, in.data, in.data, out.data, out.data, drelu.data);
+        if (bw > 0 && bw < LlamaConfig::bitlength) {
+            Relu2Round(sz, in.data, in.data, out.data, out.data, drelu.data, std::max(bw, 2));
+        }
+        else {
+            Relu(sz, in.data, in.data, out.data, out.data, drelu.data);
+        }
+    }
+
+    void relu(const Tensor<T> &in, const Tensor<T> &out, const Tensor<T> &drelu, u64 scale, int mode) {
+        relu(in, out, drelu, reluInputBitwidth(in, scale));
+    }
+
+    // ReLUs and truncations of independent layers are evaluated on one
+    // concatenated buffer, so that they share their reconstruct rounds
+    void reluBatch(const std::vector<Tensor<T> *> &in, const std::vector<Tensor<T> *> &out, const std::vector<Tensor<T> *> &drelu, u64 scale, int mode) {
+        if (in.size() == 1) {
+            relu(*in[0], *out[0], *drelu[0], scale, mode);
+            return;
+        }
+        // the widest input sets the width of the merged call
+        u64 sz = 0;
+        int bw = 0;
+        for (size_t i = 0; i < in.size(); ++i) {
+            sz += in[i]->size();
+            int b = reluInputBitwidth(*in[i], scale);
+            bw = (i == 0 || (bw > 0 && b > 0)) ? std::max(bw, b) : 0;
+        }
+        Tensor<T> x({sz}), y({sz}), d({sz});
+        u64 off = 0;
+        for (auto &t : in) {
+            std::copy(t->data, t->data + t->size(), x.data + off);
+            off += t->size();
+        }
+        relu(x, y, d, bw);
+        off = 0;
+        for (size_t i = 0; i < in.size(); ++i) {
+            std::copy(y.data + off, y.data + off + out[i]->size(), out[i]->data);
+            std::copy(d.data + off, d.data + off + drelu[i]->size(), drelu[i]->data);
+            off += in[i]->size();
+        }
+    }
+
+    void truncateForward(const Tensor<T> &in, u64 shift, u8 mode) {
+        truncateBw(in.data, in.data, shift, in.size(), truncateInputBitwidth(in, shift));
+    }
+
+    void truncateForwardBatch(const std::vector<Tensor<T> *> &in, u64 shift, u8 mode) {
+        if (in.size() == 1) {
+            this->truncateForward(*in[0], shift, mode);
+            return;
+        }
+        u64 sz = 0;
+        int bw = 0;
+        for (size_t i = 0; i < in.size(); ++i) {
+            sz += in[i]->size();
+            int b = truncateInputBitwidth(*in[i], shift);
+            bw = (i == 0 || (bw > 0 && b > 0)) ? std::max(bw, b) : 0;
+        }
+        Tensor<T> x({sz});
+        u64 off = 0;
+        for (auto &t : in) {
+            std::copy(t->data, t->data + t->size(), x.data + off);
+            off += t->size();
+        }
+        truncateBw(x.data, x.data, shift, sz, bw);
+        off = 0;
+        for (auto &t : in) {
+            std::copy(x.data + off, x.data + off + t->size(), t->data);
+            off += t->size();
+        }
     }
 
     void leakyRelu(const Tensor<T> &in, const Tensor<T> &out, const Tensor<T> &drelu, u64 scale, int mode, T alpha)
@@ -52,11 +141,19 @@ public:
     }
 
     void truncate(T *in, T *out, u64 shift, u64 size, u8 mode) {
+        truncateBw(in, out, shift, size, 0);
+    }
+
+    // bw: the inputs fit in bw bits (0: unknown)
+    void truncateBw(T *in, T *out, u64 shift, u64 size, int bw) {
         if (this->useLocalTruncation) {
             for(u64 i = 0; i < size; i++) {
                 out[i] = in[i] >> shift;
             }
         }
+        else if (bw > 0 && bw < LlamaConfig::bitlength) {
+            ARS(size, in, in, out, out, shift, std::max(bw, (int) shift + 2));
+        }
         else {
             ARS(size, in, in, out, out, shift);
         }
@@ -65,12 +162,13 @@ public:
     void maxPool2D(u64 ks, u64 padding, u64 stride, const Tensor4D<T> &in, Tensor4D<T> &out, Tensor4D<u64> &maxIdx, u64 scale, u8 mode) {
         assert(in.d1 == out.d1);
         assert(in.d4 == out.d4);
-        Tensor1D<T> maxBit((ks * ks - 1) * out.d1 * out.d2 * out.d3 * out.d4);
+        // An empty maxIdx means no backward pass will read it: skip the one-hot
+        if (maxIdx.d1 == 0) {
+            MaxPoolTree(out.d1, out.d2, out.d3, out.d4, ks, ks, padding, padding, padding, padding, stride, stride, in.d1, in.d2, in.d3, in.d4, in.data, in.data, out.data, out.data, nullptr);
+            return;
+        }
         maxIdx.resize(ks * ks * out.d1, out.d2, out.d3, out.d4);
-        MaxPool(out.d1, out.d2, out.d3, out.d4, ks, ks, padding, padding, padding, padding, stride, stride, in.d1, in.d2, in.d3, in.d4, in.data, in.data, out.data, out.data, maxBit.data);
-        MaxPoolOneHot(out.d1, out.d2, out.d3, out.d4, ks, ks, maxBit.data, maxIdx.data);
-        // maxBit.template print<1>();
-        // maxIdx.template print<1>();
+        MaxPoolTree(out.d1, out.d2, out.d3, out.d4, ks, ks, padding, padding, padding, padding, stride, stride, in.d1, in.d2, in.d3, in.d4, in.data, in.data, out.data, out.data, maxIdx.data);
     }
 
     void gelu(const Tensor<T> &in, const Tensor<T> &out, u64 scale)
@@ -215,6 +313,7 @@ public:
                         // optimize
                         node->layer->doTruncationForward = false;
                         child->layer->doTruncationForward = true;
+                        deferredTruncation.insert(node);
                     }
                 }
             }
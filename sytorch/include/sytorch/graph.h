@@ -2,6 +2,9 @@
 #include <set>
 #include <fstream>
 #include <queue>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
 
 template <typename T>
 class Layer;
@@ -14,18 +17,22 @@ struct LayerGraphNode {
     Layer<T> *layer;
     std::vector<LayerGraphNode<T> *> parents;
     std::vector<LayerGraphNode<T> *> children;
-    int numUsages = 0;
+    // Children that have consumed currTensor; independent children may run
+    // on separate threads, and the last one to finish frees the tensor
+    std::atomic<int> numUsages{0};
     Tensor<T> *currTensor = nullptr;
     bool mark = false;
     std::vector<LayerGraphNode<T> *> *allNodesInExecutionOrderRef = nullptr;
+    // Bound on the magnitude of the real values of this node's output, set
+    // by SytorchModule::calibrate; 0 when not calibrated
+    double range = 0;
 
     bool incrementAndGc()
     {
         if (layer->name == "Input") {
             return false;
         }
-        numUsages++; // todo: make it atomic
-        if (numUsages == children.size()) {
+        if (numUsages.fetch_add(1) + 1 == (int)children.size()) {
             currTensor->free();
             return true;
         }
@@ -33,6 +40,17 @@ struct LayerGraphNode {
     }
 };
 
+// Bits, sign included, that hold the output of a calibrated node when it is
+// in fixed point with the given scale; 0 when the node is not calibrated
+template <typename T>
+int calibratedBitwidth(const LayerGraphNode<T> *node, uint64_t scale)
+{
+    if (node == nullptr || node->range <= 0) {
+        return 0;
+    }
+    return 1 + (int) std::ceil(std::log2(std::ldexp(node->range, scale) + 1));
+}
+
 template <typename T, typename Functor>
 void topologicalVisit(std::set<LayerGraphNode<T> *> &visited, LayerGraphNode<T> *node, LayerGraphNode<T> *root, Functor visitFn)
 {
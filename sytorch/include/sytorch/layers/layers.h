@@ -2,6 +2,7 @@
 #include <sytorch/utils.h>
 #include <llama/assert.h>
 #include <sytorch/backend/default.h>
+#include <utils/trace.h>
 #include <string>
 
 template <typename T>
@@ -78,6 +79,20 @@ public:
             return activation;
         }
 
+        TRACE_LAYER(name.c_str());
+        forwardBegin(a);
+        _forward(a);
+        if (doTruncationForward) {
+            this->backend->truncateForward(activation, scale, forwardTruncationMode);
+        }
+        forwardEnd(a);
+        return activation;
+    }
+
+    // The steps of forward around _forward and the forward truncation, for
+    // the graph executor in SytorchModule, which merges the truncations (and
+    // ReLUs) of independent layers
+    void forwardBegin(std::vector<Tensor<T> *> &a) {
         // check if we have the graph generated already
         always_assert(node != nullptr);
         for(auto &i : a) {
@@ -94,17 +109,15 @@ public:
                 this->backend->signext(*i, scale);
             }
         }
-        _forward(a);
-        if (doTruncationForward) {
-            this->backend->truncateForward(activation, scale, forwardTruncationMode);
-        }
+    }
+
+    void forwardEnd(std::vector<Tensor<T> *> &a) {
         if (doPostSignExtension) {
             this->backend->signext(activation, scale);
         }
         for(auto &i : a) {
             i->graphNode->incrementAndGc();
         }
-        return activation;
     }
 
     virtual TensorRef<T> getweights() { return TensorRef<T>(nullptr, 0); };
@@ -354,6 +367,13 @@ public:
     void _forward(Tensor<T> &a) {
         auto a_4d = a.as_4d();
         auto act_4d = this->activation.as_4d();
+        // The argmax is only consumed by the backward pass
+        if (!this->isTrainingMode) {
+            this->maxIndex.resize(0, 0, 0, 0);
+        }
+        else if (this->maxIndex.d1 == 0) {
+            this->maxIndex.resize(this->activation.shape);
+        }
         this->backend->maxPool2D(ks, padding, stride, a_4d, act_4d, maxIndex, this->scale, this->mode);
     }
 
@@ -3,10 +3,25 @@
 #include <filesystem>
 #include <map>
 #include <algorithm>
+#include <thread>
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <cstring>
+#include <cstdio>
+
+// Fixed-point conversion of n floats, already multiplied by 2^scale in mult.
+// Runs over the OpenMP threads (the loop is a plain vectorizable map) once
+// the layer is large enough to make it worthwhile.
+template <typename T>
+void floatToFixed(const float *in, T *out, u64 n, float mult)
+{
+    #pragma omp parallel for simd schedule(static) if(n >= (1 << 16))
+    for (u64 i = 0; i < n; ++i) {
+        out[i] = type_cast<T>(in[i] * mult);
+    }
+}
 
 template <typename T>
 class SytorchModule {
@@ -15,12 +30,25 @@ public:
     Tensor<T> activation;
     Backend<T> *backend = new ClearText<T>;
     LayerGraphNode<T> *root = nullptr;
-    bool debug = true;
+    LayerGraphNode<T> *outputNode = nullptr;
+    // Runs _forward instead of the graph executor (forwardGraph). Every
+    // party of a LLAMA run must use the same setting, as the keys follow the
+    // order in which the layers run
+    bool debug = false;
     u64 scale;
 
     std::vector<LayerGraphNode<T> *> allNodesInExecutionOrder;
+    // allNodesInExecutionOrder grouped by depth (one more than the deepest
+    // parent); the nodes of a wave do not depend on each other
+    std::vector<std::vector<LayerGraphNode<T> *>> waves;
     const std::vector<std::string> functionalLayers = {"Add", "Concat", "GeLU", "SoftMax", "Split", "View", "Transpose", "_MatMul", "_ScalarMul"};
     static std::map<std::string, LayerGraphNode<T> *> functionalLayerMap;
+    // Layer-boundary checkpoints of the run, see forwardGraph; off when empty
+    std::string checkpointDir = "";
+    u64 checkpointInterval = 8;
+    // What a checkpoint must have been taken with to be resumed from: the
+    // graph, this party's input and the backend's state (see checkpointKey)
+    u64 checkpointKey[3] = {0, 0, 0};
 
 public:
 
@@ -84,6 +112,22 @@ public:
         auto &res = this->_forward(ip);
         ip.graphGenMode = false;
         root = ip.graphNode;
+        outputNode = res.graphNode;
+
+        std::map<LayerGraphNode<T> *, size_t> depth;
+        depth[root] = 0;
+        waves.clear();
+        for (auto &node : allNodesInExecutionOrder) {
+            size_t d = 0;
+            for (auto &parent : node->parents) {
+                d = std::max(d, depth[parent] + 1);
+            }
+            depth[node] = d;
+            if (waves.size() < d) {
+                waves.resize(d);
+            }
+            waves[d - 1].push_back(node);
+        }
     }
 
     void init(u64 scale)
@@ -119,51 +163,513 @@ public:
             return this->_forward(input);
         }
 
-        if (input.graphNode == nullptr) { // when the module is a top level module
+        bool topLevel = (input.graphNode == nullptr);
+        if (topLevel) { // when the module is a top level module
             topologicalApply(root, [](LayerGraphNode<T> *node, LayerGraphNode<T> *_root) {
                 node->numUsages = 0;
             });
             input.graphNode = root;
             input.graphNode->currTensor = &input;
         }
-        if (debug) {
+        if ((debug && checkpointDir == "") || !topLevel) {
             auto& res = this->_forward(input);
             this->activation.resize(res.shape);
             this->activation.copy(res);
             return this->activation;
         }
         else {
-            auto& res = this->_forward(input); // todo: calculate using the generated graph
+            forwardGraph();
+            auto& res = *outputNode->currTensor;
             this->activation.resize(res.shape);
             this->activation.copy(res);
             return this->activation;
         }
     }
 
+    // Runs the generated graph wave by wave instead of calling _forward.
+    // Backends that allow it (Backend::concurrentLayers) run the layers of a
+    // wave on separate threads. Otherwise the layers run in wave order, with
+    // the ReLUs and forward truncations of a wave handed to the backend
+    // together: the LLAMA backends then evaluate them in one round instead
+    // of one per layer. The waves only depend on the graph, so the dealer
+    // and the evaluators produce and consume keys in the same order.
+    //
+    // With checkpoints enabled, the parties that the backend lets take them
+    // save the outputs that later waves still read, and the backend's state,
+    // after every checkpointInterval waves. A run that was cut off (say, by a
+    // dropped connection) is started again with the same inputs, and resumes
+    // after the latest checkpoint that all parties hold.
+    void forwardGraph()
+    {
+        bool checkpoints = (checkpointDir != "") && backend->checkpoints();
+        if (checkpoints) {
+            checkpointKey[0] = graphSignature();
+            checkpointKey[1] = inputSignature();
+            checkpointKey[2] = backend->checkpointId();
+        }
+        size_t first = checkpoints ? resumeCheckpoint() : 0;
+        for (size_t w = first; w < waves.size(); ++w) {
+            if (checkpoints && w > first && w % checkpointInterval == 0) {
+                saveCheckpoint(w);
+            }
+            auto &wave = waves[w];
+            std::vector<std::vector<Tensor<T> *>> inputs(wave.size());
+            for (size_t i = 0; i < wave.size(); ++i) {
+                for (auto &parent : wave[i]->parents) {
+                    inputs[i].push_back(parent->currTensor);
+                }
+            }
+
+            if (wave.size() > 1 && backend->concurrentLayers()) {
+                std::vector<std::thread> pool;
+                for (size_t i = 1; i < wave.size(); ++i) {
+                    pool.emplace_back([&, i]() { wave[i]->layer->forward(inputs[i]); });
+                }
+                wave[0]->layer->forward(inputs[0]);
+                for (auto &t : pool) {
+                    t.join();
+                }
+                continue;
+            }
+
+            for (size_t i = 0; i < wave.size(); ++i) {
+                wave[i]->layer->forwardBegin(inputs[i]);
+            }
+
+            // ReLUs with the same (scale, mode) share a call
+            std::map<std::pair<u64, int>, std::vector<size_t>> relus;
+            for (size_t i = 0; i < wave.size(); ++i) {
+                auto layer = wave[i]->layer;
+                if (layer->name == "ReLU") {
+                    relus[{layer->scale, layer->mode}].push_back(i);
+                    continue;
+                }
+                TRACE_LAYER(layer->name.c_str());
+                layer->_forward(inputs[i]);
+            }
+            for (auto &group : relus) {
+                TRACE_LAYER("ReLU");
+                std::vector<Tensor<T> *> in, out, drelu;
+                for (auto i : group.second) {
+                    auto relu = (ReLU<T> *) wave[i]->layer;
+                    in.push_back(inputs[i][0]);
+                    out.push_back(&relu->activation);
+                    drelu.push_back(&relu->drelu);
+                }
+                backend->reluBatch(in, out, drelu, group.first.first, group.first.second);
+            }
+
+            // and so do truncations with the same (shift, mode)
+            std::map<std::pair<u64, int>, std::vector<Tensor<T> *>> truncations;
+            for (auto &node : wave) {
+                auto layer = node->layer;
+                if (layer->doTruncationForward) {
+                    truncations[{layer->scale, layer->forwardTruncationMode}].push_back(&layer->activation);
+                }
+            }
+            for (auto &group : truncations) {
+                TRACE_LAYER("Truncate");
+                backend->truncateForwardBatch(group.second, group.first.first, group.first.second);
+            }
+
+            for (size_t i = 0; i < wave.size(); ++i) {
+                wave[i]->layer->forwardEnd(inputs[i]);
+            }
+        }
+        if (checkpoints) {
+            // the next run starts afresh
+            for (int slot = 0; slot < 2; ++slot) {
+                std::remove(checkpointFile(slot).c_str());
+            }
+        }
+    }
+
+    // All parties must enable checkpoints, as it switches every run to
+    // forwardGraph (whose order of layers the keys follow). dir is per party.
+    // Every checkpoint costs a round (checkpointBarrier) and a file write, so
+    // by default only every 8th layer wave is checkpointed
+    void enableCheckpoints(const std::string &dir, u64 interval = 8)
+    {
+        always_assert(interval > 0);
+        std::filesystem::create_directories(dir);
+        checkpointDir = dir;
+        checkpointInterval = interval;
+    }
+
+    // Two files alternate: after a failure, the parties are at most one
+    // checkpoint apart (see checkpointBarrier), so they share one of them
+    std::string checkpointFile(int slot)
+    {
+        return checkpointDir + "/checkpoint." + std::to_string(slot);
+    }
+
+    u64 graphSignature()
+    {
+        std::string id = std::to_string(scale);
+        for (auto &node: allNodesInExecutionOrder) {
+            id += "|" + node->layer->name + "(" + node->layer->paramstring + ")";
+        }
+        // FNV-1a
+        u64 key = 0xcbf29ce484222325ULL;
+        for (unsigned char c : id) {
+            key = (key ^ c) * 0x100000001b3ULL;
+        }
+        return key;
+    }
+
+    // What this party feeds the run: its (masked) input and the weights.
+    // FNV-1a over 8-byte words, as the weights can be large
+    u64 inputSignature()
+    {
+        u64 key = 0xcbf29ce484222325ULL;
+        auto hash = [&](const T *data, u64 size) {
+            const char *bytes = (const char *) data;
+            u64 n = size * sizeof(T);
+            for (u64 i = 0; i < n; i += 8) {
+                u64 word = 0;
+                memcpy(&word, bytes + i, std::min<u64>(8, n - i));
+                key = (key ^ word) * 0x100000001b3ULL;
+            }
+        };
+        hash(root->currTensor->data, root->currTensor->size());
+        topologicalApply(root, [&](LayerGraphNode<T> *node, LayerGraphNode<T> *_root) {
+            auto weights = node->layer->getweights();
+            auto bias = node->layer->getbias();
+            hash(weights.data, weights.size);
+            hash(bias.data, bias.size);
+        });
+        return key;
+    }
+
+    // The checkpoint taken before wave w. Index 0 stands for the input and
+    // i + 1 for allNodesInExecutionOrder[i]
+    void saveCheckpoint(size_t w)
+    {
+        backend->checkpointBarrier();
+        std::vector<LayerGraphNode<T> *> nodes = {root};
+        for (size_t v = 0; v < w; ++v) {
+            nodes.insert(nodes.end(), waves[v].begin(), waves[v].end());
+        }
+        std::map<LayerGraphNode<T> *, u64> index;
+        index[root] = 0;
+        for (size_t i = 0; i < allNodesInExecutionOrder.size(); ++i) {
+            index[allNodesInExecutionOrder[i]] = i + 1;
+        }
+
+        std::string file = checkpointFile((w / checkpointInterval) % 2);
+        std::string tmpFile = file + ".tmp";
+        std::ofstream out(tmpFile, std::ios::binary);
+        u64 header[2] = {(u64) w, 0};
+        for (auto &node : nodes) {
+            if (node == outputNode || node->numUsages < (int) node->children.size()) {
+                header[1]++;
+            }
+        }
+        out.write("SYTCKPT2", 8);
+        out.write((char *) checkpointKey, sizeof(checkpointKey));
+        out.write((char *) header, sizeof(header));
+        backend->saveCheckpoint(out);
+        for (auto &node : nodes) {
+            if (node != outputNode && node->numUsages >= (int) node->children.size()) {
+                continue;
+            }
+            auto &t = *node->currTensor;
+            u64 meta[3] = {index[node], (u64) node->numUsages.load(), t.shape.size()};
+            out.write((char *) meta, sizeof(meta));
+            out.write((char *) t.shape.data(), t.shape.size() * sizeof(u64));
+            out.write((char *) t.data, t.size() * sizeof(T));
+        }
+        out.close();
+        always_assert(out.good());
+        // renamed into place, so that a failure while writing leaves the
+        // previous checkpoint in this slot intact
+        always_assert(std::rename(tmpFile.c_str(), file.c_str()) == 0);
+        std::cerr << ">> Checkpoint before layer wave " << w << " of " << waves.size() << "\n";
+    }
+
+    // Returns the wave to start from. Checkpoints of another model, input or
+    // key file (left over from an earlier run) are ignored
+    size_t resumeCheckpoint()
+    {
+        std::vector<u64> held;
+        int slotOf[2] = {-1, -1};
+        for (int slot = 0; slot < 2; ++slot) {
+            std::ifstream in(checkpointFile(slot), std::ios::binary);
+            char magic[8];
+            u64 key[3];
+            u64 header[2];
+            in.read(magic, 8);
+            in.read((char *) key, sizeof(key));
+            in.read((char *) header, sizeof(header));
+            if (in.good() && memcmp(magic, "SYTCKPT2", 8) == 0 && memcmp(key, checkpointKey, sizeof(key)) == 0 && header[0] > 0) {
+                slotOf[held.size()] = slot;
+                held.push_back(header[0]);
+            }
+        }
+        u64 w = backend->agreeCheckpoint(held);
+        if (w == 0) {
+            return 0;
+        }
+
+        int slot = slotOf[held[0] == w ? 0 : 1];
+        std::ifstream in(checkpointFile(slot), std::ios::binary);
+        in.seekg(8 + sizeof(checkpointKey));
+        u64 header[2];
+        in.read((char *) header, sizeof(header));
+        backend->loadCheckpoint(in);
+        // the outputs of the waves before w that are not in the checkpoint
+        // have been consumed
+        root->numUsages = (int) root->children.size();
+        for (size_t v = 0; v < w; ++v) {
+            for (auto &node : waves[v]) {
+                node->numUsages = (int) node->children.size();
+            }
+        }
+        for (u64 k = 0; k < header[1]; ++k) {
+            u64 meta[3];
+            in.read((char *) meta, sizeof(meta));
+            std::vector<u64> shape(meta[2]);
+            in.read((char *) shape.data(), shape.size() * sizeof(u64));
+            auto node = (meta[0] == 0) ? root : allNodesInExecutionOrder[meta[0] - 1];
+            auto &t = (node == root) ? *root->currTensor : node->layer->activation;
+            t.resize(shape);
+            in.read((char *) t.data, t.size() * sizeof(T));
+            node->currTensor = &t;
+            t.graphNode = node;
+            node->numUsages = (int) meta[1];
+        }
+        always_assert(in.good());
+        std::cerr << ">> Resuming from layer wave " << w << " of " << waves.size() << "\n";
+        return w;
+    }
+
     void optimize()
     {
         backend->optimize(root);
     }
 
+    // Range analysis for the LLAMA backends: runs input, a batch of sample
+    // queries, through the graph and records on each node a bound on the
+    // magnitude of its output, the largest value seen times 2^marginBits.
+    // Calls accumulate, so that a dataset can be fed batch by batch. Needs
+    // the ClearText backend, with which every activation is at this->scale.
+    // The bounds are not proven: a query far outside the samples gives wrong
+    // ReLUs and truncations, hence the margin.
+    void calibrate(Tensor<T> &input, u64 marginBits = 2)
+    {
+        always_assert(dynamic_cast<ClearText<T> *>(backend) != nullptr);
+        topologicalApply(root, [](LayerGraphNode<T> *node, LayerGraphNode<T> *_root) {
+            node->numUsages = 0;
+        });
+        input.graphNode = root;
+        root->currTensor = &input;
+
+        int exp = (int) marginBits - (int) scale;
+        auto observe = [exp](LayerGraphNode<T> *node, const Tensor<T> &t) {
+            double m = 0;
+            for (u64 i = 0; i < t.size(); ++i) {
+                m = std::max(m, std::abs((double) t.data[i]));
+            }
+            node->range = std::max(node->range, std::ldexp(m, exp));
+        };
+        observe(root, input);
+        // in execution order, each output is seen before its children free it
+        for (auto &node : allNodesInExecutionOrder) {
+            std::vector<Tensor<T> *> inputs;
+            for (auto &parent : node->parents) {
+                inputs.push_back(parent->currTensor);
+            }
+            observe(node, node->layer->forward(inputs));
+        }
+    }
+
+    // The calibrated ranges, one line per node in execution order, so that
+    // the dealer and the client, who have no samples, use the same widths as
+    // the server. Hex floats keep them exact.
+    void saveCalibration(const std::string &file)
+    {
+        std::ofstream out(file);
+        out << "sytorch-calibration " << allNodesInExecutionOrder.size() << "\n";
+        out << std::hexfloat;
+        out << root->layer->name << " " << root->range << "\n";
+        for (auto &node : allNodesInExecutionOrder) {
+            out << node->layer->name << " " << node->range << "\n";
+        }
+        always_assert(out.good());
+    }
+
+    void loadCalibration(const std::string &file)
+    {
+        std::ifstream in(file);
+        std::string magic, name;
+        size_t numNodes = 0;
+        in >> magic >> numNodes;
+        always_assert(magic == "sytorch-calibration" && numNodes == allNodesInExecutionOrder.size());
+        auto read = [&](LayerGraphNode<T> *node) {
+            std::string range;
+            in >> name >> range;
+            always_assert(in.good() && name == node->layer->name);
+            // operator>> does not parse hex floats
+            node->range = std::strtod(range.c_str(), nullptr);
+        };
+        read(root);
+        for (auto &node : allNodesInExecutionOrder) {
+            read(node);
+        }
+    }
+
+    // Calls f(data, size) on every parameter block, in the order in which
+    // load() reads them: weights and (if used) bias of each layer, or the
+    // folded A and B of a BatchNormInference
+    template <typename Functor>
+    void forEachParameter(Functor f)
+    {
+        for (auto &node: allNodesInExecutionOrder) {
+            auto layer = node->layer;
+            if (layer->name == "BatchNormInference") {
+                auto bn = (BatchNormInference<T>*) layer;
+                f(bn->A.data, bn->A.d1);
+                f(bn->B.data, bn->B.d1);
+            }
+            else {
+                auto weights = layer->getweights();
+                f(weights.data, weights.size);
+                if (layer->useBias) {
+                    auto bias = layer->getbias();
+                    f(bias.data, bias.size);
+                }
+            }
+        }
+    }
+
+    // With SYTORCH_WEIGHTS_CACHE=<dir>, load() keeps the converted
+    // parameters in <dir>/<key>.bin and later runs map that file instead of
+    // converting the floats again. The key covers the weights file (path,
+    // size and modification time), the parameter layout of the graph, the
+    // scale and T, so a changed model or scale misses the cache.
+    std::string weightsCacheFile(const std::string &weightsFile, u64 &key)
+    {
+        const char *dir = std::getenv("SYTORCH_WEIGHTS_CACHE");
+        if (dir == nullptr || *dir == '\0') {
+            return "";
+        }
+        struct stat sb;
+        if (stat(weightsFile.c_str(), &sb) != 0) {
+            return "";
+        }
+        std::string id = std::filesystem::absolute(weightsFile).string();
+        id += "|" + std::to_string(sb.st_size) + "|" + std::to_string(sb.st_mtim.tv_sec) + "." + std::to_string(sb.st_mtim.tv_nsec);
+        id += "|" + std::to_string(scale) + "|" + std::to_string(sizeof(T)) + "|" + std::to_string(std::is_floating_point<T>::value);
+        for (auto &node: allNodesInExecutionOrder) {
+            id += "|" + node->layer->name + "(" + node->layer->paramstring + ")";
+        }
+        forEachParameter([&](T *data, u64 size) {
+            id += "|" + std::to_string(size);
+        });
+        // FNV-1a
+        key = 0xcbf29ce484222325ULL;
+        for (unsigned char c : id) {
+            key = (key ^ c) * 0x100000001b3ULL;
+        }
+        char name[32];
+        snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+        return std::string(dir) + "/" + name;
+    }
+
+    struct WeightsCacheHeader {
+        char magic[8];
+        u64 version;
+        u64 key;
+        u64 numElements;
+    };
+    static const u64 weightsCacheVersion = 1;
+
+    bool loadWeightsCache(const std::string &cacheFile, u64 key)
+    {
+        int fd = open(cacheFile.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat sb;
+        fstat(fd, &sb);
+        size_t size = sb.st_size;
+        void *buf = (size >= sizeof(WeightsCacheHeader)) ? mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+        ::close(fd);
+        if (buf == MAP_FAILED) {
+            return false;
+        }
+
+        u64 numElements = 0;
+        forEachParameter([&](T *data, u64 n) { numElements += n; });
+        auto header = (const WeightsCacheHeader *) buf;
+        bool valid = (memcmp(header->magic, "SYTWCACH", 8) == 0) && (header->version == weightsCacheVersion)
+            && (header->key == key) && (header->numElements == numElements)
+            && (size == sizeof(WeightsCacheHeader) + numElements * sizeof(T));
+        if (valid) {
+            const T *values = (const T *)((const char *) buf + sizeof(WeightsCacheHeader));
+            forEachParameter([&](T *data, u64 n) {
+                if (n > 0) {
+                    memcpy(data, values, n * sizeof(T));
+                }
+                values += n;
+            });
+            for (auto &node: allNodesInExecutionOrder) {
+                auto layer = node->layer;
+                if (layer->name != "BatchNormInference" && !layer->useBias) {
+                    layer->getbias().zero();
+                }
+            }
+            std::cerr << "Model Weights Cache: " << cacheFile << "\n";
+        }
+        munmap(buf, size);
+        return valid;
+    }
+
+    void storeWeightsCache(const std::string &cacheFile, u64 key)
+    {
+        WeightsCacheHeader header;
+        memcpy(header.magic, "SYTWCACH", 8);
+        header.version = weightsCacheVersion;
+        header.key = key;
+        header.numElements = 0;
+        forEachParameter([&](T *data, u64 n) { header.numElements += n; });
+
+        // written aside and renamed, so that concurrent runs never map a
+        // partial file
+        std::string tmpFile = cacheFile + ".tmp." + std::to_string(getpid());
+        std::ofstream file(tmpFile, std::ios::binary);
+        file.write((char *) &header, sizeof(header));
+        forEachParameter([&](T *data, u64 n) {
+            file.write((char *) data, n * sizeof(T));
+        });
+        file.close();
+        if (!file || std::rename(tmpFile.c_str(), cacheFile.c_str()) != 0) {
+            std::cerr << "Could not write weights cache " << cacheFile << "\n";
+            std::remove(tmpFile.c_str());
+        }
+    }
+
     void load(const std::string weightsFile)
     {
+        u64 cacheKey = 0;
+        std::string cacheFile = weightsCacheFile(weightsFile, cacheKey);
+        if (cacheFile != "" && loadWeightsCache(cacheFile, cacheKey)) {
+            return;
+        }
+
         size_t size_in_bytes = std::filesystem::file_size(weightsFile);
         always_assert(size_in_bytes % 4 == 0); // as it's float
         size_t numParameters = size_in_bytes / 4;
-        float *floatWeights = new float[numParameters];
-        //float *buffer;
+        float *floatWeights = nullptr;
         int buffersize = 0;
         
-        // std::ifstream file(weightsFile, std::ios::binary);
-        // file.read((char*) floatWeights, size_in_bytes);
-        // file.close();
-        int fd1 = open(weightsFile.c_str(), O_RDWR | O_CREAT, 0);
+        int fd1 = open(weightsFile.c_str(), O_RDONLY);
         struct stat sb;
         fstat(fd1, &sb);
         buffersize = sb.st_size;
-        int advise=posix_fadvise(fd1, 0, sb.st_size, POSIX_FADV_WILLNEED);
+        posix_fadvise(fd1, 0, sb.st_size, POSIX_FADV_WILLNEED);
         floatWeights= (float*)mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, fd1, 0);
-        //floatWeights = buffer;
+        always_assert(floatWeights != MAP_FAILED);
         std::cerr << "Model Weights Size: " << sb.st_size << " bytes" << "\n";
         ::close(fd1);
         u64 scale = this->scale;
@@ -187,20 +693,12 @@ public:
             }
             else {
                 auto weights = layer->getweights();
-                for (u64 j = 0; j < weights.size; j++) {
-                    weights.data[j] = type_cast<T>(floatWeights[wIdx + j] * (1LL << scale));
-                }
-
+                floatToFixed(floatWeights + wIdx, weights.data, weights.size, (float)(1LL << scale));
                 wIdx += weights.size;
-                
 
                 auto bias = layer->getbias();
                 if (layer->useBias) {
-
-                    for (u64 j = 0; j < bias.size; ++j) {
-                        bias.data[j] = type_cast<T>(floatWeights[wIdx + j] * (float)(1LL << (2*scale)));
-                    }
-
+                    floatToFixed(floatWeights + wIdx, bias.data, bias.size, (float)(1LL << (2*scale)));
                     wIdx += bias.size;
                 }
                 else {
@@ -210,10 +708,11 @@ public:
         }
         
         always_assert(wIdx == numParameters);
-    
-        //delete floatWeights;
         munmap(floatWeights, buffersize);
-       
+
+        if (cacheFile != "") {
+            storeWeightsCache(cacheFile, cacheKey);
+        }
     }
 
     void dumpi64(const std::string weightsFile)
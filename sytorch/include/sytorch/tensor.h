@@ -380,7 +380,9 @@ public:
     void randomize(double range) {
         for(u64 i = 0; i < this->d1; i++) {
             auto r = (double)prngWeights.get<int32_t>();
-            this->data[i] = (T)((r / (1LL << 31)) * range);
+            auto w = (r / (1LL << 31)) * range;
+            // a negative double only converts to an unsigned type through a signed one
+            this->data[i] = std::is_unsigned<T>::value ? (T)(i64)w : (T)w;
         }
     }
 
@@ -423,7 +425,8 @@ public:
         for(u64 i = 0; i < this->d1; i++) {
             for(u64 j = 0; j < this->d2; j++) {
                 auto r = (double)prngWeights.get<int32_t>();
-                this->data[i * this->d2 + j] = (T)((r / (1LL << 31)) * range);
+                auto w = (r / (1LL << 31)) * range;
+                this->data[i * this->d2 + j] = std::is_unsigned<T>::value ? (T)(i64)w : (T)w;
             }
         }
     }
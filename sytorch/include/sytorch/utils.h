@@ -477,6 +477,42 @@ void print_nchw(const Tensor<T> &p, u64 scale, u64 bw)
     std::cout << std::endl;
 }
 
+// Number of client queries stacked along the batch axis of one forward pass,
+// from EZPC_BATCH (default 1). Every layer then does one key read and one set
+// of rounds for the whole batch. LLAMA keys depend on the input shape, so
+// the dealer, server and client must all run with the same value.
+inline u64 query_batch_size()
+{
+    const char *s = std::getenv("EZPC_BATCH");
+    if (s == nullptr || *s == '\0')
+        return 1;
+    long long b = std::atoll(s);
+    always_assert(b > 0);
+    return b;
+}
+
+// print_nchw for each of the queries stacked along the batch axis of p,
+// each preceded by a "# query <i>" line when there is more than one
+template <typename T>
+void print_nchw_queries(const Tensor<T> &p, u64 queries, u64 scale, u64 bw)
+{
+    if (queries == 1)
+    {
+        print_nchw(p, scale, bw);
+        return;
+    }
+    always_assert(p.shape[0] % queries == 0);
+    std::vector<u64> shape = p.shape;
+    shape[0] /= queries;
+    u64 stride = p.size() / queries;
+    for (u64 q = 0; q < queries; ++q)
+    {
+        std::cout << "# query " << q << std::endl;
+        Tensor<T> query(p.data + q * stride, shape);
+        print_nchw(query, scale, bw);
+    }
+}
+
 template <typename T>
 void print(const Tensor<T> &p, u64 scale)
 {
@@ -0,0 +1,132 @@
+"""
+Request collector for batched LLAMA inference, run by the client party.
+
+    python collector.py <batch> <timeout> [port]
+
+Clients POST an image to /inference?name=<file name> and get its output back.
+The collector waits for <batch> queries, or <timeout> seconds after the first
+one arrived, and answers all of them with one run of client-online.sh, whose
+forward pass has batch size <batch>. The keys are dealt for exactly <batch>
+queries, so a partial batch is filled up with copies of its first image and
+their outputs are dropped.
+
+The collector sees the images in the clear: it stands for the clients in the
+secure computation with the server, like client-online.sh does for one client.
+"""
+
+import http.server
+import os
+import shutil
+import subprocess
+import sys
+import threading
+import time
+import urllib.parse
+
+batch = int(sys.argv[1])
+timeout = float(sys.argv[2])
+port = int(sys.argv[3]) if len(sys.argv) > 3 else 5000
+
+QUERY_DIR = "queries"
+
+
+class Query:
+    def __init__(self, path):
+        self.path = path
+        self.output = None
+        self.done = threading.Event()
+
+
+pending = []
+pending_cv = threading.Condition()
+
+
+def output_file(image):
+    # client-online.sh writes <image name>_output.txt per query of a batch
+    if batch == 1:
+        return "output.txt"
+    name = os.path.splitext(os.path.basename(image))[0]
+    return name + "_output.txt"
+
+
+def run_batches():
+    while True:
+        with pending_cv:
+            while not pending:
+                pending_cv.wait()
+            deadline = time.monotonic() + timeout
+            while len(pending) < batch:
+                remaining = deadline - time.monotonic()
+                if remaining <= 0:
+                    break
+                pending_cv.wait(remaining)
+            queries = pending[:batch]
+            del pending[:batch]
+
+        images = [q.path for q in queries]
+        ext = os.path.splitext(images[0])[1]
+        for i in range(len(queries), batch):
+            pad = os.path.join(QUERY_DIR, f"pad{i}{ext}")
+            shutil.copyfile(images[0], pad)
+            images.append(pad)
+        print(f"Running a batch of {len(queries)} queries ({batch - len(queries)} padding)")
+        result = subprocess.run(["./client-online.sh"] + images)
+
+        for q in queries:
+            out = output_file(q.path)
+            if result.returncode == 0 and os.path.exists(out):
+                with open(out, "rb") as f:
+                    q.output = f.read()
+            q.done.set()
+        # the uploads and what client-online.sh made of them
+        for image in images:
+            stem = os.path.splitext(os.path.basename(image))[0]
+            for f in (image, os.path.basename(image), stem + ".npy", stem + ".inp", output_file(image)):
+                if os.path.exists(f):
+                    os.remove(f)
+
+
+class Handler(http.server.BaseHTTPRequestHandler):
+    count = 0
+    count_lock = threading.Lock()
+
+    def do_POST(self):
+        url = urllib.parse.urlparse(self.path)
+        if url.path != "/inference":
+            self.send_error(404)
+            return
+        name = urllib.parse.parse_qs(url.query).get("name", ["image"])[0]
+        with Handler.count_lock:
+            Handler.count += 1
+            n = Handler.count
+        # unique names, so that the outputs of a batch do not collide
+        path = os.path.join(QUERY_DIR, f"query{n}{os.path.splitext(name)[1]}")
+        with open(path, "wb") as f:
+            f.write(self.rfile.read(int(self.headers["Content-Length"])))
+
+        q = Query(path)
+        with pending_cv:
+            pending.append(q)
+            pending_cv.notify()
+        q.done.wait()
+
+        if q.output is None:
+            self.send_error(500, "Inference failed")
+            return
+        self.send_response(200)
+        self.send_header("Content-Type", "text/plain")
+        self.send_header("Content-Length", str(len(q.output)))
+        self.end_headers()
+        self.wfile.write(q.output)
+
+
+def main():
+    os.makedirs(QUERY_DIR, exist_ok=True)
+    threading.Thread(target=run_batches, daemon=True).start()
+    httpd = http.server.ThreadingHTTPServer(("", port), Handler)
+    print(f"Collecting batches of {batch} queries at localhost:{port}")
+    httpd.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
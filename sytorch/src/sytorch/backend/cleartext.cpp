@@ -1,12 +1,33 @@
 
 #include <sytorch/backend/cleartext.h>
+#include <utils/ring_gemm.h>
 #include <Eigen/Dense>
+#include <type_traits>
+
+// Integer products wrap mod 2^64 (or 2^32), so they go through the ring GEMM
+// on the unsigned type of the same width; floating point stays on Eigen.
+template <typename T>
+using RingType = std::conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
+
+template <typename T>
+static inline bool ringMatmul(u64 m, u64 n, u64 k, const T *a, const T *b, T *c, bool transA, bool transB)
+{
+    if constexpr (std::is_integral<T>::value) {
+        ring_gemm::matmul<RingType<T>>(m, n, k, (const RingType<T> *)a, (const RingType<T> *)b, (RingType<T> *)c, transA, transB);
+        return true;
+    }
+    return false;
+}
 
 template <typename T>
 void ClearText<T>::matmul(const Tensor2D<T> &a, const Tensor2D<T> &b, Tensor2D<T> &c) {
     assert(a.d2 == b.d1);
     assert(c.d1 == a.d1);
     assert(c.d2 == b.d2);
+    if (ringMatmul(a.d1, b.d2, a.d2, a.data, b.data, c.data, false, false)) {
+        modbw(c);
+        return;
+    }
     Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> eA(a.data, a.d1, a.d2);
     Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> eB(b.data, b.d1, b.d2);
     Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> eC(c.data, c.d1, c.d2);
@@ -20,6 +41,10 @@ void ClearText<T>::matmulTransposeA(const Tensor2D<T> &a, const Tensor2D<T> &b,
     assert(c.d1 == a.d2);
     assert(c.d2 == b.d2);
 //    c.zero();
+    if (ringMatmul(a.d2, b.d2, a.d1, a.data, b.data, c.data, true, false)) {
+        modbw(c);
+        return;
+    }
     Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor>> eA(a.data, a.d2, a.d1);
     Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> eB(b.data, b.d1, b.d2);
     Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> eC(c.data, c.d1, c.d2);
@@ -32,6 +57,10 @@ void ClearText<T>::matmulTransposeB(const Tensor2D<T> &a, const Tensor2D<T> &b,
     assert(a.d2 == b.d2);
     assert(c.d1 == a.d1);
     assert(c.d2 == b.d1);
+    if (ringMatmul(a.d1, b.d1, a.d2, a.data, b.data, c.data, false, true)) {
+        modbw(c);
+        return;
+    }
     Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> eA(a.data, a.d1, a.d2);
     Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor>> eB(b.data, b.d2, b.d1);
     Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> eC(c.data, c.d1, c.d2);
@@ -52,6 +81,14 @@ void ClearText<T>::conv2D(u64 fh, u64 fw, u64 padding, u64 stride, u64 ci, u64 c
     assert(output.d3 == newW);
     assert(output.d4 == co);
 
+    if constexpr (std::is_integral<T>::value) {
+        // im2col happens while packing, straight into the NHWC output
+        ring_gemm::conv2d<RingType<T>>(input.d1, input.d2, input.d3, ci, fh, fw, co, padding, padding, stride, stride, newH, newW,
+            (const RingType<T> *)input.data, (const RingType<T> *)filter.data, (RingType<T> *)output.data);
+        modbw(output);
+        return;
+    }
+
     Tensor2D<T> reshapedInput = reshapeInputTransposed<T>(input, padding, stride, fh, fw);
     Tensor2D<T> tempOutput(filter.d1, reshapedInput.d1);
     matmulTransposeB(filter, reshapedInput, tempOutput);
@@ -323,7 +360,8 @@ void ClearText<T>::maxPool2D(u64 ks, u64 padding, u64 stride, const Tensor4D<T>
                             T val = 0;
                             if (h2 < in.d2 && w2 < in.d3 && h2 >= 0 && w2 >= 0)
                                 val = in(i, h2, w2, l);
-                            if(val > max) {
+                            // ties go to the later element, as in LLAMA's maxpool
+                            if(val >= max) {
                                 max = val;
                                 maxIdxI = m;
                                 maxIdxJ = n;
@@ -331,7 +369,8 @@ void ClearText<T>::maxPool2D(u64 ks, u64 padding, u64 stride, const Tensor4D<T>
                         }
                     }
                     out(i, j, k, l) = max;
-                    maxIdx(i, j, k, l) = maxIdxI * ks + maxIdxJ;
+                    if (maxIdx.d1 != 0)
+                        maxIdx(i, j, k, l) = maxIdxI * ks + maxIdxJ;
                 }
             }
         }
@@ -261,7 +261,8 @@ void FloatClearText<T>::maxPool2D(u64 ks, u64 padding, u64 stride, const Tensor4
                         }
                     }
                     out(i, j, k, l) = max;
-                    maxIdx(i, j, k, l) = maxIdxI * ks + maxIdxJ;
+                    if (maxIdx.d1 != 0)
+                        maxIdx(i, j, k, l) = maxIdxI * ks + maxIdxJ;
                 }
             }
         } });
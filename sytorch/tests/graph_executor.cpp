@@ -0,0 +1,163 @@
+// Three-branch conv/ReLU net with add, concat and a padded 3x3 maxpool, for
+// checking that the graph executor (SytorchModule::forwardGraph) computes what
+// _forward does:
+//
+//   graph-executor 0 <graph> <train>     ClearText, prints the output
+//   graph-executor 1 <graph> <train>     LLAMA dealer, writes server.dat and client.dat
+//   graph-executor 2 <graph> <train>     LLAMA server
+//   graph-executor 3 <graph> <train>     LLAMA client, prints the output
+//
+// <graph> is 1 for the graph executor and 0 for _forward. With <train> 1 the
+// net runs in training mode and the maxpool's argmax is printed after the
+// output: ClearText's maxIndex directly, LLAMA's decoded from its one-hot.
+// tests/graph_executor.sh runs all of them and compares the outputs.
+
+#include <sytorch/backend/llama_extended.h>
+#include <sytorch/layers/layers.h>
+#include <sytorch/module.h>
+#include <sytorch/utils.h>
+
+template <typename T>
+class ThreeBranch : public SytorchModule<T> {
+public:
+    Conv2D<T> *conv1, *conv2, *conv3;
+    ReLU<T> *relu1, *relu2, *relu3;
+    MaxPool2D<T> *maxpool;
+    Flatten<T> *flatten;
+    FC<T> *fc;
+
+    ThreeBranch()
+    {
+        conv1 = new Conv2D<T>(3, 4, 3, 1, 1, true);
+        conv2 = new Conv2D<T>(3, 4, 1, 0, 1, true);
+        conv3 = new Conv2D<T>(3, 4, 3, 1, 1, false);
+        relu1 = new ReLU<T>();
+        relu2 = new ReLU<T>();
+        relu3 = new ReLU<T>();
+        // 9 leaves, so every level of MaxPoolTree but the last carries one up
+        maxpool = new MaxPool2D<T>(3, 1, 1);
+        flatten = new Flatten<T>();
+        fc = new FC<T>(8 * 8 * 8, 10, true);
+    }
+
+    Tensor<T> &_forward(Tensor<T> &input)
+    {
+        auto &a = relu1->forward(conv1->forward(input));
+        auto &b = relu2->forward(conv2->forward(input));
+        auto &c = relu3->forward(conv3->forward(input));
+        auto &s = this->add(b, c);
+        auto &d = this->concat(a, s);
+        return fc->forward(flatten->forward(maxpool->forward(d)));
+    }
+};
+
+template <typename T>
+void fillInput(Tensor<T> &x)
+{
+    for (u64 i = 0; i < x.size(); ++i) {
+        x.data[i] = (i * 37 % 103) << 4;
+    }
+}
+
+// Position in the window of each maxpool output, from ClearText's maxIndex
+void printArgmax(const Tensor4D<u64> &maxIndex)
+{
+    for (u64 i = 0; i < maxIndex.d1 * maxIndex.d2 * maxIndex.d3 * maxIndex.d4; ++i) {
+        std::cout << maxIndex.data[i] << "\n";
+    }
+}
+
+// Same, from LLAMA's revealed one-hot: ks*ks masked bits per output, window
+// position major. Prints -1 if no bit is set and -2 if more than one is.
+void printArgmax(const Tensor4D<u64> &oneHot, u64 ks)
+{
+    u64 K = ks * ks;
+    u64 S = oneHot.d1 * oneHot.d2 * oneHot.d3 * oneHot.d4 / K;
+    for (u64 i = 0; i < S; ++i) {
+        int idx = -1;
+        for (u64 f = 0; f < K; ++f) {
+            if (oneHot.data[f * S + i] & 1) {
+                idx = (idx == -1) ? f : -2;
+            }
+        }
+        std::cout << idx << "\n";
+    }
+}
+
+int main(int __argc, char **__argv)
+{
+    if (__argc < 4) {
+        std::cerr << "usage: " << __argv[0] << " <party 0|1|2|3> <graph 0|1> <train 0|1>" << std::endl;
+        return 1;
+    }
+    sytorch_init();
+    srand(7);
+
+    int party = atoi(__argv[1]);
+    bool graph = atoi(__argv[2]);
+    bool train = atoi(__argv[3]);
+    const u64 scale = 12;
+
+    if (party == 0) {
+        ThreeBranch<i64> net;
+        net.init(scale);
+        if (train) {
+            net.train();
+        }
+        net.debug = !graph;
+        Tensor<i64> input({1, 8, 8, 3});
+        fillInput(input);
+        net.forward(input);
+        print(net.activation, scale, 64);
+        if (train) {
+            printArgmax(net.maxpool->maxIndex);
+        }
+        return 0;
+    }
+
+    LlamaConfig::bitlength = 40;
+    LlamaConfig::party = party;
+    LlamaConfig::num_threads = 1;
+    LlamaConfig::serverKnownWeights = true;
+
+    using LlamaVersion = LlamaExtended<u64>;
+    LlamaVersion *llama = new LlamaVersion();
+    llama->init("127.0.0.1", false, false);
+
+    ThreeBranch<u64> net;
+    net.init(scale);
+    net.setBackend(llama);
+    net.optimize();
+    if (train) {
+        net.train();
+    }
+    net.debug = !graph;
+    if (party == DEALER) {
+        net.zero();
+    }
+    llama->initializeInferencePartyA(net.root);
+
+    Tensor<u64> input({1, 8, 8, 3});
+    if (party == CLIENT) {
+        fillInput(input);
+    }
+    llama->initializeInferencePartyB(input);
+
+    llama::start();
+    net.forward(input);
+    llama::end();
+
+    llama->outputA(net.activation);
+    auto &oneHot = net.maxpool->maxIndex;
+    if (train) {
+        llama->outputA(oneHot.data, oneHot.d1 * oneHot.d2 * oneHot.d3 * oneHot.d4);
+    }
+    if (party == CLIENT) {
+        print(net.activation, scale, LlamaConfig::bitlength);
+        if (train) {
+            printArgmax(oneHot, net.maxpool->ks);
+        }
+    }
+    llama->finalize();
+    return 0;
+}
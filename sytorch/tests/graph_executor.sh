@@ -0,0 +1,36 @@
+#!/bin/bash
+# Runs graph-executor (tests/graph_executor.cpp) with ClearText and with LLAMA,
+# each through _forward and through the graph executor, in inference and in
+# training mode, and fails unless all four outputs of each mode are the same
+#
+#   graph_executor.sh <path to graph-executor>
+
+set -e
+bin=$(realpath "$1")
+dir=$(mktemp -d)
+trap 'rm -rf "$dir"' EXIT
+cd "$dir"
+
+for train in 0 1; do
+    for graph in 0 1; do
+        out=${train}_$graph
+        "$bin" 0 $graph $train > cleartext_$out.txt
+        "$bin" 1 $graph $train > /dev/null 2>&1
+        "$bin" 2 $graph $train > /dev/null 2>&1 &
+        server=$!
+        "$bin" 3 $graph $train > llama_$out.txt 2> /dev/null
+        wait $server
+    done
+done
+
+status=0
+for train in 0 1; do
+    for f in cleartext_${train}_1.txt llama_${train}_0.txt llama_${train}_1.txt; do
+        if ! cmp -s cleartext_${train}_0.txt $f; then
+            echo "$f differs from cleartext_${train}_0.txt"
+            diff cleartext_${train}_0.txt $f | head -n 10
+            status=1
+        fi
+    done
+done
+exit $status